@@ -0,0 +1,69 @@
+"""生成 src/utils/pinyin_table.c
+
+汉字的拼音顺序取自 CLDR 的 zh pinyin 排序规则（Perl 自带的 Unicode::Collate::CJK::Pinyin
+即为该规则的数据）。数据按拼音顺序列出汉字，每个声母组前有一个 FDD0-00XX 形式的拉丁字母标记。
+按出现顺序为字母标记和汉字编号，程序中按编号比较即得拼音顺序。
+
+用法: python3 data_gen/gen_pinyin_table.py [Pinyin.pm路径] > src/utils/pinyin_table.c
+"""
+import glob
+import sys
+
+FIRST = 0x4E00
+LAST = 0x9FA5
+
+
+def find_source():
+    if len(sys.argv) > 1:
+        return sys.argv[1]
+    paths = glob.glob("/usr/share/perl*/**/Unicode/Collate/CJK/Pinyin.pm", recursive=True)
+    if not paths:
+        sys.exit("找不到 Unicode/Collate/CJK/Pinyin.pm，请指定路径")
+    return paths[0]
+
+
+def main():
+    text = open(find_source(), encoding="utf-8").read()
+    data = text.split("__DATA__\n", 1)[1].split("__END__", 1)[0]
+
+    ranks = {}
+    letters = {}
+    rank = 0
+    for token in data.split():
+        rank += 1
+        if "-" in token:
+            letters[chr(int(token.split("-")[1], 16))] = rank
+        else:
+            ranks[int(token, 16)] = rank
+
+    if rank > 0xFFFF:
+        sys.exit("编号超出16位")
+
+    out = sys.stdout
+    out.write("// 由 data_gen/gen_pinyin_table.py 生成，请勿手工修改\n")
+    out.write('#include "utils/pinyin.h"\n\n')
+
+    out.write("// 拉丁字母A-Z在拼音顺序中的位置，0表示没有以该字母开头的拼音\n")
+    out.write("const uint16_t PINYIN_LETTER_RANKS[26] = {\n   ")
+    for i in range(26):
+        out.write(" %d," % letters.get(chr(ord("A") + i), 0))
+    out.write("\n};\n\n")
+
+    extra = sorted(cp for cp in ranks if cp < FIRST or cp > LAST)
+    out.write("// 表范围之外的汉字\n")
+    out.write("const uint32_t PINYIN_EXTRA[PINYIN_EXTRA_COUNT][2] = {\n")
+    for cp in extra:
+        out.write("    {0x%04X, %d},\n" % (cp, ranks[cp]))
+    out.write("};\n\n")
+
+    out.write("// U+%04X至U+%04X各汉字在拼音顺序中的位置，0表示不在表中\n" % (FIRST, LAST))
+    out.write("const uint16_t PINYIN_RANKS[PINYIN_LAST - PINYIN_FIRST + 1] = {\n")
+    values = [ranks.get(cp, 0) for cp in range(FIRST, LAST + 1)]
+    for i in range(0, len(values), 12):
+        out.write("    " + " ".join("%d," % v for v in values[i:i + 12]) + "\n")
+    out.write("};\n")
+    sys.stderr.write("汉字 %d 个，表外 %d 个\n" % (len(ranks), len(extra)))
+
+
+if __name__ == "__main__":
+    main()
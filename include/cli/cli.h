@@ -0,0 +1,25 @@
+#ifndef CLI_H
+#define CLI_H
+
+#include "db/database.h"
+#include <stdio.h>
+
+// 命令行模式退出码
+#define CLI_EXIT_OK 0      // 成功
+#define CLI_EXIT_FAILURE 1 // 执行失败
+#define CLI_EXIT_USAGE 2   // 命令或参数错误
+
+/*
+ * 命令行（无交互）模式入口，供cron等批处理调用，直接调用模型层，不显示任何交互界面。
+ *
+ *   pms [--db 路径] [--socket 路径] [--format tsv|csv|json] [--quiet] <命令> [参数]
+ *
+ * 结果以表格形式写到标准输出（默认TSV，首行为列名），提示和错误信息写到标准错误。
+ */
+int cli_main(int argc, char *argv[]);
+
+// 在给定连接上执行一条命令（argv从可选的--format开始），结果写到out，错误信息写到err，返回退出码。
+// 本地服务的工作线程也通过它执行客户端发来的命令
+int cli_execute(Database *db, int argc, char *argv[], FILE *out, FILE *err);
+
+#endif /* CLI_H */
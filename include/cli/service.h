@@ -0,0 +1,37 @@
+#ifndef SERVICE_H
+#define SERVICE_H
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#define SERVICE_SOCKET_FILENAME "pms.sock"     // 数据目录下的默认套接字文件名
+#define SERVICE_MAX_FRAME (16 * 1024 * 1024)   // 单帧最大字节数
+#define SERVICE_QUEUE_CAPACITY 1024            // 在途请求上限，超出时直接回复繁忙
+
+/*
+ * 本地服务协议（Unix域套接字，整数均为大端序），每帧以4字节长度开头，长度不含自身：
+ *
+ *   请求：length | request_id | 参数1\0参数2\0...
+ *   响应：length | request_id | exit_code | output_length | 结果 | 错误信息
+ *
+ * 参数即命令行模式中命令及其参数（可以--format开头），结果与命令行模式的标准输出相同。
+ * 前台操作（owners find、rooms list、bills list、pay）与批处理命令一样经此协议调用。
+ * 同一连接可连续发送多个请求，响应按完成顺序返回，以request_id对应。
+ *
+ * 服务以服务账户的权限读写文件：带文件路径的选项（--out、--output、--owners等）须为绝对路径，
+ * 且只接受与服务同一用户（或root）的对端发出；service_call会先把这些路径解析为绝对路径。
+ */
+
+// 启动服务并阻塞，收到SIGINT或SIGTERM后等待在途请求完成再退出；worker_count<=0时使用CPU核数
+bool service_run(const char *db_path, const char *socket_path, int worker_count);
+
+// 客户端：发送一条命令，结果写到out，错误信息写到err，返回命令的退出码
+int service_call(const char *socket_path, int argc, char *argv[], FILE *out, FILE *err);
+
+// 前台终端：从in逐行读取命令，经一个常驻连接发给服务，结果写到out，输入exit或quit结束
+int service_desk(const char *socket_path, FILE *in, FILE *out, FILE *err);
+
+// 压测：argv为[--requests N] [--connections C] 命令 [参数]，多个连接并发重复发送同一命令，统计吞吐和延迟
+int service_bench(const char *socket_path, int argc, char *argv[], FILE *out);
+
+#endif /* SERVICE_H */
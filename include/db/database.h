@@ -5,25 +5,46 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+// 数据目录下的数据库文件名
+#define DB_FILENAME "property_management.db"
+
+// 预编译语句缓存容量：目前共31条语句经db_prepare_cached执行，留出余量；
+// 超出容量时淘汰最久未用的语句，不会失败
+#define DB_STMT_CACHE_SIZE 48
+
 // 数据库连接句柄
 typedef struct
 {
     sqlite3 *db;
     char *db_path;
+    const char *stmt_sql[DB_STMT_CACHE_SIZE];     // 缓存语句的SQL文本（按指针区分）
+    sqlite3_stmt *stmt_cache[DB_STMT_CACHE_SIZE]; // 预编译语句缓存
+    unsigned long stmt_used[DB_STMT_CACHE_SIZE];  // 各语句最近一次取用的序号
+    unsigned long stmt_clock;                     // 取用序号计数
 } Database;
 
 // 初始化数据库
 int db_init(Database *db, const char *db_path);
 
+// 打开已初始化的数据库（不建表、不输出提示），供后台线程和服务工作线程使用
+int db_open(Database *db, const char *db_path, int busy_timeout_ms);
+
 // 关闭数据库
 void db_close(Database *db);
 
+// 关闭数据库（不输出提示）
+void db_close_quiet(Database *db);
+
 // 执行SQL语句
 int db_execute(Database *db, const char *sql);
 
 // 准备SQL语句
 int db_prepare(Database *db, const char *sql, sqlite3_stmt **stmt);
 
+// 获取缓存的预编译语句，sql须为静态字符串；使用完毕后调用sqlite3_reset，
+// 缓存满时会淘汰其他空闲语句，因此不要跨越下一次db_prepare_cached持有未在执行的语句
+int db_prepare_cached(Database *db, const char *sql, sqlite3_stmt **stmt);
+
 // 数据库备份
 int db_backup(Database *db, const char *backup_path);
 
@@ -33,4 +33,16 @@ int db_init_admin(Database *db);
  */
 int db_init_staff(Database *db);
 
+/**
+ * db_set_name_sort_key
+ *
+ * 按姓名计算并写入用户的拼音排序键（users.name_sort_key），新增用户或修改姓名后调用
+ *
+ * @param db 数据库连接指针
+ * @param user_id 用户ID
+ * @param name 用户姓名
+ * @return SQLITE_OK 表示成功，其他值表示失败
+ */
+int db_set_name_sort_key(Database *db, const char *user_id, const char *name);
+
 #endif /* DB_INIT_H */
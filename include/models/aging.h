@@ -0,0 +1,76 @@
+#ifndef AGING_H
+#define AGING_H
+
+#include "db/database.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+#define AGING_MAX_BOUNDS 7   // 分档边界上限，最多8个分档
+#define AGING_MAX_BUCKETS (AGING_MAX_BOUNDS + 1)
+#define AGING_TYPE_SLOTS 8   // 费用类型槽位：1-6对应费用类型，7为其他费用，0不使用
+
+// 账龄分档：bounds为各档上限天数（递增），最后一档无上限
+typedef struct
+{
+    int bound_count;
+    int bounds[AGING_MAX_BOUNDS];
+} AgingConfig;
+
+// 默认分档：0-30、31-60、61-90、91-180、180天以上
+#define AGING_CONFIG_DEFAULT {4, {30, 60, 90, 180}}
+
+// 一个矩阵单元
+typedef struct
+{
+    long bill_count;
+    double amount;
+} AgingCell;
+
+/*
+ * 账龄矩阵：楼宇 x 费用类型 x 账龄分档。
+ * 楼宇0为未分配楼宇的账单，其余按楼宇名称排序。账龄按截止日期计算，未到期账单计入第一档。
+ */
+typedef struct
+{
+    AgingConfig config;
+    int bucket_count;
+    char bucket_names[AGING_MAX_BUCKETS][24];
+
+    int building_count;
+    char (*building_names)[64];
+    AgingCell *cells; // [building][fee_slot][bucket]
+
+    // 汇总
+    AgingCell by_bucket[AGING_MAX_BUCKETS];
+    AgingCell by_type[AGING_TYPE_SLOTS];
+    int bucket_users[AGING_MAX_BUCKETS]; // 各分档去重业主数
+    int type_users[AGING_TYPE_SLOTS];    // 各费用类型去重业主数
+    AgingCell total;
+    int total_users;
+
+    long row_count;
+    double load_seconds;   // 读取列数据耗时
+    double bucket_seconds; // 分档计算耗时
+} AgingMatrix;
+
+// 矩阵单元下标
+#define AGING_CELL(m, building, slot, bucket) \
+    ((m)->cells[((size_t)(building) * AGING_TYPE_SLOTS + (slot)) * (m)->bucket_count + (bucket)])
+
+// 校验分档边界并生成分档名称，边界须为正且严格递增
+bool aging_config_valid(const AgingConfig *config);
+
+// 解析"30,60,90,180"形式的分档边界
+bool parse_aging_bounds(const char *text, AgingConfig *config);
+
+// 读取全部未缴（含逾期）账单为列数据并计算账龄矩阵
+bool build_aging_matrix(Database *db, const AgingConfig *config, time_t now, AgingMatrix *matrix);
+
+// 打印账龄矩阵：分档汇总、费用类型 x 分档、楼宇 x 分档
+void print_aging_matrix(const AgingMatrix *matrix);
+
+// 释放账龄矩阵
+void free_aging_matrix(AgingMatrix *matrix);
+
+#endif /* AGING_H */
@@ -0,0 +1,30 @@
+#ifndef ANALYTICS_H
+#define ANALYTICS_H
+
+#include "db/database.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define ANALYTICS_TABLE_COUNT 4
+
+// 单个表的导出结果
+typedef struct
+{
+    const char *table; // 表名，文件名为"表名.arrow"
+    int64_t rows;
+    int64_t bytes;
+} AnalyticsTableSummary;
+
+// 快照导出结果
+typedef struct
+{
+    AnalyticsTableSummary tables[ANALYTICS_TABLE_COUNT];
+    int table_count;
+    int64_t total_bytes;
+    double elapsed_seconds;
+} AnalyticsSnapshotSummary;
+
+// 在同一个读事务内把transactions、rooms、users、buildings导出为out_dir下的Arrow IPC文件
+bool export_analytics_snapshot(Database *db, const char *out_dir, AnalyticsSnapshotSummary *summary);
+
+#endif /* ANALYTICS_H */
@@ -5,6 +5,7 @@
 #include "db/db_query.h"
 #include "auth/auth.h"
 #include <stdbool.h>
+#include <time.h>
 
 // 房屋信息
 typedef struct
@@ -36,4 +37,7 @@ bool list_rooms_by_building(Database *db, const char *user_id, UserType user_typ
 // 查询业主的房屋
 bool get_owner_rooms(Database *db, const char *user_id, UserType user_type, const char *owner_id, QueryResult *result);
 
+// 变更房屋业主并记录持有期，effective_date为过户生效日期；owner_id为空表示业主迁出
+bool transfer_room_owner(Database *db, const char *room_id, const char *owner_id, time_t effective_date);
+
 #endif /* APARTMENT_H */
@@ -0,0 +1,92 @@
+#ifndef BILLING_H
+#define BILLING_H
+
+#include "db/database.h"
+#include <stdbool.h>
+#include <time.h>
+
+// 出账预览默认列出的大额账单数
+#define BILLING_PREVIEW_TOP_N 10
+
+// 一次按面积计费的出账参数
+typedef struct
+{
+    int fee_type;        // 费用类型
+    time_t period_start; // 账期首日
+    time_t period_end;   // 账期末日（含）
+    time_t due_date;     // 缴费截止日期
+    double rate;         // 单价（元/㎡/整个账期）
+} BillingRun;
+
+// 出账结果
+typedef struct
+{
+    int bill_count;      // 生成的账单数
+    int prorated_count;  // 其中按持有天数折算的账单数
+    double total_amount; // 生成的账单总额
+} BillingSummary;
+
+// 预览：单个楼宇的出账汇总
+typedef struct
+{
+    char building_id[40];
+    char building_name[64];
+    int bill_count;
+    int prorated_count;
+    double total_amount;
+} BillingBuildingTotal;
+
+// 预览：单张账单
+typedef struct
+{
+    char user_id[40];
+    char owner_name[64];
+    char room_id[40];      // 房屋ID，停车费为车位ID
+    char building_name[64];
+    char room_number[20];  // 房号，停车费为车位编号
+    int days;      // 计费天数，非按天计费的账单为0
+    double amount;
+} BillingPreviewItem;
+
+// 出账预览结果（只读，不写入任何数据）
+typedef struct
+{
+    BillingSummary summary;
+    BillingBuildingTotal *buildings; // 按楼宇名称排序
+    int building_count;
+    BillingPreviewItem *top_items;   // 金额最大的账单，按金额降序
+    int top_count;
+    double elapsed_seconds;
+} BillingPreview;
+
+// 出账互斥锁（可重入）：出账、滞纳金计提期间持有，后台维护任务运行时也持有，两者不会同时进行
+void billing_lock(void);
+bool billing_trylock(void);
+void billing_unlock(void);
+
+// 获取某费用类型在指定日期生效的单价
+bool get_billing_rate(Database *db, int fee_type, time_t as_of, double *rate);
+
+// 按房屋持有期为整个小区出账：账期内业主变更的房屋按各业主持有天数拆分，已出账的不重复生成
+bool run_room_billing(Database *db, const BillingRun *run, BillingSummary *summary);
+
+// 出账预览：与run_room_billing使用同一明细查询，在只读快照上计算全部账单，不写入任何数据
+bool preview_room_billing(Database *db, const BillingRun *run, int top_n, BillingPreview *preview);
+
+// 停车费出账：每个有业主的车位按整期单价一张账单，已出账的不重复生成
+bool run_parking_billing(Database *db, const BillingRun *run, BillingSummary *summary);
+
+// 停车费出账预览：与run_parking_billing使用同一明细查询，不写入任何数据
+bool preview_parking_billing(Database *db, const BillingRun *run, int top_n, BillingPreview *preview);
+
+// 汇总账单明细查询结果生成预览，各出账引擎的预览共用
+// 明细列依次为：user_id, room_id（或parking_id）, building_id, days, amount, prorated（0/1）
+bool collect_billing_preview(Database *db, sqlite3_stmt *line_items, int top_n, BillingPreview *preview);
+
+// 打印出账预览
+void print_billing_preview(const BillingPreview *preview);
+
+// 释放出账预览
+void free_billing_preview(BillingPreview *preview);
+
+#endif /* BILLING_H */
@@ -0,0 +1,56 @@
+#ifndef BULK_IMPORT_H
+#define BULK_IMPORT_H
+
+#include "db/database.h"
+#include <stdbool.h>
+
+// 未提供密码列或密码为空时使用的初始密码，与重置密码一致
+#define IMPORT_DEFAULT_PASSWORD "default_password"
+
+// 要导入的文件，不导入的项为NULL
+typedef struct
+{
+    const char *owners_path;
+    const char *rooms_path;
+    const char *parking_path;
+} ImportFiles;
+
+// 单个文件的导入结果
+typedef struct
+{
+    long row_count;      // 数据行数（不含表头和空行）
+    long imported_count; // 写入数据库的行数
+    long rejected_count; // 写入拒绝报告的行数
+} ImportFileSummary;
+
+typedef struct
+{
+    ImportFileSummary owners;
+    ImportFileSummary rooms;
+    ImportFileSummary parking;
+    double elapsed_seconds;
+} ImportSummary;
+
+/*
+ * 各文件均为CSV格式，首行为表头，按列名识别（不区分大小写）：
+ * 业主文件
+ *   username / 用户名      登录用户名，不能与已有用户重复
+ *   name / 姓名
+ *   phone / 手机号         可选
+ *   email / 邮箱           可选
+ *   password / 初始密码    可选，为空时使用IMPORT_DEFAULT_PASSWORD
+ * 房屋文件
+ *   building / 楼宇        楼宇ID或楼宇名称，须已存在
+ *   room_number / 房号     同一楼宇内不能重复
+ *   floor / 楼层
+ *   area / 面积            平方米
+ *   owner / 业主           可选，业主用户名或用户ID（可为本次导入的业主）
+ * 车位文件
+ *   parking_number / 车位号  不能重复
+ *   owner / 业主             可选，同上
+ */
+
+// 按业主、房屋、车位的顺序导入，校验不通过的行写入拒绝报告，其余行在同一事务内写入
+bool bulk_import(Database *db, const ImportFiles *files, const char *report_path, ImportSummary *summary);
+
+#endif /* BULK_IMPORT_H */
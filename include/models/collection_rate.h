@@ -0,0 +1,43 @@
+#ifndef COLLECTION_RATE_H
+#define COLLECTION_RATE_H
+
+#include "db/database.h"
+#include <stdbool.h>
+
+// 一个月份的收缴率，账单按账期开始月份归属
+typedef struct
+{
+    int month;            // YYYYMM
+    double billed_amount; // 应缴金额
+    double paid_amount;   // 已缴金额
+    long bill_count;
+    long paid_count;
+    bool has_rate;        // 该月有应缴金额
+    double rate;          // 收缴率（已缴/应缴，按金额）
+    bool has_mom;         // 上月有收缴率
+    double mom_delta;     // 较上月变化
+    bool has_yoy;         // 去年同月有收缴率
+    double yoy_delta;     // 较去年同月变化
+} CollectionRatePoint;
+
+typedef struct
+{
+    CollectionRatePoint *points; // 按月份升序
+    int count;
+    int recomputed;              // 本次重算的月份数
+    double elapsed_seconds;
+} CollectionRateSeries;
+
+// 刷新立方体并重算被改动的月份，recomputed可为NULL
+bool refresh_collection_rates(Database *db, int *recomputed);
+
+// 查询[month_from, month_to]区间内的收缴率序列（查询前先增量刷新），区间端点为YYYYMM
+bool query_collection_rates(Database *db, int month_from, int month_to, CollectionRateSeries *series);
+
+// 打印收缴率表格及按年分行的走势图
+void print_collection_rates(const CollectionRateSeries *series);
+
+// 释放收缴率序列
+void free_collection_rates(CollectionRateSeries *series);
+
+#endif /* COLLECTION_RATE_H */
@@ -0,0 +1,70 @@
+#ifndef FEE_CUBE_H
+#define FEE_CUBE_H
+
+#include "db/database.h"
+#include <stdbool.h>
+
+// 汇总维度，可按位组合；未选中的维度被上卷（roll-up）
+#define CUBE_BY_BUILDING 0x01
+#define CUBE_BY_FEE_TYPE 0x02
+#define CUBE_BY_MONTH 0x04
+#define CUBE_BY_YEAR 0x08 // 月份上卷到年，与CUBE_BY_MONTH同时指定时以月份为准
+#define CUBE_BY_METHOD 0x10
+
+#define CUBE_ANY (-1) // 过滤条件不限
+
+// 切片/切块条件，CUBE_ANY或NULL表示不限
+typedef struct
+{
+    const char *building_name; // 楼宇名称
+    int fee_type;              // 费用类型
+    int month_from;            // 起始月份YYYYMM（含）
+    int month_to;              // 截止月份YYYYMM（含）
+    int payment_method;        // 支付方式，0表示未缴
+} CubeFilter;
+
+#define CUBE_FILTER_ALL {NULL, CUBE_ANY, CUBE_ANY, CUBE_ANY, CUBE_ANY}
+
+// 查询结果的一个单元，未参与汇总的维度为空或CUBE_ANY
+typedef struct
+{
+    char building_name[64];
+    int fee_type;
+    int period;         // 月份YYYYMM或年份YYYY
+    int payment_method;
+    double billed_amount;
+    double paid_amount;
+    double overdue_amount;
+    long bill_count;
+    long paid_count;
+    long overdue_count;
+} CubeCell;
+
+typedef struct
+{
+    unsigned group_by;
+    CubeCell *cells;
+    int count;
+    double elapsed_seconds;
+} CubeResult;
+
+// 一次增量刷新的结果
+typedef struct
+{
+    long change_count;   // 并入的变更条数
+    long long watermark; // 刷新后的水位
+} CubeRefresh;
+
+// 将水位之后的变更并入立方体
+bool refresh_fee_cube(Database *db, CubeRefresh *refresh);
+
+// 按维度汇总查询立方体（查询前先增量刷新）
+bool query_fee_cube(Database *db, unsigned group_by, const CubeFilter *filter, CubeResult *result);
+
+// 打印查询结果
+void print_fee_cube(const CubeResult *result);
+
+// 释放查询结果
+void free_fee_cube_result(CubeResult *result);
+
+#endif /* FEE_CUBE_H */
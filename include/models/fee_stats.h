@@ -0,0 +1,65 @@
+#ifndef FEE_STATS_H
+#define FEE_STATS_H
+
+#include "db/database.h"
+#include <stdbool.h>
+#include <time.h>
+
+#define FEE_STATS_TYPE_SLOTS 8   // 费用类型槽位：1-6对应费用类型，7为其他费用
+#define FEE_STATS_AGING_BUCKETS 3 // 欠费时长分档：30天内、90天内、90天以上
+#define FEE_STATS_TOP_N 10
+
+// 一组账单的汇总
+typedef struct
+{
+    int user_count;  // 去重业主数
+    long bill_count; // 账单笔数
+    double amount;   // 金额合计
+} FeeStatCell;
+
+// 欠费业主排行条目
+typedef struct
+{
+    char user_id[40];
+    char name[64];
+    char phone[24];
+    char building[64];
+    char room[32];
+    long bill_count;
+    double amount;
+} FeeStatOwner;
+
+/*
+ * 缴费统计结果，一次扫描transactions同时得出年度、当前和欠费分析所需的全部数字。
+ * 已缴账单按缴费日期归年，未缴（含逾期）账单按截止日期归年。
+ */
+typedef struct
+{
+    int total_owners;
+
+    // 指定年度
+    int year;
+    FeeStatCell year_paid;
+    FeeStatCell year_unpaid;
+    FeeStatCell year_by_type[FEE_STATS_TYPE_SLOTS]; // 该年度已缴与未缴合计
+    FeeStatOwner year_top_unpaid[FEE_STATS_TOP_N];  // 该年度未缴金额最多的业主
+    int year_top_count;
+
+    // 全部账单
+    FeeStatCell paid;
+    FeeStatCell unpaid;
+    FeeStatCell unpaid_by_type[FEE_STATS_TYPE_SLOTS];
+    FeeStatCell unpaid_by_age[FEE_STATS_AGING_BUCKETS];
+
+    long row_count;   // 扫描的账单数
+    int thread_count; // 扫描线程数
+    double elapsed_seconds;
+} FeeStats;
+
+// 欠费时长分档名称
+extern const char *FEE_STATS_AGING_NAMES[FEE_STATS_AGING_BUCKETS];
+
+// 单次扫描transactions计算缴费统计，按rowid区间分给多个线程并行扫描
+bool collect_fee_stats(Database *db, int year, time_t now, FeeStats *stats);
+
+#endif /* FEE_STATS_H */
@@ -0,0 +1,46 @@
+#ifndef LATE_FEE_H
+#define LATE_FEE_H
+
+#include "db/database.h"
+#include "db/db_query.h"
+#include "models/billing.h"
+#include <stdbool.h>
+#include <time.h>
+
+// 滞纳金规则（存放于fee_standards表，fee_type = TRANS_LATE_FEE）
+typedef struct
+{
+    char standard_id[40];
+    double daily_rate; // 日费率，按欠费本金计算（如0.0005即万分之五）
+    int grace_days;    // 宽限天数，截止日期后宽限期内不计滞纳金
+    double cap_rate;   // 封顶比例，滞纳金不超过本金*cap_rate，0表示不封顶
+} LateFeeRule;
+
+// 一次计提的结果
+typedef struct
+{
+    time_t accrual_date;  // 计提日期（当日零点）
+    int bill_count;       // 本次新增或更新的滞纳金账单数
+    double total_amount;  // 本次计提新增的滞纳金总额
+    bool already_accrued; // 该日期此前已计提过，本次未做任何写入
+} LateFeeAccrual;
+
+// 获取在指定日期生效的滞纳金规则
+bool get_late_fee_rule(Database *db, time_t as_of, LateFeeRule *rule);
+
+// 修改当前滞纳金规则（日费率、宽限期、封顶比例）
+bool update_late_fee_rule(Database *db, const LateFeeRule *rule);
+
+// 按计提日期批量计提滞纳金，同一日期重复执行不会重复计费
+bool accrue_late_fees(Database *db, time_t accrual_date, LateFeeAccrual *accrual);
+
+// 预览指定日期的滞纳金计提结果，不写入任何数据
+bool preview_late_fees(Database *db, time_t accrual_date, int top_n, BillingPreview *preview);
+
+// 按楼宇汇总滞纳金（楼宇名称、账单数、总额、已缴、未缴）
+bool query_late_fees_by_building(Database *db, QueryResult *result);
+
+// 打印按楼宇汇总的滞纳金统计
+void print_late_fee_building_summary(Database *db);
+
+#endif /* LATE_FEE_H */
@@ -0,0 +1,56 @@
+#ifndef LEDGER_H
+#define LEDGER_H
+
+#include "db/database.h"
+#include <stdbool.h>
+#include <time.h>
+
+// 账本中全部费用类型合计行的fee_type
+#define LEDGER_ALL_FEES 0
+
+// 业主账本（owner_ledger表的一行），由交易表触发器维护
+typedef struct
+{
+    char user_id[40];
+    int fee_type;          // 费用类型，LEDGER_ALL_FEES表示合计
+    double billed_amount;  // 累计应缴
+    double paid_amount;    // 累计已缴
+    double overdue_amount; // 当前逾期金额
+    int bill_count;        // 账单数
+    int unpaid_count;      // 未结账单数
+    time_t last_activity;  // 最近一次出账或缴费时间
+} OwnerLedger;
+
+// 欠费排行条目
+typedef struct
+{
+    OwnerLedger ledger;  // 业主在排行口径下的账本，按楼宇排行时只含该楼宇房屋的账单
+    char name[64];
+    char phone[24];
+    char address[64];    // 楼宇-房号
+    char fee_types[128]; // 欠费项目
+    time_t earliest_due; // 最早一笔未结账单的截止日期
+} DebtorRank;
+
+// 账本核对结果
+typedef struct
+{
+    int rows_checked;   // 核对的账本行数
+    int mismatch_count; // 与交易表不一致的行数
+    bool repaired;      // 是否已按交易表重建账本
+} LedgerAudit;
+
+// 读取业主某一费用类型的账本（主键点查），无账单时返回全零账本
+bool get_owner_ledger(Database *db, const char *user_id, int fee_type, OwnerLedger *ledger);
+
+// 读取业主各费用类型的账本（不含合计行），返回行数，出错返回-1
+int get_owner_ledger_by_type(Database *db, const char *user_id, OwnerLedger *ledgers, int max_count);
+
+// 欠费排行：按未结金额降序取前k位业主；fee_type为LEDGER_ALL_FEES时按合计，
+// building_id非NULL时金额只计该楼宇房屋的账单。返回条目数，出错返回-1
+int get_top_debtors(Database *db, int fee_type, const char *building_id, int k, DebtorRank *ranks);
+
+// 核对账本与交易表是否一致并打印差异，repair为true且存在差异时按交易表重建账本
+bool audit_owner_ledger(Database *db, bool repair, LedgerAudit *audit);
+
+#endif /* LEDGER_H */
@@ -0,0 +1,72 @@
+#ifndef OWNER_SORT_H
+#define OWNER_SORT_H
+
+#include "db/database.h"
+#include "utils/row_sort.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// 可排序的业主字段
+typedef enum
+{
+    OWNER_SORT_OUTSTANDING, // 欠费（账本合计行的应缴减已缴）
+    OWNER_SORT_AREA,        // 面积
+    OWNER_SORT_BUILDING,    // 楼宇
+    OWNER_SORT_ROOM,        // 房号
+    OWNER_SORT_REGISTERED,  // 注册时间
+    OWNER_SORT_NAME,        // 姓名
+    OWNER_SORT_FIELD_COUNT
+} OwnerSortField;
+
+typedef struct
+{
+    OwnerSortField field;
+    bool descending;
+} OwnerSortKey;
+
+// 字符串存储块，块内字符串的地址不会变化
+typedef struct OwnerSortText
+{
+    struct OwnerSortText *next;
+    size_t used;
+    size_t size;
+    char data[];
+} OwnerSortText;
+
+/*
+ * 按列存放的业主数据，每位业主一行（多套房屋时取第一套），
+ * 只取排序和显示需要的列；order为排序结果（行号）。
+ */
+typedef struct
+{
+    size_t count;
+    const char **user_ids;
+    const char **names;
+    const char **phones;
+    const char **buildings; // 无房屋时为NULL
+    const char **rooms;
+    double *outstanding;
+    double *areas;
+    uint8_t *area_nulls; // 非零表示无房屋
+    int64_t *registered;
+    uint32_t *order;
+    OwnerSortText *text;
+} OwnerSortTable;
+
+// 解析排序说明，如"outstanding:desc,building,room"或"欠费:降序,楼宇,房号"
+bool owner_sort_parse(const char *spec, OwnerSortKey *keys, int max_keys, int *key_count);
+
+// 字段的中文名称
+const char *owner_sort_field_title(OwnerSortField field);
+
+// 在一个读事务内载入全部业主
+bool owner_sort_load(Database *db, OwnerSortTable *table);
+
+// 按keys排序，结果写入table->order；stats可为NULL
+bool owner_sort_apply(OwnerSortTable *table, const OwnerSortKey *keys, int key_count, RowSortStats *stats);
+
+// 释放业主数据
+void owner_sort_free(OwnerSortTable *table);
+
+#endif /* OWNER_SORT_H */
@@ -0,0 +1,33 @@
+#ifndef RECONCILE_H
+#define RECONCILE_H
+
+#include "db/database.h"
+#include <stdbool.h>
+#include <time.h>
+
+// 对账结果汇总
+typedef struct
+{
+    long line_count;      // 流水条数（不含表头）
+    long matched_count;   // 匹配并入账的条数
+    double matched_amount; // 匹配并入账的金额
+    long replayed_count;  // 此前已对账入账的条数（重复导入）
+    long exception_count; // 写入异常报告的条数
+    double elapsed_seconds;
+} ReconcileSummary;
+
+/*
+ * 对账单为CSV格式，首行为表头，按列名识别（不区分大小写）：
+ *   reference / 参考号 / 备注      账单交易编号，可为空
+ *   amount / 金额                  到账金额（元）
+ *   payer / 付款人 / 手机号        付款人手机号
+ *   serial / 流水号                外部流水号，可选，用作幂等键
+ *   method / 支付方式              cash/card/wechat/alipay 或 现金/银行卡/微信/支付宝，可选
+ *   paid_at / 交易时间             YYYY-MM-DD[ HH:MM:SS]，可选
+ */
+
+// 导入对账单：与未结账单做哈希匹配，匹配成功的流水按支付流程入账，其余写入异常报告
+bool reconcile_statement(Database *db, const char *statement_path, int default_method,
+                         const char *report_path, ReconcileSummary *summary);
+
+#endif /* RECONCILE_H */
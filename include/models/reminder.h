@@ -0,0 +1,112 @@
+#ifndef REMINDER_H
+#define REMINDER_H
+
+#include "db/database.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <time.h>
+
+#define REMINDER_DEDUPE_SECONDS (3 * 24 * 3600)         // 默认去重窗口：3天内已提醒过的业主不再生成
+#define REMINDER_BATCH_SIZE 500                         // 批量生成时每批提交的条数
+#define REMINDER_OUTBOX_FILE "reminder_outbox.log"      // 本地投递文件名，代替短信网关，位于数据库所在目录
+#define REMINDER_MAX_LENGTH 1024                        // 单条提醒内容的最大字节数
+
+// 提醒状态
+#define REMINDER_PENDING 0   // 待投递
+#define REMINDER_DELIVERED 1 // 已投递
+#define REMINDER_FAILED 2    // 投递失败（如无手机号）
+
+/*
+ * 模板占位符：
+ *   {name}            业主姓名
+ *   {amount}          待缴总额
+ *   {overdue_amount}  逾期金额
+ *   {overdue_days}    最长逾期天数
+ *   {fee_types}       欠费类型，以"、"分隔
+ *   {date}            生成日期
+ *   {overdue_notice}  逾期提示段落，仅在有逾期金额时输出，内容由逾期模板渲染
+ */
+typedef enum
+{
+    REMINDER_FIELD_LITERAL = -1,
+    REMINDER_FIELD_NAME,
+    REMINDER_FIELD_AMOUNT,
+    REMINDER_FIELD_OVERDUE_AMOUNT,
+    REMINDER_FIELD_OVERDUE_DAYS,
+    REMINDER_FIELD_FEE_TYPES,
+    REMINDER_FIELD_DATE,
+    REMINDER_FIELD_OVERDUE_NOTICE
+} ReminderField;
+
+// 模板片段：原文片段或占位符
+typedef struct
+{
+    ReminderField field;
+    const char *text; // 原文片段，指向模板副本内部
+    size_t len;
+} ReminderSegment;
+
+// 预编译的提醒模板，编译一次后可反复渲染
+typedef struct
+{
+    char *source;               // 模板文本副本
+    ReminderSegment *body;      // 正文片段
+    int body_count;
+    ReminderSegment *notice;    // 逾期提示片段
+    int notice_count;
+} ReminderTemplate;
+
+// 渲染一条提醒所需的数据
+typedef struct
+{
+    const char *name;
+    double amount;
+    double overdue_amount;
+    int overdue_days;
+    const char *fee_types;
+    time_t date;
+} ReminderValues;
+
+// 一次生成的结果
+typedef struct
+{
+    int owner_count;    // 有欠费的业主数
+    int queued_count;   // 新生成的提醒数
+    int skipped_count;  // 去重窗口内已提醒而跳过的业主数
+    double total_amount; // 新生成提醒涉及的待缴总额
+    double elapsed_seconds;
+} ReminderBatch;
+
+// 一次投递的结果
+typedef struct
+{
+    int delivered_count;
+    int failed_count;
+} ReminderDelivery;
+
+// 默认模板
+extern const char *DEFAULT_REMINDER_TEMPLATE;
+extern const char *DEFAULT_OVERDUE_NOTICE_TEMPLATE;
+
+// 编译模板，未知占位符按原文保留
+bool reminder_template_compile(ReminderTemplate *tpl, const char *body, const char *overdue_notice);
+
+// 渲染模板，返回写入的字节数（不含结尾'\0'），超出缓冲区时截断
+size_t reminder_template_render(const ReminderTemplate *tpl, const ReminderValues *values, char *out, size_t size);
+
+// 释放模板
+void reminder_template_free(ReminderTemplate *tpl);
+
+// 为单个业主生成提醒；去重窗口内已提醒过时跳过（skipped_count为1）
+bool queue_payment_reminder(Database *db, const char *user_id, time_t now, int dedupe_seconds, ReminderBatch *batch);
+
+// 为全部欠费业主批量生成提醒
+bool queue_bulk_payment_reminders(Database *db, time_t now, int dedupe_seconds, ReminderBatch *batch);
+
+// 默认投递文件路径：数据库所在目录下的REMINDER_OUTBOX_FILE
+bool reminder_outbox_path(Database *db, char *buffer, size_t size);
+
+// 将待投递的提醒追加写入本地投递文件，并标记为已投递；outbox_path为NULL时使用默认路径
+bool deliver_pending_reminders(Database *db, const char *outbox_path, ReminderDelivery *delivery);
+
+#endif /* REMINDER_H */
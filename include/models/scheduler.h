@@ -0,0 +1,64 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include "db/database.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+#define SCHEDULER_RETRY_SECONDS 300 // 与出账冲突时推迟的秒数
+#define SCHEDULER_HISTORY_KEEP 200  // 每个任务保留的运行记录条数
+
+// 任务运行状态
+typedef enum
+{
+    JOB_RUNNING = 0,
+    JOB_SUCCEEDED = 1,
+    JOB_FAILED = 2,
+    JOB_SKIPPED = 3
+} JobStatus;
+
+// 解析后的cron计划（分 时 日 月 周），各字段为允许取值的位图
+typedef struct
+{
+    uint64_t minutes;  // 0-59
+    uint32_t hours;    // 0-23
+    uint32_t days;     // 1-31
+    uint16_t months;   // 1-12
+    uint8_t weekdays;  // 0-6，0为周日
+    bool any_day;      // 日字段为*
+    bool any_weekday;  // 周字段为*
+} CronSchedule;
+
+// 解析cron表达式，支持 * 、数值、a-b、列表和 /步长，周字段的7等同于0
+bool cron_parse(const char *text, CronSchedule *schedule);
+
+// 计算after之后（不含）的下一个触发时间（本地时间），四年内无触发时返回0
+time_t cron_next(const CronSchedule *schedule, time_t after);
+
+// 启动后台调度线程，线程使用独立的数据库连接
+bool scheduler_start(const char *db_path);
+
+// 停止调度线程，等待正在运行的任务结束
+void scheduler_stop(void);
+
+// 立即运行任务：下次运行时间置为当前时间并唤醒调度线程
+bool scheduler_run_now(Database *db, const char *job_name);
+
+// 启用或停用任务
+bool scheduler_set_enabled(Database *db, const char *job_name, bool enabled);
+
+// 修改任务计划，表达式无效时返回false
+bool scheduler_set_schedule(Database *db, const char *job_name, const char *schedule);
+
+// 在当前连接上同步运行任务并登记运行记录，message可为NULL
+JobStatus scheduler_run_job(Database *db, const char *job_name, char *message, size_t size);
+
+// 打印全部任务及其计划、下次运行时间和最近一次运行状态
+void print_scheduled_jobs(Database *db);
+
+// 打印运行记录，job_name为NULL时列出全部任务
+void print_job_runs(Database *db, const char *job_name, int limit);
+
+#endif /* SCHEDULER_H */
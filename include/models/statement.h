@@ -0,0 +1,30 @@
+#ifndef STATEMENT_H
+#define STATEMENT_H
+
+#include "db/database.h"
+#include <stdbool.h>
+
+// 对账单文件格式
+typedef enum
+{
+    STATEMENT_TEXT = 1, // 纯文本
+    STATEMENT_HTML = 2, // HTML
+    STATEMENT_CSV = 3   // CSV（UTF-8 BOM）
+} StatementFormat;
+
+// 批量生成结果
+typedef struct
+{
+    int owner_count;        // 业主数
+    int file_count;         // 成功写出的对账单数
+    int failed_count;       // 写出失败的对账单数
+    int building_count;     // 楼宇目录数
+    int thread_count;       // 工作线程数
+    double elapsed_seconds;
+} StatementSummary;
+
+// 为全部业主生成指定月份的对账单，按楼宇分目录写入out_dir
+bool generate_monthly_statements(Database *db, int year, int month, StatementFormat format,
+                                 const char *out_dir, StatementSummary *summary);
+
+#endif /* STATEMENT_H */
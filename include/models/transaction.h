@@ -15,6 +15,7 @@ typedef enum
     TRANS_WATER_FEE = 3,       // 水费
     TRANS_ELECTRICITY_FEE = 4, // 电费
     TRANS_GAS_FEE = 5,         // 燃气费
+    TRANS_LATE_FEE = 6,        // 滞纳金
     TRANS_OTHER = 99           // 其他费用
 } FeeType;
 
@@ -37,6 +38,39 @@ typedef enum
     TRANS_OVERDUE = 2 // 逾期未付
 } TransactionStatus;
 
+// 单笔支付结果
+typedef enum
+{
+    PAY_SUCCESS = 0,  // 支付成功
+    PAY_REPLAYED,     // 幂等键已处理过同一账单，返回首次支付结果
+    PAY_NOT_FOUND,    // 账单不存在或不属于该用户
+    PAY_ALREADY_PAID, // 账单已支付
+    PAY_KEY_CONFLICT, // 幂等键已用于其他账单
+    PAY_ROLLED_BACK,  // 同批其他账单失败，本笔已随整批撤销
+    PAY_FAILED        // 数据库错误
+} PaymentOutcome;
+
+// 批量支付回执中的单笔明细
+typedef struct
+{
+    char transaction_id[40];
+    int fee_type;
+    double amount;
+    PaymentOutcome outcome;
+} PaymentReceiptItem;
+
+// 批量支付回执
+typedef struct
+{
+    char user_id[40];
+    time_t payment_date;
+    int payment_method;
+    int item_count;             // 明细条数
+    int paid_count;             // 成功支付的笔数
+    double total_paid;          // 成功支付的总额
+    PaymentReceiptItem *items;  // 明细
+} PaymentReceipt;
+
 // 费用标准
 typedef struct
 {
@@ -95,6 +129,28 @@ bool get_unpaid_transactions(Database *db, const char *user_id, QueryResult *res
 // 处理用户支付交易
 bool process_payment(Database *db, const char *transaction_id, const char *user_id, int payment_method);
 
+// 以幂等键支付单笔账单，idempotency_key为NULL时不做幂等记录；amount_paid可为NULL
+PaymentOutcome pay_transaction(Database *db, const char *transaction_id, const char *user_id,
+                               int payment_method, const char *idempotency_key, double *amount_paid);
+
+// 批量支付：transaction_ids为NULL时缴清全部欠费，整批在一个事务内完成
+bool process_batch_payment(Database *db, const char *user_id, const char *const *transaction_ids, int count,
+                           int payment_method, const char *idempotency_key, PaymentReceipt *receipt);
+
+// 释放支付回执
+void free_payment_receipt(PaymentReceipt *receipt);
+
+// 打印支付回执
+void print_payment_receipt(const PaymentReceipt *receipt);
+
+// 同pay_transaction，按指定时间入账
+PaymentOutcome pay_transaction_at(Database *db, const char *transaction_id, const char *user_id,
+                                  int payment_method, const char *idempotency_key,
+                                  time_t payment_time, double *amount_paid);
+
+// 支付结果的文字说明
+const char *payment_outcome_message(PaymentOutcome outcome);
+
 // 生成各类费用的函数声明
 void generate_property_fees(Database *db, const char *user_id, UserType user_type);
 bool generate_parking_fees(Database *db, time_t period_start, time_t period_end, int due_days);
@@ -64,7 +64,7 @@ bool update_owner(Database *db, const char *user_id, UserType user_type, Owner *
 // 获取业主信息
 bool get_owner_by_id(Database *db, const char *user_id, Owner *owner);
 
-// 排序业主
+// 排序业主，compare_func为NULL时按姓名拼音排序
 void sort_owners(Database *db, int (*compare_func)(const void *, const void *));
 
 // 显示业主列表
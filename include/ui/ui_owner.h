@@ -140,6 +140,15 @@ int compare_owner_name_asc(const void *a, const void *b);
  */
 int compare_owner_name_desc(const void *a, const void *b);
 
+/**
+ * @brief 列出欠费账单并批量缴费
+ *
+ * @param db 数据库指针
+ * @param owner_id 业主ID
+ * @param fee_type 费用类型，0表示全部
+ */
+void pay_outstanding_bills(Database *db, const char *owner_id, int fee_type);
+
 /**
  * @brief 查询特定业主的缴费信息
  *
@@ -40,16 +40,20 @@ void show_payment_statistics(Database *db);
 void show_yearly_statistics(Database *db, int year);
 void show_current_statistics(Database *db);
 void show_unpaid_analysis(Database *db);
+void show_fee_cube_screen(Database *db);
+void show_collection_rate_screen(Database *db);
 
 // 缴费提醒相关函数
 void send_payment_reminders(Database *db);
 void send_payment_reminder_screen(Database *db, const char *user_id);
 void send_bulk_payment_reminders(Database *db);
-void send_payment_reminder(Database *db, const char *user_id, double unpaid_amount, const char *fee_types);
+void send_payment_reminder(Database *db, const char *user_id);
 void show_payment_reminder_menu(Database *db, const char *user_id);
 void show_reminder_history(Database *db);
 // 缴费管理相关函数
 void show_payment_management_menu(Database *db);
+void collect_owner_payment(Database *db);
+void import_statement_screen(Database *db);
 void show_current_fee_standards(Database *db);
 void get_current_fee_standards_info(Database *db, char *buffer, size_t buffer_size);
 
@@ -0,0 +1,102 @@
+#ifndef ARROW_H
+#define ARROW_H
+
+#include "utils/hash_map.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define ARROW_BATCH_ROWS 65536 // 每个记录批的行数
+
+// 列类型
+typedef enum
+{
+    ARROW_INT32,
+    ARROW_INT64,
+    ARROW_FLOAT64,
+    ARROW_TIMESTAMP, // Unix秒，时区UTC
+    ARROW_UTF8,
+    ARROW_DICTIONARY // 字典编码的UTF-8字符串，int32下标
+} ArrowType;
+
+// 列定义，所有列均可为空
+typedef struct
+{
+    const char *name;
+    ArrowType type;
+} ArrowField;
+
+// 可增长的字节缓冲区
+typedef struct
+{
+    uint8_t *data;
+    size_t len;
+    size_t cap;
+} ArrowBuffer;
+
+// 当前记录批中一列的数据
+typedef struct
+{
+    ArrowType type;
+    int64_t null_count;
+    ArrowBuffer validity; // 有效位图，1为非空
+    ArrowBuffer values;   // 定长值、字符串偏移或字典下标
+    ArrowBuffer data;     // 字符串内容
+    HashMap dictionary;   // 字典值到下标+1的映射
+    ArrowBuffer dict_offsets;
+    ArrowBuffer dict_data;
+    int32_t dict_count;
+} ArrowColumn;
+
+// 文件中一条消息的位置
+typedef struct
+{
+    int64_t offset;
+    int32_t meta_length;
+    int64_t body_length;
+} ArrowBlock;
+
+/*
+ * Arrow IPC文件写入器：打开时写入schema，字典在第一个记录批之前一次写出，
+ * 之后按行追加，每满ARROW_BATCH_ROWS行写出一个记录批，关闭时写入footer。
+ * 字典编码列须在追加第一行之前用arrow_dictionary_add登记全部取值。
+ * 只支持小端主机。
+ */
+typedef struct
+{
+    FILE *fp;
+    const ArrowField *fields;
+    int field_count;
+    ArrowColumn *columns;
+    int64_t rows;       // 当前记录批的行数
+    int64_t total_rows; // 已写出和缓冲中的总行数
+    int64_t offset;     // 已写入文件的字节数
+    ArrowBlock *dictionaries;
+    int dictionary_count;
+    ArrowBlock *batches;
+    int batch_count;
+    int batch_cap;
+    bool dictionaries_written;
+    bool failed;
+} ArrowWriter;
+
+// 创建文件并写入schema，fields须在关闭前保持有效
+bool arrow_writer_open(ArrowWriter *writer, const char *path, const ArrowField *fields, int field_count);
+
+// 为字典编码列登记一个取值，重复取值忽略；下标按登记顺序分配
+bool arrow_dictionary_add(ArrowWriter *writer, int field, const char *value, size_t len);
+
+// 追加当前行某一列的值；字符串列的值须在字典中
+void arrow_append_null(ArrowWriter *writer, int field);
+void arrow_append_int(ArrowWriter *writer, int field, int64_t value);
+void arrow_append_double(ArrowWriter *writer, int field, double value);
+void arrow_append_string(ArrowWriter *writer, int field, const char *value, size_t len);
+
+// 结束当前行（每列须恰好追加一个值），批满时写出
+bool arrow_end_row(ArrowWriter *writer);
+
+// 写出剩余数据和footer并关闭文件，释放内存；任一步失败返回false
+bool arrow_writer_close(ArrowWriter *writer);
+
+#endif /* ARROW_H */
@@ -0,0 +1,77 @@
+#ifndef CSV_H
+#define CSV_H
+
+#include <stdbool.h>
+#include <stdio.h>
+
+// 流式CSV读取器（RFC 4180），字段直接指向内部记录缓冲区，无逐字段拷贝
+typedef struct
+{
+    FILE *fp;
+    char delimiter;   // 字段分隔符，默认','
+    char *buf;        // 当前记录缓冲区
+    size_t buf_len;   // 当前记录长度
+    size_t buf_cap;   // 缓冲区容量
+    char **fields;    // 字段指针，指向buf内部
+    int field_count;  // 当前记录字段数
+    int field_cap;    // 字段数组容量
+    long record_no;   // 当前记录序号（从1开始，含表头）
+    long line_no;     // 当前记录起始行号
+    long next_line;   // 下一条记录的起始行号
+} CsvReader;
+
+// 打开CSV文件，自动跳过UTF-8 BOM
+bool csv_reader_open(CsvReader *reader, const char *path, char delimiter);
+
+// 读取下一条记录，返回字段数；0表示文件结束，-1表示错误
+int csv_read_record(CsvReader *reader);
+
+// 关闭读取器
+void csv_reader_close(CsvReader *reader);
+
+// 按表头名称查找列序号（忽略大小写和首尾空白），candidates以NULL结尾，未找到返回-1
+int csv_find_column(const CsvReader *reader, const char *const *candidates);
+
+#define CSV_WRITER_BUFFER_SIZE (1024 * 1024) // 写缓冲区大小
+
+// CsvWriter选项
+#define CSV_WRITE_BOM 0x01  // 文件开头写UTF-8 BOM（便于Excel识别编码）
+#define CSV_WRITE_GZIP 0x02 // 以gzip格式流式压缩输出
+#define CSV_WRITE_LF 0x04   // 记录以"\n"结尾（默认"\r\n"），便于命令行管道处理
+
+// 流式CSV写入器：字段按RFC 4180加引号后写入大缓冲区，满后整块写出（或送入压缩器），内存占用固定
+typedef struct
+{
+    FILE *fp;
+    bool owns_fp;           // 关闭时是否关闭fp
+    char delimiter;         // 字段分隔符
+    char *buf;              // 待写出的数据
+    size_t buf_len;
+    size_t buf_cap;
+    void *zstream;          // gzip压缩状态，未压缩时为NULL
+    unsigned char *zbuf;    // 压缩输出缓冲区
+    bool lf_only;           // 记录以"\n"而非"\r\n"结尾
+    bool record_started;    // 当前记录已写过字段
+    long record_count;      // 已写完的记录数（含表头）
+    bool failed;            // 写入或压缩出错
+} CsvWriter;
+
+// 创建文件并开始写入，flags为CSV_WRITE_*的组合
+bool csv_writer_open(CsvWriter *writer, const char *path, char delimiter, int flags);
+
+// 写入已打开的流（如标准输出），关闭写入器时不关闭该流
+bool csv_writer_attach(CsvWriter *writer, FILE *fp, char delimiter, int flags);
+
+// 写一个字段，NULL写为空字段
+void csv_write_field(CsvWriter *writer, const char *value);
+
+// 写一个已知长度的字段
+void csv_write_field_len(CsvWriter *writer, const char *value, size_t len);
+
+// 结束当前记录
+void csv_end_record(CsvWriter *writer);
+
+// 写出剩余数据并关闭，全部写入成功返回true
+bool csv_writer_close(CsvWriter *writer);
+
+#endif /* CSV_H */
@@ -0,0 +1,28 @@
+#ifndef EXPORT_H
+#define EXPORT_H
+
+#include "db/database.h"
+#include <stdbool.h>
+#include <stdio.h>
+
+// 导出选项
+typedef struct
+{
+    char delimiter;      // ','为CSV，'\t'为TSV
+    bool bom;            // 写UTF-8 BOM
+    bool gzip;           // gzip压缩
+    const char *columns; // 要导出的列名，以逗号分隔并按此顺序输出，NULL或空串表示全部列
+} ExportOptions;
+
+// 按文件名确定格式：.tsv为TSV，否则为CSV；以.gz结尾时压缩；CSV带BOM以便Excel直接打开
+void export_options_for_path(ExportOptions *options, const char *path);
+
+// 执行查询，把结果逐行从游标写到文件（首行为列名），不在内存中保留结果集；rows可为NULL
+bool export_query(Database *db, const char *sql, void (*bind_params)(sqlite3_stmt *, void *), void *params,
+                  const char *path, const ExportOptions *options, long *rows);
+
+// 同export_query，写到已打开的流
+bool export_query_to(Database *db, const char *sql, void (*bind_params)(sqlite3_stmt *, void *), void *params,
+                     FILE *fp, const ExportOptions *options, long *rows);
+
+#endif /* EXPORT_H */
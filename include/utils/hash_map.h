@@ -0,0 +1,56 @@
+#ifndef HASH_MAP_H
+#define HASH_MAP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// 哈希表条目
+typedef struct
+{
+    const char *key; // 键（存放于表内部的键区，以'\0'结尾）
+    size_t key_len;  // 键长度
+    uint64_t hash;   // 键的哈希值
+    void *value;     // 值
+} HashEntry;
+
+// 键存储块
+typedef struct HashKeyBlock
+{
+    struct HashKeyBlock *next;
+    size_t used;
+    size_t size;
+    char data[];
+} HashKeyBlock;
+
+// 以字节串为键的开放寻址哈希表
+typedef struct
+{
+    HashEntry *entries;  // 槽位数组
+    size_t capacity;     // 槽位数，始终为2的幂
+    size_t count;        // 已用槽位数
+    HashKeyBlock *keys;  // 键存储，随表一起释放
+} HashMap;
+
+// 初始化哈希表，expected为预计条目数
+bool hash_map_init(HashMap *map, size_t expected);
+
+// 查找键，不存在返回NULL
+void *hash_map_get(const HashMap *map, const void *key, size_t key_len);
+
+// 查找键，返回值槽位指针，不存在返回NULL
+void **hash_map_lookup(const HashMap *map, const void *key, size_t key_len);
+
+// 插入或覆盖键值，键会被复制
+bool hash_map_put(HashMap *map, const void *key, size_t key_len, void *value);
+
+// 遍历：从*index开始查找下一个条目，遍历结束返回NULL
+HashEntry *hash_map_next(const HashMap *map, size_t *index);
+
+// 释放哈希表（不释放值）
+void hash_map_free(HashMap *map);
+
+// 计算字节串哈希值（FNV-1a）
+uint64_t hash_bytes(const void *data, size_t len);
+
+#endif /* HASH_MAP_H */
@@ -0,0 +1,32 @@
+#ifndef PAGER_H
+#define PAGER_H
+
+#include "db/database.h"
+#include "utils/table.h"
+#include <stdbool.h>
+
+#define PAGER_MAX_KEYS 3 // 键集列最多列数
+
+/*
+ * 分页浏览的查询定义。sql为不含ORDER BY的SELECT，前column_count列用于显示，
+ * 其后key_count列为键集列（组合唯一且不为NULL，需以AS起别名）。每次翻页只取一屏：
+ * 以当前页首行或末行的键值为起点按键集顺序续取，不使用OFFSET，
+ * 翻到任意位置的开销都与结果集大小无关，内存只占一页。
+ */
+typedef struct
+{
+    const char *title;                           // 标题
+    const char *sql;                             // 基础查询，可含?参数
+    const TableColumn *columns;                  // 显示列
+    int column_count;                            // 显示列数
+    int key_count;                               // 键集列数
+    bool descending;                             // 按键集降序浏览
+    void (*bind_params)(sqlite3_stmt *, void *); // 绑定基础查询的参数，可为NULL
+    void *params;                                // 传给bind_params的参数
+} PagerQuery;
+
+// 交互浏览：PgDn/空格下一页，PgUp/b上一页，Home/g首页，End/G末页，/搜索，n下一个匹配，q返回。
+// 标准输入或输出不是终端时直接输出全部结果
+bool pager_browse(Database *db, const PagerQuery *query);
+
+#endif /* PAGER_H */
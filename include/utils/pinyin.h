@@ -0,0 +1,43 @@
+#ifndef PINYIN_H
+#define PINYIN_H
+
+#include <sqlite3.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * 汉字按拼音排序（CLDR zh pinyin规则）：
+ * 空格、数字和标点在前，拉丁字母与同声母的汉字相邻（A在"阿"之前），不区分大小写；
+ * 其余字符按码位排在最后。
+ *
+ * 排序键为每个字符3字节的大端权重，直接用memcmp（SQLite中BLOB的默认比较）
+ * 比较即得拼音顺序，可存入表中建索引。
+ */
+
+#define PINYIN_FIRST 0x4E00 // 对照表覆盖的码位范围
+#define PINYIN_LAST 0x9FA5
+#define PINYIN_EXTRA_COUNT 1
+#define PINYIN_KEY_CHAR_BYTES 3 // 排序键中每个字符的字节数
+
+// 由data_gen/gen_pinyin_table.py生成的对照表（src/utils/pinyin_table.c）
+extern const uint16_t PINYIN_LETTER_RANKS[26];
+extern const uint32_t PINYIN_EXTRA[PINYIN_EXTRA_COUNT][2];
+extern const uint16_t PINYIN_RANKS[PINYIN_LAST - PINYIN_FIRST + 1];
+
+// 生成排序键，返回键长度；out不足时只写入能容纳的完整字符，返回值仍为完整长度
+size_t pinyin_sort_key(const char *text, size_t len, unsigned char *out, size_t size);
+
+// 按拼音比较两个UTF-8字符串，拼音相同时按字节比较，保证是全序
+int pinyin_compare(const char *a, size_t a_len, const char *b, size_t b_len);
+
+// 按name_of取得的名称对记录指针数组排序：先算好排序键，再排序键/指针对，不移动记录本身
+bool pinyin_sort_records(void **records, size_t count, const char *(*name_of)(const void *record));
+
+// 在连接上注册PINYIN排序规则和pinyin_key(text)函数
+bool pinyin_register(sqlite3 *db);
+
+// 把text的排序键以BLOB绑定到语句的第index个参数（写入users.name_sort_key），text为NULL时绑定空值
+int pinyin_bind_sort_key(sqlite3_stmt *stmt, int index, const char *text);
+
+#endif /* PINYIN_H */
@@ -0,0 +1,42 @@
+#ifndef RECORD_BUFFER_H
+#define RECORD_BUFFER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#define RECORD_BUFFER_CHUNK_BYTES (64 * 1024) // 每块的默认字节数
+
+/*
+ * 定长记录缓冲区：记录存放在固定大小的块中，追加为O(1)且已有记录永不移动，
+ * 取得的记录指针在缓冲区释放前一直有效；按下标随机访问，按追加顺序遍历，
+ * 一次释放全部块。用于替代逐个malloc节点、每次追加都遍历到表尾的链表。
+ */
+typedef struct
+{
+    size_t record_size;   // 每条记录字节数
+    size_t chunk_records; // 每块记录数
+    size_t count;         // 记录数
+    char **chunks;        // 块指针数组
+    size_t chunk_count;
+    size_t chunk_cap;
+} RecordBuffer;
+
+// 初始化，chunk_records为0时按RECORD_BUFFER_CHUNK_BYTES计算每块记录数
+void record_buffer_init(RecordBuffer *buffer, size_t record_size, size_t chunk_records);
+
+// 追加一条清零的记录并返回其指针，内存不足时返回NULL
+void *record_buffer_append(RecordBuffer *buffer);
+
+// 第index条记录
+void *record_buffer_at(const RecordBuffer *buffer, size_t index);
+
+// 按compare排序（与qsort的比较函数相同），排序后原有记录指针指向的内容会改变
+bool record_buffer_sort(RecordBuffer *buffer, int (*compare)(const void *, const void *));
+
+// 清空记录，保留已分配的块供再次追加
+void record_buffer_clear(RecordBuffer *buffer);
+
+// 释放全部内存
+void record_buffer_free(RecordBuffer *buffer);
+
+#endif /* RECORD_BUFFER_H */
@@ -0,0 +1,57 @@
+#ifndef ROW_SORT_H
+#define ROW_SORT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define ROW_SORT_MAX_COLUMNS 8
+#define ROW_SORT_DEFAULT_BUDGET (64 * 1024 * 1024) // 默认内存上限
+#define ROW_SORT_DEFAULT_PREFIX 8                  // 文本列默认直接编码的字符数
+
+/*
+ * 多列排序：把每行的排序列编码成定长二进制键（各列依次拼接，最后是行号），
+ * 键直接按字节比较即为多列顺序，用MSD基数排序。键缓冲超过内存上限时
+ * 分段排序写入临时文件再多路归并。文本列按拼音排序：取值都不超过前缀长度时
+ * 直接编码拼音键，否则先对不同取值排序，编码其名次。
+ */
+
+typedef enum
+{
+    ROW_SORT_INT,  // int64_t
+    ROW_SORT_REAL, // double
+    ROW_SORT_TEXT  // UTF-8字符串，按拼音
+} RowSortType;
+
+// 排序列：各列数据按列存放，下标即行号
+typedef struct
+{
+    RowSortType type;
+    bool descending;
+    const int64_t *ints;
+    const double *reals;
+    const char *const *texts; // NULL元素表示空值
+    const uint8_t *nulls;     // 可为NULL；非零表示空值。空值升序时排最前，降序时排最后
+} RowSortColumn;
+
+typedef struct
+{
+    size_t memory_budget; // 键缓冲上限（字节），0表示ROW_SORT_DEFAULT_BUDGET
+    int text_prefix;      // 文本列直接编码的最大字符数，0表示ROW_SORT_DEFAULT_PREFIX
+} RowSortOptions;
+
+// 排序统计
+typedef struct
+{
+    size_t key_width;    // 每行键的字节数
+    bool external;       // 是否使用了外部归并
+    int run_count;       // 外部归并的段数
+    int ranked_columns;  // 按名次编码的文本列数
+    double elapsed_seconds;
+} RowSortStats;
+
+// 排序row_count行，结果（行号）写入order；options和stats可为NULL
+bool row_sort(const RowSortColumn *columns, int column_count, size_t row_count, const RowSortOptions *options,
+              uint32_t *order, RowSortStats *stats);
+
+#endif /* ROW_SORT_H */
@@ -0,0 +1,62 @@
+#ifndef TABLE_H
+#define TABLE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#define TABLE_COLUMN_GAP 2 // 列间空格数
+
+typedef enum
+{
+    TABLE_ALIGN_LEFT,
+    TABLE_ALIGN_RIGHT
+} TableAlign;
+
+// 列定义
+typedef struct
+{
+    const char *title;
+    TableAlign align;
+    int max_width; // 最大显示宽度，超出部分截断并以"…"结尾，0表示不限
+} TableColumn;
+
+/*
+ * 表格渲染器：按页缓冲行，每页计算一次各列显示宽度（中日韩全角字符占2列），
+ * 把整页格式化到一个缓冲区后一次写出。列宽只增不减，跨页保持对齐；
+ * 逐行添加即可流式输出任意大的结果，内存只占一页。
+ */
+typedef struct
+{
+    const TableColumn *columns;
+    int column_count;
+    int page_rows;  // 每页行数
+    int *widths;    // 各列当前显示宽度
+    char *cells;    // 本页单元格文本，依次以\0结尾
+    size_t cells_len;
+    size_t cells_cap;
+    size_t *offsets; // 本页各单元格在cells中的位置，(size_t)-1表示NULL
+    int page_count;  // 本页已缓冲的行数
+    char *out;       // 输出缓冲区
+    size_t out_len;
+    size_t out_cap;
+    long row_count;  // 已添加的总行数
+    bool header_done;
+    bool failed;     // 内存不足，后续行被丢弃
+} Table;
+
+// 字符串的显示宽度（UTF-8），东亚宽字符计2，组合字符计0
+int display_width(const char *text);
+
+// 终端可显示的行数，无法获取时返回24
+int table_screen_rows(void);
+
+// 开始一个表格，page_rows<=0时按终端高度分页
+bool table_begin(Table *table, const TableColumn *columns, int column_count, int page_rows);
+
+// 添加一行（立即复制），values按列给出，NULL显示为空；缓冲满一页时渲染并写出
+void table_add_row(Table *table, const char *const *values);
+
+// 写出剩余行并释放资源，返回总行数
+long table_end(Table *table);
+
+#endif /* TABLE_H */
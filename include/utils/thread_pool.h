@@ -0,0 +1,31 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// 任务函数，返回false表示任务失败（计入失败数）
+typedef bool (*ThreadTask)(void *arg);
+
+// 固定大小的工作线程池，任务队列有界，队列满时提交方阻塞等待
+typedef struct ThreadPool ThreadPool;
+
+// 创建线程池，thread_count<=0时使用CPU核数
+ThreadPool *thread_pool_create(int thread_count, size_t queue_capacity);
+
+// 提交任务，队列满时阻塞
+bool thread_pool_submit(ThreadPool *pool, ThreadTask task, void *arg);
+
+// 等待已提交的任务全部完成，返回自上次等待以来失败的任务数
+int thread_pool_wait(ThreadPool *pool);
+
+// 等待任务完成并销毁线程池
+void thread_pool_destroy(ThreadPool *pool);
+
+// 线程池大小
+int thread_pool_size(const ThreadPool *pool);
+
+// 系统CPU核数
+int thread_pool_cpu_count(void);
+
+#endif /* THREAD_POOL_H */
@@ -20,6 +20,9 @@ char *format_time(time_t time, char *buffer, int buffer_size);
 // 从字符串解析时间
 time_t parse_time(const char *time_str);
 
+// 本地日期的天序号（自1970-01-01起），与SQL中 strftime('%s','now','localtime') / 86400 一致
+long local_day_number(time_t time);
+
 // 安全字符串复制
 void safe_strcpy(char *dest, const char *src, size_t dest_size);
 
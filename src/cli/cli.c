@@ -0,0 +1,1645 @@
+#include "cli/cli.h"
+#include "cli/service.h"
+#include "db/database.h"
+#include "models/analytics.h"
+#include "models/apartment.h"
+#include "models/billing.h"
+#include "models/bulk_import.h"
+#include "models/collection_rate.h"
+#include "models/fee_stats.h"
+#include "models/late_fee.h"
+#include "models/ledger.h"
+#include "models/owner_sort.h"
+#include "models/scheduler.h"
+#include "models/statement.h"
+#include "models/transaction.h"
+#include "utils/csv.h"
+#include "utils/export.h"
+#include "utils/file_ops.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define CLI_MAX_COLUMNS 16
+#define CLI_DEFAULT_TOP 20
+
+typedef enum
+{
+    CLI_FORMAT_TSV,
+    CLI_FORMAT_CSV,
+    CLI_FORMAT_JSON
+} CliFormat;
+
+// 输出列，numeric列在JSON中不加引号
+typedef struct
+{
+    const char *name;
+    bool numeric;
+} CliColumn;
+
+// 表格输出：TSV/CSV经CsvWriter写出，首行为列名；JSON为对象数组
+typedef struct
+{
+    FILE *out;
+    CliFormat format;
+    const CliColumn *columns;
+    int column_count;
+    long row_count;
+    CsvWriter csv;  // TSV/CSV写入器
+    bool csv_open;  // 写入器已就绪，内存不足时为false，行被丢弃
+} CliTable;
+
+// 一次命令执行的上下文
+typedef struct
+{
+    Database *db;
+    FILE *out;       // 结果输出
+    FILE *err;       // 错误信息输出
+    CliFormat format;
+    int argc;        // 子命令之后的参数
+    char **argv;
+} CliContext;
+
+typedef int (*CliHandler)(CliContext *ctx);
+
+typedef struct
+{
+    const char *name;
+    const char *sub;   // 子命令，NULL表示无子命令
+    const char *usage; // 参数说明，同时用于检查选项是否合法
+    CliHandler run;
+} CliCommand;
+
+static int cmd_billing_run(CliContext *ctx);
+static int cmd_billing_overdue(CliContext *ctx);
+static int cmd_billing_late_fees(CliContext *ctx);
+static int cmd_stats(CliContext *ctx);
+static int cmd_rates(CliContext *ctx);
+static int cmd_export_owners(CliContext *ctx);
+static int cmd_export_debtors(CliContext *ctx);
+static int cmd_export_arrow(CliContext *ctx);
+static int cmd_import(CliContext *ctx);
+static int cmd_owners_sort(CliContext *ctx);
+static int cmd_owners_find(CliContext *ctx);
+static int cmd_rooms_list(CliContext *ctx);
+static int cmd_bills_list(CliContext *ctx);
+static int cmd_pay(CliContext *ctx);
+static int cmd_statements(CliContext *ctx);
+static int cmd_backup(CliContext *ctx);
+static int cmd_jobs_list(CliContext *ctx);
+static int cmd_jobs_run(CliContext *ctx);
+
+static const CliCommand COMMANDS[] = {
+    {"billing", "run", "--month YYYY-MM [--type property|water|electricity|gas|parking] [--due-days N] [--dry-run]",
+     cmd_billing_run},
+    {"billing", "overdue", "", cmd_billing_overdue},
+    {"billing", "late-fees", "[--date YYYY-MM-DD] [--dry-run]", cmd_billing_late_fees},
+    {"stats", NULL, "[--year YYYY]", cmd_stats},
+    {"rates", NULL, "[--from YYYY-MM] [--to YYYY-MM]", cmd_rates},
+    {"export", "owners", "[--out 路径] [--columns 列,...]", cmd_export_owners},
+    {"export", "debtors", "[--top K] [--building 楼宇ID]", cmd_export_debtors},
+    {"export", "arrow", "--out 目录", cmd_export_arrow},
+    {"import", NULL, "[--owners 文件] [--rooms 文件] [--parking 文件] [--report 文件]", cmd_import},
+    {"owners", "sort", "--by 字段[:desc],... [--top K]", cmd_owners_sort},
+    {"owners", "find", "[--id 业主ID|用户名] [--name 姓名前缀] [--phone 电话前缀] [--room 房号] [--top K]",
+     cmd_owners_find},
+    {"rooms", "list", "--owner 业主ID", cmd_rooms_list},
+    {"bills", "list", "--owner 业主ID [--unpaid]", cmd_bills_list},
+    {"pay", NULL, "--owner 业主ID [--bills 账单ID,...] [--all] --method cash|card|wechat|alipay|other --key 幂等键",
+     cmd_pay},
+    {"statements", NULL, "--month YYYY-MM --out 目录 [--as text|html|csv]", cmd_statements},
+    {"backup", NULL, "[--output 路径]", cmd_backup},
+    {"jobs", "list", "", cmd_jobs_list},
+    {"jobs", "run", "<任务名>", cmd_jobs_run},
+};
+
+#define COMMAND_COUNT (int)(sizeof(COMMANDS) / sizeof(COMMANDS[0]))
+
+// 任务状态的英文名，与JobStatus对应
+static const char *JOB_STATUS_KEYS[] = {"running", "succeeded", "failed", "skipped"};
+
+static const char *EXPORT_OWNERS_SQL =
+    "WITH owner_rooms AS ("
+    "  SELECT owner_id, MIN(building_id) AS building_id, GROUP_CONCAT(room_number, ' ') AS rooms "
+    "  FROM rooms WHERE owner_id IS NOT NULL AND owner_id <> '' GROUP BY owner_id) "
+    "SELECT u.user_id, u.username, u.name, u.phone_number AS phone, u.email, b.building_name AS building, o.rooms, "
+    "printf('%.2f', COALESCE(l.billed_amount - l.paid_amount, 0)) AS outstanding, "
+    "printf('%.2f', COALESCE(l.overdue_amount, 0)) AS overdue "
+    "FROM users u "
+    "LEFT JOIN owner_rooms o ON o.owner_id = u.user_id "
+    "LEFT JOIN buildings b ON b.building_id = o.building_id "
+    "LEFT JOIN owner_ledger l ON l.user_id = u.user_id AND l.fee_type = 0 "
+    "WHERE u.role_id = 'role_owner' ORDER BY u.user_id";
+
+// 前台查找业主，按给出的条件追加WHERE子句；楼宇和房号用相关子查询，只对命中的业主计算
+static const char *FIND_OWNERS_SQL =
+    "SELECT u.user_id, u.username, u.name, u.phone_number AS phone, u.email, "
+    "(SELECT b.building_name FROM rooms r JOIN buildings b ON b.building_id = r.building_id "
+    " WHERE r.owner_id = u.user_id ORDER BY r.building_id LIMIT 1) AS building, "
+    "(SELECT GROUP_CONCAT(room_number, ' ') FROM rooms WHERE owner_id = u.user_id) AS rooms, "
+    "printf('%.2f', COALESCE(l.billed_amount - l.paid_amount, 0)) AS outstanding, "
+    "printf('%.2f', COALESCE(l.overdue_amount, 0)) AS overdue "
+    "FROM users u "
+    "LEFT JOIN owner_ledger l ON l.user_id = u.user_id AND l.fee_type = 0 "
+    "WHERE u.role_id = 'role_owner'";
+
+// 导出和查找业主共用的输出列
+static const CliColumn OWNER_COLUMNS[] = {
+    {"user_id", false}, {"username", false}, {"name", false}, {"phone", false}, {"email", false},
+    {"building", false}, {"rooms", false}, {"outstanding", true}, {"overdue", true},
+};
+#define OWNER_COLUMN_COUNT (int)(sizeof(OWNER_COLUMNS) / sizeof(OWNER_COLUMNS[0]))
+
+static const char *LIST_JOBS_SQL =
+    "SELECT job_name, schedule, enabled, next_run, last_run, last_status FROM scheduled_jobs ORDER BY job_name";
+
+/**
+ * 写出一个JSON值，numeric为true时原样写出，NULL写为null
+ */
+static void write_json_value(FILE *out, const char *value, bool numeric)
+{
+    if (!value)
+    {
+        fputs("null", out);
+        return;
+    }
+    if (numeric)
+    {
+        fputs(value, out);
+        return;
+    }
+    fputc('"', out);
+    for (const unsigned char *p = (const unsigned char *)value; *p; p++)
+    {
+        if (*p == '"' || *p == '\\')
+            fprintf(out, "\\%c", *p);
+        else if (*p == '\n')
+            fputs("\\n", out);
+        else if (*p == '\t')
+            fputs("\\t", out);
+        else if (*p < 0x20)
+            fprintf(out, "\\u%04x", *p);
+        else
+            fputc(*p, out);
+    }
+    fputc('"', out);
+}
+
+static void table_begin(CliTable *table, const CliContext *ctx, const CliColumn *columns, int column_count)
+{
+    table->out = ctx->out;
+    table->format = ctx->format;
+    table->columns = columns;
+    table->column_count = column_count;
+    table->row_count = 0;
+    table->csv_open = false;
+
+    if (table->format == CLI_FORMAT_JSON)
+    {
+        fputc('[', table->out);
+        return;
+    }
+    if (!csv_writer_attach(&table->csv, table->out, table->format == CLI_FORMAT_CSV ? ',' : '\t', CSV_WRITE_LF))
+    {
+        fprintf(ctx->err, "内存不足，无法输出结果\n");
+        return;
+    }
+    table->csv_open = true;
+    for (int i = 0; i < column_count; i++)
+    {
+        csv_write_field(&table->csv, columns[i].name);
+    }
+    csv_end_record(&table->csv);
+}
+
+/**
+ * 输出一行，values按列顺序给出，NULL表示空值
+ */
+static void table_row(CliTable *table, const char *const *values)
+{
+    if (table->format == CLI_FORMAT_JSON)
+    {
+        fputs(table->row_count > 0 ? ",\n{" : "\n{", table->out);
+        for (int i = 0; i < table->column_count; i++)
+        {
+            if (i > 0)
+                fputc(',', table->out);
+            write_json_value(table->out, table->columns[i].name, false);
+            fputc(':', table->out);
+            write_json_value(table->out, values[i], table->columns[i].numeric);
+        }
+        fputc('}', table->out);
+    }
+    else if (table->csv_open)
+    {
+        for (int i = 0; i < table->column_count; i++)
+        {
+            csv_write_field(&table->csv, values[i]);
+        }
+        csv_end_record(&table->csv);
+    }
+    table->row_count++;
+}
+
+static void table_end(CliTable *table)
+{
+    if (table->format == CLI_FORMAT_JSON)
+    {
+        fputs(table->row_count > 0 ? "\n]\n" : "]\n", table->out);
+    }
+    else if (table->csv_open)
+    {
+        csv_writer_close(&table->csv);
+        table->csv_open = false;
+    }
+    fflush(table->out);
+}
+
+/**
+ * 格式化时间为"YYYY-MM-DD HH:MM:SS"（本地时间），t<=0时输出NULL
+ */
+static const char *format_timestamp(char *buf, size_t size, time_t t)
+{
+    if (t <= 0)
+    {
+        return NULL;
+    }
+    struct tm tm_info;
+    localtime_r(&t, &tm_info);
+    strftime(buf, size, "%Y-%m-%d %H:%M:%S", &tm_info);
+    return buf;
+}
+
+/**
+ * 查找选项值，支持"--name 值"和"--name=值"两种写法
+ */
+static const char *option_value(const CliContext *ctx, const char *name)
+{
+    size_t len = strlen(name);
+    for (int i = 0; i < ctx->argc; i++)
+    {
+        if (strncmp(ctx->argv[i], name, len) != 0)
+        {
+            continue;
+        }
+        if (ctx->argv[i][len] == '=')
+        {
+            return ctx->argv[i] + len + 1;
+        }
+        if (ctx->argv[i][len] == '\0' && i + 1 < ctx->argc)
+        {
+            return ctx->argv[i + 1];
+        }
+    }
+    return NULL;
+}
+
+static bool option_flag(const CliContext *ctx, const char *name)
+{
+    for (int i = 0; i < ctx->argc; i++)
+    {
+        if (strcmp(ctx->argv[i], name) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * 检查参数中的选项是否都出现在命令的用法说明中
+ */
+static bool check_options(const CliContext *ctx, const CliCommand *command)
+{
+    for (int i = 0; i < ctx->argc; i++)
+    {
+        const char *arg = ctx->argv[i];
+        if (strncmp(arg, "--", 2) != 0)
+        {
+            continue;
+        }
+        size_t len = strcspn(arg, "=");
+        const char *found = command->usage;
+        while ((found = strstr(found, "--")) != NULL)
+        {
+            if (strncmp(found, arg, len) == 0 && strchr(" ]=", found[len]))
+            {
+                break;
+            }
+            found += 2;
+        }
+        if (!found)
+        {
+            fprintf(ctx->err, "未知选项: %.*s\n", (int)len, arg);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * 解析"YYYY-MM"
+ */
+static bool parse_month(const char *text, int *year, int *month)
+{
+    char extra;
+    return text && sscanf(text, "%d-%d%c", year, month, &extra) == 2 &&
+           *year >= 1970 && *year <= 9999 && *month >= 1 && *month <= 12;
+}
+
+/**
+ * 解析"YYYY-MM-DD"为当日零点（本地时间）
+ */
+static bool parse_date(const char *text, time_t *date)
+{
+    struct tm tm_date = {0};
+    char extra;
+    if (!text || sscanf(text, "%d-%d-%d%c", &tm_date.tm_year, &tm_date.tm_mon, &tm_date.tm_mday, &extra) != 3 ||
+        tm_date.tm_mon < 1 || tm_date.tm_mon > 12 || tm_date.tm_mday < 1 || tm_date.tm_mday > 31)
+    {
+        return false;
+    }
+    tm_date.tm_year -= 1900;
+    tm_date.tm_mon -= 1;
+    tm_date.tm_isdst = -1;
+    *date = mktime(&tm_date);
+    return *date != (time_t)-1;
+}
+
+/**
+ * 解析非负整数选项，未给出时取默认值
+ */
+static bool parse_count(const CliContext *ctx, const char *name, int default_value, int *value)
+{
+    const char *text = option_value(ctx, name);
+    if (!text)
+    {
+        *value = default_value;
+        return true;
+    }
+    char *end;
+    long parsed = strtol(text, &end, 10);
+    if (end == text || *end || parsed < 0 || parsed > 1000000)
+    {
+        fprintf(ctx->err, "%s 须为非负整数: %s\n", name, text);
+        return false;
+    }
+    *value = (int)parsed;
+    return true;
+}
+
+/**
+ * 计算账期：当月首日零点至当月最后一天零点（与交互界面出账一致）
+ */
+static void month_period(int year, int month, time_t *start, time_t *end)
+{
+    struct tm tm_start = {0};
+    tm_start.tm_year = year - 1900;
+    tm_start.tm_mon = month - 1;
+    tm_start.tm_mday = 1;
+    tm_start.tm_isdst = -1;
+
+    struct tm tm_end = {0};
+    tm_end.tm_year = year - 1900;
+    tm_end.tm_mon = month;
+    tm_end.tm_mday = 0;
+    tm_end.tm_isdst = -1;
+
+    *start = mktime(&tm_start);
+    *end = mktime(&tm_end);
+}
+
+static int cmd_billing_run(CliContext *ctx)
+{
+    static const struct
+    {
+        const char *name;
+        int fee_type;
+    } types[] = {
+        {"property", TRANS_PROPERTY_FEE},
+        {"water", TRANS_WATER_FEE},
+        {"electricity", TRANS_ELECTRICITY_FEE},
+        {"gas", TRANS_GAS_FEE},
+        {"parking", TRANS_PARKING_FEE},
+    };
+
+    int year, month, due_days;
+    const char *month_text = option_value(ctx, "--month");
+    if (!parse_month(month_text, &year, &month))
+    {
+        fprintf(ctx->err, "请用 --month YYYY-MM 指定出账月份\n");
+        return CLI_EXIT_USAGE;
+    }
+    if (!parse_count(ctx, "--due-days", 0, &due_days))
+    {
+        return CLI_EXIT_USAGE;
+    }
+
+    const char *type_name = option_value(ctx, "--type");
+    BillingRun run;
+    run.fee_type = 0;
+    for (size_t i = 0; i < sizeof(types) / sizeof(types[0]); i++)
+    {
+        if (!type_name || strcmp(type_name, types[i].name) == 0)
+        {
+            run.fee_type = types[i].fee_type;
+            type_name = types[i].name;
+            break;
+        }
+    }
+    if (run.fee_type == 0)
+    {
+        fprintf(ctx->err, "未知费用类型: %s\n", type_name);
+        return CLI_EXIT_USAGE;
+    }
+
+    month_period(year, month, &run.period_start, &run.period_end);
+    run.due_date = run.period_end + (time_t)due_days * 24 * 60 * 60;
+    if (!get_billing_rate(ctx->db, run.fee_type, run.period_start, &run.rate))
+    {
+        fprintf(ctx->err, "未找到 %04d-%02d 生效的%s费用标准\n", year, month, type_name);
+        return CLI_EXIT_FAILURE;
+    }
+
+    // 停车费按车位整期出账，其余按房屋持有期出账
+    bool parking = run.fee_type == TRANS_PARKING_FEE;
+    bool dry_run = option_flag(ctx, "--dry-run");
+    BillingSummary summary;
+    if (dry_run)
+    {
+        BillingPreview preview;
+        if (!(parking ? preview_parking_billing(ctx->db, &run, 0, &preview)
+                      : preview_room_billing(ctx->db, &run, 0, &preview)))
+        {
+            return CLI_EXIT_FAILURE;
+        }
+        summary = preview.summary;
+        free_billing_preview(&preview);
+    }
+    else if (!(parking ? run_parking_billing(ctx->db, &run, &summary) : run_room_billing(ctx->db, &run, &summary)))
+    {
+        return CLI_EXIT_FAILURE;
+    }
+
+    static const CliColumn columns[] = {
+        {"month", false}, {"type", false}, {"rate", true}, {"bill_count", true},
+        {"prorated_count", true}, {"total_amount", true}, {"dry_run", true},
+    };
+    char rate[32], bills[16], prorated[16], total[32];
+    snprintf(rate, sizeof(rate), "%.4f", run.rate);
+    snprintf(bills, sizeof(bills), "%d", summary.bill_count);
+    snprintf(prorated, sizeof(prorated), "%d", summary.prorated_count);
+    snprintf(total, sizeof(total), "%.2f", summary.total_amount);
+    const char *values[] = {month_text, type_name, rate, bills, prorated, total, dry_run ? "true" : "false"};
+
+    CliTable table;
+    table_begin(&table, ctx, columns, 7);
+    table_row(&table, values);
+    table_end(&table);
+    return CLI_EXIT_OK;
+}
+
+static int cmd_billing_overdue(CliContext *ctx)
+{
+    if (!update_overdue_transactions(ctx->db))
+    {
+        return CLI_EXIT_FAILURE;
+    }
+
+    static const CliColumn columns[] = {{"updated", true}};
+    char updated[16];
+    snprintf(updated, sizeof(updated), "%d", sqlite3_changes(ctx->db->db));
+    const char *values[] = {updated};
+
+    CliTable table;
+    table_begin(&table, ctx, columns, 1);
+    table_row(&table, values);
+    table_end(&table);
+    return CLI_EXIT_OK;
+}
+
+static int cmd_billing_late_fees(CliContext *ctx)
+{
+    time_t date = time(NULL);
+    const char *date_text = option_value(ctx, "--date");
+    if (date_text && !parse_date(date_text, &date))
+    {
+        fprintf(ctx->err, "日期格式应为 YYYY-MM-DD: %s\n", date_text);
+        return CLI_EXIT_USAGE;
+    }
+
+    LateFeeRule rule;
+    if (!get_late_fee_rule(ctx->db, date, &rule))
+    {
+        fprintf(ctx->err, "未设置有效的滞纳金规则\n");
+        return CLI_EXIT_FAILURE;
+    }
+
+    bool dry_run = option_flag(ctx, "--dry-run");
+    LateFeeAccrual accrual = {0};
+    if (dry_run)
+    {
+        BillingPreview preview;
+        if (!preview_late_fees(ctx->db, date, 0, &preview))
+        {
+            return CLI_EXIT_FAILURE;
+        }
+        accrual.bill_count = preview.summary.bill_count;
+        accrual.total_amount = preview.summary.total_amount;
+        free_billing_preview(&preview);
+    }
+    else if (!accrue_late_fees(ctx->db, date, &accrual))
+    {
+        return CLI_EXIT_FAILURE;
+    }
+
+    static const CliColumn columns[] = {
+        {"date", false}, {"bill_count", true}, {"total_amount", true}, {"already_accrued", true}, {"dry_run", true},
+    };
+    char day[16], bills[16], total[32];
+    struct tm tm_date;
+    localtime_r(&date, &tm_date);
+    strftime(day, sizeof(day), "%Y-%m-%d", &tm_date);
+    snprintf(bills, sizeof(bills), "%d", accrual.bill_count);
+    snprintf(total, sizeof(total), "%.2f", accrual.total_amount);
+    const char *values[] = {day, bills, total, accrual.already_accrued ? "true" : "false",
+                            dry_run ? "true" : "false"};
+
+    CliTable table;
+    table_begin(&table, ctx, columns, 5);
+    table_row(&table, values);
+    table_end(&table);
+    return CLI_EXIT_OK;
+}
+
+static void stats_row(CliTable *table, const char *scope, const char *metric, const char *key,
+                      const FeeStatCell *cell)
+{
+    char owners[16], bills[24], amount[32];
+    snprintf(owners, sizeof(owners), "%d", cell->user_count);
+    snprintf(bills, sizeof(bills), "%ld", cell->bill_count);
+    snprintf(amount, sizeof(amount), "%.2f", cell->amount);
+    const char *values[] = {scope, metric, key, owners, bills, amount};
+    table_row(table, values);
+}
+
+/**
+ * 缴费统计：scope为年份或all，metric为paid/unpaid/by_type/unpaid_by_type/unpaid_by_age，
+ * key为费用类型代码或欠费时长分档
+ */
+static int cmd_stats(CliContext *ctx)
+{
+    static const char *AGING_KEYS[FEE_STATS_AGING_BUCKETS] = {"0-30", "31-90", "90+"};
+
+    time_t now = time(NULL);
+    struct tm tm_now;
+    localtime_r(&now, &tm_now);
+    int year = tm_now.tm_year + 1900;
+    if (!parse_count(ctx, "--year", year, &year) || year < 1970 || year > 9999)
+    {
+        return CLI_EXIT_USAGE;
+    }
+
+    FeeStats stats;
+    if (!collect_fee_stats(ctx->db, year, now, &stats))
+    {
+        return CLI_EXIT_FAILURE;
+    }
+
+    static const CliColumn columns[] = {
+        {"scope", false}, {"metric", false}, {"key", false},
+        {"owners", true}, {"bills", true}, {"amount", true},
+    };
+    char scope[8], key[8];
+    snprintf(scope, sizeof(scope), "%d", year);
+
+    CliTable table;
+    table_begin(&table, ctx, columns, 6);
+    stats_row(&table, scope, "paid", NULL, &stats.year_paid);
+    stats_row(&table, scope, "unpaid", NULL, &stats.year_unpaid);
+    for (int slot = 1; slot < FEE_STATS_TYPE_SLOTS; slot++)
+    {
+        snprintf(key, sizeof(key), "%d", slot == FEE_STATS_TYPE_SLOTS - 1 ? TRANS_OTHER : slot);
+        stats_row(&table, scope, "by_type", key, &stats.year_by_type[slot]);
+    }
+    stats_row(&table, "all", "paid", NULL, &stats.paid);
+    stats_row(&table, "all", "unpaid", NULL, &stats.unpaid);
+    for (int slot = 1; slot < FEE_STATS_TYPE_SLOTS; slot++)
+    {
+        snprintf(key, sizeof(key), "%d", slot == FEE_STATS_TYPE_SLOTS - 1 ? TRANS_OTHER : slot);
+        stats_row(&table, "all", "unpaid_by_type", key, &stats.unpaid_by_type[slot]);
+    }
+    for (int bucket = 0; bucket < FEE_STATS_AGING_BUCKETS; bucket++)
+    {
+        stats_row(&table, "all", "unpaid_by_age", AGING_KEYS[bucket], &stats.unpaid_by_age[bucket]);
+    }
+    table_end(&table);
+    return CLI_EXIT_OK;
+}
+
+/**
+ * 月度收缴率，默认最近12个月
+ */
+static int cmd_rates(CliContext *ctx)
+{
+    time_t now = time(NULL);
+    struct tm tm_now;
+    localtime_r(&now, &tm_now);
+    int to_year = tm_now.tm_year + 1900, to_month = tm_now.tm_mon + 1;
+    int from_year = to_month == 12 ? to_year : to_year - 1, from_month = to_month % 12 + 1;
+
+    const char *from = option_value(ctx, "--from");
+    const char *to = option_value(ctx, "--to");
+    if ((from && !parse_month(from, &from_year, &from_month)) || (to && !parse_month(to, &to_year, &to_month)))
+    {
+        fprintf(ctx->err, "月份格式应为 YYYY-MM\n");
+        return CLI_EXIT_USAGE;
+    }
+
+    CollectionRateSeries series;
+    if (!query_collection_rates(ctx->db, from_year * 100 + from_month, to_year * 100 + to_month, &series))
+    {
+        return CLI_EXIT_FAILURE;
+    }
+
+    static const CliColumn columns[] = {
+        {"month", false}, {"billed_amount", true}, {"paid_amount", true}, {"bill_count", true},
+        {"paid_count", true}, {"rate", true}, {"mom_delta", true}, {"yoy_delta", true},
+    };
+    CliTable table;
+    table_begin(&table, ctx, columns, 8);
+    for (int i = 0; i < series.count; i++)
+    {
+        const CollectionRatePoint *point = &series.points[i];
+        char month[16], billed[32], paid[32], bills[24], paid_bills[24], rate[16], mom[16], yoy[16];
+        snprintf(month, sizeof(month), "%04d-%02d", point->month / 100, point->month % 100);
+        snprintf(billed, sizeof(billed), "%.2f", point->billed_amount);
+        snprintf(paid, sizeof(paid), "%.2f", point->paid_amount);
+        snprintf(bills, sizeof(bills), "%ld", point->bill_count);
+        snprintf(paid_bills, sizeof(paid_bills), "%ld", point->paid_count);
+        snprintf(rate, sizeof(rate), "%.4f", point->rate);
+        snprintf(mom, sizeof(mom), "%.4f", point->mom_delta);
+        snprintf(yoy, sizeof(yoy), "%.4f", point->yoy_delta);
+        const char *values[] = {month, billed, paid, bills, paid_bills, point->has_rate ? rate : NULL,
+                                point->has_mom ? mom : NULL, point->has_yoy ? yoy : NULL};
+        table_row(&table, values);
+    }
+    table_end(&table);
+    free_collection_rates(&series);
+    return CLI_EXIT_OK;
+}
+
+/**
+ * 导出业主：指定--out时写到文件（格式由扩展名决定，.gz压缩），
+ * 指定--columns时只输出所列的列；两者都经导出引擎从游标逐行写出
+ */
+static int cmd_export_owners(CliContext *ctx)
+{
+    const char *out_path = option_value(ctx, "--out");
+    const char *column_list = option_value(ctx, "--columns");
+    if (out_path || column_list)
+    {
+        ExportOptions options;
+        long rows;
+        bool ok;
+        if (out_path)
+        {
+            export_options_for_path(&options, out_path);
+            options.columns = column_list;
+            ok = export_query(ctx->db, EXPORT_OWNERS_SQL, NULL, NULL, out_path, &options, &rows);
+        }
+        else if (ctx->format == CLI_FORMAT_JSON)
+        {
+            fprintf(ctx->err, "--columns 仅支持tsv和csv格式\n");
+            return CLI_EXIT_USAGE;
+        }
+        else
+        {
+            memset(&options, 0, sizeof(options));
+            options.delimiter = ctx->format == CLI_FORMAT_CSV ? ',' : '\t';
+            options.columns = column_list;
+            ok = export_query_to(ctx->db, EXPORT_OWNERS_SQL, NULL, NULL, ctx->out, &options, &rows);
+        }
+        if (!ok)
+        {
+            return CLI_EXIT_FAILURE;
+        }
+        if (out_path)
+        {
+            static const CliColumn columns[] = {{"file", false}, {"rows", true}};
+            char row_text[24];
+            snprintf(row_text, sizeof(row_text), "%ld", rows);
+            const char *values[] = {out_path, row_text};
+            CliTable table;
+            table_begin(&table, ctx, columns, 2);
+            table_row(&table, values);
+            table_end(&table);
+        }
+        return CLI_EXIT_OK;
+    }
+
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(ctx->db->db, EXPORT_OWNERS_SQL, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(ctx->err, "查询业主失败: %s\n", sqlite3_errmsg(ctx->db->db));
+        return CLI_EXIT_FAILURE;
+    }
+
+    CliTable table;
+    table_begin(&table, ctx, OWNER_COLUMNS, OWNER_COLUMN_COUNT);
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+    {
+        const char *values[CLI_MAX_COLUMNS];
+        for (int i = 0; i < OWNER_COLUMN_COUNT; i++)
+        {
+            values[i] = (const char *)sqlite3_column_text(stmt, i);
+        }
+        table_row(&table, values);
+    }
+    table_end(&table);
+    sqlite3_finalize(stmt);
+
+    if (rc != SQLITE_DONE)
+    {
+        fprintf(ctx->err, "导出业主失败: %s\n", sqlite3_errmsg(ctx->db->db));
+        return CLI_EXIT_FAILURE;
+    }
+    return CLI_EXIT_OK;
+}
+
+static int cmd_export_debtors(CliContext *ctx)
+{
+    int top;
+    if (!parse_count(ctx, "--top", CLI_DEFAULT_TOP, &top))
+    {
+        return CLI_EXIT_USAGE;
+    }
+    DebtorRank *ranks = top > 0 ? calloc(top, sizeof(DebtorRank)) : NULL;
+    if (top > 0 && !ranks)
+    {
+        fprintf(ctx->err, "内存分配失败：欠费排行\n");
+        return CLI_EXIT_FAILURE;
+    }
+    int count = top > 0 ? get_top_debtors(ctx->db, LEDGER_ALL_FEES, option_value(ctx, "--building"), top, ranks) : 0;
+    if (count < 0)
+    {
+        free(ranks);
+        return CLI_EXIT_FAILURE;
+    }
+
+    static const CliColumn columns[] = {
+        {"rank", true}, {"user_id", false}, {"name", false}, {"phone", false}, {"address", false},
+        {"fee_types", false}, {"outstanding", true}, {"overdue", true}, {"unpaid_count", true},
+        {"earliest_due", false},
+    };
+    CliTable table;
+    table_begin(&table, ctx, columns, 10);
+    for (int i = 0; i < count; i++)
+    {
+        const DebtorRank *rank = &ranks[i];
+        char position[16], outstanding[32], overdue[32], unpaid[16], due[32];
+        snprintf(position, sizeof(position), "%d", i + 1);
+        snprintf(outstanding, sizeof(outstanding), "%.2f", rank->ledger.billed_amount - rank->ledger.paid_amount);
+        snprintf(overdue, sizeof(overdue), "%.2f", rank->ledger.overdue_amount);
+        snprintf(unpaid, sizeof(unpaid), "%d", rank->ledger.unpaid_count);
+        const char *values[] = {position, rank->ledger.user_id, rank->name, rank->phone, rank->address,
+                                rank->fee_types, outstanding, overdue, unpaid,
+                                format_timestamp(due, sizeof(due), rank->earliest_due)};
+        table_row(&table, values);
+    }
+    table_end(&table);
+    free(ranks);
+    return CLI_EXIT_OK;
+}
+
+/**
+ * 分析快照：在一个读事务内把主要表导出为Arrow IPC文件，每个表输出一行结果
+ */
+static int cmd_export_arrow(CliContext *ctx)
+{
+    const char *out_dir = option_value(ctx, "--out");
+    if (!out_dir)
+    {
+        fprintf(ctx->err, "请用 --out 目录 指定输出目录\n");
+        return CLI_EXIT_USAGE;
+    }
+
+    AnalyticsSnapshotSummary summary;
+    bool ok = export_analytics_snapshot(ctx->db, out_dir, &summary);
+
+    static const CliColumn columns[] = {
+        {"table", false}, {"rows", true}, {"bytes", true}, {"elapsed_seconds", true},
+    };
+    char elapsed[32];
+    snprintf(elapsed, sizeof(elapsed), "%.3f", summary.elapsed_seconds);
+    CliTable table;
+    table_begin(&table, ctx, columns, 4);
+    for (int i = 0; i < summary.table_count; i++)
+    {
+        char rows[24], bytes[24];
+        snprintf(rows, sizeof(rows), "%lld", (long long)summary.tables[i].rows);
+        snprintf(bytes, sizeof(bytes), "%lld", (long long)summary.tables[i].bytes);
+        const char *values[] = {summary.tables[i].table, rows, bytes, elapsed};
+        table_row(&table, values);
+    }
+    table_end(&table);
+    return ok ? CLI_EXIT_OK : CLI_EXIT_FAILURE;
+}
+
+/**
+ * 批量导入：按业主、房屋、车位顺序导入CSV文件，被拒绝的行写入报告，每个文件输出一行结果
+ */
+static int cmd_import(CliContext *ctx)
+{
+    ImportFiles files = {
+        .owners_path = option_value(ctx, "--owners"),
+        .rooms_path = option_value(ctx, "--rooms"),
+        .parking_path = option_value(ctx, "--parking"),
+    };
+    if (!files.owners_path && !files.rooms_path && !files.parking_path)
+    {
+        fprintf(ctx->err, "请用 --owners、--rooms 或 --parking 指定要导入的文件\n");
+        return CLI_EXIT_USAGE;
+    }
+
+    char default_report[64];
+    const char *report_path = option_value(ctx, "--report");
+    if (!report_path)
+    {
+        time_t now = time(NULL);
+        struct tm tm_now;
+        localtime_r(&now, &tm_now);
+        strftime(default_report, sizeof(default_report), "import_rejects_%Y%m%d_%H%M%S.csv", &tm_now);
+        report_path = default_report;
+    }
+
+    ImportSummary summary;
+    bool ok = bulk_import(ctx->db, &files, report_path, &summary);
+
+    static const CliColumn columns[] = {
+        {"file", false},     {"rows", true},   {"imported", true},
+        {"rejected", true},  {"report", false}, {"elapsed_seconds", true},
+    };
+    const char *names[] = {"owners", "rooms", "parking"};
+    const char *paths[] = {files.owners_path, files.rooms_path, files.parking_path};
+    const ImportFileSummary *results[] = {&summary.owners, &summary.rooms, &summary.parking};
+    char elapsed[32];
+    snprintf(elapsed, sizeof(elapsed), "%.3f", summary.elapsed_seconds);
+
+    CliTable table;
+    table_begin(&table, ctx, columns, 6);
+    for (int i = 0; i < 3; i++)
+    {
+        if (!paths[i])
+        {
+            continue;
+        }
+        char rows[24], imported[24], rejected[24];
+        snprintf(rows, sizeof(rows), "%ld", results[i]->row_count);
+        snprintf(imported, sizeof(imported), "%ld", results[i]->imported_count);
+        snprintf(rejected, sizeof(rejected), "%ld", results[i]->rejected_count);
+        const char *values[] = {names[i], rows, imported, rejected, report_path, elapsed};
+        table_row(&table, values);
+    }
+    table_end(&table);
+    return ok ? CLI_EXIT_OK : CLI_EXIT_FAILURE;
+}
+
+/**
+ * 业主多列排序：字段为outstanding、area、building、room、registered、name，--top 0输出全部
+ */
+static int cmd_owners_sort(CliContext *ctx)
+{
+    OwnerSortKey keys[ROW_SORT_MAX_COLUMNS];
+    int key_count, top;
+    const char *spec = option_value(ctx, "--by");
+    if (!spec)
+    {
+        fprintf(ctx->err, "请用 --by 字段[:desc],... 指定排序字段\n");
+        return CLI_EXIT_USAGE;
+    }
+    if (!owner_sort_parse(spec, keys, ROW_SORT_MAX_COLUMNS, &key_count) ||
+        !parse_count(ctx, "--top", CLI_DEFAULT_TOP, &top))
+    {
+        return CLI_EXIT_USAGE;
+    }
+
+    OwnerSortTable owners;
+    RowSortStats stats;
+    if (!owner_sort_load(ctx->db, &owners))
+    {
+        return CLI_EXIT_FAILURE;
+    }
+    if (!owner_sort_apply(&owners, keys, key_count, &stats))
+    {
+        owner_sort_free(&owners);
+        return CLI_EXIT_FAILURE;
+    }
+    printf("已排序 %zu 位业主，键 %zu 字节，用时 %.2f ms%s\n", owners.count, stats.key_width,
+           stats.elapsed_seconds * 1000, stats.external ? "（外部归并）" : "");
+
+    static const CliColumn columns[] = {
+        {"rank", true},     {"user_id", false}, {"name", false},        {"phone", false},      {"building", false},
+        {"room", false},    {"area", true},     {"outstanding", true},  {"registered", false},
+    };
+    size_t limit = top > 0 && (size_t)top < owners.count ? (size_t)top : owners.count;
+    CliTable table;
+    table_begin(&table, ctx, columns, 9);
+    for (size_t i = 0; i < limit; i++)
+    {
+        uint32_t row = owners.order[i];
+        char rank[24], area[32], outstanding[32], registered[24];
+        snprintf(rank, sizeof(rank), "%zu", i + 1);
+        snprintf(area, sizeof(area), "%.2f", owners.areas[row]);
+        snprintf(outstanding, sizeof(outstanding), "%.2f", owners.outstanding[row]);
+        time_t reg_time = (time_t)owners.registered[row];
+        struct tm tm_reg;
+        localtime_r(&reg_time, &tm_reg);
+        strftime(registered, sizeof(registered), "%Y-%m-%d", &tm_reg);
+        const char *values[] = {rank,
+                                owners.user_ids[row],
+                                owners.names[row],
+                                owners.phones[row],
+                                owners.buildings[row],
+                                owners.rooms[row],
+                                owners.area_nulls[row] ? NULL : area,
+                                outstanding,
+                                registered};
+        table_row(&table, values);
+    }
+    table_end(&table);
+    owner_sort_free(&owners);
+    return CLI_EXIT_OK;
+}
+
+/**
+ * 检查ID只含字母、数字、'-'和'_'：模型层的部分查询把ID直接拼入SQL
+ */
+static bool check_id(const CliContext *ctx, const char *name, const char *id)
+{
+    if (!id || !*id)
+    {
+        fprintf(ctx->err, "请指定 %s\n", name);
+        return false;
+    }
+    for (const char *p = id; *p; p++)
+    {
+        if (!isalnum((unsigned char)*p) && *p != '-' && *p != '_')
+        {
+            fprintf(ctx->err, "%s 含有非法字符: %s\n", name, id);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * 前台查找业主：按业主ID或用户名精确查找，或按姓名、电话前缀及房号筛选，条件可组合
+ */
+static int cmd_owners_find(CliContext *ctx)
+{
+    const char *filters[] = {option_value(ctx, "--id"), option_value(ctx, "--name"),
+                             option_value(ctx, "--phone"), option_value(ctx, "--room")};
+    static const char *FILTER_SQL[] = {
+        " AND (u.user_id = ?1 OR u.username = ?1)",
+        " AND u.name LIKE ? || '%'",
+        " AND u.phone_number LIKE ? || '%'",
+        " AND u.user_id IN (SELECT owner_id FROM rooms WHERE room_number = ?)",
+    };
+    int top;
+    if (!parse_count(ctx, "--top", CLI_DEFAULT_TOP, &top))
+    {
+        return CLI_EXIT_USAGE;
+    }
+
+    // 只拼接给出的条件，按业主ID或用户名查找时走索引
+    char sql[2048];
+    size_t len = snprintf(sql, sizeof(sql), "%s", FIND_OWNERS_SQL);
+    bool any = false;
+    for (int i = 0; i < 4; i++)
+    {
+        if (filters[i])
+        {
+            len += snprintf(sql + len, sizeof(sql) - len, "%s", FILTER_SQL[i]);
+            any = true;
+        }
+    }
+    if (!any)
+    {
+        fprintf(ctx->err, "请至少指定 --id、--name、--phone 或 --room 之一\n");
+        return CLI_EXIT_USAGE;
+    }
+    snprintf(sql + len, sizeof(sql) - len, " ORDER BY u.user_id LIMIT %d", top);
+
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(ctx->db->db, sql, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(ctx->err, "查询业主失败: %s\n", sqlite3_errmsg(ctx->db->db));
+        return CLI_EXIT_FAILURE;
+    }
+    int index = 1;
+    for (int i = 0; i < 4; i++)
+    {
+        if (filters[i])
+        {
+            sqlite3_bind_text(stmt, index++, filters[i], -1, SQLITE_STATIC);
+        }
+    }
+
+    CliTable table;
+    table_begin(&table, ctx, OWNER_COLUMNS, OWNER_COLUMN_COUNT);
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+    {
+        const char *values[CLI_MAX_COLUMNS];
+        for (int i = 0; i < OWNER_COLUMN_COUNT; i++)
+        {
+            values[i] = (const char *)sqlite3_column_text(stmt, i);
+        }
+        table_row(&table, values);
+    }
+    table_end(&table);
+    sqlite3_finalize(stmt);
+
+    if (rc != SQLITE_DONE)
+    {
+        fprintf(ctx->err, "查询业主失败: %s\n", sqlite3_errmsg(ctx->db->db));
+        return CLI_EXIT_FAILURE;
+    }
+    return CLI_EXIT_OK;
+}
+
+/**
+ * 业主名下的房屋
+ */
+static int cmd_rooms_list(CliContext *ctx)
+{
+    const char *owner_id = option_value(ctx, "--owner");
+    if (!check_id(ctx, "--owner", owner_id))
+    {
+        return CLI_EXIT_USAGE;
+    }
+    QueryResult result;
+    if (!get_owner_rooms(ctx->db, "", USER_STAFF, owner_id, &result))
+    {
+        fprintf(ctx->err, "查询业主房屋失败\n");
+        return CLI_EXIT_FAILURE;
+    }
+
+    static const CliColumn columns[] = {
+        {"room_id", false}, {"building_id", false}, {"building", false}, {"room_number", false},
+        {"floor", true},    {"area_sqm", true},     {"status", true},
+    };
+    CliTable table;
+    table_begin(&table, ctx, columns, 7);
+    for (int i = 0; i < result.row_count; i++)
+    {
+        table_row(&table, (const char *const *)result.rows[i].values);
+    }
+    table_end(&table);
+    free_query_result(&result);
+    return CLI_EXIT_OK;
+}
+
+/**
+ * 业主的账单，--unpaid时只列未结（未付和逾期）账单
+ */
+static int cmd_bills_list(CliContext *ctx)
+{
+    const char *owner_id = option_value(ctx, "--owner");
+    if (!check_id(ctx, "--owner", owner_id))
+    {
+        return CLI_EXIT_USAGE;
+    }
+    bool unpaid_only = option_flag(ctx, "--unpaid");
+    QueryResult result;
+    if (!get_owner_transactions(ctx->db, "", USER_STAFF, owner_id, &result))
+    {
+        fprintf(ctx->err, "查询业主账单失败\n");
+        return CLI_EXIT_FAILURE;
+    }
+
+    static const CliColumn columns[] = {
+        {"transaction_id", false}, {"room_id", false},      {"parking_id", false},
+        {"fee_type", true},        {"amount", true},        {"status", true},
+        {"due_date", false},       {"payment_date", false}, {"payment_method", true},
+        {"period_start", false},   {"period_end", false},
+    };
+    CliTable table;
+    table_begin(&table, ctx, columns, 11);
+    for (int i = 0; i < result.row_count; i++)
+    {
+        char *const *row = result.rows[i].values;
+        int status = row[9] ? atoi(row[9]) : TRANS_UNPAID;
+        if (unpaid_only && status != TRANS_UNPAID && status != TRANS_OVERDUE)
+        {
+            continue;
+        }
+        char due[32], paid_at[32], start[32], end[32];
+        const char *values[] = {
+            row[0], row[2], row[3], row[4], row[5], row[9],
+            format_timestamp(due, sizeof(due), row[7] ? (time_t)atoll(row[7]) : 0),
+            format_timestamp(paid_at, sizeof(paid_at), row[6] ? (time_t)atoll(row[6]) : 0),
+            row[8],
+            format_timestamp(start, sizeof(start), row[10] ? (time_t)atoll(row[10]) : 0),
+            format_timestamp(end, sizeof(end), row[11] ? (time_t)atoll(row[11]) : 0),
+        };
+        table_row(&table, values);
+    }
+    table_end(&table);
+    free_query_result(&result);
+    return CLI_EXIT_OK;
+}
+
+/**
+ * 前台收费：支付指定账单（--bills逗号分隔）或全部欠费（--all），整批成功或整批回滚。
+ * 必须带幂等键，网络中断后以同一个键重试不会重复收费
+ */
+static int cmd_pay(CliContext *ctx)
+{
+    static const char *METHOD_KEYS[] = {"cash", "card", "wechat", "alipay", "other"};
+    static const int METHODS[] = {PAYMENT_CASH, PAYMENT_CARD, PAYMENT_WECHAT, PAYMENT_ALIPAY, PAYMENT_OTHER};
+    static const char *OUTCOME_KEYS[] = {"paid", "replayed", "not_found", "already_paid",
+                                         "key_conflict", "rolled_back", "failed"};
+
+    const char *owner_id = option_value(ctx, "--owner");
+    const char *bill_list = option_value(ctx, "--bills");
+    const char *method_name = option_value(ctx, "--method");
+    const char *key = option_value(ctx, "--key");
+    bool pay_all = option_flag(ctx, "--all");
+    if (!owner_id || !method_name || !key || !*key || pay_all == (bill_list != NULL))
+    {
+        fprintf(ctx->err, "须指定 --owner、--method、--key，以及 --bills 或 --all 之一\n");
+        return CLI_EXIT_USAGE;
+    }
+    int method = -1;
+    for (int i = 0; i < 5; i++)
+    {
+        if (strcmp(method_name, METHOD_KEYS[i]) == 0)
+            method = METHODS[i];
+    }
+    if (method < 0)
+    {
+        fprintf(ctx->err, "未知支付方式: %s\n", method_name);
+        return CLI_EXIT_USAGE;
+    }
+
+    // 拆分账单ID列表，ids指向bills内部
+    char *bills = bill_list ? strdup(bill_list) : NULL;
+    const char **ids = bills ? calloc(strlen(bills) / 2 + 1, sizeof(char *)) : NULL;
+    int count = 0;
+    if (bill_list && (!bills || !ids))
+    {
+        fprintf(ctx->err, "内存分配失败：账单列表\n");
+        free(bills);
+        return CLI_EXIT_FAILURE;
+    }
+    char *saveptr = NULL;
+    for (char *id = bills ? strtok_r(bills, ",", &saveptr) : NULL; id; id = strtok_r(NULL, ",", &saveptr))
+    {
+        ids[count++] = id;
+    }
+    if (bill_list && count == 0)
+    {
+        fprintf(ctx->err, "--bills 为空\n");
+        free(ids);
+        free(bills);
+        return CLI_EXIT_USAGE;
+    }
+
+    PaymentReceipt receipt;
+    bool ok = process_batch_payment(ctx->db, owner_id, pay_all ? NULL : ids, count, method, key, &receipt);
+    free(ids);
+    free(bills);
+
+    static const CliColumn columns[] = {
+        {"transaction_id", false}, {"fee_type", true}, {"amount", true}, {"outcome", false},
+    };
+    CliTable table;
+    table_begin(&table, ctx, columns, 4);
+    for (int i = 0; i < receipt.item_count; i++)
+    {
+        const PaymentReceiptItem *item = &receipt.items[i];
+        char fee_type[16], amount[32];
+        snprintf(fee_type, sizeof(fee_type), "%d", item->fee_type);
+        snprintf(amount, sizeof(amount), "%.2f", item->amount);
+        const char *values[] = {item->transaction_id, fee_type, amount,
+                                item->outcome <= PAY_FAILED ? OUTCOME_KEYS[item->outcome] : NULL};
+        table_row(&table, values);
+    }
+    table_end(&table);
+    if (!ok)
+    {
+        fprintf(ctx->err, "缴费失败，整批未入账\n");
+    }
+    free_payment_receipt(&receipt);
+    return ok ? CLI_EXIT_OK : CLI_EXIT_FAILURE;
+}
+
+static int cmd_statements(CliContext *ctx)
+{
+    int year, month;
+    const char *out_dir = option_value(ctx, "--out");
+    if (!parse_month(option_value(ctx, "--month"), &year, &month) || !out_dir)
+    {
+        fprintf(ctx->err, "请用 --month YYYY-MM 和 --out 目录 指定月份和输出目录\n");
+        return CLI_EXIT_USAGE;
+    }
+
+    StatementFormat format = STATEMENT_TEXT;
+    const char *as = option_value(ctx, "--as");
+    if (as && strcmp(as, "html") == 0)
+        format = STATEMENT_HTML;
+    else if (as && strcmp(as, "csv") == 0)
+        format = STATEMENT_CSV;
+    else if (as && strcmp(as, "text") != 0)
+    {
+        fprintf(ctx->err, "未知对账单格式: %s\n", as);
+        return CLI_EXIT_USAGE;
+    }
+
+    StatementSummary summary;
+    if (!generate_monthly_statements(ctx->db, year, month, format, out_dir, &summary))
+    {
+        return CLI_EXIT_FAILURE;
+    }
+
+    static const CliColumn columns[] = {
+        {"owner_count", true}, {"file_count", true}, {"failed_count", true}, {"elapsed_seconds", true},
+    };
+    char owners[16], files[16], failed[16], elapsed[32];
+    snprintf(owners, sizeof(owners), "%d", summary.owner_count);
+    snprintf(files, sizeof(files), "%d", summary.file_count);
+    snprintf(failed, sizeof(failed), "%d", summary.failed_count);
+    snprintf(elapsed, sizeof(elapsed), "%.3f", summary.elapsed_seconds);
+    const char *values[] = {owners, files, failed, elapsed};
+
+    CliTable table;
+    table_begin(&table, ctx, columns, 4);
+    table_row(&table, values);
+    table_end(&table);
+    return summary.failed_count == 0 ? CLI_EXIT_OK : CLI_EXIT_FAILURE;
+}
+
+/**
+ * 输出一次任务运行结果，成功返回CLI_EXIT_OK
+ */
+static int print_job_result(CliContext *ctx, const char *job_name, JobStatus status, const char *message)
+{
+    static const CliColumn columns[] = {{"job", false}, {"status", false}, {"message", false}};
+    const char *values[] = {job_name, JOB_STATUS_KEYS[status], message};
+
+    CliTable table;
+    table_begin(&table, ctx, columns, 3);
+    table_row(&table, values);
+    table_end(&table);
+    return status == JOB_SUCCEEDED ? CLI_EXIT_OK : CLI_EXIT_FAILURE;
+}
+
+/**
+ * 备份：指定--output时在线备份到该文件，否则运行后台备份任务（按星期轮换）
+ */
+static int cmd_backup(CliContext *ctx)
+{
+    char message[512];
+    const char *output = option_value(ctx, "--output");
+    if (output)
+    {
+        bool ok = db_backup(ctx->db, output) == SQLITE_OK;
+        snprintf(message, sizeof(message), ok ? "已备份到%s" : "备份到%s失败", output);
+        return print_job_result(ctx, "backup", ok ? JOB_SUCCEEDED : JOB_FAILED, message);
+    }
+
+    JobStatus status = scheduler_run_job(ctx->db, "backup", message, sizeof(message));
+    return print_job_result(ctx, "backup", status, message);
+}
+
+static int cmd_jobs_list(CliContext *ctx)
+{
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(ctx->db->db, LIST_JOBS_SQL, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(ctx->err, "查询后台任务失败: %s\n", sqlite3_errmsg(ctx->db->db));
+        return CLI_EXIT_FAILURE;
+    }
+
+    static const CliColumn columns[] = {
+        {"job", false}, {"schedule", false}, {"enabled", true},
+        {"next_run", false}, {"last_run", false}, {"last_status", false},
+    };
+    CliTable table;
+    table_begin(&table, ctx, columns, 6);
+    while (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        char next_run[32], last_run[32];
+        int status = sqlite3_column_int(stmt, 5);
+        bool has_status = sqlite3_column_type(stmt, 5) != SQLITE_NULL && status >= 0 && status <= JOB_SKIPPED;
+        const char *values[] = {
+            (const char *)sqlite3_column_text(stmt, 0),
+            (const char *)sqlite3_column_text(stmt, 1),
+            sqlite3_column_int(stmt, 2) ? "true" : "false",
+            format_timestamp(next_run, sizeof(next_run), (time_t)sqlite3_column_int64(stmt, 3)),
+            format_timestamp(last_run, sizeof(last_run), (time_t)sqlite3_column_int64(stmt, 4)),
+            has_status ? JOB_STATUS_KEYS[status] : NULL,
+        };
+        table_row(&table, values);
+    }
+    table_end(&table);
+    sqlite3_finalize(stmt);
+    return CLI_EXIT_OK;
+}
+
+static int cmd_jobs_run(CliContext *ctx)
+{
+    if (ctx->argc != 1 || ctx->argv[0][0] == '-')
+    {
+        fprintf(ctx->err, "请指定一个任务名\n");
+        return CLI_EXIT_USAGE;
+    }
+
+    char message[512];
+    JobStatus status = scheduler_run_job(ctx->db, ctx->argv[0], message, sizeof(message));
+    return print_job_result(ctx, ctx->argv[0], status, message);
+}
+
+static void print_usage(FILE *out)
+{
+    fprintf(out, "用法: pms [--db 路径] [--socket 路径] [--format tsv|csv|json] [--quiet] <命令> [参数]\n\n命令:\n");
+    for (int i = 0; i < COMMAND_COUNT; i++)
+    {
+        fprintf(out, "  %s%s%s %s\n", COMMANDS[i].name, COMMANDS[i].sub ? " " : "",
+                COMMANDS[i].sub ? COMMANDS[i].sub : "", COMMANDS[i].usage);
+    }
+    fprintf(out, "  serve [--workers N]              启动本地服务，监听--socket指定的套接字\n");
+    fprintf(out, "  call <命令> [参数]               通过本地服务执行命令\n");
+    fprintf(out, "  bench [--requests N] [--connections C] <命令> [参数]  对本地服务压测\n");
+    fprintf(out, "  desk                             前台终端，逐行输入命令经本地服务执行\n");
+    fprintf(out, "\n不带参数运行时进入交互界面。退出码: 0 成功，1 执行失败，2 命令或参数错误\n");
+}
+
+/**
+ * @brief 执行一条命令
+ *
+ * 命令行模式和本地服务共用：argv从可选的--format开始，随后是命令、子命令和参数
+ *
+ * @param db 数据库连接
+ * @param argc 参数个数
+ * @param argv 参数
+ * @param out 结果输出
+ * @param err 错误信息输出
+ * @return int 退出码
+ */
+int cli_execute(Database *db, int argc, char *argv[], FILE *out, FILE *err)
+{
+    CliContext ctx;
+    ctx.db = db;
+    ctx.out = out;
+    ctx.err = err;
+    ctx.format = CLI_FORMAT_TSV;
+
+    int i = 0;
+    if (i + 1 < argc && strcmp(argv[i], "--format") == 0)
+    {
+        const char *name = argv[i + 1];
+        if (strcmp(name, "tsv") == 0)
+            ctx.format = CLI_FORMAT_TSV;
+        else if (strcmp(name, "csv") == 0)
+            ctx.format = CLI_FORMAT_CSV;
+        else if (strcmp(name, "json") == 0)
+            ctx.format = CLI_FORMAT_JSON;
+        else
+        {
+            fprintf(err, "未知输出格式: %s\n", name);
+            return CLI_EXIT_USAGE;
+        }
+        i += 2;
+    }
+
+    if (i >= argc)
+    {
+        print_usage(err);
+        return CLI_EXIT_USAGE;
+    }
+    if (strcmp(argv[i], "help") == 0)
+    {
+        print_usage(out);
+        return CLI_EXIT_OK;
+    }
+
+    const CliCommand *command = NULL;
+    for (int c = 0; c < COMMAND_COUNT && !command; c++)
+    {
+        if (strcmp(COMMANDS[c].name, argv[i]) == 0 &&
+            (!COMMANDS[c].sub || (i + 1 < argc && strcmp(COMMANDS[c].sub, argv[i + 1]) == 0)))
+        {
+            command = &COMMANDS[c];
+        }
+    }
+    if (!command)
+    {
+        fprintf(err, "未知命令: %s%s%s\n\n", argv[i], i + 1 < argc ? " " : "", i + 1 < argc ? argv[i + 1] : "");
+        print_usage(err);
+        return CLI_EXIT_USAGE;
+    }
+
+    ctx.argv = argv + i + (command->sub ? 2 : 1);
+    ctx.argc = argc - i - (command->sub ? 2 : 1);
+    if (!check_options(&ctx, command))
+    {
+        fprintf(err, "用法: pms %s%s%s %s\n", command->name, command->sub ? " " : "",
+                command->sub ? command->sub : "", command->usage);
+        return CLI_EXIT_USAGE;
+    }
+    return command->run(&ctx);
+}
+
+/**
+ * @brief 命令行模式入口
+ *
+ * 先处理进程级选项（--db、--socket、--quiet），serve、call、bench交给本地服务模块，其余命令在本进程执行。
+ * 模型层的提示信息使用printf输出，为保证标准输出只有结果，先把标准输出复制一份留给结果，
+ * 再把文件描述符1指向标准错误（--quiet时指向/dev/null），之后的提示信息都不会混入结果。
+ *
+ * @param argc 参数个数（含程序名）
+ * @param argv 参数
+ * @return int 退出码
+ */
+int cli_main(int argc, char *argv[])
+{
+    const char *db_path = NULL;
+    const char *socket_path = NULL;
+    bool quiet = false;
+
+    // 进程级选项从参数中取出，--format留给cli_execute
+    char **args = calloc(argc + 1, sizeof(char *));
+    if (!args)
+    {
+        fprintf(stderr, "内存分配失败：命令行参数\n");
+        return CLI_EXIT_FAILURE;
+    }
+    int count = 0;
+    int i = 1;
+    for (; i < argc && strncmp(argv[i], "--", 2) == 0; i++)
+    {
+        if (strcmp(argv[i], "--help") == 0)
+        {
+            print_usage(stdout);
+            free(args);
+            return CLI_EXIT_OK;
+        }
+        else if (strcmp(argv[i], "--quiet") == 0)
+        {
+            quiet = true;
+        }
+        else if (strcmp(argv[i], "--db") == 0 && i + 1 < argc)
+        {
+            db_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--socket") == 0 && i + 1 < argc)
+        {
+            socket_path = argv[++i];
+        }
+        else if (strcmp(argv[i], "--format") == 0 && i + 1 < argc)
+        {
+            args[count++] = argv[i];
+            args[count++] = argv[++i];
+        }
+        else
+        {
+            fprintf(stderr, "未知选项: %s\n\n", argv[i]);
+            print_usage(stderr);
+            free(args);
+            return CLI_EXIT_USAGE;
+        }
+    }
+    const char *command = i < argc ? argv[i] : "";
+    bool remote = strcmp(command, "call") == 0 || strcmp(command, "bench") == 0 || strcmp(command, "desk") == 0;
+    if (remote)
+    {
+        i++;
+    }
+    for (; i < argc; i++)
+    {
+        args[count++] = argv[i];
+    }
+
+    char data_dir[256];
+    char default_db[512], default_socket[512];
+    if ((!db_path || !socket_path) && !get_data_dir(data_dir, sizeof(data_dir)))
+    {
+        fprintf(stderr, "无法获取数据目录\n");
+        free(args);
+        return CLI_EXIT_FAILURE;
+    }
+    if (!socket_path)
+    {
+        snprintf(default_socket, sizeof(default_socket), "%s/%s", data_dir, SERVICE_SOCKET_FILENAME);
+        socket_path = default_socket;
+    }
+
+    int code;
+    if (strcmp(command, "call") == 0)
+    {
+        code = service_call(socket_path, count, args, stdout, stderr);
+        free(args);
+        return code;
+    }
+    if (strcmp(command, "bench") == 0)
+    {
+        code = service_bench(socket_path, count, args, stdout);
+        free(args);
+        return code;
+    }
+    if (strcmp(command, "desk") == 0)
+    {
+        free(args);
+        if (count != 0)
+        {
+            fprintf(stderr, "用法: pms [--socket 路径] desk（每行输入一条命令，可以--format开头）\n");
+            return CLI_EXIT_USAGE;
+        }
+        return service_desk(socket_path, stdin, stdout, stderr);
+    }
+
+    if (!db_path)
+    {
+        snprintf(default_db, sizeof(default_db), "%s/%s", data_dir, DB_FILENAME);
+        db_path = default_db;
+    }
+    else if (!file_exists(db_path))
+    {
+        fprintf(stderr, "数据库文件不存在: %s\n", db_path);
+        free(args);
+        return CLI_EXIT_FAILURE;
+    }
+
+    if (strcmp(command, "serve") == 0)
+    {
+        int workers = 0;
+        if (count == 3 && strcmp(args[1], "--workers") == 0)
+        {
+            workers = atoi(args[2]);
+        }
+        else if (count != 1)
+        {
+            fprintf(stderr, "用法: pms [--db 路径] [--socket 路径] serve [--workers N]\n");
+            free(args);
+            return CLI_EXIT_USAGE;
+        }
+        free(args);
+
+        // 服务使用前先确保表结构已初始化
+        Database db;
+        if (db_init(&db, db_path) != SQLITE_OK)
+        {
+            fprintf(stderr, "无法初始化数据库\n");
+            return CLI_EXIT_FAILURE;
+        }
+        db_close(&db);
+        return service_run(db_path, socket_path, workers) ? CLI_EXIT_OK : CLI_EXIT_FAILURE;
+    }
+
+    // 结果写到原标准输出，其余输出改道
+    fflush(stdout);
+    int result_fd = dup(STDOUT_FILENO);
+    FILE *out = result_fd >= 0 ? fdopen(result_fd, "w") : NULL;
+    if (!out)
+    {
+        fprintf(stderr, "无法打开标准输出\n");
+        free(args);
+        return CLI_EXIT_FAILURE;
+    }
+    if (quiet)
+    {
+        if (!freopen("/dev/null", "w", stdout))
+        {
+            fprintf(stderr, "无法重定向提示信息\n");
+        }
+    }
+    else
+    {
+        dup2(STDERR_FILENO, STDOUT_FILENO);
+        setvbuf(stdout, NULL, _IOLBF, 0);
+    }
+
+    Database db;
+    if (db_init(&db, db_path) != SQLITE_OK)
+    {
+        fprintf(stderr, "无法初始化数据库\n");
+        fclose(out);
+        free(args);
+        return CLI_EXIT_FAILURE;
+    }
+
+    code = cli_execute(&db, count, args, out, stderr);
+
+    db_close(&db);
+    fflush(stdout);
+    fclose(out);
+    free(args);
+    return code;
+}
@@ -0,0 +1,1345 @@
+#define _GNU_SOURCE // struct ucred
+#include "cli/service.h"
+#include "cli/cli.h"
+#include "db/database.h"
+#include "models/scheduler.h"
+#include "utils/thread_pool.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/types.h>
+#include <time.h>
+#include <unistd.h>
+
+#define SERVICE_BUSY_TIMEOUT_MS 10000
+#define SERVICE_MAX_EVENTS 64
+#define SERVICE_READ_CHUNK 65536
+#define SERVICE_CACHE_KIB 16384                  // 每个连接的页缓存（KiB）
+#define SERVICE_MMAP_BYTES (256LL * 1024 * 1024) // 内存映射读，各连接共用操作系统页缓存
+#define BENCH_DEFAULT_REQUESTS 1000
+#define BENCH_DEFAULT_CONNECTIONS 4
+#define DESK_MAX_LINE 4096
+#define DESK_MAX_ARGS 64
+
+// 一个客户端连接，只由事件循环线程访问
+typedef struct Connection
+{
+    int fd;
+    unsigned char *in; // 未处理完的请求字节
+    size_t in_len;
+    size_t in_cap;
+    unsigned char *out; // 待发送的响应字节
+    size_t out_len;
+    size_t out_cap;
+    size_t out_sent;
+    bool want_write; // 已注册EPOLLOUT
+    bool closed;     // 套接字已关闭，等在途请求完成后释放
+    int pending;     // 在途请求数
+    uid_t peer_uid;  // 对端进程的用户，取不到时为(uid_t)-1
+    struct Connection *prev;
+    struct Connection *next;
+} Connection;
+
+typedef struct Service Service;
+
+// 一个请求，由工作线程执行后经完成队列交回事件循环
+typedef struct Request
+{
+    Service *service;
+    Connection *conn;
+    uint32_t request_id;
+    uid_t peer_uid;
+    int argc;
+    char **argv; // 指向args内部
+    char *args;
+    unsigned char *response;
+    size_t response_len;
+    struct Request *next;
+} Request;
+
+struct Service
+{
+    int epoll_fd;
+    int listen_fd;
+    int wake_fd; // 工作线程完成请求后写入，唤醒事件循环
+    ThreadPool *pool;
+
+    // 数据库连接池，每个工作线程同一时间占用一个连接，语句缓存在连接上常驻
+    Database *connections;
+    int connection_count;
+    int *idle;
+    int idle_count;
+    pthread_mutex_t pool_lock;
+    pthread_cond_t pool_ready;
+
+    // 完成队列
+    pthread_mutex_t done_lock;
+    Request *done_head;
+    Request *done_tail;
+
+    int inflight;
+    long served;
+    Connection *clients;
+};
+
+// epoll事件中区分监听套接字和唤醒描述符
+static char LISTEN_TAG;
+static char WAKE_TAG;
+
+// 带文件路径的选项。服务以服务账户的权限读写文件，客户端发送前把路径解析为绝对路径，
+// 服务端只执行与服务同一用户发来的此类命令
+static const char *const PATH_OPTIONS[] = {"--out", "--output", "--owners", "--rooms", "--parking", "--report"};
+
+static volatile sig_atomic_t service_stopping = 0;
+
+static void handle_stop_signal(int sig)
+{
+    (void)sig;
+    service_stopping = 1;
+}
+
+static void put_u32(unsigned char *p, uint32_t value)
+{
+    p[0] = (unsigned char)(value >> 24);
+    p[1] = (unsigned char)(value >> 16);
+    p[2] = (unsigned char)(value >> 8);
+    p[3] = (unsigned char)value;
+}
+
+static uint32_t get_u32(const unsigned char *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static bool buffer_reserve(unsigned char **buf, size_t *cap, size_t need)
+{
+    if (need <= *cap)
+    {
+        return true;
+    }
+    size_t new_cap = *cap ? *cap : 4096;
+    while (new_cap < need)
+    {
+        new_cap *= 2;
+    }
+    unsigned char *grown = realloc(*buf, new_cap);
+    if (!grown)
+    {
+        return false;
+    }
+    *buf = grown;
+    *cap = new_cap;
+    return true;
+}
+
+/**
+ * 组装响应帧
+ */
+static unsigned char *build_response(uint32_t request_id, int exit_code, const char *output, size_t output_len,
+                                     const char *error, size_t error_len, size_t *frame_len)
+{
+    *frame_len = 16 + output_len + error_len;
+    unsigned char *frame = malloc(*frame_len);
+    if (!frame)
+    {
+        return NULL;
+    }
+    put_u32(frame, (uint32_t)(*frame_len - 4));
+    put_u32(frame + 4, request_id);
+    put_u32(frame + 8, (uint32_t)exit_code);
+    put_u32(frame + 12, (uint32_t)output_len);
+    if (output_len)
+        memcpy(frame + 16, output, output_len);
+    if (error_len)
+        memcpy(frame + 16 + output_len, error, error_len);
+    return frame;
+}
+
+/**
+ * 参数是带文件路径的选项（"--out 值"或"--out=值"）时返回选项名长度，否则返回0
+ */
+static size_t path_option(const char *arg)
+{
+    for (size_t i = 0; i < sizeof(PATH_OPTIONS) / sizeof(PATH_OPTIONS[0]); i++)
+    {
+        size_t len = strlen(PATH_OPTIONS[i]);
+        if (strncmp(arg, PATH_OPTIONS[i], len) == 0 && (arg[len] == '\0' || arg[len] == '='))
+        {
+            return len;
+        }
+    }
+    return 0;
+}
+
+/**
+ * 检查请求中的文件路径：须由与服务同一用户（或root）发出，且为绝对路径
+ */
+static bool check_path_args(const Request *request, FILE *err)
+{
+    for (int i = 0; i < request->argc; i++)
+    {
+        const char *arg = request->argv[i];
+        size_t len = path_option(arg);
+        if (len == 0)
+        {
+            continue;
+        }
+        if (request->peer_uid != geteuid() && request->peer_uid != 0)
+        {
+            fprintf(err, "%.*s 只能由服务账户通过本地服务执行，请改用 pms --db 直接运行该命令\n", (int)len, arg);
+            return false;
+        }
+        const char *path = arg[len] == '=' ? arg + len + 1 : (i + 1 < request->argc ? request->argv[i + 1] : "");
+        if (path[0] != '/')
+        {
+            fprintf(err, "%.*s 须为绝对路径: %s\n", (int)len, arg, path);
+            return false;
+        }
+    }
+    return true;
+}
+
+static Database *acquire_connection(Service *service)
+{
+    pthread_mutex_lock(&service->pool_lock);
+    while (service->idle_count == 0)
+    {
+        pthread_cond_wait(&service->pool_ready, &service->pool_lock);
+    }
+    Database *db = &service->connections[service->idle[--service->idle_count]];
+    pthread_mutex_unlock(&service->pool_lock);
+    return db;
+}
+
+static void release_connection(Service *service, Database *db)
+{
+    pthread_mutex_lock(&service->pool_lock);
+    service->idle[service->idle_count++] = (int)(db - service->connections);
+    pthread_cond_signal(&service->pool_ready);
+    pthread_mutex_unlock(&service->pool_lock);
+}
+
+static void free_request(Request *request)
+{
+    free(request->argv);
+    free(request->args);
+    free(request->response);
+    free(request);
+}
+
+/**
+ * 工作线程：在连接池中的连接上执行命令，结果放入完成队列
+ */
+static bool handle_request(void *arg)
+{
+    Request *request = arg;
+    Service *service = request->service;
+
+    char *output = NULL, *error = NULL;
+    size_t output_len = 0, error_len = 0;
+    FILE *out = open_memstream(&output, &output_len);
+    FILE *err = open_memstream(&error, &error_len);
+    int exit_code = CLI_EXIT_FAILURE;
+    if (out && err && check_path_args(request, err))
+    {
+        Database *db = acquire_connection(service);
+        exit_code = cli_execute(db, request->argc, request->argv, out, err);
+        release_connection(service, db);
+    }
+    if (out)
+        fclose(out);
+    if (err)
+        fclose(err);
+
+    request->response = build_response(request->request_id, exit_code, output, output ? output_len : 0,
+                                       error, error ? error_len : 0, &request->response_len);
+    free(output);
+    free(error);
+
+    pthread_mutex_lock(&service->done_lock);
+    if (service->done_tail)
+        service->done_tail->next = request;
+    else
+        service->done_head = request;
+    service->done_tail = request;
+    pthread_mutex_unlock(&service->done_lock);
+
+    uint64_t one = 1;
+    if (write(service->wake_fd, &one, sizeof(one)) < 0 && errno != EAGAIN)
+    {
+        fprintf(stderr, "唤醒事件循环失败: %s\n", strerror(errno));
+    }
+    return true;
+}
+
+static void free_client(Connection *conn)
+{
+    free(conn->in);
+    free(conn->out);
+    free(conn);
+}
+
+/**
+ * 关闭连接；仍有在途请求时只关闭套接字，待请求完成后再释放
+ */
+static void close_client(Service *service, Connection *conn)
+{
+    if (conn->closed)
+    {
+        return;
+    }
+    epoll_ctl(service->epoll_fd, EPOLL_CTL_DEL, conn->fd, NULL);
+    close(conn->fd);
+    conn->closed = true;
+
+    if (conn->prev)
+        conn->prev->next = conn->next;
+    else
+        service->clients = conn->next;
+    if (conn->next)
+        conn->next->prev = conn->prev;
+
+    if (conn->pending == 0)
+    {
+        free_client(conn);
+    }
+}
+
+/**
+ * 尽量发送缓冲的响应，发不完时注册EPOLLOUT；连接出错返回false
+ */
+static bool flush_client(Service *service, Connection *conn)
+{
+    while (conn->out_sent < conn->out_len)
+    {
+        ssize_t n = send(conn->fd, conn->out + conn->out_sent, conn->out_len - conn->out_sent, MSG_NOSIGNAL);
+        if (n > 0)
+        {
+            conn->out_sent += (size_t)n;
+        }
+        else if (n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            break;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    if (conn->out_sent == conn->out_len)
+    {
+        conn->out_sent = 0;
+        conn->out_len = 0;
+    }
+
+    bool want_write = conn->out_len > 0;
+    if (want_write != conn->want_write)
+    {
+        struct epoll_event event = {0};
+        event.events = EPOLLIN | (want_write ? EPOLLOUT : 0);
+        event.data.ptr = conn;
+        epoll_ctl(service->epoll_fd, EPOLL_CTL_MOD, conn->fd, &event);
+        conn->want_write = want_write;
+    }
+    return true;
+}
+
+static bool queue_response(Service *service, Connection *conn, const unsigned char *frame, size_t len)
+{
+    if (conn->out_sent > 0)
+    {
+        memmove(conn->out, conn->out + conn->out_sent, conn->out_len - conn->out_sent);
+        conn->out_len -= conn->out_sent;
+        conn->out_sent = 0;
+    }
+    if (!buffer_reserve(&conn->out, &conn->out_cap, conn->out_len + len))
+    {
+        return false;
+    }
+    memcpy(conn->out + conn->out_len, frame, len);
+    conn->out_len += len;
+    return flush_client(service, conn);
+}
+
+/**
+ * 在事件循环中直接回复错误（请求格式错误、繁忙等）
+ */
+static bool reply_error(Service *service, Connection *conn, uint32_t request_id, int exit_code, const char *message)
+{
+    size_t len;
+    unsigned char *frame = build_response(request_id, exit_code, NULL, 0, message, strlen(message), &len);
+    bool ok = frame && queue_response(service, conn, frame, len);
+    free(frame);
+    return ok;
+}
+
+static Request *create_request(Service *service, Connection *conn, uint32_t request_id,
+                               const unsigned char *args, size_t args_len)
+{
+    Request *request = calloc(1, sizeof(Request));
+    if (!request)
+    {
+        return NULL;
+    }
+    request->service = service;
+    request->conn = conn;
+    request->request_id = request_id;
+    request->peer_uid = conn->peer_uid;
+    request->args = malloc(args_len);
+    for (size_t i = 0; i < args_len; i++)
+    {
+        request->argc += args[i] == '\0';
+    }
+    request->argv = calloc(request->argc + 1, sizeof(char *));
+    if (!request->args || !request->argv)
+    {
+        free_request(request);
+        return NULL;
+    }
+
+    memcpy(request->args, args, args_len);
+    char *p = request->args;
+    for (int i = 0; i < request->argc; i++)
+    {
+        request->argv[i] = p;
+        p += strlen(p) + 1;
+    }
+    return request;
+}
+
+/**
+ * 取出缓冲区中完整的请求帧交给线程池；协议错误返回false
+ */
+static bool dispatch_frames(Service *service, Connection *conn)
+{
+    size_t offset = 0;
+    while (conn->in_len - offset >= 4)
+    {
+        uint32_t len = get_u32(conn->in + offset);
+        if (len < 4 || len > SERVICE_MAX_FRAME)
+        {
+            return false;
+        }
+        if (conn->in_len - offset - 4 < len)
+        {
+            break;
+        }
+
+        const unsigned char *body = conn->in + offset + 4;
+        uint32_t request_id = get_u32(body);
+        size_t args_len = len - 4;
+        offset += 4 + (size_t)len;
+
+        if (args_len == 0 || body[4 + args_len - 1] != '\0')
+        {
+            if (!reply_error(service, conn, request_id, CLI_EXIT_USAGE, "请求格式错误\n"))
+                return false;
+            continue;
+        }
+        if (service->inflight >= SERVICE_QUEUE_CAPACITY)
+        {
+            if (!reply_error(service, conn, request_id, CLI_EXIT_FAILURE, "服务繁忙，请稍后重试\n"))
+                return false;
+            continue;
+        }
+
+        Request *request = create_request(service, conn, request_id, body + 4, args_len);
+        if (!request)
+        {
+            if (!reply_error(service, conn, request_id, CLI_EXIT_FAILURE, "内存分配失败\n"))
+                return false;
+            continue;
+        }
+        // 在途请求数不超过线程池队列容量，提交不会阻塞事件循环
+        service->inflight++;
+        conn->pending++;
+        thread_pool_submit(service->pool, handle_request, request);
+    }
+
+    memmove(conn->in, conn->in + offset, conn->in_len - offset);
+    conn->in_len -= offset;
+    return true;
+}
+
+/**
+ * 读到EAGAIN为止，每次读取后分发完整的请求帧；对端关闭或出错返回false
+ */
+static bool read_client(Service *service, Connection *conn)
+{
+    for (;;)
+    {
+        if (!buffer_reserve(&conn->in, &conn->in_cap, conn->in_len + SERVICE_READ_CHUNK))
+        {
+            return false;
+        }
+        ssize_t n = recv(conn->fd, conn->in + conn->in_len, conn->in_cap - conn->in_len, 0);
+        if (n > 0)
+        {
+            conn->in_len += (size_t)n;
+            if (!dispatch_frames(service, conn))
+            {
+                return false;
+            }
+        }
+        else if (n == 0)
+        {
+            return false;
+        }
+        else if (errno == EINTR)
+        {
+            continue;
+        }
+        else
+        {
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+    }
+}
+
+static void accept_clients(Service *service)
+{
+    for (;;)
+    {
+        int fd = accept(service->listen_fd, NULL, NULL);
+        if (fd < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            {
+                fprintf(stderr, "接受连接失败: %s\n", strerror(errno));
+            }
+            return;
+        }
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+
+        Connection *conn = calloc(1, sizeof(Connection));
+        struct epoll_event event = {0};
+        event.events = EPOLLIN;
+        event.data.ptr = conn;
+        if (!conn || epoll_ctl(service->epoll_fd, EPOLL_CTL_ADD, fd, &event) != 0)
+        {
+            free(conn);
+            close(fd);
+            continue;
+        }
+        conn->fd = fd;
+        struct ucred cred;
+        socklen_t cred_len = sizeof(cred);
+        conn->peer_uid = getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &cred_len) == 0 ? cred.uid : (uid_t)-1;
+        conn->next = service->clients;
+        if (service->clients)
+            service->clients->prev = conn;
+        service->clients = conn;
+    }
+}
+
+/**
+ * 把完成队列中的响应交给对应连接
+ */
+static void drain_completions(Service *service)
+{
+    uint64_t count;
+    while (read(service->wake_fd, &count, sizeof(count)) > 0)
+    {
+    }
+
+    pthread_mutex_lock(&service->done_lock);
+    Request *request = service->done_head;
+    service->done_head = NULL;
+    service->done_tail = NULL;
+    pthread_mutex_unlock(&service->done_lock);
+
+    while (request)
+    {
+        Request *next = request->next;
+        Connection *conn = request->conn;
+        service->inflight--;
+        service->served++;
+        conn->pending--;
+
+        if (conn->closed)
+        {
+            if (conn->pending == 0)
+                free_client(conn);
+        }
+        else if (!request->response ||
+                 !queue_response(service, conn, request->response, request->response_len))
+        {
+            close_client(service, conn);
+        }
+        free_request(request);
+        request = next;
+    }
+}
+
+/**
+ * 创建监听套接字；已有服务在同一路径监听时失败，残留的套接字文件会被替换
+ */
+static int open_listen_socket(const char *socket_path)
+{
+    struct sockaddr_un addr = {0};
+    addr.sun_family = AF_UNIX;
+    if (strlen(socket_path) >= sizeof(addr.sun_path))
+    {
+        fprintf(stderr, "套接字路径过长: %s\n", socket_path);
+        return -1;
+    }
+    strcpy(addr.sun_path, socket_path);
+
+    int probe = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (probe >= 0 && connect(probe, (struct sockaddr *)&addr, sizeof(addr)) == 0)
+    {
+        fprintf(stderr, "已有服务在 %s 监听\n", socket_path);
+        close(probe);
+        return -1;
+    }
+    if (probe >= 0)
+    {
+        close(probe);
+    }
+    unlink(socket_path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0 || bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(fd, SOMAXCONN) != 0)
+    {
+        fprintf(stderr, "无法监听 %s: %s\n", socket_path, strerror(errno));
+        if (fd >= 0)
+            close(fd);
+        return -1;
+    }
+    chmod(socket_path, 0660); // 同组的前台终端用户可以连接
+    return fd;
+}
+
+static void close_service(Service *service)
+{
+    if (service->pool)
+        thread_pool_destroy(service->pool);
+    for (int i = 0; i < service->connection_count; i++)
+    {
+        db_close_quiet(&service->connections[i]);
+    }
+    free(service->connections);
+    free(service->idle);
+    if (service->epoll_fd >= 0)
+        close(service->epoll_fd);
+    if (service->wake_fd >= 0)
+        close(service->wake_fd);
+    pthread_mutex_destroy(&service->pool_lock);
+    pthread_cond_destroy(&service->pool_ready);
+    pthread_mutex_destroy(&service->done_lock);
+}
+
+/**
+ * @brief 启动本地服务
+ *
+ * 单线程epoll事件循环负责接受连接和收发帧，命令交给线程池执行。每个工作线程使用连接池中的
+ * 一个常驻连接，预编译语句缓存和页缓存跨请求保持；各连接开启内存映射读，共用操作系统页缓存。
+ * 后台维护任务（标记逾期、计提滞纳金、备份等）的调度线程也在服务进程中运行。
+ *
+ * @param db_path 数据库文件路径，须已初始化
+ * @param socket_path 监听的Unix域套接字路径
+ * @param worker_count 工作线程数，<=0时使用CPU核数
+ * @return bool 正常停止返回true，启动失败返回false
+ */
+bool service_run(const char *db_path, const char *socket_path, int worker_count)
+{
+    Service service;
+    memset(&service, 0, sizeof(Service));
+    service.epoll_fd = -1;
+    service.wake_fd = -1;
+    service.listen_fd = -1;
+    pthread_mutex_init(&service.pool_lock, NULL);
+    pthread_cond_init(&service.pool_ready, NULL);
+    pthread_mutex_init(&service.done_lock, NULL);
+
+    int workers = worker_count > 0 ? worker_count : thread_pool_cpu_count();
+    service.connections = calloc(workers, sizeof(Database));
+    service.idle = calloc(workers, sizeof(int));
+    if (!service.connections || !service.idle)
+    {
+        fprintf(stderr, "内存分配失败：连接池\n");
+        close_service(&service);
+        return false;
+    }
+    for (int i = 0; i < workers; i++)
+    {
+        if (db_open(&service.connections[i], db_path, SERVICE_BUSY_TIMEOUT_MS) != SQLITE_OK)
+        {
+            close_service(&service);
+            return false;
+        }
+        service.connection_count++;
+
+        char pragma[96];
+        snprintf(pragma, sizeof(pragma), "PRAGMA cache_size = -%d; PRAGMA mmap_size = %lld;",
+                 SERVICE_CACHE_KIB, SERVICE_MMAP_BYTES);
+        sqlite3_exec(service.connections[i].db, pragma, NULL, NULL, NULL);
+        service.idle[service.idle_count++] = i;
+    }
+
+    service.pool = thread_pool_create(workers, SERVICE_QUEUE_CAPACITY);
+    service.wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    service.epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (!service.pool || service.wake_fd < 0 || service.epoll_fd < 0)
+    {
+        fprintf(stderr, "无法创建事件循环: %s\n", strerror(errno));
+        close_service(&service);
+        return false;
+    }
+
+    service.listen_fd = open_listen_socket(socket_path);
+    if (service.listen_fd < 0)
+    {
+        close_service(&service);
+        return false;
+    }
+
+    struct epoll_event event = {0};
+    event.events = EPOLLIN;
+    event.data.ptr = &LISTEN_TAG;
+    epoll_ctl(service.epoll_fd, EPOLL_CTL_ADD, service.listen_fd, &event);
+    event.data.ptr = &WAKE_TAG;
+    epoll_ctl(service.epoll_fd, EPOLL_CTL_ADD, service.wake_fd, &event);
+
+    // 不设SA_RESTART，信号到来时epoll_wait返回EINTR以便检查停止标志
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = handle_stop_signal;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    scheduler_start(db_path);
+    printf("服务已启动: %s（%d个工作线程）\n", socket_path, workers);
+    fflush(stdout);
+
+    struct epoll_event events[SERVICE_MAX_EVENTS];
+    while (!service_stopping)
+    {
+        int n = epoll_wait(service.epoll_fd, events, SERVICE_MAX_EVENTS, -1);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            fprintf(stderr, "事件循环出错: %s\n", strerror(errno));
+            break;
+        }
+
+        for (int i = 0; i < n; i++)
+        {
+            void *tag = events[i].data.ptr;
+            if (tag == &LISTEN_TAG)
+            {
+                accept_clients(&service);
+                continue;
+            }
+            if (tag == &WAKE_TAG)
+            {
+                drain_completions(&service);
+                continue;
+            }
+
+            Connection *conn = tag;
+            if (conn->closed)
+            {
+                continue;
+            }
+            if ((events[i].events & EPOLLIN) && !read_client(&service, conn))
+            {
+                close_client(&service, conn);
+            }
+            else if ((events[i].events & (EPOLLERR | EPOLLHUP)) && !(events[i].events & EPOLLIN))
+            {
+                close_client(&service, conn);
+            }
+            else if ((events[i].events & EPOLLOUT) && !flush_client(&service, conn))
+            {
+                close_client(&service, conn);
+            }
+        }
+    }
+
+    // 停止接受新连接，等在途请求执行完并尽量把响应发出
+    close(service.listen_fd);
+    unlink(socket_path);
+    thread_pool_destroy(service.pool);
+    service.pool = NULL;
+    scheduler_stop();
+    drain_completions(&service);
+    while (service.clients)
+    {
+        close_client(&service, service.clients);
+    }
+
+    printf("服务已停止，共处理%ld个请求\n", service.served);
+    close_service(&service);
+    return true;
+}
+
+static bool write_all(int fd, const void *buf, size_t len)
+{
+    const unsigned char *p = buf;
+    while (len > 0)
+    {
+        ssize_t n = send(fd, p, len, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        p += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+static bool read_all(int fd, void *buf, size_t len)
+{
+    unsigned char *p = buf;
+    while (len > 0)
+    {
+        ssize_t n = recv(fd, p, len, 0);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        p += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+static int connect_service(const char *socket_path, FILE *err)
+{
+    struct sockaddr_un addr = {0};
+    addr.sun_family = AF_UNIX;
+    if (strlen(socket_path) >= sizeof(addr.sun_path))
+    {
+        fprintf(err, "套接字路径过长: %s\n", socket_path);
+        return -1;
+    }
+    strcpy(addr.sun_path, socket_path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+    {
+        fprintf(err, "无法连接本地服务 %s: %s\n", socket_path, strerror(errno));
+        if (fd >= 0)
+            close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static bool send_request(int fd, uint32_t request_id, int argc, char *argv[])
+{
+    size_t len = 8;
+    for (int i = 0; i < argc; i++)
+    {
+        len += strlen(argv[i]) + 1;
+    }
+    if (len - 4 > SERVICE_MAX_FRAME)
+    {
+        return false;
+    }
+
+    unsigned char *frame = malloc(len);
+    if (!frame)
+    {
+        return false;
+    }
+    put_u32(frame, (uint32_t)(len - 4));
+    put_u32(frame + 4, request_id);
+    size_t offset = 8;
+    for (int i = 0; i < argc; i++)
+    {
+        size_t arg_len = strlen(argv[i]) + 1;
+        memcpy(frame + offset, argv[i], arg_len);
+        offset += arg_len;
+    }
+    bool ok = write_all(fd, frame, len);
+    free(frame);
+    return ok;
+}
+
+/**
+ * 把客户端的文件路径解析为绝对路径；文件尚不存在时解析其所在目录，返回的字符串由调用方释放
+ */
+static char *absolute_path(const char *path, FILE *err)
+{
+    char *resolved = realpath(path, NULL);
+    if (resolved)
+    {
+        return resolved;
+    }
+
+    size_t len = strlen(path);
+    while (len > 1 && path[len - 1] == '/')
+    {
+        len--;
+    }
+    const char *slash = memrchr(path, '/', len);
+    const char *base = slash ? slash + 1 : path;
+    char *dir = slash ? strndup(path, slash == path ? 1 : (size_t)(slash - path)) : strdup(".");
+    char *dir_path = dir ? realpath(dir, NULL) : NULL;
+    free(dir);
+    if (!dir_path || base == path + len)
+    {
+        fprintf(err, "无法解析路径 %s: %s\n", path, strerror(errno));
+        free(dir_path);
+        return NULL;
+    }
+
+    size_t size = strlen(dir_path) + (path + len - base) + 2;
+    char *joined = malloc(size);
+    if (joined)
+    {
+        snprintf(joined, size, "%s%s%.*s", dir_path, strcmp(dir_path, "/") == 0 ? "" : "/",
+                 (int)(path + len - base), base);
+    }
+    free(dir_path);
+    return joined;
+}
+
+static void free_args(int argc, char **args)
+{
+    for (int i = 0; args && i < argc; i++)
+    {
+        free(args[i]);
+    }
+    free(args);
+}
+
+/**
+ * 复制参数，其中的文件路径解析为客户端当前目录下的绝对路径（服务的工作目录与客户端不同）
+ */
+static char **resolve_path_args(int argc, char *argv[], FILE *err)
+{
+    char **args = calloc(argc + 1, sizeof(char *));
+    if (!args)
+    {
+        fprintf(err, "内存分配失败\n");
+        return NULL;
+    }
+    for (int i = 0; i < argc; i++)
+    {
+        size_t len = path_option(argv[i]);
+        char *resolved = NULL;
+        if (len > 0 && argv[i][len] == '=')
+        {
+            resolved = absolute_path(argv[i] + len + 1, err);
+            args[i] = resolved ? malloc(len + strlen(resolved) + 2) : NULL;
+            if (args[i])
+                sprintf(args[i], "%.*s=%s", (int)len, argv[i], resolved);
+        }
+        else if (len > 0 && i + 1 < argc)
+        {
+            args[i] = strdup(argv[i]);
+            if (args[i])
+            {
+                resolved = absolute_path(argv[++i], err);
+                args[i] = resolved ? strdup(resolved) : NULL;
+            }
+        }
+        else
+        {
+            args[i] = strdup(argv[i]);
+        }
+        free(resolved);
+        if (!args[i])
+        {
+            free_args(argc, args);
+            return NULL;
+        }
+    }
+    return args;
+}
+
+// 客户端收到的响应，output和error指向frame内部
+typedef struct
+{
+    unsigned char *frame;
+    uint32_t request_id;
+    int exit_code;
+    const char *output;
+    size_t output_len;
+    const char *error;
+    size_t error_len;
+} Response;
+
+static bool receive_response(int fd, Response *response)
+{
+    unsigned char header[4];
+    if (!read_all(fd, header, sizeof(header)))
+    {
+        return false;
+    }
+    uint32_t len = get_u32(header);
+    if (len < 12 || len > SERVICE_MAX_FRAME)
+    {
+        return false;
+    }
+    response->frame = malloc(len);
+    if (!response->frame || !read_all(fd, response->frame, len))
+    {
+        free(response->frame);
+        response->frame = NULL;
+        return false;
+    }
+
+    response->request_id = get_u32(response->frame);
+    response->exit_code = (int)get_u32(response->frame + 4);
+    response->output_len = get_u32(response->frame + 8);
+    if (response->output_len > len - 12)
+    {
+        free(response->frame);
+        response->frame = NULL;
+        return false;
+    }
+    response->output = (const char *)response->frame + 12;
+    response->error = response->output + response->output_len;
+    response->error_len = len - 12 - response->output_len;
+    return true;
+}
+
+/**
+ * @brief 通过本地服务执行一条命令
+ *
+ * @param socket_path 服务套接字路径
+ * @param argc 参数个数
+ * @param argv 命令及参数（可以--format开头）
+ * @param out 结果输出
+ * @param err 错误信息输出
+ * @return int 命令的退出码，连接失败时返回CLI_EXIT_FAILURE
+ */
+int service_call(const char *socket_path, int argc, char *argv[], FILE *out, FILE *err)
+{
+    if (argc == 0)
+    {
+        fprintf(err, "用法: pms [--socket 路径] call <命令> [参数]\n");
+        return CLI_EXIT_USAGE;
+    }
+
+    char **args = resolve_path_args(argc, argv, err);
+    if (!args)
+    {
+        return CLI_EXIT_FAILURE;
+    }
+    int fd = connect_service(socket_path, err);
+    if (fd < 0)
+    {
+        free_args(argc, args);
+        return CLI_EXIT_FAILURE;
+    }
+
+    Response response;
+    bool ok = send_request(fd, 1, argc, args) && receive_response(fd, &response);
+    close(fd);
+    free_args(argc, args);
+    if (!ok)
+    {
+        fprintf(err, "与本地服务通信失败\n");
+        return CLI_EXIT_FAILURE;
+    }
+
+    fwrite(response.output, 1, response.output_len, out);
+    fwrite(response.error, 1, response.error_len, err);
+    fflush(out);
+    free(response.frame);
+    return response.exit_code;
+}
+
+// 一个压测连接
+typedef struct
+{
+    const char *socket_path;
+    int argc;
+    char **argv;
+    int requests;
+    double *latencies; // 每个请求的耗时（秒）
+    int completed;
+    int failed;        // 命令退出码非0的请求数
+    bool broken;       // 连接中断
+} BenchClient;
+
+static double elapsed_since(const struct timespec *start)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) + (now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+static void *bench_client(void *arg)
+{
+    BenchClient *client = arg;
+    int fd = connect_service(client->socket_path, stderr);
+    if (fd < 0)
+    {
+        client->broken = true;
+        return NULL;
+    }
+
+    for (int i = 0; i < client->requests; i++)
+    {
+        struct timespec start;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        Response response;
+        if (!send_request(fd, (uint32_t)i, client->argc, client->argv) || !receive_response(fd, &response))
+        {
+            client->broken = true;
+            break;
+        }
+        client->latencies[client->completed++] = elapsed_since(&start);
+        client->failed += response.exit_code != 0;
+        free(response.frame);
+    }
+    close(fd);
+    return NULL;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * 已排序耗时的分位数（毫秒）
+ */
+static double percentile_ms(const double *sorted, int count, double p)
+{
+    return count > 0 ? sorted[(int)((count - 1) * p)] * 1000 : 0;
+}
+
+/**
+ * @brief 压测本地服务
+ *
+ * 每个连接串行发送请求（发出后等待响应），多个连接并发，输出总耗时、吞吐和延迟分位数
+ *
+ * @param socket_path 服务套接字路径
+ * @param argc 参数个数
+ * @param argv [--requests N] [--connections C] 命令 [参数]
+ * @param out 结果输出
+ * @return int 全部请求成功返回CLI_EXIT_OK
+ */
+int service_bench(const char *socket_path, int argc, char *argv[], FILE *out)
+{
+    int requests = BENCH_DEFAULT_REQUESTS;
+    int connections = BENCH_DEFAULT_CONNECTIONS;
+    int i = 0;
+    while (i + 1 < argc && (strcmp(argv[i], "--requests") == 0 || strcmp(argv[i], "--connections") == 0))
+    {
+        if (strcmp(argv[i], "--requests") == 0)
+            requests = atoi(argv[i + 1]);
+        else
+            connections = atoi(argv[i + 1]);
+        i += 2;
+    }
+    if (i >= argc || requests <= 0 || connections <= 0)
+    {
+        fprintf(stderr, "用法: pms [--socket 路径] bench [--requests N] [--connections C] <命令> [参数]\n");
+        return CLI_EXIT_USAGE;
+    }
+    if (connections > requests)
+    {
+        connections = requests;
+    }
+
+    char **args = resolve_path_args(argc - i, argv + i, stderr);
+    if (!args)
+    {
+        return CLI_EXIT_FAILURE;
+    }
+    BenchClient *clients = calloc(connections, sizeof(BenchClient));
+    pthread_t *threads = calloc(connections, sizeof(pthread_t));
+    double *latencies = malloc(requests * sizeof(double));
+    if (!clients || !threads || !latencies)
+    {
+        fprintf(stderr, "内存分配失败：压测\n");
+        free_args(argc - i, args);
+        free(clients);
+        free(threads);
+        free(latencies);
+        return CLI_EXIT_FAILURE;
+    }
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    int assigned = 0;
+    for (int c = 0; c < connections; c++)
+    {
+        clients[c].socket_path = socket_path;
+        clients[c].argc = argc - i;
+        clients[c].argv = args;
+        clients[c].requests = requests / connections + (c < requests % connections);
+        clients[c].latencies = latencies + assigned;
+        assigned += clients[c].requests;
+        if (pthread_create(&threads[c], NULL, bench_client, &clients[c]) != 0)
+        {
+            clients[c].broken = true;
+            clients[c].requests = 0;
+        }
+    }
+
+    int completed = 0, failed = 0, broken = 0;
+    for (int c = 0; c < connections; c++)
+    {
+        if (clients[c].requests > 0)
+            pthread_join(threads[c], NULL);
+        // 各连接的耗时紧凑排列到数组前部
+        memmove(latencies + completed, clients[c].latencies, clients[c].completed * sizeof(double));
+        completed += clients[c].completed;
+        failed += clients[c].failed;
+        broken += clients[c].broken;
+    }
+    double seconds = elapsed_since(&start);
+
+    qsort(latencies, completed, sizeof(double), compare_double);
+    fprintf(out, "requests\tconnections\tseconds\trequests_per_second\tp50_ms\tp95_ms\tp99_ms\tmax_ms\tfailed\tbroken\n");
+    fprintf(out, "%d\t%d\t%.3f\t%.1f\t%.3f\t%.3f\t%.3f\t%.3f\t%d\t%d\n", completed, connections, seconds,
+            seconds > 0 ? completed / seconds : 0, percentile_ms(latencies, completed, 0.50),
+            percentile_ms(latencies, completed, 0.95), percentile_ms(latencies, completed, 0.99),
+            percentile_ms(latencies, completed, 1.0), failed, broken);
+
+    free_args(argc - i, args);
+    free(clients);
+    free(threads);
+    free(latencies);
+    return broken == 0 && failed == 0 && completed == requests ? CLI_EXIT_OK : CLI_EXIT_FAILURE;
+}
+
+/**
+ * 把一行命令按空白拆成参数，双引号内的空白保留；返回参数个数，引号不配对时返回-1
+ */
+static int split_line(char *line, char *argv[], int max_args)
+{
+    int argc = 0;
+    char *p = line;
+    for (;;)
+    {
+        while (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')
+        {
+            p++;
+        }
+        if (*p == '\0')
+        {
+            return argc;
+        }
+        if (argc == max_args)
+        {
+            return -1;
+        }
+        argv[argc++] = p;
+        char *dst = p;
+        bool quoted = false;
+        while (*p && (quoted || (*p != ' ' && *p != '\t' && *p != '\n' && *p != '\r')))
+        {
+            if (*p == '"')
+                quoted = !quoted;
+            else
+                *dst++ = *p;
+            p++;
+        }
+        if (quoted)
+        {
+            return -1;
+        }
+        bool end = *p == '\0';
+        *dst = '\0';
+        if (end)
+        {
+            return argc;
+        }
+        p++;
+    }
+}
+
+/**
+ * @brief 前台终端：逐行读取命令，经同一个连接发给本地服务并显示结果
+ *
+ * 每行是一条命令（与call的参数相同），输入exit或quit结束；连接中断时退出
+ *
+ * @param socket_path 服务套接字路径
+ * @param in 命令输入
+ * @param out 结果输出
+ * @param err 错误信息输出
+ * @return int 正常结束返回CLI_EXIT_OK，最后一条命令失败或连接中断时返回非0
+ */
+int service_desk(const char *socket_path, FILE *in, FILE *out, FILE *err)
+{
+    int fd = connect_service(socket_path, err);
+    if (fd < 0)
+    {
+        return CLI_EXIT_FAILURE;
+    }
+
+    bool interactive = isatty(fileno(in));
+    char line[DESK_MAX_LINE];
+    char *argv[DESK_MAX_ARGS];
+    uint32_t request_id = 0;
+    int code = CLI_EXIT_OK;
+    for (;;)
+    {
+        if (interactive)
+        {
+            fputs("pms> ", out);
+            fflush(out);
+        }
+        if (!fgets(line, sizeof(line), in))
+        {
+            break;
+        }
+        int argc = split_line(line, argv, DESK_MAX_ARGS);
+        if (argc < 0)
+        {
+            fprintf(err, "无法解析命令（引号不配对或参数过多）\n");
+            code = CLI_EXIT_USAGE;
+            continue;
+        }
+        if (argc == 0)
+        {
+            continue;
+        }
+        if (strcmp(argv[0], "exit") == 0 || strcmp(argv[0], "quit") == 0)
+        {
+            break;
+        }
+
+        char **args = resolve_path_args(argc, argv, err);
+        if (!args)
+        {
+            code = CLI_EXIT_FAILURE;
+            continue;
+        }
+        Response response;
+        bool ok = send_request(fd, ++request_id, argc, args) && receive_response(fd, &response);
+        free_args(argc, args);
+        if (!ok)
+        {
+            fprintf(err, "与本地服务通信失败\n");
+            code = CLI_EXIT_FAILURE;
+            break;
+        }
+        fwrite(response.output, 1, response.output_len, out);
+        fflush(out);
+        fwrite(response.error, 1, response.error_len, err);
+        code = response.exit_code;
+        free(response.frame);
+    }
+    close(fd);
+    return code;
+}
@@ -1,5 +1,6 @@
 #include "db/database.h"
 #include "db/db_init.h"
+#include "utils/pinyin.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -21,12 +22,23 @@ int db_init(Database *db, const char *db_path)
         return SQLITE_ERROR;
     }
 
+    memset(db, 0, sizeof(Database));
+
     rc = sqlite3_open(db_path, &db->db);
     if (rc != SQLITE_OK)
     {
         fprintf(stderr, "无法打开数据库 %s: %s\n", db_path, sqlite3_errmsg(db->db));
         return rc;
     }
+    db->db_path = strdup(db_path);
+    pinyin_register(db->db);
+
+    // 新建的数据库启用增量回收，由后台任务定期归还空闲页；对已有数据库不生效
+    sqlite3_exec(db->db, "PRAGMA auto_vacuum = INCREMENTAL;", NULL, NULL, NULL);
+    // WAL模式下读写互不阻塞，配合NORMAL同步级别大幅降低每次提交的开销
+    sqlite3_exec(db->db, "PRAGMA journal_mode = WAL;", NULL, NULL, NULL);
+    sqlite3_exec(db->db, "PRAGMA synchronous = NORMAL;", NULL, NULL, NULL);
+    sqlite3_busy_timeout(db->db, 5000);
 
     rc = sqlite3_exec(db->db, "PRAGMA foreign_keys = ON;", NULL, NULL, NULL);
     if (rc != SQLITE_OK)
@@ -57,16 +69,69 @@ int db_init(Database *db, const char *db_path)
 }
 
 /**
- * @brief 关闭数据库连接
+ * @brief 打开已初始化的数据库
+ *
+ * 供后台线程和服务工作线程建立各自的连接：不建表、不输出提示，文件不存在时失败
  *
  * @param db 数据库结构体指针
+ * @param db_path 数据库文件路径
+ * @param busy_timeout_ms 等待锁的毫秒数
+ * @return int SQLITE_OK表示成功，其他值表示错误码
  */
-void db_close(Database *db)
+int db_open(Database *db, const char *db_path, int busy_timeout_ms)
+{
+    memset(db, 0, sizeof(Database));
+    int rc = sqlite3_open_v2(db_path, &db->db, SQLITE_OPEN_READWRITE, NULL);
+    if (rc != SQLITE_OK)
+    {
+        fprintf(stderr, "无法打开数据库 %s: %s\n", db_path, sqlite3_errmsg(db->db));
+        sqlite3_close(db->db);
+        db->db = NULL;
+        return rc;
+    }
+    db->db_path = strdup(db_path);
+    pinyin_register(db->db);
+    sqlite3_exec(db->db, "PRAGMA synchronous = NORMAL;", NULL, NULL, NULL);
+    sqlite3_exec(db->db, "PRAGMA foreign_keys = ON;", NULL, NULL, NULL);
+    sqlite3_busy_timeout(db->db, busy_timeout_ms);
+    return SQLITE_OK;
+}
+
+/**
+ * @brief 关闭数据库连接（不输出提示）
+ *
+ * @param db 数据库结构体指针
+ */
+void db_close_quiet(Database *db)
 {
     if (db && db->db)
     {
+        for (int i = 0; i < DB_STMT_CACHE_SIZE; i++)
+        {
+            if (db->stmt_cache[i])
+            {
+                sqlite3_finalize(db->stmt_cache[i]);
+                db->stmt_cache[i] = NULL;
+                db->stmt_sql[i] = NULL;
+            }
+        }
         sqlite3_close(db->db);
         db->db = NULL;
+        free(db->db_path);
+        db->db_path = NULL;
+    }
+}
+
+/**
+ * @brief 关闭数据库连接
+ *
+ * @param db 数据库结构体指针
+ */
+void db_close(Database *db)
+{
+    if (db && db->db)
+    {
+        db_close_quiet(db);
         printf("数据库连接已关闭\n");
     }
 }
@@ -128,6 +193,76 @@ int db_prepare(Database *db, const char *sql, sqlite3_stmt **stmt)
     return SQLITE_OK;
 }
 
+/**
+ * @brief 获取缓存的预编译语句
+ *
+ * 高频执行的语句只在首次使用时编译，之后复用同一句柄。缓存以SQL字符串的
+ * 地址为键，因此sql必须是静态字符串。取出的语句已重置并清空绑定参数，
+ * 使用完毕后应调用sqlite3_reset释放其持有的锁，不要finalize。
+ * 缓存已满时淘汰最久未用且不在执行中的语句，被淘汰的语句下次使用时重新编译。
+ *
+ * @param db 数据库结构体指针
+ * @param sql 静态SQL字符串
+ * @param stmt 输出的语句句柄
+ * @return int SQLITE_OK表示成功，其他值表示错误码
+ */
+int db_prepare_cached(Database *db, const char *sql, sqlite3_stmt **stmt)
+{
+    if (!db || !db->db || !sql || !stmt)
+    {
+        fprintf(stderr, "准备SQL语句失败：参数无效\n");
+        return SQLITE_ERROR;
+    }
+
+    int slot = -1;
+    for (int i = 0; i < DB_STMT_CACHE_SIZE; i++)
+    {
+        if (db->stmt_sql[i] == sql)
+        {
+            sqlite3_reset(db->stmt_cache[i]);
+            sqlite3_clear_bindings(db->stmt_cache[i]);
+            db->stmt_used[i] = ++db->stmt_clock;
+            *stmt = db->stmt_cache[i];
+            return SQLITE_OK;
+        }
+        if (db->stmt_sql[i] == NULL)
+        {
+            if (slot < 0 || db->stmt_sql[slot] != NULL)
+            {
+                slot = i;
+            }
+        }
+        else if ((slot < 0 || (db->stmt_sql[slot] != NULL && db->stmt_used[i] < db->stmt_used[slot])) &&
+                 !sqlite3_stmt_busy(db->stmt_cache[i]))
+        {
+            slot = i;
+        }
+    }
+
+    if (slot < 0)
+    {
+        // 缓存中的语句全部在执行中，无可淘汰
+        fprintf(stderr, "准备SQL语句失败：缓存的语句均在执行中\n");
+        return SQLITE_BUSY;
+    }
+
+    int rc = sqlite3_prepare_v3(db->db, sql, -1, SQLITE_PREPARE_PERSISTENT, stmt, NULL);
+    if (rc != SQLITE_OK)
+    {
+        fprintf(stderr, "准备SQL语句失败: %s\n", sqlite3_errmsg(db->db));
+        return rc;
+    }
+
+    if (db->stmt_sql[slot] != NULL)
+    {
+        sqlite3_finalize(db->stmt_cache[slot]);
+    }
+    db->stmt_sql[slot] = sql;
+    db->stmt_cache[slot] = *stmt;
+    db->stmt_used[slot] = ++db->stmt_clock;
+    return SQLITE_OK;
+}
+
 /**
  * @brief 数据库备份
  *
@@ -1,4 +1,6 @@
 #include "db/database.h"
+#include "db/db_init.h"
+#include "utils/pinyin.h"
 #include "utils/utils.h"
 #include <stdio.h>
 #include <string.h>
@@ -24,6 +26,7 @@ static const char *CREATE_USERS_TABLE =
     "role_id TEXT NOT NULL,"              // 角色ID
     "status INTEGER DEFAULT 1,"           // 状态
     "registration_date INTEGER NOT NULL," // 注册时间
+    "name_sort_key BLOB,"                 // 姓名拼音排序键，写入或改名时由程序计算
     "FOREIGN KEY (role_id) REFERENCES roles(role_id)"
     ");";
 
@@ -112,7 +115,9 @@ static const char *CREATE_FEE_STANDARDS_TABLE =
     "price_per_unit REAL NOT NULL,"
     "unit TEXT NOT NULL,"
     "effective_date INTEGER NOT NULL,"
-    "end_date INTEGER DEFAULT 0"
+    "end_date INTEGER DEFAULT 0,"
+    "grace_days INTEGER DEFAULT 0," // 宽限天数（滞纳金使用）
+    "cap_rate REAL DEFAULT 0"       // 封顶比例（滞纳金使用，0表示不封顶）
     ");";
 
 // 创建交易表
@@ -130,11 +135,346 @@ static const char *CREATE_TRANSACTIONS_TABLE =
     "status INTEGER DEFAULT 0,"
     "period_start INTEGER NOT NULL,"
     "period_end INTEGER NOT NULL,"
+    "source_id TEXT," // 滞纳金账单对应的欠费账单
+    "cube_building_id TEXT," // 立方体中的楼宇维度，出账时确定，此后不随业主名下房屋变化
     "FOREIGN KEY (user_id) REFERENCES users(user_id),"
     "FOREIGN KEY (room_id) REFERENCES rooms(room_id),"
     "FOREIGN KEY (parking_id) REFERENCES parking_spaces(parking_id)"
     ");";
 
+// 创建滞纳金计提记录表，每个计提日期一行，用于保证计提幂等
+static const char *CREATE_LATE_FEE_RUNS_TABLE =
+    "CREATE TABLE IF NOT EXISTS late_fee_runs ("
+    "accrual_date INTEGER PRIMARY KEY," // 计提日期（当日零点）
+    "run_time INTEGER NOT NULL,"        // 实际执行时间
+    "standard_id TEXT NOT NULL,"        // 使用的滞纳金规则
+    "bill_count INTEGER NOT NULL,"      // 写入的滞纳金账单数
+    "total_amount REAL NOT NULL"        // 写入的滞纳金总额
+    ");";
+
+// 创建支付请求表，按客户端提供的幂等键记录每笔支付，重试时直接返回首次结果
+static const char *CREATE_PAYMENT_REQUESTS_TABLE =
+    "CREATE TABLE IF NOT EXISTS payment_requests ("
+    "idempotency_key TEXT NOT NULL,"   // 客户端幂等键
+    "transaction_id TEXT NOT NULL,"    // 支付的账单
+    "user_id TEXT NOT NULL,"           // 付款业主
+    "amount REAL NOT NULL,"            // 支付金额
+    "payment_method INTEGER NOT NULL," // 支付方式
+    "created_at INTEGER NOT NULL,"     // 支付时间
+    "PRIMARY KEY (idempotency_key, transaction_id),"
+    "FOREIGN KEY (transaction_id) REFERENCES transactions(transaction_id)"
+    ");";
+
+// 创建缴费提醒发件箱表，提醒先写入此表，再由投递流程发出
+static const char *CREATE_PAYMENT_REMINDERS_TABLE =
+    "CREATE TABLE IF NOT EXISTS payment_reminders ("
+    "reminder_id INTEGER PRIMARY KEY AUTOINCREMENT,"
+    "user_id TEXT NOT NULL,"              // 业主ID
+    "reminder_content TEXT NOT NULL,"     // 提醒内容
+    "unpaid_amount REAL DEFAULT 0,"       // 生成时的待缴总额
+    "overdue_amount REAL DEFAULT 0,"      // 生成时的逾期金额
+    "send_time INTEGER NOT NULL,"         // 生成时间，用于去重窗口
+    "status INTEGER DEFAULT 0,"           // 0待投递 1已投递 2投递失败
+    "delivered_time INTEGER,"             // 投递时间
+    "FOREIGN KEY (user_id) REFERENCES users(user_id)"
+    ");";
+
+// 创建房屋入住记录表，每段业主持有期一行，由rooms表上的触发器维护
+// 日期存为本地日期的天序号（自1970-01-01起），持有期为[start_day, end_day)，end_day为NULL表示仍在持有
+static const char *CREATE_ROOM_OCCUPANCY_TABLE =
+    "CREATE TABLE IF NOT EXISTS room_occupancy ("
+    "occupancy_id INTEGER PRIMARY KEY,"
+    "room_id TEXT NOT NULL,"
+    "owner_id TEXT NOT NULL,"
+    "start_day INTEGER NOT NULL," // 入住日（含），0表示启用记录前已入住
+    "end_day INTEGER,"            // 迁出日（不含）
+    "FOREIGN KEY (room_id) REFERENCES rooms(room_id),"
+    "FOREIGN KEY (owner_id) REFERENCES users(user_id)"
+    ");";
+
+// 创建费用数据立方体，按楼宇、费用类型、账期月份和支付方式预汇总账单
+// 由 fee_cube_changes 变更日志增量刷新，刷新进度记录在 fee_cube_state
+static const char *CREATE_FEE_CUBE_TABLE =
+    "CREATE TABLE IF NOT EXISTS fee_cube ("
+    "building_id TEXT NOT NULL,"          // 楼宇ID，无法归属楼宇的为''
+    "fee_type INTEGER NOT NULL,"          // 费用类型
+    "month INTEGER NOT NULL,"             // 账期开始月份，YYYYMM
+    "payment_method INTEGER NOT NULL,"    // 支付方式，未缴为0
+    "billed_amount REAL DEFAULT 0,"       // 应缴金额
+    "paid_amount REAL DEFAULT 0,"         // 已缴金额
+    "overdue_amount REAL DEFAULT 0,"      // 逾期金额
+    "bill_count INTEGER DEFAULT 0,"       // 账单数
+    "paid_count INTEGER DEFAULT 0,"       // 已缴账单数
+    "overdue_count INTEGER DEFAULT 0,"    // 逾期账单数
+    "PRIMARY KEY (building_id, fee_type, month, payment_method)"
+    ") WITHOUT ROWID;";
+
+// 立方体变更日志，transactions表上的触发器为每次增删改写入正负增量
+static const char *CREATE_FEE_CUBE_CHANGES_TABLE =
+    "CREATE TABLE IF NOT EXISTS fee_cube_changes ("
+    "change_id INTEGER PRIMARY KEY AUTOINCREMENT,"
+    "building_id TEXT NOT NULL,"
+    "fee_type INTEGER NOT NULL,"
+    "month INTEGER NOT NULL,"
+    "payment_method INTEGER NOT NULL,"
+    "billed_amount REAL NOT NULL,"
+    "paid_amount REAL NOT NULL,"
+    "overdue_amount REAL NOT NULL,"
+    "bill_count INTEGER NOT NULL,"
+    "paid_count INTEGER NOT NULL,"
+    "overdue_count INTEGER NOT NULL"
+    ");";
+
+// 立方体刷新水位：已并入立方体的最大变更ID
+static const char *CREATE_FEE_CUBE_STATE_TABLE =
+    "CREATE TABLE IF NOT EXISTS fee_cube_state ("
+    "state_id INTEGER PRIMARY KEY CHECK (state_id = 1),"
+    "watermark INTEGER NOT NULL,"         // 已并入的最大change_id
+    "refreshed_at INTEGER NOT NULL"       // 最近一次刷新时间
+    ");";
+
+// 按账期月份缓存的收缴率时间序列，由立方体汇总得出
+// 立方体刷新时把涉及的月份标记为dirty，读取前只重算这些月份及其环比、同比依赖的月份
+static const char *CREATE_COLLECTION_RATES_TABLE =
+    "CREATE TABLE IF NOT EXISTS collection_rates ("
+    "month INTEGER PRIMARY KEY,"          // 账期月份，YYYYMM
+    "billed_amount REAL DEFAULT 0,"       // 应缴金额
+    "paid_amount REAL DEFAULT 0,"         // 已缴金额
+    "bill_count INTEGER DEFAULT 0,"       // 账单数
+    "paid_count INTEGER DEFAULT 0,"       // 已缴账单数
+    "rate REAL,"                          // 收缴率（按金额），无账单时为NULL
+    "mom_delta REAL,"                     // 较上月变化，上月无数据时为NULL
+    "yoy_delta REAL,"                     // 较去年同月变化，去年同月无数据时为NULL
+    "dirty INTEGER NOT NULL DEFAULT 1"    // 1表示待重算
+    ");";
+
+// 后台维护任务，由调度线程按cron计划运行
+static const char *CREATE_SCHEDULED_JOBS_TABLE =
+    "CREATE TABLE IF NOT EXISTS scheduled_jobs ("
+    "job_name TEXT PRIMARY KEY,"
+    "schedule TEXT NOT NULL,"             // cron表达式：分 时 日 月 周
+    "jitter_seconds INTEGER DEFAULT 0,"   // 每次运行随机推迟0至该秒数
+    "enabled INTEGER DEFAULT 1,"
+    "next_run INTEGER,"                   // 下次运行时间，NULL表示待计算
+    "last_run INTEGER,"                   // 最近一次开始运行的时间
+    "last_status INTEGER"                 // 最近一次运行状态，同job_runs.status
+    ");";
+
+// 后台任务运行记录
+static const char *CREATE_JOB_RUNS_TABLE =
+    "CREATE TABLE IF NOT EXISTS job_runs ("
+    "run_id INTEGER PRIMARY KEY AUTOINCREMENT,"
+    "job_name TEXT NOT NULL,"
+    "started_at INTEGER NOT NULL,"
+    "finished_at INTEGER,"
+    "status INTEGER NOT NULL,"            // 0 运行中 1 成功 2 失败 3 跳过
+    "message TEXT"
+    ");";
+
+// 当前本地日期的天序号
+#define OCCUPANCY_TODAY "(CAST(strftime('%s', 'now', 'localtime') AS INTEGER) / 86400)"
+
+// 创建业主账本表，按业主和费用类型累计账单金额，由transactions表上的触发器维护
+// fee_type = 0 的行是该业主全部费用类型的合计
+static const char *CREATE_OWNER_LEDGER_TABLE =
+    "CREATE TABLE IF NOT EXISTS owner_ledger ("
+    "user_id TEXT NOT NULL,"
+    "fee_type INTEGER NOT NULL,"         // 费用类型，0表示合计
+    "billed_amount REAL DEFAULT 0,"      // 累计应缴
+    "paid_amount REAL DEFAULT 0,"        // 累计已缴
+    "overdue_amount REAL DEFAULT 0,"     // 当前逾期金额
+    "bill_count INTEGER DEFAULT 0,"      // 账单数
+    "unpaid_count INTEGER DEFAULT 0,"    // 未结账单数（未缴和逾期）
+    "last_activity INTEGER DEFAULT 0,"   // 最近一次出账或缴费时间
+    "PRIMARY KEY (user_id, fee_type)"
+    ") WITHOUT ROWID;";
+
+// 按交易表重新汇总的账本，用于账本初始化、一致性核对和修复
+static const char *CREATE_OWNER_LEDGER_EXPECTED_VIEW =
+    "CREATE VIEW IF NOT EXISTS owner_ledger_expected AS "
+    "SELECT user_id, fee_type, SUM(amount) AS billed_amount, "
+    "SUM(CASE WHEN status = 1 THEN amount ELSE 0 END) AS paid_amount, "
+    "SUM(CASE WHEN status = 2 THEN amount ELSE 0 END) AS overdue_amount, "
+    "COUNT(*) AS bill_count, SUM(status <> 1) AS unpaid_count, "
+    "MAX(CASE WHEN status = 1 THEN payment_date ELSE period_start END) AS last_activity "
+    "FROM transactions GROUP BY user_id, fee_type "
+    "UNION ALL "
+    "SELECT user_id, 0, SUM(amount), "
+    "SUM(CASE WHEN status = 1 THEN amount ELSE 0 END), "
+    "SUM(CASE WHEN status = 2 THEN amount ELSE 0 END), "
+    "COUNT(*), SUM(status <> 1), "
+    "MAX(CASE WHEN status = 1 THEN payment_date ELSE period_start END) "
+    "FROM transactions GROUP BY user_id;";
+
+// 将一行交易按SIGN（+/-）计入账本的该费用类型行和合计行
+#define LEDGER_APPLY(ROW, SIGN, LAST_ACTIVITY)                                                                         \
+    "INSERT INTO owner_ledger (user_id, fee_type, billed_amount, paid_amount, overdue_amount, "                       \
+    "bill_count, unpaid_count, last_activity) "                                                                      \
+    "SELECT " ROW ".user_id, t.fee_type, " SIGN ROW ".amount, "                                                       \
+    SIGN "(CASE WHEN " ROW ".status = 1 THEN " ROW ".amount ELSE 0 END), "                                            \
+    SIGN "(CASE WHEN " ROW ".status = 2 THEN " ROW ".amount ELSE 0 END), "                                            \
+    SIGN "1, " SIGN "(" ROW ".status <> 1), " LAST_ACTIVITY " "                                                       \
+    "FROM (SELECT " ROW ".fee_type AS fee_type UNION ALL SELECT 0) AS t WHERE true "                                  \
+    "ON CONFLICT (user_id, fee_type) DO UPDATE SET "                                                                 \
+    "billed_amount = billed_amount + excluded.billed_amount, "                                                        \
+    "paid_amount = paid_amount + excluded.paid_amount, "                                                              \
+    "overdue_amount = overdue_amount + excluded.overdue_amount, "                                                     \
+    "bill_count = bill_count + excluded.bill_count, "                                                                 \
+    "unpaid_count = unpaid_count + excluded.unpaid_count, "                                                           \
+    "last_activity = MAX(last_activity, excluded.last_activity);"
+
+#define LEDGER_NEW_ACTIVITY "CASE WHEN NEW.status = 1 THEN NEW.payment_date ELSE NEW.period_start END"
+
+// 交易行在立方体中的维度：楼宇、账期月份、支付方式
+// 楼宇在账单写入时按房屋确定，无房屋时取业主名下第一套房屋，结果存入cube_building_id，
+// 之后改账、删账都从存下的楼宇扣减，保证与当初计入的单元一致
+#define CUBE_RESOLVE_BUILDING(ROW)                                                                                     \
+    "COALESCE((SELECT building_id FROM rooms WHERE room_id = " ROW ".room_id), "                                      \
+    "(SELECT building_id FROM rooms WHERE owner_id = " ROW ".user_id ORDER BY rowid LIMIT 1), '')"
+#define CUBE_BUILDING(ROW) "COALESCE(" ROW ".cube_building_id, " CUBE_RESOLVE_BUILDING(ROW) ")"
+#define CUBE_STORED_BUILDING(ROW) "(SELECT cube_building_id FROM transactions WHERE transaction_id = " ROW ".transaction_id)"
+#define CUBE_MONTH(ROW) "CAST(strftime('%Y%m', " ROW ".period_start, 'unixepoch', 'localtime') AS INTEGER)"
+#define CUBE_METHOD(ROW) "(CASE WHEN " ROW ".status = 1 THEN " ROW ".payment_method ELSE 0 END)"
+
+// 将一行交易按SIGN（+/-）记入立方体变更日志的BUILDING楼宇
+#define CUBE_RECORD(ROW, SIGN, BUILDING)                                                                               \
+    "INSERT INTO fee_cube_changes (building_id, fee_type, month, payment_method, billed_amount, paid_amount, "        \
+    "overdue_amount, bill_count, paid_count, overdue_count) VALUES ("                                                 \
+    BUILDING ", " ROW ".fee_type, " CUBE_MONTH(ROW) ", " CUBE_METHOD(ROW) ", "                               \
+    SIGN ROW ".amount, "                                                                                              \
+    SIGN "(CASE WHEN " ROW ".status = 1 THEN " ROW ".amount ELSE 0 END), "                                            \
+    SIGN "(CASE WHEN " ROW ".status = 2 THEN " ROW ".amount ELSE 0 END), "                                            \
+    SIGN "1, " SIGN "(" ROW ".status = 1), " SIGN "(" ROW ".status = 2));"
+
+// 触发器：出账、缴费、改账和删账在同一事务内同步更新账本；房屋业主变更时记录持有期
+static const char *CREATE_TRIGGERS[] = {
+    "CREATE TRIGGER IF NOT EXISTS trg_owner_ledger_insert AFTER INSERT ON transactions BEGIN " LEDGER_APPLY("NEW", "+", LEDGER_NEW_ACTIVITY) " END;",
+
+    "CREATE TRIGGER IF NOT EXISTS trg_owner_ledger_update "
+    "AFTER UPDATE OF user_id, fee_type, amount, status, payment_date ON transactions BEGIN " LEDGER_APPLY("OLD", "-", "0") LEDGER_APPLY("NEW", "+", LEDGER_NEW_ACTIVITY) " END;",
+
+    "CREATE TRIGGER IF NOT EXISTS trg_owner_ledger_delete AFTER DELETE ON transactions BEGIN " LEDGER_APPLY("OLD", "-", "0") " END;",
+
+    // 账单变更写入立方体变更日志，由刷新流程按水位增量并入。
+    // 写入时确定楼宇并存到账单上；改账时从原楼宇扣减，只有房屋或业主变化时才重新确定楼宇
+    "CREATE TRIGGER IF NOT EXISTS trg_fee_cube_insert_v2 AFTER INSERT ON transactions BEGIN "
+    "UPDATE transactions SET cube_building_id = " CUBE_RESOLVE_BUILDING("NEW") " "
+    "WHERE transaction_id = NEW.transaction_id AND cube_building_id IS NULL; "
+    CUBE_RECORD("NEW", "+", CUBE_STORED_BUILDING("NEW")) " END;",
+
+    "CREATE TRIGGER IF NOT EXISTS trg_fee_cube_update_v2 "
+    "AFTER UPDATE OF room_id, user_id, fee_type, amount, status, payment_method, period_start ON transactions BEGIN "
+    CUBE_RECORD("OLD", "-", CUBE_BUILDING("OLD"))
+    "UPDATE transactions SET cube_building_id = " CUBE_RESOLVE_BUILDING("NEW") " "
+    "WHERE transaction_id = NEW.transaction_id AND "
+    "(NEW.cube_building_id IS NULL OR NEW.room_id IS NOT OLD.room_id OR NEW.user_id IS NOT OLD.user_id); "
+    CUBE_RECORD("NEW", "+", CUBE_STORED_BUILDING("NEW")) " END;",
+
+    "CREATE TRIGGER IF NOT EXISTS trg_fee_cube_delete_v2 AFTER DELETE ON transactions BEGIN "
+    CUBE_RECORD("OLD", "-", CUBE_BUILDING("OLD")) " END;",
+
+    // 房屋业主变更时结束原持有期并开始新持有期
+    "CREATE TRIGGER IF NOT EXISTS trg_room_occupancy_insert AFTER INSERT ON rooms "
+    "WHEN NEW.owner_id IS NOT NULL AND NEW.owner_id <> '' BEGIN "
+    "INSERT INTO room_occupancy (room_id, owner_id, start_day) VALUES (NEW.room_id, NEW.owner_id, " OCCUPANCY_TODAY "); "
+    "END;",
+
+    "CREATE TRIGGER IF NOT EXISTS trg_room_occupancy_update AFTER UPDATE OF owner_id ON rooms "
+    "WHEN OLD.owner_id IS NOT NEW.owner_id BEGIN "
+    "UPDATE room_occupancy SET end_day = MAX(start_day, " OCCUPANCY_TODAY ") "
+    "WHERE room_id = OLD.room_id AND end_day IS NULL; "
+    "INSERT INTO room_occupancy (room_id, owner_id, start_day) "
+    "SELECT NEW.room_id, NEW.owner_id, " OCCUPANCY_TODAY " WHERE NEW.owner_id IS NOT NULL AND NEW.owner_id <> ''; "
+    "END;",
+
+    "CREATE TRIGGER IF NOT EXISTS trg_room_occupancy_delete AFTER DELETE ON rooms BEGIN "
+    "UPDATE room_occupancy SET end_day = MAX(start_day, " OCCUPANCY_TODAY ") "
+    "WHERE room_id = OLD.room_id AND end_day IS NULL; "
+    "END;",
+
+    // 首次升级时为已有的滞纳金账单补上对应的欠费账单
+    "UPDATE transactions SET source_id = substr(transaction_id, 4) "
+    "WHERE fee_type = 6 AND source_id IS NULL AND transaction_id LIKE 'LF-%';",
+
+    // 首次升级时为已有业主的房屋建立持有期，入住日未知，视为一直持有
+    "INSERT INTO room_occupancy (room_id, owner_id, start_day) "
+    "SELECT room_id, owner_id, 0 FROM rooms r WHERE owner_id IS NOT NULL AND owner_id <> '' "
+    "AND NOT EXISTS (SELECT 1 FROM room_occupancy o WHERE o.room_id = r.room_id);",
+
+    // 首次升级时为已有账单确定立方体楼宇（不涉及触发器监听的列，不会产生立方体变更）
+    "UPDATE transactions SET cube_building_id = " CUBE_RESOLVE_BUILDING("transactions") " "
+    "WHERE cube_building_id IS NULL;",
+
+    // 首次升级时按现有交易初始化账本
+    "INSERT INTO owner_ledger (user_id, fee_type, billed_amount, paid_amount, overdue_amount, "
+    "bill_count, unpaid_count, last_activity) "
+    "SELECT * FROM owner_ledger_expected WHERE NOT EXISTS (SELECT 1 FROM owner_ledger);",
+    // 首次升级时按现有交易构建立方体，并将水位置于当前日志末尾
+    "INSERT INTO fee_cube (building_id, fee_type, month, payment_method, billed_amount, paid_amount, "
+    "overdue_amount, bill_count, paid_count, overdue_count) "
+    "SELECT " CUBE_BUILDING("t") " AS building, t.fee_type, " CUBE_MONTH("t") " AS month, " CUBE_METHOD("t") " AS method, "
+    "SUM(t.amount), SUM(CASE WHEN t.status = 1 THEN t.amount ELSE 0 END), "
+    "SUM(CASE WHEN t.status = 2 THEN t.amount ELSE 0 END), COUNT(*), SUM(t.status = 1), SUM(t.status = 2) "
+    "FROM transactions t WHERE NOT EXISTS (SELECT 1 FROM fee_cube_state) "
+    "GROUP BY building, t.fee_type, month, method;",
+
+    "INSERT OR IGNORE INTO fee_cube_state (state_id, watermark, refreshed_at) "
+    "SELECT 1, COALESCE(MAX(change_id), 0), strftime('%s', 'now') FROM fee_cube_changes;",
+    // 首次升级时把立方体中已有的月份全部标记为待计算
+    "INSERT OR IGNORE INTO collection_rates (month) SELECT DISTINCT month FROM fee_cube;",
+    NULL};
+
+// 已被取代的旧版触发器，升级时删除
+static const char *DROP_TRIGGERS[] = {
+    "DROP TRIGGER IF EXISTS trg_fee_cube_insert;",
+    "DROP TRIGGER IF EXISTS trg_fee_cube_update;",
+    "DROP TRIGGER IF EXISTS trg_fee_cube_delete;",
+    // 调用pinyin_key()的触发器要求每个写users表的连接都注册该函数，改为由程序计算排序键
+    "DROP TRIGGER IF EXISTS trg_users_sort_key_insert;",
+    "DROP TRIGGER IF EXISTS trg_users_sort_key_update;",
+    NULL};
+
+// 旧版本数据库缺失的列：表名、列名、列定义
+static const char *MIGRATE_COLUMNS[][3] = {
+    {"fee_standards", "grace_days", "INTEGER DEFAULT 0"},
+    {"fee_standards", "cap_rate", "REAL DEFAULT 0"},
+    {"users", "name_sort_key", "BLOB"},
+    {"transactions", "source_id", "TEXT"},
+    {"transactions", "cube_building_id", "TEXT"},
+    {NULL, NULL, NULL}};
+
+// 创建索引
+static const char *CREATE_INDEXES[] = {
+    // 逾期标记与滞纳金计提按状态和截止日期扫描
+    "CREATE INDEX IF NOT EXISTS idx_transactions_status_due ON transactions(status, due_date);",
+    // 出账时按房屋、费用类型和账期判断账单是否已存在
+    "CREATE INDEX IF NOT EXISTS idx_transactions_room_period ON transactions(room_id, fee_type, period_start);",
+    "CREATE INDEX IF NOT EXISTS idx_transactions_parking_period ON transactions(parking_id, fee_type, period_start) "
+    "WHERE parking_id IS NOT NULL;",
+    // 业主变更时按房屋查找当前持有期
+    "CREATE INDEX IF NOT EXISTS idx_room_occupancy_room ON room_occupancy(room_id, end_day);",
+    // 对账单按业主读取当月账单
+    "CREATE INDEX IF NOT EXISTS idx_transactions_user ON transactions(user_id, period_start);",
+    // 提醒去重按业主查找最近一次提醒，投递只扫描待投递的提醒
+    "CREATE INDEX IF NOT EXISTS idx_payment_reminders_user ON payment_reminders(user_id, send_time);",
+    "CREATE INDEX IF NOT EXISTS idx_payment_reminders_pending ON payment_reminders(status) WHERE status = 0;",
+    // 提醒记录和业主缴费记录按时间分页浏览
+    "CREATE INDEX IF NOT EXISTS idx_payment_reminders_send ON payment_reminders(send_time);",
+    "CREATE INDEX IF NOT EXISTS idx_transactions_user_paid ON transactions(user_id, payment_date, transaction_id);",
+    // 立方体按业主归属楼宇，按月份切片
+    "CREATE INDEX IF NOT EXISTS idx_rooms_owner ON rooms(owner_id);",
+    "CREATE INDEX IF NOT EXISTS idx_fee_cube_month ON fee_cube(month);",
+    // 欠费排行按未结金额有序扫描账本
+    "CREATE INDEX IF NOT EXISTS idx_owner_ledger_outstanding ON owner_ledger(fee_type, billed_amount - paid_amount);",
+    // 收缴率缓存只重算待计算的月份
+    "CREATE INDEX IF NOT EXISTS idx_collection_rates_dirty ON collection_rates(month) WHERE dirty = 1;",
+    "CREATE INDEX IF NOT EXISTS idx_job_runs_job ON job_runs(job_name, run_id);",
+    // 按姓名拼音顺序列出某一角色的用户
+    "CREATE INDEX IF NOT EXISTS idx_users_role_sort ON users(role_id, name_sort_key, user_id);",
+    // 计提时按欠费账单汇总已开出的滞纳金
+    "CREATE INDEX IF NOT EXISTS idx_transactions_source ON transactions(source_id) WHERE source_id IS NOT NULL;",
+    NULL};
+
 // 初始化角色数据 - 使用静态标识符而非UUID
 static const char *INSERT_ROLES[] = {
     "INSERT OR IGNORE INTO roles (role_id, role_name, permission_level) VALUES ('role_admin', '管理员', 1);",
@@ -168,6 +508,20 @@ static const char *INSERT_DEFAULT_FEE_STANDARDS[] = {
     "INSERT OR IGNORE INTO fee_standards (standard_id, fee_type, price_per_unit, unit, effective_date) "
     "VALUES ('GF01', 5, 3.2, '元/m³', strftime('%s','2024-01-01'));", // 燃气费
 
+    // 滞纳金标准：日万分之五，宽限15天，最高不超过欠费本金
+    "INSERT OR IGNORE INTO fee_standards (standard_id, fee_type, price_per_unit, unit, effective_date, grace_days, cap_rate) "
+    "VALUES ('LF01', 6, 0.0005, '比例/日', strftime('%s','2024-01-01'), 15, 1.0);", // 滞纳金
+
+    NULL};
+
+// 默认后台维护任务，错开在夜间运行
+static const char *INSERT_DEFAULT_JOBS[] = {
+    "INSERT OR IGNORE INTO scheduled_jobs (job_name, schedule, jitter_seconds) VALUES ('mark_overdue', '*/15 * * * *', 60);",
+    "INSERT OR IGNORE INTO scheduled_jobs (job_name, schedule, jitter_seconds) VALUES ('refresh_statistics', '*/10 * * * *', 60);",
+    "INSERT OR IGNORE INTO scheduled_jobs (job_name, schedule, jitter_seconds) VALUES ('accrue_late_fees', '10 1 * * *', 600);",
+    "INSERT OR IGNORE INTO scheduled_jobs (job_name, schedule, jitter_seconds) VALUES ('backup', '30 2 * * *', 600);",
+    "INSERT OR IGNORE INTO scheduled_jobs (job_name, schedule, jitter_seconds) VALUES ('optimize', '0 3 * * *', 600);",
+    "INSERT OR IGNORE INTO scheduled_jobs (job_name, schedule, jitter_seconds) VALUES ('incremental_vacuum', '30 3 * * 0', 600);",
     NULL};
 
 // 初始化默认楼栋数据
@@ -182,6 +536,65 @@ static const char *INSERT_DEFAULT_BUILDINGS[] = {
 
     NULL};
 
+/**
+ * 写入用户姓名的拼音排序键，新增用户或修改姓名后调用
+ */
+int db_set_name_sort_key(Database *db, const char *user_id, const char *name)
+{
+    sqlite3_stmt *stmt;
+    int result = sqlite3_prepare_v2(db->db, "UPDATE users SET name_sort_key = ? WHERE user_id = ?;", -1, &stmt, NULL);
+    if (result != SQLITE_OK)
+    {
+        fprintf(stderr, "无法更新姓名排序键: %s\n", sqlite3_errmsg(db->db));
+        return result;
+    }
+    pinyin_bind_sort_key(stmt, 1, name);
+    sqlite3_bind_text(stmt, 2, user_id, -1, SQLITE_STATIC);
+    result = sqlite3_step(stmt);
+    sqlite3_finalize(stmt);
+    if (result != SQLITE_DONE)
+    {
+        fprintf(stderr, "无法更新姓名排序键: %s\n", sqlite3_errmsg(db->db));
+        return result;
+    }
+    return SQLITE_OK;
+}
+
+/**
+ * 为排序键为空的用户计算排序键：旧版本数据库升级，或外部脚本直接写入的用户
+ */
+static int backfill_name_sort_keys(Database *db)
+{
+    sqlite3_stmt *select_stmt, *update_stmt;
+    int result = sqlite3_prepare_v2(db->db, "SELECT rowid, name FROM users WHERE name_sort_key IS NULL;", -1,
+                                    &select_stmt, NULL);
+    if (result != SQLITE_OK)
+    {
+        return result;
+    }
+    result = sqlite3_prepare_v2(db->db, "UPDATE users SET name_sort_key = ? WHERE rowid = ?;", -1, &update_stmt, NULL);
+    if (result != SQLITE_OK)
+    {
+        sqlite3_finalize(select_stmt);
+        return result;
+    }
+
+    while ((result = sqlite3_step(select_stmt)) == SQLITE_ROW)
+    {
+        pinyin_bind_sort_key(update_stmt, 1, (const char *)sqlite3_column_text(select_stmt, 1));
+        sqlite3_bind_int64(update_stmt, 2, sqlite3_column_int64(select_stmt, 0));
+        result = sqlite3_step(update_stmt);
+        sqlite3_reset(update_stmt);
+        if (result != SQLITE_DONE)
+        {
+            break;
+        }
+    }
+    sqlite3_finalize(select_stmt);
+    sqlite3_finalize(update_stmt);
+    return result == SQLITE_DONE ? SQLITE_OK : result;
+}
+
 /**
  * 使用UUID初始化默认管理员账户
  * 注意：用户ID使用UUID，但角色ID使用静态标识符'role_admin'
@@ -206,6 +619,11 @@ int db_init_admin(Database *db)
         fprintf(stderr, "初始化管理员账户失败: %s\n", sqlite3_errmsg(db->db));
         return result;
     }
+    result = db_set_name_sort_key(db, admin_uuid, "系统管理员");
+    if (result != SQLITE_OK)
+    {
+        return result;
+    }
 
     printf("管理员账户初始化完成\n");
     return SQLITE_OK;
@@ -275,6 +693,11 @@ int db_init_staff(Database *db)
             fprintf(stderr, "初始化物业人员用户失败: %s\n", sqlite3_errmsg(db->db));
             return result;
         }
+        result = db_set_name_sort_key(db, staff_user_uuid, "物业服务员");
+        if (result != SQLITE_OK)
+        {
+            return result;
+        }
     }
 
     // 检查staff关联记录是否已存在
@@ -362,6 +785,11 @@ int db_init_default_data(Database *db)
                 fprintf(stderr, "初始化用户数据失败: %s\n", sqlite3_errmsg(db->db));
                 return result;
             }
+            result = db_set_name_sort_key(db, user_uuids[i], names[i]);
+            if (result != SQLITE_OK)
+            {
+                return result;
+            }
         }
     }
 
@@ -411,6 +839,47 @@ int db_init_default_data(Database *db)
     return SQLITE_OK;
 }
 
+/**
+ * 为旧版本数据库补齐缺失的列
+ *
+ * @param db 数据库连接指针
+ * @param table 表名
+ * @param column 列名
+ * @param definition 列定义
+ * @return SQLITE_OK 表示成功，其他值表示失败
+ */
+static int db_add_missing_column(Database *db, const char *table, const char *column, const char *definition)
+{
+    char sql[256];
+    sqlite3_stmt *stmt;
+    bool exists = false;
+
+    snprintf(sql, sizeof(sql), "PRAGMA table_info(%s);", table);
+    int result = sqlite3_prepare_v2(db->db, sql, -1, &stmt, NULL);
+    if (result != SQLITE_OK)
+    {
+        return result;
+    }
+
+    while (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        if (strcmp((const char *)sqlite3_column_text(stmt, 1), column) == 0)
+        {
+            exists = true;
+            break;
+        }
+    }
+    sqlite3_finalize(stmt);
+
+    if (exists)
+    {
+        return SQLITE_OK;
+    }
+
+    snprintf(sql, sizeof(sql), "ALTER TABLE %s ADD COLUMN %s %s;", table, column, definition);
+    return db_execute(db, sql);
+}
+
 /**
  * db_init_tables
  *
@@ -443,6 +912,18 @@ int db_init_tables(Database *db)
         CREATE_SERVICE_RECORDS_TABLE,
         CREATE_FEE_STANDARDS_TABLE,
         CREATE_TRANSACTIONS_TABLE,
+        CREATE_LATE_FEE_RUNS_TABLE,
+        CREATE_PAYMENT_REQUESTS_TABLE,
+        CREATE_PAYMENT_REMINDERS_TABLE,
+        CREATE_OWNER_LEDGER_TABLE,
+        CREATE_OWNER_LEDGER_EXPECTED_VIEW,
+        CREATE_ROOM_OCCUPANCY_TABLE,
+        CREATE_FEE_CUBE_TABLE,
+        CREATE_FEE_CUBE_CHANGES_TABLE,
+        CREATE_FEE_CUBE_STATE_TABLE,
+        CREATE_COLLECTION_RATES_TABLE,
+        CREATE_SCHEDULED_JOBS_TABLE,
+        CREATE_JOB_RUNS_TABLE,
         NULL};
 
     int i = 0;
@@ -458,6 +939,51 @@ int db_init_tables(Database *db)
         i++;
     }
 
+    // 升级旧版本数据库的表结构
+    for (i = 0; MIGRATE_COLUMNS[i][0] != NULL; i++)
+    {
+        result = db_add_missing_column(db, MIGRATE_COLUMNS[i][0], MIGRATE_COLUMNS[i][1], MIGRATE_COLUMNS[i][2]);
+        if (result != SQLITE_OK)
+        {
+            fprintf(stderr, "升级表结构失败: %s\n", sqlite3_errmsg(db->db));
+            db_execute(db, "ROLLBACK;");
+            return result;
+        }
+    }
+
+    for (i = 0; CREATE_INDEXES[i] != NULL; i++)
+    {
+        result = db_execute(db, CREATE_INDEXES[i]);
+        if (result != SQLITE_OK)
+        {
+            fprintf(stderr, "创建索引失败: %s\n", sqlite3_errmsg(db->db));
+            db_execute(db, "ROLLBACK;");
+            return result;
+        }
+    }
+
+    for (i = 0; DROP_TRIGGERS[i] != NULL; i++)
+    {
+        result = db_execute(db, DROP_TRIGGERS[i]);
+        if (result != SQLITE_OK)
+        {
+            fprintf(stderr, "删除旧触发器失败: %s\n", sqlite3_errmsg(db->db));
+            db_execute(db, "ROLLBACK;");
+            return result;
+        }
+    }
+
+    for (i = 0; CREATE_TRIGGERS[i] != NULL; i++)
+    {
+        result = db_execute(db, CREATE_TRIGGERS[i]);
+        if (result != SQLITE_OK)
+        {
+            fprintf(stderr, "创建触发器失败: %s\n", sqlite3_errmsg(db->db));
+            db_execute(db, "ROLLBACK;");
+            return result;
+        }
+    }
+
     i = 0;
     while (INSERT_ROLES[i] != NULL)
     {
@@ -485,6 +1011,18 @@ int db_init_tables(Database *db)
         i++;
     }
 
+    // 初始化后台维护任务
+    for (i = 0; INSERT_DEFAULT_JOBS[i] != NULL; i++)
+    {
+        result = db_execute(db, INSERT_DEFAULT_JOBS[i]);
+        if (result != SQLITE_OK)
+        {
+            fprintf(stderr, "初始化后台任务失败: %s\n", sqlite3_errmsg(db->db));
+            db_execute(db, "ROLLBACK;");
+            return result;
+        }
+    }
+
     // // 初始化楼栋数据
     // i = 0;
     // while (INSERT_DEFAULT_BUILDINGS[i] != NULL)
@@ -523,6 +1061,15 @@ int db_init_tables(Database *db)
     //     return result;
     // }
 
+    // 补算缺失的姓名排序键
+    result = backfill_name_sort_keys(db);
+    if (result != SQLITE_OK)
+    {
+        fprintf(stderr, "计算姓名排序键失败: %s\n", sqlite3_errmsg(db->db));
+        db_execute(db, "ROLLBACK;");
+        return result;
+    }
+
     // 提交事务
     result = db_execute(db, "COMMIT;");
     if (result != SQLITE_OK)
@@ -154,7 +154,12 @@ bool restore_database(Database *db)
  */
 bool clean_database(Database *db) {
     const char *cleanup_queries[] = {
+        "DELETE FROM payment_reminders;",
         "DELETE FROM transactions;",
+        "DELETE FROM owner_ledger;",
+        "DELETE FROM fee_cube_changes;",
+        "DELETE FROM fee_cube;",
+        "DELETE FROM collection_rates;",
         "DELETE FROM rooms;",
         "DELETE FROM users WHERE role_id = 'role_owner';",
         "VACUUM;",
@@ -2,6 +2,7 @@
  * 物业管理系统主程序入口
  *
  * 功能：
+ * - 带参数运行时进入命令行模式
  * - 初始化用户界面
  * - 设置和检查数据存储目录
  * - 初始化数据库连接
@@ -27,11 +28,16 @@
 #include "ui/ui_owner.h"
 #include "utils/file_ops.h"
 #include "models/transaction.h"
+#include "models/scheduler.h"
+#include "cli/cli.h"
 
-#define DB_FILENAME "property_management.db"
-
-int main()
+int main(int argc, char *argv[])
 {
+    // 带参数运行时执行批处理命令，不进入交互界面
+    if (argc > 1)
+    {
+        return cli_main(argc, argv);
+    }
 
     // 数据库保存的地方
     char data_dir[256];
@@ -84,11 +90,15 @@ int main()
         return 1;
     }
 
+    // 启动后台维护任务（标记逾期、计提滞纳金、备份等）
+    scheduler_start(db_path);
+
     system("clear||cls");
 
     LoginResult login_result = show_login_screen(&db);
 
     // 清理资源
+    scheduler_stop();
     db_close(&db);
 
     return 0;
@@ -0,0 +1,562 @@
+#include "models/aging.h"
+#include "utils/hash_map.h"
+#include "utils/table.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define AGING_BLOCK 1024 // 分档内核每批处理的账单数，批内下标数组留在一级缓存
+
+static const char *FEE_TYPE_NAMES[AGING_TYPE_SLOTS] = {"", "物业费", "停车费", "水费", "电费", "燃气费", "滞纳金", "其他费用"};
+
+// 楼宇取账单所属房屋的楼宇，未关联房屋时取业主名下房屋的楼宇
+static const char *LOAD_UNPAID_SQL =
+    "SELECT t.due_date, t.amount, t.fee_type, t.user_id, "
+    "COALESCE(r.building_id, (SELECT o.building_id FROM rooms o WHERE o.owner_id = t.user_id LIMIT 1)) "
+    "FROM transactions t "
+    "LEFT JOIN rooms r ON r.room_id = t.room_id "
+    "WHERE t.status IN (0, 2)";
+
+// 未缴账单列数据，同一下标对应同一笔账单
+typedef struct
+{
+    size_t count;
+    size_t cap;
+    int64_t *due;       // 截止日期
+    double *amount;     // 金额
+    uint8_t *fee_slot;  // 费用类型槽位
+    uint16_t *building; // 楼宇下标，0为未分配
+    uint32_t *user;     // 业主下标
+} AgingColumns;
+
+static double seconds_between(const struct timespec *from, const struct timespec *to)
+{
+    return (to->tv_sec - from->tv_sec) + (to->tv_nsec - from->tv_nsec) / 1e9;
+}
+
+/**
+ * @brief 校验分档边界并生成分档名称
+ *
+ * @param config 分档配置
+ * @return bool 边界为正且严格递增时返回true
+ */
+bool aging_config_valid(const AgingConfig *config)
+{
+    if (config->bound_count < 1 || config->bound_count > AGING_MAX_BOUNDS)
+    {
+        return false;
+    }
+    for (int i = 0; i < config->bound_count; i++)
+    {
+        if (config->bounds[i] <= 0 || (i > 0 && config->bounds[i] <= config->bounds[i - 1]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief 解析分档边界
+ *
+ * @param text "30,60,90,180"形式的文本，也接受空格分隔
+ * @param config 输出参数，分档配置
+ * @return bool 解析成功且边界有效返回true
+ */
+bool parse_aging_bounds(const char *text, AgingConfig *config)
+{
+    AgingConfig parsed = {0};
+    const char *p = text;
+    while (*p)
+    {
+        if (*p == ',' || *p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')
+        {
+            p++;
+            continue;
+        }
+
+        char *end;
+        long value = strtol(p, &end, 10);
+        if (end == p || value <= 0 || value > 36500 || parsed.bound_count == AGING_MAX_BOUNDS)
+        {
+            return false;
+        }
+        parsed.bounds[parsed.bound_count++] = (int)value;
+        p = end;
+    }
+
+    if (!aging_config_valid(&parsed))
+    {
+        return false;
+    }
+    *config = parsed;
+    return true;
+}
+
+/**
+ * 追加一行到列数据，容量不足时各列同时扩容
+ */
+static bool append_row(AgingColumns *cols)
+{
+    if (cols->count < cols->cap)
+    {
+        return true;
+    }
+
+    size_t cap = cols->cap ? cols->cap * 2 : 65536;
+    int64_t *due = realloc(cols->due, cap * sizeof(int64_t));
+    if (due)
+        cols->due = due;
+    double *amount = realloc(cols->amount, cap * sizeof(double));
+    if (amount)
+        cols->amount = amount;
+    uint8_t *fee_slot = realloc(cols->fee_slot, cap * sizeof(uint8_t));
+    if (fee_slot)
+        cols->fee_slot = fee_slot;
+    uint16_t *building = realloc(cols->building, cap * sizeof(uint16_t));
+    if (building)
+        cols->building = building;
+    uint32_t *user = realloc(cols->user, cap * sizeof(uint32_t));
+    if (user)
+        cols->user = user;
+
+    if (!due || !amount || !fee_slot || !building || !user)
+    {
+        fprintf(stderr, "内存分配失败：账龄列数据\n");
+        return false;
+    }
+    cols->cap = cap;
+    return true;
+}
+
+static void free_columns(AgingColumns *cols)
+{
+    free(cols->due);
+    free(cols->amount);
+    free(cols->fee_slot);
+    free(cols->building);
+    free(cols->user);
+    memset(cols, 0, sizeof(AgingColumns));
+}
+
+/**
+ * 读取楼宇列表，楼宇下标从1开始按名称排序，0保留给未分配楼宇
+ */
+static bool load_buildings(Database *db, AgingMatrix *matrix, HashMap *building_index)
+{
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(db->db, "SELECT COUNT(*) FROM buildings", -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "读取楼宇失败: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+    int count = sqlite3_step(stmt) == SQLITE_ROW ? sqlite3_column_int(stmt, 0) : 0;
+    sqlite3_finalize(stmt);
+
+    if (count + 1 > UINT16_MAX)
+    {
+        fprintf(stderr, "楼宇数量超出账龄分析上限\n");
+        return false;
+    }
+
+    matrix->building_names = calloc(count + 1, sizeof(*matrix->building_names));
+    if (!matrix->building_names || !hash_map_init(building_index, count))
+    {
+        fprintf(stderr, "内存分配失败：楼宇列表\n");
+        return false;
+    }
+    snprintf(matrix->building_names[0], sizeof(matrix->building_names[0]), "未分配楼宇");
+    matrix->building_count = 1;
+
+    if (sqlite3_prepare_v2(db->db, "SELECT building_id, building_name FROM buildings ORDER BY building_name",
+                           -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "读取楼宇失败: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+    while (matrix->building_count <= count && sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        const char *name = (const char *)sqlite3_column_text(stmt, 1);
+        int index = matrix->building_count++;
+        snprintf(matrix->building_names[index], sizeof(matrix->building_names[index]), "%s", name ? name : "");
+        if (!hash_map_put(building_index, sqlite3_column_text(stmt, 0), (size_t)sqlite3_column_bytes(stmt, 0),
+                          (void *)(intptr_t)index))
+        {
+            sqlite3_finalize(stmt);
+            return false;
+        }
+    }
+    sqlite3_finalize(stmt);
+    return true;
+}
+
+/**
+ * 读取全部未缴账单为列数据，业主ID映射为连续下标
+ */
+static bool load_columns(Database *db, const HashMap *building_index, AgingColumns *cols, size_t *user_count)
+{
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(db->db, LOAD_UNPAID_SQL, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "读取未缴账单失败: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+
+    HashMap users;
+    if (!hash_map_init(&users, 1024))
+    {
+        sqlite3_finalize(stmt);
+        return false;
+    }
+
+    bool ok = true;
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+    {
+        if (!append_row(cols))
+        {
+            ok = false;
+            break;
+        }
+
+        size_t row = cols->count++;
+        int fee_type = sqlite3_column_int(stmt, 2);
+        cols->due[row] = sqlite3_column_int64(stmt, 0);
+        cols->amount[row] = sqlite3_column_double(stmt, 1);
+        cols->fee_slot[row] = (fee_type >= 1 && fee_type <= 6) ? fee_type : 7;
+
+        const void *user_id = sqlite3_column_text(stmt, 3);
+        size_t user_len = (size_t)sqlite3_column_bytes(stmt, 3);
+        void **user = hash_map_lookup(&users, user_id ? user_id : "", user_len);
+        if (!user)
+        {
+            if (!hash_map_put(&users, user_id ? user_id : "", user_len, (void *)(intptr_t)(users.count + 1)))
+            {
+                ok = false;
+                break;
+            }
+            user = hash_map_lookup(&users, user_id ? user_id : "", user_len);
+        }
+        cols->user[row] = (uint32_t)((intptr_t)*user - 1);
+
+        const void *building_id = sqlite3_column_text(stmt, 4);
+        cols->building[row] = building_id
+                                  ? (uint16_t)(intptr_t)hash_map_get(building_index, building_id,
+                                                                     (size_t)sqlite3_column_bytes(stmt, 4))
+                                  : 0;
+    }
+    if (ok && rc != SQLITE_DONE)
+    {
+        fprintf(stderr, "读取未缴账单失败: %s\n", sqlite3_errmsg(db->db));
+        ok = false;
+    }
+    sqlite3_finalize(stmt);
+
+    *user_count = users.count;
+    hash_map_free(&users);
+    return ok;
+}
+
+/**
+ * 分档内核
+ *
+ * 每批先算出各账单的矩阵单元下标：分档号等于账龄超过的边界个数，未使用的边界填最大值，
+ * 内层比较次数固定且无分支，编译器可向量化。再按下标把笔数和金额散列累加到矩阵，
+ * 同时以位掩码记录每位业主出现过的分档和费用类型，用于统计去重业主数。
+ */
+static void bucket_columns(const AgingColumns *cols, const int64_t *bound_seconds, int bucket_count,
+                           int64_t now, AgingCell *cells, uint8_t *user_buckets, uint8_t *user_types)
+{
+    uint32_t cell_index[AGING_BLOCK];
+    uint8_t bucket[AGING_BLOCK];
+
+    for (size_t start = 0; start < cols->count; start += AGING_BLOCK)
+    {
+        size_t n = cols->count - start < AGING_BLOCK ? cols->count - start : AGING_BLOCK;
+        const int64_t *due = cols->due + start;
+        const uint8_t *fee_slot = cols->fee_slot + start;
+        const uint16_t *building = cols->building + start;
+
+        for (size_t i = 0; i < n; i++)
+        {
+            int64_t age = now - due[i];
+            uint32_t b = 0;
+            for (int j = 0; j < AGING_MAX_BOUNDS; j++)
+            {
+                b += age > bound_seconds[j];
+            }
+            bucket[i] = (uint8_t)b;
+            cell_index[i] = ((uint32_t)building[i] * AGING_TYPE_SLOTS + fee_slot[i]) * (uint32_t)bucket_count + b;
+        }
+
+        const double *amount = cols->amount + start;
+        const uint32_t *user = cols->user + start;
+        for (size_t i = 0; i < n; i++)
+        {
+            AgingCell *cell = &cells[cell_index[i]];
+            cell->bill_count++;
+            cell->amount += amount[i];
+            user_buckets[user[i]] |= (uint8_t)(1u << bucket[i]);
+            user_types[user[i]] |= (uint8_t)(1u << fee_slot[i]);
+        }
+    }
+}
+
+/**
+ * 由矩阵单元和业主位掩码得出各项汇总
+ */
+static void summarize(AgingMatrix *matrix, const uint8_t *user_buckets, const uint8_t *user_types, size_t user_count)
+{
+    for (int building = 0; building < matrix->building_count; building++)
+    {
+        for (int slot = 1; slot < AGING_TYPE_SLOTS; slot++)
+        {
+            for (int bucket = 0; bucket < matrix->bucket_count; bucket++)
+            {
+                const AgingCell *cell = &AGING_CELL(matrix, building, slot, bucket);
+                matrix->by_bucket[bucket].bill_count += cell->bill_count;
+                matrix->by_bucket[bucket].amount += cell->amount;
+                matrix->by_type[slot].bill_count += cell->bill_count;
+                matrix->by_type[slot].amount += cell->amount;
+                matrix->total.bill_count += cell->bill_count;
+                matrix->total.amount += cell->amount;
+            }
+        }
+    }
+
+    for (size_t user = 0; user < user_count; user++)
+    {
+        for (int bucket = 0; bucket < matrix->bucket_count; bucket++)
+        {
+            matrix->bucket_users[bucket] += (user_buckets[user] >> bucket) & 1;
+        }
+        for (int slot = 1; slot < AGING_TYPE_SLOTS; slot++)
+        {
+            matrix->type_users[slot] += (user_types[user] >> slot) & 1;
+        }
+    }
+    matrix->total_users = (int)user_count;
+}
+
+/**
+ * 计算账龄矩阵
+ *
+ * 未缴（含逾期）账单一次读入为连续的列数组（截止日期、金额、费用类型、楼宇、业主），
+ * 分档在内存中完成，不再由SQL逐行调用日期函数。
+ *
+ * @param db 数据库连接
+ * @param config 分档配置，NULL使用默认分档
+ * @param now 计算账龄的基准时间
+ * @param matrix 输出参数，账龄矩阵，用完须调用free_aging_matrix
+ * @return bool 成功返回true
+ */
+bool build_aging_matrix(Database *db, const AgingConfig *config, time_t now, AgingMatrix *matrix)
+{
+    static const AgingConfig default_config = AGING_CONFIG_DEFAULT;
+    memset(matrix, 0, sizeof(AgingMatrix));
+    matrix->config = config ? *config : default_config;
+    if (!aging_config_valid(&matrix->config))
+    {
+        fprintf(stderr, "账龄分档边界无效\n");
+        return false;
+    }
+
+    matrix->bucket_count = matrix->config.bound_count + 1;
+    int64_t bound_seconds[AGING_MAX_BOUNDS];
+    for (int j = 0; j < AGING_MAX_BOUNDS; j++)
+    {
+        bound_seconds[j] = j < matrix->config.bound_count ? (int64_t)matrix->config.bounds[j] * 86400 : INT64_MAX;
+    }
+    for (int b = 0; b < matrix->bucket_count; b++)
+    {
+        int low = b == 0 ? 0 : matrix->config.bounds[b - 1] + 1;
+        if (b == matrix->config.bound_count)
+            snprintf(matrix->bucket_names[b], sizeof(matrix->bucket_names[b]), "%d天以上", matrix->config.bounds[b - 1]);
+        else
+            snprintf(matrix->bucket_names[b], sizeof(matrix->bucket_names[b]), "%d-%d天", low, matrix->config.bounds[b]);
+    }
+
+    struct timespec started, loaded, finished;
+    clock_gettime(CLOCK_MONOTONIC, &started);
+
+    HashMap building_index = {0};
+    AgingColumns cols = {0};
+    size_t user_count = 0;
+    bool ok = load_buildings(db, matrix, &building_index) &&
+              load_columns(db, &building_index, &cols, &user_count);
+    hash_map_free(&building_index);
+    if (!ok)
+    {
+        free_columns(&cols);
+        free_aging_matrix(matrix);
+        return false;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &loaded);
+
+    size_t cell_count = (size_t)matrix->building_count * AGING_TYPE_SLOTS * matrix->bucket_count;
+    matrix->cells = calloc(cell_count, sizeof(AgingCell));
+    uint8_t *user_buckets = calloc(user_count + 1, 1);
+    uint8_t *user_types = calloc(user_count + 1, 1);
+    if (!matrix->cells || !user_buckets || !user_types)
+    {
+        fprintf(stderr, "内存分配失败：账龄矩阵\n");
+        free(user_buckets);
+        free(user_types);
+        free_columns(&cols);
+        free_aging_matrix(matrix);
+        return false;
+    }
+
+    bucket_columns(&cols, bound_seconds, matrix->bucket_count, (int64_t)now, matrix->cells, user_buckets, user_types);
+    summarize(matrix, user_buckets, user_types, user_count);
+    clock_gettime(CLOCK_MONOTONIC, &finished);
+
+    matrix->row_count = (long)cols.count;
+    matrix->load_seconds = seconds_between(&started, &loaded);
+    matrix->bucket_seconds = seconds_between(&loaded, &finished);
+
+    free(user_buckets);
+    free(user_types);
+    free_columns(&cols);
+    return true;
+}
+
+/**
+ * 打印一行分档金额
+ */
+static void add_bucket_row(Table *table, const AgingMatrix *matrix, const char *label, const AgingCell *cells,
+                           const AgingCell *total)
+{
+    char amounts[AGING_MAX_BUCKETS + 1][32];
+    const char *values[AGING_MAX_BUCKETS + 2];
+    values[0] = label;
+    for (int b = 0; b < matrix->bucket_count; b++)
+    {
+        snprintf(amounts[b], sizeof(amounts[b]), "%.2f", cells[b].amount);
+        values[b + 1] = amounts[b];
+    }
+    snprintf(amounts[matrix->bucket_count], sizeof(amounts[0]), "%.2f", total->amount);
+    values[matrix->bucket_count + 1] = amounts[matrix->bucket_count];
+    table_add_row(table, values);
+}
+
+// 首列为维度，其后每个账龄分档一列，最后一列合计；columns需在表格结束前保持有效
+static bool begin_bucket_table(Table *table, TableColumn *columns, const AgingMatrix *matrix, const char *first)
+{
+    columns[0] = (TableColumn){first, TABLE_ALIGN_LEFT, 16};
+    for (int b = 0; b < matrix->bucket_count; b++)
+    {
+        columns[b + 1] = (TableColumn){matrix->bucket_names[b], TABLE_ALIGN_RIGHT, 0};
+    }
+    columns[matrix->bucket_count + 1] = (TableColumn){"合计", TABLE_ALIGN_RIGHT, 0};
+    return table_begin(table, columns, matrix->bucket_count + 2, 0);
+}
+
+/**
+ * @brief 打印账龄矩阵
+ *
+ * @param matrix 账龄矩阵
+ */
+void print_aging_matrix(const AgingMatrix *matrix)
+{
+    static const TableColumn summary_columns[] = {
+        {"账龄", TABLE_ALIGN_LEFT, 0},
+        {"用户数", TABLE_ALIGN_RIGHT, 0},
+        {"账单数", TABLE_ALIGN_RIGHT, 0},
+        {"欠费金额", TABLE_ALIGN_RIGHT, 0},
+        {"占比", TABLE_ALIGN_RIGHT, 0},
+    };
+    TableColumn columns[AGING_MAX_BUCKETS + 2];
+    Table table;
+
+    printf("【按账龄分档统计】\n");
+    if (table_begin(&table, summary_columns, 5, 0))
+    {
+        char users[16], bills[24], amount[32], share[16];
+        for (int b = 0; b < matrix->bucket_count; b++)
+        {
+            const AgingCell *cell = &matrix->by_bucket[b];
+            snprintf(users, sizeof(users), "%d", matrix->bucket_users[b]);
+            snprintf(bills, sizeof(bills), "%ld", cell->bill_count);
+            snprintf(amount, sizeof(amount), "%.2f", cell->amount);
+            snprintf(share, sizeof(share), "%.1f%%",
+                     matrix->total.amount > 0 ? cell->amount / matrix->total.amount * 100 : 0.0);
+            const char *values[] = {matrix->bucket_names[b], users, bills, amount, share};
+            table_add_row(&table, values);
+        }
+        snprintf(users, sizeof(users), "%d", matrix->total_users);
+        snprintf(bills, sizeof(bills), "%ld", matrix->total.bill_count);
+        snprintf(amount, sizeof(amount), "%.2f", matrix->total.amount);
+        const char *values[] = {"合计", users, bills, amount, NULL};
+        table_add_row(&table, values);
+        table_end(&table);
+    }
+    printf("\n");
+
+    printf("【费用类型 x 账龄】\n");
+    if (begin_bucket_table(&table, columns, matrix, "费用类型"))
+    {
+        for (int slot = 1; slot < AGING_TYPE_SLOTS; slot++)
+        {
+            if (matrix->by_type[slot].bill_count == 0)
+            {
+                continue;
+            }
+            AgingCell row[AGING_MAX_BUCKETS] = {{0}};
+            for (int building = 0; building < matrix->building_count; building++)
+            {
+                for (int b = 0; b < matrix->bucket_count; b++)
+                {
+                    row[b].amount += AGING_CELL(matrix, building, slot, b).amount;
+                }
+            }
+            add_bucket_row(&table, matrix, FEE_TYPE_NAMES[slot], row, &matrix->by_type[slot]);
+        }
+        add_bucket_row(&table, matrix, "合计", matrix->by_bucket, &matrix->total);
+        table_end(&table);
+    }
+    printf("\n");
+
+    printf("【楼宇 x 账龄】\n");
+    if (begin_bucket_table(&table, columns, matrix, "楼宇"))
+    {
+        for (int building = 0; building < matrix->building_count; building++)
+        {
+            AgingCell row[AGING_MAX_BUCKETS] = {{0}};
+            AgingCell total = {0};
+            for (int slot = 1; slot < AGING_TYPE_SLOTS; slot++)
+            {
+                for (int b = 0; b < matrix->bucket_count; b++)
+                {
+                    const AgingCell *cell = &AGING_CELL(matrix, building, slot, b);
+                    row[b].amount += cell->amount;
+                    total.bill_count += cell->bill_count;
+                    total.amount += cell->amount;
+                }
+            }
+            if (total.bill_count > 0)
+            {
+                add_bucket_row(&table, matrix, matrix->building_names[building], row, &total);
+            }
+        }
+        add_bucket_row(&table, matrix, "合计", matrix->by_bucket, &matrix->total);
+        table_end(&table);
+    }
+
+    printf("\n共%ld笔未缴账单，读取%.3f秒，分档%.3f毫秒\n",
+           matrix->row_count, matrix->load_seconds, matrix->bucket_seconds * 1000);
+}
+
+/**
+ * @brief 释放账龄矩阵
+ *
+ * @param matrix 账龄矩阵
+ */
+void free_aging_matrix(AgingMatrix *matrix)
+{
+    free(matrix->building_names);
+    free(matrix->cells);
+    matrix->building_names = NULL;
+    matrix->cells = NULL;
+}
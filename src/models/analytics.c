@@ -0,0 +1,252 @@
+#include "models/analytics.h"
+#include "utils/arrow.h"
+#include "utils/file_ops.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define ANALYTICS_MAX_COLUMNS 16
+
+// 导出列：expr为取值的SQL表达式，NULL表示与列名相同
+typedef struct
+{
+    const char *name;
+    ArrowType type;
+    const char *expr;
+} AnalyticsColumn;
+
+typedef struct
+{
+    const char *table;
+    const AnalyticsColumn *columns;
+    int column_count;
+} AnalyticsTable;
+
+// 外键和取值较少的字符串列用字典编码；未缴账单的缴费日期（0）导出为空值
+static const AnalyticsColumn TRANSACTION_COLUMNS[] = {
+    {"transaction_id", ARROW_UTF8, NULL},
+    {"user_id", ARROW_DICTIONARY, NULL},
+    {"room_id", ARROW_DICTIONARY, "NULLIF(room_id, '')"},
+    {"parking_id", ARROW_DICTIONARY, "NULLIF(parking_id, '')"},
+    {"fee_type", ARROW_INT32, NULL},
+    {"amount", ARROW_FLOAT64, NULL},
+    {"payment_date", ARROW_TIMESTAMP, "NULLIF(payment_date, 0)"},
+    {"due_date", ARROW_TIMESTAMP, NULL},
+    {"payment_method", ARROW_INT32, NULL},
+    {"status", ARROW_INT32, NULL},
+    {"period_start", ARROW_TIMESTAMP, NULL},
+    {"period_end", ARROW_TIMESTAMP, NULL},
+};
+
+static const AnalyticsColumn ROOM_COLUMNS[] = {
+    {"room_id", ARROW_UTF8, NULL},
+    {"building_id", ARROW_DICTIONARY, NULL},
+    {"room_number", ARROW_UTF8, NULL},
+    {"floor", ARROW_INT32, NULL},
+    {"area_sqm", ARROW_FLOAT64, NULL},
+    {"owner_id", ARROW_DICTIONARY, "NULLIF(owner_id, '')"},
+    {"status", ARROW_INT32, NULL},
+};
+
+// 不导出密码哈希
+static const AnalyticsColumn USER_COLUMNS[] = {
+    {"user_id", ARROW_UTF8, NULL},
+    {"username", ARROW_UTF8, NULL},
+    {"name", ARROW_UTF8, NULL},
+    {"phone_number", ARROW_UTF8, NULL},
+    {"email", ARROW_UTF8, NULL},
+    {"role_id", ARROW_DICTIONARY, NULL},
+    {"status", ARROW_INT32, NULL},
+    {"registration_date", ARROW_TIMESTAMP, NULL},
+};
+
+static const AnalyticsColumn BUILDING_COLUMNS[] = {
+    {"building_id", ARROW_UTF8, NULL},
+    {"building_name", ARROW_UTF8, NULL},
+    {"address", ARROW_UTF8, NULL},
+    {"floors_count", ARROW_INT32, NULL},
+};
+
+#define TABLE_ENTRY(name, columns) {name, columns, (int)(sizeof(columns) / sizeof(columns[0]))}
+
+static const AnalyticsTable ANALYTICS_TABLES[ANALYTICS_TABLE_COUNT] = {
+    TABLE_ENTRY("transactions", TRANSACTION_COLUMNS),
+    TABLE_ENTRY("rooms", ROOM_COLUMNS),
+    TABLE_ENTRY("users", USER_COLUMNS),
+    TABLE_ENTRY("buildings", BUILDING_COLUMNS),
+};
+
+static const char *column_expr(const AnalyticsColumn *column)
+{
+    return column->expr ? column->expr : column->name;
+}
+
+/**
+ * 登记字典编码列的全部取值，字典按值排序
+ */
+static bool load_dictionary(Database *db, const AnalyticsTable *spec, int field, ArrowWriter *writer)
+{
+    const char *expr = column_expr(&spec->columns[field]);
+    char sql[256];
+    snprintf(sql, sizeof(sql), "SELECT DISTINCT %s AS v FROM %s WHERE v IS NOT NULL ORDER BY v", expr, spec->table);
+
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(db->db, sql, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "准备字典查询失败: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+    int rc;
+    bool ok = true;
+    while (ok && (rc = sqlite3_step(stmt)) == SQLITE_ROW)
+    {
+        const char *value = (const char *)sqlite3_column_text(stmt, 0);
+        ok = arrow_dictionary_add(writer, field, value, sqlite3_column_bytes(stmt, 0));
+    }
+    sqlite3_finalize(stmt);
+    return ok && rc == SQLITE_DONE;
+}
+
+/**
+ * 把一个表写成Arrow文件：先写到临时文件，完成后改名，读取方不会看到写了一半的文件
+ */
+static bool export_table(Database *db, const AnalyticsTable *spec, const char *out_dir, AnalyticsTableSummary *result)
+{
+    char path[512], temp_path[520];
+    snprintf(path, sizeof(path), "%s/%s.arrow", out_dir, spec->table);
+    snprintf(temp_path, sizeof(temp_path), "%s.tmp", path);
+
+    ArrowField fields[ANALYTICS_MAX_COLUMNS];
+    char sql[1024];
+    size_t len = snprintf(sql, sizeof(sql), "SELECT ");
+    for (int i = 0; i < spec->column_count; i++)
+    {
+        fields[i].name = spec->columns[i].name;
+        fields[i].type = spec->columns[i].type;
+        len += snprintf(sql + len, sizeof(sql) - len, "%s%s", i > 0 ? ", " : "", column_expr(&spec->columns[i]));
+    }
+    snprintf(sql + len, sizeof(sql) - len, " FROM %s", spec->table);
+
+    ArrowWriter writer;
+    if (!arrow_writer_open(&writer, temp_path, fields, spec->column_count))
+    {
+        return false;
+    }
+
+    bool ok = true;
+    for (int i = 0; ok && i < spec->column_count; i++)
+    {
+        if (spec->columns[i].type == ARROW_DICTIONARY)
+        {
+            ok = load_dictionary(db, spec, i, &writer);
+        }
+    }
+
+    sqlite3_stmt *stmt = NULL;
+    if (ok && sqlite3_prepare_v2(db->db, sql, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "准备导出查询失败: %s\n", sqlite3_errmsg(db->db));
+        ok = false;
+    }
+    int rc = SQLITE_DONE;
+    while (ok && (rc = sqlite3_step(stmt)) == SQLITE_ROW)
+    {
+        for (int i = 0; i < spec->column_count; i++)
+        {
+            if (sqlite3_column_type(stmt, i) == SQLITE_NULL)
+            {
+                arrow_append_null(&writer, i);
+                continue;
+            }
+            switch (fields[i].type)
+            {
+            case ARROW_FLOAT64:
+                arrow_append_double(&writer, i, sqlite3_column_double(stmt, i));
+                break;
+            case ARROW_UTF8:
+            case ARROW_DICTIONARY:
+            {
+                const char *text = (const char *)sqlite3_column_text(stmt, i);
+                arrow_append_string(&writer, i, text, sqlite3_column_bytes(stmt, i));
+                break;
+            }
+            default:
+                arrow_append_int(&writer, i, sqlite3_column_int64(stmt, i));
+                break;
+            }
+        }
+        ok = arrow_end_row(&writer);
+    }
+    if (ok && rc != SQLITE_DONE)
+    {
+        fprintf(stderr, "读取%s失败: %s\n", spec->table, sqlite3_errmsg(db->db));
+        ok = false;
+    }
+    sqlite3_finalize(stmt);
+
+    result->table = spec->table;
+    result->rows = writer.total_rows;
+    ok = arrow_writer_close(&writer) && ok;
+    result->bytes = writer.offset;
+    if (!ok || rename(temp_path, path) != 0)
+    {
+        fprintf(stderr, "写入%s失败\n", path);
+        remove(temp_path);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * 导出分析快照
+ *
+ * 四个表在同一个读事务内读取（WAL模式下即同一快照），导出期间其他连接的写入
+ * 不会出现在结果中。每个表一个Arrow IPC文件，字符串外键为字典编码，
+ * 分析工具可以直接内存映射各列。
+ *
+ * @param db 数据库连接
+ * @param out_dir 输出目录，不存在时自动创建
+ * @param summary 输出参数，导出结果
+ * @return 全部表导出成功返回true
+ */
+bool export_analytics_snapshot(Database *db, const char *out_dir, AnalyticsSnapshotSummary *summary)
+{
+    struct timespec started, finished;
+    clock_gettime(CLOCK_MONOTONIC, &started);
+    memset(summary, 0, sizeof(AnalyticsSnapshotSummary));
+
+    if (!create_directory(out_dir))
+    {
+        printf("无法创建输出目录: %s\n", out_dir);
+        return false;
+    }
+
+    // BEGIN是延迟事务，先读一次以固定快照
+    bool own_transaction = sqlite3_get_autocommit(db->db);
+    if (own_transaction && (sqlite3_exec(db->db, "BEGIN", 0, 0, 0) != SQLITE_OK ||
+                            sqlite3_exec(db->db, "SELECT COUNT(*) FROM sqlite_master", 0, 0, 0) != SQLITE_OK))
+    {
+        fprintf(stderr, "开始读事务失败: %s\n", sqlite3_errmsg(db->db));
+        sqlite3_exec(db->db, "ROLLBACK", 0, 0, 0);
+        return false;
+    }
+
+    bool ok = true;
+    for (int i = 0; ok && i < ANALYTICS_TABLE_COUNT; i++)
+    {
+        AnalyticsTableSummary *result = &summary->tables[i];
+        ok = export_table(db, &ANALYTICS_TABLES[i], out_dir, result);
+        summary->table_count++;
+        summary->total_bytes += result->bytes;
+    }
+
+    if (own_transaction)
+    {
+        sqlite3_exec(db->db, "COMMIT", 0, 0, 0);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &finished);
+    summary->elapsed_seconds = (finished.tv_sec - started.tv_sec) + (finished.tv_nsec - started.tv_nsec) / 1e9;
+    return ok;
+}
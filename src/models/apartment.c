@@ -364,3 +364,127 @@ bool get_owner_rooms(Database *db, const char *user_id, UserType user_type, cons
     log_info("成功查询业主 %s 的房屋列表，共 %d 条记录", owner_id, result->row_count);
     return true;
 }
+
+/**
+ * 变更房屋业主
+ *
+ * 更新rooms.owner_id，由触发器结束原业主的持有期并开始新业主的持有期，
+ * 再将两段持有期的分界调整为过户生效日期，出账时据此按持有天数拆分费用。
+ *
+ * @param db 数据库连接
+ * @param room_id 房屋ID
+ * @param owner_id 新业主ID，NULL或空串表示业主迁出、房屋空置
+ * @param effective_date 过户生效日期，不能早于原业主的入住日期
+ * @return 操作成功返回true，失败返回false
+ */
+bool transfer_room_owner(Database *db, const char *room_id, const char *owner_id, time_t effective_date)
+{
+    const char *current_query =
+        "SELECT r.owner_id, o.occupancy_id, o.start_day FROM rooms r "
+        "LEFT JOIN room_occupancy o ON o.room_id = r.room_id AND o.end_day IS NULL "
+        "WHERE r.room_id = ?";
+    const char *update_room_query = "UPDATE rooms SET owner_id = ?, status = ? WHERE room_id = ?";
+    const char *close_query = "UPDATE room_occupancy SET end_day = ? WHERE occupancy_id = ?";
+    const char *open_query = "UPDATE room_occupancy SET start_day = ? WHERE room_id = ? AND end_day IS NULL";
+
+    if (owner_id && owner_id[0] == '\0')
+    {
+        owner_id = NULL;
+    }
+    long effective_day = local_day_number(effective_date);
+
+    bool own_transaction = sqlite3_get_autocommit(db->db);
+    if (own_transaction && sqlite3_exec(db->db, "BEGIN IMMEDIATE", 0, 0, 0) != SQLITE_OK)
+    {
+        log_error("无法开始事务: %s", sqlite3_errmsg(db->db));
+        return false;
+    }
+
+    bool success = false;
+    bool rejected = false; // 参数校验未通过（已提示原因）
+    sqlite3_stmt *stmt = NULL;
+    sqlite3_int64 previous_id = 0;
+
+    do
+    {
+        if (sqlite3_prepare_v2(db->db, current_query, -1, &stmt, NULL) != SQLITE_OK)
+            break;
+        sqlite3_bind_text(stmt, 1, room_id, -1, SQLITE_STATIC);
+        if (sqlite3_step(stmt) != SQLITE_ROW)
+        {
+            log_error("房间 ID %s 不存在", room_id);
+            rejected = true;
+            break;
+        }
+
+        const char *current_owner = (const char *)sqlite3_column_text(stmt, 0);
+        if (current_owner && current_owner[0] == '\0')
+        {
+            current_owner = NULL;
+        }
+        if ((!current_owner && !owner_id) || (current_owner && owner_id && strcmp(current_owner, owner_id) == 0))
+        {
+            success = true; // 业主未变化
+            break;
+        }
+        if (sqlite3_column_type(stmt, 1) != SQLITE_NULL)
+        {
+            previous_id = sqlite3_column_int64(stmt, 1);
+            if (effective_day < sqlite3_column_int64(stmt, 2))
+            {
+                log_error("过户日期早于当前业主的入住日期");
+                rejected = true;
+                break;
+            }
+        }
+        sqlite3_finalize(stmt);
+        stmt = NULL;
+
+        if (sqlite3_prepare_v2(db->db, update_room_query, -1, &stmt, NULL) != SQLITE_OK)
+            break;
+        if (owner_id)
+            sqlite3_bind_text(stmt, 1, owner_id, -1, SQLITE_STATIC);
+        else
+            sqlite3_bind_null(stmt, 1);
+        sqlite3_bind_int(stmt, 2, owner_id ? 1 : 0);
+        sqlite3_bind_text(stmt, 3, room_id, -1, SQLITE_STATIC);
+        if (sqlite3_step(stmt) != SQLITE_DONE)
+            break;
+        sqlite3_finalize(stmt);
+        stmt = NULL;
+
+        if (previous_id)
+        {
+            if (sqlite3_prepare_v2(db->db, close_query, -1, &stmt, NULL) != SQLITE_OK)
+                break;
+            sqlite3_bind_int64(stmt, 1, effective_day);
+            sqlite3_bind_int64(stmt, 2, previous_id);
+            if (sqlite3_step(stmt) != SQLITE_DONE)
+                break;
+            sqlite3_finalize(stmt);
+            stmt = NULL;
+        }
+
+        if (sqlite3_prepare_v2(db->db, open_query, -1, &stmt, NULL) != SQLITE_OK)
+            break;
+        sqlite3_bind_int64(stmt, 1, effective_day);
+        sqlite3_bind_text(stmt, 2, room_id, -1, SQLITE_STATIC);
+        success = sqlite3_step(stmt) == SQLITE_DONE;
+    } while (0);
+
+    if (!success && !rejected)
+    {
+        log_error("变更房屋业主失败: %s", sqlite3_errmsg(db->db));
+    }
+    sqlite3_finalize(stmt);
+
+    if (own_transaction)
+    {
+        sqlite3_exec(db->db, success ? "COMMIT" : "ROLLBACK", 0, 0, 0);
+    }
+    if (success)
+    {
+        log_info("房屋 %s 已过户给 %s", room_id, owner_id ? owner_id : "（空置）");
+    }
+    return success;
+}
@@ -0,0 +1,614 @@
+#include "models/billing.h"
+#include "utils/hash_map.h"
+#include "utils/utils.h"
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 账单明细：按持有期与账期的重叠天数拆分房屋费用，同一业主在账期内的多段持有期合并为一张账单。
+// 持有期的起止日已存为天序号，重叠天数直接相减得到，无需逐房屋计算日期。
+// 参数: ?1 账期首日天序号  ?2 账期末日天序号  ?3 单价  ?4 费用类型  ?5 账期开始时间
+#define BILLING_LINE_ITEMS_SQL                                                                          \
+    "SELECT s.owner_id AS user_id, s.room_id AS room_id, r.building_id AS building_id, "                \
+    "SUM(s.days) AS days, ROUND(r.area_sqm * ?3 * SUM(s.days) / (?2 - ?1 + 1), 2) AS amount "           \
+    "FROM (SELECT owner_id, room_id, "                                                                  \
+    "      MIN(COALESCE(end_day, ?2 + 1), ?2 + 1) - MAX(start_day, ?1) AS days "                        \
+    "      FROM room_occupancy WHERE start_day <= ?2 AND (end_day IS NULL OR end_day > ?1)) s "         \
+    "JOIN rooms r ON r.room_id = s.room_id "                                                            \
+    "WHERE NOT EXISTS (SELECT 1 FROM transactions t WHERE t.room_id = s.room_id "                       \
+    "                  AND t.fee_type = ?4 AND t.period_start = ?5 AND t.user_id = s.owner_id) "        \
+    "GROUP BY s.owner_id, s.room_id HAVING amount > 0"
+
+// 出账汇总：账单数、总额和按天折算的账单数
+static const char *BILLING_SUMMARY_SQL =
+    "SELECT COUNT(*), TOTAL(amount), TOTAL(days < ?2 - ?1 + 1) FROM (" BILLING_LINE_ITEMS_SQL ")";
+
+// 出账预览：明细加上是否按天折算
+static const char *PREVIEW_BILLING_SQL =
+    "SELECT user_id, room_id, building_id, days, amount, days < ?2 - ?1 + 1 FROM (" BILLING_LINE_ITEMS_SQL ")";
+
+// 出账：一条语句写入全部账单明细，立方体楼宇直接取房屋所在楼宇
+// 参数: 同上，?6 账期结束时间  ?7 缴费截止日期
+static const char *RUN_BILLING_SQL =
+    "INSERT INTO transactions (transaction_id, user_id, room_id, fee_type, amount, "
+    "payment_date, due_date, status, period_start, period_end, cube_building_id) "
+    "SELECT LOWER(HEX(RANDOMBLOB(16))), user_id, room_id, ?4, amount, 0, ?7, 0, ?5, ?6, building_id "
+    "FROM (" BILLING_LINE_ITEMS_SQL ")";
+
+// 停车费明细：每个已售出且有业主的车位按整期单价一张账单，已出账的车位不重复生成。
+// 停车位不属于任何楼宇，预览中单独归为一组。
+// 参数: ?3 单价  ?4 费用类型  ?5 账期开始时间（?1、?2与房屋明细共用，此处不使用）
+#define PARKING_LINE_ITEMS_SQL                                                                          \
+    "SELECT p.owner_id AS user_id, p.parking_id AS parking_id, NULL AS building_id, 0 AS days, "        \
+    "ROUND(?3, 2) AS amount "                                                                           \
+    "FROM parking_spaces p "                                                                            \
+    "WHERE p.owner_id IS NOT NULL AND p.owner_id != '' AND p.status = 1 AND ?3 > 0 "                    \
+    "AND NOT EXISTS (SELECT 1 FROM transactions t WHERE t.parking_id = p.parking_id "                   \
+    "                AND t.fee_type = ?4 AND t.period_start = ?5 AND t.user_id = p.owner_id)"
+
+static const char *PARKING_SUMMARY_SQL =
+    "SELECT COUNT(*), TOTAL(amount), 0 FROM (" PARKING_LINE_ITEMS_SQL ")";
+
+static const char *PREVIEW_PARKING_SQL =
+    "SELECT user_id, parking_id, building_id, days, amount, 0 FROM (" PARKING_LINE_ITEMS_SQL ")";
+
+static const char *RUN_PARKING_SQL =
+    "INSERT INTO transactions (transaction_id, user_id, parking_id, fee_type, amount, "
+    "payment_date, due_date, status, period_start, period_end) "
+    "SELECT LOWER(HEX(RANDOMBLOB(16))), user_id, parking_id, ?4, amount, 0, ?7, 0, ?5, ?6 "
+    "FROM (" PARKING_LINE_ITEMS_SQL ")";
+
+static pthread_mutex_t billing_mutex;
+static pthread_once_t billing_mutex_once = PTHREAD_ONCE_INIT;
+
+static void init_billing_mutex(void)
+{
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&billing_mutex, &attr);
+    pthread_mutexattr_destroy(&attr);
+}
+
+/**
+ * 获取出账互斥锁
+ *
+ * 可重入：持有锁的线程可以再调用出账、计提等同样加锁的函数
+ */
+void billing_lock(void)
+{
+    pthread_once(&billing_mutex_once, init_billing_mutex);
+    pthread_mutex_lock(&billing_mutex);
+}
+
+/**
+ * 尝试获取出账互斥锁
+ *
+ * @return 获取成功返回true，锁被其他线程持有时立即返回false
+ */
+bool billing_trylock(void)
+{
+    pthread_once(&billing_mutex_once, init_billing_mutex);
+    return pthread_mutex_trylock(&billing_mutex) == 0;
+}
+
+/**
+ * 释放出账互斥锁
+ */
+void billing_unlock(void)
+{
+    pthread_mutex_unlock(&billing_mutex);
+}
+
+/**
+ * 获取费用单价
+ *
+ * @param db 数据库连接
+ * @param fee_type 费用类型
+ * @param as_of 生效日期
+ * @param rate 输出参数，单价
+ * @return 找到有效单价返回true，否则返回false
+ */
+bool get_billing_rate(Database *db, int fee_type, time_t as_of, double *rate)
+{
+    const char *query =
+        "SELECT price_per_unit FROM fee_standards "
+        "WHERE fee_type = ? AND effective_date <= ? AND (end_date = 0 OR end_date >= ?) "
+        "ORDER BY effective_date DESC LIMIT 1";
+    sqlite3_stmt *stmt;
+
+    if (sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "查询费用标准失败: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+    sqlite3_bind_int(stmt, 1, fee_type);
+    sqlite3_bind_int64(stmt, 2, as_of);
+    sqlite3_bind_int64(stmt, 3, as_of);
+
+    bool found = false;
+    if (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        *rate = sqlite3_column_double(stmt, 0);
+        found = *rate > 0;
+    }
+    sqlite3_finalize(stmt);
+    return found;
+}
+
+/**
+ * 绑定账单明细查询的公共参数
+ */
+static void bind_billing_run(sqlite3_stmt *stmt, const BillingRun *run)
+{
+    sqlite3_bind_int64(stmt, 1, local_day_number(run->period_start));
+    sqlite3_bind_int64(stmt, 2, local_day_number(run->period_end));
+    sqlite3_bind_double(stmt, 3, run->rate);
+    sqlite3_bind_int(stmt, 4, run->fee_type);
+    sqlite3_bind_int64(stmt, 5, run->period_start);
+}
+
+/**
+ * 出账：在同一事务内先按汇总查询统计，再用INSERT...SELECT写入全部明细
+ */
+static bool run_billing_locked(Database *db, const BillingRun *run, const char *summary_sql, const char *insert_sql,
+                               BillingSummary *summary)
+{
+    memset(summary, 0, sizeof(BillingSummary));
+
+    if (local_day_number(run->period_end) < local_day_number(run->period_start))
+    {
+        printf("账期结束日期早于开始日期\n");
+        return false;
+    }
+
+    bool own_transaction = sqlite3_get_autocommit(db->db);
+    if (own_transaction && sqlite3_exec(db->db, "BEGIN IMMEDIATE", 0, 0, 0) != SQLITE_OK)
+    {
+        fprintf(stderr, "无法开始事务: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+
+    // 先在同一事务内汇总待出账明细，再一次写入，两者看到的数据一致
+    sqlite3_stmt *stmt = NULL;
+    bool success = false;
+    do
+    {
+        if (sqlite3_prepare_v2(db->db, summary_sql, -1, &stmt, NULL) != SQLITE_OK)
+            break;
+        bind_billing_run(stmt, run);
+        if (sqlite3_step(stmt) != SQLITE_ROW)
+            break;
+        summary->bill_count = sqlite3_column_int(stmt, 0);
+        summary->total_amount = sqlite3_column_double(stmt, 1);
+        summary->prorated_count = sqlite3_column_int(stmt, 2);
+        sqlite3_finalize(stmt);
+        stmt = NULL;
+
+        if (sqlite3_prepare_v2(db->db, insert_sql, -1, &stmt, NULL) != SQLITE_OK)
+            break;
+        bind_billing_run(stmt, run);
+        sqlite3_bind_int64(stmt, 6, run->period_end);
+        sqlite3_bind_int64(stmt, 7, run->due_date);
+        success = sqlite3_step(stmt) == SQLITE_DONE && sqlite3_changes(db->db) == summary->bill_count;
+    } while (0);
+    sqlite3_finalize(stmt);
+
+    if (!success)
+    {
+        fprintf(stderr, "出账失败: %s\n", sqlite3_errmsg(db->db));
+        if (own_transaction)
+        {
+            sqlite3_exec(db->db, "ROLLBACK", 0, 0, 0);
+        }
+        memset(summary, 0, sizeof(BillingSummary));
+        return false;
+    }
+
+    if (own_transaction && sqlite3_exec(db->db, "COMMIT", 0, 0, 0) != SQLITE_OK)
+    {
+        fprintf(stderr, "提交出账失败: %s\n", sqlite3_errmsg(db->db));
+        sqlite3_exec(db->db, "ROLLBACK", 0, 0, 0);
+        memset(summary, 0, sizeof(BillingSummary));
+        return false;
+    }
+    return true;
+}
+
+/**
+ * 按房屋持有期出账
+ *
+ * 以room_occupancy为源，一条INSERT...SELECT为账期内持有过房屋的每位业主生成一张账单，
+ * 金额 = 面积 × 单价 × 持有天数 / 账期天数。账期内没有业主变更的房屋即为整期金额。
+ * 已存在同一业主、房屋、费用类型和账期的账单不会重复生成。出账期间持有出账互斥锁。
+ *
+ * @param db 数据库连接
+ * @param run 出账参数
+ * @param summary 输出参数，出账结果
+ * @return 成功返回true，失败返回false（已回滚，不会部分出账）
+ */
+bool run_room_billing(Database *db, const BillingRun *run, BillingSummary *summary)
+{
+    billing_lock();
+    bool ok = run_billing_locked(db, run, BILLING_SUMMARY_SQL, RUN_BILLING_SQL, summary);
+    billing_unlock();
+    return ok;
+}
+
+/**
+ * 按明细查询生成预览
+ */
+static bool preview_billing(Database *db, const BillingRun *run, const char *line_items_sql, int top_n,
+                            BillingPreview *preview)
+{
+    memset(preview, 0, sizeof(BillingPreview));
+
+    if (local_day_number(run->period_end) < local_day_number(run->period_start))
+    {
+        printf("账期结束日期早于开始日期\n");
+        return false;
+    }
+
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(db->db, line_items_sql, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "准备出账预览失败: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+    bind_billing_run(stmt, run);
+
+    bool ok = collect_billing_preview(db, stmt, top_n, preview);
+    sqlite3_finalize(stmt);
+    return ok;
+}
+
+/**
+ * 预览出账结果
+ *
+ * 使用与run_room_billing相同的明细查询，结果只在内存中汇总，不写入数据库
+ *
+ * @param db 数据库连接
+ * @param run 出账参数
+ * @param top_n 列出金额最大的账单数
+ * @param preview 输出参数，使用后调用free_billing_preview释放
+ * @return 成功返回true，失败返回false
+ */
+bool preview_room_billing(Database *db, const BillingRun *run, int top_n, BillingPreview *preview)
+{
+    return preview_billing(db, run, PREVIEW_BILLING_SQL, top_n, preview);
+}
+
+/**
+ * 停车费出账
+ *
+ * 每个已售出且有业主的停车位按单价生成一张整期账单，同一业主、车位和账期已出账的不重复生成，
+ * 全部账单由一条INSERT...SELECT在一个事务内写入。出账期间持有出账互斥锁。
+ *
+ * @param db 数据库连接
+ * @param run 出账参数，rate为每个车位整个账期的费用
+ * @param summary 输出参数，出账结果
+ * @return 成功返回true，失败返回false（已回滚，不会部分出账）
+ */
+bool run_parking_billing(Database *db, const BillingRun *run, BillingSummary *summary)
+{
+    billing_lock();
+    bool ok = run_billing_locked(db, run, PARKING_SUMMARY_SQL, RUN_PARKING_SQL, summary);
+    billing_unlock();
+    return ok;
+}
+
+/**
+ * 预览停车费出账结果
+ *
+ * 使用与run_parking_billing相同的明细查询，结果只在内存中汇总，不写入数据库
+ *
+ * @param db 数据库连接
+ * @param run 出账参数
+ * @param top_n 列出金额最大的账单数
+ * @param preview 输出参数，使用后调用free_billing_preview释放
+ * @return 成功返回true，失败返回false
+ */
+bool preview_parking_billing(Database *db, const BillingRun *run, int top_n, BillingPreview *preview)
+{
+    return preview_billing(db, run, PREVIEW_PARKING_SQL, top_n, preview);
+}
+
+/**
+ * 小顶堆下沉，堆顶为当前入选账单中金额最小的一张
+ */
+static void sift_down(BillingPreviewItem *heap, int count, int i)
+{
+    for (;;)
+    {
+        int smallest = i;
+        int left = 2 * i + 1;
+        int right = left + 1;
+        if (left < count && heap[left].amount < heap[smallest].amount)
+            smallest = left;
+        if (right < count && heap[right].amount < heap[smallest].amount)
+            smallest = right;
+        if (smallest == i)
+            return;
+        BillingPreviewItem tmp = heap[i];
+        heap[i] = heap[smallest];
+        heap[smallest] = tmp;
+        i = smallest;
+    }
+}
+
+/**
+ * 小顶堆上浮
+ */
+static void sift_up(BillingPreviewItem *heap, int i)
+{
+    while (i > 0)
+    {
+        int parent = (i - 1) / 2;
+        if (heap[parent].amount <= heap[i].amount)
+            return;
+        BillingPreviewItem tmp = heap[i];
+        heap[i] = heap[parent];
+        heap[parent] = tmp;
+        i = parent;
+    }
+}
+
+static int compare_building_name(const void *a, const void *b)
+{
+    return strcmp(((const BillingBuildingTotal *)a)->building_name, ((const BillingBuildingTotal *)b)->building_name);
+}
+
+static int compare_amount_desc(const void *a, const void *b)
+{
+    double x = ((const BillingPreviewItem *)a)->amount;
+    double y = ((const BillingPreviewItem *)b)->amount;
+    return (x < y) - (x > y);
+}
+
+/**
+ * 复制查询结果中的文本列
+ */
+static void copy_column_text(sqlite3_stmt *stmt, int column, char *dest, size_t size)
+{
+    const char *text = (const char *)sqlite3_column_text(stmt, column);
+    strncpy(dest, text ? text : "", size - 1);
+    dest[size - 1] = '\0';
+}
+
+/**
+ * 补全楼宇名称和入选账单的业主、房号
+ */
+static bool fill_preview_names(Database *db, BillingPreview *preview)
+{
+    sqlite3_stmt *stmt;
+
+    if (sqlite3_prepare_v2(db->db, "SELECT building_name FROM buildings WHERE building_id = ?", -1, &stmt, NULL) != SQLITE_OK)
+        return false;
+    for (int i = 0; i < preview->building_count; i++)
+    {
+        BillingBuildingTotal *building = &preview->buildings[i];
+        sqlite3_bind_text(stmt, 1, building->building_id, -1, SQLITE_STATIC);
+        if (sqlite3_step(stmt) == SQLITE_ROW)
+            copy_column_text(stmt, 0, building->building_name, sizeof(building->building_name));
+        else
+            strcpy(building->building_name, building->building_id[0] ? building->building_id : "未关联楼宇");
+        sqlite3_reset(stmt);
+    }
+    sqlite3_finalize(stmt);
+
+    if (sqlite3_prepare_v2(db->db,
+                           "SELECT (SELECT name FROM users WHERE user_id = ?1), "
+                           "COALESCE(r.room_number, (SELECT parking_number FROM parking_spaces WHERE parking_id = ?2)), "
+                           "b.building_name FROM (SELECT 1) "
+                           "LEFT JOIN rooms r ON r.room_id = ?2 "
+                           "LEFT JOIN buildings b ON b.building_id = r.building_id",
+                           -1, &stmt, NULL) != SQLITE_OK)
+        return false;
+    for (int i = 0; i < preview->top_count; i++)
+    {
+        BillingPreviewItem *item = &preview->top_items[i];
+        sqlite3_bind_text(stmt, 1, item->user_id, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 2, item->room_id, -1, SQLITE_STATIC);
+        if (sqlite3_step(stmt) == SQLITE_ROW)
+        {
+            copy_column_text(stmt, 0, item->owner_name, sizeof(item->owner_name));
+            copy_column_text(stmt, 1, item->room_number, sizeof(item->room_number));
+            copy_column_text(stmt, 2, item->building_name, sizeof(item->building_name));
+        }
+        sqlite3_reset(stmt);
+    }
+    sqlite3_finalize(stmt);
+    return true;
+}
+
+/**
+ * 汇总账单明细生成预览
+ *
+ * 在一个只读事务内逐行读取明细：按楼宇累加到哈希表，并用大小为top_n的小顶堆保留
+ * 金额最大的账单，内存占用与账单总数无关。读取期间的快照保证汇总与明细一致。
+ *
+ * @param db 数据库连接
+ * @param line_items 已绑定参数的明细查询，列依次为user_id, room_id, building_id, days, amount, prorated
+ * @param top_n 保留金额最大的账单数
+ * @param preview 输出参数，使用后调用free_billing_preview释放
+ * @return 成功返回true，失败返回false
+ */
+bool collect_billing_preview(Database *db, sqlite3_stmt *line_items, int top_n, BillingPreview *preview)
+{
+    struct timespec started, finished;
+    clock_gettime(CLOCK_MONOTONIC, &started);
+    memset(preview, 0, sizeof(BillingPreview));
+
+    HashMap building_index;
+    if (!hash_map_init(&building_index, 64))
+    {
+        return false;
+    }
+    int building_cap = 0;
+    if (top_n > 0)
+    {
+        preview->top_items = calloc(top_n, sizeof(BillingPreviewItem));
+        if (!preview->top_items)
+        {
+            hash_map_free(&building_index);
+            return false;
+        }
+    }
+
+    bool own_transaction = sqlite3_get_autocommit(db->db);
+    if (own_transaction)
+    {
+        sqlite3_exec(db->db, "BEGIN", 0, 0, 0);
+    }
+
+    bool ok = true;
+    int rc;
+    while ((rc = sqlite3_step(line_items)) == SQLITE_ROW)
+    {
+        double amount = sqlite3_column_double(line_items, 4);
+        int prorated = sqlite3_column_int(line_items, 5);
+        preview->summary.bill_count++;
+        preview->summary.prorated_count += prorated;
+        preview->summary.total_amount += amount;
+
+        // 按楼宇累加
+        const char *building_id = (const char *)sqlite3_column_text(line_items, 2);
+        if (!building_id)
+            building_id = "";
+        size_t key_len = strlen(building_id);
+        intptr_t slot = (intptr_t)hash_map_get(&building_index, building_id, key_len);
+        if (slot == 0)
+        {
+            if (preview->building_count == building_cap)
+            {
+                int cap = building_cap ? building_cap * 2 : 16;
+                BillingBuildingTotal *buildings = realloc(preview->buildings, cap * sizeof(BillingBuildingTotal));
+                if (!buildings)
+                {
+                    ok = false;
+                    break;
+                }
+                preview->buildings = buildings;
+                building_cap = cap;
+            }
+            BillingBuildingTotal *building = &preview->buildings[preview->building_count];
+            memset(building, 0, sizeof(BillingBuildingTotal));
+            strncpy(building->building_id, building_id, sizeof(building->building_id) - 1);
+            slot = ++preview->building_count;
+            if (!hash_map_put(&building_index, building_id, key_len, (void *)slot))
+            {
+                ok = false;
+                break;
+            }
+        }
+        BillingBuildingTotal *building = &preview->buildings[slot - 1];
+        building->bill_count++;
+        building->prorated_count += prorated;
+        building->total_amount += amount;
+
+        // 保留金额最大的top_n张账单
+        if (top_n <= 0 || (preview->top_count == top_n && amount <= preview->top_items[0].amount))
+            continue;
+
+        BillingPreviewItem item;
+        memset(&item, 0, sizeof(item));
+        copy_column_text(line_items, 0, item.user_id, sizeof(item.user_id));
+        copy_column_text(line_items, 1, item.room_id, sizeof(item.room_id));
+        item.days = sqlite3_column_int(line_items, 3);
+        item.amount = amount;
+        if (preview->top_count < top_n)
+        {
+            preview->top_items[preview->top_count] = item;
+            sift_up(preview->top_items, preview->top_count++);
+        }
+        else
+        {
+            preview->top_items[0] = item;
+            sift_down(preview->top_items, preview->top_count, 0);
+        }
+    }
+
+    if (ok && rc != SQLITE_DONE)
+    {
+        fprintf(stderr, "出账预览失败: %s\n", sqlite3_errmsg(db->db));
+        ok = false;
+    }
+    if (ok)
+    {
+        ok = fill_preview_names(db, preview);
+    }
+    if (own_transaction)
+    {
+        sqlite3_exec(db->db, "COMMIT", 0, 0, 0);
+    }
+    hash_map_free(&building_index);
+
+    if (!ok)
+    {
+        free_billing_preview(preview);
+        return false;
+    }
+
+    qsort(preview->buildings, preview->building_count, sizeof(BillingBuildingTotal), compare_building_name);
+    qsort(preview->top_items, preview->top_count, sizeof(BillingPreviewItem), compare_amount_desc);
+
+    clock_gettime(CLOCK_MONOTONIC, &finished);
+    preview->elapsed_seconds = (finished.tv_sec - started.tv_sec) + (finished.tv_nsec - started.tv_nsec) / 1e9;
+    return true;
+}
+
+/**
+ * 打印出账预览
+ *
+ * @param preview 预览结果
+ */
+void print_billing_preview(const BillingPreview *preview)
+{
+    printf("\n===== 出账预览（未写入任何数据） =====\n");
+    printf("账单数: %d  其中按天折算: %d  合计金额: %.2f 元\n",
+           preview->summary.bill_count, preview->summary.prorated_count, preview->summary.total_amount);
+
+    if (preview->building_count > 0)
+    {
+        printf("\n%-16s %-10s %-10s %-14s\n", "楼宇", "账单数", "按天折算", "金额");
+        printf("------------------------------------------------------\n");
+        for (int i = 0; i < preview->building_count; i++)
+        {
+            const BillingBuildingTotal *building = &preview->buildings[i];
+            printf("%-16s %-10d %-10d %-14.2f\n", building->building_name,
+                   building->bill_count, building->prorated_count, building->total_amount);
+        }
+    }
+
+    if (preview->top_count > 0)
+    {
+        printf("\n金额最大的 %d 张账单:\n", preview->top_count);
+        printf("%-16s %-10s %-16s %-8s %-12s\n", "业主", "楼宇", "房号", "天数", "金额");
+        printf("------------------------------------------------------------\n");
+        for (int i = 0; i < preview->top_count; i++)
+        {
+            const BillingPreviewItem *item = &preview->top_items[i];
+            printf("%-16s %-10s %-16s %-8d %-12.2f\n",
+                   item->owner_name[0] ? item->owner_name : item->user_id,
+                   item->building_name[0] ? item->building_name : "-",
+                   item->room_number[0] ? item->room_number : "-",
+                   item->days, item->amount);
+        }
+    }
+
+    printf("\n预览用时 %.3f 秒\n", preview->elapsed_seconds);
+}
+
+/**
+ * 释放出账预览
+ *
+ * @param preview 预览结果
+ */
+void free_billing_preview(BillingPreview *preview)
+{
+    free(preview->buildings);
+    free(preview->top_items);
+    memset(preview, 0, sizeof(BillingPreview));
+}
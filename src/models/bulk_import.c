@@ -0,0 +1,664 @@
+#include "models/bulk_import.h"
+#include "utils/csv.h"
+#include "utils/hash_map.h"
+#include "utils/pinyin.h"
+#include "utils/record_buffer.h"
+#include "utils/utils.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// 组合键的字段分隔符
+#define KEY_SEP '\x1f'
+
+// 已知用户，按用户名和用户ID两个键登记
+typedef struct
+{
+    char user_id[40];
+    bool owner;
+} KnownUser;
+
+// 已知楼宇，按楼宇ID和楼宇名称两个键登记
+typedef struct
+{
+    char building_id[40];
+} KnownBuilding;
+
+// 一次导入的状态：已有数据和本次已导入数据的内存索引，外键和唯一性校验只查这里
+typedef struct
+{
+    Database *db;
+    CsvWriter report;
+    HashMap users;
+    HashMap buildings;
+    HashMap rooms;   // 楼宇ID+房号
+    HashMap parking; // 车位号
+    RecordBuffer user_records;
+    RecordBuffer building_records;
+    char default_hash[80];
+} ImportContext;
+
+// 唯一性集合中的值
+static char present;
+
+static const char *USERNAME_HEADERS[] = {"username", "用户名", "账号", NULL};
+static const char *NAME_HEADERS[] = {"name", "姓名", NULL};
+static const char *PHONE_HEADERS[] = {"phone", "phone_number", "手机号", "电话", NULL};
+static const char *EMAIL_HEADERS[] = {"email", "邮箱", NULL};
+static const char *PASSWORD_HEADERS[] = {"password", "初始密码", "密码", NULL};
+static const char *BUILDING_HEADERS[] = {"building", "building_id", "building_name", "楼宇", "楼号", NULL};
+static const char *ROOM_NUMBER_HEADERS[] = {"room_number", "room", "房号", "房间号", NULL};
+static const char *FLOOR_HEADERS[] = {"floor", "楼层", NULL};
+static const char *AREA_HEADERS[] = {"area", "area_sqm", "面积", NULL};
+static const char *OWNER_HEADERS[] = {"owner", "owner_username", "业主", NULL};
+static const char *PARKING_NUMBER_HEADERS[] = {"parking_number", "parking", "车位号", NULL};
+
+/**
+ * 读取一列的值并就地去掉首尾空白，列不存在时返回空串
+ */
+static const char *column_value(const CsvReader *reader, int column)
+{
+    if (column < 0 || column >= reader->field_count)
+    {
+        return "";
+    }
+    char *value = reader->fields[column];
+    while (isspace((unsigned char)*value))
+    {
+        value++;
+    }
+    size_t len = strlen(value);
+    while (len > 0 && isspace((unsigned char)value[len - 1]))
+    {
+        value[--len] = '\0';
+    }
+    return value;
+}
+
+/**
+ * 写一条拒绝记录：文件、行号、原因，之后为原始字段
+ */
+static void reject_row(ImportContext *ctx, const char *file, const CsvReader *reader, const char *reason,
+                       ImportFileSummary *summary)
+{
+    char line[24];
+    snprintf(line, sizeof(line), "%ld", reader->line_no);
+    csv_write_field(&ctx->report, file);
+    csv_write_field(&ctx->report, line);
+    csv_write_field(&ctx->report, reason);
+    for (int i = 0; i < reader->field_count; i++)
+    {
+        csv_write_field(&ctx->report, reader->fields[i]);
+    }
+    csv_end_record(&ctx->report);
+    summary->rejected_count++;
+}
+
+static bool remember_user(ImportContext *ctx, const char *user_id, const char *username, bool owner)
+{
+    KnownUser *user = record_buffer_append(&ctx->user_records);
+    if (!user)
+    {
+        return false;
+    }
+    snprintf(user->user_id, sizeof(user->user_id), "%s", user_id);
+    user->owner = owner;
+    return hash_map_put(&ctx->users, user_id, strlen(user_id), user) &&
+           (!username || hash_map_put(&ctx->users, username, strlen(username), user));
+}
+
+static size_t room_key(char *key, size_t size, const char *building_id, const char *room_number)
+{
+    int len = snprintf(key, size, "%s%c%s", building_id, KEY_SEP, room_number);
+    return len < 0 ? 0 : ((size_t)len < size ? (size_t)len : size - 1);
+}
+
+/**
+ * 载入已有的用户、楼宇、房号和车位号
+ */
+static bool load_existing(ImportContext *ctx)
+{
+    sqlite3 *db = ctx->db->db;
+    sqlite3_stmt *stmt;
+    bool ok = true;
+    char key[160];
+
+    if (sqlite3_prepare_v2(db, "SELECT user_id, username, role_id = 'role_owner' FROM users", -1, &stmt, NULL) != SQLITE_OK)
+        return false;
+    while (ok && sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        ok = remember_user(ctx, (const char *)sqlite3_column_text(stmt, 0), (const char *)sqlite3_column_text(stmt, 1),
+                           sqlite3_column_int(stmt, 2));
+    }
+    sqlite3_finalize(stmt);
+
+    if (!ok || sqlite3_prepare_v2(db, "SELECT building_id, building_name FROM buildings", -1, &stmt, NULL) != SQLITE_OK)
+        return false;
+    while (ok && sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        KnownBuilding *building = record_buffer_append(&ctx->building_records);
+        const char *id = (const char *)sqlite3_column_text(stmt, 0);
+        const char *name = (const char *)sqlite3_column_text(stmt, 1);
+        ok = building != NULL;
+        if (ok)
+        {
+            snprintf(building->building_id, sizeof(building->building_id), "%s", id);
+            ok = hash_map_put(&ctx->buildings, id, strlen(id), building);
+        }
+        // 名称与其他楼宇的ID相同时以ID为准
+        if (ok && name && !hash_map_get(&ctx->buildings, name, strlen(name)))
+        {
+            ok = hash_map_put(&ctx->buildings, name, strlen(name), building);
+        }
+    }
+    sqlite3_finalize(stmt);
+
+    if (!ok || sqlite3_prepare_v2(db, "SELECT building_id, room_number FROM rooms", -1, &stmt, NULL) != SQLITE_OK)
+        return false;
+    while (ok && sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        size_t len = room_key(key, sizeof(key), (const char *)sqlite3_column_text(stmt, 0),
+                              (const char *)sqlite3_column_text(stmt, 1));
+        ok = hash_map_put(&ctx->rooms, key, len, &present);
+    }
+    sqlite3_finalize(stmt);
+
+    if (!ok || sqlite3_prepare_v2(db, "SELECT parking_number FROM parking_spaces", -1, &stmt, NULL) != SQLITE_OK)
+        return false;
+    while (ok && sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        const char *number = (const char *)sqlite3_column_text(stmt, 0);
+        ok = hash_map_put(&ctx->parking, number, strlen(number), &present);
+    }
+    sqlite3_finalize(stmt);
+    return ok;
+}
+
+/**
+ * 打开导入文件并读取表头
+ */
+static bool open_import_file(CsvReader *reader, const char *path)
+{
+    if (!csv_reader_open(reader, path, ','))
+    {
+        printf("无法打开导入文件: %s\n", path);
+        return false;
+    }
+    if (csv_read_record(reader) <= 0)
+    {
+        printf("导入文件为空: %s\n", path);
+        csv_reader_close(reader);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * 读取下一条数据行，跳过空行；文件结束返回0，出错返回-1
+ */
+static int next_row(CsvReader *reader, ImportFileSummary *summary)
+{
+    int fields;
+    while ((fields = csv_read_record(reader)) == 1 && reader->fields[0][0] == '\0')
+    {
+    }
+    if (fields > 0)
+    {
+        summary->row_count++;
+    }
+    return fields;
+}
+
+/**
+ * 执行一条插入：约束冲突时返回拒绝原因，其他错误返回NULL并置*failed
+ */
+static const char *step_insert(ImportContext *ctx, sqlite3_stmt *stmt, bool *failed)
+{
+    int rc = sqlite3_step(stmt);
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+    if (rc == SQLITE_DONE)
+    {
+        return NULL;
+    }
+    if ((rc & 0xFF) == SQLITE_CONSTRAINT)
+    {
+        return "与数据库中已有数据冲突";
+    }
+    fprintf(stderr, "写入失败: %s\n", sqlite3_errmsg(ctx->db->db));
+    *failed = true;
+    return NULL;
+}
+
+/**
+ * 查找业主，返回拒绝原因；owner为空时*user置NULL
+ */
+static const char *find_owner(ImportContext *ctx, const char *owner, const KnownUser **user)
+{
+    *user = NULL;
+    if (!*owner)
+    {
+        return NULL;
+    }
+    *user = hash_map_get(&ctx->users, owner, strlen(owner));
+    if (!*user)
+    {
+        return "业主不存在";
+    }
+    return (*user)->owner ? NULL : "该用户不是业主";
+}
+
+static bool valid_phone(const char *phone)
+{
+    size_t digits = 0;
+    for (; *phone; phone++)
+    {
+        if (isdigit((unsigned char)*phone))
+            digits++;
+        else if (*phone != '+' && *phone != '-' && *phone != ' ')
+            return false;
+    }
+    return digits >= 5 && digits <= 20;
+}
+
+static bool import_owners(ImportContext *ctx, const char *path, ImportFileSummary *summary)
+{
+    CsvReader reader;
+    if (!open_import_file(&reader, path))
+    {
+        return false;
+    }
+    int username_col = csv_find_column(&reader, USERNAME_HEADERS);
+    int name_col = csv_find_column(&reader, NAME_HEADERS);
+    int phone_col = csv_find_column(&reader, PHONE_HEADERS);
+    int email_col = csv_find_column(&reader, EMAIL_HEADERS);
+    int password_col = csv_find_column(&reader, PASSWORD_HEADERS);
+    if (username_col < 0 || name_col < 0)
+    {
+        printf("业主文件缺少必要的列：用户名、姓名\n");
+        csv_reader_close(&reader);
+        return false;
+    }
+
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(ctx->db->db,
+                           "INSERT INTO users (user_id, username, password_hash, name, phone_number, email, role_id, "
+                           "status, registration_date, name_sort_key) VALUES (?, ?, ?, ?, ?, ?, 'role_owner', 1, ?, ?)",
+                           -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "准备插入业主失败: %s\n", sqlite3_errmsg(ctx->db->db));
+        csv_reader_close(&reader);
+        return false;
+    }
+
+    sqlite3_int64 now = time(NULL);
+    bool failed = false;
+    int fields;
+    while (!failed && (fields = next_row(&reader, summary)) != 0)
+    {
+        if (fields < 0)
+        {
+            failed = true;
+            break;
+        }
+        const char *username = column_value(&reader, username_col);
+        const char *name = column_value(&reader, name_col);
+        const char *phone = column_value(&reader, phone_col);
+        const char *email = column_value(&reader, email_col);
+        const char *password = column_value(&reader, password_col);
+
+        const char *reason = NULL;
+        if (!*username)
+            reason = "用户名为空";
+        else if (strlen(username) >= 50)
+            reason = "用户名过长";
+        else if (!*name)
+            reason = "姓名为空";
+        else if (*phone && !valid_phone(phone))
+            reason = "手机号格式错误";
+        else if (*email && !strchr(email, '@'))
+            reason = "邮箱格式错误";
+        else if (hash_map_get(&ctx->users, username, strlen(username)))
+            reason = "用户名已存在";
+        if (reason)
+        {
+            reject_row(ctx, "owners", &reader, reason, summary);
+            continue;
+        }
+
+        char user_id[40], password_hash[80];
+        generate_uuid(user_id);
+        if (*password && !hash_password(password, password_hash, sizeof(password_hash)))
+        {
+            reject_row(ctx, "owners", &reader, "密码加密失败", summary);
+            continue;
+        }
+        sqlite3_bind_text(stmt, 1, user_id, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 2, username, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 3, *password ? password_hash : ctx->default_hash, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 4, name, -1, SQLITE_STATIC);
+        if (*phone)
+            sqlite3_bind_text(stmt, 5, phone, -1, SQLITE_STATIC);
+        if (*email)
+            sqlite3_bind_text(stmt, 6, email, -1, SQLITE_STATIC);
+        sqlite3_bind_int64(stmt, 7, now);
+        pinyin_bind_sort_key(stmt, 8, name);
+
+        reason = step_insert(ctx, stmt, &failed);
+        if (reason)
+        {
+            reject_row(ctx, "owners", &reader, reason, summary);
+        }
+        else if (!failed)
+        {
+            failed = !remember_user(ctx, user_id, username, true);
+            summary->imported_count++;
+        }
+    }
+
+    sqlite3_finalize(stmt);
+    csv_reader_close(&reader);
+    return !failed;
+}
+
+static bool import_rooms(ImportContext *ctx, const char *path, ImportFileSummary *summary)
+{
+    CsvReader reader;
+    if (!open_import_file(&reader, path))
+    {
+        return false;
+    }
+    int building_col = csv_find_column(&reader, BUILDING_HEADERS);
+    int number_col = csv_find_column(&reader, ROOM_NUMBER_HEADERS);
+    int floor_col = csv_find_column(&reader, FLOOR_HEADERS);
+    int area_col = csv_find_column(&reader, AREA_HEADERS);
+    int owner_col = csv_find_column(&reader, OWNER_HEADERS);
+    if (building_col < 0 || number_col < 0 || floor_col < 0 || area_col < 0)
+    {
+        printf("房屋文件缺少必要的列：楼宇、房号、楼层、面积\n");
+        csv_reader_close(&reader);
+        return false;
+    }
+
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(ctx->db->db,
+                           "INSERT INTO rooms (room_id, building_id, room_number, floor, area_sqm, owner_id, status) "
+                           "VALUES (?, ?, ?, ?, ?, ?, ?)",
+                           -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "准备插入房屋失败: %s\n", sqlite3_errmsg(ctx->db->db));
+        csv_reader_close(&reader);
+        return false;
+    }
+
+    bool failed = false;
+    char key[160];
+    int fields;
+    while (!failed && (fields = next_row(&reader, summary)) != 0)
+    {
+        if (fields < 0)
+        {
+            failed = true;
+            break;
+        }
+        const char *building_text = column_value(&reader, building_col);
+        const char *number = column_value(&reader, number_col);
+        const char *floor_text = column_value(&reader, floor_col);
+        const char *area_text = column_value(&reader, area_col);
+        char *end;
+        long floor = strtol(floor_text, &end, 10);
+        bool floor_ok = *floor_text && *end == '\0';
+        double area = strtod(area_text, &end);
+        bool area_ok = *area_text && *end == '\0' && area > 0;
+
+        const KnownBuilding *building = hash_map_get(&ctx->buildings, building_text, strlen(building_text));
+        const KnownUser *owner = NULL;
+        const char *reason = NULL;
+        size_t key_len = 0;
+        if (!building)
+            reason = *building_text ? "楼宇不存在" : "楼宇为空";
+        else if (!*number)
+            reason = "房号为空";
+        else if (!floor_ok)
+            reason = "楼层格式错误";
+        else if (!area_ok)
+            reason = "面积格式错误";
+        else if (!(reason = find_owner(ctx, column_value(&reader, owner_col), &owner)))
+        {
+            key_len = room_key(key, sizeof(key), building->building_id, number);
+            if (hash_map_get(&ctx->rooms, key, key_len))
+                reason = "房号重复";
+        }
+        if (reason)
+        {
+            reject_row(ctx, "rooms", &reader, reason, summary);
+            continue;
+        }
+
+        char room_id[40];
+        generate_uuid(room_id);
+        sqlite3_bind_text(stmt, 1, room_id, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 2, building->building_id, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 3, number, -1, SQLITE_STATIC);
+        sqlite3_bind_int(stmt, 4, (int)floor);
+        sqlite3_bind_double(stmt, 5, area);
+        if (owner)
+            sqlite3_bind_text(stmt, 6, owner->user_id, -1, SQLITE_STATIC);
+        sqlite3_bind_int(stmt, 7, owner ? 1 : 0);
+
+        reason = step_insert(ctx, stmt, &failed);
+        if (reason)
+        {
+            reject_row(ctx, "rooms", &reader, reason, summary);
+        }
+        else if (!failed)
+        {
+            failed = !hash_map_put(&ctx->rooms, key, key_len, &present);
+            summary->imported_count++;
+        }
+    }
+
+    sqlite3_finalize(stmt);
+    csv_reader_close(&reader);
+    return !failed;
+}
+
+static bool import_parking(ImportContext *ctx, const char *path, ImportFileSummary *summary)
+{
+    CsvReader reader;
+    if (!open_import_file(&reader, path))
+    {
+        return false;
+    }
+    int number_col = csv_find_column(&reader, PARKING_NUMBER_HEADERS);
+    int owner_col = csv_find_column(&reader, OWNER_HEADERS);
+    if (number_col < 0)
+    {
+        printf("车位文件缺少必要的列：车位号\n");
+        csv_reader_close(&reader);
+        return false;
+    }
+
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(ctx->db->db,
+                           "INSERT INTO parking_spaces (parking_id, parking_number, owner_id, status) VALUES (?, ?, ?, ?)",
+                           -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "准备插入车位失败: %s\n", sqlite3_errmsg(ctx->db->db));
+        csv_reader_close(&reader);
+        return false;
+    }
+
+    bool failed = false;
+    int fields;
+    while (!failed && (fields = next_row(&reader, summary)) != 0)
+    {
+        if (fields < 0)
+        {
+            failed = true;
+            break;
+        }
+        const char *number = column_value(&reader, number_col);
+        const KnownUser *owner = NULL;
+        const char *reason = NULL;
+        if (!*number)
+            reason = "车位号为空";
+        else if (!(reason = find_owner(ctx, column_value(&reader, owner_col), &owner)) &&
+                 hash_map_get(&ctx->parking, number, strlen(number)))
+            reason = "车位号重复";
+        if (reason)
+        {
+            reject_row(ctx, "parking", &reader, reason, summary);
+            continue;
+        }
+
+        char parking_id[40];
+        generate_uuid(parking_id);
+        sqlite3_bind_text(stmt, 1, parking_id, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 2, number, -1, SQLITE_STATIC);
+        if (owner)
+            sqlite3_bind_text(stmt, 3, owner->user_id, -1, SQLITE_STATIC);
+        sqlite3_bind_int(stmt, 4, owner ? 1 : 0);
+
+        reason = step_insert(ctx, stmt, &failed);
+        if (reason)
+        {
+            reject_row(ctx, "parking", &reader, reason, summary);
+        }
+        else if (!failed)
+        {
+            failed = !hash_map_put(&ctx->parking, number, strlen(number), &present);
+            summary->imported_count++;
+        }
+    }
+
+    sqlite3_finalize(stmt);
+    csv_reader_close(&reader);
+    return !failed;
+}
+
+/**
+ * 读取返回单个整数的PRAGMA当前值
+ */
+static bool read_pragma(Database *db, const char *name, int *value)
+{
+    char sql[64];
+    snprintf(sql, sizeof(sql), "PRAGMA %s", name);
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(db->db, sql, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        return false;
+    }
+    bool found = sqlite3_step(stmt) == SQLITE_ROW;
+    if (found)
+    {
+        *value = sqlite3_column_int(stmt, 0);
+    }
+    sqlite3_finalize(stmt);
+    return found;
+}
+
+static void write_pragma(Database *db, const char *name, int value)
+{
+    char sql[64];
+    snprintf(sql, sizeof(sql), "PRAGMA %s = %d", name, value);
+    sqlite3_exec(db->db, sql, 0, 0, 0);
+}
+
+/**
+ * 批量导入业主、房屋和车位
+ *
+ * 先把已有用户、楼宇、房号和车位号载入内存哈希表，外键和唯一性只在内存中校验，
+ * 本次导入的业主随即登记，可在同一批的房屋和车位文件中引用。全部写入在一个事务内
+ * 用预编译语句完成，期间关闭外键检查（已在内存中校验）并加大页缓存，结束后恢复连接原有设置；
+ * 出现约束冲突以外的数据库错误时整体回滚。
+ *
+ * @param db 数据库连接
+ * @param files 要导入的文件
+ * @param report_path 拒绝报告CSV路径
+ * @param summary 输出参数，导入结果
+ * @return 成功返回true，失败返回false（已回滚，不会部分导入）
+ */
+bool bulk_import(Database *db, const ImportFiles *files, const char *report_path, ImportSummary *summary)
+{
+    struct timespec started, finished;
+    clock_gettime(CLOCK_MONOTONIC, &started);
+    memset(summary, 0, sizeof(ImportSummary));
+
+    ImportContext ctx;
+    memset(&ctx, 0, sizeof(ImportContext));
+    ctx.db = db;
+    record_buffer_init(&ctx.user_records, sizeof(KnownUser), 0);
+    record_buffer_init(&ctx.building_records, sizeof(KnownBuilding), 0);
+    if (!hash_password(IMPORT_DEFAULT_PASSWORD, ctx.default_hash, sizeof(ctx.default_hash)))
+    {
+        return false;
+    }
+
+    if (!csv_writer_open(&ctx.report, report_path, ',', CSV_WRITE_BOM))
+    {
+        printf("无法创建拒绝报告: %s\n", report_path);
+        return false;
+    }
+    const char *header[] = {"文件", "行号", "原因", "原始记录"};
+    for (int i = 0; i < 4; i++)
+    {
+        csv_write_field(&ctx.report, header[i]);
+    }
+    csv_end_record(&ctx.report);
+
+    bool ok = hash_map_init(&ctx.users, 1024) && hash_map_init(&ctx.buildings, 64) &&
+              hash_map_init(&ctx.rooms, 1024) && hash_map_init(&ctx.parking, 1024);
+
+    // foreign_keys只能在事务外切换；连接可能来自服务的连接池，导入前记下原设置
+    int saved_foreign_keys = 1, saved_cache_size = -2000, saved_temp_store = 0;
+    read_pragma(db, "foreign_keys", &saved_foreign_keys);
+    read_pragma(db, "cache_size", &saved_cache_size);
+    read_pragma(db, "temp_store", &saved_temp_store);
+    sqlite3_exec(db->db, "PRAGMA foreign_keys = OFF", 0, 0, 0);
+    sqlite3_exec(db->db, "PRAGMA cache_size = -65536", 0, 0, 0);
+    sqlite3_exec(db->db, "PRAGMA temp_store = MEMORY", 0, 0, 0);
+    if (ok && sqlite3_exec(db->db, "BEGIN IMMEDIATE", 0, 0, 0) != SQLITE_OK)
+    {
+        fprintf(stderr, "无法开始事务: %s\n", sqlite3_errmsg(db->db));
+        ok = false;
+    }
+    ok = ok && load_existing(&ctx);
+    ok = ok && (!files->owners_path || import_owners(&ctx, files->owners_path, &summary->owners));
+    ok = ok && (!files->rooms_path || import_rooms(&ctx, files->rooms_path, &summary->rooms));
+    ok = ok && (!files->parking_path || import_parking(&ctx, files->parking_path, &summary->parking));
+
+    if (ok && sqlite3_exec(db->db, "COMMIT", 0, 0, 0) != SQLITE_OK)
+    {
+        fprintf(stderr, "提交事务失败: %s\n", sqlite3_errmsg(db->db));
+        ok = false;
+    }
+    if (!ok)
+    {
+        fprintf(stderr, "导入失败，已回滚，未写入任何数据\n");
+        sqlite3_exec(db->db, "ROLLBACK", 0, 0, 0);
+        summary->owners.imported_count = 0;
+        summary->rooms.imported_count = 0;
+        summary->parking.imported_count = 0;
+    }
+    write_pragma(db, "temp_store", saved_temp_store);
+    write_pragma(db, "cache_size", saved_cache_size);
+    write_pragma(db, "foreign_keys", saved_foreign_keys);
+
+    if (!csv_writer_close(&ctx.report))
+    {
+        fprintf(stderr, "写入拒绝报告失败: %s\n", report_path);
+    }
+    hash_map_free(&ctx.users);
+    hash_map_free(&ctx.buildings);
+    hash_map_free(&ctx.rooms);
+    hash_map_free(&ctx.parking);
+    record_buffer_free(&ctx.user_records);
+    record_buffer_free(&ctx.building_records);
+
+    clock_gettime(CLOCK_MONOTONIC, &finished);
+    summary->elapsed_seconds = (finished.tv_sec - started.tv_sec) + (finished.tv_nsec - started.tv_nsec) / 1e9;
+    return ok;
+}
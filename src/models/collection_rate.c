@@ -0,0 +1,307 @@
+#include "models/collection_rate.h"
+#include "models/fee_cube.h"
+#include "utils/table.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// 月份YYYYMM换算为连续的月序号，相邻月份相差1，跨年同月相差12
+#define MONTH_INDEX(col) "((" col ") / 100 * 12 + (" col ") % 100 - 1)"
+
+// 先清零待重算月份，立方体中已无数据的月份保持为0
+static const char *RATES_RESET_SQL =
+    "UPDATE collection_rates SET billed_amount = 0, paid_amount = 0, bill_count = 0, paid_count = 0 "
+    "WHERE dirty = 1";
+
+// 只汇总待重算月份的立方体单元
+static const char *RATES_AGGREGATE_SQL =
+    "UPDATE collection_rates SET billed_amount = c.billed, paid_amount = c.paid, "
+    "bill_count = c.bills, paid_count = c.paid_bills "
+    "FROM (SELECT month, SUM(billed_amount) AS billed, SUM(paid_amount) AS paid, "
+    "      SUM(bill_count) AS bills, SUM(paid_count) AS paid_bills "
+    "      FROM fee_cube WHERE month IN (SELECT month FROM collection_rates WHERE dirty = 1) "
+    "      GROUP BY month) AS c "
+    "WHERE collection_rates.month = c.month";
+
+// 环比、同比用窗口函数在月序号上取前1个月、前12个月的收缴率，缺月时为NULL。
+// 只写回待重算月份及以其为上月或去年同月的月份
+static const char *RATES_WINDOW_SQL =
+    "UPDATE collection_rates SET rate = w.rate, mom_delta = w.rate - w.prev_month, yoy_delta = w.rate - w.prev_year "
+    "FROM (SELECT month, rate, "
+    "      FIRST_VALUE(rate) OVER (ORDER BY month_index RANGE BETWEEN 1 PRECEDING AND 1 PRECEDING) AS prev_month, "
+    "      FIRST_VALUE(rate) OVER (ORDER BY month_index RANGE BETWEEN 12 PRECEDING AND 12 PRECEDING) AS prev_year "
+    "      FROM (SELECT month, " MONTH_INDEX("month") " AS month_index, "
+    "            CASE WHEN billed_amount > 0.005 THEN paid_amount / billed_amount END AS rate "
+    "            FROM collection_rates)) AS w "
+    "WHERE collection_rates.month = w.month AND (collection_rates.dirty = 1 OR EXISTS ("
+    "  SELECT 1 FROM collection_rates d WHERE d.dirty = 1 AND d.month IN ("
+    "  CASE WHEN collection_rates.month % 100 = 1 THEN collection_rates.month - 89 ELSE collection_rates.month - 1 END, "
+    "  collection_rates.month - 100)))";
+
+static const char *RATES_CLEAN_SQL = "UPDATE collection_rates SET dirty = 0 WHERE dirty = 1";
+
+static const char *RATES_QUERY_SQL =
+    "SELECT month, billed_amount, paid_amount, bill_count, paid_count, rate, mom_delta, yoy_delta "
+    "FROM collection_rates WHERE month BETWEEN ? AND ? AND bill_count > 0 ORDER BY month";
+
+// 走势图字符，由低到高
+static const char *SPARK_LEVELS[] = {"▁", "▂", "▃", "▄", "▅", "▆", "▇", "█"};
+
+/**
+ * 执行一条缓存的写语句
+ */
+static bool run_cached(Database *db, const char *sql)
+{
+    sqlite3_stmt *stmt;
+    if (db_prepare_cached(db, sql, &stmt) != SQLITE_OK)
+    {
+        return false;
+    }
+    bool ok = sqlite3_step(stmt) == SQLITE_DONE;
+    sqlite3_reset(stmt);
+    return ok;
+}
+
+/**
+ * 增量刷新收缴率缓存
+ *
+ * 立方体刷新时已把本轮变更涉及的账期月份标记为待重算。这里只对这些月份从立方体重新汇总，
+ * 再用窗口函数重算它们自身以及受其影响的下月环比、次年同比；其余月份的缓存保持不动。
+ *
+ * @param db 数据库连接
+ * @param recomputed 输出参数，重算的月份数，可为NULL
+ * @return 成功返回true
+ */
+bool refresh_collection_rates(Database *db, int *recomputed)
+{
+    if (recomputed)
+    {
+        *recomputed = 0;
+    }
+    if (!refresh_fee_cube(db, NULL))
+    {
+        return false;
+    }
+
+    bool own_transaction = sqlite3_get_autocommit(db->db);
+    if (own_transaction && sqlite3_exec(db->db, "BEGIN IMMEDIATE", 0, 0, 0) != SQLITE_OK)
+    {
+        fprintf(stderr, "无法开始事务: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+
+    bool ok = run_cached(db, RATES_RESET_SQL);
+    int dirty = sqlite3_changes(db->db);
+    if (ok && dirty > 0)
+    {
+        ok = run_cached(db, RATES_AGGREGATE_SQL) &&
+             run_cached(db, RATES_WINDOW_SQL) &&
+             run_cached(db, RATES_CLEAN_SQL);
+    }
+
+    if (!ok)
+    {
+        fprintf(stderr, "刷新收缴率失败: %s\n", sqlite3_errmsg(db->db));
+    }
+    if (own_transaction)
+    {
+        sqlite3_exec(db->db, ok ? "COMMIT" : "ROLLBACK", 0, 0, 0);
+    }
+    if (ok && recomputed)
+    {
+        *recomputed = dirty;
+    }
+    return ok;
+}
+
+/**
+ * 查询收缴率序列
+ *
+ * @param db 数据库连接
+ * @param month_from 起始月份YYYYMM（含）
+ * @param month_to 截止月份YYYYMM（含）
+ * @param series 输出参数，使用后调用free_collection_rates释放
+ * @return 成功返回true
+ */
+bool query_collection_rates(Database *db, int month_from, int month_to, CollectionRateSeries *series)
+{
+    struct timespec started, finished;
+    clock_gettime(CLOCK_MONOTONIC, &started);
+    memset(series, 0, sizeof(CollectionRateSeries));
+
+    if (!refresh_collection_rates(db, &series->recomputed))
+    {
+        return false;
+    }
+
+    sqlite3_stmt *stmt;
+    if (db_prepare_cached(db, RATES_QUERY_SQL, &stmt) != SQLITE_OK)
+    {
+        fprintf(stderr, "查询收缴率失败: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+    sqlite3_bind_int(stmt, 1, month_from);
+    sqlite3_bind_int(stmt, 2, month_to);
+
+    int cap = 0;
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+    {
+        if (series->count == cap)
+        {
+            cap = cap ? cap * 2 : 64;
+            CollectionRatePoint *points = realloc(series->points, cap * sizeof(CollectionRatePoint));
+            if (!points)
+            {
+                fprintf(stderr, "内存分配失败：收缴率序列\n");
+                rc = SQLITE_NOMEM;
+                break;
+            }
+            series->points = points;
+        }
+
+        CollectionRatePoint *point = &series->points[series->count++];
+        point->month = sqlite3_column_int(stmt, 0);
+        point->billed_amount = sqlite3_column_double(stmt, 1);
+        point->paid_amount = sqlite3_column_double(stmt, 2);
+        point->bill_count = (long)sqlite3_column_int64(stmt, 3);
+        point->paid_count = (long)sqlite3_column_int64(stmt, 4);
+        point->has_rate = sqlite3_column_type(stmt, 5) != SQLITE_NULL;
+        point->rate = sqlite3_column_double(stmt, 5);
+        point->has_mom = sqlite3_column_type(stmt, 6) != SQLITE_NULL;
+        point->mom_delta = sqlite3_column_double(stmt, 6);
+        point->has_yoy = sqlite3_column_type(stmt, 7) != SQLITE_NULL;
+        point->yoy_delta = sqlite3_column_double(stmt, 7);
+    }
+    sqlite3_reset(stmt);
+
+    if (rc != SQLITE_DONE)
+    {
+        if (rc != SQLITE_NOMEM)
+        {
+            fprintf(stderr, "查询收缴率失败: %s\n", sqlite3_errmsg(db->db));
+        }
+        free_collection_rates(series);
+        return false;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &finished);
+    series->elapsed_seconds = (finished.tv_sec - started.tv_sec) + (finished.tv_nsec - started.tv_nsec) / 1e9;
+    return true;
+}
+
+/**
+ * 格式化变化量（百分点），无数据时为"-"
+ */
+static void format_delta(char *buf, size_t size, bool has_value, double delta)
+{
+    if (has_value)
+        snprintf(buf, size, "%+.1f", delta * 100);
+    else
+        snprintf(buf, size, "-");
+}
+
+/**
+ * @brief 打印收缴率序列
+ *
+ * 先按月列出金额、收缴率和环比、同比（百分点），再按年各占一行画出12个月的走势图，
+ * 走势图按0-100%的固定刻度取字符高度，不同年份之间可直接比较。
+ *
+ * @param series 收缴率序列
+ */
+void print_collection_rates(const CollectionRateSeries *series)
+{
+    if (series->count == 0)
+    {
+        printf("没有符合条件的账单\n");
+        return;
+    }
+
+    static const TableColumn columns[] = {
+        {"月份", TABLE_ALIGN_LEFT, 0},
+        {"应缴金额", TABLE_ALIGN_RIGHT, 0},
+        {"已缴金额", TABLE_ALIGN_RIGHT, 0},
+        {"收缴率", TABLE_ALIGN_RIGHT, 0},
+        {"环比", TABLE_ALIGN_RIGHT, 0},
+        {"同比", TABLE_ALIGN_RIGHT, 0},
+    };
+    Table table;
+    if (table_begin(&table, columns, 6, 0))
+    {
+        for (int i = 0; i < series->count; i++)
+        {
+            const CollectionRatePoint *point = &series->points[i];
+            char month[16], billed[32], paid[32], rate[16], mom[16], yoy[16];
+            snprintf(month, sizeof(month), "%04d-%02d", point->month / 100, point->month % 100);
+            snprintf(billed, sizeof(billed), "%.2f", point->billed_amount);
+            snprintf(paid, sizeof(paid), "%.2f", point->paid_amount);
+            if (point->has_rate)
+                snprintf(rate, sizeof(rate), "%.1f%%", point->rate * 100);
+            else
+                snprintf(rate, sizeof(rate), "-");
+            format_delta(mom, sizeof(mom), point->has_mom, point->mom_delta);
+            format_delta(yoy, sizeof(yoy), point->has_yoy, point->yoy_delta);
+
+            const char *values[] = {month, billed, paid, rate, mom, yoy};
+            table_add_row(&table, values);
+        }
+        table_end(&table);
+    }
+    printf(" (环比、同比单位为百分点)\n\n");
+
+    printf("收缴率走势(1-12月):\n");
+    int i = 0;
+    while (i < series->count)
+    {
+        int year = series->points[i].month / 100;
+        const char *cells[12];
+        for (int m = 0; m < 12; m++)
+        {
+            cells[m] = "·";
+        }
+
+        double billed = 0, paid = 0;
+        for (; i < series->count && series->points[i].month / 100 == year; i++)
+        {
+            const CollectionRatePoint *point = &series->points[i];
+            int m = point->month % 100 - 1;
+            if (m < 0 || m >= 12)
+            {
+                continue;
+            }
+            billed += point->billed_amount;
+            paid += point->paid_amount;
+            if (point->has_rate)
+            {
+                int level = (int)(point->rate * 7 + 0.5);
+                level = level < 0 ? 0 : level > 7 ? 7 : level;
+                cells[m] = SPARK_LEVELS[level];
+            }
+        }
+
+        printf(" %04d  ", year);
+        for (int m = 0; m < 12; m++)
+        {
+            fputs(cells[m], stdout);
+        }
+        if (billed > 0.005)
+            printf("  全年 %.1f%%\n", paid / billed * 100);
+        else
+            printf("\n");
+    }
+
+    printf("\n共%d个月，本次重算%d个月，用时%.3f秒\n", series->count, series->recomputed, series->elapsed_seconds);
+}
+
+/**
+ * @brief 释放收缴率序列
+ *
+ * @param series 收缴率序列
+ */
+void free_collection_rates(CollectionRateSeries *series)
+{
+    free(series->points);
+    series->points = NULL;
+    series->count = 0;
+}
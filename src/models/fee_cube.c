@@ -0,0 +1,336 @@
+#include "models/fee_cube.h"
+#include "utils/table.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static const char *CUBE_WATERMARK_SQL =
+    "SELECT s.watermark, (SELECT COALESCE(MAX(change_id), s.watermark) FROM fee_cube_changes) "
+    "FROM fee_cube_state s WHERE s.state_id = 1";
+
+// 将(?1, ?2]区间内的变更按单元汇总后并入立方体
+static const char *CUBE_MERGE_SQL =
+    "INSERT INTO fee_cube (building_id, fee_type, month, payment_method, billed_amount, paid_amount, "
+    "overdue_amount, bill_count, paid_count, overdue_count) "
+    "SELECT building_id, fee_type, month, payment_method, SUM(billed_amount), SUM(paid_amount), "
+    "SUM(overdue_amount), SUM(bill_count), SUM(paid_count), SUM(overdue_count) "
+    "FROM fee_cube_changes WHERE change_id > ?1 AND change_id <= ?2 "
+    "GROUP BY building_id, fee_type, month, payment_method "
+    "ON CONFLICT (building_id, fee_type, month, payment_method) DO UPDATE SET "
+    "billed_amount = billed_amount + excluded.billed_amount, "
+    "paid_amount = paid_amount + excluded.paid_amount, "
+    "overdue_amount = overdue_amount + excluded.overdue_amount, "
+    "bill_count = bill_count + excluded.bill_count, "
+    "paid_count = paid_count + excluded.paid_count, "
+    "overdue_count = overdue_count + excluded.overdue_count";
+
+// 把(?1, ?2]区间内变更涉及的账期月份标记为收缴率待重算
+static const char *CUBE_MARK_MONTHS_SQL =
+    "INSERT INTO collection_rates (month) "
+    "SELECT DISTINCT month FROM fee_cube_changes WHERE change_id > ?1 AND change_id <= ?2 "
+    "ON CONFLICT (month) DO UPDATE SET dirty = 1";
+
+static const char *CUBE_PRUNE_SQL = "DELETE FROM fee_cube WHERE bill_count = 0";
+
+static const char *CUBE_CONSUME_SQL = "DELETE FROM fee_cube_changes WHERE change_id <= ?";
+
+static const char *CUBE_ADVANCE_SQL = "UPDATE fee_cube_state SET watermark = ?, refreshed_at = ? WHERE state_id = 1";
+
+static const char *FEE_TYPE_NAMES[] = {"其他费用", "物业费", "停车费", "水费", "电费", "燃气费", "滞纳金"};
+static const char *METHOD_NAMES[] = {"未缴/未知", "现金", "银行卡", "微信", "支付宝"};
+
+/**
+ * 执行一条缓存的写语句
+ */
+static bool run_cached(Database *db, const char *sql, sqlite3_int64 a, sqlite3_int64 b, int bind_count)
+{
+    sqlite3_stmt *stmt;
+    if (db_prepare_cached(db, sql, &stmt) != SQLITE_OK)
+    {
+        return false;
+    }
+    if (bind_count > 0)
+        sqlite3_bind_int64(stmt, 1, a);
+    if (bind_count > 1)
+        sqlite3_bind_int64(stmt, 2, b);
+    bool ok = sqlite3_step(stmt) == SQLITE_DONE;
+    sqlite3_reset(stmt);
+    return ok;
+}
+
+/**
+ * 增量刷新立方体
+ *
+ * 触发器把每次账单增删改记为正负增量写入变更日志，这里把水位之后的增量按单元汇总，
+ * 一次UPSERT并入立方体，同时标记涉及的月份供收缴率缓存重算，随后推进水位并清理已并入的日志。
+ * 无新变更时只做一次读取。
+ *
+ * @param db 数据库连接
+ * @param refresh 输出参数，可为NULL
+ * @return 成功返回true
+ */
+bool refresh_fee_cube(Database *db, CubeRefresh *refresh)
+{
+    CubeRefresh local = {0};
+    if (!refresh)
+    {
+        refresh = &local;
+    }
+    memset(refresh, 0, sizeof(CubeRefresh));
+
+    sqlite3_stmt *stmt;
+    if (db_prepare_cached(db, CUBE_WATERMARK_SQL, &stmt) != SQLITE_OK)
+    {
+        fprintf(stderr, "读取立方体水位失败: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+    sqlite3_int64 watermark = 0, latest = 0;
+    if (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        watermark = sqlite3_column_int64(stmt, 0);
+        latest = sqlite3_column_int64(stmt, 1);
+    }
+    sqlite3_reset(stmt);
+
+    refresh->watermark = watermark;
+    if (latest <= watermark)
+    {
+        return true;
+    }
+
+    bool own_transaction = sqlite3_get_autocommit(db->db);
+    if (own_transaction && sqlite3_exec(db->db, "BEGIN IMMEDIATE", 0, 0, 0) != SQLITE_OK)
+    {
+        fprintf(stderr, "无法开始事务: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+
+    // 取得写锁后重新读取，期间可能有其他连接已完成刷新或追加了变更
+    if (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        watermark = sqlite3_column_int64(stmt, 0);
+        latest = sqlite3_column_int64(stmt, 1);
+    }
+    sqlite3_reset(stmt);
+
+    bool ok = true;
+    if (latest > watermark)
+    {
+        ok = run_cached(db, CUBE_MERGE_SQL, watermark, latest, 2) &&
+             run_cached(db, CUBE_MARK_MONTHS_SQL, watermark, latest, 2) &&
+             run_cached(db, CUBE_PRUNE_SQL, 0, 0, 0) &&
+             run_cached(db, CUBE_CONSUME_SQL, latest, 0, 1);
+        if (ok)
+        {
+            refresh->change_count = sqlite3_changes(db->db);
+            ok = run_cached(db, CUBE_ADVANCE_SQL, latest, time(NULL), 2);
+        }
+        if (ok)
+        {
+            refresh->watermark = latest;
+        }
+    }
+
+    if (!ok)
+    {
+        fprintf(stderr, "刷新立方体失败: %s\n", sqlite3_errmsg(db->db));
+    }
+    if (own_transaction)
+    {
+        sqlite3_exec(db->db, ok ? "COMMIT" : "ROLLBACK", 0, 0, 0);
+    }
+    return ok;
+}
+
+/**
+ * 按维度汇总查询立方体
+ *
+ * 选中的维度作为分组列，其余维度上卷；过滤条件对应切片（单值）和切块（月份区间）。
+ * 立方体行数只与楼宇数、费用类型数、月份数和支付方式数有关，与账单量无关。
+ *
+ * @param db 数据库连接
+ * @param group_by 汇总维度，CUBE_BY_*按位组合，0表示总计
+ * @param filter 过滤条件，NULL表示不限
+ * @param result 输出参数，使用后调用free_fee_cube_result释放
+ * @return 成功返回true
+ */
+bool query_fee_cube(Database *db, unsigned group_by, const CubeFilter *filter, CubeResult *result)
+{
+    struct timespec started, finished;
+    clock_gettime(CLOCK_MONOTONIC, &started);
+    memset(result, 0, sizeof(CubeResult));
+    result->group_by = group_by;
+
+    if (!refresh_fee_cube(db, NULL))
+    {
+        return false;
+    }
+
+    CubeFilter all = CUBE_FILTER_ALL;
+    if (!filter)
+    {
+        filter = &all;
+    }
+
+    const char *period = (group_by & CUBE_BY_MONTH)  ? "c.month"
+                         : (group_by & CUBE_BY_YEAR) ? "c.month / 100"
+                                                     : "-1";
+    char sql[1024];
+    snprintf(sql, sizeof(sql),
+             "SELECT %s, %s, %s, %s, SUM(c.billed_amount), SUM(c.paid_amount), SUM(c.overdue_amount), "
+             "SUM(c.bill_count), SUM(c.paid_count), SUM(c.overdue_count) "
+             "FROM fee_cube c LEFT JOIN buildings b ON b.building_id = c.building_id "
+             "WHERE c.month BETWEEN ?3 AND ?4 "
+             "AND (?1 IS NULL OR b.building_name = ?1) AND (?2 < 0 OR c.fee_type = ?2) "
+             "AND (?5 < 0 OR c.payment_method = ?5) "
+             "GROUP BY 1, 2, 3, 4 HAVING SUM(c.bill_count) <> 0 ORDER BY 1, 2, 3, 4",
+             (group_by & CUBE_BY_BUILDING) ? "COALESCE(b.building_name, '未归属')" : "''",
+             (group_by & CUBE_BY_FEE_TYPE) ? "c.fee_type" : "-1",
+             period,
+             (group_by & CUBE_BY_METHOD) ? "c.payment_method" : "-1");
+
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(db->db, sql, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "准备立方体查询失败: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+    if (filter->building_name)
+        sqlite3_bind_text(stmt, 1, filter->building_name, -1, SQLITE_STATIC);
+    sqlite3_bind_int(stmt, 2, filter->fee_type);
+    sqlite3_bind_int(stmt, 3, filter->month_from == CUBE_ANY ? 0 : filter->month_from);
+    sqlite3_bind_int(stmt, 4, filter->month_to == CUBE_ANY ? 999999 : filter->month_to);
+    sqlite3_bind_int(stmt, 5, filter->payment_method);
+
+    int capacity = 0;
+    int rc;
+    bool ok = true;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+    {
+        if (result->count == capacity)
+        {
+            capacity = capacity ? capacity * 2 : 64;
+            CubeCell *cells = realloc(result->cells, capacity * sizeof(CubeCell));
+            if (!cells)
+            {
+                fprintf(stderr, "内存分配失败：立方体查询结果\n");
+                ok = false;
+                break;
+            }
+            result->cells = cells;
+        }
+
+        CubeCell *cell = &result->cells[result->count++];
+        snprintf(cell->building_name, sizeof(cell->building_name), "%s", (const char *)sqlite3_column_text(stmt, 0));
+        cell->fee_type = sqlite3_column_int(stmt, 1);
+        cell->period = sqlite3_column_int(stmt, 2);
+        cell->payment_method = sqlite3_column_int(stmt, 3);
+        cell->billed_amount = sqlite3_column_double(stmt, 4);
+        cell->paid_amount = sqlite3_column_double(stmt, 5);
+        cell->overdue_amount = sqlite3_column_double(stmt, 6);
+        cell->bill_count = sqlite3_column_int64(stmt, 7);
+        cell->paid_count = sqlite3_column_int64(stmt, 8);
+        cell->overdue_count = sqlite3_column_int64(stmt, 9);
+    }
+    if (ok && rc != SQLITE_DONE)
+    {
+        fprintf(stderr, "查询立方体失败: %s\n", sqlite3_errmsg(db->db));
+        ok = false;
+    }
+    sqlite3_finalize(stmt);
+
+    if (!ok)
+    {
+        free_fee_cube_result(result);
+        return false;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &finished);
+    result->elapsed_seconds = (finished.tv_sec - started.tv_sec) + (finished.tv_nsec - started.tv_nsec) / 1e9;
+    return true;
+}
+
+/**
+ * 打印查询结果，只输出参与汇总的维度列，末尾附合计
+ */
+void print_fee_cube(const CubeResult *result)
+{
+    unsigned by = result->group_by;
+    TableColumn columns[9];
+    int dimension_count = 0;
+    if (by & CUBE_BY_BUILDING)
+        columns[dimension_count++] = (TableColumn){"楼宇", TABLE_ALIGN_LEFT, 16};
+    if (by & CUBE_BY_FEE_TYPE)
+        columns[dimension_count++] = (TableColumn){"费用类型", TABLE_ALIGN_LEFT, 0};
+    if (by & (CUBE_BY_MONTH | CUBE_BY_YEAR))
+        columns[dimension_count++] = (TableColumn){(by & CUBE_BY_MONTH) ? "月份" : "年份", TABLE_ALIGN_LEFT, 0};
+    if (by & CUBE_BY_METHOD)
+        columns[dimension_count++] = (TableColumn){"支付方式", TABLE_ALIGN_LEFT, 0};
+    columns[dimension_count + 0] = (TableColumn){"应缴", TABLE_ALIGN_RIGHT, 0};
+    columns[dimension_count + 1] = (TableColumn){"已缴", TABLE_ALIGN_RIGHT, 0};
+    columns[dimension_count + 2] = (TableColumn){"逾期", TABLE_ALIGN_RIGHT, 0};
+    columns[dimension_count + 3] = (TableColumn){"账单数", TABLE_ALIGN_RIGHT, 0};
+    columns[dimension_count + 4] = (TableColumn){"收缴率", TABLE_ALIGN_RIGHT, 0};
+
+    Table table;
+    bool shown = result->count > 0 && table_begin(&table, columns, dimension_count + 5, 0);
+    CubeCell total = {0};
+    for (int i = 0; i < result->count; i++)
+    {
+        const CubeCell *cell = &result->cells[i];
+        char period[16], billed[32], paid[32], overdue[32], bills[24], rate[16];
+        const char *values[9];
+        int n = 0;
+        if (by & CUBE_BY_BUILDING)
+            values[n++] = cell->building_name;
+        if (by & CUBE_BY_FEE_TYPE)
+            values[n++] = FEE_TYPE_NAMES[(cell->fee_type >= 1 && cell->fee_type <= 6) ? cell->fee_type : 0];
+        if (by & (CUBE_BY_MONTH | CUBE_BY_YEAR))
+        {
+            snprintf(period, sizeof(period), "%d", cell->period);
+            values[n++] = period;
+        }
+        if (by & CUBE_BY_METHOD)
+            values[n++] = (cell->payment_method >= 0 && cell->payment_method <= 4) ? METHOD_NAMES[cell->payment_method] : "其他";
+        snprintf(billed, sizeof(billed), "%.2f", cell->billed_amount);
+        snprintf(paid, sizeof(paid), "%.2f", cell->paid_amount);
+        snprintf(overdue, sizeof(overdue), "%.2f", cell->overdue_amount);
+        snprintf(bills, sizeof(bills), "%ld", cell->bill_count);
+        snprintf(rate, sizeof(rate), "%.1f%%", cell->billed_amount > 0 ? cell->paid_amount / cell->billed_amount * 100 : 0);
+        values[n++] = billed;
+        values[n++] = paid;
+        values[n++] = overdue;
+        values[n++] = bills;
+        values[n++] = rate;
+        if (shown)
+            table_add_row(&table, values);
+
+        total.billed_amount += cell->billed_amount;
+        total.paid_amount += cell->paid_amount;
+        total.overdue_amount += cell->overdue_amount;
+        total.bill_count += cell->bill_count;
+    }
+    if (shown)
+        table_end(&table);
+
+    if (result->count == 0)
+    {
+        printf("无符合条件的数据\n");
+        return;
+    }
+    printf("合计: 应缴 %.2f  已缴 %.2f  逾期 %.2f  账单 %ld 笔  收缴率 %.1f%%\n",
+           total.billed_amount, total.paid_amount, total.overdue_amount, total.bill_count,
+           total.billed_amount > 0 ? total.paid_amount / total.billed_amount * 100 : 0);
+    printf("（共 %d 行，查询耗时 %.1f 毫秒）\n", result->count, result->elapsed_seconds * 1000);
+}
+
+/**
+ * 释放查询结果
+ */
+void free_fee_cube_result(CubeResult *result)
+{
+    free(result->cells);
+    result->cells = NULL;
+    result->count = 0;
+}
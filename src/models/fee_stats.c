@@ -0,0 +1,475 @@
+#include "models/fee_stats.h"
+#include "utils/hash_map.h"
+#include "utils/thread_pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FEE_STATS_MIN_ROWS_PER_THREAD 20000 // 每个线程至少分到的行数，行数太少时不值得开线程
+
+const char *FEE_STATS_AGING_NAMES[FEE_STATS_AGING_BUCKETS] = {"30天内", "90天内", "90天以上"};
+
+static const char *SCAN_TRANSACTIONS_SQL =
+    "SELECT fee_type, status, amount, due_date, payment_date, user_id "
+    "FROM transactions WHERE rowid BETWEEN ? AND ?";
+
+static const char *OWNER_DETAIL_SQL =
+    "SELECT u.name, u.phone_number, b.building_name, r.room_number "
+    "FROM users u "
+    "LEFT JOIN rooms r ON r.owner_id = u.user_id "
+    "LEFT JOIN buildings b ON b.building_id = r.building_id "
+    "WHERE u.user_id = ? LIMIT 1";
+
+// 分组键头部，其后紧跟业主ID
+typedef struct
+{
+    uint8_t fee_slot; // 费用类型槽位
+    uint8_t status;   // 账单状态
+    uint8_t age;      // 欠费时长分档，已缴账单为0
+    uint8_t reserved;
+    int32_t year;     // 已缴按缴费日期、未缴按截止日期归属的年份
+} GroupKey;
+
+// 分组累计值
+typedef struct
+{
+    long bill_count;
+    double amount;
+} GroupTotals;
+
+// 一个扫描分区：rowid区间及其局部哈希表
+typedef struct
+{
+    const char *db_path; // 非NULL时分区自行打开只读连接
+    sqlite3 *shared;     // db_path为NULL时使用的连接
+    sqlite3_int64 first_rowid;
+    sqlite3_int64 last_rowid;
+    time_t now;
+    HashMap groups;       // 分组键 -> totals下标+1
+    GroupTotals *totals;
+    size_t total_count;
+    size_t total_cap;
+    long row_count;
+} ScanPartition;
+
+/**
+ * 累加到分组，不存在时新建
+ */
+static bool add_to_group(HashMap *groups, GroupTotals **totals, size_t *count, size_t *cap,
+                         const void *key, size_t key_len, long bill_count, double amount)
+{
+    void **slot = hash_map_lookup(groups, key, key_len);
+    if (slot)
+    {
+        GroupTotals *t = &(*totals)[(uintptr_t)*slot - 1];
+        t->bill_count += bill_count;
+        t->amount += amount;
+        return true;
+    }
+
+    if (*count == *cap)
+    {
+        size_t new_cap = *cap ? *cap * 2 : 1024;
+        GroupTotals *grown = realloc(*totals, new_cap * sizeof(GroupTotals));
+        if (!grown)
+        {
+            fprintf(stderr, "内存分配失败：统计分组\n");
+            return false;
+        }
+        *totals = grown;
+        *cap = new_cap;
+    }
+    (*totals)[*count] = (GroupTotals){bill_count, amount};
+    (*count)++;
+    return hash_map_put(groups, key, key_len, (void *)(uintptr_t)*count);
+}
+
+/**
+ * 扫描一个rowid区间，按(费用类型, 状态, 年份, 业主)分组累计
+ */
+static bool scan_partition(void *arg)
+{
+    ScanPartition *part = (ScanPartition *)arg;
+    sqlite3 *conn = part->shared;
+    if (part->db_path &&
+        sqlite3_open_v2(part->db_path, &conn, SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "打开统计连接失败: %s\n", sqlite3_errmsg(conn));
+        sqlite3_close(conn);
+        return false;
+    }
+
+    sqlite3_stmt *stmt;
+    bool ok = sqlite3_prepare_v2(conn, SCAN_TRANSACTIONS_SQL, -1, &stmt, NULL) == SQLITE_OK;
+    if (ok)
+    {
+        sqlite3_bind_int64(stmt, 1, part->first_rowid);
+        sqlite3_bind_int64(stmt, 2, part->last_rowid);
+
+        char key[sizeof(GroupKey) + 64];
+        GroupKey header = {0};
+        int rc;
+        while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+        {
+            int fee_type = sqlite3_column_int(stmt, 0);
+            int status = sqlite3_column_int(stmt, 1);
+            if (status < 0 || status > 2)
+            {
+                continue;
+            }
+
+            time_t when;
+            header.fee_slot = (fee_type >= 1 && fee_type <= 6) ? fee_type : 7;
+            header.status = (uint8_t)status;
+            header.age = 0;
+            if (status == 1)
+            {
+                when = (time_t)sqlite3_column_int64(stmt, 4);
+            }
+            else
+            {
+                when = (time_t)sqlite3_column_int64(stmt, 3);
+                double days = difftime(part->now, when) / 86400.0;
+                header.age = days <= 30 ? 0 : days <= 90 ? 1 : 2;
+            }
+            struct tm tm_info;
+            localtime_r(&when, &tm_info);
+            header.year = tm_info.tm_year + 1900;
+
+            const char *user_id = (const char *)sqlite3_column_text(stmt, 5);
+            size_t user_len = (size_t)sqlite3_column_bytes(stmt, 5);
+            if (user_len > sizeof(key) - sizeof(GroupKey))
+            {
+                user_len = sizeof(key) - sizeof(GroupKey);
+            }
+            memcpy(key, &header, sizeof(GroupKey));
+            memcpy(key + sizeof(GroupKey), user_id ? user_id : "", user_len);
+
+            if (!add_to_group(&part->groups, &part->totals, &part->total_count, &part->total_cap,
+                              key, sizeof(GroupKey) + user_len, 1, sqlite3_column_double(stmt, 2)))
+            {
+                ok = false;
+                break;
+            }
+            part->row_count++;
+        }
+        if (ok && rc != SQLITE_DONE)
+        {
+            ok = false;
+        }
+    }
+    if (!ok)
+    {
+        fprintf(stderr, "扫描账单失败: %s\n", sqlite3_errmsg(conn));
+    }
+
+    sqlite3_finalize(stmt);
+    if (part->db_path)
+    {
+        sqlite3_close(conn);
+    }
+    return ok;
+}
+
+/**
+ * 记录业主在某项统计中出现，首次出现时业主数加一
+ */
+static bool count_user(HashMap *seen, int metric, const char *user_id, size_t user_len, FeeStatCell *cell)
+{
+    char key[1 + 64];
+    key[0] = (char)metric;
+    memcpy(key + 1, user_id, user_len);
+    if (hash_map_lookup(seen, key, user_len + 1))
+    {
+        return true;
+    }
+    cell->user_count++;
+    return hash_map_put(seen, key, user_len + 1, NULL);
+}
+
+static void add_cell(FeeStatCell *cell, const GroupTotals *totals)
+{
+    cell->bill_count += totals->bill_count;
+    cell->amount += totals->amount;
+}
+
+// 去重业主统计项编号
+enum
+{
+    METRIC_PAID,
+    METRIC_UNPAID,
+    METRIC_YEAR_PAID,
+    METRIC_YEAR_UNPAID,
+    METRIC_UNPAID_TYPE,                                    // + 费用类型槽位
+    METRIC_UNPAID_AGE = METRIC_UNPAID_TYPE + FEE_STATS_TYPE_SLOTS, // + 分档
+    METRIC_YEAR_TYPE = METRIC_UNPAID_AGE + FEE_STATS_AGING_BUCKETS // + 费用类型槽位
+};
+
+/**
+ * 由分组结果推导全部统计数字
+ */
+static bool derive_stats(const ScanPartition *merged, FeeStats *stats, HashMap *year_debts,
+                         GroupTotals **debts, size_t *debt_count, size_t *debt_cap)
+{
+    HashMap seen;
+    if (!hash_map_init(&seen, merged->groups.count))
+    {
+        return false;
+    }
+
+    bool ok = true;
+    size_t index = 0;
+    HashEntry *entry;
+    while (ok && (entry = hash_map_next(&merged->groups, &index)))
+    {
+        GroupKey header;
+        memcpy(&header, entry->key, sizeof(GroupKey));
+        const char *user_id = entry->key + sizeof(GroupKey);
+        size_t user_len = entry->key_len - sizeof(GroupKey);
+        const GroupTotals *totals = &merged->totals[(uintptr_t)entry->value - 1];
+        bool paid = header.status == 1;
+        bool in_year = header.year == stats->year;
+        int slot = header.fee_slot;
+
+        if (paid)
+        {
+            add_cell(&stats->paid, totals);
+            ok = count_user(&seen, METRIC_PAID, user_id, user_len, &stats->paid);
+            if (ok && in_year)
+            {
+                add_cell(&stats->year_paid, totals);
+                ok = count_user(&seen, METRIC_YEAR_PAID, user_id, user_len, &stats->year_paid);
+            }
+        }
+        else
+        {
+            add_cell(&stats->unpaid, totals);
+            add_cell(&stats->unpaid_by_type[slot], totals);
+            add_cell(&stats->unpaid_by_age[header.age], totals);
+            ok = count_user(&seen, METRIC_UNPAID, user_id, user_len, &stats->unpaid) &&
+                 count_user(&seen, METRIC_UNPAID_TYPE + slot, user_id, user_len, &stats->unpaid_by_type[slot]) &&
+                 count_user(&seen, METRIC_UNPAID_AGE + header.age, user_id, user_len, &stats->unpaid_by_age[header.age]);
+            if (ok && in_year)
+            {
+                add_cell(&stats->year_unpaid, totals);
+                ok = count_user(&seen, METRIC_YEAR_UNPAID, user_id, user_len, &stats->year_unpaid) &&
+                     add_to_group(year_debts, debts, debt_count, debt_cap, user_id, user_len,
+                                  totals->bill_count, totals->amount);
+            }
+        }
+
+        if (ok && in_year)
+        {
+            add_cell(&stats->year_by_type[slot], totals);
+            ok = count_user(&seen, METRIC_YEAR_TYPE + slot, user_id, user_len, &stats->year_by_type[slot]);
+        }
+    }
+
+    hash_map_free(&seen);
+    return ok;
+}
+
+/**
+ * 从年度欠费中选出金额最多的业主，并补充姓名、电话、楼号和房号
+ */
+static void select_top_unpaid(Database *db, const HashMap *year_debts, const GroupTotals *debts, FeeStats *stats)
+{
+    size_t index = 0;
+    HashEntry *entry;
+    while ((entry = hash_map_next(year_debts, &index)))
+    {
+        const GroupTotals *totals = &debts[(uintptr_t)entry->value - 1];
+        int pos = stats->year_top_count;
+        if (pos == FEE_STATS_TOP_N)
+        {
+            if (totals->amount <= stats->year_top_unpaid[pos - 1].amount)
+            {
+                continue;
+            }
+            pos--;
+        }
+        else
+        {
+            stats->year_top_count++;
+        }
+
+        // 插入排序，保持金额降序
+        while (pos > 0 && stats->year_top_unpaid[pos - 1].amount < totals->amount)
+        {
+            stats->year_top_unpaid[pos] = stats->year_top_unpaid[pos - 1];
+            pos--;
+        }
+        FeeStatOwner *owner = &stats->year_top_unpaid[pos];
+        memset(owner, 0, sizeof(FeeStatOwner));
+        size_t len = entry->key_len < sizeof(owner->user_id) - 1 ? entry->key_len : sizeof(owner->user_id) - 1;
+        memcpy(owner->user_id, entry->key, len);
+        owner->bill_count = totals->bill_count;
+        owner->amount = totals->amount;
+    }
+
+    sqlite3_stmt *stmt;
+    if (db_prepare_cached(db, OWNER_DETAIL_SQL, &stmt) != SQLITE_OK)
+    {
+        return;
+    }
+    for (int i = 0; i < stats->year_top_count; i++)
+    {
+        FeeStatOwner *owner = &stats->year_top_unpaid[i];
+        sqlite3_bind_text(stmt, 1, owner->user_id, -1, SQLITE_STATIC);
+        if (sqlite3_step(stmt) == SQLITE_ROW)
+        {
+            const char *columns[4];
+            for (int c = 0; c < 4; c++)
+            {
+                columns[c] = (const char *)sqlite3_column_text(stmt, c);
+            }
+            snprintf(owner->name, sizeof(owner->name), "%s", columns[0] ? columns[0] : "");
+            snprintf(owner->phone, sizeof(owner->phone), "%s", columns[1] ? columns[1] : "");
+            snprintf(owner->building, sizeof(owner->building), "%s", columns[2] ? columns[2] : "未知");
+            snprintf(owner->room, sizeof(owner->room), "%s", columns[3] ? columns[3] : "未知");
+        }
+        sqlite3_reset(stmt);
+    }
+}
+
+/**
+ * 计算缴费统计
+ *
+ * 原先每个统计界面要对transactions做五六次扫描（多个标量子查询加分组和排行），
+ * 这里只扫描一遍：按rowid区间把表切成若干分区，每个线程用自己的只读连接扫描一个分区，
+ * 在局部哈希表中按(费用类型, 状态, 年份, 业主)累计，最后合并并推导出全部数字。
+ * 内存数据库或调用方处于未提交事务中时，其他连接看不到数据，退化为在当前连接上单线程扫描。
+ *
+ * @param db 数据库连接
+ * @param year 年度统计的年份
+ * @param now 欠费时长的计算基准时间
+ * @param stats 输出参数，统计结果
+ * @return 成功返回true
+ */
+bool collect_fee_stats(Database *db, int year, time_t now, FeeStats *stats)
+{
+    struct timespec started, finished;
+    clock_gettime(CLOCK_MONOTONIC, &started);
+    memset(stats, 0, sizeof(FeeStats));
+    stats->year = year;
+
+    sqlite3_stmt *stmt;
+    sqlite3_int64 min_rowid = 0, max_rowid = -1;
+    if (sqlite3_prepare_v2(db->db,
+                           "SELECT (SELECT COUNT(*) FROM users WHERE role_id = 'role_owner'), "
+                           "(SELECT MIN(rowid) FROM transactions), (SELECT MAX(rowid) FROM transactions)",
+                           -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "查询统计范围失败: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+    if (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        stats->total_owners = sqlite3_column_int(stmt, 0);
+        if (sqlite3_column_type(stmt, 1) != SQLITE_NULL)
+        {
+            min_rowid = sqlite3_column_int64(stmt, 1);
+            max_rowid = sqlite3_column_int64(stmt, 2);
+        }
+    }
+    sqlite3_finalize(stmt);
+
+    // 分区数按CPU核数和行数决定
+    bool separate_connections = db->db_path && db->db_path[0] && strcmp(db->db_path, ":memory:") != 0 &&
+                                sqlite3_get_autocommit(db->db);
+    sqlite3_int64 span = max_rowid - min_rowid + 1;
+    int partition_count = 1;
+    if (separate_connections)
+    {
+        partition_count = thread_pool_cpu_count();
+        if (span / FEE_STATS_MIN_ROWS_PER_THREAD < partition_count)
+        {
+            partition_count = (int)(span / FEE_STATS_MIN_ROWS_PER_THREAD);
+        }
+        if (partition_count < 1)
+        {
+            partition_count = 1;
+        }
+    }
+
+    ScanPartition *parts = calloc(partition_count, sizeof(ScanPartition));
+    if (!parts)
+    {
+        fprintf(stderr, "内存分配失败：统计分区\n");
+        return false;
+    }
+
+    bool ok = true;
+    for (int i = 0; i < partition_count && ok; i++)
+    {
+        ScanPartition *part = &parts[i];
+        part->db_path = partition_count > 1 ? db->db_path : NULL;
+        part->shared = db->db;
+        part->first_rowid = min_rowid + span * i / partition_count;
+        part->last_rowid = min_rowid + span * (i + 1) / partition_count - 1;
+        part->now = now;
+        ok = hash_map_init(&part->groups, 1024);
+    }
+
+    if (ok && partition_count == 1)
+    {
+        ok = scan_partition(&parts[0]);
+    }
+    else if (ok)
+    {
+        ThreadPool *pool = thread_pool_create(partition_count, partition_count);
+        ok = pool != NULL;
+        for (int i = 0; ok && i < partition_count; i++)
+        {
+            ok = thread_pool_submit(pool, scan_partition, &parts[i]);
+        }
+        if (pool)
+        {
+            ok = thread_pool_wait(pool) == 0 && ok;
+            thread_pool_destroy(pool);
+        }
+    }
+    stats->thread_count = partition_count;
+
+    // 合并各分区到第一个分区
+    ScanPartition *merged = &parts[0];
+    stats->row_count = merged->row_count;
+    for (int i = 1; ok && i < partition_count; i++)
+    {
+        size_t index = 0;
+        HashEntry *entry;
+        while (ok && (entry = hash_map_next(&parts[i].groups, &index)))
+        {
+            const GroupTotals *totals = &parts[i].totals[(uintptr_t)entry->value - 1];
+            ok = add_to_group(&merged->groups, &merged->totals, &merged->total_count, &merged->total_cap,
+                              entry->key, entry->key_len, totals->bill_count, totals->amount);
+        }
+        stats->row_count += parts[i].row_count;
+    }
+
+    if (ok)
+    {
+        HashMap year_debts;
+        GroupTotals *debts = NULL;
+        size_t debt_count = 0, debt_cap = 0;
+        ok = hash_map_init(&year_debts, 256) &&
+             derive_stats(merged, stats, &year_debts, &debts, &debt_count, &debt_cap);
+        if (ok)
+        {
+            select_top_unpaid(db, &year_debts, debts, stats);
+        }
+        hash_map_free(&year_debts);
+        free(debts);
+    }
+
+    for (int i = 0; i < partition_count; i++)
+    {
+        hash_map_free(&parts[i].groups);
+        free(parts[i].totals);
+    }
+    free(parts);
+
+    clock_gettime(CLOCK_MONOTONIC, &finished);
+    stats->elapsed_seconds = (finished.tv_sec - started.tv_sec) + (finished.tv_nsec - started.tv_nsec) / 1e9;
+    return ok;
+}
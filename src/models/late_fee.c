@@ -0,0 +1,413 @@
+#include "models/late_fee.h"
+#include "models/billing.h"
+#include "models/transaction.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// 滞纳金来源：超过宽限期的未缴或逾期账单及其逾期计费天数，
+// 连同该账单已开出的滞纳金合计、已计提到的日期和尚未缴清的滞纳金账单
+// 参数: ?2 宽限天数  ?4 计提日期
+#define LATE_FEE_SOURCE_SQL                                                                     \
+    "(SELECT transaction_id, user_id, room_id, parking_id, amount, due_date, "                  \
+    "        (?4 - due_date) / 86400 - ?2 AS days "                                             \
+    "  FROM transactions "                                                                      \
+    "  WHERE status IN (0, 2) AND fee_type != 6 AND amount > 0 AND due_date < ?4) s "          \
+    "LEFT JOIN (SELECT source_id, SUM(amount) AS billed, MAX(period_end) AS accrued_to, "       \
+    "                  MAX(CASE WHEN status != 1 THEN transaction_id END) AS open_id "          \
+    "           FROM transactions WHERE source_id IS NOT NULL GROUP BY source_id) f "           \
+    "ON f.source_id = s.transaction_id "                                                        \
+    "WHERE s.days > 0 AND ?4 > COALESCE(f.accrued_to, 0)"
+
+// 本次应计的滞纳金增量 = 截至计提日期的滞纳金总额 - 已开出的滞纳金，
+// 总额 = 本金 * 日费率 * 天数，受封顶比例限制
+// 参数: ?1 日费率  ?3 封顶比例
+#define LATE_FEE_AMOUNT_SQL                                                            \
+    "ROUND(CASE WHEN ?3 > 0 THEN MIN(s.amount * ?3, s.amount * ?1 * s.days) "          \
+    "ELSE s.amount * ?1 * s.days END - COALESCE(f.billed, 0), 2)"
+
+// 批量计提：以欠费账单为源，一条语句生成或追加对应的滞纳金账单。
+// 源账单还有未缴清的滞纳金账单时，增量追加到该账单上；否则新开一张账单，
+// 首张ID为 'LF-' || 源账单ID，此后每张为 'LF-' || 源账单ID || '-' || 计提日期，
+// 已缴清的滞纳金账单不会被改写，早于上次计提日期的重算也不会产生写入。
+// 新账单的截止日期为计提日期加宽限期。
+// 参数: ?1 日费率  ?2 宽限天数  ?3 封顶比例  ?4 计提日期
+static const char *ACCRUE_LATE_FEES_SQL =
+    "INSERT INTO transactions (transaction_id, user_id, room_id, parking_id, fee_type, amount, "
+    "payment_date, due_date, payment_method, status, period_start, period_end, source_id) "
+    "SELECT COALESCE(f.open_id, 'LF-' || s.transaction_id || CASE WHEN f.source_id IS NULL THEN '' ELSE '-' || ?4 END), "
+    "s.user_id, NULLIF(s.room_id, ''), NULLIF(s.parking_id, ''), 6, " LATE_FEE_AMOUNT_SQL ", "
+    "0, ?4 + ?2 * 86400, 0, 0, COALESCE(f.accrued_to, s.due_date), ?4, s.transaction_id "
+    "FROM " LATE_FEE_SOURCE_SQL " AND " LATE_FEE_AMOUNT_SQL " > 0 "
+    "ON CONFLICT(transaction_id) DO UPDATE SET "
+    "amount = ROUND(transactions.amount + excluded.amount, 2), period_end = excluded.period_end "
+    "WHERE transactions.status != 1";
+
+// 计提前统计本次将开出的滞纳金：与计提语句相同的来源和增量，
+// 追加到已有账单时RETURNING只能取到累计金额，因此在同一事务内先行汇总
+// 参数同ACCRUE_LATE_FEES_SQL
+static const char *ACCRUE_TOTAL_SQL =
+    "SELECT COUNT(*), COALESCE(SUM(amount), 0) "
+    "FROM (SELECT " LATE_FEE_AMOUNT_SQL " AS amount "
+    "      FROM " LATE_FEE_SOURCE_SQL " AND " LATE_FEE_AMOUNT_SQL " > 0)";
+
+// 计提预览：与计提相同的来源和增量计算，只保留实际执行时会新增或追加的滞纳金
+static const char *PREVIEW_LATE_FEES_SQL =
+    "SELECT p.user_id, p.room_id, r.building_id, p.days, p.amount, 0 "
+    "FROM (SELECT s.user_id, s.room_id, s.days, " LATE_FEE_AMOUNT_SQL " AS amount "
+    "      FROM " LATE_FEE_SOURCE_SQL " AND " LATE_FEE_AMOUNT_SQL " > 0) p "
+    "LEFT JOIN rooms r ON r.room_id = p.room_id";
+
+/**
+ * 将时间截断到当地零点
+ */
+static time_t truncate_to_day(time_t t)
+{
+    struct tm tm_day;
+    localtime_r(&t, &tm_day);
+    tm_day.tm_hour = 0;
+    tm_day.tm_min = 0;
+    tm_day.tm_sec = 0;
+    tm_day.tm_isdst = -1;
+    return mktime(&tm_day);
+}
+
+/**
+ * 获取在指定日期生效的滞纳金规则
+ *
+ * @param db 数据库连接
+ * @param as_of 生效日期
+ * @param rule 输出参数，滞纳金规则
+ * @return 找到规则返回true，否则返回false
+ */
+bool get_late_fee_rule(Database *db, time_t as_of, LateFeeRule *rule)
+{
+    const char *query =
+        "SELECT standard_id, price_per_unit, grace_days, cap_rate "
+        "FROM fee_standards "
+        "WHERE fee_type = ? AND effective_date <= ? AND (end_date = 0 OR end_date >= ?) "
+        "ORDER BY effective_date DESC LIMIT 1";
+
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "查询滞纳金规则失败: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+
+    sqlite3_bind_int(stmt, 1, TRANS_LATE_FEE);
+    sqlite3_bind_int64(stmt, 2, as_of);
+    sqlite3_bind_int64(stmt, 3, as_of);
+
+    bool found = false;
+    if (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        memset(rule, 0, sizeof(LateFeeRule));
+        strncpy(rule->standard_id, (const char *)sqlite3_column_text(stmt, 0), sizeof(rule->standard_id) - 1);
+        rule->daily_rate = sqlite3_column_double(stmt, 1);
+        rule->grace_days = sqlite3_column_int(stmt, 2);
+        rule->cap_rate = sqlite3_column_double(stmt, 3);
+        found = true;
+    }
+
+    sqlite3_finalize(stmt);
+    return found;
+}
+
+/**
+ * 修改滞纳金规则
+ *
+ * @param db 数据库连接
+ * @param rule 新的规则，按standard_id定位
+ * @return 成功返回true，失败返回false
+ */
+bool update_late_fee_rule(Database *db, const LateFeeRule *rule)
+{
+    if (rule->daily_rate < 0 || rule->grace_days < 0 || rule->cap_rate < 0)
+    {
+        printf("滞纳金规则参数无效\n");
+        return false;
+    }
+
+    const char *query =
+        "UPDATE fee_standards SET price_per_unit = ?, grace_days = ?, cap_rate = ? "
+        "WHERE standard_id = ? AND fee_type = ?";
+
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "更新滞纳金规则失败: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+
+    sqlite3_bind_double(stmt, 1, rule->daily_rate);
+    sqlite3_bind_int(stmt, 2, rule->grace_days);
+    sqlite3_bind_double(stmt, 3, rule->cap_rate);
+    sqlite3_bind_text(stmt, 4, rule->standard_id, -1, SQLITE_STATIC);
+    sqlite3_bind_int(stmt, 5, TRANS_LATE_FEE);
+
+    int rc = sqlite3_step(stmt);
+    sqlite3_finalize(stmt);
+
+    if (rc != SQLITE_DONE || sqlite3_changes(db->db) == 0)
+    {
+        fprintf(stderr, "更新滞纳金规则失败: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+
+    return true;
+}
+
+static bool accrue_late_fees_locked(Database *db, time_t accrual_date, LateFeeAccrual *accrual)
+{
+    LateFeeAccrual summary;
+    memset(&summary, 0, sizeof(summary));
+    summary.accrual_date = truncate_to_day(accrual_date);
+
+    LateFeeRule rule;
+    if (!get_late_fee_rule(db, summary.accrual_date, &rule))
+    {
+        printf("未找到有效的滞纳金规则\n");
+        return false;
+    }
+
+    // 先刷新逾期状态，保证计提基于最新的账单状态
+    update_overdue_transactions(db);
+
+    if (sqlite3_exec(db->db, "BEGIN IMMEDIATE", 0, 0, 0) != SQLITE_OK)
+    {
+        fprintf(stderr, "无法开始事务: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+
+    sqlite3_stmt *stmt;
+    bool ok = false;
+
+    // 检查该日期是否已经计提过
+    if (sqlite3_prepare_v2(db->db,
+                           "SELECT bill_count, total_amount FROM late_fee_runs WHERE accrual_date = ?",
+                           -1, &stmt, NULL) != SQLITE_OK)
+    {
+        goto done;
+    }
+    sqlite3_bind_int64(stmt, 1, summary.accrual_date);
+    if (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        summary.bill_count = sqlite3_column_int(stmt, 0);
+        summary.total_amount = sqlite3_column_double(stmt, 1);
+        summary.already_accrued = true;
+        sqlite3_finalize(stmt);
+        ok = true;
+        goto done;
+    }
+    sqlite3_finalize(stmt);
+
+    if (rule.daily_rate > 0)
+    {
+        if (sqlite3_prepare_v2(db->db, ACCRUE_TOTAL_SQL, -1, &stmt, NULL) != SQLITE_OK)
+        {
+            goto done;
+        }
+        sqlite3_bind_double(stmt, 1, rule.daily_rate);
+        sqlite3_bind_int(stmt, 2, rule.grace_days);
+        sqlite3_bind_double(stmt, 3, rule.cap_rate);
+        sqlite3_bind_int64(stmt, 4, summary.accrual_date);
+        if (sqlite3_step(stmt) != SQLITE_ROW)
+        {
+            sqlite3_finalize(stmt);
+            goto done;
+        }
+        summary.bill_count = sqlite3_column_int(stmt, 0);
+        summary.total_amount = sqlite3_column_double(stmt, 1);
+        sqlite3_finalize(stmt);
+
+        if (sqlite3_prepare_v2(db->db, ACCRUE_LATE_FEES_SQL, -1, &stmt, NULL) != SQLITE_OK)
+        {
+            goto done;
+        }
+        sqlite3_bind_double(stmt, 1, rule.daily_rate);
+        sqlite3_bind_int(stmt, 2, rule.grace_days);
+        sqlite3_bind_double(stmt, 3, rule.cap_rate);
+        sqlite3_bind_int64(stmt, 4, summary.accrual_date);
+        int rc = sqlite3_step(stmt);
+        sqlite3_finalize(stmt);
+        if (rc != SQLITE_DONE)
+        {
+            goto done;
+        }
+    }
+
+    if (sqlite3_prepare_v2(db->db,
+                           "INSERT INTO late_fee_runs (accrual_date, run_time, standard_id, bill_count, total_amount) "
+                           "VALUES (?, ?, ?, ?, ?)",
+                           -1, &stmt, NULL) != SQLITE_OK)
+    {
+        goto done;
+    }
+    sqlite3_bind_int64(stmt, 1, summary.accrual_date);
+    sqlite3_bind_int64(stmt, 2, time(NULL));
+    sqlite3_bind_text(stmt, 3, rule.standard_id, -1, SQLITE_STATIC);
+    sqlite3_bind_int(stmt, 4, summary.bill_count);
+    sqlite3_bind_double(stmt, 5, summary.total_amount);
+    ok = sqlite3_step(stmt) == SQLITE_DONE;
+    sqlite3_finalize(stmt);
+
+done:
+    if (ok && sqlite3_exec(db->db, "COMMIT", 0, 0, 0) == SQLITE_OK)
+    {
+        if (accrual)
+        {
+            *accrual = summary;
+        }
+        return true;
+    }
+
+    fprintf(stderr, "计提滞纳金失败: %s\n", sqlite3_errmsg(db->db));
+    sqlite3_exec(db->db, "ROLLBACK", 0, 0, 0);
+    return false;
+}
+
+/**
+ * 批量计提滞纳金
+ *
+ * 对所有未缴或逾期、且已超过宽限期的账单，按"本金 * 日费率 * 逾期天数"计算滞纳金，
+ * 并受封顶比例限制，扣除该账单已开出的滞纳金后计入未缴清的滞纳金账单或新开账单。每个计提日期在late_fee_runs表中登记一次，同一日期重复执行
+ * 直接返回上次的结果，不会产生任何写入。计提期间持有出账互斥锁。
+ *
+ * @param db 数据库连接
+ * @param accrual_date 计提日期，会截断到当日零点
+ * @param accrual 输出参数，计提结果，可为NULL
+ * @return 成功返回true，失败返回false
+ */
+bool accrue_late_fees(Database *db, time_t accrual_date, LateFeeAccrual *accrual)
+{
+    billing_lock();
+    bool ok = accrue_late_fees_locked(db, accrual_date, accrual);
+    billing_unlock();
+    return ok;
+}
+
+/**
+ * 预览滞纳金计提
+ *
+ * 按与accrue_late_fees相同的规则计算计提日期下各欠费账单将新增的滞纳金，
+ * 结果只在内存中汇总，不写入数据库。该日期已计提过时预览为空。
+ *
+ * @param db 数据库连接
+ * @param accrual_date 计提日期，会截断到当日零点
+ * @param top_n 列出金额最大的账单数
+ * @param preview 输出参数，使用后调用free_billing_preview释放
+ * @return 成功返回true，失败返回false
+ */
+bool preview_late_fees(Database *db, time_t accrual_date, int top_n, BillingPreview *preview)
+{
+    memset(preview, 0, sizeof(BillingPreview));
+    accrual_date = truncate_to_day(accrual_date);
+
+    LateFeeRule rule;
+    if (!get_late_fee_rule(db, accrual_date, &rule))
+    {
+        printf("未找到有效的滞纳金规则\n");
+        return false;
+    }
+
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(db->db, "SELECT 1 FROM late_fee_runs WHERE accrual_date = ?", -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "查询计提记录失败: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+    sqlite3_bind_int64(stmt, 1, accrual_date);
+    bool already_accrued = sqlite3_step(stmt) == SQLITE_ROW;
+    sqlite3_finalize(stmt);
+    if (already_accrued)
+    {
+        printf("该日期已计提过滞纳金，执行计提不会产生新的账单\n");
+        return true;
+    }
+
+    if (sqlite3_prepare_v2(db->db, PREVIEW_LATE_FEES_SQL, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "准备计提预览失败: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+    sqlite3_bind_double(stmt, 1, rule.daily_rate);
+    sqlite3_bind_int(stmt, 2, rule.grace_days);
+    sqlite3_bind_double(stmt, 3, rule.cap_rate);
+    sqlite3_bind_int64(stmt, 4, accrual_date);
+
+    bool ok = collect_billing_preview(db, stmt, top_n, preview);
+    sqlite3_finalize(stmt);
+    return ok;
+}
+
+/**
+ * 按楼宇汇总滞纳金
+ *
+ * 滞纳金通过源账单的房屋关联到楼宇，停车位等未关联房屋的滞纳金单独归为一组
+ *
+ * @param db 数据库连接
+ * @param result 输出参数：楼宇名称、账单数、总额、已缴金额、未缴金额
+ * @return 成功返回true，失败返回false
+ */
+bool query_late_fees_by_building(Database *db, QueryResult *result)
+{
+    char query[1024];
+    snprintf(query, sizeof(query),
+             "SELECT COALESCE(b.building_name, '未关联楼宇') AS building_name, "
+             "COUNT(*) AS bill_count, "
+             "printf('%%.2f', SUM(t.amount)) AS total_amount, "
+             "printf('%%.2f', SUM(CASE WHEN t.status = %d THEN t.amount ELSE 0 END)) AS paid_amount, "
+             "printf('%%.2f', SUM(CASE WHEN t.status != %d THEN t.amount ELSE 0 END)) AS unpaid_amount "
+             "FROM transactions t "
+             "LEFT JOIN rooms r ON t.room_id = r.room_id "
+             "LEFT JOIN buildings b ON r.building_id = b.building_id "
+             "WHERE t.fee_type = %d "
+             "GROUP BY b.building_id "
+             "ORDER BY SUM(t.amount) DESC",
+             TRANS_PAID, TRANS_PAID, TRANS_LATE_FEE);
+
+    if (!execute_query(db, query, result))
+    {
+        printf("查询滞纳金统计失败\n");
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * 打印按楼宇汇总的滞纳金统计
+ *
+ * @param db 数据库连接
+ */
+void print_late_fee_building_summary(Database *db)
+{
+    QueryResult result;
+    if (!query_late_fees_by_building(db, &result))
+    {
+        return;
+    }
+
+    printf("\n各楼宇滞纳金统计：\n");
+    printf("------------------------------------------------------------------\n");
+    printf("%-16s %-10s %-14s %-14s %-14s\n", "楼宇名称", "账单数", "滞纳金总额", "已缴", "未缴");
+
+    if (result.row_count == 0)
+    {
+        printf("暂无滞纳金记录\n");
+    }
+
+    for (int i = 0; i < result.row_count; i++)
+    {
+        printf("%-16s %-10s %-14s %-14s %-14s\n",
+               result.rows[i].values[0],
+               result.rows[i].values[1],
+               result.rows[i].values[2],
+               result.rows[i].values[3],
+               result.rows[i].values[4]);
+    }
+
+    free_query_result(&result);
+}
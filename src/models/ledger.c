@@ -0,0 +1,324 @@
+#include "models/ledger.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LEDGER_COLUMNS \
+    "user_id, fee_type, billed_amount, paid_amount, overdue_amount, bill_count, unpaid_count, last_activity"
+
+// 金额比较容差（REAL累加误差）
+#define LEDGER_EPSILON "0.005"
+
+/**
+ * 从查询结果行读取账本
+ */
+static void read_ledger_row(sqlite3_stmt *stmt, OwnerLedger *ledger)
+{
+    const char *user_id = (const char *)sqlite3_column_text(stmt, 0);
+    strncpy(ledger->user_id, user_id ? user_id : "", sizeof(ledger->user_id) - 1);
+    ledger->user_id[sizeof(ledger->user_id) - 1] = '\0';
+    ledger->fee_type = sqlite3_column_int(stmt, 1);
+    ledger->billed_amount = sqlite3_column_double(stmt, 2);
+    ledger->paid_amount = sqlite3_column_double(stmt, 3);
+    ledger->overdue_amount = sqlite3_column_double(stmt, 4);
+    ledger->bill_count = sqlite3_column_int(stmt, 5);
+    ledger->unpaid_count = sqlite3_column_int(stmt, 6);
+    ledger->last_activity = (time_t)sqlite3_column_int64(stmt, 7);
+}
+
+/**
+ * 读取业主某一费用类型的账本
+ *
+ * 账本按(user_id, fee_type)主键存储，读取为单次点查，与业主账单数量无关
+ *
+ * @param db 数据库连接
+ * @param user_id 业主ID
+ * @param fee_type 费用类型，LEDGER_ALL_FEES表示合计
+ * @param ledger 输出参数，业主尚无该类型账单时为全零
+ * @return 成功返回true，失败返回false
+ */
+bool get_owner_ledger(Database *db, const char *user_id, int fee_type, OwnerLedger *ledger)
+{
+    static const char *LEDGER_GET_SQL =
+        "SELECT " LEDGER_COLUMNS " FROM owner_ledger WHERE user_id = ? AND fee_type = ?";
+    sqlite3_stmt *stmt;
+
+    memset(ledger, 0, sizeof(OwnerLedger));
+    strncpy(ledger->user_id, user_id, sizeof(ledger->user_id) - 1);
+    ledger->fee_type = fee_type;
+
+    if (db_prepare_cached(db, LEDGER_GET_SQL, &stmt) != SQLITE_OK)
+    {
+        fprintf(stderr, "查询业主账本失败: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+    sqlite3_bind_text(stmt, 1, user_id, -1, SQLITE_STATIC);
+    sqlite3_bind_int(stmt, 2, fee_type);
+
+    int rc = sqlite3_step(stmt);
+    if (rc == SQLITE_ROW)
+    {
+        read_ledger_row(stmt, ledger);
+    }
+    sqlite3_reset(stmt);
+
+    if (rc != SQLITE_ROW && rc != SQLITE_DONE)
+    {
+        fprintf(stderr, "查询业主账本失败: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+    return true;
+}
+
+/**
+ * 读取业主各费用类型的账本
+ *
+ * @param db 数据库连接
+ * @param user_id 业主ID
+ * @param ledgers 输出数组
+ * @param max_count 数组容量
+ * @return 读取的行数，出错返回-1
+ */
+int get_owner_ledger_by_type(Database *db, const char *user_id, OwnerLedger *ledgers, int max_count)
+{
+    static const char *LEDGER_BY_TYPE_SQL =
+        "SELECT " LEDGER_COLUMNS " FROM owner_ledger "
+        "WHERE user_id = ? AND fee_type <> 0 AND bill_count > 0 ORDER BY fee_type";
+    sqlite3_stmt *stmt;
+
+    if (db_prepare_cached(db, LEDGER_BY_TYPE_SQL, &stmt) != SQLITE_OK)
+    {
+        fprintf(stderr, "查询业主账本失败: %s\n", sqlite3_errmsg(db->db));
+        return -1;
+    }
+    sqlite3_bind_text(stmt, 1, user_id, -1, SQLITE_STATIC);
+
+    int count = 0;
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW && count < max_count)
+    {
+        read_ledger_row(stmt, &ledgers[count++]);
+    }
+    sqlite3_reset(stmt);
+
+    if (rc != SQLITE_ROW && rc != SQLITE_DONE)
+    {
+        fprintf(stderr, "查询业主账本失败: %s\n", sqlite3_errmsg(db->db));
+        return -1;
+    }
+    return count;
+}
+
+/**
+ * 按交易表重建账本
+ */
+static bool rebuild_owner_ledger(Database *db)
+{
+    const char *statements[] = {
+        "BEGIN IMMEDIATE",
+        "DELETE FROM owner_ledger",
+        "INSERT INTO owner_ledger (" LEDGER_COLUMNS ") SELECT * FROM owner_ledger_expected",
+        "COMMIT",
+        NULL};
+
+    for (int i = 0; statements[i]; i++)
+    {
+        char *err_msg = NULL;
+        if (sqlite3_exec(db->db, statements[i], NULL, NULL, &err_msg) != SQLITE_OK)
+        {
+            fprintf(stderr, "重建业主账本失败: %s\n", err_msg);
+            sqlite3_free(err_msg);
+            if (i > 0)
+            {
+                sqlite3_exec(db->db, "ROLLBACK", NULL, NULL, NULL);
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
+// 欠费项目名称，按费用类型排序；?1为费用类型过滤，0表示全部
+#define DEBTOR_FEE_TYPES_SQL(FROM_WHERE)                                                        \
+    "(SELECT GROUP_CONCAT(type_name, '、') FROM (SELECT DISTINCT CASE t.fee_type "               \
+    "   WHEN 1 THEN '物业费' WHEN 2 THEN '停车费' WHEN 3 THEN '水费' WHEN 4 THEN '电费' "        \
+    "   WHEN 5 THEN '燃气费' WHEN 6 THEN '滞纳金' ELSE '其他费用' END AS type_name "              \
+    "   " FROM_WHERE " AND t.status <> 1 AND (?1 = 0 OR t.fee_type = ?1) ORDER BY t.fee_type))"
+
+/**
+ * 欠费排行
+ *
+ * 全小区排行直接读取账本：账本由交易表触发器在出账、缴费时同步更新并随数据库持久化，
+ * (fee_type, 未结金额)上的表达式索引使排行成为一次有序索引扫描，按未结金额从高到低
+ * 取到k条即停止，不再对全部未缴账单汇总排序。
+ * 按楼宇排行时金额只计该楼宇房屋的账单（含其滞纳金），业主在其他楼宇的欠费不计入；
+ * 账本不区分楼宇，因此按楼宇内各房屋的账单汇总。楼宇、欠费项目等明细只对前k位业主查询。
+ *
+ * @param db 数据库连接
+ * @param fee_type 费用类型，LEDGER_ALL_FEES表示全部费用合计
+ * @param building_id 楼宇ID，NULL表示全小区
+ * @param k 取前k位
+ * @param ranks 输出数组，容量不小于k
+ * @return 条目数，出错返回-1
+ */
+int get_top_debtors(Database *db, int fee_type, const char *building_id, int k, DebtorRank *ranks)
+{
+    static const char *TOP_DEBTORS_SQL =
+        "SELECT l.user_id, l.fee_type, l.billed_amount, l.paid_amount, l.overdue_amount, "
+        "l.bill_count, l.unpaid_count, l.last_activity, u.name, u.phone_number, "
+        "(SELECT b.building_name || '-' || r.room_number FROM rooms r "
+        " JOIN buildings b ON b.building_id = r.building_id WHERE r.owner_id = l.user_id LIMIT 1), "
+        "(SELECT MIN(t.due_date) FROM transactions t "
+        " WHERE t.user_id = l.user_id AND t.status <> 1 AND (?1 = 0 OR t.fee_type = ?1)), "
+        DEBTOR_FEE_TYPES_SQL("FROM transactions t WHERE t.user_id = l.user_id") " "
+        "FROM owner_ledger l "
+        "JOIN users u ON u.user_id = l.user_id "
+        "WHERE l.fee_type = ?1 AND l.billed_amount - l.paid_amount > " LEDGER_EPSILON " "
+        "ORDER BY l.billed_amount - l.paid_amount DESC "
+        "LIMIT ?3";
+    static const char *TOP_DEBTORS_IN_BUILDING_SQL =
+        "WITH d AS (SELECT t.user_id, ?1 AS fee_type, SUM(t.amount) AS billed_amount, "
+        "  SUM(CASE WHEN t.status = 1 THEN t.amount ELSE 0 END) AS paid_amount, "
+        "  SUM(CASE WHEN t.status = 2 THEN t.amount ELSE 0 END) AS overdue_amount, "
+        "  COUNT(*) AS bill_count, SUM(t.status <> 1) AS unpaid_count, "
+        "  MAX(CASE WHEN t.status = 1 THEN t.payment_date ELSE t.period_start END) AS last_activity, "
+        "  MIN(CASE WHEN t.status <> 1 THEN t.due_date END) AS earliest_due "
+        "  FROM rooms r JOIN transactions t ON t.room_id = r.room_id "
+        "  WHERE r.building_id = ?2 AND (?1 = 0 OR t.fee_type = ?1) "
+        "  GROUP BY t.user_id "
+        "  HAVING SUM(CASE WHEN t.status <> 1 THEN t.amount ELSE 0 END) > " LEDGER_EPSILON ") "
+        "SELECT d.user_id, d.fee_type, d.billed_amount, d.paid_amount, d.overdue_amount, "
+        "d.bill_count, d.unpaid_count, d.last_activity, u.name, u.phone_number, "
+        "(SELECT b.building_name || '-' || r.room_number FROM rooms r "
+        " JOIN buildings b ON b.building_id = r.building_id "
+        " WHERE r.owner_id = d.user_id AND r.building_id = ?2 LIMIT 1), "
+        "d.earliest_due, "
+        DEBTOR_FEE_TYPES_SQL("FROM rooms r JOIN transactions t ON t.room_id = r.room_id "
+                             "WHERE r.building_id = ?2 AND t.user_id = d.user_id") " "
+        "FROM d JOIN users u ON u.user_id = d.user_id "
+        "ORDER BY d.billed_amount - d.paid_amount DESC "
+        "LIMIT ?3";
+    sqlite3_stmt *stmt;
+
+    if (db_prepare_cached(db, building_id ? TOP_DEBTORS_IN_BUILDING_SQL : TOP_DEBTORS_SQL, &stmt) != SQLITE_OK)
+    {
+        fprintf(stderr, "查询欠费排行失败: %s\n", sqlite3_errmsg(db->db));
+        return -1;
+    }
+    sqlite3_bind_int(stmt, 1, fee_type);
+    if (building_id)
+    {
+        sqlite3_bind_text(stmt, 2, building_id, -1, SQLITE_STATIC);
+    }
+    sqlite3_bind_int(stmt, 3, k);
+
+    int count = 0;
+    int rc = SQLITE_DONE;
+    while (count < k && (rc = sqlite3_step(stmt)) == SQLITE_ROW)
+    {
+        DebtorRank *rank = &ranks[count++];
+        memset(rank, 0, sizeof(DebtorRank));
+        read_ledger_row(stmt, &rank->ledger);
+
+        const char *text;
+        text = (const char *)sqlite3_column_text(stmt, 8);
+        snprintf(rank->name, sizeof(rank->name), "%s", text ? text : "");
+        text = (const char *)sqlite3_column_text(stmt, 9);
+        snprintf(rank->phone, sizeof(rank->phone), "%s", text ? text : "");
+        text = (const char *)sqlite3_column_text(stmt, 10);
+        snprintf(rank->address, sizeof(rank->address), "%s", text ? text : "未登记");
+        rank->earliest_due = (time_t)sqlite3_column_int64(stmt, 11);
+        text = (const char *)sqlite3_column_text(stmt, 12);
+        snprintf(rank->fee_types, sizeof(rank->fee_types), "%s", text ? text : "");
+    }
+    if (count < k && rc != SQLITE_DONE)
+    {
+        fprintf(stderr, "查询欠费排行失败: %s\n", sqlite3_errmsg(db->db));
+        count = -1;
+    }
+    sqlite3_reset(stmt);
+    return count;
+}
+
+/**
+ * 核对业主账本
+ *
+ * 将owner_ledger与按交易表重新汇总的结果（owner_ledger_expected视图）逐行比较，
+ * 打印金额或笔数不一致、缺失或多余的账本行。最近活动时间不参与核对。
+ *
+ * @param db 数据库连接
+ * @param repair 存在差异时是否按交易表重建账本
+ * @param audit 输出参数，核对结果
+ * @return 核对（及修复）成功返回true，失败返回false
+ */
+bool audit_owner_ledger(Database *db, bool repair, LedgerAudit *audit)
+{
+    const char *query =
+        "WITH e AS MATERIALIZED (SELECT * FROM owner_ledger_expected) "
+        "SELECT e.user_id, e.fee_type, e.billed_amount, l.billed_amount, e.paid_amount, l.paid_amount, "
+        "e.overdue_amount, l.overdue_amount, e.bill_count, l.bill_count, e.unpaid_count, l.unpaid_count "
+        "FROM e LEFT JOIN owner_ledger l ON l.user_id = e.user_id AND l.fee_type = e.fee_type "
+        "WHERE l.user_id IS NULL "
+        "OR ABS(e.billed_amount - l.billed_amount) > " LEDGER_EPSILON " "
+        "OR ABS(e.paid_amount - l.paid_amount) > " LEDGER_EPSILON " "
+        "OR ABS(e.overdue_amount - l.overdue_amount) > " LEDGER_EPSILON " "
+        "OR e.bill_count <> l.bill_count OR e.unpaid_count <> l.unpaid_count "
+        "UNION ALL "
+        "SELECT l.user_id, l.fee_type, 0, l.billed_amount, 0, l.paid_amount, "
+        "0, l.overdue_amount, 0, l.bill_count, 0, l.unpaid_count "
+        "FROM owner_ledger l LEFT JOIN e ON e.user_id = l.user_id AND e.fee_type = l.fee_type "
+        "WHERE e.user_id IS NULL AND (l.bill_count <> 0 OR ABS(l.billed_amount) > " LEDGER_EPSILON ") "
+        "ORDER BY 1, 2";
+
+    memset(audit, 0, sizeof(LedgerAudit));
+
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(db->db, "SELECT COUNT(*) FROM owner_ledger", -1, &stmt, NULL) == SQLITE_OK)
+    {
+        if (sqlite3_step(stmt) == SQLITE_ROW)
+        {
+            audit->rows_checked = sqlite3_column_int(stmt, 0);
+        }
+        sqlite3_finalize(stmt);
+    }
+
+    if (sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "核对业主账本失败: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+    {
+        if (audit->mismatch_count == 0)
+        {
+            printf("%-38s %-6s %-22s %-22s %-22s %-10s\n",
+                   "业主ID", "类型", "应缴(交易/账本)", "已缴(交易/账本)", "逾期(交易/账本)", "笔数");
+        }
+        audit->mismatch_count++;
+        printf("%-38s %-6d %10.2f/%-10.2f %10.2f/%-10.2f %10.2f/%-10.2f %d/%d\n",
+               sqlite3_column_text(stmt, 0), sqlite3_column_int(stmt, 1),
+               sqlite3_column_double(stmt, 2), sqlite3_column_double(stmt, 3),
+               sqlite3_column_double(stmt, 4), sqlite3_column_double(stmt, 5),
+               sqlite3_column_double(stmt, 6), sqlite3_column_double(stmt, 7),
+               sqlite3_column_int(stmt, 8), sqlite3_column_int(stmt, 9));
+    }
+    sqlite3_finalize(stmt);
+
+    if (rc != SQLITE_DONE)
+    {
+        fprintf(stderr, "核对业主账本失败: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+
+    if (repair && audit->mismatch_count > 0)
+    {
+        if (!rebuild_owner_ledger(db))
+        {
+            return false;
+        }
+        audit->repaired = true;
+    }
+    return true;
+}
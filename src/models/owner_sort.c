@@ -0,0 +1,308 @@
+#include "models/owner_sort.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEXT_BLOCK_SIZE (64 * 1024)
+
+// 字段名：英文名、中文名
+static const char *FIELD_NAMES[OWNER_SORT_FIELD_COUNT][2] = {
+    {"outstanding", "欠费"}, {"area", "面积"},           {"building", "楼宇"},
+    {"room", "房号"},        {"registered", "注册时间"}, {"name", "姓名"},
+};
+
+// 每位业主取第一套房屋，欠费取账本合计行
+static const char *LOAD_OWNERS_SQL =
+    "SELECT u.user_id, u.name, u.phone_number, b.building_name, r.room_number, r.area_sqm, "
+    "u.registration_date, COALESCE(l.billed_amount - l.paid_amount, 0) "
+    "FROM users u "
+    "LEFT JOIN rooms r ON r.rowid = (SELECT rowid FROM rooms WHERE owner_id = u.user_id ORDER BY rowid LIMIT 1) "
+    "LEFT JOIN buildings b ON b.building_id = r.building_id "
+    "LEFT JOIN owner_ledger l ON l.user_id = u.user_id AND l.fee_type = 0 "
+    "WHERE u.role_id = 'role_owner'";
+
+/**
+ * 解析排序说明
+ *
+ * 各字段以逗号分隔，字段后可跟":desc"（或":降序"）表示降序，":asc"（或":升序"）表示升序
+ *
+ * @param spec 排序说明
+ * @param keys 输出参数，排序键
+ * @param max_keys keys的容量
+ * @param key_count 输出参数，键数
+ * @return 格式正确返回true
+ */
+bool owner_sort_parse(const char *spec, OwnerSortKey *keys, int max_keys, int *key_count)
+{
+    *key_count = 0;
+    const char *pos = spec;
+    while (pos && *pos)
+    {
+        const char *end = strchr(pos, ',');
+        size_t len = end ? (size_t)(end - pos) : strlen(pos);
+        char token[64];
+        if (len >= sizeof(token))
+        {
+            printf("排序字段过长\n");
+            return false;
+        }
+        memcpy(token, pos, len);
+        token[len] = '\0';
+        pos = end ? end + 1 : NULL;
+
+        char *name = token;
+        while (*name == ' ')
+            name++;
+        char *tail = name + strlen(name);
+        while (tail > name && tail[-1] == ' ')
+            *--tail = '\0';
+        if (!*name)
+        {
+            continue;
+        }
+
+        bool descending = false;
+        char *direction = strchr(name, ':');
+        if (direction)
+        {
+            *direction++ = '\0';
+            if (strcmp(direction, "desc") == 0 || strcmp(direction, "降序") == 0)
+                descending = true;
+            else if (strcmp(direction, "asc") != 0 && strcmp(direction, "升序") != 0)
+            {
+                printf("未知排序方向: %s\n", direction);
+                return false;
+            }
+        }
+
+        int field = 0;
+        while (field < OWNER_SORT_FIELD_COUNT && strcmp(name, FIELD_NAMES[field][0]) != 0 &&
+               strcmp(name, FIELD_NAMES[field][1]) != 0)
+        {
+            field++;
+        }
+        if (field == OWNER_SORT_FIELD_COUNT)
+        {
+            printf("未知排序字段: %s\n", name);
+            return false;
+        }
+        if (*key_count >= max_keys)
+        {
+            printf("排序字段不能超过%d个\n", max_keys);
+            return false;
+        }
+        keys[*key_count].field = (OwnerSortField)field;
+        keys[*key_count].descending = descending;
+        (*key_count)++;
+    }
+    if (*key_count == 0)
+    {
+        printf("请指定排序字段\n");
+        return false;
+    }
+    return true;
+}
+
+const char *owner_sort_field_title(OwnerSortField field)
+{
+    return field < OWNER_SORT_FIELD_COUNT ? FIELD_NAMES[field][1] : "";
+}
+
+/**
+ * 复制一个字符串到存储块，NULL原样返回
+ */
+static const char *copy_text(OwnerSortTable *table, const unsigned char *text, int len)
+{
+    if (!text)
+    {
+        return NULL;
+    }
+    size_t need = (size_t)len + 1;
+    OwnerSortText *block = table->text;
+    if (!block || block->size - block->used < need)
+    {
+        size_t size = need > TEXT_BLOCK_SIZE ? need : TEXT_BLOCK_SIZE;
+        block = malloc(sizeof(OwnerSortText) + size);
+        if (!block)
+        {
+            return NULL;
+        }
+        block->next = table->text;
+        block->used = 0;
+        block->size = size;
+        table->text = block;
+    }
+    char *copy = block->data + block->used;
+    memcpy(copy, text, (size_t)len);
+    copy[len] = '\0';
+    block->used += need;
+    return copy;
+}
+
+/**
+ * 载入业主数据
+ *
+ * 先取业主数，按数量一次分配各列，再逐行填充；两次查询在同一读事务内
+ *
+ * @param db 数据库连接
+ * @param table 输出参数，业主数据
+ * @return 成功返回true
+ */
+bool owner_sort_load(Database *db, OwnerSortTable *table)
+{
+    memset(table, 0, sizeof(OwnerSortTable));
+    bool own_transaction = sqlite3_get_autocommit(db->db);
+    if (own_transaction)
+    {
+        sqlite3_exec(db->db, "BEGIN", 0, 0, 0);
+    }
+
+    sqlite3_stmt *stmt;
+    size_t capacity = 0;
+    if (sqlite3_prepare_v2(db->db, "SELECT COUNT(*) FROM users WHERE role_id = 'role_owner'", -1, &stmt, NULL) ==
+        SQLITE_OK)
+    {
+        if (sqlite3_step(stmt) == SQLITE_ROW)
+            capacity = (size_t)sqlite3_column_int64(stmt, 0);
+        sqlite3_finalize(stmt);
+    }
+
+    size_t n = capacity > 0 ? capacity : 1;
+    table->user_ids = malloc(n * sizeof(char *));
+    table->names = malloc(n * sizeof(char *));
+    table->phones = malloc(n * sizeof(char *));
+    table->buildings = malloc(n * sizeof(char *));
+    table->rooms = malloc(n * sizeof(char *));
+    table->outstanding = malloc(n * sizeof(double));
+    table->areas = malloc(n * sizeof(double));
+    table->area_nulls = malloc(n);
+    table->registered = malloc(n * sizeof(int64_t));
+    table->order = malloc(n * sizeof(uint32_t));
+    bool ok = table->user_ids && table->names && table->phones && table->buildings && table->rooms &&
+              table->outstanding && table->areas && table->area_nulls && table->registered && table->order;
+    if (!ok)
+    {
+        printf("内存分配失败：业主数据\n");
+    }
+
+    if (ok && sqlite3_prepare_v2(db->db, LOAD_OWNERS_SQL, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "准备业主查询失败: %s\n", sqlite3_errmsg(db->db));
+        ok = false;
+    }
+    int rc = SQLITE_DONE;
+    while (ok && table->count < capacity && (rc = sqlite3_step(stmt)) == SQLITE_ROW)
+    {
+        size_t i = table->count;
+        table->user_ids[i] = copy_text(table, sqlite3_column_text(stmt, 0), sqlite3_column_bytes(stmt, 0));
+        table->names[i] = copy_text(table, sqlite3_column_text(stmt, 1), sqlite3_column_bytes(stmt, 1));
+        table->phones[i] = copy_text(table, sqlite3_column_text(stmt, 2), sqlite3_column_bytes(stmt, 2));
+        table->buildings[i] = copy_text(table, sqlite3_column_text(stmt, 3), sqlite3_column_bytes(stmt, 3));
+        table->rooms[i] = copy_text(table, sqlite3_column_text(stmt, 4), sqlite3_column_bytes(stmt, 4));
+        table->area_nulls[i] = sqlite3_column_type(stmt, 5) == SQLITE_NULL;
+        table->areas[i] = sqlite3_column_double(stmt, 5);
+        table->registered[i] = sqlite3_column_int64(stmt, 6);
+        table->outstanding[i] = sqlite3_column_double(stmt, 7);
+        if (!table->user_ids[i] || !table->names[i])
+        {
+            printf("内存分配失败：业主数据\n");
+            ok = false;
+            break;
+        }
+        table->order[i] = (uint32_t)i;
+        table->count++;
+    }
+    if (ok && rc != SQLITE_DONE && rc != SQLITE_ROW)
+    {
+        fprintf(stderr, "读取业主失败: %s\n", sqlite3_errmsg(db->db));
+        ok = false;
+    }
+    sqlite3_finalize(stmt);
+
+    if (own_transaction)
+    {
+        sqlite3_exec(db->db, "COMMIT", 0, 0, 0);
+    }
+    if (!ok)
+    {
+        owner_sort_free(table);
+    }
+    return ok;
+}
+
+/**
+ * 按多个字段排序
+ *
+ * 各字段直接引用表中的列数组，由row_sort编码成二进制键后基数排序
+ *
+ * @param table 业主数据
+ * @param keys 排序键，按优先级排列
+ * @param key_count 键数
+ * @param stats 输出参数，可为NULL
+ * @return 成功返回true
+ */
+bool owner_sort_apply(OwnerSortTable *table, const OwnerSortKey *keys, int key_count, RowSortStats *stats)
+{
+    if (key_count < 1 || key_count > ROW_SORT_MAX_COLUMNS)
+    {
+        return false;
+    }
+    RowSortColumn columns[ROW_SORT_MAX_COLUMNS];
+    memset(columns, 0, sizeof(columns));
+    for (int i = 0; i < key_count; i++)
+    {
+        RowSortColumn *column = &columns[i];
+        column->descending = keys[i].descending;
+        switch (keys[i].field)
+        {
+        case OWNER_SORT_OUTSTANDING:
+            column->type = ROW_SORT_REAL;
+            column->reals = table->outstanding;
+            break;
+        case OWNER_SORT_AREA:
+            column->type = ROW_SORT_REAL;
+            column->reals = table->areas;
+            column->nulls = table->area_nulls;
+            break;
+        case OWNER_SORT_BUILDING:
+            column->type = ROW_SORT_TEXT;
+            column->texts = table->buildings;
+            break;
+        case OWNER_SORT_ROOM:
+            column->type = ROW_SORT_TEXT;
+            column->texts = table->rooms;
+            break;
+        case OWNER_SORT_REGISTERED:
+            column->type = ROW_SORT_INT;
+            column->ints = table->registered;
+            break;
+        case OWNER_SORT_NAME:
+        default:
+            column->type = ROW_SORT_TEXT;
+            column->texts = table->names;
+            break;
+        }
+    }
+    return row_sort(columns, key_count, table->count, NULL, table->order, stats);
+}
+
+void owner_sort_free(OwnerSortTable *table)
+{
+    free(table->user_ids);
+    free(table->names);
+    free(table->phones);
+    free(table->buildings);
+    free(table->rooms);
+    free(table->outstanding);
+    free(table->areas);
+    free(table->area_nulls);
+    free(table->registered);
+    free(table->order);
+    while (table->text)
+    {
+        OwnerSortText *next = table->text->next;
+        free(table->text);
+        table->text = next;
+    }
+    memset(table, 0, sizeof(OwnerSortTable));
+}
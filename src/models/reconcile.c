@@ -0,0 +1,546 @@
+#include "models/reconcile.h"
+#include "models/transaction.h"
+#include "utils/csv.h"
+#include "utils/hash_map.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+#define strcasecmp _stricmp
+#else
+#include <strings.h>
+#endif
+
+// 组合键的字段分隔符
+#define KEY_SEP '\x1f'
+
+// 待匹配的未结账单
+typedef struct
+{
+    char transaction_id[40];
+    char reference[40]; // 规范化后的交易编号，用于匹配
+    char user_id[40];
+    char phone[24];
+    long long cents; // 金额（分）
+    bool settled;    // 本次导入中已被某条流水结清
+} OpenBill;
+
+// 同一付款人同一金额存在多笔未结账单时的占位标记
+static OpenBill ambiguous_bill;
+
+// 对账单列序号
+typedef struct
+{
+    int reference;
+    int amount;
+    int payer;
+    int serial;
+    int method;
+    int paid_at;
+} StatementColumns;
+
+static const char *REFERENCE_HEADERS[] = {"reference", "ref", "参考号", "备注", "交易编号", NULL};
+static const char *AMOUNT_HEADERS[] = {"amount", "金额", "到账金额", NULL};
+static const char *PAYER_HEADERS[] = {"payer", "phone", "付款人", "手机号", "付款人手机", NULL};
+static const char *SERIAL_HEADERS[] = {"serial", "流水号", "交易单号", NULL};
+static const char *METHOD_HEADERS[] = {"method", "支付方式", "渠道", NULL};
+static const char *PAID_AT_HEADERS[] = {"paid_at", "time", "交易时间", "到账时间", NULL};
+
+/**
+ * 规范化手机号：只保留数字，去掉86国家码
+ */
+static void normalize_phone(const char *src, char *dest, size_t size)
+{
+    size_t n = 0;
+    for (; src && *src && n + 1 < size; src++)
+    {
+        if (isdigit((unsigned char)*src))
+        {
+            dest[n++] = *src;
+        }
+    }
+    dest[n] = '\0';
+
+    if (n == 13 && strncmp(dest, "86", 2) == 0)
+    {
+        memmove(dest, dest + 2, n - 1);
+    }
+}
+
+/**
+ * 规范化参考号：去掉首尾空白并转为小写
+ */
+static void normalize_reference(const char *src, char *dest, size_t size)
+{
+    while (src && isspace((unsigned char)*src))
+    {
+        src++;
+    }
+    size_t n = 0;
+    for (; src && *src && n + 1 < size; src++)
+    {
+        dest[n++] = (char)tolower((unsigned char)*src);
+    }
+    while (n > 0 && isspace((unsigned char)dest[n - 1]))
+    {
+        n--;
+    }
+    dest[n] = '\0';
+}
+
+/**
+ * 解析金额为分，忽略货币符号和千分位，无效返回-1
+ */
+static long long parse_cents(const char *text)
+{
+    char digits[64];
+    size_t n = 0;
+    for (; text && *text && n + 1 < sizeof(digits); text++)
+    {
+        if (isdigit((unsigned char)*text) || *text == '.' || *text == '-')
+        {
+            digits[n++] = *text;
+        }
+    }
+    digits[n] = '\0';
+
+    char *end;
+    double value = strtod(digits, &end);
+    if (n == 0 || *end != '\0' || value <= 0)
+    {
+        return -1;
+    }
+    return (long long)(value * 100 + 0.5);
+}
+
+/**
+ * 解析支付方式，无法识别时返回默认值
+ */
+static int parse_method(const char *text, int default_method)
+{
+    if (!text || !*text)
+        return default_method;
+    if (strcasecmp(text, "wechat") == 0 || strstr(text, "微信"))
+        return PAYMENT_WECHAT;
+    if (strcasecmp(text, "alipay") == 0 || strstr(text, "支付宝"))
+        return PAYMENT_ALIPAY;
+    if (strcasecmp(text, "card") == 0 || strcasecmp(text, "bank") == 0 || strstr(text, "银行"))
+        return PAYMENT_CARD;
+    if (strcasecmp(text, "cash") == 0 || strstr(text, "现金"))
+        return PAYMENT_CASH;
+    if (isdigit((unsigned char)text[0]))
+        return atoi(text);
+    return default_method;
+}
+
+/**
+ * 解析交易时间，无法识别时返回默认值
+ */
+static time_t parse_paid_at(const char *text, time_t default_time)
+{
+    struct tm tm_paid = {0};
+    int year, month, day, hour = 0, minute = 0, second = 0;
+    if (!text || sscanf(text, "%d%*[-/]%d%*[-/]%d %d:%d:%d", &year, &month, &day, &hour, &minute, &second) < 3)
+    {
+        return default_time;
+    }
+    tm_paid.tm_year = year - 1900;
+    tm_paid.tm_mon = month - 1;
+    tm_paid.tm_mday = day;
+    tm_paid.tm_hour = hour;
+    tm_paid.tm_min = minute;
+    tm_paid.tm_sec = second;
+    tm_paid.tm_isdst = -1;
+    time_t t = mktime(&tm_paid);
+    return t == (time_t)-1 ? default_time : t;
+}
+
+/**
+ * 拼接组合键，返回键长度
+ */
+static size_t make_key(char *key, size_t size, const char *a, long long cents, const char *b)
+{
+    int n;
+    if (b)
+        n = snprintf(key, size, "%s%c%lld%c%s", a, KEY_SEP, cents, KEY_SEP, b);
+    else
+        n = snprintf(key, size, "%s%c%lld", a, KEY_SEP, cents);
+    return n < 0 ? 0 : ((size_t)n < size ? (size_t)n : size - 1);
+}
+
+/**
+ * 一次扫描载入全部未结账单
+ */
+static OpenBill *load_open_bills(Database *db, long *count)
+{
+    const char *query =
+        "SELECT t.transaction_id, t.user_id, t.amount, COALESCE(u.phone_number, '') "
+        "FROM transactions t JOIN users u ON t.user_id = u.user_id "
+        "WHERE t.status IN (0, 2)";
+
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "查询未结账单失败: %s\n", sqlite3_errmsg(db->db));
+        return NULL;
+    }
+
+    OpenBill *bills = NULL;
+    long n = 0, capacity = 0;
+    while (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        if (n == capacity)
+        {
+            capacity = capacity ? capacity * 2 : 1024;
+            OpenBill *grown = realloc(bills, capacity * sizeof(OpenBill));
+            if (!grown)
+            {
+                free(bills);
+                sqlite3_finalize(stmt);
+                fprintf(stderr, "内存分配失败：未结账单\n");
+                return NULL;
+            }
+            bills = grown;
+        }
+
+        OpenBill *bill = &bills[n++];
+        memset(bill, 0, sizeof(OpenBill));
+        strncpy(bill->transaction_id, (const char *)sqlite3_column_text(stmt, 0), sizeof(bill->transaction_id) - 1);
+        normalize_reference(bill->transaction_id, bill->reference, sizeof(bill->reference));
+        strncpy(bill->user_id, (const char *)sqlite3_column_text(stmt, 1), sizeof(bill->user_id) - 1);
+        bill->cents = (long long)(sqlite3_column_double(stmt, 2) * 100 + 0.5);
+        normalize_phone((const char *)sqlite3_column_text(stmt, 3), bill->phone, sizeof(bill->phone));
+    }
+    sqlite3_finalize(stmt);
+
+    *count = n;
+    return bills ? bills : calloc(1, sizeof(OpenBill));
+}
+
+/**
+ * 写一个CSV字段，必要时加引号
+ */
+static void write_csv_field(FILE *fp, const char *value, bool last)
+{
+    if (!value)
+        value = "";
+    if (strpbrk(value, ",\"\r\n"))
+    {
+        fputc('"', fp);
+        for (; *value; value++)
+        {
+            if (*value == '"')
+                fputc('"', fp);
+            fputc(*value, fp);
+        }
+        fputc('"', fp);
+    }
+    else
+    {
+        fputs(value, fp);
+    }
+    fputc(last ? '\n' : ',', fp);
+}
+
+/**
+ * 写一条异常记录
+ */
+static void report_exception(FILE *report, ReconcileSummary *summary, long line_no, const char *serial,
+                             const char *reference, const char *amount, const char *payer, const char *reason)
+{
+    char line[24];
+    snprintf(line, sizeof(line), "%ld", line_no);
+    write_csv_field(report, line, false);
+    write_csv_field(report, serial, false);
+    write_csv_field(report, reference, false);
+    write_csv_field(report, amount, false);
+    write_csv_field(report, payer, false);
+    write_csv_field(report, reason, true);
+    summary->exception_count++;
+}
+
+/**
+ * 读取一列的值，列不存在时返回空串
+ */
+static const char *column_value(const CsvReader *reader, int column)
+{
+    return (column >= 0 && column < reader->field_count) ? reader->fields[column] : "";
+}
+
+/**
+ * 参考号不在未结账单中时，区分账单已支付和不存在
+ */
+static const char *classify_missing_reference(Database *db, const char *reference)
+{
+    static const char *STATUS_SQL = "SELECT status FROM transactions WHERE transaction_id = ?";
+    sqlite3_stmt *stmt;
+    const char *reason = "参考号不存在";
+
+    if (db_prepare_cached(db, STATUS_SQL, &stmt) == SQLITE_OK)
+    {
+        sqlite3_bind_text(stmt, 1, reference, -1, SQLITE_STATIC);
+        if (sqlite3_step(stmt) == SQLITE_ROW && sqlite3_column_int(stmt, 0) == TRANS_PAID)
+        {
+            reason = "账单已支付（可能已对账）";
+        }
+        sqlite3_reset(stmt);
+    }
+    return reason;
+}
+
+/**
+ * 流水号此前是否已对账入账（重复导入同一对账单）
+ */
+static bool serial_already_reconciled(Database *db, const char *idempotency_key)
+{
+    static const char *FIND_SQL = "SELECT 1 FROM payment_requests WHERE idempotency_key = ? LIMIT 1";
+    sqlite3_stmt *stmt;
+    bool found = false;
+
+    if (db_prepare_cached(db, FIND_SQL, &stmt) == SQLITE_OK)
+    {
+        sqlite3_bind_text(stmt, 1, idempotency_key, -1, SQLITE_STATIC);
+        found = sqlite3_step(stmt) == SQLITE_ROW;
+        sqlite3_reset(stmt);
+    }
+    return found;
+}
+
+/**
+ * 导入对账单
+ *
+ * 先一次扫描载入全部未结账单，按"参考号+金额+付款人"、"参考号"和"付款人+金额"
+ * 建立三个哈希索引；随后流式读取对账单，每条流水只做常数次哈希查找：
+ * 三要素完全一致的直接匹配；没有参考号时，付款人和金额唯一对应一笔未结账单也视为匹配；
+ * 其余情况（金额不符、付款人不符、无法唯一确定、重复流水等）写入异常报告。
+ * 匹配成功的流水在同一事务内经支付流程入账，幂等键取外部流水号（无流水号时取账单号），
+ * 同一对账单重复导入不会重复入账。
+ *
+ * @param db 数据库连接
+ * @param statement_path 对账单CSV路径
+ * @param default_method 对账单未注明支付方式时使用的支付方式
+ * @param report_path 异常报告CSV路径
+ * @param summary 输出参数，对账结果汇总
+ * @return 成功返回true，失败返回false（已回滚，不会部分入账）
+ */
+bool reconcile_statement(Database *db, const char *statement_path, int default_method,
+                         const char *report_path, ReconcileSummary *summary)
+{
+    struct timespec started, finished;
+    clock_gettime(CLOCK_MONOTONIC, &started);
+    memset(summary, 0, sizeof(ReconcileSummary));
+
+    CsvReader reader;
+    if (!csv_reader_open(&reader, statement_path, ','))
+    {
+        printf("无法打开对账单: %s\n", statement_path);
+        return false;
+    }
+
+    StatementColumns columns;
+    if (csv_read_record(&reader) <= 0)
+    {
+        printf("对账单为空\n");
+        csv_reader_close(&reader);
+        return false;
+    }
+    columns.reference = csv_find_column(&reader, REFERENCE_HEADERS);
+    columns.amount = csv_find_column(&reader, AMOUNT_HEADERS);
+    columns.payer = csv_find_column(&reader, PAYER_HEADERS);
+    columns.serial = csv_find_column(&reader, SERIAL_HEADERS);
+    columns.method = csv_find_column(&reader, METHOD_HEADERS);
+    columns.paid_at = csv_find_column(&reader, PAID_AT_HEADERS);
+
+    if (columns.amount < 0 || (columns.reference < 0 && columns.payer < 0))
+    {
+        printf("对账单缺少必要的列：需要金额列，以及参考号或付款人列\n");
+        csv_reader_close(&reader);
+        return false;
+    }
+
+    FILE *report = fopen(report_path, "wb");
+    if (!report)
+    {
+        printf("无法创建异常报告: %s\n", report_path);
+        csv_reader_close(&reader);
+        return false;
+    }
+    fputs("\xEF\xBB\xBF", report); // BOM，便于Excel识别UTF-8
+    fputs("行号,流水号,参考号,金额,付款人,原因\n", report);
+
+    long bill_count = 0;
+    OpenBill *bills = load_open_bills(db, &bill_count);
+    HashMap by_triple, by_reference, by_payer_amount;
+    memset(&by_triple, 0, sizeof(HashMap));
+    memset(&by_reference, 0, sizeof(HashMap));
+    memset(&by_payer_amount, 0, sizeof(HashMap));
+    bool ok = bills != NULL &&
+              hash_map_init(&by_triple, bill_count) &&
+              hash_map_init(&by_reference, bill_count) &&
+              hash_map_init(&by_payer_amount, bill_count);
+
+    char key[160];
+    for (long i = 0; ok && i < bill_count; i++)
+    {
+        OpenBill *bill = &bills[i];
+        size_t len = make_key(key, sizeof(key), bill->reference, bill->cents, bill->phone);
+        ok = hash_map_put(&by_triple, key, len, bill) &&
+             hash_map_put(&by_reference, bill->reference, strlen(bill->reference), bill);
+        if (ok && bill->phone[0])
+        {
+            len = make_key(key, sizeof(key), bill->phone, bill->cents, NULL);
+            void **slot = hash_map_lookup(&by_payer_amount, key, len);
+            if (slot)
+                *slot = &ambiguous_bill;
+            else
+                ok = hash_map_put(&by_payer_amount, key, len, bill);
+        }
+    }
+
+    if (ok && sqlite3_exec(db->db, "BEGIN IMMEDIATE", 0, 0, 0) != SQLITE_OK)
+    {
+        fprintf(stderr, "无法开始事务: %s\n", sqlite3_errmsg(db->db));
+        ok = false;
+    }
+
+    time_t now = time(NULL);
+    int fields;
+    while (ok && (fields = csv_read_record(&reader)) != 0)
+    {
+        if (fields < 0)
+        {
+            ok = false;
+            break;
+        }
+        if (fields == 1 && reader.fields[0][0] == '\0')
+        {
+            continue; // 空行
+        }
+        summary->line_count++;
+
+        const char *raw_amount = column_value(&reader, columns.amount);
+        const char *raw_payer = column_value(&reader, columns.payer);
+        const char *serial = column_value(&reader, columns.serial);
+        const char *raw_reference = column_value(&reader, columns.reference);
+        char reference[64], phone[24];
+        normalize_reference(raw_reference, reference, sizeof(reference));
+        normalize_phone(raw_payer, phone, sizeof(phone));
+
+        long long cents = parse_cents(raw_amount);
+        if (cents < 0)
+        {
+            report_exception(report, summary, reader.line_no, serial, raw_reference, raw_amount, raw_payer, "金额格式错误");
+            continue;
+        }
+
+        OpenBill *bill = NULL;
+        const char *reason = NULL;
+
+        if (reference[0])
+        {
+            size_t len = make_key(key, sizeof(key), reference, cents, phone);
+            bill = hash_map_get(&by_triple, key, len);
+            if (!bill)
+            {
+                OpenBill *candidate = hash_map_get(&by_reference, reference, strlen(reference));
+                if (!candidate)
+                    reason = classify_missing_reference(db, reference);
+                else if (candidate->cents != cents)
+                    reason = "金额与账单不符";
+                else
+                    reason = "付款人与账单业主不符";
+            }
+        }
+        else if (phone[0])
+        {
+            size_t len = make_key(key, sizeof(key), phone, cents, NULL);
+            bill = hash_map_get(&by_payer_amount, key, len);
+            if (bill == &ambiguous_bill)
+            {
+                bill = NULL;
+                reason = "该付款人有多笔同金额账单，无法唯一匹配";
+            }
+            else if (!bill)
+            {
+                reason = "未找到该付款人同金额的未结账单";
+            }
+        }
+        else
+        {
+            reason = "缺少参考号和付款人";
+        }
+
+        if (bill && bill->settled)
+        {
+            bill = NULL;
+            reason = "重复流水：账单已被本对账单中的其他流水结清";
+        }
+
+        char idempotency_key[96];
+        if (!bill)
+        {
+            snprintf(idempotency_key, sizeof(idempotency_key), "recon:%s", serial);
+            if (serial[0] && serial_already_reconciled(db, idempotency_key))
+            {
+                summary->replayed_count++;
+                continue;
+            }
+            report_exception(report, summary, reader.line_no, serial, raw_reference, raw_amount, raw_payer, reason);
+            continue;
+        }
+
+        snprintf(idempotency_key, sizeof(idempotency_key), "recon:%s", serial[0] ? serial : bill->transaction_id);
+
+        double paid = 0;
+        PaymentOutcome outcome = pay_transaction_at(db, bill->transaction_id, bill->user_id,
+                                                    parse_method(column_value(&reader, columns.method), default_method),
+                                                    idempotency_key,
+                                                    parse_paid_at(column_value(&reader, columns.paid_at), now),
+                                                    &paid);
+        switch (outcome)
+        {
+        case PAY_SUCCESS:
+            bill->settled = true;
+            summary->matched_count++;
+            summary->matched_amount += paid;
+            break;
+        case PAY_REPLAYED:
+            bill->settled = true;
+            summary->replayed_count++;
+            break;
+        case PAY_FAILED:
+            ok = false;
+            break;
+        default:
+            report_exception(report, summary, reader.line_no, serial, raw_reference, raw_amount, raw_payer,
+                             payment_outcome_message(outcome));
+            break;
+        }
+    }
+
+    if (ok && sqlite3_exec(db->db, "COMMIT", 0, 0, 0) != SQLITE_OK)
+    {
+        ok = false;
+    }
+    if (!ok)
+    {
+        fprintf(stderr, "对账入账失败，已回滚: %s\n", sqlite3_errmsg(db->db));
+        sqlite3_exec(db->db, "ROLLBACK", 0, 0, 0);
+        summary->matched_count = 0;
+        summary->matched_amount = 0;
+    }
+
+    hash_map_free(&by_triple);
+    hash_map_free(&by_reference);
+    hash_map_free(&by_payer_amount);
+    free(bills);
+    fclose(report);
+    csv_reader_close(&reader);
+
+    clock_gettime(CLOCK_MONOTONIC, &finished);
+    summary->elapsed_seconds = (finished.tv_sec - started.tv_sec) + (finished.tv_nsec - started.tv_nsec) / 1e9;
+    return ok;
+}
@@ -0,0 +1,599 @@
+#include "models/reminder.h"
+#include "utils/file_ops.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+const char *DEFAULT_REMINDER_TEMPLATE =
+    "尊敬的{name}业主:\n\n"
+    "您好！我们的系统显示您目前有以下费用未缴纳：\n"
+    "总金额：{amount}元\n"
+    "{overdue_notice}"
+    "费用类型：{fee_types}\n\n"
+    "请您及时缴纳费用。如已缴费请忽略此提醒。\n\n"
+    "发送时间：{date}\n"
+    "灰灰小区物业服务中心";
+
+const char *DEFAULT_OVERDUE_NOTICE_TEMPLATE =
+    "其中逾期费用：{overdue_amount}元，已逾期{overdue_days}天\n"
+    "请注意：逾期将按规定计收滞纳金\n\n";
+
+static const char *FIELD_NAMES[] = {
+    "name", "amount", "overdue_amount", "overdue_days", "fee_types", "date", "overdue_notice"};
+
+// 欠费类型名称，下标为 MIN(fee_type, 7)
+static const char *FEE_TYPE_NAMES[] = {"其他费用", "物业费", "停车费", "水费", "电费", "燃气费", "滞纳金", "其他费用"};
+
+// 按业主汇总欠费，并标记去重窗口内是否已提醒过
+// 参数: ?1 当前时间  ?2 去重窗口起点  ?3 业主ID（NULL表示全部业主）
+// fee_mask 为各欠费类型的位掩码（第 MIN(fee_type, 7) 位）
+static const char *REMINDER_CANDIDATES_SQL =
+    "SELECT t.user_id, u.name, SUM(t.amount), "
+    "SUM(CASE WHEN t.status = 2 OR t.due_date < ?1 THEN t.amount ELSE 0 END), "
+    "MAX(CASE WHEN t.status = 2 OR t.due_date < ?1 THEN (?1 - t.due_date) / 86400 ELSE 0 END), "
+    "SUM(DISTINCT 1 << MIN(t.fee_type, 7)), "
+    "EXISTS (SELECT 1 FROM payment_reminders pr WHERE pr.user_id = t.user_id AND pr.send_time > ?2) "
+    "FROM transactions t "
+    "JOIN users u ON u.user_id = t.user_id "
+    "WHERE t.status IN (0, 2) AND (?3 IS NULL OR t.user_id = ?3) "
+    "GROUP BY t.user_id";
+
+static const char *INSERT_REMINDER_SQL =
+    "INSERT INTO payment_reminders (user_id, reminder_content, unpaid_amount, overdue_amount, send_time, status) "
+    "VALUES (?, ?, ?, ?, ?, 0)";
+
+static const char *PENDING_REMINDERS_SQL =
+    "SELECT pr.reminder_id, COALESCE(u.phone_number, ''), pr.reminder_content "
+    "FROM payment_reminders pr "
+    "LEFT JOIN users u ON u.user_id = pr.user_id "
+    "WHERE pr.status = 0 "
+    "ORDER BY pr.reminder_id";
+
+static const char *MARK_REMINDER_SQL =
+    "UPDATE payment_reminders SET status = ?, delivered_time = ? WHERE reminder_id = ?";
+
+/**
+ * 将模板文本切分为原文片段与占位符片段
+ */
+static bool compile_segments(const char *text, ReminderSegment **segments, int *count)
+{
+    // 片段数不超过占位符数*2+1，按'{'个数预估
+    int cap = 1;
+    for (const char *p = text; *p; p++)
+    {
+        cap += (*p == '{') * 2;
+    }
+    *segments = malloc(cap * sizeof(ReminderSegment));
+    if (!*segments)
+    {
+        return false;
+    }
+
+    int n = 0;
+    const char *literal = text;
+    const char *p = text;
+    while (*p)
+    {
+        const char *close = *p == '{' ? strchr(p, '}') : NULL;
+        int field = REMINDER_FIELD_LITERAL;
+        if (close)
+        {
+            for (int i = 0; i < (int)(sizeof(FIELD_NAMES) / sizeof(FIELD_NAMES[0])); i++)
+            {
+                size_t len = strlen(FIELD_NAMES[i]);
+                if ((size_t)(close - p - 1) == len && strncmp(p + 1, FIELD_NAMES[i], len) == 0)
+                {
+                    field = i;
+                    break;
+                }
+            }
+        }
+        if (field == REMINDER_FIELD_LITERAL)
+        {
+            p++;
+            continue;
+        }
+
+        if (p > literal)
+        {
+            (*segments)[n++] = (ReminderSegment){REMINDER_FIELD_LITERAL, literal, (size_t)(p - literal)};
+        }
+        (*segments)[n++] = (ReminderSegment){(ReminderField)field, NULL, 0};
+        p = close + 1;
+        literal = p;
+    }
+    if (p > literal)
+    {
+        (*segments)[n++] = (ReminderSegment){REMINDER_FIELD_LITERAL, literal, (size_t)(p - literal)};
+    }
+
+    *count = n;
+    return true;
+}
+
+/**
+ * 编译提醒模板
+ *
+ * 模板只在编译时解析一次，渲染时按片段顺序拼接，不再扫描模板文本
+ *
+ * @param tpl 输出参数，编译结果
+ * @param body 正文模板
+ * @param overdue_notice 逾期提示模板，正文中{overdue_notice}处展开；不可再包含{overdue_notice}
+ * @return 成功返回true
+ */
+bool reminder_template_compile(ReminderTemplate *tpl, const char *body, const char *overdue_notice)
+{
+    memset(tpl, 0, sizeof(ReminderTemplate));
+
+    size_t body_len = strlen(body);
+    size_t notice_len = strlen(overdue_notice);
+    tpl->source = malloc(body_len + notice_len + 2);
+    if (!tpl->source)
+    {
+        return false;
+    }
+    memcpy(tpl->source, body, body_len + 1);
+    memcpy(tpl->source + body_len + 1, overdue_notice, notice_len + 1);
+
+    if (!compile_segments(tpl->source, &tpl->body, &tpl->body_count) ||
+        !compile_segments(tpl->source + body_len + 1, &tpl->notice, &tpl->notice_count))
+    {
+        reminder_template_free(tpl);
+        return false;
+    }
+
+    // 逾期提示内不允许递归展开
+    for (int i = 0; i < tpl->notice_count; i++)
+    {
+        if (tpl->notice[i].field == REMINDER_FIELD_OVERDUE_NOTICE)
+        {
+            tpl->notice[i].field = REMINDER_FIELD_LITERAL;
+            tpl->notice[i].text = "";
+        }
+    }
+    return true;
+}
+
+/**
+ * 释放模板
+ */
+void reminder_template_free(ReminderTemplate *tpl)
+{
+    free(tpl->source);
+    free(tpl->body);
+    free(tpl->notice);
+    memset(tpl, 0, sizeof(ReminderTemplate));
+}
+
+// 追加写入，超出容量时截断
+static void append(char *out, size_t size, size_t *len, const char *text, size_t text_len)
+{
+    if (*len + 1 >= size)
+    {
+        return;
+    }
+    if (text_len > size - 1 - *len)
+    {
+        text_len = size - 1 - *len;
+    }
+    memcpy(out + *len, text, text_len);
+    *len += text_len;
+}
+
+static void render_segments(const ReminderSegment *segments, int count, const ReminderTemplate *tpl,
+                            const ReminderValues *values, char *out, size_t size, size_t *len)
+{
+    char number[32];
+    for (int i = 0; i < count; i++)
+    {
+        const ReminderSegment *seg = &segments[i];
+        switch (seg->field)
+        {
+        case REMINDER_FIELD_LITERAL:
+            append(out, size, len, seg->text, seg->len);
+            break;
+        case REMINDER_FIELD_NAME:
+            append(out, size, len, values->name, strlen(values->name));
+            break;
+        case REMINDER_FIELD_AMOUNT:
+            append(out, size, len, number, snprintf(number, sizeof(number), "%.2f", values->amount));
+            break;
+        case REMINDER_FIELD_OVERDUE_AMOUNT:
+            append(out, size, len, number, snprintf(number, sizeof(number), "%.2f", values->overdue_amount));
+            break;
+        case REMINDER_FIELD_OVERDUE_DAYS:
+            append(out, size, len, number, snprintf(number, sizeof(number), "%d", values->overdue_days));
+            break;
+        case REMINDER_FIELD_FEE_TYPES:
+            append(out, size, len, values->fee_types, strlen(values->fee_types));
+            break;
+        case REMINDER_FIELD_DATE:
+        {
+            struct tm tm_info;
+            localtime_r(&values->date, &tm_info);
+            append(out, size, len, number, strftime(number, sizeof(number), "%Y-%m-%d", &tm_info));
+            break;
+        }
+        case REMINDER_FIELD_OVERDUE_NOTICE:
+            if (values->overdue_amount > 0)
+            {
+                render_segments(tpl->notice, tpl->notice_count, tpl, values, out, size, len);
+            }
+            break;
+        }
+    }
+}
+
+/**
+ * 渲染提醒内容
+ *
+ * @param tpl 已编译的模板
+ * @param values 提醒数据
+ * @param out 输出缓冲区
+ * @param size 缓冲区大小
+ * @return 写入的字节数（不含结尾'\0'）
+ */
+size_t reminder_template_render(const ReminderTemplate *tpl, const ReminderValues *values, char *out, size_t size)
+{
+    size_t len = 0;
+    if (size == 0)
+    {
+        return 0;
+    }
+    render_segments(tpl->body, tpl->body_count, tpl, values, out, size, &len);
+    out[len] = '\0';
+    return len;
+}
+
+/**
+ * 将欠费类型位掩码转为"物业费、水费"形式的文本
+ */
+static void format_fee_types(long long mask, char *out, size_t size)
+{
+    size_t len = 0;
+    out[0] = '\0';
+    for (int type = 1; type <= 7; type++)
+    {
+        if (mask & (1LL << type))
+        {
+            if (len > 0)
+            {
+                append(out, size, &len, "、", strlen("、"));
+            }
+            append(out, size, &len, FEE_TYPE_NAMES[type], strlen(FEE_TYPE_NAMES[type]));
+        }
+    }
+    out[len] = '\0';
+}
+
+/**
+ * 按汇总查询生成提醒
+ *
+ * 一次汇总查询得到每位业主的欠费信息，用预编译的模板渲染后插入发件箱。
+ * 自行开启事务时每 REMINDER_BATCH_SIZE 条提交一次，避免长时间持有写锁。
+ */
+static bool queue_reminders(Database *db, const char *user_id, time_t now, int dedupe_seconds, ReminderBatch *batch)
+{
+    struct timespec started, finished;
+    clock_gettime(CLOCK_MONOTONIC, &started);
+    memset(batch, 0, sizeof(ReminderBatch));
+
+    ReminderTemplate tpl;
+    if (!reminder_template_compile(&tpl, DEFAULT_REMINDER_TEMPLATE, DEFAULT_OVERDUE_NOTICE_TEMPLATE))
+    {
+        fprintf(stderr, "内存分配失败：提醒模板\n");
+        return false;
+    }
+
+    sqlite3_stmt *select_stmt;
+    sqlite3_stmt *insert_stmt;
+    if (sqlite3_prepare_v2(db->db, REMINDER_CANDIDATES_SQL, -1, &select_stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "准备提醒查询失败: %s\n", sqlite3_errmsg(db->db));
+        reminder_template_free(&tpl);
+        return false;
+    }
+    if (db_prepare_cached(db, INSERT_REMINDER_SQL, &insert_stmt) != SQLITE_OK)
+    {
+        fprintf(stderr, "准备提醒插入失败: %s\n", sqlite3_errmsg(db->db));
+        sqlite3_finalize(select_stmt);
+        reminder_template_free(&tpl);
+        return false;
+    }
+
+    sqlite3_bind_int64(select_stmt, 1, now);
+    sqlite3_bind_int64(select_stmt, 2, dedupe_seconds > 0 ? now - dedupe_seconds : now + 1);
+    if (user_id)
+    {
+        sqlite3_bind_text(select_stmt, 3, user_id, -1, SQLITE_STATIC);
+    }
+
+    bool own_transaction = sqlite3_get_autocommit(db->db);
+    if (own_transaction && sqlite3_exec(db->db, "BEGIN IMMEDIATE", 0, 0, 0) != SQLITE_OK)
+    {
+        fprintf(stderr, "无法开始事务: %s\n", sqlite3_errmsg(db->db));
+        sqlite3_finalize(select_stmt);
+        reminder_template_free(&tpl);
+        return false;
+    }
+
+    bool ok = true;
+    int pending = 0;
+    char content[REMINDER_MAX_LENGTH];
+    char fee_types[128];
+    int rc;
+
+    while ((rc = sqlite3_step(select_stmt)) == SQLITE_ROW)
+    {
+        batch->owner_count++;
+        if (sqlite3_column_int(select_stmt, 6))
+        {
+            batch->skipped_count++;
+            continue;
+        }
+
+        const char *name = (const char *)sqlite3_column_text(select_stmt, 1);
+        format_fee_types(sqlite3_column_int64(select_stmt, 5), fee_types, sizeof(fee_types));
+        ReminderValues values = {
+            name ? name : "",
+            sqlite3_column_double(select_stmt, 2),
+            sqlite3_column_double(select_stmt, 3),
+            sqlite3_column_int(select_stmt, 4),
+            fee_types,
+            now};
+        size_t len = reminder_template_render(&tpl, &values, content, sizeof(content));
+
+        sqlite3_bind_text(insert_stmt, 1, (const char *)sqlite3_column_text(select_stmt, 0), -1, SQLITE_TRANSIENT);
+        sqlite3_bind_text(insert_stmt, 2, content, (int)len, SQLITE_STATIC);
+        sqlite3_bind_double(insert_stmt, 3, values.amount);
+        sqlite3_bind_double(insert_stmt, 4, values.overdue_amount);
+        sqlite3_bind_int64(insert_stmt, 5, now);
+        ok = sqlite3_step(insert_stmt) == SQLITE_DONE;
+        sqlite3_reset(insert_stmt);
+        if (!ok)
+        {
+            fprintf(stderr, "写入提醒失败: %s\n", sqlite3_errmsg(db->db));
+            break;
+        }
+
+        batch->queued_count++;
+        batch->total_amount += values.amount;
+
+        if (own_transaction && ++pending == REMINDER_BATCH_SIZE)
+        {
+            pending = 0;
+            if (sqlite3_exec(db->db, "COMMIT", 0, 0, 0) != SQLITE_OK ||
+                sqlite3_exec(db->db, "BEGIN IMMEDIATE", 0, 0, 0) != SQLITE_OK)
+            {
+                fprintf(stderr, "提交提醒批次失败: %s\n", sqlite3_errmsg(db->db));
+                ok = false;
+                break;
+            }
+        }
+    }
+
+    if (ok && rc != SQLITE_DONE)
+    {
+        fprintf(stderr, "查询欠费业主失败: %s\n", sqlite3_errmsg(db->db));
+        ok = false;
+    }
+    sqlite3_clear_bindings(insert_stmt);
+    sqlite3_finalize(select_stmt);
+    reminder_template_free(&tpl);
+
+    if (own_transaction && sqlite3_get_autocommit(db->db) == 0)
+    {
+        // 已提交的批次保留，只回滚当前批次
+        sqlite3_exec(db->db, ok ? "COMMIT" : "ROLLBACK", 0, 0, 0);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &finished);
+    batch->elapsed_seconds = (finished.tv_sec - started.tv_sec) + (finished.tv_nsec - started.tv_nsec) / 1e9;
+    return ok;
+}
+
+/**
+ * 为单个业主生成缴费提醒
+ *
+ * @param db 数据库连接
+ * @param user_id 业主ID
+ * @param now 生成时间
+ * @param dedupe_seconds 去重窗口（秒），0表示不去重
+ * @param batch 输出参数，生成结果；业主无欠费时owner_count为0
+ * @return 成功返回true
+ */
+bool queue_payment_reminder(Database *db, const char *user_id, time_t now, int dedupe_seconds, ReminderBatch *batch)
+{
+    return queue_reminders(db, user_id, now, dedupe_seconds, batch);
+}
+
+/**
+ * 为全部欠费业主批量生成缴费提醒
+ *
+ * @param db 数据库连接
+ * @param now 生成时间
+ * @param dedupe_seconds 去重窗口（秒），窗口内已有提醒的业主跳过；0表示不去重
+ * @param batch 输出参数，生成结果
+ * @return 成功返回true；失败时已提交的批次保留
+ */
+bool queue_bulk_payment_reminders(Database *db, time_t now, int dedupe_seconds, ReminderBatch *batch)
+{
+    return queue_reminders(db, NULL, now, dedupe_seconds, batch);
+}
+
+/**
+ * 写出一条投递记录：时间、手机号、内容，制表符分隔，内容中的换行转义为\n
+ */
+static void write_outbox_record(FILE *fp, const char *stamp, const char *phone, const char *content)
+{
+    fputs(stamp, fp);
+    fputc('\t', fp);
+    fputs(phone, fp);
+    fputc('\t', fp);
+    for (const char *p = content; *p; p++)
+    {
+        switch (*p)
+        {
+        case '\n':
+            fputs("\\n", fp);
+            break;
+        case '\t':
+            fputs("\\t", fp);
+            break;
+        case '\\':
+            fputs("\\\\", fp);
+            break;
+        default:
+            fputc(*p, fp);
+        }
+    }
+    fputc('\n', fp);
+}
+
+/**
+ * 获取默认投递文件路径
+ *
+ * 投递文件与数据库、备份放在同一数据目录下：取数据库文件所在目录，
+ * 数据库路径不含目录时使用程序数据目录
+ *
+ * @param db 数据库连接
+ * @param buffer 输出缓冲区
+ * @param size 缓冲区大小
+ * @return 成功返回true
+ */
+bool reminder_outbox_path(Database *db, char *buffer, size_t size)
+{
+    const char *slash = db->db_path ? strrchr(db->db_path, '/') : NULL;
+    int written;
+    if (slash)
+    {
+        written = snprintf(buffer, size, "%.*s/%s", (int)(slash - db->db_path), db->db_path, REMINDER_OUTBOX_FILE);
+    }
+    else
+    {
+        char data_dir[512];
+        if (!get_data_dir(data_dir, sizeof(data_dir)))
+        {
+            return false;
+        }
+        written = snprintf(buffer, size, "%s/%s", data_dir, REMINDER_OUTBOX_FILE);
+    }
+    return written > 0 && (size_t)written < size;
+}
+
+/**
+ * 投递待发送的提醒
+ *
+ * 以本地文件代替短信网关：每条提醒追加一行到投递文件，无手机号的业主标记为投递失败。
+ * 状态更新与文件写出在同一事务内，文件写出失败时回滚，提醒保持待投递状态。
+ *
+ * @param db 数据库连接
+ * @param outbox_path 投递文件路径，NULL表示使用数据目录下的默认投递文件
+ * @param delivery 输出参数，投递结果
+ * @return 成功返回true
+ */
+bool deliver_pending_reminders(Database *db, const char *outbox_path, ReminderDelivery *delivery)
+{
+    memset(delivery, 0, sizeof(ReminderDelivery));
+    char default_path[1024];
+    if (!outbox_path)
+    {
+        if (!reminder_outbox_path(db, default_path, sizeof(default_path)))
+        {
+            printf("无法确定投递文件路径\n");
+            return false;
+        }
+        outbox_path = default_path;
+    }
+
+    FILE *fp = fopen(outbox_path, "ab");
+    if (!fp)
+    {
+        printf("无法打开投递文件: %s\n", outbox_path);
+        return false;
+    }
+    setvbuf(fp, NULL, _IOFBF, 64 * 1024);
+
+    sqlite3_stmt *select_stmt;
+    sqlite3_stmt *mark_stmt;
+    if (sqlite3_prepare_v2(db->db, PENDING_REMINDERS_SQL, -1, &select_stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "准备投递查询失败: %s\n", sqlite3_errmsg(db->db));
+        fclose(fp);
+        return false;
+    }
+    if (db_prepare_cached(db, MARK_REMINDER_SQL, &mark_stmt) != SQLITE_OK)
+    {
+        fprintf(stderr, "准备投递更新失败: %s\n", sqlite3_errmsg(db->db));
+        sqlite3_finalize(select_stmt);
+        fclose(fp);
+        return false;
+    }
+
+    bool own_transaction = sqlite3_get_autocommit(db->db);
+    if (own_transaction && sqlite3_exec(db->db, "BEGIN IMMEDIATE", 0, 0, 0) != SQLITE_OK)
+    {
+        fprintf(stderr, "无法开始事务: %s\n", sqlite3_errmsg(db->db));
+        sqlite3_finalize(select_stmt);
+        fclose(fp);
+        return false;
+    }
+
+    time_t now = time(NULL);
+    char stamp[32];
+    struct tm tm_info;
+    localtime_r(&now, &tm_info);
+    strftime(stamp, sizeof(stamp), "%Y-%m-%d %H:%M:%S", &tm_info);
+
+    bool ok = true;
+    int rc;
+    while ((rc = sqlite3_step(select_stmt)) == SQLITE_ROW)
+    {
+        const char *phone = (const char *)sqlite3_column_text(select_stmt, 1);
+        const char *content = (const char *)sqlite3_column_text(select_stmt, 2);
+        int status = REMINDER_FAILED;
+        if (phone[0] != '\0')
+        {
+            write_outbox_record(fp, stamp, phone, content ? content : "");
+            status = REMINDER_DELIVERED;
+        }
+
+        sqlite3_bind_int(mark_stmt, 1, status);
+        sqlite3_bind_int64(mark_stmt, 2, now);
+        sqlite3_bind_int64(mark_stmt, 3, sqlite3_column_int64(select_stmt, 0));
+        ok = sqlite3_step(mark_stmt) == SQLITE_DONE;
+        sqlite3_reset(mark_stmt);
+        if (!ok)
+        {
+            fprintf(stderr, "更新提醒状态失败: %s\n", sqlite3_errmsg(db->db));
+            break;
+        }
+
+        if (status == REMINDER_DELIVERED)
+            delivery->delivered_count++;
+        else
+            delivery->failed_count++;
+    }
+    if (ok && rc != SQLITE_DONE)
+    {
+        fprintf(stderr, "读取待投递提醒失败: %s\n", sqlite3_errmsg(db->db));
+        ok = false;
+    }
+    sqlite3_finalize(select_stmt);
+
+    if (fclose(fp) != 0 && ok)
+    {
+        printf("写入投递文件失败: %s\n", outbox_path);
+        ok = false;
+    }
+
+    if (own_transaction)
+    {
+        sqlite3_exec(db->db, ok ? "COMMIT" : "ROLLBACK", 0, 0, 0);
+    }
+    if (!ok)
+    {
+        memset(delivery, 0, sizeof(ReminderDelivery));
+    }
+    return ok;
+}
@@ -0,0 +1,933 @@
+#include "models/scheduler.h"
+#include "models/billing.h"
+#include "models/collection_rate.h"
+#include "models/fee_cube.h"
+#include "models/late_fee.h"
+#include "models/transaction.h"
+#include "utils/file_ops.h"
+#include "utils/table.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SCHEDULER_MAX_JOBS 32
+#define SCHEDULER_POLL_SECONDS 60      // 最长休眠时间，其他进程修改任务表后最迟在此时间内生效
+#define SCHEDULER_BUSY_TIMEOUT_MS 30000 // 后台连接等待写锁的时间，比交互连接长
+#define SCHEDULER_BACKUP_STEP_PAGES 256 // 备份每步复制的页数，步间让出写锁
+
+typedef bool (*JobHandler)(Database *db, char *message, size_t size);
+
+typedef struct
+{
+    const char *name;
+    const char *description;
+    JobHandler run;
+} JobDefinition;
+
+static bool job_mark_overdue(Database *db, char *message, size_t size);
+static bool job_refresh_statistics(Database *db, char *message, size_t size);
+static bool job_accrue_late_fees(Database *db, char *message, size_t size);
+static bool job_backup(Database *db, char *message, size_t size);
+static bool job_optimize(Database *db, char *message, size_t size);
+static bool job_incremental_vacuum(Database *db, char *message, size_t size);
+
+// 任务名与scheduled_jobs表中的job_name对应，计划和开关保存在表中
+static const JobDefinition JOBS[] = {
+    {"mark_overdue", "标记逾期账单", job_mark_overdue},
+    {"refresh_statistics", "刷新统计立方体和收缴率", job_refresh_statistics},
+    {"accrue_late_fees", "计提滞纳金", job_accrue_late_fees},
+    {"backup", "数据库备份", job_backup},
+    {"optimize", "更新查询统计信息", job_optimize},
+    {"incremental_vacuum", "回收空闲页并截断WAL", job_incremental_vacuum},
+};
+
+static const char *STATUS_NAMES[] = {"运行中", "成功", "失败", "跳过"};
+
+static const char *LOAD_JOBS_SQL =
+    "SELECT job_name, schedule, jitter_seconds, next_run FROM scheduled_jobs WHERE enabled = 1 ORDER BY job_name";
+
+// 以旧的下次运行时间为条件推进，多个进程同时运行调度线程时只有一个能领到本次运行
+static const char *CLAIM_JOB_SQL =
+    "UPDATE scheduled_jobs SET next_run = ?1 WHERE job_name = ?2 AND next_run IS ?3";
+
+static const char *BEGIN_RUN_SQL = "INSERT INTO job_runs (job_name, started_at, status) VALUES (?, ?, 0)";
+
+static const char *FINISH_RUN_SQL = "UPDATE job_runs SET finished_at = ?, status = ?, message = ? WHERE run_id = ?";
+
+static const char *UPDATE_LAST_RUN_SQL = "UPDATE scheduled_jobs SET last_run = ?, last_status = ? WHERE job_name = ?";
+
+static const char *PRUNE_RUNS_SQL =
+    "DELETE FROM job_runs WHERE job_name = ?1 AND run_id <= "
+    "(SELECT run_id FROM job_runs WHERE job_name = ?1 ORDER BY run_id DESC LIMIT 1 OFFSET ?2)";
+
+static pthread_mutex_t scheduler_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t scheduler_wakeup = PTHREAD_COND_INITIALIZER;
+static pthread_t scheduler_thread;
+static bool scheduler_running = false;
+static bool scheduler_stopping = false;
+static bool scheduler_wake_pending = false;
+static char *scheduler_db_path = NULL;
+
+/**
+ * 解析cron的一个字段
+ */
+static bool parse_cron_field(const char *field, int min, int max, uint64_t *mask, bool *any)
+{
+    char buf[64];
+    if (snprintf(buf, sizeof(buf), "%s", field) >= (int)sizeof(buf))
+    {
+        return false;
+    }
+    *mask = 0;
+    if (any)
+    {
+        *any = strcmp(buf, "*") == 0;
+    }
+
+    char *save = NULL;
+    for (char *item = strtok_r(buf, ",", &save); item; item = strtok_r(NULL, ",", &save))
+    {
+        long step = 1;
+        char *slash = strchr(item, '/');
+        if (slash)
+        {
+            char *end;
+            step = strtol(slash + 1, &end, 10);
+            if (end == slash + 1 || *end || step <= 0)
+            {
+                return false;
+            }
+            *slash = '\0';
+        }
+
+        long lo, hi;
+        if (strcmp(item, "*") == 0)
+        {
+            lo = min;
+            hi = max;
+        }
+        else
+        {
+            char *end;
+            lo = strtol(item, &end, 10);
+            if (end == item)
+            {
+                return false;
+            }
+            hi = slash ? max : lo;
+            if (*end == '-')
+            {
+                char *range = end + 1;
+                hi = strtol(range, &end, 10);
+                if (end == range)
+                {
+                    return false;
+                }
+            }
+            if (*end)
+            {
+                return false;
+            }
+        }
+
+        if (lo < min || hi > max || lo > hi)
+        {
+            return false;
+        }
+        for (long v = lo; v <= hi; v += step)
+        {
+            *mask |= 1ULL << v;
+        }
+    }
+    return *mask != 0;
+}
+
+/**
+ * @brief 解析cron表达式
+ *
+ * @param text "分 时 日 月 周"，如"*\/15 * * * *"、"30 2 * * 1-5"
+ * @param schedule 输出参数，解析结果
+ * @return bool 表达式有效返回true
+ */
+bool cron_parse(const char *text, CronSchedule *schedule)
+{
+    char fields[5][64];
+    char extra;
+    if (sscanf(text, "%63s %63s %63s %63s %63s %c", fields[0], fields[1], fields[2], fields[3], fields[4], &extra) != 5)
+    {
+        return false;
+    }
+
+    memset(schedule, 0, sizeof(CronSchedule));
+    uint64_t mask;
+    if (!parse_cron_field(fields[0], 0, 59, &mask, NULL))
+        return false;
+    schedule->minutes = mask;
+    if (!parse_cron_field(fields[1], 0, 23, &mask, NULL))
+        return false;
+    schedule->hours = (uint32_t)mask;
+    if (!parse_cron_field(fields[2], 1, 31, &mask, &schedule->any_day))
+        return false;
+    schedule->days = (uint32_t)mask;
+    if (!parse_cron_field(fields[3], 1, 12, &mask, NULL))
+        return false;
+    schedule->months = (uint16_t)mask;
+    if (!parse_cron_field(fields[4], 0, 7, &mask, &schedule->any_weekday))
+        return false;
+    schedule->weekdays = (uint8_t)((mask | (mask >> 7)) & 0x7F); // 7即周日
+    return true;
+}
+
+/**
+ * 日期是否匹配：日和周都有限定时满足其一即可（与cron一致）
+ */
+static bool cron_day_matches(const CronSchedule *schedule, const struct tm *tm)
+{
+    bool day = (schedule->days >> tm->tm_mday) & 1;
+    bool weekday = (schedule->weekdays >> tm->tm_wday) & 1;
+    if (schedule->any_day && schedule->any_weekday)
+        return true;
+    if (schedule->any_day)
+        return weekday;
+    if (schedule->any_weekday)
+        return day;
+    return day || weekday;
+}
+
+/**
+ * 规范化本地时间
+ */
+static time_t normalize_tm(struct tm *tm)
+{
+    tm->tm_isdst = -1;
+    time_t t = mktime(tm);
+    localtime_r(&t, tm);
+    return t;
+}
+
+/**
+ * @brief 计算下一个触发时间
+ *
+ * 从after的下一分钟开始，月、日、时不匹配时整段跳过，只在匹配的小时内逐分钟查找
+ *
+ * @param schedule 计划
+ * @param after 起始时间（不含）
+ * @return time_t 下一个触发时间，四年内无触发（如2月30日）时返回0
+ */
+time_t cron_next(const CronSchedule *schedule, time_t after)
+{
+    struct tm tm;
+    time_t t = after - after % 60 + 60;
+    localtime_r(&t, &tm);
+    tm.tm_sec = 0;
+
+    time_t limit = after + 4 * 366 * 86400; // 覆盖闰年2月29日
+    while (t <= limit)
+    {
+        if (!((schedule->months >> (tm.tm_mon + 1)) & 1))
+        {
+            tm.tm_mon++;
+            tm.tm_mday = 1;
+            tm.tm_hour = 0;
+            tm.tm_min = 0;
+        }
+        else if (!cron_day_matches(schedule, &tm))
+        {
+            tm.tm_mday++;
+            tm.tm_hour = 0;
+            tm.tm_min = 0;
+        }
+        else if (!((schedule->hours >> tm.tm_hour) & 1))
+        {
+            tm.tm_hour++;
+            tm.tm_min = 0;
+        }
+        else if (!((schedule->minutes >> tm.tm_min) & 1))
+        {
+            tm.tm_min++;
+        }
+        else
+        {
+            return t;
+        }
+        t = normalize_tm(&tm);
+    }
+    return 0;
+}
+
+/**
+ * 按计划计算下次运行时间并加上随机推迟，计划无效时返回0
+ */
+static time_t next_run_time(const char *schedule, int jitter, time_t after, unsigned *seed)
+{
+    CronSchedule cron;
+    if (!cron_parse(schedule, &cron))
+    {
+        return 0;
+    }
+    time_t next = cron_next(&cron, after);
+    if (next > 0 && jitter > 0)
+    {
+        next += rand_r(seed) % (jitter + 1);
+    }
+    return next;
+}
+
+static const JobDefinition *find_job(const char *name)
+{
+    for (size_t i = 0; i < sizeof(JOBS) / sizeof(JOBS[0]); i++)
+    {
+        if (strcmp(JOBS[i].name, name) == 0)
+        {
+            return &JOBS[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * 执行返回单个整数的PRAGMA
+ */
+static int pragma_int(Database *db, const char *sql)
+{
+    sqlite3_stmt *stmt;
+    int value = -1;
+    if (sqlite3_prepare_v2(db->db, sql, -1, &stmt, NULL) == SQLITE_OK)
+    {
+        if (sqlite3_step(stmt) == SQLITE_ROW)
+        {
+            value = sqlite3_column_int(stmt, 0);
+        }
+        sqlite3_finalize(stmt);
+    }
+    return value;
+}
+
+static bool job_mark_overdue(Database *db, char *message, size_t size)
+{
+    if (!update_overdue_transactions(db))
+    {
+        snprintf(message, size, "更新逾期状态失败: %s", sqlite3_errmsg(db->db));
+        return false;
+    }
+    snprintf(message, size, "标记逾期账单%d笔", sqlite3_changes(db->db));
+    return true;
+}
+
+static bool job_refresh_statistics(Database *db, char *message, size_t size)
+{
+    CubeRefresh cube;
+    int months;
+    if (!refresh_fee_cube(db, &cube) || !refresh_collection_rates(db, &months))
+    {
+        snprintf(message, size, "刷新失败: %s", sqlite3_errmsg(db->db));
+        return false;
+    }
+    snprintf(message, size, "立方体并入%ld条变更，收缴率重算%d个月", cube.change_count, months);
+    return true;
+}
+
+static bool job_accrue_late_fees(Database *db, char *message, size_t size)
+{
+    time_t now = time(NULL);
+    LateFeeRule rule;
+    if (!get_late_fee_rule(db, now, &rule))
+    {
+        snprintf(message, size, "未设置有效的滞纳金规则，未计提");
+        return true;
+    }
+
+    LateFeeAccrual accrual;
+    if (!accrue_late_fees(db, now, &accrual))
+    {
+        snprintf(message, size, "计提失败: %s", sqlite3_errmsg(db->db));
+        return false;
+    }
+    if (accrual.already_accrued)
+        snprintf(message, size, "今日已计提过（%d笔）", accrual.bill_count);
+    else
+        snprintf(message, size, "计提滞纳金%d笔，共%.2f元", accrual.bill_count, accrual.total_amount);
+    return true;
+}
+
+/**
+ * 在线备份到数据目录下的backups/auto_backup_<周几>.db，按星期轮换保留7份。
+ * 分步复制，步间短暂休眠让出写锁；先写临时文件再改名，中途失败不会破坏上一份备份。
+ */
+static bool job_backup(Database *db, char *message, size_t size)
+{
+    char dir[512];
+    const char *slash = strrchr(db->db_path, '/');
+    if (slash)
+        snprintf(dir, sizeof(dir), "%.*s/backups", (int)(slash - db->db_path), db->db_path);
+    else
+        snprintf(dir, sizeof(dir), "backups");
+    if (!create_directory(dir))
+    {
+        snprintf(message, size, "无法创建备份目录 %s", dir);
+        return false;
+    }
+
+    time_t now = time(NULL);
+    struct tm tm_now;
+    localtime_r(&now, &tm_now);
+    char path[600], temp_path[620];
+    snprintf(path, sizeof(path), "%s/auto_backup_%d.db", dir, tm_now.tm_wday);
+    snprintf(temp_path, sizeof(temp_path), "%s.tmp", path);
+    remove(temp_path);
+
+    sqlite3 *dest;
+    if (sqlite3_open(temp_path, &dest) != SQLITE_OK)
+    {
+        snprintf(message, size, "无法创建备份文件 %s: %s", temp_path, sqlite3_errmsg(dest));
+        sqlite3_close(dest);
+        return false;
+    }
+
+    sqlite3_backup *backup = sqlite3_backup_init(dest, "main", db->db, "main");
+    if (!backup)
+    {
+        snprintf(message, size, "初始化备份失败: %s", sqlite3_errmsg(dest));
+        sqlite3_close(dest);
+        remove(temp_path);
+        return false;
+    }
+
+    int rc;
+    do
+    {
+        rc = sqlite3_backup_step(backup, SCHEDULER_BACKUP_STEP_PAGES);
+        if (rc == SQLITE_OK || rc == SQLITE_BUSY || rc == SQLITE_LOCKED)
+        {
+            sqlite3_sleep(10);
+        }
+    } while (rc == SQLITE_OK || rc == SQLITE_BUSY || rc == SQLITE_LOCKED);
+    int pages = sqlite3_backup_pagecount(backup);
+    sqlite3_backup_finish(backup);
+    sqlite3_close(dest);
+
+    if (rc != SQLITE_DONE || rename(temp_path, path) != 0)
+    {
+        snprintf(message, size, "备份失败: %s", sqlite3_errstr(rc));
+        remove(temp_path);
+        return false;
+    }
+    snprintf(message, size, "已备份到%s（%d页）", path, pages);
+    return true;
+}
+
+static bool job_optimize(Database *db, char *message, size_t size)
+{
+    // 限制每个索引的采样行数，ANALYZE在大表上也能很快完成
+    if (sqlite3_exec(db->db, "PRAGMA analysis_limit = 1000; ANALYZE; PRAGMA optimize;", 0, 0, 0) != SQLITE_OK)
+    {
+        snprintf(message, size, "ANALYZE失败: %s", sqlite3_errmsg(db->db));
+        return false;
+    }
+    snprintf(message, size, "已更新查询统计信息");
+    return true;
+}
+
+static bool job_incremental_vacuum(Database *db, char *message, size_t size)
+{
+    int mode = pragma_int(db, "PRAGMA auto_vacuum");
+    int before = pragma_int(db, "PRAGMA freelist_count");
+    if (mode == 2 && sqlite3_exec(db->db, "PRAGMA incremental_vacuum;", 0, 0, 0) != SQLITE_OK)
+    {
+        snprintf(message, size, "回收空闲页失败: %s", sqlite3_errmsg(db->db));
+        return false;
+    }
+    int after = pragma_int(db, "PRAGMA freelist_count");
+
+    // 把WAL中的内容写回数据库并截断WAL文件
+    sqlite3_exec(db->db, "PRAGMA wal_checkpoint(TRUNCATE);", 0, 0, 0);
+
+    if (mode == 2)
+        snprintf(message, size, "回收空闲页%d页，已截断WAL", before - after);
+    else
+        snprintf(message, size, "数据库未启用增量回收（空闲页%d页），已截断WAL", before);
+    return true;
+}
+
+/**
+ * @brief 在当前连接上同步运行一个任务并登记运行记录
+ *
+ * 任务运行期间持有出账互斥锁；出账或计提正在进行时本次跳过，返回JOB_SKIPPED
+ *
+ * @param db 数据库连接
+ * @param job_name 任务名
+ * @param message 输出参数，运行结果说明，可为NULL
+ * @param size message缓冲区大小
+ * @return JobStatus 运行状态
+ */
+JobStatus scheduler_run_job(Database *db, const char *job_name, char *message, size_t size)
+{
+    char buf[512] = "";
+    if (!message)
+    {
+        message = buf;
+        size = sizeof(buf);
+    }
+    message[0] = '\0';
+
+    time_t started = time(NULL);
+    sqlite3_int64 run_id = 0;
+    sqlite3_stmt *stmt;
+    if (db_prepare_cached(db, BEGIN_RUN_SQL, &stmt) == SQLITE_OK)
+    {
+        sqlite3_bind_text(stmt, 1, job_name, -1, SQLITE_STATIC);
+        sqlite3_bind_int64(stmt, 2, started);
+        if (sqlite3_step(stmt) == SQLITE_DONE)
+        {
+            run_id = sqlite3_last_insert_rowid(db->db);
+        }
+        sqlite3_reset(stmt);
+    }
+
+    JobStatus status;
+    const JobDefinition *job = find_job(job_name);
+    if (!job)
+    {
+        snprintf(message, size, "未知任务");
+        status = JOB_FAILED;
+    }
+    else if (!billing_trylock())
+    {
+        snprintf(message, size, "出账进行中，%d秒后重试", SCHEDULER_RETRY_SECONDS);
+        status = JOB_SKIPPED;
+    }
+    else
+    {
+        status = job->run(db, message, size) ? JOB_SUCCEEDED : JOB_FAILED;
+        billing_unlock();
+    }
+
+    if (run_id > 0 && db_prepare_cached(db, FINISH_RUN_SQL, &stmt) == SQLITE_OK)
+    {
+        sqlite3_bind_int64(stmt, 1, time(NULL));
+        sqlite3_bind_int(stmt, 2, status);
+        sqlite3_bind_text(stmt, 3, message, -1, SQLITE_STATIC);
+        sqlite3_bind_int64(stmt, 4, run_id);
+        sqlite3_step(stmt);
+        sqlite3_reset(stmt);
+    }
+    if (db_prepare_cached(db, UPDATE_LAST_RUN_SQL, &stmt) == SQLITE_OK)
+    {
+        sqlite3_bind_int64(stmt, 1, started);
+        sqlite3_bind_int(stmt, 2, status);
+        sqlite3_bind_text(stmt, 3, job_name, -1, SQLITE_STATIC);
+        sqlite3_step(stmt);
+        sqlite3_reset(stmt);
+    }
+    if (db_prepare_cached(db, PRUNE_RUNS_SQL, &stmt) == SQLITE_OK)
+    {
+        sqlite3_bind_text(stmt, 1, job_name, -1, SQLITE_STATIC);
+        sqlite3_bind_int(stmt, 2, SCHEDULER_HISTORY_KEEP);
+        sqlite3_step(stmt);
+        sqlite3_reset(stmt);
+    }
+    return status;
+}
+
+/**
+ * 以旧值为条件更新下次运行时间，返回是否由本连接更新成功
+ */
+static bool claim_job(Database *db, const char *job_name, time_t next_run, bool had_next, sqlite3_int64 old_next)
+{
+    sqlite3_stmt *stmt;
+    if (db_prepare_cached(db, CLAIM_JOB_SQL, &stmt) != SQLITE_OK)
+    {
+        return false;
+    }
+    if (next_run > 0)
+        sqlite3_bind_int64(stmt, 1, next_run);
+    else
+        sqlite3_bind_null(stmt, 1);
+    sqlite3_bind_text(stmt, 2, job_name, -1, SQLITE_STATIC);
+    if (had_next)
+        sqlite3_bind_int64(stmt, 3, old_next);
+    else
+        sqlite3_bind_null(stmt, 3);
+    bool claimed = sqlite3_step(stmt) == SQLITE_DONE && sqlite3_changes(db->db) == 1;
+    sqlite3_reset(stmt);
+    return claimed;
+}
+
+/**
+ * 运行所有到期的任务
+ *
+ * @return 最早的下次运行时间，没有待运行的任务时返回0
+ */
+static time_t run_due_jobs(Database *db, unsigned *seed)
+{
+    struct
+    {
+        char name[64];
+        char schedule[128];
+        int jitter;
+        bool has_next;
+        sqlite3_int64 next_run;
+    } jobs[SCHEDULER_MAX_JOBS];
+    int count = 0;
+
+    sqlite3_stmt *stmt;
+    if (db_prepare_cached(db, LOAD_JOBS_SQL, &stmt) != SQLITE_OK)
+    {
+        return 0;
+    }
+    while (count < SCHEDULER_MAX_JOBS && sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        snprintf(jobs[count].name, sizeof(jobs[count].name), "%s", (const char *)sqlite3_column_text(stmt, 0));
+        snprintf(jobs[count].schedule, sizeof(jobs[count].schedule), "%s", (const char *)sqlite3_column_text(stmt, 1));
+        jobs[count].jitter = sqlite3_column_int(stmt, 2);
+        jobs[count].has_next = sqlite3_column_type(stmt, 3) != SQLITE_NULL;
+        jobs[count].next_run = sqlite3_column_int64(stmt, 3);
+        count++;
+    }
+    sqlite3_reset(stmt);
+
+    time_t earliest = 0;
+    for (int i = 0; i < count; i++)
+    {
+        time_t now = time(NULL);
+        time_t next = jobs[i].next_run;
+
+        if (!jobs[i].has_next || next <= now)
+        {
+            next = next_run_time(jobs[i].schedule, jobs[i].jitter, now, seed);
+            bool claimed = claim_job(db, jobs[i].name, next, jobs[i].has_next, jobs[i].next_run);
+
+            // 首次计算只登记下次运行时间；到期且领到本次运行的才执行
+            if (claimed && jobs[i].has_next && scheduler_run_job(db, jobs[i].name, NULL, 0) == JOB_SKIPPED)
+            {
+                time_t retry = time(NULL) + SCHEDULER_RETRY_SECONDS;
+                if (next == 0 || retry < next)
+                {
+                    claim_job(db, jobs[i].name, retry, next > 0, next);
+                    next = retry;
+                }
+            }
+            if (!claimed)
+            {
+                continue;
+            }
+        }
+
+        if (next > 0 && (earliest == 0 || next < earliest))
+        {
+            earliest = next;
+        }
+    }
+    return earliest;
+}
+
+/**
+ * 调度线程：运行到期任务后休眠到最早的下次运行时间，可被停止或立即运行请求唤醒
+ */
+static void *scheduler_main(void *arg)
+{
+    (void)arg;
+    Database db;
+    if (db_open(&db, scheduler_db_path, SCHEDULER_BUSY_TIMEOUT_MS) != SQLITE_OK)
+    {
+        return NULL;
+    }
+    unsigned seed = (unsigned)time(NULL) ^ (unsigned)(uintptr_t)&db;
+
+    pthread_mutex_lock(&scheduler_mutex);
+    while (!scheduler_stopping)
+    {
+        scheduler_wake_pending = false;
+        pthread_mutex_unlock(&scheduler_mutex);
+
+        time_t wake = run_due_jobs(&db, &seed);
+        time_t now = time(NULL);
+        if (wake == 0 || wake > now + SCHEDULER_POLL_SECONDS)
+        {
+            wake = now + SCHEDULER_POLL_SECONDS;
+        }
+        struct timespec deadline = {wake, 0};
+
+        pthread_mutex_lock(&scheduler_mutex);
+        if (!scheduler_stopping && !scheduler_wake_pending)
+        {
+            pthread_cond_timedwait(&scheduler_wakeup, &scheduler_mutex, &deadline);
+        }
+    }
+    pthread_mutex_unlock(&scheduler_mutex);
+
+    db_close_quiet(&db);
+    return NULL;
+}
+
+/**
+ * @brief 启动后台调度线程
+ *
+ * @param db_path 数据库文件路径，须已完成表结构初始化
+ * @return bool 成功（或已在运行）返回true
+ */
+bool scheduler_start(const char *db_path)
+{
+    pthread_mutex_lock(&scheduler_mutex);
+    if (scheduler_running)
+    {
+        pthread_mutex_unlock(&scheduler_mutex);
+        return true;
+    }
+
+    scheduler_db_path = strdup(db_path);
+    scheduler_stopping = false;
+    scheduler_running = scheduler_db_path && pthread_create(&scheduler_thread, NULL, scheduler_main, NULL) == 0;
+    if (!scheduler_running)
+    {
+        fprintf(stderr, "无法启动后台任务线程\n");
+        free(scheduler_db_path);
+        scheduler_db_path = NULL;
+    }
+    pthread_mutex_unlock(&scheduler_mutex);
+    return scheduler_running;
+}
+
+/**
+ * @brief 停止后台调度线程
+ *
+ * 正在运行的任务会执行完毕后再退出
+ */
+void scheduler_stop(void)
+{
+    pthread_mutex_lock(&scheduler_mutex);
+    if (!scheduler_running)
+    {
+        pthread_mutex_unlock(&scheduler_mutex);
+        return;
+    }
+    scheduler_stopping = true;
+    pthread_cond_signal(&scheduler_wakeup);
+    pthread_mutex_unlock(&scheduler_mutex);
+
+    pthread_join(scheduler_thread, NULL);
+
+    pthread_mutex_lock(&scheduler_mutex);
+    scheduler_running = false;
+    free(scheduler_db_path);
+    scheduler_db_path = NULL;
+    pthread_mutex_unlock(&scheduler_mutex);
+}
+
+/**
+ * 唤醒调度线程重新读取任务表
+ */
+static void wake_scheduler(void)
+{
+    pthread_mutex_lock(&scheduler_mutex);
+    scheduler_wake_pending = true;
+    pthread_cond_signal(&scheduler_wakeup);
+    pthread_mutex_unlock(&scheduler_mutex);
+}
+
+/**
+ * 执行一条以任务名为最后一个参数的更新
+ */
+static bool update_job(Database *db, const char *sql, const char *job_name, sqlite3_int64 value, const char *text)
+{
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(db->db, sql, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "更新后台任务失败: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+    if (text)
+        sqlite3_bind_text(stmt, 1, text, -1, SQLITE_STATIC);
+    else
+        sqlite3_bind_int64(stmt, 1, value);
+    sqlite3_bind_text(stmt, 2, job_name, -1, SQLITE_STATIC);
+    bool ok = sqlite3_step(stmt) == SQLITE_DONE && sqlite3_changes(db->db) == 1;
+    sqlite3_finalize(stmt);
+
+    if (ok)
+    {
+        wake_scheduler();
+    }
+    return ok;
+}
+
+/**
+ * @brief 立即运行任务
+ *
+ * @param db 数据库连接
+ * @param job_name 任务名
+ * @return bool 任务存在返回true
+ */
+bool scheduler_run_now(Database *db, const char *job_name)
+{
+    return update_job(db, "UPDATE scheduled_jobs SET next_run = ? WHERE job_name = ?", job_name, time(NULL), NULL);
+}
+
+/**
+ * @brief 启用或停用任务
+ *
+ * 重新启用时下次运行时间按计划从当前时间重新计算
+ *
+ * @param db 数据库连接
+ * @param job_name 任务名
+ * @param enabled 是否启用
+ * @return bool 任务存在返回true
+ */
+bool scheduler_set_enabled(Database *db, const char *job_name, bool enabled)
+{
+    return update_job(db, "UPDATE scheduled_jobs SET enabled = ?, next_run = NULL WHERE job_name = ?",
+                      job_name, enabled ? 1 : 0, NULL);
+}
+
+/**
+ * @brief 修改任务计划
+ *
+ * @param db 数据库连接
+ * @param job_name 任务名
+ * @param schedule cron表达式
+ * @return bool 表达式有效且任务存在返回true
+ */
+bool scheduler_set_schedule(Database *db, const char *job_name, const char *schedule)
+{
+    CronSchedule cron;
+    if (!cron_parse(schedule, &cron))
+    {
+        return false;
+    }
+    return update_job(db, "UPDATE scheduled_jobs SET schedule = ?, next_run = NULL WHERE job_name = ?",
+                      job_name, 0, schedule);
+}
+
+static void format_run_time(char *buf, size_t size, sqlite3_stmt *stmt, int column)
+{
+    if (sqlite3_column_type(stmt, column) == SQLITE_NULL || sqlite3_column_int64(stmt, column) <= 0)
+    {
+        snprintf(buf, size, "-");
+        return;
+    }
+    time_t t = (time_t)sqlite3_column_int64(stmt, column);
+    struct tm tm_info;
+    localtime_r(&t, &tm_info);
+    strftime(buf, size, "%Y-%m-%d %H:%M", &tm_info);
+}
+
+static const char *status_name(sqlite3_stmt *stmt, int column)
+{
+    if (sqlite3_column_type(stmt, column) == SQLITE_NULL)
+    {
+        return "-";
+    }
+    int status = sqlite3_column_int(stmt, column);
+    return status >= 0 && status <= JOB_SKIPPED ? STATUS_NAMES[status] : "未知";
+}
+
+/**
+ * @brief 打印全部后台任务
+ *
+ * @param db 数据库连接
+ */
+void print_scheduled_jobs(Database *db)
+{
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(db->db,
+                           "SELECT job_name, schedule, enabled, next_run, last_run, last_status "
+                           "FROM scheduled_jobs ORDER BY job_name",
+                           -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "查询后台任务失败: %s\n", sqlite3_errmsg(db->db));
+        return;
+    }
+
+    static const TableColumn columns[] = {
+        {"任务", TABLE_ALIGN_LEFT, 0},
+        {"说明", TABLE_ALIGN_LEFT, 24},
+        {"计划", TABLE_ALIGN_LEFT, 0},
+        {"状态", TABLE_ALIGN_LEFT, 0},
+        {"下次运行", TABLE_ALIGN_LEFT, 0},
+        {"最近运行", TABLE_ALIGN_LEFT, 0},
+        {"结果", TABLE_ALIGN_LEFT, 0},
+    };
+    Table table;
+    table_begin(&table, columns, 7, 0);
+    while (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        const char *name = (const char *)sqlite3_column_text(stmt, 0);
+        const JobDefinition *job = find_job(name);
+        char next_run[32], last_run[32];
+        format_run_time(next_run, sizeof(next_run), stmt, 3);
+        format_run_time(last_run, sizeof(last_run), stmt, 4);
+        const char *values[] = {name, job ? job->description : "未知任务",
+                                (const char *)sqlite3_column_text(stmt, 1),
+                                sqlite3_column_int(stmt, 2) ? "启用" : "停用",
+                                next_run, last_run, status_name(stmt, 5)};
+        table_add_row(&table, values);
+    }
+    table_end(&table);
+    sqlite3_finalize(stmt);
+
+    pthread_mutex_lock(&scheduler_mutex);
+    bool running = scheduler_running;
+    pthread_mutex_unlock(&scheduler_mutex);
+    if (!running)
+    {
+        printf("\n后台任务线程未运行\n");
+    }
+}
+
+/**
+ * @brief 打印运行记录
+ *
+ * @param db 数据库连接
+ * @param job_name 任务名，NULL表示全部任务
+ * @param limit 最多列出的条数
+ */
+void print_job_runs(Database *db, const char *job_name, int limit)
+{
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(db->db,
+                           "SELECT job_name, started_at, finished_at, status, message FROM job_runs "
+                           "WHERE ?1 IS NULL OR job_name = ?1 ORDER BY run_id DESC LIMIT ?2",
+                           -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "查询运行记录失败: %s\n", sqlite3_errmsg(db->db));
+        return;
+    }
+    if (job_name)
+        sqlite3_bind_text(stmt, 1, job_name, -1, SQLITE_STATIC);
+    else
+        sqlite3_bind_null(stmt, 1);
+    sqlite3_bind_int(stmt, 2, limit);
+
+    static const TableColumn columns[] = {
+        {"任务", TABLE_ALIGN_LEFT, 0},
+        {"开始时间", TABLE_ALIGN_LEFT, 0},
+        {"耗时(秒)", TABLE_ALIGN_RIGHT, 0},
+        {"结果", TABLE_ALIGN_LEFT, 0},
+        {"说明", TABLE_ALIGN_LEFT, 60},
+    };
+    Table table;
+    table_begin(&table, columns, 5, 0);
+    while (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        char started[32];
+        format_run_time(started, sizeof(started), stmt, 1);
+        char elapsed[16] = "-";
+        if (sqlite3_column_type(stmt, 2) != SQLITE_NULL)
+        {
+            snprintf(elapsed, sizeof(elapsed), "%lld",
+                     (long long)(sqlite3_column_int64(stmt, 2) - sqlite3_column_int64(stmt, 1)));
+        }
+        const char *text = (const char *)sqlite3_column_text(stmt, 4);
+        const char *values[] = {(const char *)sqlite3_column_text(stmt, 0), started, elapsed,
+                                status_name(stmt, 3), text};
+        table_add_row(&table, values);
+    }
+    long count = table_end(&table);
+    sqlite3_finalize(stmt);
+
+    if (count == 0)
+    {
+        printf(" 暂无运行记录\n");
+    }
+}
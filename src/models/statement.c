@@ -0,0 +1,597 @@
+#include "models/statement.h"
+#include "utils/file_ops.h"
+#include "utils/thread_pool.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// 全部业主的对账数据，一次按楼宇、业主有序扫描，每位业主的行连续出现
+// 账单范围：账期在当月开始的账单，以及当月缴清的账单
+// 参数: ?1 当月首日零点  ?2 次月首日零点
+static const char *STATEMENT_SCAN_SQL =
+    "WITH owner_rooms AS ("
+    "  SELECT owner_id, MIN(building_id) AS building_id, GROUP_CONCAT(room_number, ' ') AS rooms "
+    "  FROM rooms WHERE owner_id IS NOT NULL AND owner_id <> '' GROUP BY owner_id) "
+    "SELECT u.user_id, u.name, u.phone_number, COALESCE(b.building_name, ''), COALESCE(o.rooms, ''), "
+    "COALESCE(l.billed_amount - l.paid_amount, 0), COALESCE(l.overdue_amount, 0), "
+    "t.transaction_id, t.fee_type, t.amount, t.status, t.period_start, t.due_date, t.payment_date "
+    "FROM users u "
+    "LEFT JOIN owner_rooms o ON o.owner_id = u.user_id "
+    "LEFT JOIN buildings b ON b.building_id = o.building_id "
+    "LEFT JOIN owner_ledger l ON l.user_id = u.user_id AND l.fee_type = 0 "
+    "LEFT JOIN transactions t ON t.user_id = u.user_id "
+    "  AND ((t.period_start >= ?1 AND t.period_start < ?2) OR (t.payment_date >= ?1 AND t.payment_date < ?2)) "
+    "WHERE u.role_id = 'role_owner' "
+    "ORDER BY COALESCE(b.building_name, ''), u.user_id, t.period_start, t.transaction_id";
+
+static const char *FEE_TYPE_NAMES[] = {"其他费用", "物业费", "停车费", "水费", "电费", "燃气费", "滞纳金"};
+static const char *STATUS_NAMES[] = {"未缴", "已缴", "逾期"};
+
+// 对账单中的一笔账单
+typedef struct
+{
+    char transaction_id[40];
+    int fee_type;
+    double amount;
+    int status;
+    time_t period_start;
+    time_t due_date;
+    time_t payment_date;
+} StatementItem;
+
+// 本次批量生成的公共参数
+typedef struct
+{
+    StatementFormat format;
+    int year;
+    int month;
+    time_t month_start;
+    time_t month_end;
+} StatementContext;
+
+// 一位业主的对账单任务，由工作线程渲染写出后释放
+typedef struct
+{
+    const StatementContext *ctx;
+    char path[512];
+    char user_id[40];
+    char name[64];
+    char phone[24];
+    char building[64];
+    char rooms[128];
+    double outstanding;
+    double overdue;
+    int item_count;
+    int item_cap;
+    StatementItem *items;
+} StatementJob;
+
+// 渲染缓冲区，整份对账单渲染完成后一次写出
+typedef struct
+{
+    char *data;
+    size_t len;
+    size_t cap;
+    bool failed;
+} OutputBuffer;
+
+static bool buffer_reserve(OutputBuffer *buf, size_t extra)
+{
+    if (buf->failed)
+        return false;
+    if (buf->len + extra + 1 <= buf->cap)
+        return true;
+
+    size_t cap = buf->cap ? buf->cap : 4096;
+    while (cap < buf->len + extra + 1)
+        cap *= 2;
+    char *data = realloc(buf->data, cap);
+    if (!data)
+    {
+        buf->failed = true;
+        return false;
+    }
+    buf->data = data;
+    buf->cap = cap;
+    return true;
+}
+
+static void buffer_printf(OutputBuffer *buf, const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    int need = vsnprintf(NULL, 0, format, args);
+    va_end(args);
+
+    if (need < 0 || !buffer_reserve(buf, (size_t)need))
+        return;
+
+    va_start(args, format);
+    vsnprintf(buf->data + buf->len, buf->cap - buf->len, format, args);
+    va_end(args);
+    buf->len += (size_t)need;
+}
+
+static void buffer_puts(OutputBuffer *buf, const char *text)
+{
+    size_t len = strlen(text);
+    if (!buffer_reserve(buf, len))
+        return;
+    memcpy(buf->data + buf->len, text, len + 1);
+    buf->len += len;
+}
+
+// 写入HTML转义后的文本
+static void buffer_html(OutputBuffer *buf, const char *text)
+{
+    for (; *text; text++)
+    {
+        switch (*text)
+        {
+        case '&':
+            buffer_puts(buf, "&amp;");
+            break;
+        case '<':
+            buffer_puts(buf, "&lt;");
+            break;
+        case '>':
+            buffer_puts(buf, "&gt;");
+            break;
+        case '"':
+            buffer_puts(buf, "&quot;");
+            break;
+        default:
+            if (buffer_reserve(buf, 1))
+            {
+                buf->data[buf->len++] = *text;
+                buf->data[buf->len] = '\0';
+            }
+        }
+    }
+}
+
+// 写入一个CSV字段（含分隔符或引号时加引号）
+static void buffer_csv(OutputBuffer *buf, const char *text, bool last)
+{
+    if (strpbrk(text, ",\"\r\n"))
+    {
+        buffer_puts(buf, "\"");
+        for (; *text; text++)
+        {
+            if (!buffer_reserve(buf, 2))
+                return;
+            if (*text == '"')
+                buf->data[buf->len++] = '"';
+            buf->data[buf->len++] = *text;
+            buf->data[buf->len] = '\0';
+        }
+        buffer_puts(buf, "\"");
+    }
+    else
+    {
+        buffer_puts(buf, text);
+    }
+    buffer_puts(buf, last ? "\r\n" : ",");
+}
+
+static void format_date(time_t t, char *out, size_t size)
+{
+    if (t <= 0)
+    {
+        snprintf(out, size, "-");
+        return;
+    }
+    struct tm tm_info;
+    localtime_r(&t, &tm_info);
+    strftime(out, size, "%Y-%m-%d", &tm_info);
+}
+
+static const char *fee_type_name(int fee_type)
+{
+    return FEE_TYPE_NAMES[(fee_type >= 1 && fee_type <= 6) ? fee_type : 0];
+}
+
+static const char *status_name(int status)
+{
+    return (status >= 0 && status <= 2) ? STATUS_NAMES[status] : "未知";
+}
+
+/**
+ * 计算当月应缴与当月已缴
+ */
+static void statement_totals(const StatementJob *job, double *billed, double *paid)
+{
+    *billed = 0;
+    *paid = 0;
+    for (int i = 0; i < job->item_count; i++)
+    {
+        const StatementItem *item = &job->items[i];
+        if (item->period_start >= job->ctx->month_start && item->period_start < job->ctx->month_end)
+            *billed += item->amount;
+        if (item->status == 1 && item->payment_date >= job->ctx->month_start && item->payment_date < job->ctx->month_end)
+            *paid += item->amount;
+    }
+}
+
+static void render_text(const StatementJob *job, OutputBuffer *buf)
+{
+    double billed, paid;
+    statement_totals(job, &billed, &paid);
+
+    buffer_printf(buf, "灰灰小区物业 %d年%d月 业主对账单\n", job->ctx->year, job->ctx->month);
+    buffer_puts(buf, "============================================================\n");
+    buffer_printf(buf, "业主: %s    电话: %s\n", job->name, job->phone[0] ? job->phone : "-");
+    buffer_printf(buf, "楼宇: %s    房号: %s\n", job->building[0] ? job->building : "-", job->rooms[0] ? job->rooms : "-");
+    buffer_puts(buf, "------------------------------------------------------------\n");
+
+    if (job->item_count == 0)
+    {
+        buffer_puts(buf, "本月无账单\n");
+    }
+    else
+    {
+        buffer_printf(buf, "%-10s %-12s %-12s %-12s %-6s %s\n", "费用类型", "账期开始", "截止日期", "金额", "状态", "缴费日期");
+        for (int i = 0; i < job->item_count; i++)
+        {
+            const StatementItem *item = &job->items[i];
+            char start[16], due[16], paid_on[16];
+            format_date(item->period_start, start, sizeof(start));
+            format_date(item->due_date, due, sizeof(due));
+            format_date(item->status == 1 ? item->payment_date : 0, paid_on, sizeof(paid_on));
+            buffer_printf(buf, "%-10s %-12s %-12s %-12.2f %-6s %s\n",
+                          fee_type_name(item->fee_type), start, due, item->amount, status_name(item->status), paid_on);
+        }
+    }
+
+    buffer_puts(buf, "------------------------------------------------------------\n");
+    buffer_printf(buf, "本月应缴: %.2f    本月已缴: %.2f\n", billed, paid);
+    buffer_printf(buf, "累计欠费: %.2f    其中逾期: %.2f\n", job->outstanding, job->overdue);
+}
+
+static void render_html(const StatementJob *job, OutputBuffer *buf)
+{
+    double billed, paid;
+    statement_totals(job, &billed, &paid);
+
+    buffer_printf(buf, "<!DOCTYPE html>\n<html lang=\"zh-CN\">\n<head>\n<meta charset=\"UTF-8\">\n"
+                       "<title>%d年%d月 业主对账单</title>\n"
+                       "<style>table{border-collapse:collapse}td,th{border:1px solid #999;padding:4px 8px}"
+                       "td.num{text-align:right}</style>\n</head>\n<body>\n",
+                  job->ctx->year, job->ctx->month);
+    buffer_printf(buf, "<h2>灰灰小区物业 %d年%d月 业主对账单</h2>\n<p>业主: ", job->ctx->year, job->ctx->month);
+    buffer_html(buf, job->name);
+    buffer_puts(buf, " &nbsp; 电话: ");
+    buffer_html(buf, job->phone[0] ? job->phone : "-");
+    buffer_puts(buf, "<br>楼宇: ");
+    buffer_html(buf, job->building[0] ? job->building : "-");
+    buffer_puts(buf, " &nbsp; 房号: ");
+    buffer_html(buf, job->rooms[0] ? job->rooms : "-");
+    buffer_puts(buf, "</p>\n<table>\n<tr><th>费用类型</th><th>账期开始</th><th>截止日期</th><th>金额</th><th>状态</th><th>缴费日期</th></tr>\n");
+
+    for (int i = 0; i < job->item_count; i++)
+    {
+        const StatementItem *item = &job->items[i];
+        char start[16], due[16], paid_on[16];
+        format_date(item->period_start, start, sizeof(start));
+        format_date(item->due_date, due, sizeof(due));
+        format_date(item->status == 1 ? item->payment_date : 0, paid_on, sizeof(paid_on));
+        buffer_printf(buf, "<tr><td>%s</td><td>%s</td><td>%s</td><td class=\"num\">%.2f</td><td>%s</td><td>%s</td></tr>\n",
+                      fee_type_name(item->fee_type), start, due, item->amount, status_name(item->status), paid_on);
+    }
+    if (job->item_count == 0)
+    {
+        buffer_puts(buf, "<tr><td colspan=\"6\">本月无账单</td></tr>\n");
+    }
+
+    buffer_printf(buf, "</table>\n<p>本月应缴: %.2f &nbsp; 本月已缴: %.2f<br>累计欠费: %.2f &nbsp; 其中逾期: %.2f</p>\n"
+                       "</body>\n</html>\n",
+                  billed, paid, job->outstanding, job->overdue);
+}
+
+static void render_csv(const StatementJob *job, OutputBuffer *buf)
+{
+    buffer_puts(buf, "\xEF\xBB\xBF"); // BOM，便于Excel识别UTF-8
+    buffer_puts(buf, "业主,电话,楼宇,房号,交易编号,费用类型,账期开始,截止日期,金额,状态,缴费日期\r\n");
+
+    for (int i = 0; i < job->item_count; i++)
+    {
+        const StatementItem *item = &job->items[i];
+        char start[16], due[16], paid_on[16], amount[32];
+        format_date(item->period_start, start, sizeof(start));
+        format_date(item->due_date, due, sizeof(due));
+        format_date(item->status == 1 ? item->payment_date : 0, paid_on, sizeof(paid_on));
+        snprintf(amount, sizeof(amount), "%.2f", item->amount);
+
+        buffer_csv(buf, job->name, false);
+        buffer_csv(buf, job->phone, false);
+        buffer_csv(buf, job->building, false);
+        buffer_csv(buf, job->rooms, false);
+        buffer_csv(buf, item->transaction_id, false);
+        buffer_csv(buf, fee_type_name(item->fee_type), false);
+        buffer_csv(buf, start, false);
+        buffer_csv(buf, due, false);
+        buffer_csv(buf, amount, false);
+        buffer_csv(buf, status_name(item->status), false);
+        buffer_csv(buf, paid_on, true);
+    }
+}
+
+static void free_statement_job(StatementJob *job)
+{
+    free(job->items);
+    free(job);
+}
+
+/**
+ * 工作线程任务：渲染并写出一份对账单
+ */
+static bool write_statement(void *arg)
+{
+    StatementJob *job = (StatementJob *)arg;
+    OutputBuffer buf = {0};
+
+    switch (job->ctx->format)
+    {
+    case STATEMENT_HTML:
+        render_html(job, &buf);
+        break;
+    case STATEMENT_CSV:
+        render_csv(job, &buf);
+        break;
+    default:
+        render_text(job, &buf);
+        break;
+    }
+
+    bool ok = !buf.failed;
+    if (ok)
+    {
+        FILE *fp = fopen(job->path, "wb");
+        ok = fp && fwrite(buf.data, 1, buf.len, fp) == buf.len;
+        if (fp && fclose(fp) != 0)
+            ok = false;
+    }
+    if (!ok)
+    {
+        fprintf(stderr, "写出对账单失败: %s\n", job->path);
+    }
+
+    free(buf.data);
+    free_statement_job(job);
+    return ok;
+}
+
+/**
+ * 将名称中不能用于文件名的字符替换为'_'
+ */
+static void sanitize_file_name(const char *name, char *out, size_t size)
+{
+    size_t n = 0;
+    for (; *name && n + 1 < size; name++)
+    {
+        unsigned char c = (unsigned char)*name;
+        out[n++] = (c < 0x20 || strchr("/\\:*?\"<>|", c)) ? '_' : (char)c;
+    }
+    out[n] = '\0';
+    if (n == 0 || strcmp(out, ".") == 0 || strcmp(out, "..") == 0)
+    {
+        snprintf(out, size, "_");
+    }
+}
+
+static void copy_text(sqlite3_stmt *stmt, int column, char *dest, size_t size)
+{
+    const char *text = (const char *)sqlite3_column_text(stmt, column);
+    strncpy(dest, text ? text : "", size - 1);
+    dest[size - 1] = '\0';
+}
+
+/**
+ * 从当前行创建业主任务（不含账单明细）
+ */
+static StatementJob *new_statement_job(sqlite3_stmt *stmt, const StatementContext *ctx, const char *building_dir)
+{
+    StatementJob *job = calloc(1, sizeof(StatementJob));
+    if (!job)
+        return NULL;
+
+    job->ctx = ctx;
+    copy_text(stmt, 0, job->user_id, sizeof(job->user_id));
+    copy_text(stmt, 1, job->name, sizeof(job->name));
+    copy_text(stmt, 2, job->phone, sizeof(job->phone));
+    copy_text(stmt, 3, job->building, sizeof(job->building));
+    copy_text(stmt, 4, job->rooms, sizeof(job->rooms));
+    job->outstanding = sqlite3_column_double(stmt, 5);
+    job->overdue = sqlite3_column_double(stmt, 6);
+
+    static const char *extensions[] = {"txt", "txt", "html", "csv"};
+    char file_name[160];
+    char owner_label[112];
+    snprintf(owner_label, sizeof(owner_label), "%s_%s", job->name, job->user_id);
+    sanitize_file_name(owner_label, file_name, sizeof(file_name));
+    snprintf(job->path, sizeof(job->path), "%s/%s.%s", building_dir, file_name,
+             extensions[(ctx->format >= STATEMENT_TEXT && ctx->format <= STATEMENT_CSV) ? ctx->format : 0]);
+    return job;
+}
+
+/**
+ * 向任务追加当前行的账单
+ */
+static bool append_statement_item(StatementJob *job, sqlite3_stmt *stmt)
+{
+    if (job->item_count == job->item_cap)
+    {
+        int cap = job->item_cap ? job->item_cap * 2 : 8;
+        StatementItem *items = realloc(job->items, cap * sizeof(StatementItem));
+        if (!items)
+            return false;
+        job->items = items;
+        job->item_cap = cap;
+    }
+
+    StatementItem *item = &job->items[job->item_count++];
+    copy_text(stmt, 7, item->transaction_id, sizeof(item->transaction_id));
+    item->fee_type = sqlite3_column_int(stmt, 8);
+    item->amount = sqlite3_column_double(stmt, 9);
+    item->status = sqlite3_column_int(stmt, 10);
+    item->period_start = (time_t)sqlite3_column_int64(stmt, 11);
+    item->due_date = (time_t)sqlite3_column_int64(stmt, 12);
+    item->payment_date = (time_t)sqlite3_column_int64(stmt, 13);
+    return true;
+}
+
+/**
+ * 批量生成业主月度对账单
+ *
+ * 主线程在一个读事务内对全部业主做一次有序扫描，每凑齐一位业主的账单就作为任务
+ * 交给线程池；工作线程在内存中渲染整份对账单后一次写出。任务队列有界，扫描速度
+ * 超过写出速度时主线程会等待，内存占用与业主总数无关。
+ * 输出目录结构为 out_dir/楼宇名称/业主姓名_业主ID.扩展名，未分配房屋的业主归入"未分配楼宇"。
+ *
+ * @param db 数据库连接
+ * @param year 年份
+ * @param month 月份（1-12）
+ * @param format 文件格式
+ * @param out_dir 输出根目录，不存在时自动创建
+ * @param summary 输出参数，生成结果
+ * @return 全部对账单写出成功返回true，否则返回false
+ */
+bool generate_monthly_statements(Database *db, int year, int month, StatementFormat format,
+                                 const char *out_dir, StatementSummary *summary)
+{
+    struct timespec started, finished;
+    clock_gettime(CLOCK_MONOTONIC, &started);
+    memset(summary, 0, sizeof(StatementSummary));
+
+    if (month < 1 || month > 12)
+    {
+        printf("无效的月份\n");
+        return false;
+    }
+    if (!create_directory(out_dir))
+    {
+        printf("无法创建输出目录: %s\n", out_dir);
+        return false;
+    }
+
+    StatementContext ctx;
+    ctx.format = format;
+    ctx.year = year;
+    ctx.month = month;
+    struct tm tm_start = {0};
+    tm_start.tm_year = year - 1900;
+    tm_start.tm_mon = month - 1;
+    tm_start.tm_mday = 1;
+    tm_start.tm_isdst = -1;
+    struct tm tm_end = tm_start;
+    tm_end.tm_mon = month;
+    ctx.month_start = mktime(&tm_start);
+    ctx.month_end = mktime(&tm_end);
+
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(db->db, STATEMENT_SCAN_SQL, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "准备对账单查询失败: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+    sqlite3_bind_int64(stmt, 1, ctx.month_start);
+    sqlite3_bind_int64(stmt, 2, ctx.month_end);
+
+    ThreadPool *pool = thread_pool_create(0, 0);
+    if (!pool)
+    {
+        sqlite3_finalize(stmt);
+        return false;
+    }
+    summary->thread_count = thread_pool_size(pool);
+
+    bool own_transaction = sqlite3_get_autocommit(db->db);
+    if (own_transaction)
+    {
+        sqlite3_exec(db->db, "BEGIN", 0, 0, 0);
+    }
+
+    bool ok = true;
+    StatementJob *job = NULL;
+    char building_dir[400] = "";
+    char current_building[64] = "";
+    bool first_building = true;
+    int rc;
+
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+    {
+        const char *user_id = (const char *)sqlite3_column_text(stmt, 0);
+        if (!job || strcmp(job->user_id, user_id ? user_id : "") != 0)
+        {
+            // 上一位业主的账单已全部读完
+            if (job)
+            {
+                thread_pool_submit(pool, write_statement, job);
+                job = NULL;
+            }
+
+            const char *building = (const char *)sqlite3_column_text(stmt, 3);
+            if (first_building || strcmp(current_building, building ? building : "") != 0)
+            {
+                first_building = false;
+                strncpy(current_building, building ? building : "", sizeof(current_building) - 1);
+                char dir_name[128];
+                sanitize_file_name(current_building[0] ? current_building : "未分配楼宇", dir_name, sizeof(dir_name));
+                snprintf(building_dir, sizeof(building_dir), "%s/%s", out_dir, dir_name);
+                if (!create_directory(building_dir))
+                {
+                    printf("无法创建目录: %s\n", building_dir);
+                    ok = false;
+                    break;
+                }
+                summary->building_count++;
+            }
+
+            job = new_statement_job(stmt, &ctx, building_dir);
+            if (!job)
+            {
+                ok = false;
+                break;
+            }
+            summary->owner_count++;
+        }
+
+        if (sqlite3_column_type(stmt, 7) != SQLITE_NULL && !append_statement_item(job, stmt))
+        {
+            ok = false;
+            break;
+        }
+    }
+
+    if (ok && rc != SQLITE_DONE)
+    {
+        fprintf(stderr, "读取对账数据失败: %s\n", sqlite3_errmsg(db->db));
+        ok = false;
+    }
+    if (job)
+    {
+        if (ok)
+            thread_pool_submit(pool, write_statement, job);
+        else
+            free_statement_job(job);
+    }
+    sqlite3_finalize(stmt);
+    if (own_transaction)
+    {
+        sqlite3_exec(db->db, "COMMIT", 0, 0, 0);
+    }
+
+    summary->failed_count = thread_pool_wait(pool);
+    thread_pool_destroy(pool);
+
+    // 未提交的业主不计入写出数
+    summary->file_count = summary->owner_count - summary->failed_count - (ok ? 0 : 1);
+    if (summary->file_count < 0)
+        summary->file_count = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &finished);
+    summary->elapsed_seconds = (finished.tv_sec - started.tv_sec) + (finished.tv_nsec - started.tv_nsec) / 1e9;
+    return ok && summary->failed_count == 0;
+}
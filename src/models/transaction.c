@@ -1,4 +1,5 @@
 #include "models/transaction.h"
+#include "models/billing.h"
 #include "auth/auth.h"
 #include "utils/utils.h"
 #include <stdio.h>
@@ -456,62 +457,275 @@ bool get_unpaid_transactions(Database *db, const char *user_id, QueryResult *res
     return true;
 }
 
+// 条件更新：只有属于该用户且未付或逾期（status 0/2）的账单才会被标记为已付（status 1）
+static const char *PAY_UPDATE_SQL =
+    "UPDATE transactions SET status = 1, payment_date = ?, payment_method = ? "
+    "WHERE transaction_id = ? AND user_id = ? AND status IN (0, 2) "
+    "RETURNING amount, fee_type";
+
+// 缴清该用户全部欠费
+static const char *PAY_ALL_SQL =
+    "UPDATE transactions SET status = 1, payment_date = ?, payment_method = ? "
+    "WHERE user_id = ? AND status IN (0, 2) "
+    "RETURNING transaction_id, fee_type, amount";
+
+// 按幂等键取回批量支付的回执明细
+static const char *PAY_REPLAY_SQL =
+    "SELECT p.transaction_id, t.fee_type, p.amount, p.payment_method, p.created_at "
+    "FROM payment_requests p JOIN transactions t ON p.transaction_id = t.transaction_id "
+    "WHERE p.idempotency_key = ? AND p.user_id = ? "
+    "ORDER BY t.due_date, p.transaction_id";
+
+static const char *PAY_STATUS_SQL =
+    "SELECT status FROM transactions WHERE transaction_id = ? AND user_id = ?";
+
+static const char *PAY_FIND_KEY_SQL =
+    "SELECT transaction_id, amount FROM payment_requests WHERE idempotency_key = ?";
+
+static const char *PAY_RECORD_KEY_SQL =
+    "INSERT INTO payment_requests (idempotency_key, transaction_id, user_id, amount, payment_method, created_at) "
+    "VALUES (?, ?, ?, ?, ?, ?)";
+
 /**
- * 处理用户支付交易
+ * 查找幂等键的既往支付记录
+ *
+ * @return -1 查询失败，0 无记录，1 已支付过同一账单，2 幂等键已用于其他账单
+ */
+static int find_idempotent_payment(Database *db, const char *idempotency_key,
+                                   const char *transaction_id, double *amount_paid)
+{
+    sqlite3_stmt *stmt;
+    if (db_prepare_cached(db, PAY_FIND_KEY_SQL, &stmt) != SQLITE_OK)
+    {
+        return -1;
+    }
+
+    sqlite3_bind_text(stmt, 1, idempotency_key, -1, SQLITE_STATIC);
+
+    int found = 0;
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+    {
+        if (strcmp((const char *)sqlite3_column_text(stmt, 0), transaction_id) == 0)
+        {
+            if (amount_paid)
+            {
+                *amount_paid = sqlite3_column_double(stmt, 1);
+            }
+            found = 1;
+            break;
+        }
+        found = 2;
+    }
+    sqlite3_reset(stmt);
+
+    return (rc == SQLITE_ROW || rc == SQLITE_DONE) ? found : -1;
+}
+
+/**
+ * 支付单笔账单（调用者负责事务）
+ *
+ * 以一条条件UPDATE完成校验和更新，由sqlite3_changes判断结果，
+ * 仅在失败时再查询一次账单状态以区分"不存在"和"已支付"。
+ */
+static PaymentOutcome settle_transaction(Database *db, const char *transaction_id, const char *user_id,
+                                         int payment_method, const char *idempotency_key,
+                                         time_t payment_time, double *amount_paid, int *fee_type)
+{
+    sqlite3_stmt *stmt;
+    if (db_prepare_cached(db, PAY_UPDATE_SQL, &stmt) != SQLITE_OK)
+    {
+        return PAY_FAILED;
+    }
+
+    sqlite3_bind_int64(stmt, 1, payment_time);
+    sqlite3_bind_int(stmt, 2, payment_method);
+    sqlite3_bind_text(stmt, 3, transaction_id, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 4, user_id, -1, SQLITE_STATIC);
+
+    double amount = 0;
+    int paid_fee_type = 0;
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+    {
+        amount = sqlite3_column_double(stmt, 0);
+        paid_fee_type = sqlite3_column_int(stmt, 1);
+    }
+    sqlite3_reset(stmt);
+
+    if (rc != SQLITE_DONE)
+    {
+        return PAY_FAILED;
+    }
+
+    if (sqlite3_changes(db->db) == 0)
+    {
+        if (db_prepare_cached(db, PAY_STATUS_SQL, &stmt) != SQLITE_OK)
+        {
+            return PAY_FAILED;
+        }
+        sqlite3_bind_text(stmt, 1, transaction_id, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 2, user_id, -1, SQLITE_STATIC);
+        PaymentOutcome outcome = sqlite3_step(stmt) == SQLITE_ROW ? PAY_ALREADY_PAID : PAY_NOT_FOUND;
+        sqlite3_reset(stmt);
+        return outcome;
+    }
+
+    if (idempotency_key)
+    {
+        if (db_prepare_cached(db, PAY_RECORD_KEY_SQL, &stmt) != SQLITE_OK)
+        {
+            return PAY_FAILED;
+        }
+        sqlite3_bind_text(stmt, 1, idempotency_key, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 2, transaction_id, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 3, user_id, -1, SQLITE_STATIC);
+        sqlite3_bind_double(stmt, 4, amount);
+        sqlite3_bind_int(stmt, 5, payment_method);
+        sqlite3_bind_int64(stmt, 6, payment_time);
+        rc = sqlite3_step(stmt);
+        sqlite3_reset(stmt);
+        if (rc != SQLITE_DONE)
+        {
+            return PAY_FAILED;
+        }
+    }
+
+    if (amount_paid)
+    {
+        *amount_paid = amount;
+    }
+    if (fee_type)
+    {
+        *fee_type = paid_fee_type;
+    }
+    return PAY_SUCCESS;
+}
+
+/**
+ * 以幂等键支付单笔账单
+ *
+ * 同一幂等键重复提交同一账单时不再修改任何数据，直接返回PAY_REPLAYED和首次支付的金额，
+ * 客户端因超时等原因重试是安全的。不带幂等键时只执行一条条件UPDATE。
  *
  * @param db 数据库连接
  * @param transaction_id 交易ID
  * @param user_id 用户ID
  * @param payment_method 支付方式
- * @return 支付成功返回true，失败返回false
+ * @param idempotency_key 客户端幂等键，可为NULL
+ * @param amount_paid 输出参数，支付金额，可为NULL
+ * @return 支付结果
  */
-bool process_payment(Database *db, const char *transaction_id, const char *user_id, int payment_method)
+PaymentOutcome pay_transaction(Database *db, const char *transaction_id, const char *user_id,
+                               int payment_method, const char *idempotency_key, double *amount_paid)
 {
-    // 先检查交易是否存在并属于该用户
-    char check_query[512];
-    QueryResult check_result;
+    return pay_transaction_at(db, transaction_id, user_id, payment_method, idempotency_key,
+                              time(NULL), amount_paid);
+}
 
-    snprintf(check_query, sizeof(check_query),
-             "SELECT transaction_id, status FROM transactions "
-             "WHERE transaction_id = '%s' AND user_id = '%s'",
-             transaction_id, user_id);
+/**
+ * 以幂等键支付单笔账单，并指定支付时间
+ *
+ * 用于按外部流水的实际到账时间入账（如对账导入），其余行为与pay_transaction相同
+ *
+ * @param payment_time 支付时间
+ */
+PaymentOutcome pay_transaction_at(Database *db, const char *transaction_id, const char *user_id,
+                                  int payment_method, const char *idempotency_key,
+                                  time_t payment_time, double *amount_paid)
+{
+    if (!transaction_id || !user_id)
+    {
+        return PAY_NOT_FOUND;
+    }
 
-    if (!execute_query(db, check_query, &check_result))
+    if (!idempotency_key || idempotency_key[0] == '\0')
     {
-        printf("验证交易记录失败\n");
-        return false;
+        return settle_transaction(db, transaction_id, user_id, payment_method, NULL, payment_time, amount_paid, NULL);
     }
 
-    if (check_result.row_count == 0)
+    // 幂等记录与账单更新需原子完成；已处于外层事务中时直接复用
+    bool own_transaction = sqlite3_get_autocommit(db->db);
+    if (own_transaction && sqlite3_exec(db->db, "BEGIN IMMEDIATE", 0, 0, 0) != SQLITE_OK)
     {
-        printf("未找到该交易记录或您无权支付此交易\n");
-        free_query_result(&check_result);
-        return false;
+        return PAY_FAILED;
     }
 
-    // 检查交易状态是否为未付或逾期
-    int status = atoi(check_result.rows[0].values[1]);
-    if (status == TRANS_PAID)
+    PaymentOutcome outcome;
+    switch (find_idempotent_payment(db, idempotency_key, transaction_id, amount_paid))
     {
-        printf("该交易已支付，无需重复支付\n");
-        free_query_result(&check_result);
-        return false;
+    case 0:
+        outcome = settle_transaction(db, transaction_id, user_id, payment_method,
+                                     idempotency_key, payment_time, amount_paid, NULL);
+        break;
+    case 1:
+        outcome = PAY_REPLAYED;
+        break;
+    case 2:
+        outcome = PAY_KEY_CONFLICT;
+        break;
+    default:
+        outcome = PAY_FAILED;
+        break;
     }
 
-    free_query_result(&check_result);
+    if (own_transaction)
+    {
+        if (outcome == PAY_SUCCESS && sqlite3_exec(db->db, "COMMIT", 0, 0, 0) != SQLITE_OK)
+        {
+            outcome = PAY_FAILED;
+        }
+        if (outcome != PAY_SUCCESS)
+        {
+            sqlite3_exec(db->db, "ROLLBACK", 0, 0, 0);
+        }
+    }
 
-    // 更新交易状态为已付，记录支付时间和方式
-    time_t payment_time = time(NULL);
-    char update_query[512];
+    return outcome;
+}
 
-    snprintf(update_query, sizeof(update_query),
-             "UPDATE transactions SET status = %d, payment_date = %ld, payment_method = %d "
-             "WHERE transaction_id = '%s'",
-             TRANS_PAID, (long)payment_time, payment_method, transaction_id);
+/**
+ * 支付结果的文字说明
+ *
+ * @param outcome 支付结果
+ * @return 说明文字
+ */
+const char *payment_outcome_message(PaymentOutcome outcome)
+{
+    switch (outcome)
+    {
+    case PAY_SUCCESS:
+        return "支付成功";
+    case PAY_REPLAYED:
+        return "该请求已处理，支付已完成";
+    case PAY_NOT_FOUND:
+        return "未找到该交易记录或您无权支付此交易";
+    case PAY_ALREADY_PAID:
+        return "该交易已支付，无需重复支付";
+    case PAY_KEY_CONFLICT:
+        return "幂等键已用于其他交易";
+    case PAY_ROLLED_BACK:
+        return "同批其他账单支付失败，本笔已撤销";
+    default:
+        return "更新交易状态失败";
+    }
+}
 
-    if (!execute_update(db, update_query))
+/**
+ * 处理用户支付交易
+ *
+ * @param db 数据库连接
+ * @param transaction_id 交易ID
+ * @param user_id 用户ID
+ * @param payment_method 支付方式
+ * @return 支付成功返回true，失败返回false
+ */
+bool process_payment(Database *db, const char *transaction_id, const char *user_id, int payment_method)
+{
+    PaymentOutcome outcome = pay_transaction(db, transaction_id, user_id, payment_method, NULL, NULL);
+    if (outcome != PAY_SUCCESS)
     {
-        printf("更新交易状态失败\n");
+        printf("%s\n", payment_outcome_message(outcome));
         return false;
     }
 
@@ -520,218 +734,382 @@ bool process_payment(Database *db, const char *transaction_id, const char *user_
 }
 
 /**
- * 生成物业费记录
- *
- * @param db 数据库连接
+ * 向回执追加一笔明细
  */
-// 添加生成物业费账单的功能函数
-void generate_property_fees(Database *db, const char *user_id, UserType user_type)
+static bool append_receipt_item(PaymentReceipt *receipt, int *capacity, const char *transaction_id,
+                                int fee_type, double amount, PaymentOutcome outcome)
 {
-    printf("\n===== 生成物业费账单 =====\n");
+    if (receipt->item_count == *capacity)
+    {
+        int new_capacity = *capacity ? *capacity * 2 : 16;
+        PaymentReceiptItem *items = realloc(receipt->items, new_capacity * sizeof(PaymentReceiptItem));
+        if (!items)
+        {
+            fprintf(stderr, "内存分配失败：支付回执\n");
+            return false;
+        }
+        receipt->items = items;
+        *capacity = new_capacity;
+    }
 
-    // 获取当前年月
-    time_t now = time(NULL);
-    struct tm tm_now;
-    localtime_r(&now, &tm_now);
+    PaymentReceiptItem *item = &receipt->items[receipt->item_count++];
+    memset(item, 0, sizeof(PaymentReceiptItem));
+    strncpy(item->transaction_id, transaction_id, sizeof(item->transaction_id) - 1);
+    item->fee_type = fee_type;
+    item->amount = amount;
+    item->outcome = outcome;
 
-    int year, month;
-    printf("请输入要生成的物业费年份 (如 2025): ");
-    scanf("%d", &year);
-    getchar();
+    if (outcome == PAY_SUCCESS || outcome == PAY_REPLAYED)
+    {
+        receipt->paid_count++;
+        receipt->total_paid += amount;
+    }
+    return true;
+}
 
-    printf("请输入要生成的物业费月份 (1-12): ");
-    scanf("%d", &month);
-    getchar();
+/**
+ * 从幂等记录还原批量支付回执
+ *
+ * @return -1 查询失败，0 该幂等键无记录，1 已还原回执
+ */
+static int replay_batch_payment(Database *db, const char *user_id, const char *idempotency_key,
+                                PaymentReceipt *receipt, int *capacity)
+{
+    sqlite3_stmt *stmt;
+    if (db_prepare_cached(db, PAY_REPLAY_SQL, &stmt) != SQLITE_OK)
+    {
+        return -1;
+    }
+    sqlite3_bind_text(stmt, 1, idempotency_key, -1, SQLITE_STATIC);
+    sqlite3_bind_text(stmt, 2, user_id, -1, SQLITE_STATIC);
 
-    if (month < 1 || month > 12)
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
     {
-        printf("无效的月份！\n");
-        printf("按任意键返回...");
-        getchar();
-        return;
+        receipt->payment_method = sqlite3_column_int(stmt, 3);
+        receipt->payment_date = (time_t)sqlite3_column_int64(stmt, 4);
+        if (!append_receipt_item(receipt, capacity, (const char *)sqlite3_column_text(stmt, 0),
+                                 sqlite3_column_int(stmt, 1), sqlite3_column_double(stmt, 2), PAY_REPLAYED))
+        {
+            rc = SQLITE_NOMEM;
+            break;
+        }
     }
+    sqlite3_reset(stmt);
 
-    // 确认操作
-    printf("\n将为 %d年%d月 生成物业费账单，确认操作？(y/n): ", year, month);
-    char confirm;
-    scanf("%c", &confirm);
-    getchar();
+    if (rc != SQLITE_DONE)
+    {
+        return -1;
+    }
+    return receipt->item_count > 0 ? 1 : 0;
+}
 
-    if (confirm != 'y' && confirm != 'Y')
+/**
+ * 缴清用户全部欠费，单条UPDATE完成并通过RETURNING生成回执
+ */
+static bool settle_all_outstanding(Database *db, const char *user_id, int payment_method,
+                                   const char *idempotency_key, PaymentReceipt *receipt, int *capacity)
+{
+    sqlite3_stmt *stmt;
+    if (db_prepare_cached(db, PAY_ALL_SQL, &stmt) != SQLITE_OK)
     {
-        printf("操作已取消\n");
-        printf("按任意键返回...");
-        getchar();
-        return;
+        return false;
     }
+    sqlite3_bind_int64(stmt, 1, receipt->payment_date);
+    sqlite3_bind_int(stmt, 2, payment_method);
+    sqlite3_bind_text(stmt, 3, user_id, -1, SQLITE_STATIC);
 
-    // 获取费用标准
-    float property_fee_rate = 0.0;
-    QueryResult fee_result;
-    char query[512];
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+    {
+        if (!append_receipt_item(receipt, capacity, (const char *)sqlite3_column_text(stmt, 0),
+                                 sqlite3_column_int(stmt, 1), sqlite3_column_double(stmt, 2), PAY_SUCCESS))
+        {
+            rc = SQLITE_NOMEM;
+            break;
+        }
+    }
+    sqlite3_reset(stmt);
+    if (rc != SQLITE_DONE)
+    {
+        return false;
+    }
 
-    snprintf(query, sizeof(query),
-             "SELECT price_per_unit FROM fee_standards WHERE fee_type = %d AND "
-             "effective_date <= %ld AND (end_date >= %ld OR end_date = 0) "
-             "ORDER BY effective_date DESC LIMIT 1",
-             TRANS_PROPERTY_FEE, now, now);
+    if (!idempotency_key)
+    {
+        return true;
+    }
 
-    if (!execute_query(db, query, &fee_result) || fee_result.row_count == 0)
+    if (db_prepare_cached(db, PAY_RECORD_KEY_SQL, &stmt) != SQLITE_OK)
     {
-        printf("未找到有效的物业费标准！\n");
-        if (fee_result.row_count > 0)
+        return false;
+    }
+    for (int i = 0; i < receipt->item_count; i++)
+    {
+        sqlite3_reset(stmt);
+        sqlite3_bind_text(stmt, 1, idempotency_key, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 2, receipt->items[i].transaction_id, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 3, user_id, -1, SQLITE_STATIC);
+        sqlite3_bind_double(stmt, 4, receipt->items[i].amount);
+        sqlite3_bind_int(stmt, 5, payment_method);
+        sqlite3_bind_int64(stmt, 6, receipt->payment_date);
+        if (sqlite3_step(stmt) != SQLITE_DONE)
         {
-            free_query_result(&fee_result);
+            sqlite3_reset(stmt);
+            return false;
         }
-        printf("按任意键返回...");
-        getchar();
-        return;
     }
+    sqlite3_reset(stmt);
+    return true;
+}
 
-    property_fee_rate = atof(fee_result.rows[0].values[0]);
-    free_query_result(&fee_result);
+/**
+ * 批量支付账单
+ *
+ * 在一个事务内结清指定账单或该用户的全部欠费，任何一笔失败（不存在、已支付等）
+ * 整批回滚，回执中记录每笔账单的结果以便提示。带幂等键重复提交时不做任何写入，
+ * 直接返回首次支付的回执（明细状态为PAY_REPLAYED）。
+ *
+ * @param db 数据库连接
+ * @param user_id 付款业主ID
+ * @param transaction_ids 要支付的交易ID数组，为NULL时表示全部欠费
+ * @param count transaction_ids中的ID数量
+ * @param payment_method 支付方式
+ * @param idempotency_key 客户端幂等键，可为NULL
+ * @param receipt 输出参数，支付回执，使用后调用free_payment_receipt释放
+ * @return 整批支付成功（或重放成功）返回true，否则返回false
+ */
+bool process_batch_payment(Database *db, const char *user_id, const char *const *transaction_ids, int count,
+                           int payment_method, const char *idempotency_key, PaymentReceipt *receipt)
+{
+    memset(receipt, 0, sizeof(PaymentReceipt));
+    strncpy(receipt->user_id, user_id, sizeof(receipt->user_id) - 1);
+    receipt->payment_method = payment_method;
+    receipt->payment_date = time(NULL);
 
-    if (property_fee_rate <= 0)
+    if (idempotency_key && idempotency_key[0] == '\0')
     {
-        printf("物业费费率无效！\n");
-        printf("按任意键返回...");
-        getchar();
-        return;
+        idempotency_key = NULL;
     }
 
-    // 查询所有有业主的房屋
-    QueryResult rooms_result;
-    snprintf(query, sizeof(query),
-             "SELECT r.room_id, r.owner_id, r.area_sqm, b.building_name, r.room_number "
-             "FROM rooms r "
-             "JOIN buildings b ON r.building_id = b.building_id "
-             "WHERE r.owner_id IS NOT NULL AND r.owner_id != ''");
+    if (sqlite3_exec(db->db, "BEGIN IMMEDIATE", 0, 0, 0) != SQLITE_OK)
+    {
+        fprintf(stderr, "无法开始事务: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+
+    int capacity = 0;
+    bool ok = true;
 
-    if (!execute_query(db, query, &rooms_result) || rooms_result.row_count == 0)
+    if (idempotency_key)
     {
-        printf("未找到有业主的房屋！\n");
-        if (rooms_result.row_count > 0)
+        int replayed = replay_batch_payment(db, user_id, idempotency_key, receipt, &capacity);
+        if (replayed != 0)
         {
-            free_query_result(&rooms_result);
+            sqlite3_exec(db->db, replayed > 0 ? "COMMIT" : "ROLLBACK", 0, 0, 0);
+            return replayed > 0;
         }
-        printf("按任意键返回...");
-        getchar();
-        return;
     }
 
-    // 设置账单起始和结束日期
-    struct tm period_start = {0};
-    period_start.tm_year = year - 1900;
-    period_start.tm_mon = month - 1;
-    period_start.tm_mday = 1;
-
-    struct tm period_end = {0};
-    period_end.tm_year = year - 1900;
-    period_end.tm_mon = month;
-    period_end.tm_mday = 0; // 会自动调整为上个月的最后一天
-    mktime(&period_end);
-
-    // 设置截止日期（当月最后一天）
-    struct tm due_date = {0};
-    due_date.tm_year = year - 1900;
-    due_date.tm_mon = month - 1;
-    due_date.tm_mday = 28; // 先设为28日
-    mktime(&due_date);
-    // 算出当月最后一天
-    if (due_date.tm_mon == 1)
-    { // 2月特殊处理
-        due_date.tm_mday = (year % 4 == 0 && (year % 100 != 0 || year % 400 == 0)) ? 29 : 28;
-    }
-    else if (due_date.tm_mon == 3 || due_date.tm_mon == 5 ||
-             due_date.tm_mon == 8 || due_date.tm_mon == 10)
+    if (transaction_ids == NULL)
     {
-        due_date.tm_mday = 30;
+        ok = settle_all_outstanding(db, user_id, payment_method, idempotency_key, receipt, &capacity);
     }
     else
     {
-        due_date.tm_mday = 31;
+        for (int i = 0; i < count && ok; i++)
+        {
+            double amount = 0;
+            int fee_type = 0;
+            PaymentOutcome outcome = settle_transaction(db, transaction_ids[i], user_id, payment_method,
+                                                        idempotency_key, receipt->payment_date,
+                                                        &amount, &fee_type);
+            ok = append_receipt_item(receipt, &capacity, transaction_ids[i], fee_type, amount, outcome) &&
+                 outcome == PAY_SUCCESS;
+        }
+    }
+
+    if (ok && sqlite3_exec(db->db, "COMMIT", 0, 0, 0) == SQLITE_OK)
+    {
+        return true;
+    }
+
+    sqlite3_exec(db->db, "ROLLBACK", 0, 0, 0);
+    for (int i = 0; i < receipt->item_count; i++)
+    {
+        if (receipt->items[i].outcome == PAY_SUCCESS)
+        {
+            receipt->items[i].outcome = PAY_ROLLED_BACK;
+        }
     }
-    mktime(&due_date);
+    receipt->paid_count = 0;
+    receipt->total_paid = 0;
+    return false;
+}
+
+/**
+ * 释放支付回执
+ *
+ * @param receipt 支付回执
+ */
+void free_payment_receipt(PaymentReceipt *receipt)
+{
+    if (!receipt)
+        return;
+    free(receipt->items);
+    receipt->items = NULL;
+    receipt->item_count = 0;
+}
+
+/**
+ * 打印支付回执
+ *
+ * @param receipt 支付回执
+ */
+void print_payment_receipt(const PaymentReceipt *receipt)
+{
+    static const char *fee_type_names[] = {"其他费用", "物业费", "停车费", "水费", "电费", "燃气费", "滞纳金"};
 
-    // 开始事务
-    sqlite3_exec(db->db, "BEGIN TRANSACTION", 0, 0, 0);
+    char date_str[20];
+    struct tm tm_info;
+    localtime_r(&receipt->payment_date, &tm_info);
+    strftime(date_str, sizeof(date_str), "%Y-%m-%d %H:%M", &tm_info);
 
-    int success_count = 0;
-    int fail_count = 0;
+    printf("\n════════════════════════════════════════════════\n");
+    printf("缴费回执\n");
+    printf("────────────────────────────────────────────────\n");
+    printf("用户ID: %s\n", receipt->user_id);
+    printf("缴费时间: %s\n", date_str);
+    printf("%-40s %-10s %-12s %s\n", "交易编号", "费用类型", "金额", "结果");
 
-    // 为每个房屋生成物业费账单
-    for (int i = 0; i < rooms_result.row_count; i++)
+    for (int i = 0; i < receipt->item_count; i++)
     {
-        const char *room_id = rooms_result.rows[i].values[0];
-        const char *owner_id = rooms_result.rows[i].values[1];
-        float area = atof(rooms_result.rows[i].values[2]);
-        const char *building_name = rooms_result.rows[i].values[3];
-        const char *room_number = rooms_result.rows[i].values[4];
+        const PaymentReceiptItem *item = &receipt->items[i];
+        int type = (item->fee_type >= 1 && item->fee_type <= 6) ? item->fee_type : 0;
+        printf("%-40s %-10s ￥%-11.2f %s\n",
+               item->transaction_id,
+               fee_type_names[type],
+               item->amount,
+               payment_outcome_message(item->outcome));
+    }
 
-        // 计算物业费金额
-        float fee_amount = area * property_fee_rate;
+    printf("────────────────────────────────────────────────\n");
+    printf("缴费笔数: %d  缴费总额: ￥%.2f\n", receipt->paid_count, receipt->total_paid);
+}
 
-        // 检查是否已经存在相同时期的物业费账单
-        QueryResult check_result;
-        char check_query[512];
-        snprintf(check_query, sizeof(check_query),
-                 "SELECT COUNT(*) FROM transactions "
-                 "WHERE user_id = '%s' AND room_id = '%s' AND fee_type = %d "
-                 "AND period_start = %ld AND period_end = %ld",
-                 owner_id, room_id, TRANS_PROPERTY_FEE,
-                 mktime(&period_start), mktime(&period_end));
+/**
+ * 生成物业费记录
+ *
+ * @param db 数据库连接
+ */
+// 添加生成物业费账单的功能函数
+void generate_property_fees(Database *db, const char *user_id, UserType user_type)
+{
+    printf("\n===== 生成物业费账单 =====\n");
+
+    // 获取当前年月
+    time_t now = time(NULL);
+    struct tm tm_now;
+    localtime_r(&now, &tm_now);
+
+    int year, month;
+    printf("请输入要生成的物业费年份 (如 2025): ");
+    scanf("%d", &year);
+    getchar();
+
+    printf("请输入要生成的物业费月份 (1-12): ");
+    scanf("%d", &month);
+    getchar();
+
+    if (month < 1 || month > 12)
+    {
+        printf("无效的月份！\n");
+        printf("按任意键返回...");
+        getchar();
+        return;
+    }
 
-        if (execute_query(db, check_query, &check_result) &&
-            check_result.row_count > 0 &&
-            atoi(check_result.rows[0].values[0]) > 0)
+    // 账期为当月首日至末日，截止日期为当月最后一天
+    struct tm tm_start = {0};
+    tm_start.tm_year = year - 1900;
+    tm_start.tm_mon = month - 1;
+    tm_start.tm_mday = 1;
+    tm_start.tm_isdst = -1;
+
+    struct tm tm_end = {0};
+    tm_end.tm_year = year - 1900;
+    tm_end.tm_mon = month;
+    tm_end.tm_mday = 0; // 会自动调整为上个月的最后一天
+    tm_end.tm_isdst = -1;
+
+    BillingRun run;
+    run.fee_type = TRANS_PROPERTY_FEE;
+    run.period_start = mktime(&tm_start);
+    run.period_end = mktime(&tm_end);
+    run.due_date = run.period_end;
+
+    if (!get_billing_rate(db, TRANS_PROPERTY_FEE, run.period_start, &run.rate))
+    {
+        printf("未找到有效的物业费标准！\n");
+        printf("按任意键返回...");
+        getchar();
+        return;
+    }
+
+    // 可先预览出账结果，确认无误后再写入
+    for (;;)
+    {
+        printf("\n将为 %d年%d月 生成物业费账单（%.2f 元/㎡）\n", year, month, run.rate);
+        printf("1. 预览出账结果（不写入）\n");
+        printf("2. 确认生成\n");
+        printf("0. 取消\n");
+        printf("请选择: ");
+        int choice;
+        if (scanf("%d", &choice) != 1)
         {
-            free_query_result(&check_result);
-            printf("跳过 %s-%s，已存在该账单\n", building_name, room_number);
-            continue;
+            choice = -1;
         }
+        clear_input_buffer();
 
-        if (check_result.row_count > 0)
+        if (choice == 0)
         {
-            free_query_result(&check_result);
+            printf("操作已取消\n");
+            printf("按任意键返回...");
+            getchar();
+            return;
         }
-
-        // 生成唯一的交易ID
-        char transaction_id[37];
-        generate_uuid(transaction_id);
-
-        // 插入交易记录
-        char insert_query[1024];
-        snprintf(insert_query, sizeof(insert_query),
-                 "INSERT INTO transactions "
-                 "(transaction_id, user_id, room_id, fee_type, amount, due_date, "
-                 "payment_date, status, period_start, period_end) VALUES "
-                 "('%s', '%s', '%s', %d, %.2f, %ld, "
-                 "0, 0, %ld, %ld)", // 添加了 payment_date 字段，设为 0
-                 transaction_id, owner_id, room_id, TRANS_PROPERTY_FEE, fee_amount,
-                 mktime(&due_date), mktime(&period_start), mktime(&period_end));
-
-        if (execute_update(db, insert_query))
+        if (choice == 2)
         {
-            success_count++;
+            break;
         }
-        else
+        if (choice == 1)
         {
-            fail_count++;
-            printf("生成 %s-%s 的账单失败\n", building_name, room_number);
+            BillingPreview preview;
+            if (preview_room_billing(db, &run, BILLING_PREVIEW_TOP_N, &preview))
+            {
+                print_billing_preview(&preview);
+                free_billing_preview(&preview);
+            }
+            else
+            {
+                printf("出账预览失败\n");
+            }
         }
     }
 
-    free_query_result(&rooms_result);
-
-    // 提交事务
-    if (fail_count == 0)
+    // 按房屋持有期一次性出账，月中过户的房屋按新旧业主持有天数拆分
+    BillingSummary summary;
+    if (run_room_billing(db, &run, &summary))
     {
-        sqlite3_exec(db->db, "COMMIT", 0, 0, 0);
-        printf("\n✅ 物业费账单生成成功！共生成 %d 条账单记录\n", success_count);
+        printf("\n✅ 物业费账单生成成功！共生成 %d 条账单记录，合计 %.2f 元\n",
+               summary.bill_count, summary.total_amount);
+        if (summary.prorated_count > 0)
+        {
+            printf("其中 %d 条按业主持有天数折算\n", summary.prorated_count);
+        }
     }
     else
     {
-        sqlite3_exec(db->db, "ROLLBACK", 0, 0, 0);
         printf("\n❌ 物业费账单生成失败！已回滚所有操作\n");
     }
 
@@ -742,6 +1120,9 @@ void generate_property_fees(Database *db, const char *user_id, UserType user_typ
 /**
  * 生成停车费记录
  *
+ * 按账期首日生效的停车费标准，为每个有业主的停车位生成一张整期账单，
+ * 与房屋出账共用出账引擎，已出账的车位不重复生成
+ *
  * @param db 数据库连接
  * @param period_start 账单开始日期
  * @param period_end 账单结束日期
@@ -750,60 +1131,20 @@ void generate_property_fees(Database *db, const char *user_id, UserType user_typ
  */
 bool generate_parking_fees(Database *db, time_t period_start, time_t period_end, int due_days)
 {
-    char query[1024];
-    QueryResult parking_spaces;
-    FeeStandard fee_standard;
+    BillingRun run;
+    run.fee_type = TRANS_PARKING_FEE;
+    run.period_start = period_start;
+    run.period_end = period_end;
+    run.due_date = period_end + (due_days * 24 * 60 * 60); // 计算截止日期
 
-    // 获取当前停车费标准
-    if (!get_current_fee_standard(db, TRANS_PARKING_FEE, &fee_standard))
+    if (!get_billing_rate(db, TRANS_PARKING_FEE, period_start, &run.rate))
     {
         printf("获取停车费标准失败\n");
         return false;
     }
 
-    // 查询所有有业主的停车位
-    snprintf(query, sizeof(query),
-             "SELECT parking_id, owner_id FROM parking_spaces "
-             "WHERE owner_id IS NOT NULL AND owner_id != '' AND status = 1");
-
-    if (!execute_query(db, query, &parking_spaces))
-    {
-        printf("查询停车位信息失败\n");
-        return false;
-    }
-
-    time_t due_date = period_end + (due_days * 24 * 60 * 60); // 计算截止日期
-
-    // 为每个停车位生成停车费记录
-    for (int i = 0; i < parking_spaces.row_count; i++)
-    {
-        char *parking_id = parking_spaces.rows[i].values[0];
-        char *owner_id = parking_spaces.rows[i].values[1];
-
-        // 停车费是固定金额
-        float amount = fee_standard.price_per_unit;
-
-        // 创建交易记录
-        Transaction transaction;
-        generate_uuid(transaction.transaction_id);
-        strcpy(transaction.user_id, owner_id);
-        transaction.room_id[0] = '\0'; // 停车费与房屋无关
-        strcpy(transaction.parking_id, parking_id);
-        transaction.fee_type = TRANS_PARKING_FEE;
-        transaction.amount = amount;
-        transaction.payment_date = 0; // 尚未支付
-        transaction.due_date = due_date;
-        transaction.payment_method = PAYMENT_NONE; // 尚未选择支付方式
-        transaction.status = TRANS_UNPAID;         // 未付款
-        transaction.period_start = period_start;
-        transaction.period_end = period_end;
-
-        // 添加交易记录
-        add_transaction(db, "system", USER_ADMIN, &transaction);
-    }
-
-    free_query_result(&parking_spaces);
-    return true;
+    BillingSummary summary;
+    return run_parking_billing(db, &run, &summary);
 }
 
 /**
@@ -817,51 +1158,36 @@ bool generate_parking_fees(Database *db, time_t period_start, time_t period_end,
  */
 bool generate_utility_fees(Database *db, time_t period_start, time_t period_end, int due_days)
 {
-    time_t due_date = period_end + (due_days * 24 * 60 * 60);
-    char transaction_id[40];
+    static const int utility_fee_types[] = {TRANS_WATER_FEE, TRANS_ELECTRICITY_FEE, TRANS_GAS_FEE};
+
+    bool own_transaction = sqlite3_get_autocommit(db->db);
+    if (own_transaction && sqlite3_exec(db->db, "BEGIN IMMEDIATE", 0, 0, 0) != SQLITE_OK)
+    {
+        fprintf(stderr, "无法开始事务: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+
+    // 水费、电费、燃气费依次按房屋持有期出账，同一事务内全部成功或全部回滚
     bool success = true;
+    for (size_t i = 0; i < sizeof(utility_fee_types) / sizeof(utility_fee_types[0]) && success; i++)
+    {
+        BillingRun run;
+        run.fee_type = utility_fee_types[i];
+        run.period_start = period_start;
+        run.period_end = period_end;
+        run.due_date = period_end + (due_days * 24 * 60 * 60);
+        if (!get_billing_rate(db, run.fee_type, period_start, &run.rate))
+        {
+            continue; // 未设置该费用标准
+        }
 
-    // 水费生成
-    const char *water_query =
-        "INSERT INTO transactions (transaction_id, user_id, room_id, fee_type, amount, "
-        "payment_date, due_date, status, period_start, period_end) "
-        "SELECT LOWER(HEX(RANDOMBLOB(16))), r.owner_id, r.room_id, "
-        "3, r.area_sqm * fs.price_per_unit, "
-        "?, ?, 0, ?, ? "
-        "FROM rooms r "
-        "JOIN fee_standards fs ON fs.fee_type = 3 "
-        "WHERE r.owner_id IS NOT NULL "
-        "AND (fs.end_date = 0 OR fs.end_date > ?)";
-
-    success &= execute_parameterized_update(db, water_query, period_start, period_end, due_date);
-
-    // 电费生成
-    const char *electricity_query =
-        "INSERT INTO transactions (transaction_id, user_id, room_id, fee_type, amount, "
-        "payment_date, due_date, status, period_start, period_end) "
-        "SELECT LOWER(HEX(RANDOMBLOB(16))), r.owner_id, r.room_id, "
-        "4, r.area_sqm * fs.price_per_unit, "
-        "?, ?, 0, ?, ? "
-        "FROM rooms r "
-        "JOIN fee_standards fs ON fs.fee_type = 4 "
-        "WHERE r.owner_id IS NOT NULL "
-        "AND (fs.end_date = 0 OR fs.end_date > ?)";
-
-    success &= execute_parameterized_update(db, electricity_query, period_start, period_end, due_date);
-
-    // 燃气费生成
-    const char *gas_query =
-        "INSERT INTO transactions (transaction_id, user_id, room_id, fee_type, amount, "
-        "payment_date, due_date, status, period_start, period_end) "
-        "SELECT LOWER(HEX(RANDOMBLOB(16))), r.owner_id, r.room_id, "
-        "5, r.area_sqm * fs.price_per_unit, "
-        "?, ?, 0, ?, ? "
-        "FROM rooms r "
-        "JOIN fee_standards fs ON fs.fee_type = 5 "
-        "WHERE r.owner_id IS NOT NULL "
-        "AND (fs.end_date = 0 OR fs.end_date > ?)";
-
-    success &= execute_parameterized_update(db, gas_query, period_start, period_end, due_date);
+        BillingSummary summary;
+        success = run_room_billing(db, &run, &summary);
+    }
 
+    if (own_transaction)
+    {
+        sqlite3_exec(db->db, success ? "COMMIT" : "ROLLBACK", 0, 0, 0);
+    }
     return success;
 }
\ No newline at end of file
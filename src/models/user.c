@@ -1,5 +1,6 @@
 #include "models/user.h"
 #include "utils/utils.h"
+#include "utils/pinyin.h"
 #include "auth/auth.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -42,6 +43,16 @@ bool create_owner(Database *db, Owner *owner, const char *password)
     if (!execute_update(db, insert_query)) {
         return false; 
     }
+
+    // 写入姓名排序键
+    sqlite3_stmt *key_stmt;
+    if (sqlite3_prepare_v2(db->db, "UPDATE users SET name_sort_key = ? WHERE rowid = last_insert_rowid();", -1,
+                           &key_stmt, NULL) == SQLITE_OK)
+    {
+        pinyin_bind_sort_key(key_stmt, 1, owner->name);
+        sqlite3_step(key_stmt);
+        sqlite3_finalize(key_stmt);
+    }
     
     // 获取自动分配的ID
     const char *id_query = "SELECT last_insert_rowid();";
@@ -71,7 +82,7 @@ bool update_owner(Database *db, const char *user_id, UserType user_type, Owner *
         fprintf(stderr, "更新业主信息参数无效\n");
         return false;
     }
-    const char *query = "UPDATE users SET name=?,phone_number=?,email=? WHERE user_id=?;";
+    const char *query = "UPDATE users SET name=?,phone_number=?,email=?,name_sort_key=? WHERE user_id=?;";
     sqlite3_stmt *stmt;
     int rc = sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL);
     if (rc != SQLITE_OK)
@@ -82,7 +93,8 @@ bool update_owner(Database *db, const char *user_id, UserType user_type, Owner *
     sqlite3_bind_text(stmt, 1, owner->name, -1, SQLITE_STATIC);
     sqlite3_bind_text(stmt, 2, owner->phone_number, -1, SQLITE_STATIC);
     sqlite3_bind_text(stmt, 3, owner->email, -1, SQLITE_STATIC);
-    sqlite3_bind_text(stmt, 4, user_id, -1, SQLITE_STATIC);
+    pinyin_bind_sort_key(stmt, 4, owner->name);
+    sqlite3_bind_text(stmt, 5, user_id, -1, SQLITE_STATIC);
     rc = sqlite3_step(stmt);
     sqlite3_finalize(stmt);
     if (rc != SQLITE_DONE)
@@ -155,7 +167,8 @@ bool create_staff(Database *db, Staff *staff, const char *password)
         return false;
     }
 
-    const char *query = "INSERT INTO users (user_id, name, phone_number, user_type, password) VALUES (?, ?, ?, ?, ?)";
+    const char *query = "INSERT INTO users (user_id, name, phone_number, user_type, password, name_sort_key) "
+                        "VALUES (?, ?, ?, ?, ?, ?)";
     sqlite3_stmt *stmt;
     int rc = sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL);
     if (rc != SQLITE_OK)
@@ -169,6 +182,7 @@ bool create_staff(Database *db, Staff *staff, const char *password)
     sqlite3_bind_text(stmt, 3, staff->phone_number, -1, SQLITE_STATIC);
     sqlite3_bind_int(stmt, 4, USER_STAFF);
     sqlite3_bind_text(stmt, 5, hashed_password, -1, SQLITE_STATIC);
+    pinyin_bind_sort_key(stmt, 6, staff->name);
 
     rc = sqlite3_step(stmt);
     sqlite3_finalize(stmt);
@@ -330,7 +344,8 @@ bool create_admin(Database *db, Admin *admin, const char *password)
         return false;
     }
 
-    const char *query = "INSERT INTO users (user_id, name, phone_number, user_type, password) VALUES (?,?,?,?,?)";
+    const char *query = "INSERT INTO users (user_id, name, phone_number, user_type, password, name_sort_key) "
+                        "VALUES (?,?,?,?,?,?)";
     sqlite3_stmt *stmt;
     int rc = sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL);
     if (rc != SQLITE_OK)
@@ -343,6 +358,7 @@ bool create_admin(Database *db, Admin *admin, const char *password)
     sqlite3_bind_text(stmt, 3, admin->username, -1, SQLITE_STATIC);
     sqlite3_bind_int(stmt, 4, USER_ADMIN);
     sqlite3_bind_text(stmt, 5, hashed_password, -1, SQLITE_STATIC);
+    pinyin_bind_sort_key(stmt, 6, admin->name);
 
     rc = sqlite3_step(stmt);
     sqlite3_finalize(stmt);
@@ -371,7 +387,7 @@ bool update_admin(Database *db, const char *user_id, UserType user_type, Admin *
         fprintf(stderr, "更新管理员信息参数无效\n");
         return false;
     }
-    const char *query = "UPDATE users SET name =?, phone_number =? WHERE user_id =? AND user_type =?";
+    const char *query = "UPDATE users SET name =?, phone_number =?, name_sort_key =? WHERE user_id =? AND user_type =?";
     sqlite3_stmt *stmt;
     int rc = sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL);
     if (rc != SQLITE_OK)
@@ -382,8 +398,9 @@ bool update_admin(Database *db, const char *user_id, UserType user_type, Admin *
 
     sqlite3_bind_text(stmt, 1, admin->name, -1, SQLITE_STATIC);
     sqlite3_bind_text(stmt, 2, admin->username, -1, SQLITE_STATIC);
-    sqlite3_bind_text(stmt, 3, user_id, -1, SQLITE_STATIC);
-    sqlite3_bind_int(stmt, 4, USER_ADMIN);
+    pinyin_bind_sort_key(stmt, 3, admin->name);
+    sqlite3_bind_text(stmt, 4, user_id, -1, SQLITE_STATIC);
+    sqlite3_bind_int(stmt, 5, USER_ADMIN);
 
     rc = sqlite3_step(stmt);
     sqlite3_finalize(stmt);
@@ -756,13 +773,20 @@ int compare_id_asc(const void *a, const void *b)
     return strcmp(owner_a->user_id, owner_b->user_id);
 }
 
+static const char *owner_name(const void *record)
+{
+    return ((const Owner *)record)->name;
+}
+
 /**
  * @brief 排序业主列表
  *
+ * compare_func为NULL时按姓名拼音排序：预先计算排序键，只排序键/指针对，
+ * 不搬动Owner结构体
+ *
  * @param db 数据库连接
- * @param compare_func 用于排序的比较函数
+ * @param compare_func 用于排序的比较函数，NULL表示按姓名拼音排序
  */
-
 void sort_owners(Database *db, int (*compare_func)(const void *, const void *))
 {
     // 确保数据库存在
@@ -773,8 +797,7 @@ void sort_owners(Database *db, int (*compare_func)(const void *, const void *))
     }
 
     // 查询业主数据
-    const char *query = "SELECT user_id, name FROM users WHERE role_id = "
-                        "(SELECT role_id FROM roles WHERE role_name = '业主')";
+    const char *query = "SELECT user_id, name FROM users WHERE role_id = 'role_owner'";
 
     QueryResult result;
     if (!execute_query(db, query, &result))
@@ -791,34 +814,46 @@ void sort_owners(Database *db, int (*compare_func)(const void *, const void *))
         return;
     }
 
-    // 申请内存存储业主数据
-    Owner *owners = malloc(sizeof(Owner) * result.row_count);
-    if (!owners)
+    // 申请内存存储业主数据和排序用的指针
+    Owner *owners = calloc(result.row_count, sizeof(Owner));
+    void **sorted = malloc(sizeof(void *) * result.row_count);
+    if (!owners || !sorted)
     {
         printf("内存分配失败\n");
+        free(owners);
+        free(sorted);
         free_query_result(&result);
         return;
     }
 
     // 解析查询结果并填充 owners 数组
-    for (int i = 0; result.row_count; i++)
+    for (int i = 0; i < result.row_count; i++)
     {
-        strcpy(owners[i].user_id, result.rows[i].values[0]); // user_id
-        strcpy(owners[i].name, result.rows[i].values[1]);    // name
+        snprintf(owners[i].user_id, sizeof(owners[i].user_id), "%s", result.rows[i].values[0]);
+        snprintf(owners[i].name, sizeof(owners[i].name), "%s", result.rows[i].values[1]);
+        sorted[i] = &owners[i];
     }
 
-    // 使用 qsort 对业主数组进行排序
     printf("正在对业主进行排序...\n");
-    qsort(owners, result.row_count, sizeof(Owner), compare_func);
+    if (compare_func)
+    {
+        qsort(owners, result.row_count, sizeof(Owner), compare_func);
+    }
+    else if (!pinyin_sort_records(sorted, result.row_count, owner_name))
+    {
+        printf("内存分配失败\n");
+    }
     printf("排序完成。\n");
 
     // 显示排序后的业主列表
-    for (int i = 0; result.row_count; i++)
+    for (int i = 0; i < result.row_count; i++)
     {
-        printf("ID: %s, Name: %s\n", owners[i].user_id, owners[i].name);
+        const Owner *owner = sorted[i];
+        printf("ID: %s, Name: %s\n", owner->user_id, owner->name);
     }
 
     // 释放内存
+    free(sorted);
     free(owners);
     free_query_result(&result); // 释放查询结果
 }
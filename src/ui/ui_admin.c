@@ -10,16 +10,28 @@
  */
 #include "ui/ui_admin.h"
 #include "ui/ui_login.h"
+#include "ui/ui_staff.h"
 #include "models/building.h"
 #include "models/apartment.h"
 #include "models/user.h"
 #include "models/transaction.h"
+#include "models/late_fee.h"
+#include "models/ledger.h"
+#include "models/fee_cube.h"
+#include "models/statement.h"
 #include "models/service.h"
+#include "models/billing.h"
+#include "models/scheduler.h"
+#include "models/owner_sort.h"
+#include "db/db_init.h"
 #include "db/db_query.h"
 #include "db/db_utils.h"
 #include "utils/utils.h"
 #include "utils/file_ops.h"
 #include "utils/console.h"
+#include "utils/export.h"
+#include "utils/table.h"
+#include "utils/csv.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -91,144 +103,25 @@ void show_admin_main_screen(Database *db, const char *user_id, UserType user_typ
 }
 
 /**
- * @brief 业主信息链表节点结构
- */
-typedef struct OwnerNode
-{
-    char name[100];
-    char phone[20];
-    char email[100];
-    char building[50];
-    char room[20];
-    char floor[10];
-    struct OwnerNode *next;
-} OwnerNode;
-
-/**
- * @brief 服务人员信息链表节点结构
- */
-typedef struct StaffNode
-{
-    char name[100];
-    char service_type[50];
-    int building_count;
-    char buildings[255];
-    struct StaffNode *next;
-} StaffNode;
-
-/**
- * @brief 创建一个新的业主节点
- *
- * @param name 业主姓名
- * @param phone 电话号码
- * @param email 电子邮箱
- * @param building 所在楼宇
- * @param room 房间号
- * @param floor 楼层
- * @return OwnerNode* 新创建的节点指针
- */
-OwnerNode *create_owner_node_by_admin(const char *name, const char *phone, const char *email,
-                                      const char *building, const char *room, const char *floor)
-{
-    OwnerNode *node = (OwnerNode *)malloc(sizeof(OwnerNode));
-    if (node == NULL)
-    {
-        printf("内存分配失败\n");
-        return NULL;
-    }
-
-    strncpy(node->name, name ? name : "未知", sizeof(node->name) - 1);
-    strncpy(node->phone, phone ? phone : "未登记", sizeof(node->phone) - 1);
-    strncpy(node->email, email ? email : "未登记", sizeof(node->email) - 1);
-    strncpy(node->building, building ? building : "未分配", sizeof(node->building) - 1);
-    strncpy(node->room, room ? room : "--", sizeof(node->room) - 1);
-    strncpy(node->floor, floor ? floor : "--", sizeof(node->floor) - 1);
-
-    node->next = NULL;
-    return node;
-}
-
-/**
- * @brief 创建一个新的服务人员节点
- *
- * @param name 服务人员姓名
- * @param service_type 服务类型
- * @param building_count 负责楼宇数量
- * @param buildings 负责楼宇列表
- * @return StaffNode* 新创建的节点指针
- */
-StaffNode *create_staff_node(const char *name, const char *service_type,
-                             int building_count, const char *buildings)
-{
-    StaffNode *node = (StaffNode *)malloc(sizeof(StaffNode));
-    if (node == NULL)
-    {
-        printf("内存分配失败\n");
-        return NULL;
-    }
-
-    strncpy(node->name, name ? name : "未知", sizeof(node->name) - 1);
-    strncpy(node->service_type, service_type ? service_type : "未知", sizeof(node->service_type) - 1);
-    node->building_count = building_count;
-    strncpy(node->buildings, buildings ? buildings : "无", sizeof(node->buildings) - 1);
-
-    node->next = NULL;
-    return node;
-}
-
-/**
- * @brief 保存业主信息到文件
+ * @brief 把查询结果导出到文件
  *
- * @param head 业主信息链表头指针
- * @param filename 要保存的文件名
- */
-void save_owners_to_file(OwnerNode *head, const char *filename)
-{
-    FILE *file = fopen(filename, "w");
-    if (!file)
-    {
-        printf("无法打开文件 %s\n", filename);
-        return;
-    }
-    fprintf(file, "%-15s %-15s %-25s %-15s %-10s %-6s\n",
-            "姓名", "电话", "邮箱", "所在楼宇", "房间号", "楼层");
-    fprintf(file, "--------------------------------------------------------------------------------\n");
-
-    for (OwnerNode *node = head; node != NULL; node = node->next)
-    {
-        fprintf(file, "%-15s %-15s %-25s %-15s %-10s %-6s\n",
-                node->name, node->phone, node->email,
-                node->building, node->room, node->floor);
-    }
-    fclose(file);
-    printf("业主信息已保存到 %s\n", filename);
-}
-
-/**
- * @brief 保存服务人员信息到文件
+ * 以.tsv结尾时为TSV，否则为CSV；以.gz结尾时压缩
  *
- * @param head 服务人员信息链表头指针
+ * @param db 数据库连接
+ * @param sql 查询语句
  * @param filename 要保存的文件名
  */
-void save_staff_to_file(StaffNode *head, const char *filename)
+static void export_sql_to_file(Database *db, const char *sql, const char *filename)
 {
-    FILE *file = fopen(filename, "w");
-    if (!file)
+    long rows;
+    if (export_query(db, sql, NULL, NULL, filename, NULL, &rows))
     {
-        printf("无法打开文件 %s\n", filename);
-        return;
+        printf("%ld 条记录已保存到 %s\n", rows, filename);
     }
-    fprintf(file, "%-15s %-15s %-12s %-40s\n",
-            "姓名", "服务类型", "负责楼宇数", "负责楼宇");
-    fprintf(file, "--------------------------------------------------------------------------------\n");
-
-    for (StaffNode *node = head; node != NULL; node = node->next)
+    else
     {
-        fprintf(file, "%-15s %-15s %-12d %-40s\n",
-                node->name, node->service_type, node->building_count, node->buildings);
+        printf("无法保存到文件 %s\n", filename);
     }
-    fclose(file);
-    printf("服务人员信息已保存到 %s\n", filename);
 }
 
 /**
@@ -481,20 +374,22 @@ void manage_buildings(Database *db, const char *user_id)
 
         if (execute_query(db, sql, &result))
         {
-            printf("\n=== 楼宇列表 ===\n");
-            printf("%-20s %-30s %-10s\n",
-                   "楼宇名称", "地址", "楼层数");
-            printf("--------------------------------------------------------\n");
+            static const TableColumn columns[] = {
+                {"楼宇名称", TABLE_ALIGN_LEFT, 20},
+                {"地址", TABLE_ALIGN_LEFT, 30},
+                {"楼层数", TABLE_ALIGN_RIGHT, 0},
+            };
+            Table table;
 
-            for (int i = 0; i < result.row_count; i++)
+            printf("\n=== 楼宇列表 ===\n");
+            if (table_begin(&table, columns, 3, 0))
             {
-                printf("%-20s %-30s %-10s\n",
-                       result.rows[i].values[1],
-                       result.rows[i].values[2],
-                       result.rows[i].values[3]);
+                for (int i = 0; i < result.row_count; i++)
+                {
+                    table_add_row(&table, (const char *const *)&result.rows[i].values[1]);
+                }
+                table_end(&table);
             }
-
-            printf("--------------------------------------------------------\n");
             printf("共 %d 条记录\n", result.row_count);
 
             free_query_result(&result);
@@ -707,26 +602,36 @@ void manage_apartments(Database *db, const char *user_id)
                  "ORDER BY b.building_name, r.floor, r.room_number;");
         if (execute_query(db, sql, &result))
         {
-            printf("\n=== 住户列表 ===\n");
-            printf("%-20s %-15s %-8s %-12s %-20s %-12s\n",
-                   "楼宇名称", "房间号", "楼层", "面积(m²)", "业主姓名", "状态");
-            printf("---------------------------------------------------------------------------------\n");
+            static const TableColumn columns[] = {
+                {"楼宇名称", TABLE_ALIGN_LEFT, 20},
+                {"房间号", TABLE_ALIGN_LEFT, 15},
+                {"楼层", TABLE_ALIGN_RIGHT, 0},
+                {"面积(m²)", TABLE_ALIGN_RIGHT, 0},
+                {"业主姓名", TABLE_ALIGN_LEFT, 20},
+                {"状态", TABLE_ALIGN_LEFT, 12},
+            };
+            Table table;
 
-            for (int i = 0; i < result.row_count; i++)
+            printf("\n=== 住户列表 ===\n");
+            if (table_begin(&table, columns, 6, 0))
             {
-                int floor = atoi(result.rows[i].values[3]);
-                float area = atof(result.rows[i].values[4]);
-
-                printf("%-20s %-15s %-8d %-12.2f %-20s %-12s\n",
-                       result.rows[i].values[1],
-                       result.rows[i].values[2],
-                       floor,
-                       area,
-                       result.rows[i].values[5] ? result.rows[i].values[5] : "未分配",
-                       result.rows[i].values[6]);
+                for (int i = 0; i < result.row_count; i++)
+                {
+                    char floor[16], area[32];
+                    snprintf(floor, sizeof(floor), "%d", atoi(result.rows[i].values[3]));
+                    snprintf(area, sizeof(area), "%.2f", atof(result.rows[i].values[4]));
+
+                    const char *values[] = {
+                        result.rows[i].values[1],
+                        result.rows[i].values[2],
+                        floor,
+                        area,
+                        result.rows[i].values[5] ? result.rows[i].values[5] : "未分配",
+                        result.rows[i].values[6]};
+                    table_add_row(&table, values);
+                }
+                table_end(&table);
             }
-
-            printf("---------------------------------------------------------------------------------\n");
             printf("共 %d 条记录\n", result.row_count);
 
             free_query_result(&result);
@@ -832,7 +737,7 @@ void manage_users(Database *db, const char *user_id, UserType user_type)
                  "VALUES ('%s', '%s', '%s', '%s', '%s', '%s', '%s', '1', datetime('now'));",
                  new_user_id, username, password_hash, name, phone, email, role_id);
 
-        if (execute_update(db, sql))
+        if (execute_update(db, sql) && db_set_name_sort_key(db, new_user_id, name) == SQLITE_OK)
             printf("用户添加成功！新用户ID: %s\n", new_user_id);
         else
             printf("用户添加失败。\n");
@@ -954,7 +859,7 @@ void manage_users(Database *db, const char *user_id, UserType user_type)
                      "UPDATE users SET name = '%s' WHERE user_id = '%s';",
                      new_name, modify_user_id);
 
-            if (execute_update(db, sql))
+            if (execute_update(db, sql) && db_set_name_sort_key(db, modify_user_id, new_name) == SQLITE_OK)
                 printf("用户姓名更新成功！\n");
             else
                 printf("更新失败。\n");
@@ -1073,10 +978,19 @@ void manage_users(Database *db, const char *user_id, UserType user_type)
 
         if (execute_query(db, sql, &result))
         {
+            static const TableColumn columns[] = {
+                {"用户名", TABLE_ALIGN_LEFT, 15},
+                {"姓名", TABLE_ALIGN_LEFT, 15},
+                {"电话", TABLE_ALIGN_LEFT, 15},
+                {"邮箱", TABLE_ALIGN_LEFT, 25},
+                {"角色", TABLE_ALIGN_LEFT, 0},
+                {"状态", TABLE_ALIGN_LEFT, 0},
+                {"注册日期", TABLE_ALIGN_LEFT, 0},
+            };
+            Table table;
+
             printf("\n=== 用户列表 ===\n");
-            printf("%-15s %-15s %-15s %-25s %-12s %-10s %-20s\n",
-                   "用户名", "姓名", "电话", "邮箱", "角色", "状态", "注册日期");
-            printf("----------------------------------------------------------------------------------------------------------\n");
+            table_begin(&table, columns, 7, 0);
 
             for (int i = 0; i < result.row_count; i++)
             {
@@ -1119,16 +1033,17 @@ void manage_users(Database *db, const char *user_id, UserType user_type)
                     strncpy(formatted_date, "未设置", sizeof(formatted_date) - 1);
                 }
 
-                printf("%-15s %-15s %-15s %-25s %-12s %-10s %-20s\n",
-                       result.rows[i].values[0], // username
-                       result.rows[i].values[1], // name
-                       result.rows[i].values[2], // phone_number
-                       result.rows[i].values[3], // email
-                       result.rows[i].values[4], // role_name
-                       result.rows[i].values[5], // status_name
-                       formatted_date);          // formatted registration_date
+                const char *values[] = {
+                    result.rows[i].values[0], // username
+                    result.rows[i].values[1], // name
+                    result.rows[i].values[2], // phone_number
+                    result.rows[i].values[3], // email
+                    result.rows[i].values[4], // role_name
+                    result.rows[i].values[5], // status_name
+                    formatted_date};          // formatted registration_date
+                table_add_row(&table, values);
             }
-            printf("----------------------------------------------------------------------------------------------------------\n");
+            table_end(&table);
             printf("共 %d 条记录\n", result.row_count);
 
             free_query_result(&result);
@@ -1336,19 +1251,22 @@ void show_service_assignment_screen(Database *db, const char *user_id, UserType
 
             if (execute_query(db, sql, &result))
             {
-                printf("\n=== 服务人员分配情况 ===\n");
-                printf("%-20s %-20s %-20s\n",
-                       "服务人员姓名", "服务人员用户名", "楼宇名称");
-                printf("------------------------------------------------------------\n");
+                static const TableColumn columns[] = {
+                    {"服务人员姓名", TABLE_ALIGN_LEFT, 20},
+                    {"服务人员用户名", TABLE_ALIGN_LEFT, 20},
+                    {"楼宇名称", TABLE_ALIGN_LEFT, 20},
+                };
+                Table table;
 
-                for (int i = 0; i < result.row_count; i++)
+                printf("\n=== 服务人员分配情况 ===\n");
+                if (table_begin(&table, columns, 3, 0))
                 {
-                    printf("%-20s %-20s %-20s\n",
-                           result.rows[i].values[0],
-                           result.rows[i].values[1],
-                           result.rows[i].values[2]);
+                    for (int i = 0; i < result.row_count; i++)
+                    {
+                        table_add_row(&table, (const char *const *)result.rows[i].values);
+                    }
+                    table_end(&table);
                 }
-                printf("------------------------------------------------------------\n");
                 printf("共 %d 条记录\n", result.row_count);
 
                 free_query_result(&result);
@@ -1372,6 +1290,41 @@ void show_service_assignment_screen(Database *db, const char *user_id, UserType
     }
 }
 
+/**
+ * @brief 以表格显示业主查询结果
+ *
+ * @param result 依次为姓名、电话、邮箱、楼宇、房间号、楼层的查询结果
+ */
+static void print_owner_rows(const QueryResult *result)
+{
+    static const TableColumn columns[] = {
+        {"姓名", TABLE_ALIGN_LEFT, 16},
+        {"电话", TABLE_ALIGN_LEFT, 15},
+        {"邮箱", TABLE_ALIGN_LEFT, 25},
+        {"所在楼宇", TABLE_ALIGN_LEFT, 16},
+        {"房间号", TABLE_ALIGN_LEFT, 10},
+        {"楼层", TABLE_ALIGN_RIGHT, 0},
+    };
+    Table table;
+    if (!table_begin(&table, columns, 6, 0))
+    {
+        return;
+    }
+    for (int i = 0; i < result->row_count; i++)
+    {
+        char **row = result->rows[i].values;
+        const char *values[] = {
+            row[0],
+            row[1] ? row[1] : "未登记",
+            row[2] ? row[2] : "未登记",
+            row[3] ? row[3] : "未分配",
+            row[4] ? row[4] : "--",
+            row[5] ? row[5] : "--"};
+        table_add_row(&table, values);
+    }
+    table_end(&table);
+}
+
 /**
  * @brief 显示信息查询界面
  *
@@ -1422,21 +1375,7 @@ void show_info_query_screen(Database *db, const char *user_id, UserType user_typ
             if (execute_query(db, sql, &result))
             {
                 printf("\n=== 业主信息查询结果 ===\n");
-                printf("%-15s %-15s %-25s %-15s %-10s %-6s\n",
-                       "姓名", "电话", "邮箱", "所在楼宇", "房间号", "楼层");
-                printf("--------------------------------------------------------------------------------\n");
-
-                for (int i = 0; i < result.row_count; i++)
-                {
-                    printf("%-15s %-15s %-25s %-15s %-10s %-6s\n",
-                           result.rows[i].values[0],                                       // 姓名
-                           result.rows[i].values[1] ? result.rows[i].values[1] : "未登记", // 电话
-                           result.rows[i].values[2] ? result.rows[i].values[2] : "未登记", // 邮箱
-                           result.rows[i].values[3] ? result.rows[i].values[3] : "未分配", // 楼宇
-                           result.rows[i].values[4] ? result.rows[i].values[4] : "--",     // 房间号
-                           result.rows[i].values[5] ? result.rows[i].values[5] : "--");    // 楼层
-                }
-                printf("--------------------------------------------------------------------------------\n");
+                print_owner_rows(&result);
                 printf("共 %d 条记录\n", result.row_count);
                 free_query_result(&result);
             }
@@ -1466,21 +1405,26 @@ void show_info_query_screen(Database *db, const char *user_id, UserType user_typ
 
             if (execute_query(db, sql, &result))
             {
-                printf("\n=== 服务人员查询结果 ===\n");
-                printf("%-15s %-15s %-15s %-12s %-30s\n",
-                       "姓名", "服务类型", "联系电话", "负责楼宇数", "负责楼宇");
-                printf("--------------------------------------------------------------------------------\n");
+                static const TableColumn columns[] = {
+                    {"姓名", TABLE_ALIGN_LEFT, 16},
+                    {"服务类型", TABLE_ALIGN_LEFT, 16},
+                    {"联系电话", TABLE_ALIGN_LEFT, 15},
+                    {"负责楼宇数", TABLE_ALIGN_RIGHT, 0},
+                    {"负责楼宇", TABLE_ALIGN_LEFT, 30},
+                };
+                Table table;
 
-                for (int i = 0; i < result.row_count; i++)
+                printf("\n=== 服务人员查询结果 ===\n");
+                if (table_begin(&table, columns, 5, 0))
                 {
-                    printf("%-15s %-15s %-15s %-12s %-30s\n",
-                           result.rows[i].values[0],                                    // 姓名
-                           result.rows[i].values[1],                                    // 服务类型
-                           result.rows[i].values[2],                                    // 电话
-                           result.rows[i].values[3],                                    // 楼宇数量
-                           result.rows[i].values[4] ? result.rows[i].values[4] : "无"); // 楼宇列表
+                    for (int i = 0; i < result.row_count; i++)
+                    {
+                        char **row = result.rows[i].values;
+                        const char *values[] = {row[0], row[1], row[2], row[3], row[4] ? row[4] : "无"};
+                        table_add_row(&table, values);
+                    }
+                    table_end(&table);
                 }
-                printf("--------------------------------------------------------------------------------\n");
                 printf("共 %d 条记录\n", result.row_count);
                 free_query_result(&result);
             }
@@ -1500,10 +1444,167 @@ void show_info_query_screen(Database *db, const char *user_id, UserType user_typ
     } while (1);
 }
 
+#define OWNER_SORT_SHOW_ROWS 50
+
+/**
+ * @brief 把多列排序后的业主写入文件
+ *
+ * @param owners 已排序的业主数据
+ * @param filename 文件名，格式由扩展名决定
+ */
+static void save_sorted_owners(const OwnerSortTable *owners, const char *filename)
+{
+    ExportOptions options;
+    export_options_for_path(&options, filename);
+    CsvWriter writer;
+    if (!csv_writer_open(&writer, filename, options.delimiter,
+                         (options.bom ? CSV_WRITE_BOM : 0) | (options.gzip ? CSV_WRITE_GZIP : 0)))
+    {
+        printf("无法创建文件: %s\n", filename);
+        return;
+    }
+
+    const char *header[] = {"姓名", "电话", "楼宇", "房号", "面积", "欠费", "注册日期"};
+    for (int i = 0; i < 7; i++)
+    {
+        csv_write_field(&writer, header[i]);
+    }
+    csv_end_record(&writer);
+
+    for (size_t i = 0; i < owners->count; i++)
+    {
+        uint32_t row = owners->order[i];
+        char area[32], outstanding[32], registered[16];
+        snprintf(area, sizeof(area), "%.2f", owners->areas[row]);
+        snprintf(outstanding, sizeof(outstanding), "%.2f", owners->outstanding[row]);
+        time_t reg_time = (time_t)owners->registered[row];
+        strftime(registered, sizeof(registered), "%Y-%m-%d", localtime(&reg_time));
+
+        csv_write_field(&writer, owners->names[row]);
+        csv_write_field(&writer, owners->phones[row] ? owners->phones[row] : "");
+        csv_write_field(&writer, owners->buildings[row] ? owners->buildings[row] : "");
+        csv_write_field(&writer, owners->rooms[row] ? owners->rooms[row] : "");
+        csv_write_field(&writer, owners->area_nulls[row] ? "" : area);
+        csv_write_field(&writer, outstanding);
+        csv_write_field(&writer, registered);
+        csv_end_record(&writer);
+    }
+
+    if (csv_writer_close(&writer))
+    {
+        printf("✓ %zu 条数据已成功导出到%s\n", owners->count, filename);
+    }
+    else
+    {
+        printf("导出失败: %s\n", filename);
+    }
+}
+
+/**
+ * @brief 按多个字段组合排序查看业主
+ *
+ * 业主数据按列载入内存后由排序引擎一次排好，显示前若干条，可把全部结果保存到文件
+ *
+ * @param db 数据库连接指针
+ */
+static void show_owner_multi_sort(Database *db)
+{
+    char spec[256];
+    printf("\n可用字段：欠费 面积 楼宇 房号 注册时间 姓名，字段后加\":降序\"表示降序\n");
+    printf("请输入排序字段（如 欠费:降序,楼宇,房号）: ");
+    if (!fgets(spec, sizeof(spec), stdin))
+    {
+        return;
+    }
+    trim_newline(spec);
+
+    OwnerSortKey keys[ROW_SORT_MAX_COLUMNS];
+    int key_count;
+    if (!owner_sort_parse(spec, keys, ROW_SORT_MAX_COLUMNS, &key_count))
+    {
+        return;
+    }
+
+    OwnerSortTable owners;
+    if (!owner_sort_load(db, &owners))
+    {
+        printf("载入业主数据失败\n");
+        return;
+    }
+    RowSortStats stats;
+    if (!owner_sort_apply(&owners, keys, key_count, &stats))
+    {
+        printf("排序失败\n");
+        owner_sort_free(&owners);
+        return;
+    }
+
+    printf("\n=== 业主信息(按");
+    for (int i = 0; i < key_count; i++)
+    {
+        printf("%s%s%s", i > 0 ? "、" : "", owner_sort_field_title(keys[i].field),
+               keys[i].descending ? "降序" : "");
+    }
+    printf("排序) ===\n");
+
+    static const TableColumn columns[] = {
+        {"姓名", TABLE_ALIGN_LEFT, 16},
+        {"电话", TABLE_ALIGN_LEFT, 15},
+        {"楼宇", TABLE_ALIGN_LEFT, 16},
+        {"房号", TABLE_ALIGN_LEFT, 10},
+        {"面积", TABLE_ALIGN_RIGHT, 0},
+        {"欠费", TABLE_ALIGN_RIGHT, 0},
+        {"注册日期", TABLE_ALIGN_LEFT, 0},
+    };
+    size_t shown = owners.count < OWNER_SORT_SHOW_ROWS ? owners.count : OWNER_SORT_SHOW_ROWS;
+    Table table;
+    if (table_begin(&table, columns, 7, 0))
+    {
+        for (size_t i = 0; i < shown; i++)
+        {
+            uint32_t row = owners.order[i];
+            char area[32], outstanding[32], registered[16];
+            snprintf(area, sizeof(area), "%.2f", owners.areas[row]);
+            snprintf(outstanding, sizeof(outstanding), "%.2f", owners.outstanding[row]);
+            time_t reg_time = (time_t)owners.registered[row];
+            strftime(registered, sizeof(registered), "%Y-%m-%d", localtime(&reg_time));
+
+            const char *values[] = {
+                owners.names[row],
+                owners.phones[row] ? owners.phones[row] : "未登记",
+                owners.buildings[row] ? owners.buildings[row] : "未分配",
+                owners.rooms[row] ? owners.rooms[row] : "--",
+                owners.area_nulls[row] ? "--" : area,
+                outstanding,
+                registered};
+            table_add_row(&table, values);
+        }
+        table_end(&table);
+    }
+    printf("共 %zu 条记录，显示前 %zu 条，排序用时 %.1f ms\n", owners.count, shown,
+           stats.elapsed_seconds * 1000);
+
+    // 提供保存到文件选项
+    printf("\n是否要保存排序结果到文件? (y/n): ");
+    char save_choice;
+    scanf(" %c", &save_choice);
+    getchar();
+
+    if (save_choice == 'y' || save_choice == 'Y')
+    {
+        char filename[100];
+        printf("请输入文件名: ");
+        fgets(filename, sizeof(filename), stdin);
+        trim_newline(filename);
+        save_sorted_owners(&owners, filename);
+    }
+    owner_sort_free(&owners);
+}
+
 /**
  * @brief 显示信息排序界面
  *
- * 提供按缴费时间、缴费金额和业主姓名排序的功能
+ * 提供按业主姓名、服务人员负责楼宇数量排序，以及业主多字段组合排序的功能
  *
  * @param db 数据库连接指针
  * @param user_id 当前登录用户的ID
@@ -1520,6 +1621,7 @@ void show_info_sort_screen(Database *db, const char *user_id, UserType user_type
         printf("\n=== 信息排序 ===\n");
         printf("1. 按姓名排序查看业主信息\n");
         printf("2. 按负责楼宇数量排序查看服务人员\n");
+        printf("3. 多字段组合排序查看业主（欠费、面积、楼宇、房号、注册时间）\n");
         printf("0. 返回主菜单\n");
         printf("\n请选择: ");
 
@@ -1533,8 +1635,8 @@ void show_info_sort_screen(Database *db, const char *user_id, UserType user_type
         case 1: // 按姓名排序查看业主信息
         {
             snprintf(sql, sizeof(sql),
-                     "SELECT u.name, u.phone_number, u.email, "
-                     "b.building_name, r.room_number, r.floor "
+                     "SELECT u.name AS 姓名, u.phone_number AS 电话, u.email AS 邮箱, "
+                     "b.building_name AS 所在楼宇, r.room_number AS 房间号, r.floor AS 楼层 "
                      "FROM users u "
                      "LEFT JOIN rooms r ON u.user_id = r.owner_id "
                      "LEFT JOIN buildings b ON r.building_id = b.building_id "
@@ -1544,23 +1646,8 @@ void show_info_sort_screen(Database *db, const char *user_id, UserType user_type
             if (execute_query(db, sql, &result))
             {
                 printf("\n=== 业主信息(按姓名排序) ===\n");
-                printf("%-15s %-15s %-25s %-15s %-10s %-6s\n",
-                       "姓名", "电话", "邮箱", "所在楼宇", "房间号", "楼层");
-                printf("--------------------------------------------------------------------------------\n");
-
-                for (int i = 0; i < result.row_count; i++)
-                {
-                    printf("%-15s %-15s %-25s %-15s %-10s %-6s\n",
-                           result.rows[i].values[0],                                       // 姓名
-                           result.rows[i].values[1] ? result.rows[i].values[1] : "未登记", // 电话
-                           result.rows[i].values[2] ? result.rows[i].values[2] : "未登记", // 邮箱
-                           result.rows[i].values[3] ? result.rows[i].values[3] : "未分配", // 楼宇
-                           result.rows[i].values[4] ? result.rows[i].values[4] : "--",     // 房间号
-                           result.rows[i].values[5] ? result.rows[i].values[5] : "--");    // 楼层
-                }
-                printf("--------------------------------------------------------------------------------\n");
+                print_owner_rows(&result);
                 printf("共 %d 条记录\n", result.row_count);
-                free_query_result(&result);
 
                 // 提供保存到文件选项
                 printf("\n是否要保存排序结果到文件? (y/n): ");
@@ -1575,45 +1662,10 @@ void show_info_sort_screen(Database *db, const char *user_id, UserType user_type
                     fgets(filename, sizeof(filename), stdin);
                     trim_newline(filename);
 
-                    // 创建链表存储业主信息
-                    OwnerNode *head = NULL;
-                    OwnerNode *current = NULL;
-
-                    // 将查询结果转换为链表
-                    for (int i = 0; i < result.row_count; i++)
-                    {
-                        OwnerNode *node = create_owner_node_by_admin(
-                            result.rows[i].values[0], // 姓名
-                            result.rows[i].values[1], // 电话
-                            result.rows[i].values[2], // 邮箱
-                            result.rows[i].values[3], // 楼宇
-                            result.rows[i].values[4], // 房间号
-                            result.rows[i].values[5]  // 楼层
-                        );
-
-                        if (head == NULL)
-                        {
-                            head = node;
-                            current = node;
-                        }
-                        else
-                        {
-                            current->next = node;
-                            current = node;
-                        }
-                    }
-
-                    // 保存到文件
-                    save_owners_to_file(head, filename);
-
-                    // 释放链表
-                    while (head != NULL)
-                    {
-                        OwnerNode *temp = head;
-                        head = head->next;
-                        free(temp);
-                    }
+                    // 重新执行查询，逐行写入文件，格式由扩展名决定
+                    export_sql_to_file(db, sql, filename);
                 }
+                free_query_result(&result);
             }
             break;
         }
@@ -1621,9 +1673,9 @@ void show_info_sort_screen(Database *db, const char *user_id, UserType user_type
         case 2: // 按负责楼宇数量排序查看服务人员
         {
             snprintf(sql, sizeof(sql),
-                     "SELECT u.name, st.type_name, "
-                     "COUNT(DISTINCT sa.building_id) as building_count, "
-                     "GROUP_CONCAT(b.building_name) as buildings "
+                     "SELECT u.name AS 姓名, st.type_name AS 服务类型, "
+                     "COUNT(DISTINCT sa.building_id) AS 负责楼宇数, "
+                     "GROUP_CONCAT(b.building_name) AS 负责楼宇 "
                      "FROM users u "
                      "JOIN staff s ON u.user_id = s.user_id "
                      "JOIN staff_types st ON s.staff_type_id = st.staff_type_id "
@@ -1631,15 +1683,10 @@ void show_info_sort_screen(Database *db, const char *user_id, UserType user_type
                      "LEFT JOIN buildings b ON sa.building_id = b.building_id "
                      "WHERE u.role_id = 'role_staff' "
                      "GROUP BY u.user_id "
-                     "ORDER BY building_count DESC");
+                     "ORDER BY 负责楼宇数 DESC");
 
             if (execute_query(db, sql, &result))
             {
-                printf("\n=== 服务人员(按负责楼宇数量排序) ===\n");
-                printf("%-15s %-15s %-12s %-40s\n",
-                       "姓名", "服务类型", "负责楼宇数", "负责楼宇");
-                printf("--------------------------------------------------------------------------------\n");
-
                 // 提供保存到文件选项
                 printf("\n是否要保存排序结果到文件? (y/n): ");
                 char save_choice;
@@ -1653,60 +1700,40 @@ void show_info_sort_screen(Database *db, const char *user_id, UserType user_type
                     fgets(filename, sizeof(filename), stdin);
                     trim_newline(filename);
 
-                    // 创建链表存储结果
-                    StaffNode *head = NULL;
-                    StaffNode *current = NULL;
-
-                    // 将查询结果转换为链表
-                    for (int i = 0; i < result.row_count; i++)
-                    {
-                        StaffNode *node = create_staff_node(
-                            result.rows[i].values[0],                                  // 姓名
-                            result.rows[i].values[1],                                  // 服务类型
-                            atoi(result.rows[i].values[2]),                            // 楼宇数量
-                            result.rows[i].values[3] ? result.rows[i].values[3] : "无" // 楼宇列表
-                        );
-
-                        if (head == NULL)
-                        {
-                            head = node;
-                            current = node;
-                        }
-                        else
-                        {
-                            current->next = node;
-                            current = node;
-                        }
-                    }
-
-                    // 保存到文件
-                    save_staff_to_file(head, filename);
-
-                    // 释放链表
-                    while (head != NULL)
-                    {
-                        StaffNode *temp = head;
-                        head = head->next;
-                        free(temp);
-                    }
+                    // 重新执行查询，逐行写入文件，格式由扩展名决定
+                    export_sql_to_file(db, sql, filename);
                 }
 
                 // 显示结果
-                for (int i = 0; i < result.row_count; i++)
+                static const TableColumn columns[] = {
+                    {"姓名", TABLE_ALIGN_LEFT, 16},
+                    {"服务类型", TABLE_ALIGN_LEFT, 16},
+                    {"负责楼宇数", TABLE_ALIGN_RIGHT, 0},
+                    {"负责楼宇", TABLE_ALIGN_LEFT, 40},
+                };
+                Table table;
+
+                printf("\n=== 服务人员(按负责楼宇数量排序) ===\n");
+                if (table_begin(&table, columns, 4, 0))
                 {
-                    printf("%-15s %-15s %-12s %-40s\n",
-                           result.rows[i].values[0],                                    // 姓名
-                           result.rows[i].values[1],                                    // 服务类型
-                           result.rows[i].values[2],                                    // 楼宇数量
-                           result.rows[i].values[3] ? result.rows[i].values[3] : "无"); // 楼宇列表
+                    for (int i = 0; i < result.row_count; i++)
+                    {
+                        char **row = result.rows[i].values;
+                        const char *values[] = {row[0], row[1], row[2], row[3] ? row[3] : "无"};
+                        table_add_row(&table, values);
+                    }
+                    table_end(&table);
                 }
-                printf("--------------------------------------------------------------------------------\n");
                 printf("共 %d 条记录\n", result.row_count);
                 free_query_result(&result);
             }
             break;
         }
 
+        case 3: // 多字段组合排序查看业主
+            show_owner_multi_sort(db);
+            break;
+
         case 0:
             return;
 
@@ -1737,6 +1764,10 @@ void show_info_statistics_screen(Database *db, const char *user_id, UserType use
         printf("\n=== 信息统计界面 ===\n");
         printf("1. 楼宇统计\n");
         printf("2. 住户统计\n");
+        printf("3. 滞纳金统计\n");
+        printf("4. 费用统计\n");
+        printf("5. 费用多维分析\n");
+        printf("6. 月度收缴率走势\n");
         printf("0. 返回主菜单\n");
         printf("请输入选项: ");
 
@@ -1773,14 +1804,20 @@ void show_info_statistics_screen(Database *db, const char *user_id, UserType use
 
                 if (execute_query(db, sql, &result))
                 {
+                    static const TableColumn columns[] = {
+                        {"楼宇名称", TABLE_ALIGN_LEFT, 20},
+                        {"房间数", TABLE_ALIGN_RIGHT, 0},
+                    };
+                    Table table;
+
                     printf("\n各楼宇房间统计：\n");
-                    printf("------------------------\n");
-                    printf("%-20s %-10s\n", "楼宇名称", "房间数");
-                    for (int i = 0; i < result.row_count; i++)
+                    if (table_begin(&table, columns, 2, 0))
                     {
-                        printf("%-20s %-10s\n",
-                               result.rows[i].values[0],
-                               result.rows[i].values[1]);
+                        for (int i = 0; i < result.row_count; i++)
+                        {
+                            table_add_row(&table, (const char *const *)result.rows[i].values);
+                        }
+                        table_end(&table);
                     }
                     free_query_result(&result);
                 }
@@ -1817,23 +1854,69 @@ void show_info_statistics_screen(Database *db, const char *user_id, UserType use
 
                 if (execute_query(db, sql, &result))
                 {
+                    static const TableColumn columns[] = {
+                        {"楼宇名称", TABLE_ALIGN_LEFT, 20},
+                        {"总房间数", TABLE_ALIGN_RIGHT, 0},
+                        {"已入住", TABLE_ALIGN_RIGHT, 0},
+                        {"入住率(%)", TABLE_ALIGN_RIGHT, 0},
+                    };
+                    Table table;
+
                     printf("\n楼宇入住率统计：\n");
-                    printf("------------------------\n");
-                    printf("%-20s %-10s %-10s %-10s\n",
-                           "楼宇名称", "总房间数", "已入住", "入住率(%)");
-                    for (int i = 0; i < result.row_count; i++)
+                    if (table_begin(&table, columns, 4, 0))
                     {
-                        printf("%-20s %-10s %-10s %-10s\n",
-                               result.rows[i].values[0],
-                               result.rows[i].values[1],
-                               result.rows[i].values[2],
-                               result.rows[i].values[3]);
+                        for (int i = 0; i < result.row_count; i++)
+                        {
+                            table_add_row(&table, (const char *const *)result.rows[i].values);
+                        }
+                        table_end(&table);
                     }
                     free_query_result(&result);
                 }
             }
             break;
         }
+        case 3:
+            print_late_fee_building_summary(db);
+            break;
+        case 4:
+        {
+            // 各楼宇按费用类型汇总，以及近12个月的收缴走势
+            CubeResult cube;
+            if (query_fee_cube(db, CUBE_BY_BUILDING | CUBE_BY_FEE_TYPE, NULL, &cube))
+            {
+                printf("\n各楼宇费用统计：\n");
+                printf("------------------------\n");
+                print_fee_cube(&cube);
+                free_fee_cube_result(&cube);
+            }
+
+            time_t now = time(NULL);
+            struct tm tm_now;
+            localtime_r(&now, &tm_now);
+            int this_month = (tm_now.tm_year + 1900) * 100 + tm_now.tm_mon + 1;
+            CubeFilter recent = CUBE_FILTER_ALL;
+            recent.month_from = this_month - 100 + 1;
+            if (recent.month_from % 100 == 13)
+            {
+                recent.month_from += 100 - 12;
+            }
+            recent.month_to = this_month;
+            if (query_fee_cube(db, CUBE_BY_MONTH, &recent, &cube))
+            {
+                printf("\n近12个月收缴走势：\n");
+                printf("------------------------\n");
+                print_fee_cube(&cube);
+                free_fee_cube_result(&cube);
+            }
+            break;
+        }
+        case 5:
+            show_fee_cube_screen(db);
+            continue;
+        case 6:
+            show_collection_rate_screen(db);
+            continue;
         case 0:
             return;
 
@@ -1846,6 +1929,92 @@ void show_info_statistics_screen(Database *db, const char *user_id, UserType use
     }
 }
 
+/**
+ * @brief 后台维护任务管理
+ *
+ * 列出后台任务的计划和运行状态，可立即运行、启用/停用、修改计划和查看运行记录
+ *
+ * @param db 数据库连接指针
+ */
+static void manage_scheduled_jobs(Database *db)
+{
+    while (1) {
+        clear_screen();
+        printf("\n=== 后台维护任务 ===\n");
+        print_scheduled_jobs(db);
+        printf("\n1. 立即运行\n");
+        printf("2. 启用/停用\n");
+        printf("3. 修改计划\n");
+        printf("4. 运行记录\n");
+        printf("0. 返回\n");
+        printf("\n请输入选项: ");
+
+        int choice;
+        if (scanf("%d", &choice) != 1) {
+            choice = -1;
+        }
+        clear_input_buffer();
+        if (choice == 0) {
+            return;
+        }
+        if (choice < 1 || choice > 4) {
+            printf("无效选项，请重新输入\n");
+            printf("\n按Enter键继续...");
+            getchar();
+            continue;
+        }
+
+        char job_name[64];
+        printf(choice == 4 ? "请输入任务名（直接回车查看全部）: " : "请输入任务名: ");
+        fgets(job_name, sizeof(job_name), stdin);
+        trim_newline(job_name);
+        if (strlen(job_name) == 0 && choice != 4) {
+            continue;
+        }
+
+        switch (choice) {
+            case 1:
+                if (scheduler_run_now(db, job_name))
+                    printf("已安排立即运行，可在运行记录中查看结果\n");
+                else
+                    printf("任务不存在\n");
+                break;
+
+            case 2:
+            {
+                char answer[8];
+                printf("启用还是停用？(1启用/0停用): ");
+                fgets(answer, sizeof(answer), stdin);
+                if (scheduler_set_enabled(db, job_name, atoi(answer) == 1))
+                    printf("已更新\n");
+                else
+                    printf("任务不存在\n");
+                break;
+            }
+
+            case 3:
+            {
+                char schedule[128];
+                printf("请输入cron计划（分 时 日 月 周，如 30 2 * * *）: ");
+                fgets(schedule, sizeof(schedule), stdin);
+                trim_newline(schedule);
+                if (scheduler_set_schedule(db, job_name, schedule))
+                    printf("计划已更新\n");
+                else
+                    printf("计划无效或任务不存在\n");
+                break;
+            }
+
+            case 4:
+                print_job_runs(db, strlen(job_name) ? job_name : NULL, 30);
+                break;
+        }
+
+        printf("\n按Enter键继续...");
+        getchar();
+    }
+}
+
 /**
  * @brief 显示系统维护界面
  *
@@ -1869,6 +2038,8 @@ void show_system_maintenance_screen(Database *db, const char *user_id, UserType
         printf("\n=== 系统维护界面 ===\n");
         printf("1. 数据库备份\n");
         printf("2. 数据库恢复\n");
+        printf("3. 业主账本核对\n");
+        printf("4. 后台维护任务\n");
         printf("0. 返回主菜单\n");
         printf("\n请输入选项: ");
 
@@ -1966,6 +2137,9 @@ void show_system_maintenance_screen(Database *db, const char *user_id, UserType
             break;
         }
 
+        // 恢复期间暂停后台任务
+        billing_lock();
+
         // 初始化备份
         backup = sqlite3_backup_init(db->db, "main", backup_db, "main");
         
@@ -1982,6 +2156,7 @@ void show_system_maintenance_screen(Database *db, const char *user_id, UserType
         } else {
             printf("恢复初始化失败：%s\n", sqlite3_errmsg(db->db));
         }
+        billing_unlock();
         
         // 关闭备份数据库连接
         sqlite3_close(backup_db);
@@ -1989,6 +2164,36 @@ void show_system_maintenance_screen(Database *db, const char *user_id, UserType
     break;
 }
 
+            case 3: // 业主账本核对
+            {
+                printf("\n=== 业主账本核对 ===\n");
+                LedgerAudit audit;
+                if (!audit_owner_ledger(db, false, &audit)) {
+                    printf("核对失败\n");
+                    break;
+                }
+
+                printf("\n共核对 %d 行账本，不一致 %d 行\n", audit.rows_checked, audit.mismatch_count);
+                if (audit.mismatch_count == 0) {
+                    break;
+                }
+
+                printf("是否按交易记录重建账本？(y/n): ");
+                scanf(" %c", &confirm);
+                getchar();
+                if (confirm == 'y' || confirm == 'Y') {
+                    if (audit_owner_ledger(db, true, &audit) && audit.repaired) {
+                        printf("账本已重建\n");
+                    } else {
+                        printf("账本重建失败\n");
+                    }
+                }
+                break;
+            }
+
+            case 4: // 后台维护任务
+                manage_scheduled_jobs(db);
+                continue;
 
             case 0: // 返回主菜单
                 return;
@@ -2002,6 +2207,224 @@ void show_system_maintenance_screen(Database *db, const char *user_id, UserType
     }
 }
 
+/**
+ * @brief 设置滞纳金规则
+ *
+ * 修改当前生效的滞纳金日费率、宽限天数和封顶比例
+ *
+ * @param db 数据库连接指针
+ */
+static void manage_late_fee_rule(Database *db)
+{
+    LateFeeRule rule;
+    printf("\n===== 设置滞纳金规则 =====\n");
+
+    if (!get_late_fee_rule(db, time(NULL), &rule))
+    {
+        printf("未找到有效的滞纳金规则\n");
+        printf("按任意键返回...");
+        getchar();
+        return;
+    }
+
+    printf("当前规则: 日费率 %.4f%%, 宽限 %d 天, 封顶 %.0f%% (0表示不封顶)\n",
+           rule.daily_rate * 100, rule.grace_days, rule.cap_rate * 100);
+
+    double rate_percent, cap_percent;
+    printf("请输入新的日费率(%%，如0.05表示万分之五): ");
+    if (scanf("%lf", &rate_percent) != 1)
+    {
+        clear_input_buffer();
+        printf("输入无效\n");
+        printf("按任意键返回...");
+        getchar();
+        return;
+    }
+    printf("请输入宽限天数: ");
+    scanf("%d", &rule.grace_days);
+    printf("请输入封顶比例(%%，如100表示不超过欠费本金，0表示不封顶): ");
+    scanf("%lf", &cap_percent);
+    clear_input_buffer();
+
+    rule.daily_rate = rate_percent / 100;
+    rule.cap_rate = cap_percent / 100;
+
+    if (update_late_fee_rule(db, &rule))
+    {
+        printf("滞纳金规则更新成功\n");
+    }
+    else
+    {
+        printf("滞纳金规则更新失败\n");
+    }
+
+    printf("按任意键返回...");
+    getchar();
+}
+
+/**
+ * @brief 计提滞纳金
+ *
+ * 按指定日期对所有超过宽限期的欠费账单批量计提滞纳金
+ *
+ * @param db 数据库连接指针
+ */
+static void run_late_fee_accrual(Database *db)
+{
+    char date_str[20];
+    time_t accrual_date = time(NULL);
+
+    printf("\n===== 计提滞纳金 =====\n");
+    printf("请输入计提日期(YYYY-MM-DD，直接回车表示今天): ");
+    fgets(date_str, sizeof(date_str), stdin);
+    trim_newline(date_str);
+
+    if (date_str[0] != '\0')
+    {
+        struct tm tm_date = {0};
+        char extra;
+        if (sscanf(date_str, "%d-%d-%d%c", &tm_date.tm_year, &tm_date.tm_mon, &tm_date.tm_mday, &extra) != 3 ||
+            tm_date.tm_mon < 1 || tm_date.tm_mon > 12 || tm_date.tm_mday < 1 || tm_date.tm_mday > 31)
+        {
+            printf("日期格式无效\n");
+            printf("按任意键返回...");
+            getchar();
+            return;
+        }
+        tm_date.tm_year -= 1900;
+        tm_date.tm_mon -= 1;
+        tm_date.tm_isdst = -1;
+        accrual_date = mktime(&tm_date);
+    }
+
+    // 可先预览计提结果，确认无误后再执行
+    for (;;)
+    {
+        printf("\n1. 预览计提结果（不写入）\n");
+        printf("2. 执行计提\n");
+        printf("0. 取消\n");
+        printf("请选择: ");
+        int choice;
+        if (scanf("%d", &choice) != 1)
+        {
+            choice = -1;
+        }
+        clear_input_buffer();
+
+        if (choice == 0)
+        {
+            printf("操作已取消\n");
+            printf("按任意键返回...");
+            getchar();
+            return;
+        }
+        if (choice == 2)
+        {
+            break;
+        }
+        if (choice == 1)
+        {
+            BillingPreview preview;
+            if (preview_late_fees(db, accrual_date, BILLING_PREVIEW_TOP_N, &preview))
+            {
+                print_billing_preview(&preview);
+                free_billing_preview(&preview);
+            }
+            else
+            {
+                printf("计提预览失败\n");
+            }
+        }
+    }
+
+    LateFeeAccrual accrual;
+    if (accrue_late_fees(db, accrual_date, &accrual))
+    {
+        char day[20];
+        struct tm tm_info;
+        localtime_r(&accrual.accrual_date, &tm_info);
+        strftime(day, sizeof(day), "%Y-%m-%d", &tm_info);
+
+        if (accrual.already_accrued)
+        {
+            printf("%s 已计提过滞纳金（%d 条，共 %.2f 元），本次未重复计提\n",
+                   day, accrual.bill_count, accrual.total_amount);
+        }
+        else
+        {
+            printf("%s 滞纳金计提完成：更新 %d 条滞纳金账单，金额合计 %.2f 元\n",
+                   day, accrual.bill_count, accrual.total_amount);
+        }
+        print_late_fee_building_summary(db);
+    }
+    else
+    {
+        printf("滞纳金计提失败\n");
+    }
+
+    printf("\n按任意键返回...");
+    getchar();
+}
+
+/**
+ * @brief 批量生成业主月度对账单
+ *
+ * 按指定年月为全部业主生成对账单，按楼宇分目录输出
+ *
+ * @param db 数据库连接指针
+ */
+static void run_statement_generation(Database *db)
+{
+    int year, month, format;
+    char out_dir[256];
+
+    printf("\n===== 批量生成业主月度对账单 =====\n");
+    printf("请输入年份: ");
+    if (scanf("%d", &year) != 1)
+    {
+        year = 0;
+    }
+    printf("请输入月份(1-12): ");
+    if (scanf("%d", &month) != 1)
+    {
+        month = 0;
+    }
+    printf("文件格式(1 文本 / 2 HTML / 3 CSV): ");
+    if (scanf("%d", &format) != 1 || format < STATEMENT_TEXT || format > STATEMENT_CSV)
+    {
+        format = STATEMENT_TEXT;
+    }
+    clear_input_buffer();
+    printf("输出目录(直接回车为 statements): ");
+    fgets(out_dir, sizeof(out_dir), stdin);
+    trim_newline(out_dir);
+    if (out_dir[0] == '\0')
+    {
+        strcpy(out_dir, "statements");
+    }
+
+    if (year < 1970 || month < 1 || month > 12)
+    {
+        printf("年月输入无效\n");
+        printf("按任意键返回...");
+        getchar();
+        return;
+    }
+
+    StatementSummary summary;
+    bool ok = generate_monthly_statements(db, year, month, (StatementFormat)format, out_dir, &summary);
+    printf("\n业主 %d 位，写出对账单 %d 份，楼宇目录 %d 个\n",
+           summary.owner_count, summary.file_count, summary.building_count);
+    if (summary.failed_count > 0)
+    {
+        printf("写出失败 %d 份\n", summary.failed_count);
+    }
+    printf("工作线程 %d 个，耗时 %.2f 秒\n", summary.thread_count, summary.elapsed_seconds);
+    printf(ok ? "对账单已生成到 %s\n" : "对账单生成未全部完成，输出目录: %s\n", out_dir);
+    printf("按任意键返回...");
+    getchar();
+}
+
 /**
  * @brief 显示费用标准管理界面
  *
@@ -2027,6 +2450,9 @@ void manage_fee_standards_screen(Database *db, const char *user_id, UserType use
         printf("1. 查看现有费用标准\n");
         printf("2. 修改费用标准\n");
         printf("3. 生成物业费账单\n");
+        printf("4. 设置滞纳金规则\n");
+        printf("5. 计提滞纳金\n");
+        printf("6. 批量生成业主月度对账单\n");
         printf("0. 返回上一级\n");
         printf("请输入您的选择: ");
         scanf("%d", &choice);
@@ -2063,12 +2489,24 @@ void manage_fee_standards_screen(Database *db, const char *user_id, UserType use
                 break;
             }
 
-            printf("%-12s %-15s %-12s %-10s %-15s %-15s\n",
-                   "标准ID", "费用类型", "单价", "单位", "生效日期", "终止日期");
+            static const TableColumn columns[] = {
+                {"标准ID", TABLE_ALIGN_LEFT, 0},
+                {"费用类型", TABLE_ALIGN_LEFT, 0},
+                {"单价", TABLE_ALIGN_RIGHT, 0},
+                {"单位", TABLE_ALIGN_LEFT, 0},
+                {"生效日期", TABLE_ALIGN_LEFT, 0},
+                {"终止日期", TABLE_ALIGN_LEFT, 0},
+            };
+            Table table;
+            if (!table_begin(&table, columns, 6, 0))
+            {
+                free_query_result(&result);
+                break;
+            }
 
             char fee_type_str[20];
             struct tm tm_info;
-            char start_date_str[20], end_date_str[20];
+            char start_date_str[20], end_date_str[20], price_str[32];
 
             for (int i = 0; i < result.row_count; i++)
             {
@@ -2090,6 +2528,9 @@ void manage_fee_standards_screen(Database *db, const char *user_id, UserType use
                 case TRANS_GAS_FEE:
                     strcpy(fee_type_str, "燃气费");
                     break;
+                case TRANS_LATE_FEE:
+                    strcpy(fee_type_str, "滞纳金");
+                    break;
                 default:
                     strcpy(fee_type_str, "其他费用");
                     break;
@@ -2110,14 +2551,20 @@ void manage_fee_standards_screen(Database *db, const char *user_id, UserType use
                     strftime(end_date_str, sizeof(end_date_str), "%Y-%m-%d", &tm_info);
                 }
 
-                printf("%-12s %-15s %-12.2f %-10s %-15s %-15s\n",
-                       result.rows[i].values[0],
-                       fee_type_str,
-                       atof(result.rows[i].values[2]),
-                       result.rows[i].values[3],
-                       start_date_str,
-                       end_date_str);
+                snprintf(price_str, sizeof(price_str), "%.*f",
+                         fee_type == TRANS_LATE_FEE ? 4 : 2, // 滞纳金日费率精度较高
+                         atof(result.rows[i].values[2]));
+
+                const char *values[] = {
+                    result.rows[i].values[0],
+                    fee_type_str,
+                    price_str,
+                    result.rows[i].values[3],
+                    start_date_str,
+                    end_date_str};
+                table_add_row(&table, values);
             }
+            table_end(&table);
 
             free_query_result(&result);
             printf("\n按任意键返回...");
@@ -2235,6 +2682,15 @@ void manage_fee_standards_screen(Database *db, const char *user_id, UserType use
         case 3:
             generate_property_fees(db, user_id, user_type);
             break;
+        case 4:
+            manage_late_fee_rule(db);
+            break;
+        case 5:
+            run_late_fee_accrual(db);
+            break;
+        case 6:
+            run_statement_generation(db);
+            break;
         case 0:
             return;
         default:
@@ -2295,19 +2751,28 @@ void show_room_assignment_screen(Database *db, const char *admin_id)
         "WHERE u.role_id = 'role_owner' AND r.room_id IS NULL "
         "ORDER BY u.user_id";
 
-    printf("\n待分配房屋的业主:\n");
-    printf("%-8s %-12s %-15s\n", "用户ID", "姓名", "电话");
-    printf("--------------------------------\n");
+    static const TableColumn owner_columns[] = {
+        {"用户ID", TABLE_ALIGN_LEFT, 0},
+        {"姓名", TABLE_ALIGN_LEFT, 16},
+        {"电话", TABLE_ALIGN_LEFT, 15},
+    };
+    Table table;
 
+    printf("\n待分配房屋的业主:\n");
     sqlite3_stmt *stmt;
     if (sqlite3_prepare_v2(db->db, unassigned_query, -1, &stmt, NULL) == SQLITE_OK)
     {
-        while (sqlite3_step(stmt) == SQLITE_ROW)
+        if (table_begin(&table, owner_columns, 3, 0))
         {
-            printf("%-8d %-12s %-15s\n",
-                   sqlite3_column_int(stmt, 0),
-                   sqlite3_column_text(stmt, 1),
-                   sqlite3_column_text(stmt, 2));
+            while (sqlite3_step(stmt) == SQLITE_ROW)
+            {
+                const char *values[] = {
+                    (const char *)sqlite3_column_text(stmt, 0),
+                    (const char *)sqlite3_column_text(stmt, 1),
+                    (const char *)sqlite3_column_text(stmt, 2)};
+                table_add_row(&table, values);
+            }
+            table_end(&table);
         }
         sqlite3_finalize(stmt);
     }
@@ -2325,39 +2790,56 @@ void show_room_assignment_screen(Database *db, const char *admin_id)
         "WHERE r.owner_id IS NULL AND r.status = 0 "
         "ORDER BY b.building_name, r.floor, r.room_number";
 
-    printf("\n可用房屋:\n");
-    printf("%-8s %-8s %-8s %-6s %-8s\n",
-           "房屋ID", "楼号", "房号", "楼层", "面积");
-    printf("----------------------------------------\n");
+    static const TableColumn room_columns[] = {
+        {"房屋ID", TABLE_ALIGN_LEFT, 0},
+        {"楼号", TABLE_ALIGN_LEFT, 16},
+        {"房号", TABLE_ALIGN_LEFT, 0},
+        {"楼层", TABLE_ALIGN_RIGHT, 0},
+        {"面积", TABLE_ALIGN_RIGHT, 0},
+    };
 
+    printf("\n可用房屋:\n");
     if (sqlite3_prepare_v2(db->db, available_query, -1, &stmt, NULL) == SQLITE_OK)
     {
-        while (sqlite3_step(stmt) == SQLITE_ROW)
+        if (table_begin(&table, room_columns, 5, 0))
         {
-            printf("%-8s %-8s %-8s %-6d %-8.2f\n",
-                   sqlite3_column_text(stmt, 0),
-                   sqlite3_column_text(stmt, 1),
-                   sqlite3_column_text(stmt, 2),
-                   sqlite3_column_int(stmt, 3),
-                   sqlite3_column_double(stmt, 4));
+            while (sqlite3_step(stmt) == SQLITE_ROW)
+            {
+                char floor[16], area[32];
+                snprintf(floor, sizeof(floor), "%d", sqlite3_column_int(stmt, 3));
+                snprintf(area, sizeof(area), "%.2f", sqlite3_column_double(stmt, 4));
+                const char *values[] = {
+                    (const char *)sqlite3_column_text(stmt, 0),
+                    (const char *)sqlite3_column_text(stmt, 1),
+                    (const char *)sqlite3_column_text(stmt, 2),
+                    floor,
+                    area};
+                table_add_row(&table, values);
+            }
+            table_end(&table);
         }
         sqlite3_finalize(stmt);
     }
 
-    int user_id;
-    char room_id[10];
+    char owner_id[40];
+    char room_id[40];
+    char date_text[32];
     printf("\n请输入要分配的业主ID: ");
-    scanf("%d", &user_id);
+    scanf("%39s", owner_id);
     printf("请输入要分配的房屋ID: ");
-    scanf("%s", room_id);
-
-    char update_query[256];
-    snprintf(update_query, sizeof(update_query),
-             "UPDATE rooms SET owner_id = %d, status = 1 "
-             "WHERE room_id = '%s' AND owner_id IS NULL",
-             user_id, room_id);
+    scanf("%39s", room_id);
+    clear_input_buffer();
+    printf("请输入入住日期 (YYYY-MM-DD，直接回车为今天): ");
+    fgets(date_text, sizeof(date_text), stdin);
+    trim_newline(date_text);
 
-    if (execute_update(db, update_query))
+    // 入住日期决定账期内按天折算的起点
+    time_t effective_date = date_text[0] ? parse_time(date_text) : time(NULL);
+    if (effective_date == (time_t)-1)
+    {
+        printf("\n✗ 日期格式错误\n");
+    }
+    else if (transfer_room_owner(db, room_id, owner_id, effective_date))
     {
         printf("\n✓ 房屋分配成功!\n");
     }
@@ -2368,5 +2850,4 @@ void show_room_assignment_screen(Database *db, const char *admin_id)
 
     printf("\n按Enter键继续...");
     getchar();
-    getchar();
 }
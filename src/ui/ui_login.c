@@ -12,6 +12,7 @@
 #include "ui/ui_login.h"
 #include "utils/utils.h"
 #include "models/user.h"
+#include "utils/pinyin.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -339,8 +340,8 @@ bool show_registration_screen(Database *db)
 
     // 插入新用户记录
     sprintf(query,
-            "INSERT INTO users (user_id, username, password_hash, name, phone_number, email, role_id, registration_date) "
-            "VALUES (?, ?, ?, ?, ?, ?, ?, ?);");
+            "INSERT INTO users (user_id, username, password_hash, name, phone_number, email, role_id, registration_date, "
+            "name_sort_key) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?);");
 
     if (db_prepare(db, query, &stmt) != SQLITE_OK)
     {
@@ -360,6 +361,7 @@ bool show_registration_screen(Database *db)
     sqlite3_bind_text(stmt, 6, email, -1, SQLITE_STATIC);
     sqlite3_bind_text(stmt, 7, role_id, -1, SQLITE_STATIC); // 动态绑定角色
     sqlite3_bind_int64(stmt, 8, current_time);
+    pinyin_bind_sort_key(stmt, 9, name);
 
     if (sqlite3_step(stmt) == SQLITE_DONE)
     {
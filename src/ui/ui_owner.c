@@ -19,10 +19,14 @@
 #include "models/apartment.h"
 #include "models/user.h"
 #include "models/transaction.h"
+#include "models/ledger.h"
 #include "models/service.h"
 #include "db/db_query.h"
 #include "utils/utils.h"
 #include "utils/console.h"
+#include "utils/export.h"
+#include "utils/pager.h"
+#include "utils/table.h"
 #include "auth/auth.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -30,23 +34,17 @@
 #include <time.h>
 #include <sys/time.h>
 
-/**
- * @struct PaymentRecord
- * @brief 定义缴费记录链表结构
- */
-typedef struct PaymentRecord
+// 已完成缴费记录的筛选条件，?为业主ID
+#define PAID_HISTORY_FROM \
+    "FROM transactions t " \
+    "WHERE t.user_id = ? AND t.payment_date > 0 AND t.status = 1 AND t.amount > 0"
+
+static void bind_user_id(sqlite3_stmt *stmt, void *params)
 {
-    char transaction_id[37];    /**< 交易ID */
-    char fee_type[20];          /**< 费用类型 */
-    double amount;              /**< 金额 */
-    time_t payment_date;        /**< 缴费日期 */
-    struct PaymentRecord *next; /**< 指向下一条记录的指针 */
-} PaymentRecord;
-
-// 函数原型声明
-PaymentRecord *create_payment_record_list(Database *db, const char *user_id);
-void export_payment_records_to_file(PaymentRecord *head);
-void free_payment_record_list(PaymentRecord *head);
+    sqlite3_bind_text(stmt, 1, (const char *)params, -1, SQLITE_TRANSIENT);
+}
+
+static void export_payment_history(Database *db, const char *user_id, double total_paid);
 
 /**
  * @brief 显示用户的缴费记录
@@ -58,81 +56,61 @@ void free_payment_record_list(PaymentRecord *head);
  */
 void show_payment_history(Database *db, const char *user_id)
 {
-    clear_screen();
-    printf("\n====== 缴费记录 ======\n");
-
-    const char *query =
-        "SELECT t.transaction_id, "
-        "CASE t.fee_type "
-        "WHEN 1 THEN '物业费' "
-        "WHEN 2 THEN '停车费' "
-        "WHEN 3 THEN '水费' "
-        "WHEN 4 THEN '电费' "
-        "WHEN 5 THEN '燃气费' "
-        "ELSE '其他' END as fee_type, "
-        "t.amount, "
-        "t.payment_date "
-        "FROM transactions t "
-        "WHERE t.user_id = ? "
-        "AND t.payment_date IS NOT NULL "
-        "AND t.payment_date > 0 "
-        "AND t.status = 1 "
-        "AND t.amount > 0 " // 确保金额为正数
-        "ORDER BY t.payment_date DESC";
+    static const TableColumn columns[] = {
+        {"交易编号", TABLE_ALIGN_LEFT, 0},
+        {"费用类型", TABLE_ALIGN_LEFT, 0},
+        {"缴费金额", TABLE_ALIGN_RIGHT, 0},
+        {"缴费日期", TABLE_ALIGN_LEFT, 0},
+    };
+    const PagerQuery query = {
+        .title = "缴费记录",
+        .sql = "SELECT substr(t.transaction_id, 1, 8) AS short_id, "
+               "CASE t.fee_type "
+               "WHEN 1 THEN '物业费' "
+               "WHEN 2 THEN '停车费' "
+               "WHEN 3 THEN '水费' "
+               "WHEN 4 THEN '电费' "
+               "WHEN 5 THEN '燃气费' "
+               "WHEN 6 THEN '滞纳金' "
+               "ELSE '其他' END AS fee_name, "
+               "printf('￥%.2f', t.amount) AS amount_text, "
+               "strftime('%Y-%m-%d', t.payment_date, 'unixepoch', 'localtime') AS date_text, "
+               "t.payment_date AS sort_date, t.transaction_id AS sort_id " PAID_HISTORY_FROM,
+        .columns = columns,
+        .column_count = 4,
+        .key_count = 2,
+        .descending = true,
+        .bind_params = bind_user_id,
+        .params = (void *)user_id,
+    };
 
+    // 先汇总笔数和金额，记录本身按页读取
+    int found = 0;
+    double total_paid = 0.0;
     sqlite3_stmt *stmt;
-    if (sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL) != SQLITE_OK)
+    if (sqlite3_prepare_v2(db->db, "SELECT COUNT(*), COALESCE(SUM(t.amount), 0) " PAID_HISTORY_FROM,
+                           -1, &stmt, NULL) != SQLITE_OK)
     {
         printf("SQL错误: %s\n", sqlite3_errmsg(db->db));
         return;
     }
-
-    sqlite3_bind_text(stmt, 1, user_id, -1, SQLITE_STATIC);
-
-    printf("\n%-20s %-10s %-15s %-15s\n",
-           "交易编号", "费用类型", "缴费金额", "缴费日期");
-    printf("----------------------------------------------------------------------\n");
-
-    int found = 0;
-    double total_paid = 0.0;
-
-    while (sqlite3_step(stmt) == SQLITE_ROW)
+    bind_user_id(stmt, (void *)user_id);
+    if (sqlite3_step(stmt) == SQLITE_ROW)
     {
-        const unsigned char *transaction_id = sqlite3_column_text(stmt, 0);
-        const unsigned char *fee_type = sqlite3_column_text(stmt, 1);
-        double amount = sqlite3_column_double(stmt, 2);
-        time_t pay_date = sqlite3_column_int64(stmt, 3);
-
-        // 验证日期的有效性
-        if (pay_date > 0)
-        {
-            found = 1;
-            char date_buf[20];
-            strftime(date_buf, sizeof(date_buf), "%Y-%m-%d", localtime(&pay_date));
-
-            // 缩短交易ID的显示长度
-            char short_id[9] = {0};
-            strncpy(short_id, (const char *)transaction_id, 8);
-
-            printf("%-20s %-10s ￥%-14.2f %s\n",
-                   short_id,
-                   fee_type,
-                   amount,
-                   date_buf);
-
-            total_paid += amount;
-        }
+        found = sqlite3_column_int(stmt, 0) > 0;
+        total_paid = sqlite3_column_double(stmt, 1);
     }
-
     sqlite3_finalize(stmt);
 
     if (!found)
     {
+        clear_screen();
+        printf("\n====== 缴费记录 ======\n");
         printf("\n⚠️ 当前用户暂无缴费记录。\n");
     }
     else
     {
-        printf("----------------------------------------------------------------------\n");
+        pager_browse(db, &query);
         printf("累计已缴金额: ￥%.2f\n", total_paid);
     }
 
@@ -146,17 +124,7 @@ void show_payment_history(Database *db, const char *user_id)
 
     if (choice == 1 && found)
     {
-        // 将缴费记录转换为链表并导出到文件
-        PaymentRecord *records = create_payment_record_list(db, user_id);
-        if (records)
-        {
-            export_payment_records_to_file(records);
-            free_payment_record_list(records);
-        }
-        else
-        {
-            printf("⚠️ 导出失败：无法创建缴费记录列表。\n");
-        }
+        export_payment_history(db, user_id, total_paid);
     }
 
     printf("\n按Enter键返回...");
@@ -164,204 +132,233 @@ void show_payment_history(Database *db, const char *user_id)
 }
 
 /**
- * @brief 创建缴费记录链表
+ * @brief 导出缴费记录到文件
  *
- * 从数据库中查询用户的缴费记录并构建链表结构
+ * 按缴费日期倒序把已完成的缴费记录逐行写入带时间戳的CSV文件
  *
  * @param db 数据库连接
  * @param user_id 用户ID
- * @return PaymentRecord* 缴费记录链表头指针，失败返回NULL
+ * @param total_paid 累计已缴金额
  */
-PaymentRecord *create_payment_record_list(Database *db, const char *user_id)
+static void export_payment_history(Database *db, const char *user_id, double total_paid)
 {
+    // 生成带时间戳的文件名
+    char filename[100];
+    time_t now = time(NULL);
+    strftime(filename, sizeof(filename), "payment_history_%Y%m%d_%H%M%S.csv", localtime(&now));
+
     const char *query =
-        "SELECT t.transaction_id, "
+        "SELECT t.transaction_id AS 交易编号, "
         "CASE t.fee_type "
         "WHEN 1 THEN '物业费' "
         "WHEN 2 THEN '停车费' "
         "WHEN 3 THEN '水费' "
         "WHEN 4 THEN '电费' "
         "WHEN 5 THEN '燃气费' "
-        "ELSE '其他' END as fee_type, "
-        "t.amount, "
-        "t.payment_date "
-        "FROM transactions t "
-        "WHERE t.user_id = ? "
-        "AND t.payment_date IS NOT NULL "
-        "AND t.payment_date > 0 "
-        "AND t.status = 1 "
-        "AND t.amount > 0 "
-        "ORDER BY t.payment_date DESC";
-
-    sqlite3_stmt *stmt;
-    if (sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL) != SQLITE_OK)
+        "WHEN 6 THEN '滞纳金' "
+        "ELSE '其他' END AS 费用类型, "
+        "printf('%.2f', t.amount) AS 缴费金额, "
+        "strftime('%Y-%m-%d', t.payment_date, 'unixepoch', 'localtime') AS 缴费日期 " PAID_HISTORY_FROM " "
+        "ORDER BY t.payment_date DESC, t.transaction_id DESC";
+
+    long rows;
+    if (!export_query(db, query, bind_user_id, (void *)user_id, filename, NULL, &rows))
     {
-        fprintf(stderr, "SQL错误: %s\n", sqlite3_errmsg(db->db));
-        return NULL;
+        printf("⚠️ 导出失败：无法写入缴费记录。\n");
+        return;
     }
+    printf("✅ %ld 条缴费记录已导出到文件：%s（累计已缴金额: ￥%.2f）\n", rows, filename, total_paid);
+}
 
-    sqlite3_bind_text(stmt, 1, user_id, -1, SQLITE_STATIC);
-
-    // 链表的头指针和尾指针
-    PaymentRecord *head = NULL;
-    PaymentRecord *tail = NULL;
-
-    while (sqlite3_step(stmt) == SQLITE_ROW)
+/**
+ * @brief 查询用户总费用
+ *
+ * @param db 数据库连接
+ * @param user_id 用户ID
+ * @return double 总费用金额（取自业主账本），出错返回-1.0
+ */
+double query_total_fee(Database *db, const char *user_id)
+{
+    OwnerLedger ledger;
+    if (!get_owner_ledger(db, user_id, LEDGER_ALL_FEES, &ledger))
     {
-        // 创建新节点
-        PaymentRecord *record = (PaymentRecord *)malloc(sizeof(PaymentRecord));
-        if (!record)
-        {
-            fprintf(stderr, "内存分配失败\n");
-            // 释放已分配的节点
-            free_payment_record_list(head);
-            sqlite3_finalize(stmt);
-            return NULL;
-        }
-
-        // 复制数据
-        strncpy(record->transaction_id, (const char *)sqlite3_column_text(stmt, 0), 36);
-        record->transaction_id[36] = '\0';
-
-        strncpy(record->fee_type, (const char *)sqlite3_column_text(stmt, 1), 19);
-        record->fee_type[19] = '\0';
-
-        record->amount = sqlite3_column_double(stmt, 2);
-        record->payment_date = sqlite3_column_int64(stmt, 3);
-        record->next = NULL;
-
-        // 添加到链表
-        if (!head)
-        {
-            head = record;
-            tail = record;
-        }
-        else
-        {
-            tail->next = record;
-            tail = record;
-        }
+        return -1.0;
     }
-
-    sqlite3_finalize(stmt);
-    return head;
+    return ledger.billed_amount;
 }
 
 /**
- * @brief 导出缴费记录到文件
+ * @brief 列出欠费账单并批量缴费
  *
- * 将缴费记录链表中的数据导出到带时间戳的文本文件
+ * 列出业主指定类型（fee_type为0表示全部类型）的未缴和逾期账单，可一次缴清全部
+ * 或按序号选择部分账单，整批在一个事务内完成并打印逐笔回执。业主和物业人员代缴共用。
  *
- * @param head 缴费记录链表头指针
+ * @param db 数据库连接
+ * @param owner_id 业主用户ID
+ * @param fee_type 费用类型，0表示全部
  */
-void export_payment_records_to_file(PaymentRecord *head)
+void pay_outstanding_bills(Database *db, const char *owner_id, int fee_type)
 {
-    // 生成带时间戳的文件名
-    char filename[100];
-    time_t now = time(NULL);
-    struct tm *t = localtime(&now);
-    strftime(filename, sizeof(filename), "payment_history_%Y%m%d_%H%M%S.txt", t);
+    const char *query_unpaid =
+        "SELECT transaction_id, fee_type, amount, due_date, status "
+        "FROM transactions "
+        "WHERE user_id = ? AND status IN (0, 2) AND (?2 = 0 OR fee_type = ?2) "
+        "ORDER BY due_date ASC";
+    static const char *fee_type_names[] = {"其他费用", "物业费", "停车费", "水费", "电费", "燃气费", "滞纳金"};
 
-    FILE *file = fopen(filename, "w");
-    if (!file)
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(db->db, query_unpaid, -1, &stmt, NULL) != SQLITE_OK)
     {
-        fprintf(stderr, "无法创建文件：%s\n", filename);
+        printf("❌ 查询未缴费用记录失败: %s\n", sqlite3_errmsg(db->db));
         return;
     }
+    sqlite3_bind_text(stmt, 1, owner_id, -1, SQLITE_STATIC);
+    sqlite3_bind_int(stmt, 2, fee_type);
 
-    // 写入表头
-    fprintf(file, "%-20s %-10s %-15s %-15s\n", "交易编号", "费用类型", "缴费金额", "缴费日期");
-    fprintf(file, "----------------------------------------------------------------------\n");
+    typedef char TransactionId[40];
+    TransactionId *ids = NULL;
+    int record_count = 0, capacity = 0;
+    double total_unpaid = 0.0;
 
-    // 写入数据
-    PaymentRecord *current = head;
-    double total_paid = 0.0;
+    printf("\n%-5s %-38s %-10s %-12s %-12s %s\n", "序号", "交易编号", "费用类型", "金额", "到期日期", "状态");
+    printf("----------------------------------------------------------------------------------\n");
 
-    while (current)
+    while (sqlite3_step(stmt) == SQLITE_ROW)
     {
-        char date_buf[20];
-        strftime(date_buf, sizeof(date_buf), "%Y-%m-%d", localtime(&current->payment_date));
+        if (record_count == capacity)
+        {
+            capacity = capacity ? capacity * 2 : 32;
+            TransactionId *grown = realloc(ids, capacity * sizeof(TransactionId));
+            if (!grown)
+            {
+                break;
+            }
+            ids = grown;
+        }
 
-        fprintf(file, "%-20s %-10s ￥%-14.2f %s\n",
-                current->transaction_id,
-                current->fee_type,
-                current->amount,
-                date_buf);
+        strncpy(ids[record_count], (const char *)sqlite3_column_text(stmt, 0), sizeof(TransactionId) - 1);
+        ids[record_count][sizeof(TransactionId) - 1] = '\0';
 
-        total_paid += current->amount;
-        current = current->next;
+        int type = sqlite3_column_int(stmt, 1);
+        double amount = sqlite3_column_double(stmt, 2);
+        time_t due_date = (time_t)sqlite3_column_int64(stmt, 3);
+        char date_str[20];
+        strftime(date_str, sizeof(date_str), "%Y-%m-%d", localtime(&due_date));
+
+        printf("%-5d %-38s %-10s ￥%-11.2f %-12s %s\n",
+               record_count + 1,
+               ids[record_count],
+               fee_type_names[(type >= 1 && type <= 6) ? type : 0],
+               amount,
+               date_str,
+               sqlite3_column_int(stmt, 4) == 2 ? "已逾期" : "未支付");
+
+        total_unpaid += amount;
+        record_count++;
     }
+    sqlite3_finalize(stmt);
 
-    // 写入合计
-    fprintf(file, "----------------------------------------------------------------------\n");
-    fprintf(file, "累计已缴金额: ￥%.2f\n", total_paid);
-    fprintf(file, "导出时间: ");
+    if (record_count == 0)
+    {
+        printf("⚠️ 当前暂无未缴费用记录。\n");
+        free(ids);
+        return;
+    }
 
-    // 写入当前时间
-    char time_buf[30];
-    strftime(time_buf, sizeof(time_buf), "%Y-%m-%d %H:%M:%S", localtime(&now));
-    fprintf(file, "%s\n", time_buf);
+    printf("----------------------------------------------------------------------------------\n");
+    printf("总计: %d笔待缴费用，共计￥%.2f\n", record_count, total_unpaid);
 
-    fclose(file);
-    printf("✅ 缴费记录已导出到文件：%s\n", filename);
-}
+    // 每个确认界面只生成一个幂等键，重试时沿用，重复提交不会重复扣款
+    char idempotency_key[40];
+    generate_uuid(idempotency_key);
 
-/**
- * @brief 释放缴费记录链表内存
- *
- * @param head 缴费记录链表头指针
- */
-void free_payment_record_list(PaymentRecord *head)
-{
-    PaymentRecord *current = head;
-    while (current)
+    printf("\n1. 全部缴清\n2. 选择部分账单\n0. 取消\n请选择: ");
+    int choice;
+    if (scanf("%d", &choice) != 1)
     {
-        PaymentRecord *next = current->next;
-        free(current);
-        current = next;
+        choice = 0;
     }
-}
+    clear_input_buffer();
 
-/**
- * @brief 查询用户总费用
- *
- * @param db 数据库连接
- * @param user_id 用户ID
- * @return double 总费用金额，出错返回-1.0
- */
-double query_total_fee(Database *db, const char *user_id)
-{
-    // 1. 定义所有变量
-    const char *query = "SELECT SUM(amount) FROM transactions WHERE user_id=?;";
-    sqlite3_stmt *stmt;
-    double total_fee = -1.0;
+    const char **selected = malloc(record_count * sizeof(char *));
+    int selected_count = 0;
+    // 未限定费用类型时全部缴清由一条语句结清该业主的全部欠费
+    bool settle_all = choice == 1 && fee_type == 0;
 
-    // 2. 准备语句
-    if (sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL) != SQLITE_OK)
+    if (choice == 1)
     {
-        fprintf(stderr, "准备查询失败: %s\n", sqlite3_errmsg(db->db));
-        return -1.0;
+        for (int i = 0; i < record_count; i++)
+        {
+            selected[selected_count++] = ids[i];
+        }
+    }
+    else if (choice == 2)
+    {
+        char line[1024];
+        bool *picked = calloc(record_count, sizeof(bool));
+        printf("请输入要缴纳的账单序号（以空格或逗号分隔）: ");
+        if (fgets(line, sizeof(line), stdin))
+        {
+            for (char *tok = strtok(line, " ,，\n"); tok; tok = strtok(NULL, " ,，\n"))
+            {
+                int index = atoi(tok);
+                if (index >= 1 && index <= record_count && !picked[index - 1])
+                {
+                    picked[index - 1] = true;
+                    selected[selected_count++] = ids[index - 1];
+                }
+            }
+        }
+        free(picked);
     }
 
-    // 3. 绑定参数
-    sqlite3_bind_text(stmt, 1, user_id, -1, SQLITE_STATIC);
-
-    // 4. 执行查询
-    int rc = sqlite3_step(stmt);
-    if (rc == SQLITE_ROW)
+    if (selected_count == 0)
     {
-        total_fee = sqlite3_column_double(stmt, 0);
+        printf("❌ 取消缴费操作\n");
+        free(selected);
+        free(ids);
+        return;
     }
-    else if (rc != SQLITE_DONE)
+
+    printf("请选择支付方式 (1-现金 2-银行卡 3-微信 4-支付宝): ");
+    int payment_method;
+    if (scanf("%d", &payment_method) != 1 || payment_method < PAYMENT_CASH || payment_method > PAYMENT_ALIPAY)
     {
-        fprintf(stderr, "查询执行失败: %s\n", sqlite3_errmsg(db->db));
+        payment_method = PAYMENT_OTHER;
     }
+    clear_input_buffer();
 
-    // 5. 释放资源
-    sqlite3_finalize(stmt);
+    PaymentReceipt receipt;
+    while (1)
+    {
+        if (process_batch_payment(db, owner_id, settle_all ? NULL : selected, selected_count, payment_method,
+                                  idempotency_key, &receipt))
+        {
+            printf("\n✅ 批量缴费成功\n");
+            print_payment_receipt(&receipt);
+            free_payment_receipt(&receipt);
+            break;
+        }
 
-    // 6. 返回结果
-    return total_fee;
+        printf("\n❌ 缴费失败，所有账单均未扣款\n");
+        print_payment_receipt(&receipt);
+        free_payment_receipt(&receipt);
+
+        printf("是否重试? (y/n): ");
+        char retry = 'n';
+        if (scanf(" %c", &retry) != 1)
+        {
+            retry = 'n';
+        }
+        clear_input_buffer();
+        if (retry != 'y' && retry != 'Y')
+        {
+            break;
+        }
+    }
+
+    free(selected);
+    free(ids);
 }
 
 /**
@@ -377,18 +374,19 @@ void process_payment_screen(Database *db, const char *user_id)
     clear_screen();
     printf("\n============= 费用缴纳 =============\n\n");
 
-    const char *fee_types[] = {"物业费", "水电费", "停车费", "维修基金"};
-    const int valid_days[] = {365, 30, 30, 365};
+    const char *fee_types[] = {"物业费", "停车费", "水费", "电费", "燃气费", "滞纳金"};
+    int fee_type_count = (int)(sizeof(fee_types) / sizeof(fee_types[0]));
 
     printf("请选择费用类型:\n");
-    for (int i = 0; i < sizeof(fee_types) / sizeof(fee_types[0]); i++)
+    for (int i = 0; i < fee_type_count; i++)
     {
         printf("%d. %s\n", i + 1, fee_types[i]);
     }
-    printf("\n选择(1-%d): ", (int)(sizeof(fee_types) / sizeof(fee_types[0])));
+    printf("%d. 全部欠费\n", fee_type_count + 1);
+    printf("\n选择(1-%d): ", fee_type_count + 1);
 
     int fee_type;
-    if (scanf("%d", &fee_type) != 1 || fee_type < 1 || fee_type > (int)(sizeof(fee_types) / sizeof(fee_types[0])))
+    if (scanf("%d", &fee_type) != 1 || fee_type < 1 || fee_type > fee_type_count + 1)
     {
         printf("❌ 无效选择\n");
         clear_input_buffer();
@@ -396,124 +394,9 @@ void process_payment_screen(Database *db, const char *user_id)
     }
     clear_input_buffer();
 
-    // 修改查询语句，包含所有未支付的费用（包括逾期的）
-    const char *query_unpaid =
-        "SELECT transaction_id, amount, due_date, status "
-        "FROM transactions "
-        "WHERE user_id = ? AND fee_type = ? AND (status = 0 OR status = 2) "
-        "ORDER BY due_date ASC";
-
-    sqlite3_stmt *stmt_unpaid;
-    if (sqlite3_prepare_v2(db->db, query_unpaid, -1, &stmt_unpaid, NULL) == SQLITE_OK)
-    {
-        sqlite3_bind_text(stmt_unpaid, 1, user_id, -1, SQLITE_STATIC);
-        sqlite3_bind_int(stmt_unpaid, 2, fee_type);
-
-        struct UnpaidRecord
-        {
-            char transaction_id[37];
-            double amount;
-            time_t due_date;
-            int status; // 添加状态字段
-        } unpaid_records[100];
-        int record_count = 0;
-        double total_unpaid = 0.0;
-
-        while (sqlite3_step(stmt_unpaid) == SQLITE_ROW && record_count < 100)
-        {
-            const char *trans_id = (const char *)sqlite3_column_text(stmt_unpaid, 0);
-            if (trans_id)
-            {
-                strncpy(unpaid_records[record_count].transaction_id,
-                        trans_id,
-                        sizeof(unpaid_records[record_count].transaction_id) - 1);
-                unpaid_records[record_count].transaction_id[sizeof(unpaid_records[record_count].transaction_id) - 1] = '\0';
-
-                unpaid_records[record_count].amount = sqlite3_column_double(stmt_unpaid, 1);
-                unpaid_records[record_count].due_date = sqlite3_column_int64(stmt_unpaid, 2);
-                unpaid_records[record_count].status = sqlite3_column_int(stmt_unpaid, 3);
-                total_unpaid += unpaid_records[record_count].amount;
-                record_count++;
-            }
-        }
-        sqlite3_finalize(stmt_unpaid);
-
-        if (record_count > 0)
-        {
-            printf("\n=== 未缴%s记录 ===\n", fee_types[fee_type - 1]);
-            printf("交易编号\t\t金额\t\t到期日期\t\t状态\n");
-            printf("----------------------------------------------------------\n");
-
-            for (int i = 0; i < record_count; i++)
-            {
-                char date_str[20];
-                strftime(date_str, sizeof(date_str), "%Y-%m-%d",
-                         localtime(&unpaid_records[i].due_date));
-                const char *status_str = (unpaid_records[i].status == 2) ? "已逾期" : "未支付";
-                printf("%-24s ￥%-10.2f %-12s %s\n",
-                       unpaid_records[i].transaction_id,
-                       unpaid_records[i].amount,
-                       date_str,
-                       status_str);
-            }
-            printf("----------------------------------------------------------\n");
-            printf("总计: %d笔待缴费用，共计￥%.2f\n", record_count, total_unpaid);
-
-            printf("\n将一次性缴清所有费用，确定吗 (1-是/0-否): ");
-            int choice;
-            scanf("%d", &choice);
-            clear_input_buffer();
-
-            time_t now = time(NULL);
-
-            if (choice == 1)
-            {
-                sqlite3_exec(db->db, "BEGIN TRANSACTION", 0, 0, 0);
-
-                for (int i = 0; i < record_count; i++)
-                {
-                    const char *update_query =
-                        "UPDATE transactions "
-                        "SET status = 1, payment_date = ? "
-                        "WHERE transaction_id = ?";
-
-                    sqlite3_stmt *update_stmt;
-                    if (sqlite3_prepare_v2(db->db, update_query, -1, &update_stmt, NULL) == SQLITE_OK)
-                    {
-                        sqlite3_bind_int64(update_stmt, 1, (sqlite3_int64)now);
-                        sqlite3_bind_text(update_stmt, 2, unpaid_records[i].transaction_id, -1, SQLITE_STATIC);
-                        sqlite3_step(update_stmt);
-                        sqlite3_finalize(update_stmt);
-                    }
-                }
+    // 费用类型编号与FeeType一致，最后一项表示全部类型
+    pay_outstanding_bills(db, user_id, fee_type == fee_type_count + 1 ? 0 : fee_type);
 
-                sqlite3_exec(db->db, "COMMIT", 0, 0, 0);
-                char display_date[20];
-                strftime(display_date, sizeof(display_date), "%Y-%m-%d", localtime(&now));
-
-                printf("\n════════════════════════\n");
-                printf("✅ 批量缴费成功\n");
-                printf("────────────────────────\n");
-                printf("用户ID: %s\n", user_id);
-                printf("费用类型: %s\n", fee_types[fee_type - 1]);
-                printf("缴费总额: ￥%.2f\n", total_unpaid);
-                printf("缴费日期: %s\n", display_date);
-                printf("缴费笔数: %d\n", record_count);
-            }
-            else
-            {
-                printf("❌ 取消缴费操作\n");
-            }
-        }
-        else
-        {
-            printf("⚠️ 当前用户暂无未缴费用记录。\n");
-        }
-    }
-    else
-    {
-        printf("❌ 查询未缴费用记录失败: %s\n", sqlite3_errmsg(db->db));
-    }
     printf("\n按任意键返回...");
     wait_for_key();
 }
@@ -525,27 +408,60 @@ void process_payment_screen(Database *db, const char *user_id)
  */
 void query_remaining_balance(Database *db, const char *user_id)
 {
+    static const char *fee_type_names[] = {"其他费用", "物业费", "停车费", "水费", "电费", "燃气费", "滞纳金"};
+
     clear_screen();
     printf("=====查询剩余费用=====\n");
-    const char *query = "SELECT SUM(amount) FROM transactions WHERE user_id=?;";
-    sqlite3_stmt *stmt;
-    int rc = sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL);
-    if (rc != SQLITE_OK)
+
+    OwnerLedger total;
+    OwnerLedger by_type[16];
+    int type_count = get_owner_ledger_by_type(db, user_id, by_type, 16);
+    if (!get_owner_ledger(db, user_id, LEDGER_ALL_FEES, &total) || type_count < 0)
     {
-        fprintf(stderr, "无法准备查询语句: %s\n", sqlite3_errmsg(db->db));
+        printf("查询失败\n");
+        wait_for_key();
         return;
     }
-    sqlite3_bind_text(stmt, 1, user_id, -1, SQLITE_STATIC);
-    if (sqlite3_step(stmt) == SQLITE_ROW)
+
+    if (type_count > 0)
     {
-        double total_amount = sqlite3_column_double(stmt, 0);
-        printf("剩余费用: %.2f\n", total_amount);
+        static const TableColumn columns[] = {
+            {"费用类型", TABLE_ALIGN_LEFT, 0},
+            {"应缴", TABLE_ALIGN_RIGHT, 0},
+            {"已缴", TABLE_ALIGN_RIGHT, 0},
+            {"未缴", TABLE_ALIGN_RIGHT, 0},
+            {"其中逾期", TABLE_ALIGN_RIGHT, 0},
+        };
+        Table table;
+
+        printf("\n");
+        if (table_begin(&table, columns, 5, 0))
+        {
+            for (int i = 0; i < type_count; i++)
+            {
+                int type = by_type[i].fee_type;
+                char billed[32], paid[32], unpaid[32], overdue[32];
+                snprintf(billed, sizeof(billed), "%.2f", by_type[i].billed_amount);
+                snprintf(paid, sizeof(paid), "%.2f", by_type[i].paid_amount);
+                snprintf(unpaid, sizeof(unpaid), "%.2f", by_type[i].billed_amount - by_type[i].paid_amount);
+                snprintf(overdue, sizeof(overdue), "%.2f", by_type[i].overdue_amount);
+                const char *values[] = {
+                    fee_type_names[(type >= 1 && type <= 6) ? type : 0],
+                    billed, paid, unpaid, overdue};
+                table_add_row(&table, values);
+            }
+            table_end(&table);
+        }
     }
-    else
+
+    printf("剩余费用: %.2f（%d 笔未结，其中逾期 %.2f）\n",
+           total.billed_amount - total.paid_amount, total.unpaid_count, total.overdue_amount);
+    if (total.last_activity > 0)
     {
-        printf("查询失败或无剩余费用\n");
+        char date[32];
+        strftime(date, sizeof(date), "%Y-%m-%d", localtime(&total.last_activity));
+        printf("最近账务变动: %s\n", date);
     }
-    sqlite3_finalize(stmt);
     wait_for_key();
 }
 
@@ -570,19 +486,22 @@ void query_community_info(Database *db)
 
     if (execute_query(db, sql, &result))
     {
-        printf("%-20s %-30s %-10s\n",
-               "楼宇名称", "地址", "楼层数");
-        printf("--------------------------------------------------------\n");
-
-        for (int i = 0; i < result.row_count; i++)
+        static const TableColumn columns[] = {
+            {"楼宇名称", TABLE_ALIGN_LEFT, 20},
+            {"地址", TABLE_ALIGN_LEFT, 30},
+            {"楼层数", TABLE_ALIGN_RIGHT, 0},
+        };
+        Table table;
+
+        if (table_begin(&table, columns, 3, 0))
         {
-            printf("%-20s %-30s %-10s\n",
-                   result.rows[i].values[1],  // building_name
-                   result.rows[i].values[2],  // address
-                   result.rows[i].values[3]); // floors_count
+            for (int i = 0; i < result.row_count; i++)
+            {
+                // building_name, address, floors_count
+                table_add_row(&table, (const char *const *)&result.rows[i].values[1]);
+            }
+            table_end(&table);
         }
-
-        printf("--------------------------------------------------------\n");
         printf("共 %d 栋楼\n", result.row_count);
 
         free_query_result(&result);
@@ -622,32 +541,35 @@ void query_fee_info(Database *db, const char *user_id)
     int fee_types[] = {1, 2, 3, 4, 5}; // 对应物业费、停车费、水费、电费、燃气费
     int fee_count = sizeof(fee_types) / sizeof(fee_types[0]);
 
-    // 打印表头
-    printf("费用ID\t\t费用名称\t\t费用金额\t\t单位\n");
-    printf("--------------------------------------------\n");
+    static const TableColumn columns[] = {
+        {"费用ID", TABLE_ALIGN_LEFT, 0},
+        {"费用名称", TABLE_ALIGN_LEFT, 0},
+        {"费用金额", TABLE_ALIGN_RIGHT, 0},
+        {"单位", TABLE_ALIGN_LEFT, 0},
+    };
+    Table table;
+    bool shown = table_begin(&table, columns, 4, 0);
 
     // 遍历每种费用类型
     int found = 0;
-    for (int i = 0; i < fee_count; i++)
+    for (int i = 0; shown && i < fee_count; i++)
     {
         FeeStandard standard;
         if (get_current_fee_standard(db, fee_types[i], &standard))
         {
             found = 1;
 
-            // 格式化日期
-            char effective_date[20] = {0};
-            time_t eff_time = standard.effective_date;
-            strftime(effective_date, sizeof(effective_date), "%Y-%m-%d", localtime(&eff_time));
-
-            // 输出费用信息
-            printf("%-8s\t%-16s\t￥%.2f\t\t/%s\n",
-                   standard.standard_id,
-                   fee_type_names[standard.fee_type],
-                   standard.price_per_unit,
-                   standard.unit);
+            char price[32], unit[40];
+            snprintf(price, sizeof(price), "￥%.2f", standard.price_per_unit);
+            snprintf(unit, sizeof(unit), "/%s", standard.unit);
+            const char *values[] = {standard.standard_id, fee_type_names[standard.fee_type], price, unit};
+            table_add_row(&table, values);
         }
     }
+    if (shown)
+    {
+        table_end(&table);
+    }
 
     // 检查是否无数据
     if (!found)
@@ -1033,8 +955,12 @@ void show_payment_stats_by_year(Database *db, const char *user_id)
 
     sqlite3_bind_text(stmt, 1, user_id, -1, SQLITE_STATIC);
 
-    printf("%-10s %-20s\n", "年份", "缴费总额(元)");
-    printf("-------------------------------\n");
+    static const TableColumn columns[] = {
+        {"年份", TABLE_ALIGN_LEFT, 0},
+        {"缴费总额(元)", TABLE_ALIGN_RIGHT, 0},
+    };
+    Table table;
+    bool shown = table_begin(&table, columns, 2, 0);
 
     int found = 0;
     double grand_total = 0.0;
@@ -1045,9 +971,19 @@ void show_payment_stats_by_year(Database *db, const char *user_id)
         const char *year = (const char *)sqlite3_column_text(stmt, 0);
         double amount = sqlite3_column_double(stmt, 1);
 
-        printf("%-10s ￥%-20.2f\n", year, amount);
+        char amount_str[32];
+        snprintf(amount_str, sizeof(amount_str), "￥%.2f", amount);
+        const char *values[] = {year, amount_str};
+        if (shown)
+        {
+            table_add_row(&table, values);
+        }
         grand_total += amount;
     }
+    if (shown)
+    {
+        table_end(&table);
+    }
 
     sqlite3_finalize(stmt);
 
@@ -1182,9 +1118,16 @@ void query_due_payments(Database *db, const char *user_id)
     double total_due = 0.0;
     double total_overdue = 0.0;
 
+    static const TableColumn columns[] = {
+        {"费用类型", TABLE_ALIGN_LEFT, 0},
+        {"金额", TABLE_ALIGN_RIGHT, 0},
+        {"到期日", TABLE_ALIGN_LEFT, 0},
+        {"状态", TABLE_ALIGN_LEFT, 0},
+    };
+    Table table;
+
     printf("费用明细:\n");
-    printf("----------------------------------------\n");
-    printf("费用类型\t金额\t\t到期日\t\t状态\n");
+    bool shown = table_begin(&table, columns, 4, 0);
 
     int found = 0;
     while (sqlite3_step(stmt) == SQLITE_ROW)
@@ -1213,8 +1156,17 @@ void query_due_payments(Database *db, const char *user_id)
         const char *status_str = (status == 0) ? "未支付" : (status == 2) ? "已逾期"
                                                                           : "未知";
 
-        printf("%-12s\t￥%.2f\t%s\t%s\n",
-               fee_type, amount, date_str, status_str);
+        char amount_str[32];
+        snprintf(amount_str, sizeof(amount_str), "￥%.2f", amount);
+        const char *values[] = {fee_type, amount_str, date_str, status_str};
+        if (shown)
+        {
+            table_add_row(&table, values);
+        }
+    }
+    if (shown)
+    {
+        table_end(&table);
     }
 
     sqlite3_finalize(stmt);
@@ -1251,6 +1203,14 @@ void query_owner_payment_info(Database *db, const char *user_id)
 {
     printf("\n===== 缴费记录查询 =====\n");
 
+    OwnerLedger ledger;
+    if (get_owner_ledger(db, user_id, LEDGER_ALL_FEES, &ledger))
+    {
+        printf("累计应缴: %.2f  已缴: %.2f  未缴: %.2f（逾期 %.2f）\n",
+               ledger.billed_amount, ledger.paid_amount,
+               ledger.billed_amount - ledger.paid_amount, ledger.overdue_amount);
+    }
+
     const char *query =
         "SELECT CAST(transaction_id AS INTEGER) as id, "
         "fee_type, amount, payment_date, status "
@@ -1266,21 +1226,38 @@ void query_owner_payment_info(Database *db, const char *user_id)
 
     sqlite3_bind_text(stmt, 1, user_id, -1, SQLITE_STATIC);
 
-    printf("\n%-6s %-10s %-10s %-12s %-8s\n",
-           "单号", "费用类型", "金额", "支付日期", "状态");
-    printf("----------------------------------------\n");
+    static const TableColumn columns[] = {
+        {"单号", TABLE_ALIGN_RIGHT, 0},
+        {"费用类型", TABLE_ALIGN_RIGHT, 0},
+        {"金额", TABLE_ALIGN_RIGHT, 0},
+        {"支付日期", TABLE_ALIGN_LEFT, 0},
+        {"状态", TABLE_ALIGN_LEFT, 0},
+    };
+    Table table;
 
+    printf("\n");
+    if (!table_begin(&table, columns, 5, 0))
+    {
+        sqlite3_finalize(stmt);
+        return;
+    }
     while (sqlite3_step(stmt) == SQLITE_ROW)
     {
         const char *status_text = sqlite3_column_int(stmt, 4) == 1 ? "已支付" : "未支付";
 
-        printf("%-6d %-10d %-10.2f %-12s %-8s\n",
-               sqlite3_column_int(stmt, 0),
-               sqlite3_column_int(stmt, 1),
-               sqlite3_column_double(stmt, 2),
-               sqlite3_column_text(stmt, 3) ? (const char *)sqlite3_column_text(stmt, 3) : "未支付",
-               status_text);
+        char id[16], fee_type[16], amount[32];
+        snprintf(id, sizeof(id), "%d", sqlite3_column_int(stmt, 0));
+        snprintf(fee_type, sizeof(fee_type), "%d", sqlite3_column_int(stmt, 1));
+        snprintf(amount, sizeof(amount), "%.2f", sqlite3_column_double(stmt, 2));
+        const char *values[] = {
+            id,
+            fee_type,
+            amount,
+            sqlite3_column_text(stmt, 3) ? (const char *)sqlite3_column_text(stmt, 3) : "未支付",
+            status_text};
+        table_add_row(&table, values);
     }
+    table_end(&table);
 
     sqlite3_finalize(stmt);
 }
@@ -1308,15 +1285,25 @@ void query_all_owners_payment_info(Database *db)
         return;
     }
 
-    printf("业主ID\t姓名\t\t累计缴费金额\n");
-    printf("-----------------------------------------\n");
-    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+    static const TableColumn columns[] = {
+        {"业主ID", TABLE_ALIGN_LEFT, 0},
+        {"姓名", TABLE_ALIGN_LEFT, 16},
+        {"累计缴费金额", TABLE_ALIGN_RIGHT, 0},
+    };
+    Table table;
+    if (table_begin(&table, columns, 3, 0))
     {
-        const char *user_id = sqlite3_column_text(stmt, 0);
-        const char *name = sqlite3_column_text(stmt, 1);
-        double total_paid = sqlite3_column_double(stmt, 2);
-
-        printf("%s\t%s\t\t%.2f\n", user_id, name, total_paid);
+        while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+        {
+            char total_paid[32];
+            snprintf(total_paid, sizeof(total_paid), "%.2f", sqlite3_column_double(stmt, 2));
+            const char *values[] = {
+                (const char *)sqlite3_column_text(stmt, 0),
+                (const char *)sqlite3_column_text(stmt, 1),
+                total_paid};
+            table_add_row(&table, values);
+        }
+        table_end(&table);
     }
 
     sqlite3_finalize(stmt);
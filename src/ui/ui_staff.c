@@ -18,46 +18,32 @@
 
 #include "ui/ui_staff.h"
 #include "ui/ui_login.h"
+#include "ui/ui_owner.h"
 #include "models/building.h"
 #include "models/apartment.h"
 #include "models/user.h"
 #include "models/transaction.h"
+#include "models/late_fee.h"
+#include "models/reconcile.h"
+#include "models/reminder.h"
+#include "models/fee_stats.h"
+#include "models/fee_cube.h"
+#include "models/collection_rate.h"
+#include "models/ledger.h"
+#include "models/aging.h"
 #include "models/service.h"
 #include "db/db_query.h"
 #include "utils/utils.h"
+#include "utils/export.h"
+#include "utils/pager.h"
+#include "utils/pinyin.h"
+#include "utils/table.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
 #include <ctype.h>
 
-typedef struct OwnerNode
-{
-    char name[50];
-    char phone[20];
-    char building[20];
-    char room[20];
-    double area;
-    char reg_date[20];
-    int unpaid_count;
-    struct OwnerNode *next;
-} OwnerNode;
-OwnerNode *create_owner_node(const char *name, const char *phone, const char *building, const char *room, double area, const char *reg_date, int unpaid_count)
-{
-    OwnerNode *new_node = (OwnerNode *)malloc(sizeof(OwnerNode));
-    if (new_node)
-    {
-        strncpy(new_node->name, name, sizeof(new_node->name) - 1);
-        strncpy(new_node->phone, phone, sizeof(new_node->phone) - 1);
-        strncpy(new_node->building, building, sizeof(new_node->building) - 1);
-        strncpy(new_node->room, room, sizeof(new_node->room) - 1);
-        new_node->area = area;
-        strncpy(new_node->reg_date, reg_date, sizeof(new_node->reg_date) - 1);
-        new_node->unpaid_count = unpaid_count;
-        new_node->next = NULL;
-    }
-    return new_node;
-}
 // 静态函数声明
 /**
  * @brief 等待用户按键后继续
@@ -73,16 +59,11 @@ static void wait_for_key(void);
 static const char *get_fee_type_name(int fee_type);
 
 /**
- * @brief 打印用户表格表头
- */
-static void print_user_table_header();
-
-/**
- * @brief 打印单个用户信息
+ * @brief 以表格打印查询到的全部用户
  *
- * @param stmt SQLite查询结果
+ * @param stmt SQLite查询语句
  */
-static void print_user_info(sqlite3_stmt *stmt);
+static void print_user_table(sqlite3_stmt *stmt);
 
 // 函数前向声明
 /**
@@ -136,6 +117,8 @@ static const char *get_fee_type_name(int fee_type)
         return "电费";
     case 5:
         return "燃气费";
+    case 6:
+        return "滞纳金";
     default:
         return "其他费用";
     }
@@ -154,31 +137,34 @@ void wait_for_key()
 /**
  * @brief 批量发送缴费提醒
  *
+ * 为全部欠费业主生成提醒（去重窗口内已提醒过的跳过），随后投递到本地投递文件
+ *
  * @param db 数据库连接
  */
 void send_bulk_payment_reminders(Database *db)
 {
-    const char *query =
-        "SELECT DISTINCT u.user_id, u.username, SUM(t.amount) as total "
-        "FROM users u "
-        "JOIN transactions t ON u.user_id = t.user_id "
-        "WHERE t.status = 0 "
-        "GROUP BY u.user_id;";
+    ReminderBatch batch;
+    if (!queue_bulk_payment_reminders(db, time(NULL), REMINDER_DEDUPE_SECONDS, &batch))
+    {
+        printf("\n⚠️ 生成提醒失败\n");
+        wait_for_key();
+        return;
+    }
+    printf("\n欠费业主 %d 位，新生成提醒 %d 条（涉及金额 %.2f 元），%d 位业主近期已提醒而跳过\n",
+           batch.owner_count, batch.queued_count, batch.total_amount, batch.skipped_count);
 
-    sqlite3_stmt *stmt;
-    if (sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL) == SQLITE_OK)
+    ReminderDelivery delivery;
+    if (deliver_pending_reminders(db, NULL, &delivery))
     {
-        int count = 0;
-        while (sqlite3_step(stmt) == SQLITE_ROW)
+        printf("✓ 已成功发送%d条提醒\n", delivery.delivered_count);
+        if (delivery.failed_count > 0)
         {
-            const char *user_id = (const char *)sqlite3_column_text(stmt, 0);
-            const char *username = (const char *)sqlite3_column_text(stmt, 1);
-            double amount = sqlite3_column_double(stmt, 2);
-
-            count++;
+            printf("⚠️ %d条提醒因业主无手机号未能发送\n", delivery.failed_count);
         }
-        printf("\n✓ 已成功发送%d条提醒\n", count);
-        sqlite3_finalize(stmt);
+    }
+    else
+    {
+        printf("⚠️ 投递提醒失败，提醒已保留待下次发送\n");
     }
     wait_for_key();
 }
@@ -336,6 +322,7 @@ void get_current_fee_standards_info(Database *db, char *buffer, size_t buffer_si
         "  WHEN fee_type = 3 THEN '水费' "
         "  WHEN fee_type = 4 THEN '电费' "
         "  WHEN fee_type = 5 THEN '燃气费' "
+        "  WHEN fee_type = 6 THEN '滞纳金' "
         "  ELSE '其他费用' END) as type_name "
         "FROM fee_standards "
         "WHERE end_date = 0 OR end_date > strftime('%s','now') "
@@ -507,12 +494,15 @@ void show_sorted_owners_by(Database *db, const char *sort_criteria)
     snprintf(query, sizeof(query),
              "SELECT u.user_id, u.username, u.name, u.phone_number, u.email, "
              "u.registration_date, b.building_name, r.room_number, r.area_sqm, "
-             "(SELECT COUNT(*) FROM transactions t WHERE t.user_id = u.user_id AND t.status = 0) as unpaid_count "
+             "COALESCE(l.unpaid_count, 0) as unpaid_count, "
+             "strftime('%%Y-%%m-%%d', u.registration_date, 'unixepoch', 'localtime') as reg_day "
              "FROM users u "
-             "LEFT JOIN rooms r ON u.user_id = r.owner_id "
+             // 每位业主取其第一套房屋，避免GROUP BY打断索引顺序
+             "LEFT JOIN rooms r ON r.rowid = "
+             "(SELECT rowid FROM rooms WHERE owner_id = u.user_id ORDER BY rowid LIMIT 1) "
              "LEFT JOIN buildings b ON r.building_id = b.building_id "
+             "LEFT JOIN owner_ledger l ON l.user_id = u.user_id AND l.fee_type = 0 "
              "WHERE u.role_id = 'role_owner' "
-             "GROUP BY u.user_id "
              "ORDER BY %s",
              sort_criteria);
 
@@ -523,8 +513,6 @@ void show_sorted_owners_by(Database *db, const char *sort_criteria)
         printf(" %-8s %-12s   %-8s    %-8s   %-8s    \n",
                "姓名", "电话", "楼号", "房号", "面积");
 
-        OwnerNode *head = NULL;
-
         while (sqlite3_step(stmt) == SQLITE_ROW)
         {
             time_t reg_date = sqlite3_column_int64(stmt, 5);
@@ -539,17 +527,6 @@ void show_sorted_owners_by(Database *db, const char *sort_criteria)
                    sqlite3_column_double(stmt, 8),
                    date_str,
                    sqlite3_column_int(stmt, 9));
-
-            // 将数据添加到链表中
-            OwnerNode *new_node = create_owner_node(
-                sqlite3_column_text(stmt, 2),
-                sqlite3_column_text(stmt, 3),
-                sqlite3_column_text(stmt, 6),
-                sqlite3_column_text(stmt, 7),
-                sqlite3_column_double(stmt, 8),
-                date_str,
-                sqlite3_column_int(stmt, 9));
-            add_owner_to_list(&head, new_node);
         }
 
         sqlite3_finalize(stmt);
@@ -560,13 +537,16 @@ void show_sorted_owners_by(Database *db, const char *sort_criteria)
         scanf(" %c", &export_choice);
         if (export_choice == 'y' || export_choice == 'Y')
         {
-            // 导出数据到文件
-            write_list_to_file(head, "sorted_owners.csv");
-            printf("✓ 数据已成功导出到sorted_owners.csv\n");
+            // 重新执行同一查询，逐行写入文件
+            ExportOptions options;
+            export_options_for_path(&options, "sorted_owners.csv");
+            options.columns = "name,phone_number,building_name,room_number,area_sqm,reg_day,unpaid_count";
+            long rows;
+            if (export_query(db, query, NULL, NULL, "sorted_owners.csv", &options, &rows))
+                printf("✓ %ld 条数据已成功导出到sorted_owners.csv\n", rows);
+            else
+                printf("导出失败\n");
         }
-
-        // 释放链表内存
-        free_owner_list(head);
     }
     wait_for_key();
 }
@@ -583,7 +563,7 @@ void show_sorted_owners_menu(Database *db)
     {
         clear_staff_screen();
         printf("\n=== 业主信息排序 ===\n");
-        printf("1. 按姓名排序（unicode序）\n");
+        printf("1. 按姓名排序（拼音序）\n");
         printf("2. 按楼号和房号排序\n");
         printf("3. 按注册时间排序\n");
         printf("0. 返回上级菜单\n");
@@ -595,7 +575,7 @@ void show_sorted_owners_menu(Database *db)
         switch (choice)
         {
         case 1:
-            show_sorted_owners_by(db, "u.name ASC");
+            show_sorted_owners_by(db, "u.name_sort_key, u.user_id");
             break;
         case 2:
             show_sorted_owners_by(db, "b.building_name ASC, r.room_number ASC");
@@ -609,81 +589,6 @@ void show_sorted_owners_menu(Database *db)
             printf("无效选择，请重试\n");
         }
     } while (choice != 0);
-    // 询问用户是否要导出数据
-    printf("\n是否将排序后的业主信息导出到文件？(y/n): ");
-    char export_choice;
-    scanf(" %c", &export_choice);
-    if (export_choice == 'y' || export_choice == 'Y')
-    {
-        // 创建链表并导出数据
-        OwnerNode *head = NULL;
-        // 假设show_sorted_owners_by函数已经填充了链表
-        write_list_to_file(head, "sorted_owners.csv");
-        free_owner_list(head);
-        printf("✓ 数据已成功导出到sorted_owners.csv\n");
-    }
-}
-
-/**
- * @brief 将业主节点添加到链表
- *
- * @param head 链表头指针
- * @param new_node 新的业主节点
- */
-void add_owner_to_list(OwnerNode **head, OwnerNode *new_node)
-{
-    if (!*head)
-    {
-        *head = new_node;
-    }
-    else
-    {
-        OwnerNode *current = *head;
-        while (current->next)
-        {
-            current = current->next;
-        }
-        current->next = new_node;
-    }
-}
-
-/**
- * @brief 将链表数据写入文件
- *
- * @param head 链表头指针
- * @param filename 文件名
- */
-void write_list_to_file(OwnerNode *head, const char *filename)
-{
-    FILE *file = fopen(filename, "w");
-    if (file)
-    {
-        OwnerNode *current = head;
-        while (current)
-        {
-            fprintf(file, "%s,%s,%s,%s,%.2f,%s,%d\n",
-                    current->name, current->phone, current->building, current->room,
-                    current->area, current->reg_date, current->unpaid_count);
-            current = current->next;
-        }
-        fclose(file);
-    }
-}
-
-/**
- * @brief 释放链表内存
- *
- * @param head 链表头指针
- */
-void free_owner_list(OwnerNode *head)
-{
-    OwnerNode *current = head;
-    while (current)
-    {
-        OwnerNode *next = current->next;
-        free(current);
-        current = next;
-    }
 }
 
 /**
@@ -794,21 +699,37 @@ void show_owner_payment_status(Database *db)
         return;
     }
 
-    printf("\n%-8s %-12s %-8s %-12s %-12s %-10s\n",
-           "业主ID", "姓名", "房号", "已缴金额", "未缴金额", "逾期数");
-    printf("------------------------------------------------------------\n");
+    static const TableColumn columns[] = {
+        {"业主ID", TABLE_ALIGN_LEFT, 0},
+        {"姓名", TABLE_ALIGN_LEFT, 16},
+        {"房号", TABLE_ALIGN_LEFT, 0},
+        {"已缴金额", TABLE_ALIGN_RIGHT, 0},
+        {"未缴金额", TABLE_ALIGN_RIGHT, 0},
+        {"逾期数", TABLE_ALIGN_RIGHT, 0},
+    };
+    Table table;
 
+    printf("\n");
     bool found = false;
-    while (sqlite3_step(stmt) == SQLITE_ROW)
+    if (table_begin(&table, columns, 6, 0))
     {
-        found = true;
-        printf("%-8s %-12s %-8s %-12.2f %-12.2f %-10d\n",
-               sqlite3_column_text(stmt, 0),
-               sqlite3_column_text(stmt, 1),
-               sqlite3_column_text(stmt, 2),
-               sqlite3_column_double(stmt, 3),
-               sqlite3_column_double(stmt, 4),
-               sqlite3_column_int(stmt, 5));
+        while (sqlite3_step(stmt) == SQLITE_ROW)
+        {
+            found = true;
+            char paid[32], unpaid[32], overdue[16];
+            snprintf(paid, sizeof(paid), "%.2f", sqlite3_column_double(stmt, 3));
+            snprintf(unpaid, sizeof(unpaid), "%.2f", sqlite3_column_double(stmt, 4));
+            snprintf(overdue, sizeof(overdue), "%d", sqlite3_column_int(stmt, 5));
+            const char *values[] = {
+                (const char *)sqlite3_column_text(stmt, 0),
+                (const char *)sqlite3_column_text(stmt, 1),
+                (const char *)sqlite3_column_text(stmt, 2),
+                paid,
+                unpaid,
+                overdue};
+            table_add_row(&table, values);
+        }
+        table_end(&table);
     }
 
     sqlite3_finalize(stmt);
@@ -838,20 +759,33 @@ void send_payment_reminders(Database *db)
         return;
     }
 
-    printf("\n%-8s %-12s %-15s %-25s %-12s\n",
-           "业主ID", "姓名", "电话", "邮箱", "待缴总额");
-    printf("----------------------------------------------------------------\n");
+    static const TableColumn columns[] = {
+        {"业主ID", TABLE_ALIGN_LEFT, 0},
+        {"姓名", TABLE_ALIGN_LEFT, 16},
+        {"电话", TABLE_ALIGN_LEFT, 15},
+        {"邮箱", TABLE_ALIGN_LEFT, 25},
+        {"待缴总额", TABLE_ALIGN_RIGHT, 0},
+    };
+    Table table;
 
+    printf("\n");
     bool found = false;
-    while (sqlite3_step(stmt) == SQLITE_ROW)
+    if (table_begin(&table, columns, 5, 0))
     {
-        found = true;
-        printf("%-8s %-12s %-15s %-25s %-12.2f\n",
-               sqlite3_column_text(stmt, 0),
-               sqlite3_column_text(stmt, 1),
-               sqlite3_column_text(stmt, 2),
-               sqlite3_column_text(stmt, 3),
-               sqlite3_column_double(stmt, 4));
+        while (sqlite3_step(stmt) == SQLITE_ROW)
+        {
+            found = true;
+            char total_due[32];
+            snprintf(total_due, sizeof(total_due), "%.2f", sqlite3_column_double(stmt, 4));
+            const char *values[] = {
+                (const char *)sqlite3_column_text(stmt, 0),
+                (const char *)sqlite3_column_text(stmt, 1),
+                (const char *)sqlite3_column_text(stmt, 2),
+                (const char *)sqlite3_column_text(stmt, 3),
+                total_due};
+            table_add_row(&table, values);
+        }
+        table_end(&table);
     }
 
     sqlite3_finalize(stmt);
@@ -861,9 +795,10 @@ void send_payment_reminders(Database *db)
         printf("\n是否发送提醒短信给这些业主？(y/n): ");
         char choice;
         scanf(" %c", &choice);
+        clear_input_buffer();
         if (choice == 'y' || choice == 'Y')
         {
-            printf("✓ 提醒短信发送成功！\n");
+            send_bulk_payment_reminders(db);
         }
     }
 }
@@ -1153,19 +1088,34 @@ void show_staff_query_screen(Database *db, const char *user_id, UserType user_ty
             sqlite3_stmt *stmt;
             if (sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL) == SQLITE_OK)
             {
-                printf("%-12s%-16s%-16s%-16s%-16s%-16s\n",
-                       "用户ID", "用户名", "楼号", "房间号", "楼层", "面积(㎡)");
+                static const TableColumn columns[] = {
+                    {"用户ID", TABLE_ALIGN_LEFT, 0},
+                    {"用户名", TABLE_ALIGN_LEFT, 16},
+                    {"楼号", TABLE_ALIGN_LEFT, 16},
+                    {"房间号", TABLE_ALIGN_LEFT, 0},
+                    {"楼层", TABLE_ALIGN_RIGHT, 0},
+                    {"面积(㎡)", TABLE_ALIGN_RIGHT, 0},
+                };
+                Table table;
                 int found = 0;
-                while (sqlite3_step(stmt) == SQLITE_ROW)
+                if (table_begin(&table, columns, 6, 0))
                 {
-                    found = 1;
-                    printf("%-12s%-16s%-16s%-16s%-16d%-16.2f\n",
-                           sqlite3_column_text(stmt, 0),
-                           sqlite3_column_text(stmt, 1),
-                           sqlite3_column_text(stmt, 2),
-                           sqlite3_column_text(stmt, 3),
-                           sqlite3_column_int(stmt, 4),
-                           sqlite3_column_double(stmt, 5));
+                    while (sqlite3_step(stmt) == SQLITE_ROW)
+                    {
+                        found = 1;
+                        char floor[16], area[32];
+                        snprintf(floor, sizeof(floor), "%d", sqlite3_column_int(stmt, 4));
+                        snprintf(area, sizeof(area), "%.2f", sqlite3_column_double(stmt, 5));
+                        const char *values[] = {
+                            (const char *)sqlite3_column_text(stmt, 0),
+                            (const char *)sqlite3_column_text(stmt, 1),
+                            (const char *)sqlite3_column_text(stmt, 2),
+                            (const char *)sqlite3_column_text(stmt, 3),
+                            floor,
+                            area};
+                        table_add_row(&table, values);
+                    }
+                    table_end(&table);
                 }
 
                 if (!found)
@@ -1191,17 +1141,14 @@ void show_staff_query_screen(Database *db, const char *user_id, UserType user_ty
 }
 
 /**
- * @brief 按姓名比较服务人员（用于排序）
+ * @brief 取服务人员姓名（用于按拼音排序）
  *
- * @param a 第一个服务人员
- * @param b 第二个服务人员
- * @return int 比较结果
+ * @param record 服务人员
+ * @return const char* 姓名
  */
-int compare_staff_by_name(const void *a, const void *b)
+static const char *staff_name(const void *record)
 {
-    const Staff *staff1 = (const Staff *)a;
-    const Staff *staff2 = (const Staff *)b;
-    return strcmp(staff1->name, staff2->name);
+    return ((const Staff *)record)->name;
 }
 
 /**
@@ -1224,12 +1171,19 @@ void show_staff_sort_screen(Database *db, const char *user_id, UserType user_typ
     }
     else
     {
-        qsort(staff_list, count, sizeof(Staff), compare_staff_by_name);
+        // 只排序指针，不搬动Staff结构体
+        void *sorted[100];
+        for (int i = 0; i < count; i++)
+        {
+            sorted[i] = &staff_list[i];
+        }
+        pinyin_sort_records(sorted, count, staff_name);
         printf("按姓名排序后的服务人员信息:\n");
         for (int i = 0; i < count; i++)
         {
+            const Staff *staff = sorted[i];
             printf("%d. 姓名: %s, 联系方式: %s, 服务类型: %s\n",
-                   i + 1, staff_list[i].name, staff_list[i].phone_number, staff_list[i].staff_type_id);
+                   i + 1, staff->name, staff->phone_number, staff->staff_type_id);
         }
     }
 
@@ -1341,6 +1295,7 @@ void show_current_fee_standards(Database *db)
         "  WHEN fee_type = 3 THEN '水费' "
         "  WHEN fee_type = 4 THEN '电费' "
         "  WHEN fee_type = 5 THEN '燃气费' "
+        "  WHEN fee_type = 6 THEN '滞纳金' "
         "  ELSE '其他费用' END) as type_name "
         "FROM fee_standards "
         "WHERE end_date = 0 OR end_date > strftime('%s','now') "
@@ -1692,105 +1647,38 @@ void show_sorted_users(Database *db)
 /**
  * @brief 发送缴费提醒给指定用户
  *
+ * 按业主当前欠费生成提醒并立即投递；去重窗口内已提醒过的不重复发送
+ *
  * @param db 数据库连接
  * @param user_id 用户ID
- * @param unpaid_amount 未付款金额
- * @param fee_types 费用类型字符串
  */
-void send_payment_reminder(Database *db, const char *user_id, double unpaid_amount, const char *fee_types)
+void send_payment_reminder(Database *db, const char *user_id)
 {
-    char reminder[512];
-    char username[100];
-    char phone[20] = "未知";
-    time_t now = time(NULL);
-    struct tm *t = localtime(&now);
-
-    const char *user_query =
-        "SELECT name, phone_number FROM users WHERE user_id = ?";
-
-    sqlite3_stmt *stmt;
-    if (sqlite3_prepare_v2(db->db, user_query, -1, &stmt, NULL) == SQLITE_OK)
-    {
-        sqlite3_bind_text(stmt, 1, user_id, -1, SQLITE_STATIC);
-
-        if (sqlite3_step(stmt) == SQLITE_ROW)
-        {
-            strncpy(username, (const char *)sqlite3_column_text(stmt, 0), sizeof(username) - 1);
-            strncpy(phone, (const char *)sqlite3_column_text(stmt, 1), sizeof(phone) - 1);
-        }
-        sqlite3_finalize(stmt);
-    }
-
-    char fee_types_str[256] = "";
-    if (strlen(fee_types) == 0)
+    ReminderBatch batch;
+    if (!queue_payment_reminder(db, user_id, time(NULL), REMINDER_DEDUPE_SECONDS, &batch))
     {
-        get_current_fee_standards_info(db, fee_types_str, sizeof(fee_types_str));
-        fee_types = fee_types_str;
+        printf("\n⚠️ 发送提醒失败\n");
+        return;
     }
-
-    double overdue_amount = 0.0;
-    int overdue_days = 0;
-
-    const char *overdue_query =
-        "SELECT SUM(amount), "
-        "MAX(julianday('now') - julianday(datetime(due_date, 'unixepoch'))) "
-        "FROM transactions "
-        "WHERE user_id = ? AND status = 0 AND due_date < strftime('%s','now')";
-
-    if (sqlite3_prepare_v2(db->db, overdue_query, -1, &stmt, NULL) == SQLITE_OK)
+    if (batch.owner_count == 0)
     {
-        sqlite3_bind_text(stmt, 1, user_id, -1, SQLITE_STATIC);
-
-        if (sqlite3_step(stmt) == SQLITE_ROW)
-        {
-            overdue_amount = sqlite3_column_double(stmt, 0);
-            overdue_days = (int)sqlite3_column_double(stmt, 1);
-        }
-        sqlite3_finalize(stmt);
+        printf("\n该业主没有待缴费用，无需提醒\n");
+        return;
     }
-
-    snprintf(reminder, sizeof(reminder),
-             "尊敬的%s业主:\n\n"
-             "您好！我们的系统显示您目前有以下费用未缴纳：\n"
-             "总金额：%.2f元\n",
-             username, unpaid_amount);
-
-    if (overdue_amount > 0)
+    if (batch.skipped_count > 0)
     {
-        char overdue_info[200];
-        snprintf(overdue_info, sizeof(overdue_info),
-                 "其中逾期费用：%.2f元，已逾期%d天\n"
-                 "请注意：逾期超过30天将产生额外滞纳金\n\n",
-                 overdue_amount, overdue_days);
-        strncat(reminder, overdue_info, sizeof(reminder) - strlen(reminder) - 1);
+        printf("\n该业主近%d天内已提醒过，本次不再重复发送\n", REMINDER_DEDUPE_SECONDS / (24 * 3600));
+        return;
     }
 
-    strncat(reminder, "费用类型：", sizeof(reminder) - strlen(reminder) - 1);
-    strncat(reminder, fee_types, sizeof(reminder) - strlen(reminder) - 1);
-
-    char ending[200];
-    snprintf(ending, sizeof(ending),
-             "\n\n请您及时缴纳费用。如已缴费请忽略此提醒。\n\n"
-             "发送时间：%d-%02d-%02d\n"
-             "联系电话：400-888-XXXX\n"
-             "%s物业服务中心",
-             t->tm_year + 1900, t->tm_mon + 1, t->tm_mday,
-             "翠湖花园");
-    strncat(reminder, ending, sizeof(reminder) - strlen(reminder) - 1);
-
-    char query[1024];
-    snprintf(query, sizeof(query),
-             "INSERT INTO payment_reminders (user_id, reminder_content, send_time, status) "
-             "VALUES ('%s', '%s', %ld, 0)",
-             user_id, reminder, (long)now);
-
-    if (execute_update(db, query))
+    ReminderDelivery delivery;
+    if (deliver_pending_reminders(db, NULL, &delivery) && delivery.delivered_count > 0)
     {
-        printf("\n✓ 已成功向业主 %s(%s) 发送缴费提醒\n", username, phone);
+        printf("\n✓ 已成功发送缴费提醒（待缴 %.2f 元）\n", batch.total_amount);
     }
     else
     {
-        printf("\n⚠️ 发送提醒失败\n");
+        printf("\n⚠️ 提醒已生成但未能投递，请检查业主手机号\n");
     }
 }
 
@@ -1855,32 +1743,39 @@ void send_payment_reminder_screen(Database *db, const char *user_id)
     clear_staff_screen();
     printf("\n=== 发送缴费提醒 ===\n");
 
+    // 支持按业主ID、姓名或手机号查找
     const char *query =
-        "SELECT u.name, u.phone_number, t.amount, t.due_date, "
-        "CASE t.fee_type "
-        "    WHEN 1 THEN '物业费' "
-        "    WHEN 2 THEN '停车费' "
-        "    WHEN 3 THEN '水费' "
-        "    WHEN 4 THEN '电费' "
-        "    WHEN 5 THEN '燃气费' "
-        "END as fee_type "
-        "FROM transactions t "
-        "JOIN users u ON t.user_id = u.user_id "
-        "WHERE t.user_id = ? AND t.status = 0";
+        "SELECT user_id, name, phone_number FROM users "
+        "WHERE role_id = 'role_owner' AND (user_id = ?1 OR name = ?1 OR phone_number = ?1) "
+        "LIMIT 1";
 
     sqlite3_stmt *stmt;
     if (sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL) == SQLITE_OK)
     {
-        printf("\n是否发送缴费提醒？(Y/N): ");
-        char choice;
-        scanf(" %c", &choice);
+        sqlite3_bind_text(stmt, 1, user_id, -1, SQLITE_STATIC);
+        if (sqlite3_step(stmt) == SQLITE_ROW)
+        {
+            char owner_id[40];
+            strncpy(owner_id, (const char *)sqlite3_column_text(stmt, 0), sizeof(owner_id) - 1);
+            owner_id[sizeof(owner_id) - 1] = '\0';
+            printf("\n业主: %s  电话: %s\n", sqlite3_column_text(stmt, 1),
+                   sqlite3_column_text(stmt, 2) ? (const char *)sqlite3_column_text(stmt, 2) : "无");
+            sqlite3_finalize(stmt);
+
+            printf("\n是否发送缴费提醒？(Y/N): ");
+            char choice;
+            scanf(" %c", &choice);
 
-        if (toupper(choice) == 'Y')
+            if (toupper(choice) == 'Y')
+            {
+                send_payment_reminder(db, owner_id);
+            }
+        }
+        else
         {
-            printf("\n✓ 提醒已发送\n");
+            sqlite3_finalize(stmt);
+            printf("\n未找到业主: %s\n", user_id);
         }
-
-        sqlite3_finalize(stmt);
     }
     wait_for_user();
 }
@@ -1962,12 +1857,7 @@ void query_user_by_name(Database *db)
         snprintf(name_pattern, sizeof(name_pattern), "%%%s%%", name);
         sqlite3_bind_text(stmt, 1, name_pattern, -1, SQLITE_STATIC);
 
-        print_user_table_header();
-
-        while (sqlite3_step(stmt) == SQLITE_ROW)
-        {
-            print_user_info(stmt);
-        }
+        print_user_table(stmt);
 
         sqlite3_finalize(stmt);
     }
@@ -2001,12 +1891,7 @@ void query_user_by_room(Database *db)
         sqlite3_bind_text(stmt, 1, building, -1, SQLITE_STATIC);
         sqlite3_bind_text(stmt, 2, room, -1, SQLITE_STATIC);
 
-        print_user_table_header();
-
-        while (sqlite3_step(stmt) == SQLITE_ROW)
-        {
-            print_user_info(stmt);
-        }
+        print_user_table(stmt);
 
         sqlite3_finalize(stmt);
     }
@@ -2032,21 +1917,35 @@ void query_user_payment_status(Database *db)
     sqlite3_stmt *stmt;
     if (sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL) == SQLITE_OK)
     {
+        static const TableColumn columns[] = {
+            {"用户名", TABLE_ALIGN_LEFT, 20},
+            {"姓名", TABLE_ALIGN_LEFT, 15},
+            {"未缴费笔数", TABLE_ALIGN_RIGHT, 0},
+            {"待缴总额", TABLE_ALIGN_RIGHT, 0},
+            {"状态", TABLE_ALIGN_LEFT, 0},
+        };
+        Table table;
+
         printf("\n=== 待缴费用户列表 ===\n");
-        printf("%-20s%-15s%-15s%-15s%-15s\n",
-               "用户名", "姓名", "未缴费笔数", "待缴总额", "状态");
-        printf("------------------------------------------------------------------\n");
+        table_begin(&table, columns, 5, 0);
 
+        // 逐行流式输出，每满一屏写出一次
         while (sqlite3_step(stmt) == SQLITE_ROW)
         {
-            printf("%-20s%-15s%-15d%-15.2f%-15s\n",
-                   sqlite3_column_text(stmt, 1),
-                   sqlite3_column_text(stmt, 2),
-                   sqlite3_column_int(stmt, 3),
-                   sqlite3_column_double(stmt, 4),
-                   "待缴费");
+            char count[16], amount[32];
+            snprintf(count, sizeof(count), "%d", sqlite3_column_int(stmt, 3));
+            snprintf(amount, sizeof(amount), "%.2f", sqlite3_column_double(stmt, 4));
+
+            const char *values[] = {
+                (const char *)sqlite3_column_text(stmt, 1),
+                (const char *)sqlite3_column_text(stmt, 2),
+                count,
+                amount,
+                "待缴费"};
+            table_add_row(&table, values);
         }
 
+        table_end(&table);
         sqlite3_finalize(stmt);
     }
     wait_for_key();
@@ -2059,127 +1958,90 @@ void query_user_payment_status(Database *db)
  */
 void show_all_users(Database *db)
 {
-    clear_staff_screen();
-
-    const char *query =
-        "SELECT DISTINCT "
-        "   u.user_id, u.username, u.name, u.phone_number, u.email, "
-        "   b.building_name, r.room_number, r.area_sqm, "
-        "   (SELECT COUNT(*) FROM transactions t WHERE t.user_id = u.user_id AND t.status = 1) as paid_count, "
-        "   (SELECT COALESCE(SUM(amount), 0) FROM transactions t WHERE t.user_id = u.user_id AND t.status = 1) as total_paid, "
-        "   (SELECT COUNT(*) FROM transactions t WHERE t.user_id = u.user_id AND t.status = 0) as unpaid_count, "
-        "   (SELECT COALESCE(SUM(amount), 0) FROM transactions t WHERE t.user_id = u.user_id AND t.status = 0) as total_unpaid "
-        "FROM users u "
-        "LEFT JOIN rooms r ON u.user_id = r.owner_id "
-        "LEFT JOIN buildings b ON r.building_id = b.building_id "
-        "WHERE u.role_id = 'role_owner' "
-        "ORDER BY b.building_name, r.room_number";
-
-    sqlite3_stmt *stmt;
-    if (sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL) == SQLITE_OK)
-    {
-        printf("\n=== 业主信息总览 ===\n\n");
-
-        printf(" %-8s %-12s %-8s %-10s %-6s %-8s %-12s %-12s\n",
-               "姓名", "电话", "楼号", "房号", "面积", "已缴费", "待缴费", "缴费率");
-
-        while (sqlite3_step(stmt) == SQLITE_ROW)
-        {
-            const char *name = (const char *)sqlite3_column_text(stmt, 2);
-            const char *phone = (const char *)sqlite3_column_text(stmt, 3);
-            const char *building = (const char *)sqlite3_column_text(stmt, 5);
-            const char *room = (const char *)sqlite3_column_text(stmt, 6);
-            double area = sqlite3_column_double(stmt, 7);
-            int paid_count = sqlite3_column_int(stmt, 8);
-            double total_paid = sqlite3_column_double(stmt, 9);
-            int unpaid_count = sqlite3_column_int(stmt, 10);
-            double total_unpaid = sqlite3_column_double(stmt, 11);
-
-            double payment_rate = 0;
-            if (paid_count + unpaid_count > 0)
-            {
-                payment_rate = (double)paid_count / (paid_count + unpaid_count) * 100;
-            }
-
-            printf(" %-8s %-12s %-8s %-10s %6.1f %8.2f %12.2f %11.1f%%\n",
-                   name ? name : "未知",
-                   phone ? phone : "未知",
-                   building ? building : "未分配",
-                   room ? room : "未分配",
-                   area,
-                   total_paid,
-                   total_unpaid,
-                   payment_rate);
-
-            if (unpaid_count > 0)
-            {
-
-                printf(" 待缴费明细:                                                                              \n");
-
-                const char *detail_query =
-                    "SELECT fee_type, amount, due_date "
-                    "FROM transactions "
-                    "WHERE user_id = ? AND status = 0 "
-                    "ORDER BY due_date ASC";
-
-                sqlite3_stmt *detail_stmt;
-                if (sqlite3_prepare_v2(db->db, detail_query, -1, &detail_stmt, NULL) == SQLITE_OK)
-                {
-                    sqlite3_bind_text(detail_stmt, 1, sqlite3_column_text(stmt, 0), -1, SQLITE_STATIC);
-
-                    while (sqlite3_step(detail_stmt) == SQLITE_ROW)
-                    {
-                        int fee_type = sqlite3_column_int(detail_stmt, 0);
-                        double amount = sqlite3_column_double(detail_stmt, 1);
-                        time_t due_date = sqlite3_column_int64(detail_stmt, 2);
-
-                        char date_str[20];
-                        strftime(date_str, sizeof(date_str), "%Y-%m-%d", localtime(&due_date));
-
-                        printf(" %-12s: %-8.2f元  到期日期: %-12s                                          \n",
-                               get_fee_type_name(fee_type),
-                               amount,
-                               date_str);
-                    }
-                    sqlite3_finalize(detail_stmt);
-                }
-            }
-        }
-
-        sqlite3_finalize(stmt);
+    static const TableColumn columns[] = {
+        {"姓名", TABLE_ALIGN_LEFT, 10},
+        {"电话", TABLE_ALIGN_LEFT, 0},
+        {"楼号", TABLE_ALIGN_LEFT, 10},
+        {"房号", TABLE_ALIGN_LEFT, 0},
+        {"面积", TABLE_ALIGN_RIGHT, 0},
+        {"已缴费", TABLE_ALIGN_RIGHT, 0},
+        {"待缴笔数", TABLE_ALIGN_RIGHT, 0},
+        {"待缴费", TABLE_ALIGN_RIGHT, 0},
+        {"缴费率", TABLE_ALIGN_RIGHT, 0},
+    };
+    // 每页只对当页的业主计算缴费汇总；键集列去掉NULL，保证比较有效
+    const PagerQuery query = {
+        .title = "业主信息总览",
+        .sql = "SELECT name, phone, building, room, printf('%.1f', area_sqm) AS area, "
+               "printf('%.2f', total_paid) AS paid, unpaid_count, printf('%.2f', total_unpaid) AS unpaid, "
+               "CASE WHEN paid_count + unpaid_count > 0 "
+               "THEN printf('%.1f%%', 100.0 * paid_count / (paid_count + unpaid_count)) ELSE '0.0%' END AS rate, "
+               "sort_building, sort_room, sort_user "
+               "FROM (SELECT IFNULL(u.name, '未知') AS name, IFNULL(u.phone_number, '未知') AS phone, "
+               "   IFNULL(b.building_name, '未分配') AS building, IFNULL(r.room_number, '未分配') AS room, "
+               "   IFNULL(r.area_sqm, 0) AS area_sqm, "
+               "   (SELECT COUNT(*) FROM transactions t WHERE t.user_id = u.user_id AND t.status = 1) AS paid_count, "
+               "   (SELECT COALESCE(SUM(amount), 0) FROM transactions t WHERE t.user_id = u.user_id AND t.status = 1) AS total_paid, "
+               "   (SELECT COUNT(*) FROM transactions t WHERE t.user_id = u.user_id AND t.status = 0) AS unpaid_count, "
+               "   (SELECT COALESCE(SUM(amount), 0) FROM transactions t WHERE t.user_id = u.user_id AND t.status = 0) AS total_unpaid, "
+               "   IFNULL(b.building_name, '') AS sort_building, IFNULL(r.room_number, '') AS sort_room, "
+               "   u.user_id AS sort_user "
+               "   FROM users u "
+               "   LEFT JOIN rooms r ON u.user_id = r.owner_id "
+               "   LEFT JOIN buildings b ON r.building_id = b.building_id "
+               "   WHERE u.role_id = 'role_owner')",
+        .columns = columns,
+        .column_count = 9,
+        .key_count = 3,
+    };
+
+    if (!pager_browse(db, &query))
+    {
+        printf("查询业主信息失败: %s\n", sqlite3_errmsg(db->db));
+        wait_for_key();
     }
-    wait_for_key();
-}
-
-/**
- * @brief 打印用户表头
- */
-static void print_user_table_header()
-{
-    printf("\n%-12s%-15s%-15s%-15s%-25s%-15s%-15s\n",
-           "用户名", "姓名", "电话", "楼号", "房号", "注册时间", "状态");
-    printf("--------------------------------------------------------------------------------\n");
 }
 
 /**
- * @brief 打印用户信息
+ * @brief 以表格打印查询到的全部用户
  *
- * @param stmt SQLite查询结果
+ * @param stmt SQLite查询语句
  */
-static void print_user_info(sqlite3_stmt *stmt)
+static void print_user_table(sqlite3_stmt *stmt)
 {
-    time_t reg_time = sqlite3_column_int64(stmt, 5);
-    char time_str[20];
-    strftime(time_str, sizeof(time_str), "%Y-%m-%d", localtime(&reg_time));
-
-    printf("%-12s%-15s%-15s%-15s%-25s%-15s%-15s\n",
-           sqlite3_column_text(stmt, 1),
-           sqlite3_column_text(stmt, 2),
-           sqlite3_column_text(stmt, 3),
-           sqlite3_column_text(stmt, 7),
-           sqlite3_column_text(stmt, 6),
-           time_str,
-           "正常");
+    static const TableColumn columns[] = {
+        {"用户名", TABLE_ALIGN_LEFT, 16},
+        {"姓名", TABLE_ALIGN_LEFT, 16},
+        {"电话", TABLE_ALIGN_LEFT, 15},
+        {"楼号", TABLE_ALIGN_LEFT, 16},
+        {"房号", TABLE_ALIGN_LEFT, 10},
+        {"注册时间", TABLE_ALIGN_LEFT, 0},
+        {"状态", TABLE_ALIGN_LEFT, 0},
+    };
+    Table table;
+
+    printf("\n");
+    if (!table_begin(&table, columns, 7, 0))
+    {
+        return;
+    }
+    while (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        time_t reg_time = sqlite3_column_int64(stmt, 5);
+        char time_str[20];
+        strftime(time_str, sizeof(time_str), "%Y-%m-%d", localtime(&reg_time));
+
+        const char *values[] = {
+            (const char *)sqlite3_column_text(stmt, 1),
+            (const char *)sqlite3_column_text(stmt, 2),
+            (const char *)sqlite3_column_text(stmt, 3),
+            (const char *)sqlite3_column_text(stmt, 7),
+            (const char *)sqlite3_column_text(stmt, 6),
+            time_str,
+            "正常"};
+        table_add_row(&table, values);
+    }
+    table_end(&table);
 }
 
 /**
@@ -2256,97 +2118,140 @@ void show_paid_users(Database *db)
     wait_for_key();
 }
 
+/**
+ * @brief 读取一行整数输入，直接回车时返回默认值
+ */
+static int read_int_or_default(const char *prompt, int default_value)
+{
+    char line[32];
+    printf("%s", prompt);
+    if (!fgets(line, sizeof(line), stdin))
+    {
+        return default_value;
+    }
+    trim_newline(line);
+    return line[0] ? atoi(line) : default_value;
+}
+
+/**
+ * @brief 打印一组欠费排行
+ */
+static void print_debtor_ranks(const DebtorRank *ranks, int count, time_t now)
+{
+    printf(" %-4s %-8s %-12s %-15s %10s %10s    %-16s %-10s\n",
+           "排名", "姓名", "电话", "住址", "欠费金额", "其中逾期", "欠费项目", "欠费状态");
+
+    for (int i = 0; i < count; i++)
+    {
+        const DebtorRank *rank = &ranks[i];
+        int overdue_days = rank->earliest_due > 0 ? (int)(difftime(now, rank->earliest_due) / 86400) : 0;
+        const char *status = "正常";
+        if (overdue_days > 90)
+            status = "严重逾期";
+        else if (overdue_days > 30)
+            status = "已逾期";
+        else if (overdue_days > 0)
+            status = "即将逾期";
+
+        printf(" %-4d %-8s %-12s %-15s %10.2f %10.2f    %-16s %-10s\n",
+               i + 1, rank->name, rank->phone, rank->address,
+               rank->ledger.billed_amount - rank->ledger.paid_amount,
+               rank->ledger.overdue_amount, rank->fee_types, status);
+    }
+    if (count == 0)
+    {
+        printf(" %-70s \n", "当前没有欠费业主");
+    }
+}
+
 /**
  * @brief 显示未缴费用户
  *
+ * 以欠费排行展示：可选前K位及排行范围（全小区、按楼宇、按费用类型）。
+ * 排行直接读取随出账、缴费同步更新的业主账本，不再对全部未缴账单重新汇总排序。
+ *
  * @param db 数据库连接
  */
 void show_unpaid_users(Database *db)
 {
     clear_staff_screen();
-    printf("\n=== 欠费业主明细表 ===\n\n");
-
-    const char *query =
-        "SELECT u.user_id, u.name, u.phone_number, b.building_name, r.room_number, "
-        "SUM(t.amount) as total_due, COUNT(t.transaction_id) as unpaid_count, "
-        "GROUP_CONCAT(DISTINCT CASE "
-        "  WHEN t.fee_type = 1 THEN '物业费' "
-        "  WHEN t.fee_type = 2 THEN '停车费' "
-        "  WHEN t.fee_type = 3 THEN '水费' "
-        "  WHEN t.fee_type = 4 THEN '电费' "
-        "  WHEN t.fee_type = 5 THEN '燃气费' "
-        "  ELSE '其他费用' END) as fee_types, "
-        "MIN(t.due_date) as earliest_due, "
-        "julianday('now') - julianday(datetime(MIN(t.due_date), 'unixepoch')) as overdue_days "
-        "FROM users u "
-        "JOIN transactions t ON u.user_id = t.user_id "
-        "LEFT JOIN rooms r ON u.user_id = r.owner_id "
-        "LEFT JOIN buildings b ON r.building_id = b.building_id "
-        "WHERE t.status = 0 AND u.role_id = 'role_owner' "
-        "GROUP BY u.user_id "
-        "ORDER BY overdue_days DESC";
+    printf("\n=== 欠费业主排行 ===\n\n");
 
-    sqlite3_stmt *stmt;
-    if (sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL) == SQLITE_OK)
+    int k = read_int_or_default("显示前几位业主(直接回车为10): ", 10);
+    if (k < 1 || k > 1000)
     {
+        k = 10;
+    }
+    int scope = read_int_or_default("排行范围(1 全小区  2 按楼宇  3 按费用类型，直接回车为全小区): ", 1);
 
-        printf(" %-8s %-12s %-15s %-8s    %-10s    %-10s\n",
-               "姓名", "电话", "住址", "欠费金额", "欠费项目", "欠费状态");
-
-        int count = 0;
-        double total_unpaid = 0.0;
+    DebtorRank *ranks = malloc(k * sizeof(DebtorRank));
+    if (!ranks)
+    {
+        printf("内存分配失败\n");
+        wait_for_key();
+        return;
+    }
 
-        while (sqlite3_step(stmt) == SQLITE_ROW)
+    time_t now = time(NULL);
+    int count;
+    if (scope == 2)
+    {
+        sqlite3_stmt *stmt;
+        if (sqlite3_prepare_v2(db->db, "SELECT building_id, building_name FROM buildings ORDER BY building_name",
+                               -1, &stmt, NULL) == SQLITE_OK)
         {
-            count++;
-            const char *name = (const char *)sqlite3_column_text(stmt, 1);
-            const char *phone = (const char *)sqlite3_column_text(stmt, 2);
-
-            char address[50] = "";
-            if (sqlite3_column_text(stmt, 3) && sqlite3_column_text(stmt, 4))
+            while (sqlite3_step(stmt) == SQLITE_ROW)
             {
-                snprintf(address, sizeof(address), "%s-%s",
-                         (const char *)sqlite3_column_text(stmt, 3),
-                         (const char *)sqlite3_column_text(stmt, 4));
+                count = get_top_debtors(db, LEDGER_ALL_FEES, (const char *)sqlite3_column_text(stmt, 0), k, ranks);
+                if (count > 0)
+                {
+                    printf("\n【%s】\n", sqlite3_column_text(stmt, 1));
+                    print_debtor_ranks(ranks, count, now);
+                }
             }
-            else
+            sqlite3_finalize(stmt);
+        }
+    }
+    else if (scope == 3)
+    {
+        static const int FEE_TYPES[] = {TRANS_PROPERTY_FEE, TRANS_PARKING_FEE, TRANS_WATER_FEE, TRANS_ELECTRICITY_FEE,
+                                        TRANS_GAS_FEE, TRANS_LATE_FEE, TRANS_OTHER};
+        for (size_t i = 0; i < sizeof(FEE_TYPES) / sizeof(FEE_TYPES[0]); i++)
+        {
+            int fee_type = FEE_TYPES[i];
+            count = get_top_debtors(db, fee_type, NULL, k, ranks);
+            if (count > 0)
             {
-                strcpy(address, "未登记");
+                printf("\n【%s】\n", get_fee_type_name(fee_type));
+                print_debtor_ranks(ranks, count, now);
             }
-
-            double amount = sqlite3_column_double(stmt, 5);
-            const char *fee_types = (const char *)sqlite3_column_text(stmt, 7);
-            int overdue_days = (int)sqlite3_column_double(stmt, 9);
-
-            total_unpaid += amount;
-
-            const char *status = "正常";
-            if (overdue_days > 90)
-                status = "严重逾期";
-            else if (overdue_days > 30)
-                status = "已逾期";
-            else if (overdue_days > 0)
-                status = "即将逾期";
-
-            printf(" %-8s %-12s %-15s %8.2f %-10s %-10s\n",
-                   name, phone, address, amount,
-                   fee_types ? fee_types : "物业费等", status);
         }
-
-        if (count > 0)
-        {
-
-            printf(" 总计: %-2d位业主欠费，共计金额: %-10.2f元                        \n",
-                   count, total_unpaid);
-        }
-        else
+    }
+    else
+    {
+        count = get_top_debtors(db, LEDGER_ALL_FEES, NULL, k, ranks);
+        if (count >= 0)
         {
-            printf(" %-70s \n", "当前没有欠费业主");
+            print_debtor_ranks(ranks, count, now);
         }
+    }
 
+    // 全小区欠费总额直接取账本合计
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(db->db,
+                           "SELECT COUNT(*), COALESCE(SUM(billed_amount - paid_amount), 0) FROM owner_ledger "
+                           "WHERE fee_type = 0 AND billed_amount - paid_amount > 0.005",
+                           -1, &stmt, NULL) == SQLITE_OK)
+    {
+        if (sqlite3_step(stmt) == SQLITE_ROW && sqlite3_column_int(stmt, 0) > 0)
+        {
+            printf("\n 总计: %-2d位业主欠费，共计金额: %-10.2f元\n",
+                   sqlite3_column_int(stmt, 0), sqlite3_column_double(stmt, 1));
+        }
         sqlite3_finalize(stmt);
     }
 
+    free(ranks);
     wait_for_key();
 }
 
@@ -2414,8 +2319,10 @@ void show_payment_management_menu(Database *db)
         printf("2. 显示所有欠费业主\n");
         printf("3. 显示所有已缴费业主\n");
         printf("4. 查看当前收费标准\n");
+        printf("5. 代业主批量缴费\n");
+        printf("6. 导入银行/微信/支付宝对账单\n");
         printf("0. 返回上级菜单\n");
-        printf("请选择(0-4): ");
+        printf("请选择(0-6): ");
 
         int choice;
         scanf("%d", &choice);
@@ -2436,6 +2343,12 @@ void show_payment_management_menu(Database *db)
             show_current_fee_standards(db);
             wait_for_key();
             break;
+        case 5:
+            collect_owner_payment(db);
+            break;
+        case 6:
+            import_statement_screen(db);
+            break;
         case 0:
             return;
         default:
@@ -2445,6 +2358,144 @@ void show_payment_management_menu(Database *db)
     }
 }
 
+/**
+ * @brief 代业主批量缴费
+ *
+ * 按姓名或电话定位业主后，列出其全部欠费账单，一次缴清或选择部分账单缴纳
+ *
+ * @param db 数据库连接
+ */
+void collect_owner_payment(Database *db)
+{
+    clear_staff_screen();
+    printf("\n=== 代业主批量缴费 ===\n\n");
+
+    char keyword[64];
+    printf("请输入业主姓名或电话: ");
+    if (!fgets(keyword, sizeof(keyword), stdin))
+    {
+        return;
+    }
+    trim_newline(keyword);
+
+    const char *query =
+        "SELECT user_id, name, phone_number FROM users "
+        "WHERE role_id = 'role_owner' AND (name = ?1 OR phone_number = ?1) "
+        "ORDER BY name LIMIT 20";
+
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        printf("查询业主失败: %s\n", sqlite3_errmsg(db->db));
+        wait_for_key();
+        return;
+    }
+    sqlite3_bind_text(stmt, 1, keyword, -1, SQLITE_STATIC);
+
+    char owner_ids[20][40];
+    int owner_count = 0;
+    while (sqlite3_step(stmt) == SQLITE_ROW && owner_count < 20)
+    {
+        strncpy(owner_ids[owner_count], (const char *)sqlite3_column_text(stmt, 0), sizeof(owner_ids[0]) - 1);
+        owner_ids[owner_count][sizeof(owner_ids[0]) - 1] = '\0';
+        const char *phone = (const char *)sqlite3_column_text(stmt, 2);
+        printf("%d. %s (%s)\n", owner_count + 1, sqlite3_column_text(stmt, 1), phone ? phone : "无电话");
+        owner_count++;
+    }
+    sqlite3_finalize(stmt);
+
+    if (owner_count == 0)
+    {
+        printf("未找到该业主\n");
+        wait_for_key();
+        return;
+    }
+
+    int index = 1;
+    if (owner_count > 1)
+    {
+        printf("请选择业主(1-%d): ", owner_count);
+        if (scanf("%d", &index) != 1 || index < 1 || index > owner_count)
+        {
+            clear_input_buffer();
+            printf("无效选择\n");
+            wait_for_key();
+            return;
+        }
+        clear_input_buffer();
+    }
+
+    pay_outstanding_bills(db, owner_ids[index - 1], 0);
+    wait_for_key();
+}
+
+/**
+ * @brief 导入对账单并自动核销
+ *
+ * 匹配成功的流水直接入账，无法匹配的写入异常报告供人工处理
+ *
+ * @param db 数据库连接
+ */
+void import_statement_screen(Database *db)
+{
+    clear_staff_screen();
+    printf("\n=== 导入对账单 ===\n\n");
+
+    char path[256];
+    printf("请输入对账单文件路径(CSV): ");
+    if (!fgets(path, sizeof(path), stdin))
+    {
+        return;
+    }
+    trim_newline(path);
+    if (path[0] == '\0')
+    {
+        printf("文件路径不能为空\n");
+        wait_for_key();
+        return;
+    }
+
+    printf("\n对账单未注明支付方式时按以下方式入账:\n");
+    printf("1. 现金\n2. 银行卡\n3. 微信\n4. 支付宝\n");
+    printf("请选择(1-4): ");
+    int method;
+    if (scanf("%d", &method) != 1 || method < PAYMENT_CASH || method > PAYMENT_ALIPAY)
+    {
+        clear_input_buffer();
+        printf("无效选择\n");
+        wait_for_key();
+        return;
+    }
+    clear_input_buffer();
+
+    char report_path[64];
+    time_t now = time(NULL);
+    strftime(report_path, sizeof(report_path), "reconcile_exceptions_%Y%m%d_%H%M%S.csv", localtime(&now));
+
+    ReconcileSummary summary;
+    if (!reconcile_statement(db, path, method, report_path, &summary))
+    {
+        printf("对账失败，未入账任何流水\n");
+        wait_for_key();
+        return;
+    }
+
+    printf("\n对账完成，用时 %.2f 秒\n", summary.elapsed_seconds);
+    printf("流水条数: %ld\n", summary.line_count);
+    printf("匹配入账: %ld 条，共 %.2f 元\n", summary.matched_count, summary.matched_amount);
+    printf("此前已入账: %ld 条\n", summary.replayed_count);
+    printf("异常流水: %ld 条\n", summary.exception_count);
+    if (summary.exception_count > 0)
+    {
+        printf("异常报告已写入: %s\n", report_path);
+    }
+    else
+    {
+        remove(report_path);
+    }
+    wait_for_key();
+}
+
 /**
  * @brief 显示提醒管理菜单
  *
@@ -2459,6 +2510,7 @@ void show_reminder_management_menu(Database *db)
         printf("\n=== 缴费提醒管理 ===\n");
         printf("1. 发送单个提醒\n");
         printf("2. 批量发送提醒\n");
+        printf("3. 查看提醒记录\n");
         printf("0. 返回上级菜单\n");
         printf("\n请选择: ");
 
@@ -2470,14 +2522,17 @@ void show_reminder_management_menu(Database *db)
         case 1:
         {
             char user_id[37];
-            printf("请输入业主姓名: ");
-            scanf("%s", user_id);
+            printf("请输入业主姓名或手机号: ");
+            scanf("%36s", user_id);
             send_payment_reminder_screen(db, user_id);
             break;
         }
         case 2:
             send_bulk_payment_reminders(db);
             break;
+        case 3:
+            show_reminder_history(db);
+            break;
         case 0:
             return;
         default:
@@ -2500,6 +2555,10 @@ void show_statistics_menu(Database *db)
         printf("\n===== 缴费统计分析 =====\n");
         printf("1. 按年度查看统计\n");
         printf("2. 查看当前月度统计\n");
+        printf("3. 按楼宇查看滞纳金\n");
+        printf("4. 欠费情况分析\n");
+        printf("5. 费用多维分析\n");
+        printf("6. 月度收缴率走势\n");
         printf("0. 返回上级菜单\n");
         printf("\n请选择: ");
 
@@ -2520,6 +2579,20 @@ void show_statistics_menu(Database *db)
         case 2:
             show_current_statistics(db);
             break;
+        case 3:
+            clear_staff_screen();
+            print_late_fee_building_summary(db);
+            wait_for_key();
+            break;
+        case 4:
+            show_unpaid_analysis(db);
+            break;
+        case 5:
+            show_fee_cube_screen(db);
+            break;
+        case 6:
+            show_collection_rate_screen(db);
+            break;
         case 0:
             printf("返回上级菜单\n");
             break;
@@ -2532,131 +2605,169 @@ void show_statistics_menu(Database *db)
 }
 
 /**
- * @brief 显示年度统计
+ * @brief 费用多维分析
+ *
+ * 从预汇总的费用立方体按楼宇、费用类型、月份/年份和支付方式任意组合汇总，
+ * 可按楼宇、费用类型、月份区间和支付方式切片，用于逐层下钻
  *
  * @param db 数据库连接
- * @param year 年份
  */
-void show_yearly_statistics(Database *db, int year)
+void show_fee_cube_screen(Database *db)
 {
-    clear_staff_screen();
-    printf("\n=== %d年度缴费统计 ===\n\n", year);
-
-    char year_str[5];
-    snprintf(year_str, sizeof(year_str), "%d", year);
-
-    const char *query =
-        "SELECT "
-        "(SELECT COUNT(DISTINCT user_id) FROM users WHERE role_id = 'role_owner') as total_owners, "
-        "(SELECT COUNT(DISTINCT user_id) FROM transactions WHERE status = 1 AND strftime('%Y', datetime(payment_date, 'unixepoch')) = ?) as paid_users, "
-        "(SELECT COUNT(DISTINCT user_id) FROM transactions WHERE status = 0 AND strftime('%Y', datetime(due_date, 'unixepoch')) = ?) as unpaid_users, "
-        "(SELECT SUM(amount) FROM transactions WHERE status = 1 AND strftime('%Y', datetime(payment_date, 'unixepoch')) = ?) as paid_amount, "
-        "(SELECT SUM(amount) FROM transactions WHERE status = 0 AND strftime('%Y', datetime(due_date, 'unixepoch')) = ?) as unpaid_amount";
-
-    sqlite3_stmt *stmt;
-    if (sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL) == SQLITE_OK)
+    char line[64];
+    do
     {
-        for (int i = 1; i <= 4; i++)
+        clear_staff_screen();
+        printf("\n=== 费用多维分析 ===\n");
+        printf("汇总维度(可多选，如13): 1 楼宇  2 费用类型  3 月份  4 年份  5 支付方式，直接回车为总计\n");
+        printf("请选择: ");
+        unsigned group_by = 0;
+        if (fgets(line, sizeof(line), stdin))
         {
-            sqlite3_bind_text(stmt, i, year_str, -1, SQLITE_STATIC);
+            static const unsigned dims[] = {CUBE_BY_BUILDING, CUBE_BY_FEE_TYPE, CUBE_BY_MONTH, CUBE_BY_YEAR, CUBE_BY_METHOD};
+            for (char *p = line; *p; p++)
+            {
+                if (*p >= '1' && *p <= '5')
+                {
+                    group_by |= dims[*p - '1'];
+                }
+            }
         }
 
-        if (sqlite3_step(stmt) == SQLITE_ROW)
+        CubeFilter filter = CUBE_FILTER_ALL;
+        char building[64];
+        printf("楼宇名称(直接回车不限): ");
+        if (fgets(building, sizeof(building), stdin))
         {
-            int total_owners = sqlite3_column_int(stmt, 0);
-            int paid_users = sqlite3_column_int(stmt, 1);
-            int unpaid_users = sqlite3_column_int(stmt, 2);
-            double paid_amount = sqlite3_column_double(stmt, 3);
-            double unpaid_amount = sqlite3_column_double(stmt, 4);
-
-            printf(" 总业主数量: %-8d           \n", total_owners);
-            printf(" 已缴费用户: %-8d \n",
-                   paid_users, total_owners > 0 ? (float)paid_users / total_owners * 100 : 0);
-            printf(" 未缴费用户: %-8d \n",
-                   unpaid_users, total_owners > 0 ? (float)unpaid_users / total_owners * 100 : 0);
-            printf(" 已收缴费总额: %-8.2f元     \n", paid_amount);
-            printf(" 未收缴费总额: %-8.2f元     \n", unpaid_amount);
+            trim_newline(building);
+            if (building[0])
+            {
+                filter.building_name = building;
+            }
         }
-        sqlite3_finalize(stmt);
-    }
-
-    const char *type_query =
-        "SELECT fee_type, "
-        "COUNT(DISTINCT user_id) as user_count, "
-        "SUM(amount) as total_amount "
-        "FROM transactions "
-        "WHERE (status = 0 AND strftime('%Y', datetime(due_date, 'unixepoch')) = ?) "
-        "OR (status = 1 AND strftime('%Y', datetime(payment_date, 'unixepoch')) = ?) "
-        "GROUP BY fee_type";
+        filter.fee_type = read_int_or_default("费用类型(1物业费 2停车费 3水费 4电费 5燃气费 6滞纳金，直接回车不限): ", CUBE_ANY);
+        filter.month_from = read_int_or_default("起始月份YYYYMM(直接回车不限): ", CUBE_ANY);
+        filter.month_to = read_int_or_default("截止月份YYYYMM(直接回车不限): ", CUBE_ANY);
+        filter.payment_method = read_int_or_default("支付方式(0未缴 1现金 2银行卡 3微信 4支付宝，直接回车不限): ", CUBE_ANY);
 
-    if (sqlite3_prepare_v2(db->db, type_query, -1, &stmt, NULL) == SQLITE_OK)
-    {
-        sqlite3_bind_text(stmt, 1, year_str, -1, SQLITE_STATIC);
-        sqlite3_bind_text(stmt, 2, year_str, -1, SQLITE_STATIC);
-
-        printf("【按费用类型统计】\n");
-
-        printf(" %-10s  %-8s  %-10s \n", "费用类型", "用户数", "总金额");
-
-        double total = 0;
-        while (sqlite3_step(stmt) == SQLITE_ROW)
+        CubeResult result;
+        printf("\n");
+        if (query_fee_cube(db, group_by, &filter, &result))
         {
-            int fee_type = sqlite3_column_int(stmt, 0);
-            int user_count = sqlite3_column_int(stmt, 1);
-            double amount = sqlite3_column_double(stmt, 2);
-            total += amount;
+            print_fee_cube(&result);
+            free_fee_cube_result(&result);
+        }
+        else
+        {
+            printf("查询失败\n");
+        }
 
-            printf(" %-10s  %-8d  %10.2f \n",
-                   get_fee_type_name(fee_type),
-                   user_count,
-                   amount);
+        printf("\n继续分析？(y/n): ");
+        if (!fgets(line, sizeof(line), stdin))
+        {
+            break;
         }
+    } while (line[0] == 'y' || line[0] == 'Y');
+}
 
-        printf(" %-10s  %-8s  %10.2f \n", "合计", "", total);
+/**
+ * @brief 月度收缴率走势
+ *
+ * 按账期月份列出收缴率及环比、同比，并按年画出走势图
+ *
+ * @param db 数据库连接
+ */
+void show_collection_rate_screen(Database *db)
+{
+    clear_staff_screen();
+    printf("\n=== 月度收缴率走势 ===\n\n");
 
-        sqlite3_finalize(stmt);
+    int years = read_int_or_default("查看最近几年(直接回车为3): ", 3);
+    if (years < 1 || years > 50)
+    {
+        years = 3;
     }
 
-    const char *unpaid_list_query =
-        "SELECT DISTINCT u.name, u.phone_number, b.building_name, r.room_number, "
-        "COUNT(t.transaction_id) as unpaid_count, SUM(t.amount) as unpaid_amount "
-        "FROM transactions t "
-        "JOIN users u ON t.user_id = u.user_id "
-        "LEFT JOIN rooms r ON u.user_id = r.owner_id "
-        "LEFT JOIN buildings b ON r.building_id = b.building_id "
-        "WHERE t.status = 0 AND strftime('%Y', datetime(t.due_date, 'unixepoch')) = ? "
-        "GROUP BY u.user_id "
-        "ORDER BY unpaid_amount DESC "
-        "LIMIT 10";
+    time_t now = time(NULL);
+    struct tm tm_now;
+    localtime_r(&now, &tm_now);
+    int year = tm_now.tm_year + 1900;
 
-    if (sqlite3_prepare_v2(db->db, unpaid_list_query, -1, &stmt, NULL) == SQLITE_OK)
+    CollectionRateSeries series;
+    printf("\n");
+    if (query_collection_rates(db, (year - years + 1) * 100 + 1, year * 100 + 12, &series))
     {
-        sqlite3_bind_text(stmt, 1, year_str, -1, SQLITE_STATIC);
+        print_collection_rates(&series);
+        free_collection_rates(&series);
+    }
+    else
+    {
+        printf("查询失败\n");
+    }
+    wait_for_key();
+}
 
-        printf("【%d年度未缴费业主TOP10】\n", year);
+/**
+ * @brief 显示年度统计
+ *
+ * @param db 数据库连接
+ * @param year 年份
+ */
+void show_yearly_statistics(Database *db, int year)
+{
+    clear_staff_screen();
+    printf("\n=== %d年度缴费统计 ===\n\n", year);
 
-        printf(" %-8s %-12s %-8s %-6s %-8s %-10s\n",
-               "业主", "电话", "楼号", "房号", "未缴笔数", "未缴金额");
+    FeeStats stats;
+    if (!collect_fee_stats(db, year, time(NULL), &stats))
+    {
+        printf("统计失败\n");
+        wait_for_key();
+        return;
+    }
 
-        bool found = false;
-        while (sqlite3_step(stmt) == SQLITE_ROW)
-        {
-            found = true;
-            printf(" %-8s %-12s %-8s %-6s %-8d %10.2f\n",
-                   sqlite3_column_text(stmt, 0),
-                   sqlite3_column_text(stmt, 1),
-                   sqlite3_column_text(stmt, 2) ? sqlite3_column_text(stmt, 2) : (const unsigned char *)"未知",
-                   sqlite3_column_text(stmt, 3) ? sqlite3_column_text(stmt, 3) : (const unsigned char *)"未知",
-                   sqlite3_column_int(stmt, 4),
-                   sqlite3_column_double(stmt, 5));
-        }
+    int total_owners = stats.total_owners;
+    printf(" 总业主数量: %-8d           \n", total_owners);
+    printf(" 已缴费用户: %-8d (%.1f%%)   \n",
+           stats.year_paid.user_count, total_owners > 0 ? (float)stats.year_paid.user_count / total_owners * 100 : 0);
+    printf(" 未缴费用户: %-8d (%.1f%%)   \n",
+           stats.year_unpaid.user_count, total_owners > 0 ? (float)stats.year_unpaid.user_count / total_owners * 100 : 0);
+    printf(" 已收缴费总额: %-8.2f元     \n", stats.year_paid.amount);
+    printf(" 未收缴费总额: %-8.2f元     \n", stats.year_unpaid.amount);
 
-        if (!found)
+    printf("【按费用类型统计】\n");
+    printf(" %-10s  %-8s  %-10s \n", "费用类型", "用户数", "总金额");
+
+    double total = 0;
+    for (int slot = 1; slot < FEE_STATS_TYPE_SLOTS; slot++)
+    {
+        const FeeStatCell *cell = &stats.year_by_type[slot];
+        if (cell->bill_count == 0)
         {
-            printf(" %-62s \n", "暂无未缴费记录");
+            continue;
         }
+        total += cell->amount;
+        printf(" %-10s  %-8d  %10.2f \n",
+               get_fee_type_name(slot == FEE_STATS_TYPE_SLOTS - 1 ? TRANS_OTHER : slot),
+               cell->user_count,
+               cell->amount);
+    }
+    printf(" %-10s  %-8s  %10.2f \n", "合计", "", total);
 
-        sqlite3_finalize(stmt);
+    printf("【%d年度未缴费业主TOP10】\n", year);
+    printf(" %-8s %-12s %-8s %-6s %-8s %-10s\n",
+           "业主", "电话", "楼号", "房号", "未缴笔数", "未缴金额");
+
+    for (int i = 0; i < stats.year_top_count; i++)
+    {
+        const FeeStatOwner *owner = &stats.year_top_unpaid[i];
+        printf(" %-8s %-12s %-8s %-6s %-8ld %10.2f\n",
+               owner->name, owner->phone, owner->building, owner->room,
+               owner->bill_count, owner->amount);
+    }
+    if (stats.year_top_count == 0)
+    {
+        printf(" %-62s \n", "暂无未缴费记录");
     }
 
     wait_for_key();
@@ -2672,40 +2783,33 @@ void show_current_statistics(Database *db)
     clear_staff_screen();
     printf("\n=== 当前缴费情况统计 ===\n\n");
 
-    const char *query =
-        "SELECT "
-        "(SELECT COUNT(DISTINCT user_id) FROM users WHERE role_id = 'role_owner') as total_owners, "
-        "(SELECT COUNT(DISTINCT user_id) FROM transactions WHERE status = 1) as paid_users, "
-        "(SELECT COUNT(DISTINCT user_id) FROM transactions WHERE status = 0) as unpaid_users, "
-        "(SELECT SUM(amount) FROM transactions WHERE status = 1) as total_paid, "
-        "(SELECT SUM(amount) FROM transactions WHERE status = 0) as total_unpaid";
+    time_t now = time(NULL);
+    struct tm tm_now;
+    localtime_r(&now, &tm_now);
 
-    sqlite3_stmt *stmt;
-    if (sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL) == SQLITE_OK)
+    FeeStats stats;
+    if (collect_fee_stats(db, tm_now.tm_year + 1900, now, &stats))
     {
-        if (sqlite3_step(stmt) == SQLITE_ROW)
-        {
-            int total_owners = sqlite3_column_int(stmt, 0);
-            int paid_users = sqlite3_column_int(stmt, 1);
-            int unpaid_users = sqlite3_column_int(stmt, 2);
-            double total_paid = sqlite3_column_double(stmt, 3);
-            double total_unpaid = sqlite3_column_double(stmt, 4);
-
-            printf("总业主数量: %-8d           \n", total_owners);
-            printf("已缴费用户: %-8d (%.1f%%)   \n",
-                   paid_users, total_owners > 0 ? (float)paid_users / total_owners * 100 : 0);
-            printf("未缴费用户: %-8d (%.1f%%)   \n",
-                   unpaid_users, total_owners > 0 ? (float)unpaid_users / total_owners * 100 : 0);
-            printf("已收缴费总额: %-8.2f元     \n", total_paid);
-            printf("未收缴费总额: %-8.2f元     \n", total_unpaid);
-        }
-        sqlite3_finalize(stmt);
+        int total_owners = stats.total_owners;
+        printf("总业主数量: %-8d           \n", total_owners);
+        printf("已缴费用户: %-8d (%.1f%%)   \n",
+               stats.paid.user_count, total_owners > 0 ? (float)stats.paid.user_count / total_owners * 100 : 0);
+        printf("未缴费用户: %-8d (%.1f%%)   \n",
+               stats.unpaid.user_count, total_owners > 0 ? (float)stats.unpaid.user_count / total_owners * 100 : 0);
+        printf("已收缴费总额: %-8.2f元     \n", stats.paid.amount);
+        printf("未收缴费总额: %-8.2f元     \n", stats.unpaid.amount);
+    }
+    else
+    {
+        printf("统计失败\n");
     }
     wait_for_key();
 }
 
 /**
- * @brief 显示欠费分析
+ * @brief 显示欠费情况分析
+ *
+ * 账龄矩阵：按账龄分档、费用类型 x 账龄、楼宇 x 账龄，分档边界可自定义
  *
  * @param db 数据库连接
  */
@@ -2714,69 +2818,33 @@ void show_unpaid_analysis(Database *db)
     clear_staff_screen();
     printf("\n=== 欠费情况分析 ===\n\n");
 
-    const char *duration_query =
-        "SELECT "
-        "CASE "
-        "  WHEN julianday('now') - julianday(datetime(due_date, 'unixepoch')) <= 30 THEN '30天内' "
-        "  WHEN julianday('now') - julianday(datetime(due_date, 'unixepoch')) <= 90 THEN '90天内' "
-        "  ELSE '90天以上' "
-        "END as overdue_period, "
-        "COUNT(DISTINCT user_id) as user_count, "
-        "SUM(amount) as total_amount "
-        "FROM transactions "
-        "WHERE status = 0 "
-        "GROUP BY overdue_period "
-        "ORDER BY MIN(due_date)";
-
-    sqlite3_stmt *stmt;
-    if (sqlite3_prepare_v2(db->db, duration_query, -1, &stmt, NULL) == SQLITE_OK)
+    AgingConfig config = AGING_CONFIG_DEFAULT;
+    char line[128];
+    printf("账龄分档边界(天，逗号分隔，直接回车使用30,60,90,180): ");
+    if (fgets(line, sizeof(line), stdin) && line[0] != '\n' && !parse_aging_bounds(line, &config))
     {
-        printf("【按欠费时长统计】\n");
-        printf("%-10s  %-8s  %-10s \n", "欠费时长", "用户数", "欠费金额");
-
-        while (sqlite3_step(stmt) == SQLITE_ROW)
-        {
-            printf(" %-10s  %-8d  %10.2f \n",
-                   sqlite3_column_text(stmt, 0),
-                   sqlite3_column_int(stmt, 1),
-                   sqlite3_column_double(stmt, 2));
-        }
-
-        sqlite3_finalize(stmt);
+        printf("分档边界无效，使用默认分档\n");
+        config = (AgingConfig)AGING_CONFIG_DEFAULT;
     }
+    printf("\n");
 
-    const char *type_query =
-        "SELECT fee_type, COUNT(DISTINCT user_id) as user_count, "
-        "SUM(amount) as total_amount "
-        "FROM transactions "
-        "WHERE status = 0 "
-        "GROUP BY fee_type "
-        "ORDER BY total_amount DESC";
-
-    if (sqlite3_prepare_v2(db->db, type_query, -1, &stmt, NULL) == SQLITE_OK)
+    AgingMatrix matrix;
+    if (!build_aging_matrix(db, &config, time(NULL), &matrix))
     {
-        printf("【按费用类型统计】\n");
-
-        printf(" %-10s  %-8s  %-10s \n", "费用类型", "用户数", "欠费金额");
-
-        double total = 0;
-        while (sqlite3_step(stmt) == SQLITE_ROW)
-        {
-            int fee_type = sqlite3_column_int(stmt, 0);
-            int user_count = sqlite3_column_int(stmt, 1);
-            double amount = sqlite3_column_double(stmt, 2);
-            total += amount;
-
-            printf(" %-10s  %-8d  %10.2f \n",
-                   get_fee_type_name(fee_type),
-                   user_count,
-                   amount);
-        }
-
-        printf(" %-10s  %-8s  %10.2f \n", "合计", "", total);
+        printf("统计失败\n");
+        wait_for_key();
+        return;
+    }
 
-        sqlite3_finalize(stmt);
+    if (matrix.row_count == 0)
+    {
+        printf("当前没有未缴账单\n");
     }
+    else
+    {
+        print_aging_matrix(&matrix);
+    }
+    free_aging_matrix(&matrix);
     wait_for_key();
 }
 
@@ -2858,8 +2926,7 @@ void show_owner_payment_query(Database *db)
 
                 if (choice == 'y' || choice == 'Y')
                 {
-                    send_payment_reminder(db, user_id, unpaid, "");
-                    printf("\n✓ 已成功向 %s 发送缴费提醒\n", owner_name);
+                    send_payment_reminder(db, user_id);
                 }
             }
         }
@@ -2943,49 +3010,30 @@ void show_payment_details(Database *db, const char *user_id, int status)
  */
 void show_reminder_history(Database *db)
 {
-    clear_staff_screen();
-    printf("\n=== 已发送提醒记录 ===\n\n");
-
-    const char *query =
-        "SELECT pr.reminder_id, u.name, u.phone_number, pr.send_time, "
-        "substr(pr.reminder_content, 1, 30) as content_preview "
-        "FROM payment_reminders pr "
-        "JOIN users u ON pr.user_id = u.user_id "
-        "ORDER BY pr.send_time DESC "
-        "LIMIT 20";
-
-    sqlite3_stmt *stmt;
-    if (sqlite3_prepare_v2(db->db, query, -1, &stmt, NULL) == SQLITE_OK)
-    {
-
-        printf(" %-8s %-10s %-12s %-16s %-20s\n",
-               "编号", "姓名", "电话", "发送时间", "内容预览");
-
-        bool found = false;
-        while (sqlite3_step(stmt) == SQLITE_ROW)
-        {
-            found = true;
-            int id = sqlite3_column_int(stmt, 0);
-            const char *name = (const char *)sqlite3_column_text(stmt, 1);
-            const char *phone = (const char *)sqlite3_column_text(stmt, 2);
-            time_t send_time = sqlite3_column_int64(stmt, 3);
-            const char *preview = (const char *)sqlite3_column_text(stmt, 4);
-
-            char time_str[20];
-            strftime(time_str, sizeof(time_str), "%Y-%m-%d %H:%M", localtime(&send_time));
-
-            printf(" %-8d %-10s %-12s %-16s %-20s\n",
-                   id, name, phone, time_str, preview);
-        }
-
-        if (!found)
-        {
-            printf(" %-68s \n", "暂无提醒记录");
-        }
-
-        sqlite3_finalize(stmt);
-    }
-    else
+    static const TableColumn columns[] = {
+        {"编号", TABLE_ALIGN_RIGHT, 0},
+        {"姓名", TABLE_ALIGN_LEFT, 10},
+        {"电话", TABLE_ALIGN_LEFT, 0},
+        {"发送时间", TABLE_ALIGN_LEFT, 0},
+        {"状态", TABLE_ALIGN_LEFT, 0},
+        {"内容预览", TABLE_ALIGN_LEFT, 30},
+    };
+    const PagerQuery query = {
+        .title = "已发送提醒记录",
+        .sql = "SELECT pr.reminder_id, u.name, u.phone_number, "
+               "strftime('%Y-%m-%d %H:%M', pr.send_time, 'unixepoch', 'localtime') AS send_text, "
+               "CASE pr.status WHEN 1 THEN '已投递' WHEN 2 THEN '投递失败' ELSE '待投递' END AS status_text, "
+               "substr(pr.reminder_content, 1, 30) AS content_preview, "
+               "pr.send_time AS sort_time, pr.reminder_id AS sort_id "
+               "FROM payment_reminders pr "
+               "JOIN users u ON pr.user_id = u.user_id",
+        .columns = columns,
+        .column_count = 6,
+        .key_count = 2,
+        .descending = true,
+    };
+
+    if (!pager_browse(db, &query))
     {
         printf("查询提醒记录失败: %s\n", sqlite3_errmsg(db->db));
     }
@@ -0,0 +1,868 @@
+#include "utils/arrow.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define FB_MAX_FIELDS 8 // 本文件用到的flatbuffers表的最大字段数
+
+// Message.fbs / Schema.fbs中的枚举值
+#define ARROW_METADATA_V5 4
+#define ARROW_HEADER_SCHEMA 1
+#define ARROW_HEADER_DICTIONARY_BATCH 2
+#define ARROW_HEADER_RECORD_BATCH 3
+#define ARROW_TYPE_INT 2
+#define ARROW_TYPE_FLOATING_POINT 3
+#define ARROW_TYPE_UTF8 5
+#define ARROW_TYPE_TIMESTAMP 10
+#define ARROW_PRECISION_DOUBLE 2
+#define ARROW_UNIT_SECOND 0
+
+static const char ARROW_MAGIC[8] = "ARROW1\0\0";
+
+/*
+ * 从缓冲区尾部向前构建的flatbuffer。位置一律用"距缓冲区尾部的字节数"表示，
+ * 扩容时数据整体后移，已有位置不变。同一时刻只能有一个表处于构建中，
+ * 子对象须在父表开始之前写完。
+ */
+typedef struct
+{
+    uint8_t *buf;
+    size_t cap;
+    size_t used;
+    size_t minalign;
+    size_t fields[FB_MAX_FIELDS]; // 当前表各字段的位置，0为未写
+    int field_count;
+    size_t table_start;
+    bool failed;
+} FlatBuilder;
+
+static bool fb_reserve(FlatBuilder *b, size_t n)
+{
+    if (b->cap - b->used >= n)
+    {
+        return true;
+    }
+    size_t cap = b->cap ? b->cap * 2 : 1024;
+    while (cap - b->used < n)
+    {
+        cap *= 2;
+    }
+    uint8_t *buf = malloc(cap);
+    if (!buf)
+    {
+        b->failed = true;
+        return false;
+    }
+    if (b->used)
+    {
+        memcpy(buf + cap - b->used, b->buf + b->cap - b->used, b->used);
+    }
+    free(b->buf);
+    b->buf = buf;
+    b->cap = cap;
+    return true;
+}
+
+static void fb_put(FlatBuilder *b, const void *data, size_t n)
+{
+    if (!fb_reserve(b, n))
+    {
+        return;
+    }
+    b->used += n;
+    if (data)
+        memcpy(b->buf + b->cap - b->used, data, n);
+    else
+        memset(b->buf + b->cap - b->used, 0, n);
+}
+
+/**
+ * 填充使得再写入additional字节后位置按size对齐
+ */
+static void fb_prep(FlatBuilder *b, size_t size, size_t additional)
+{
+    if (size > b->minalign)
+    {
+        b->minalign = size;
+    }
+    fb_put(b, NULL, (~(b->used + additional) + 1) & (size - 1));
+}
+
+static void fb_offset(FlatBuilder *b, size_t ref)
+{
+    fb_prep(b, 4, 0);
+    uint32_t value = (uint32_t)(b->used + 4 - ref);
+    fb_put(b, &value, 4);
+}
+
+static size_t fb_string(FlatBuilder *b, const char *s)
+{
+    size_t len = strlen(s);
+    fb_prep(b, 4, len + 1);
+    fb_put(b, NULL, 1);
+    fb_put(b, s, len);
+    uint32_t n = (uint32_t)len;
+    fb_put(b, &n, 4);
+    return b->used;
+}
+
+static void fb_start_vector(FlatBuilder *b, size_t elem_size, size_t count, size_t alignment)
+{
+    fb_prep(b, 4, elem_size * count);
+    fb_prep(b, alignment, elem_size * count);
+}
+
+static size_t fb_end_vector(FlatBuilder *b, size_t count)
+{
+    uint32_t n = (uint32_t)count;
+    fb_put(b, &n, 4);
+    return b->used;
+}
+
+// 由子对象位置组成的向量
+static size_t fb_offset_vector(FlatBuilder *b, const size_t *refs, int count)
+{
+    fb_start_vector(b, 4, count, 4);
+    for (int i = count - 1; i >= 0; i--)
+    {
+        fb_offset(b, refs[i]);
+    }
+    return fb_end_vector(b, count);
+}
+
+// 由定长结构体组成的向量，结构体已按小端布局好
+static size_t fb_struct_vector(FlatBuilder *b, const void *items, size_t item_size, int count)
+{
+    fb_start_vector(b, item_size, count, 8);
+    for (int i = count - 1; i >= 0; i--)
+    {
+        fb_put(b, (const uint8_t *)items + i * item_size, item_size);
+    }
+    return fb_end_vector(b, count);
+}
+
+static void fb_start_table(FlatBuilder *b)
+{
+    memset(b->fields, 0, sizeof(b->fields));
+    b->field_count = 0;
+    b->table_start = b->used;
+}
+
+static void fb_slot(FlatBuilder *b, int id)
+{
+    b->fields[id] = b->used;
+    if (id >= b->field_count)
+    {
+        b->field_count = id + 1;
+    }
+}
+
+static void fb_add_scalar(FlatBuilder *b, int id, const void *value, size_t size)
+{
+    fb_prep(b, size, 0);
+    fb_put(b, value, size);
+    fb_slot(b, id);
+}
+
+static void fb_add_offset(FlatBuilder *b, int id, size_t ref)
+{
+    if (ref)
+    {
+        fb_offset(b, ref);
+        fb_slot(b, id);
+    }
+}
+
+static size_t fb_end_table(FlatBuilder *b)
+{
+    fb_prep(b, 4, 0);
+    fb_put(b, NULL, 4);
+    size_t object = b->used;
+
+    for (int i = b->field_count - 1; i >= 0; i--)
+    {
+        uint16_t field_offset = b->fields[i] ? (uint16_t)(object - b->fields[i]) : 0;
+        fb_put(b, &field_offset, 2);
+    }
+    uint16_t object_size = (uint16_t)(object - b->table_start);
+    uint16_t vtable_size = (uint16_t)((b->field_count + 2) * 2);
+    fb_put(b, &object_size, 2);
+    fb_put(b, &vtable_size, 2);
+
+    // 表开头的soffset指向其vtable
+    if (!b->failed)
+    {
+        int32_t soffset = (int32_t)(b->used - object);
+        memcpy(b->buf + b->cap - object, &soffset, 4);
+    }
+    return object;
+}
+
+static void fb_finish(FlatBuilder *b, size_t root)
+{
+    fb_prep(b, b->minalign > 4 ? b->minalign : 4, 4);
+    fb_offset(b, root);
+}
+
+static const uint8_t *fb_bytes(const FlatBuilder *b)
+{
+    return b->buf + b->cap - b->used;
+}
+
+static size_t build_int_type(FlatBuilder *b, int32_t bit_width)
+{
+    bool is_signed = true;
+    fb_start_table(b);
+    fb_add_scalar(b, 0, &bit_width, 4);
+    fb_add_scalar(b, 1, &is_signed, 1);
+    return fb_end_table(b);
+}
+
+static size_t build_field(FlatBuilder *b, const ArrowField *field, int64_t dictionary_id)
+{
+    size_t name = fb_string(b, field->name);
+    size_t timezone = field->type == ARROW_TIMESTAMP ? fb_string(b, "UTC") : 0;
+
+    uint8_t type_type;
+    size_t type;
+    switch (field->type)
+    {
+    case ARROW_INT32:
+    case ARROW_INT64:
+        type_type = ARROW_TYPE_INT;
+        type = build_int_type(b, field->type == ARROW_INT32 ? 32 : 64);
+        break;
+    case ARROW_FLOAT64:
+    {
+        int16_t precision = ARROW_PRECISION_DOUBLE;
+        type_type = ARROW_TYPE_FLOATING_POINT;
+        fb_start_table(b);
+        fb_add_scalar(b, 0, &precision, 2);
+        type = fb_end_table(b);
+        break;
+    }
+    case ARROW_TIMESTAMP:
+    {
+        int16_t unit = ARROW_UNIT_SECOND;
+        type_type = ARROW_TYPE_TIMESTAMP;
+        fb_start_table(b);
+        fb_add_offset(b, 1, timezone);
+        fb_add_scalar(b, 0, &unit, 2);
+        type = fb_end_table(b);
+        break;
+    }
+    default:
+        type_type = ARROW_TYPE_UTF8;
+        fb_start_table(b);
+        type = fb_end_table(b);
+        break;
+    }
+
+    size_t dictionary = 0;
+    if (field->type == ARROW_DICTIONARY)
+    {
+        size_t index_type = build_int_type(b, 32);
+        fb_start_table(b);
+        fb_add_scalar(b, 0, &dictionary_id, 8);
+        fb_add_offset(b, 1, index_type);
+        dictionary = fb_end_table(b);
+    }
+
+    fb_start_vector(b, 4, 0, 4);
+    size_t children = fb_end_vector(b, 0);
+
+    bool nullable = true;
+    fb_start_table(b);
+    fb_add_offset(b, 0, name);
+    fb_add_offset(b, 3, type);
+    fb_add_offset(b, 4, dictionary);
+    fb_add_offset(b, 5, children);
+    fb_add_scalar(b, 1, &nullable, 1);
+    fb_add_scalar(b, 2, &type_type, 1);
+    return fb_end_table(b);
+}
+
+static size_t build_schema(FlatBuilder *b, const ArrowField *fields, int field_count)
+{
+    size_t *refs = malloc((field_count + 1) * sizeof(size_t));
+    if (!refs)
+    {
+        b->failed = true;
+        return 0;
+    }
+    for (int i = 0; i < field_count; i++)
+    {
+        refs[i] = build_field(b, &fields[i], i);
+    }
+    size_t vector = fb_offset_vector(b, refs, field_count);
+    free(refs);
+
+    int16_t endianness = 0;
+    fb_start_table(b);
+    fb_add_offset(b, 1, vector);
+    fb_add_scalar(b, 0, &endianness, 2);
+    return fb_end_table(b);
+}
+
+// RecordBatch中的FieldNode和Buffer结构体
+typedef struct
+{
+    int64_t first;
+    int64_t second;
+} ArrowPair;
+
+static size_t build_record_batch(FlatBuilder *b, int64_t length, const ArrowPair *nodes, int node_count,
+                                 const ArrowPair *buffers, int buffer_count)
+{
+    size_t node_vector = fb_struct_vector(b, nodes, sizeof(ArrowPair), node_count);
+    size_t buffer_vector = fb_struct_vector(b, buffers, sizeof(ArrowPair), buffer_count);
+    fb_start_table(b);
+    fb_add_scalar(b, 0, &length, 8);
+    fb_add_offset(b, 1, node_vector);
+    fb_add_offset(b, 2, buffer_vector);
+    return fb_end_table(b);
+}
+
+static void finish_message(FlatBuilder *b, uint8_t header_type, size_t header, int64_t body_length)
+{
+    int16_t version = ARROW_METADATA_V5;
+    fb_start_table(b);
+    fb_add_scalar(b, 3, &body_length, 8);
+    fb_add_offset(b, 2, header);
+    fb_add_scalar(b, 0, &version, 2);
+    fb_add_scalar(b, 1, &header_type, 1);
+    fb_finish(b, fb_end_table(b));
+}
+
+static bool buffer_reserve(ArrowBuffer *buffer, size_t n)
+{
+    if (buffer->cap - buffer->len >= n)
+    {
+        return true;
+    }
+    size_t cap = buffer->cap ? buffer->cap * 2 : 4096;
+    while (cap - buffer->len < n)
+    {
+        cap *= 2;
+    }
+    uint8_t *data = realloc(buffer->data, cap);
+    if (!data)
+    {
+        return false;
+    }
+    buffer->data = data;
+    buffer->cap = cap;
+    return true;
+}
+
+static bool buffer_append(ArrowBuffer *buffer, const void *data, size_t n)
+{
+    if (!buffer_reserve(buffer, n))
+    {
+        return false;
+    }
+    memcpy(buffer->data + buffer->len, data, n);
+    buffer->len += n;
+    return true;
+}
+
+static void buffer_free(ArrowBuffer *buffer)
+{
+    free(buffer->data);
+    memset(buffer, 0, sizeof(ArrowBuffer));
+}
+
+static int64_t pad8(int64_t n)
+{
+    return (n + 7) & ~(int64_t)7;
+}
+
+// 消息体中的一段数据
+typedef struct
+{
+    const void *data;
+    int64_t length;
+} ArrowBodyPart;
+
+/**
+ * 写出一条封装消息：续行标记、元数据长度、元数据flatbuffer、消息体
+ */
+static bool write_message(ArrowWriter *writer, const FlatBuilder *b, const ArrowBodyPart *parts, int part_count,
+                          int64_t body_length, ArrowBlock *block)
+{
+    static const uint8_t zeros[8] = {0};
+    if (b->failed)
+    {
+        return false;
+    }
+    size_t meta_size = (size_t)(pad8(8 + (int64_t)b->used) - 8);
+    uint32_t prefix[2] = {0xFFFFFFFFu, (uint32_t)meta_size};
+
+    bool ok = fwrite(prefix, sizeof(prefix), 1, writer->fp) == 1 &&
+              fwrite(fb_bytes(b), 1, b->used, writer->fp) == b->used &&
+              fwrite(zeros, 1, meta_size - b->used, writer->fp) == meta_size - b->used;
+    for (int i = 0; ok && i < part_count; i++)
+    {
+        size_t padding = (size_t)(pad8(parts[i].length) - parts[i].length);
+        ok = (parts[i].length == 0 || fwrite(parts[i].data, 1, parts[i].length, writer->fp) == (size_t)parts[i].length) &&
+             fwrite(zeros, 1, padding, writer->fp) == padding;
+    }
+    if (!ok)
+    {
+        return false;
+    }
+
+    if (block)
+    {
+        block->offset = writer->offset;
+        block->meta_length = (int32_t)(8 + meta_size);
+        block->body_length = body_length;
+    }
+    writer->offset += 8 + (int64_t)meta_size + body_length;
+    return true;
+}
+
+/**
+ * 把各缓冲区登记为消息体的连续片段，返回消息体长度
+ */
+static int64_t layout_body(ArrowBodyPart *parts, ArrowPair *buffers, int count)
+{
+    int64_t offset = 0;
+    for (int i = 0; i < count; i++)
+    {
+        buffers[i].first = offset;
+        buffers[i].second = parts[i].length;
+        offset += pad8(parts[i].length);
+    }
+    return offset;
+}
+
+static bool write_dictionaries(ArrowWriter *writer)
+{
+    writer->dictionaries_written = true;
+    for (int f = 0; f < writer->field_count; f++)
+    {
+        ArrowColumn *column = &writer->columns[f];
+        if (column->type != ARROW_DICTIONARY)
+        {
+            continue;
+        }
+
+        ArrowBodyPart parts[3] = {
+            {NULL, 0},
+            {column->dict_offsets.data, (int64_t)column->dict_offsets.len},
+            {column->dict_data.data, (int64_t)column->dict_data.len},
+        };
+        ArrowPair buffers[3];
+        int64_t body_length = layout_body(parts, buffers, 3);
+        ArrowPair node = {column->dict_count, 0};
+
+        FlatBuilder b = {0};
+        size_t data = build_record_batch(&b, column->dict_count, &node, 1, buffers, 3);
+        int64_t id = f;
+        bool is_delta = false;
+        fb_start_table(&b);
+        fb_add_scalar(&b, 0, &id, 8);
+        fb_add_offset(&b, 1, data);
+        fb_add_scalar(&b, 2, &is_delta, 1);
+        size_t header = fb_end_table(&b);
+        finish_message(&b, ARROW_HEADER_DICTIONARY_BATCH, header, body_length);
+
+        bool ok = write_message(writer, &b, parts, 3, body_length, &writer->dictionaries[writer->dictionary_count]);
+        free(b.buf);
+        if (!ok)
+        {
+            return false;
+        }
+        writer->dictionary_count++;
+    }
+    return true;
+}
+
+static void reset_column(ArrowColumn *column)
+{
+    column->null_count = 0;
+    column->validity.len = 0;
+    column->values.len = 0;
+    column->data.len = 0;
+    if (column->type == ARROW_UTF8)
+    {
+        int32_t zero = 0;
+        buffer_append(&column->values, &zero, 4);
+    }
+}
+
+/**
+ * 写出当前记录批
+ */
+static bool flush_batch(ArrowWriter *writer)
+{
+    if (!writer->dictionaries_written && !write_dictionaries(writer))
+    {
+        return false;
+    }
+    if (writer->rows == 0)
+    {
+        return true;
+    }
+    if (writer->batch_count == writer->batch_cap)
+    {
+        int cap = writer->batch_cap ? writer->batch_cap * 2 : 16;
+        ArrowBlock *batches = realloc(writer->batches, cap * sizeof(ArrowBlock));
+        if (!batches)
+        {
+            return false;
+        }
+        writer->batches = batches;
+        writer->batch_cap = cap;
+    }
+
+    int count = writer->field_count;
+    ArrowPair *nodes = malloc(count * sizeof(ArrowPair));
+    ArrowPair *buffers = malloc(count * 3 * sizeof(ArrowPair));
+    ArrowBodyPart *parts = malloc(count * 3 * sizeof(ArrowBodyPart));
+    bool ok = nodes && buffers && parts;
+    int part_count = 0;
+    for (int f = 0; ok && f < count; f++)
+    {
+        ArrowColumn *column = &writer->columns[f];
+        nodes[f].first = writer->rows;
+        nodes[f].second = column->null_count;
+        // 没有空值时省略有效位图
+        parts[part_count].data = column->validity.data;
+        parts[part_count++].length = column->null_count ? (int64_t)(writer->rows + 7) / 8 : 0;
+        parts[part_count].data = column->values.data;
+        parts[part_count++].length = (int64_t)column->values.len;
+        if (column->type == ARROW_UTF8)
+        {
+            parts[part_count].data = column->data.data;
+            parts[part_count++].length = (int64_t)column->data.len;
+        }
+    }
+
+    if (ok)
+    {
+        int64_t body_length = layout_body(parts, buffers, part_count);
+        FlatBuilder b = {0};
+        size_t header = build_record_batch(&b, writer->rows, nodes, count, buffers, part_count);
+        finish_message(&b, ARROW_HEADER_RECORD_BATCH, header, body_length);
+        ok = write_message(writer, &b, parts, part_count, body_length, &writer->batches[writer->batch_count]);
+        free(b.buf);
+    }
+    free(nodes);
+    free(buffers);
+    free(parts);
+    if (!ok)
+    {
+        return false;
+    }
+
+    writer->batch_count++;
+    writer->rows = 0;
+    for (int f = 0; f < count; f++)
+    {
+        reset_column(&writer->columns[f]);
+    }
+    return true;
+}
+
+/**
+ * @brief 创建Arrow IPC文件并写入schema
+ *
+ * @param writer 写入器
+ * @param path 文件路径
+ * @param fields 列定义
+ * @param field_count 列数
+ * @return bool 成功返回true
+ */
+bool arrow_writer_open(ArrowWriter *writer, const char *path, const ArrowField *fields, int field_count)
+{
+    memset(writer, 0, sizeof(ArrowWriter));
+    writer->fields = fields;
+    writer->field_count = field_count;
+    writer->columns = calloc(field_count, sizeof(ArrowColumn));
+    writer->dictionaries = calloc(field_count, sizeof(ArrowBlock));
+    if (!writer->columns || !writer->dictionaries)
+    {
+        fprintf(stderr, "内存分配失败：Arrow写入器\n");
+        free(writer->columns);
+        free(writer->dictionaries);
+        return false;
+    }
+
+    bool ok = true;
+    for (int f = 0; f < field_count; f++)
+    {
+        ArrowColumn *column = &writer->columns[f];
+        column->type = fields[f].type;
+        reset_column(column);
+        if (column->type == ARROW_DICTIONARY)
+        {
+            int32_t zero = 0;
+            ok = ok && hash_map_init(&column->dictionary, 256) && buffer_append(&column->dict_offsets, &zero, 4);
+        }
+    }
+
+    writer->fp = ok ? fopen(path, "wb") : NULL;
+    if (!writer->fp)
+    {
+        fprintf(stderr, ok ? "无法创建文件: %s\n" : "内存分配失败：Arrow写入器\n", path);
+        writer->failed = true;
+        arrow_writer_close(writer);
+        return false;
+    }
+
+    FlatBuilder b = {0};
+    finish_message(&b, ARROW_HEADER_SCHEMA, build_schema(&b, fields, field_count), 0);
+    ok = fwrite(ARROW_MAGIC, sizeof(ARROW_MAGIC), 1, writer->fp) == 1;
+    writer->offset = sizeof(ARROW_MAGIC);
+    ok = ok && write_message(writer, &b, NULL, 0, 0, NULL);
+    free(b.buf);
+    if (!ok)
+    {
+        writer->failed = true;
+        arrow_writer_close(writer);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief 登记字典编码列的一个取值
+ *
+ * @param writer 写入器
+ * @param field 列序号
+ * @param value 取值
+ * @param len 取值字节数
+ * @return bool 成功返回true
+ */
+bool arrow_dictionary_add(ArrowWriter *writer, int field, const char *value, size_t len)
+{
+    ArrowColumn *column = &writer->columns[field];
+    if (writer->dictionaries_written || column->type != ARROW_DICTIONARY)
+    {
+        writer->failed = true;
+        return false;
+    }
+    if (hash_map_get(&column->dictionary, value, len))
+    {
+        return true;
+    }
+
+    int32_t end = (int32_t)(column->dict_data.len + len);
+    bool ok = hash_map_put(&column->dictionary, value, len, (void *)(uintptr_t)(column->dict_count + 1)) &&
+              buffer_append(&column->dict_data, value, len) &&
+              buffer_append(&column->dict_offsets, &end, 4);
+    if (!ok)
+    {
+        writer->failed = true;
+        return false;
+    }
+    column->dict_count++;
+    return true;
+}
+
+/**
+ * 设置当前行在有效位图中的位
+ */
+static void set_valid(ArrowWriter *writer, ArrowColumn *column, bool valid)
+{
+    size_t byte = (size_t)(writer->rows / 8);
+    if (byte >= column->validity.len)
+    {
+        uint8_t zero = 0;
+        if (!buffer_append(&column->validity, &zero, 1))
+        {
+            writer->failed = true;
+            return;
+        }
+    }
+    if (valid)
+        column->validity.data[byte] |= (uint8_t)(1u << (writer->rows % 8));
+    else
+        column->null_count++;
+}
+
+void arrow_append_null(ArrowWriter *writer, int field)
+{
+    ArrowColumn *column = &writer->columns[field];
+    set_valid(writer, column, false);
+    switch (column->type)
+    {
+    case ARROW_UTF8:
+    {
+        int32_t end = (int32_t)column->data.len;
+        writer->failed |= !buffer_append(&column->values, &end, 4);
+        break;
+    }
+    case ARROW_INT32:
+    case ARROW_DICTIONARY:
+    {
+        int32_t zero = 0;
+        writer->failed |= !buffer_append(&column->values, &zero, 4);
+        break;
+    }
+    default:
+    {
+        int64_t zero = 0;
+        writer->failed |= !buffer_append(&column->values, &zero, 8);
+        break;
+    }
+    }
+}
+
+void arrow_append_int(ArrowWriter *writer, int field, int64_t value)
+{
+    ArrowColumn *column = &writer->columns[field];
+    set_valid(writer, column, true);
+    if (column->type == ARROW_INT32)
+    {
+        int32_t narrow = (int32_t)value;
+        writer->failed |= !buffer_append(&column->values, &narrow, 4);
+    }
+    else
+    {
+        writer->failed |= !buffer_append(&column->values, &value, 8);
+    }
+}
+
+void arrow_append_double(ArrowWriter *writer, int field, double value)
+{
+    ArrowColumn *column = &writer->columns[field];
+    set_valid(writer, column, true);
+    writer->failed |= !buffer_append(&column->values, &value, 8);
+}
+
+void arrow_append_string(ArrowWriter *writer, int field, const char *value, size_t len)
+{
+    ArrowColumn *column = &writer->columns[field];
+    if (column->type == ARROW_DICTIONARY)
+    {
+        void *slot = hash_map_get(&column->dictionary, value, len);
+        if (!slot)
+        {
+            fprintf(stderr, "列%s的取值不在字典中: %.*s\n", writer->fields[field].name, (int)len, value);
+            writer->failed = true;
+            return;
+        }
+        int32_t index = (int32_t)((uintptr_t)slot - 1);
+        set_valid(writer, column, true);
+        writer->failed |= !buffer_append(&column->values, &index, 4);
+        return;
+    }
+
+    set_valid(writer, column, true);
+    int32_t end = (int32_t)(column->data.len + len);
+    writer->failed |= !buffer_append(&column->data, value, len) || !buffer_append(&column->values, &end, 4);
+}
+
+/**
+ * @brief 结束当前行
+ *
+ * @param writer 写入器
+ * @return bool 成功返回true
+ */
+bool arrow_end_row(ArrowWriter *writer)
+{
+    if (writer->failed)
+    {
+        return false;
+    }
+    writer->rows++;
+    writer->total_rows++;
+    if (writer->rows == ARROW_BATCH_ROWS && !flush_batch(writer))
+    {
+        writer->failed = true;
+    }
+    return !writer->failed;
+}
+
+/**
+ * 写出结束标记、footer和文件尾
+ */
+static bool write_footer(ArrowWriter *writer)
+{
+    // Block结构体：offset、metaDataLength（后跟4字节填充）、bodyLength
+    typedef struct
+    {
+        int64_t offset;
+        int32_t meta_length;
+        int32_t padding;
+        int64_t body_length;
+    } FooterBlock;
+
+    int block_count = writer->dictionary_count + writer->batch_count;
+    FooterBlock *blocks = calloc(block_count + 1, sizeof(FooterBlock));
+    if (!blocks)
+    {
+        return false;
+    }
+    for (int i = 0; i < block_count; i++)
+    {
+        const ArrowBlock *block = i < writer->dictionary_count ? &writer->dictionaries[i]
+                                                               : &writer->batches[i - writer->dictionary_count];
+        blocks[i].offset = block->offset;
+        blocks[i].meta_length = block->meta_length;
+        blocks[i].body_length = block->body_length;
+    }
+
+    FlatBuilder b = {0};
+    size_t schema = build_schema(&b, writer->fields, writer->field_count);
+    size_t dictionaries = fb_struct_vector(&b, blocks, sizeof(FooterBlock), writer->dictionary_count);
+    size_t batches = fb_struct_vector(&b, blocks + writer->dictionary_count, sizeof(FooterBlock), writer->batch_count);
+    free(blocks);
+    int16_t version = ARROW_METADATA_V5;
+    fb_start_table(&b);
+    fb_add_offset(&b, 1, schema);
+    fb_add_offset(&b, 2, dictionaries);
+    fb_add_offset(&b, 3, batches);
+    fb_add_scalar(&b, 0, &version, 2);
+    fb_finish(&b, fb_end_table(&b));
+
+    uint32_t end_of_stream[2] = {0xFFFFFFFFu, 0};
+    int32_t footer_size = (int32_t)b.used;
+    bool ok = !b.failed &&
+              fwrite(end_of_stream, sizeof(end_of_stream), 1, writer->fp) == 1 &&
+              fwrite(fb_bytes(&b), 1, b.used, writer->fp) == b.used &&
+              fwrite(&footer_size, 4, 1, writer->fp) == 1 &&
+              fwrite(ARROW_MAGIC, 6, 1, writer->fp) == 1;
+    writer->offset += sizeof(end_of_stream) + b.used + 4 + 6;
+    free(b.buf);
+    return ok;
+}
+
+/**
+ * @brief 写出剩余数据和footer并关闭文件
+ *
+ * @param writer 写入器
+ * @return bool 全部写入成功返回true
+ */
+bool arrow_writer_close(ArrowWriter *writer)
+{
+    bool ok = !writer->failed && writer->fp && flush_batch(writer) && write_footer(writer);
+    if (writer->fp && fclose(writer->fp) != 0)
+    {
+        ok = false;
+    }
+    writer->fp = NULL;
+
+    for (int f = 0; f < writer->field_count && writer->columns; f++)
+    {
+        ArrowColumn *column = &writer->columns[f];
+        buffer_free(&column->validity);
+        buffer_free(&column->values);
+        buffer_free(&column->data);
+        buffer_free(&column->dict_offsets);
+        buffer_free(&column->dict_data);
+        if (column->type == ARROW_DICTIONARY)
+        {
+            hash_map_free(&column->dictionary);
+        }
+    }
+    free(writer->columns);
+    free(writer->dictionaries);
+    free(writer->batches);
+    writer->columns = NULL;
+    writer->dictionaries = NULL;
+    writer->batches = NULL;
+    return ok;
+}
@@ -1,5 +1,6 @@
 #include "utils/console.h"
 #include "utils/utils.h"
+#include "utils/table.h"
 #include "db/db_query.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -114,26 +115,35 @@ void print_query_result(QueryResult *result)
         return;
     }
 
-    for (int i = 0; i < result->column_count; i++)
+    TableColumn *columns = malloc(result->column_count * sizeof(TableColumn));
+    if (!columns)
     {
-        printf("%-15s", result->column_names[i]);
+        fprintf(stderr, "内存分配失败：表格\n");
+        return;
     }
-    printf("\n");
-
     for (int i = 0; i < result->column_count; i++)
     {
-        printf("---------------");
+        columns[i].title = result->column_names[i];
+        columns[i].align = TABLE_ALIGN_LEFT;
+        columns[i].max_width = 40;
     }
-    printf("\n");
 
-    for (int i = 0; i < result->row_count; i++)
+    Table table;
+    if (table_begin(&table, columns, result->column_count, 0))
     {
-        for (int j = 0; j < result->column_count; j++)
+        const char **values = malloc(result->column_count * sizeof(char *));
+        for (int i = 0; values && i < result->row_count; i++)
         {
-            printf("%-15s", result->rows[i].values[j] ? result->rows[i].values[j] : "NULL");
+            for (int j = 0; j < result->column_count; j++)
+            {
+                values[j] = result->rows[i].values[j] ? result->rows[i].values[j] : "NULL";
+            }
+            table_add_row(&table, values);
         }
-        printf("\n");
+        free(values);
+        table_end(&table);
     }
+    free(columns);
 
     printf("\n共 %d 条记录\n", result->row_count);
 }
@@ -0,0 +1,510 @@
+#include "utils/csv.h"
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+#ifdef _WIN32
+#define strncasecmp _strnicmp
+#else
+#include <strings.h>
+#endif
+
+/**
+ * @brief 打开CSV文件
+ *
+ * @param reader 读取器
+ * @param path 文件路径
+ * @param delimiter 字段分隔符，传0表示','
+ * @return bool 成功返回true
+ */
+bool csv_reader_open(CsvReader *reader, const char *path, char delimiter)
+{
+    memset(reader, 0, sizeof(CsvReader));
+    reader->delimiter = delimiter ? delimiter : ',';
+    reader->next_line = 1;
+
+    reader->fp = fopen(path, "rb");
+    if (!reader->fp)
+    {
+        return false;
+    }
+
+    // 跳过UTF-8 BOM
+    unsigned char bom[3];
+    size_t n = fread(bom, 1, 3, reader->fp);
+    if (!(n == 3 && bom[0] == 0xEF && bom[1] == 0xBB && bom[2] == 0xBF))
+    {
+        fseek(reader->fp, 0, SEEK_SET);
+    }
+
+    return true;
+}
+
+/**
+ * @brief 追加读取一个物理行到记录缓冲区
+ *
+ * @return bool 读到数据返回true，文件结束返回false
+ */
+static bool append_line(CsvReader *reader)
+{
+    bool got = false;
+    for (;;)
+    {
+        if (reader->buf_cap - reader->buf_len < 4096)
+        {
+            size_t cap = reader->buf_cap ? reader->buf_cap * 2 : 8192;
+            char *buf = realloc(reader->buf, cap);
+            if (!buf)
+            {
+                return false;
+            }
+            reader->buf = buf;
+            reader->buf_cap = cap;
+        }
+
+        char *dest = reader->buf + reader->buf_len;
+        if (!fgets(dest, (int)(reader->buf_cap - reader->buf_len), reader->fp))
+        {
+            return got;
+        }
+        got = true;
+
+        size_t len = strlen(dest);
+        reader->buf_len += len;
+        if (len > 0 && dest[len - 1] == '\n')
+        {
+            reader->next_line++;
+            return true;
+        }
+    }
+}
+
+/**
+ * @brief 读取下一条记录
+ *
+ * 引号内的换行视为字段内容，记录可跨越多个物理行。解析在缓冲区内原地进行，
+ * 字段指针在下一次调用前有效。
+ *
+ * @param reader 读取器
+ * @return int 字段数；0表示文件结束，-1表示内存不足
+ */
+int csv_read_record(CsvReader *reader)
+{
+    reader->buf_len = 0;
+    reader->field_count = 0;
+    reader->line_no = reader->next_line;
+
+    if (!append_line(reader))
+    {
+        return 0;
+    }
+
+    // 引号未闭合时继续读取下一行
+    for (;;)
+    {
+        int quotes = 0;
+        for (size_t i = 0; i < reader->buf_len; i++)
+        {
+            quotes += reader->buf[i] == '"';
+        }
+        if (quotes % 2 == 0 || !append_line(reader))
+        {
+            break;
+        }
+    }
+
+    // 去掉行尾换行
+    while (reader->buf_len > 0 &&
+           (reader->buf[reader->buf_len - 1] == '\n' || reader->buf[reader->buf_len - 1] == '\r'))
+    {
+        reader->buf_len--;
+    }
+    reader->buf[reader->buf_len] = '\0';
+
+    char *read = reader->buf;
+    char *end = reader->buf + reader->buf_len;
+    for (;;)
+    {
+        if (reader->field_count == reader->field_cap)
+        {
+            int cap = reader->field_cap ? reader->field_cap * 2 : 16;
+            char **fields = realloc(reader->fields, cap * sizeof(char *));
+            if (!fields)
+            {
+                return -1;
+            }
+            reader->fields = fields;
+            reader->field_cap = cap;
+        }
+
+        char *field = read;
+        char *write = read;
+        bool quoted = false;
+
+        if (read < end && *read == '"')
+        {
+            quoted = true;
+            read++;
+        }
+
+        while (read < end)
+        {
+            if (quoted)
+            {
+                if (*read == '"')
+                {
+                    if (read + 1 < end && read[1] == '"')
+                    {
+                        *write++ = '"';
+                        read += 2;
+                        continue;
+                    }
+                    quoted = false;
+                    read++;
+                    continue;
+                }
+                *write++ = *read++;
+            }
+            else
+            {
+                if (*read == reader->delimiter)
+                {
+                    break;
+                }
+                *write++ = *read++;
+            }
+        }
+
+        bool more = read < end;
+        *write = '\0';
+        reader->fields[reader->field_count++] = field;
+
+        if (!more)
+        {
+            break;
+        }
+        read++; // 跳过分隔符
+    }
+
+    reader->record_no++;
+    return reader->field_count;
+}
+
+/**
+ * @brief 关闭读取器并释放缓冲区
+ *
+ * @param reader 读取器
+ */
+void csv_reader_close(CsvReader *reader)
+{
+    if (reader->fp)
+    {
+        fclose(reader->fp);
+    }
+    free(reader->buf);
+    free(reader->fields);
+    memset(reader, 0, sizeof(CsvReader));
+}
+
+/**
+ * @brief 比较表头名称，忽略大小写和首尾空白
+ */
+static bool header_equals(const char *header, const char *name)
+{
+    while (isspace((unsigned char)*header))
+    {
+        header++;
+    }
+    size_t len = strlen(header);
+    while (len > 0 && isspace((unsigned char)header[len - 1]))
+    {
+        len--;
+    }
+    return strlen(name) == len && strncasecmp(header, name, len) == 0;
+}
+
+/**
+ * @brief 按表头名称查找列序号
+ *
+ * 须在读取表头记录后调用
+ *
+ * @param reader 读取器
+ * @param candidates 候选列名，以NULL结尾
+ * @return int 列序号，未找到返回-1
+ */
+int csv_find_column(const CsvReader *reader, const char *const *candidates)
+{
+    for (int c = 0; candidates[c]; c++)
+    {
+        for (int i = 0; i < reader->field_count; i++)
+        {
+            if (header_equals(reader->fields[i], candidates[c]))
+            {
+                return i;
+            }
+        }
+    }
+    return -1;
+}
+
+#define CSV_GZIP_WINDOW_BITS (15 + 16) // 15位窗口，加16表示写gzip头尾
+
+/**
+ * 把缓冲区写到文件，gzip时先送入压缩器；finish为true时结束压缩流
+ */
+static void writer_flush(CsvWriter *writer, bool finish)
+{
+    if (writer->failed)
+    {
+        writer->buf_len = 0;
+        return;
+    }
+
+    if (!writer->zstream)
+    {
+        if (writer->buf_len > 0 && fwrite(writer->buf, 1, writer->buf_len, writer->fp) != writer->buf_len)
+        {
+            writer->failed = true;
+        }
+        writer->buf_len = 0;
+        return;
+    }
+
+    z_stream *zs = writer->zstream;
+    zs->next_in = (Bytef *)writer->buf;
+    zs->avail_in = (uInt)writer->buf_len;
+    int mode = finish ? Z_FINISH : Z_NO_FLUSH;
+    int rc;
+    do
+    {
+        zs->next_out = writer->zbuf;
+        zs->avail_out = CSV_WRITER_BUFFER_SIZE;
+        rc = deflate(zs, mode);
+        if (rc == Z_STREAM_ERROR)
+        {
+            writer->failed = true;
+            break;
+        }
+        size_t have = CSV_WRITER_BUFFER_SIZE - zs->avail_out;
+        if (have > 0 && fwrite(writer->zbuf, 1, have, writer->fp) != have)
+        {
+            writer->failed = true;
+            break;
+        }
+    } while (zs->avail_out == 0 || (finish && rc != Z_STREAM_END));
+    writer->buf_len = 0;
+}
+
+/**
+ * 保证缓冲区还能放下need字节，放不下时先写出，单个字段超过缓冲区时扩容
+ */
+static bool writer_reserve(CsvWriter *writer, size_t need)
+{
+    if (writer->buf_len + need <= writer->buf_cap)
+    {
+        return true;
+    }
+    writer_flush(writer, false);
+    if (need <= writer->buf_cap)
+    {
+        return true;
+    }
+    char *grown = realloc(writer->buf, need);
+    if (!grown)
+    {
+        writer->failed = true;
+        return false;
+    }
+    writer->buf = grown;
+    writer->buf_cap = need;
+    return true;
+}
+
+/**
+ * @brief 在已打开的流上创建写入器
+ *
+ * @param writer 写入器
+ * @param fp 输出流
+ * @param delimiter 字段分隔符，传0表示','
+ * @param flags CSV_WRITE_BOM、CSV_WRITE_GZIP、CSV_WRITE_LF的组合
+ * @return bool 成功返回true
+ */
+bool csv_writer_attach(CsvWriter *writer, FILE *fp, char delimiter, int flags)
+{
+    memset(writer, 0, sizeof(CsvWriter));
+    writer->fp = fp;
+    writer->delimiter = delimiter ? delimiter : ',';
+    writer->lf_only = (flags & CSV_WRITE_LF) != 0;
+    writer->buf_cap = CSV_WRITER_BUFFER_SIZE;
+    writer->buf = malloc(writer->buf_cap);
+    if (!writer->buf)
+    {
+        return false;
+    }
+
+    if (flags & CSV_WRITE_GZIP)
+    {
+        z_stream *zs = calloc(1, sizeof(z_stream));
+        writer->zbuf = malloc(CSV_WRITER_BUFFER_SIZE);
+        if (!zs || !writer->zbuf ||
+            deflateInit2(zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, CSV_GZIP_WINDOW_BITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        {
+            free(zs);
+            free(writer->zbuf);
+            free(writer->buf);
+            return false;
+        }
+        writer->zstream = zs;
+    }
+
+    if (flags & CSV_WRITE_BOM)
+    {
+        memcpy(writer->buf, "\xEF\xBB\xBF", 3);
+        writer->buf_len = 3;
+    }
+    return true;
+}
+
+/**
+ * @brief 创建文件并在其上创建写入器
+ *
+ * @param writer 写入器
+ * @param path 文件路径
+ * @param delimiter 字段分隔符，传0表示','
+ * @param flags CSV_WRITE_BOM、CSV_WRITE_GZIP、CSV_WRITE_LF的组合
+ * @return bool 成功返回true
+ */
+bool csv_writer_open(CsvWriter *writer, const char *path, char delimiter, int flags)
+{
+    FILE *fp = fopen(path, "wb");
+    if (!fp)
+    {
+        return false;
+    }
+    if (!csv_writer_attach(writer, fp, delimiter, flags))
+    {
+        fclose(fp);
+        return false;
+    }
+    writer->owns_fp = true;
+    return true;
+}
+
+/**
+ * @brief 写一个已知长度的字段
+ *
+ * 含分隔符、双引号或换行的字段用双引号括起，内部双引号写两次
+ *
+ * @param writer 写入器
+ * @param value 字段值，NULL写为空字段
+ * @param len 字段长度
+ */
+void csv_write_field_len(CsvWriter *writer, const char *value, size_t len)
+{
+    if (!value)
+    {
+        len = 0;
+    }
+
+    bool quote = false;
+    size_t quotes = 0;
+    for (size_t i = 0; i < len; i++)
+    {
+        char c = value[i];
+        if (c == '"')
+        {
+            quotes++;
+            quote = true;
+        }
+        else if (c == writer->delimiter || c == '\n' || c == '\r')
+        {
+            quote = true;
+        }
+    }
+
+    if (!writer_reserve(writer, len + quotes + 3))
+    {
+        return;
+    }
+    char *out = writer->buf + writer->buf_len;
+    if (writer->record_started)
+    {
+        *out++ = writer->delimiter;
+    }
+    if (!quote)
+    {
+        memcpy(out, value, len);
+        out += len;
+    }
+    else
+    {
+        *out++ = '"';
+        for (size_t i = 0; i < len; i++)
+        {
+            if (value[i] == '"')
+                *out++ = '"';
+            *out++ = value[i];
+        }
+        *out++ = '"';
+    }
+    writer->buf_len = out - writer->buf;
+    writer->record_started = true;
+}
+
+/**
+ * @brief 写一个字段
+ *
+ * @param writer 写入器
+ * @param value 字段值，NULL写为空字段
+ */
+void csv_write_field(CsvWriter *writer, const char *value)
+{
+    csv_write_field_len(writer, value, value ? strlen(value) : 0);
+}
+
+/**
+ * @brief 结束当前记录（RFC 4180的记录以CRLF结尾）
+ *
+ * @param writer 写入器
+ */
+void csv_end_record(CsvWriter *writer)
+{
+    if (writer_reserve(writer, 2))
+    {
+        if (!writer->lf_only)
+            writer->buf[writer->buf_len++] = '\r';
+        writer->buf[writer->buf_len++] = '\n';
+    }
+    writer->record_started = false;
+    writer->record_count++;
+}
+
+/**
+ * @brief 写出剩余数据并释放写入器
+ *
+ * @param writer 写入器
+ * @return bool 全部数据写入成功返回true
+ */
+bool csv_writer_close(CsvWriter *writer)
+{
+    writer_flush(writer, true);
+    if (writer->zstream)
+    {
+        deflateEnd(writer->zstream);
+        free(writer->zstream);
+    }
+    if (fflush(writer->fp) != 0)
+    {
+        writer->failed = true;
+    }
+    if (writer->owns_fp && fclose(writer->fp) != 0)
+    {
+        writer->failed = true;
+    }
+    free(writer->buf);
+    free(writer->zbuf);
+    bool ok = !writer->failed;
+    memset(writer, 0, sizeof(CsvWriter));
+    return ok;
+}
@@ -0,0 +1,212 @@
+#include "utils/export.h"
+#include "utils/csv.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#define strcasecmp _stricmp
+#define strtok_r strtok_s
+#else
+#include <strings.h>
+#endif
+
+/**
+ * 判断path是否以suffix结尾（忽略大小写）
+ */
+static bool ends_with(const char *path, const char *suffix)
+{
+    size_t len = strlen(path), n = strlen(suffix);
+    return len >= n && strcasecmp(path + len - n, suffix) == 0;
+}
+
+/**
+ * @brief 按文件名设置导出选项
+ *
+ * @param options 导出选项，columns置为NULL
+ * @param path 文件名
+ */
+void export_options_for_path(ExportOptions *options, const char *path)
+{
+    memset(options, 0, sizeof(ExportOptions));
+    options->gzip = ends_with(path, ".gz");
+    bool tsv = ends_with(path, options->gzip ? ".tsv.gz" : ".tsv");
+    options->delimiter = tsv ? '\t' : ',';
+    options->bom = !tsv;
+}
+
+/**
+ * 把columns中的列名解析为语句中的列序号，返回列数，列名不存在时返回-1
+ */
+static int resolve_columns(sqlite3_stmt *stmt, const char *columns, int *indexes)
+{
+    int total = sqlite3_column_count(stmt);
+    if (!columns || !*columns)
+    {
+        for (int i = 0; i < total; i++)
+        {
+            indexes[i] = i;
+        }
+        return total;
+    }
+
+    char *list = strdup(columns);
+    if (!list)
+    {
+        return -1;
+    }
+    int count = 0;
+    char *save = NULL;
+    for (char *name = strtok_r(list, ",", &save); name; name = strtok_r(NULL, ",", &save))
+    {
+        while (*name == ' ')
+            name++;
+        for (char *end = name + strlen(name); end > name && end[-1] == ' '; end--)
+            end[-1] = '\0';
+
+        int found = -1;
+        for (int i = 0; i < total && found < 0; i++)
+        {
+            if (strcasecmp(sqlite3_column_name(stmt, i), name) == 0)
+                found = i;
+        }
+        if (found < 0 || count == total)
+        {
+            fprintf(stderr, found < 0 ? "导出列不存在: %s\n" : "导出列过多: %s\n", name);
+            free(list);
+            return -1;
+        }
+        indexes[count++] = found;
+    }
+    free(list);
+    return count;
+}
+
+/**
+ * 准备语句并逐行写到writer，结束后关闭writer
+ */
+static bool export_with_writer(Database *db, const char *sql, void (*bind_params)(sqlite3_stmt *, void *),
+                               void *params, CsvWriter *writer, const ExportOptions *options, long *rows)
+{
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(db->db, sql, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "准备导出查询失败: %s\n", sqlite3_errmsg(db->db));
+        csv_writer_close(writer);
+        return false;
+    }
+    if (bind_params)
+    {
+        bind_params(stmt, params);
+    }
+
+    int *indexes = malloc((sqlite3_column_count(stmt) + 1) * sizeof(int));
+    int count = indexes ? resolve_columns(stmt, options->columns, indexes) : -1;
+    if (count < 0)
+    {
+        free(indexes);
+        sqlite3_finalize(stmt);
+        csv_writer_close(writer);
+        return false;
+    }
+
+    for (int c = 0; c < count; c++)
+    {
+        csv_write_field(writer, sqlite3_column_name(stmt, indexes[c]));
+    }
+    csv_end_record(writer);
+
+    long written = 0;
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW && !writer->failed)
+    {
+        for (int c = 0; c < count; c++)
+        {
+            const char *text = (const char *)sqlite3_column_text(stmt, indexes[c]);
+            csv_write_field_len(writer, text, text ? (size_t)sqlite3_column_bytes(stmt, indexes[c]) : 0);
+        }
+        csv_end_record(writer);
+        written++;
+    }
+    if (rc != SQLITE_DONE && rc != SQLITE_ROW)
+    {
+        fprintf(stderr, "导出查询失败: %s\n", sqlite3_errmsg(db->db));
+    }
+    free(indexes);
+    sqlite3_finalize(stmt);
+
+    bool written_ok = csv_writer_close(writer);
+    if (!written_ok)
+    {
+        fprintf(stderr, "写入导出文件失败\n");
+    }
+    if (rows)
+    {
+        *rows = written;
+    }
+    return written_ok && rc == SQLITE_DONE;
+}
+
+static int writer_flags(const ExportOptions *options)
+{
+    return (options->bom ? CSV_WRITE_BOM : 0) | (options->gzip ? CSV_WRITE_GZIP : 0);
+}
+
+/**
+ * @brief 把查询结果流式导出到文件
+ *
+ * @param db 数据库连接
+ * @param sql 查询语句
+ * @param bind_params 绑定参数的回调，可为NULL
+ * @param params 传给bind_params的参数
+ * @param path 文件路径
+ * @param options 导出选项，NULL表示按文件名确定
+ * @param rows 输出导出的数据行数，可为NULL
+ * @return bool 成功返回true
+ */
+bool export_query(Database *db, const char *sql, void (*bind_params)(sqlite3_stmt *, void *), void *params,
+                  const char *path, const ExportOptions *options, long *rows)
+{
+    ExportOptions by_path;
+    if (!options)
+    {
+        export_options_for_path(&by_path, path);
+        options = &by_path;
+    }
+
+    CsvWriter writer;
+    if (!csv_writer_open(&writer, path, options->delimiter, writer_flags(options)))
+    {
+        fprintf(stderr, "无法创建导出文件: %s\n", path);
+        return false;
+    }
+    bool ok = export_with_writer(db, sql, bind_params, params, &writer, options, rows);
+    if (!ok)
+    {
+        remove(path);
+    }
+    return ok;
+}
+
+/**
+ * @brief 把查询结果流式导出到已打开的流
+ *
+ * @param db 数据库连接
+ * @param sql 查询语句
+ * @param bind_params 绑定参数的回调，可为NULL
+ * @param params 传给bind_params的参数
+ * @param fp 输出流
+ * @param options 导出选项
+ * @param rows 输出导出的数据行数，可为NULL
+ * @return bool 成功返回true
+ */
+bool export_query_to(Database *db, const char *sql, void (*bind_params)(sqlite3_stmt *, void *), void *params,
+                     FILE *fp, const ExportOptions *options, long *rows)
+{
+    CsvWriter writer;
+    if (!csv_writer_attach(&writer, fp, options->delimiter, writer_flags(options)))
+    {
+        fprintf(stderr, "内存分配失败：导出\n");
+        return false;
+    }
+    return export_with_writer(db, sql, bind_params, params, &writer, options, rows);
+}
@@ -0,0 +1,228 @@
+#include "utils/hash_map.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HASH_KEY_BLOCK_SIZE (64 * 1024)
+
+/**
+ * @brief 计算字节串哈希值（FNV-1a）
+ *
+ * @param data 数据
+ * @param len 长度
+ * @return uint64_t 哈希值
+ */
+uint64_t hash_bytes(const void *data, size_t len)
+{
+    const unsigned char *p = (const unsigned char *)data;
+    uint64_t hash = 1469598103934665603ULL;
+    for (size_t i = 0; i < len; i++)
+    {
+        hash ^= p[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/**
+ * @brief 初始化哈希表
+ *
+ * @param map 哈希表
+ * @param expected 预计条目数，用于预分配槽位避免扩容
+ * @return bool 成功返回true
+ */
+bool hash_map_init(HashMap *map, size_t expected)
+{
+    memset(map, 0, sizeof(HashMap));
+
+    // 负载因子不超过1/2
+    size_t capacity = 16;
+    while (capacity < expected * 2)
+    {
+        capacity <<= 1;
+    }
+
+    map->entries = calloc(capacity, sizeof(HashEntry));
+    if (!map->entries)
+    {
+        fprintf(stderr, "内存分配失败：哈希表\n");
+        return false;
+    }
+    map->capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief 将键复制到键存储区
+ */
+static const char *store_key(HashMap *map, const void *key, size_t key_len)
+{
+    size_t need = key_len + 1;
+    if (!map->keys || map->keys->size - map->keys->used < need)
+    {
+        size_t size = need > HASH_KEY_BLOCK_SIZE ? need : HASH_KEY_BLOCK_SIZE;
+        HashKeyBlock *block = malloc(sizeof(HashKeyBlock) + size);
+        if (!block)
+        {
+            return NULL;
+        }
+        block->next = map->keys;
+        block->used = 0;
+        block->size = size;
+        map->keys = block;
+    }
+
+    char *dest = map->keys->data + map->keys->used;
+    memcpy(dest, key, key_len);
+    dest[key_len] = '\0';
+    map->keys->used += need;
+    return dest;
+}
+
+/**
+ * @brief 查找键所在槽位（线性探测），返回空槽位表示不存在
+ */
+static HashEntry *find_slot(HashEntry *entries, size_t capacity, const void *key, size_t key_len, uint64_t hash)
+{
+    size_t mask = capacity - 1;
+    size_t i = (size_t)hash & mask;
+    while (entries[i].key)
+    {
+        if (entries[i].hash == hash && entries[i].key_len == key_len &&
+            memcmp(entries[i].key, key, key_len) == 0)
+        {
+            break;
+        }
+        i = (i + 1) & mask;
+    }
+    return &entries[i];
+}
+
+/**
+ * @brief 扩容为原来的两倍
+ */
+static bool grow(HashMap *map)
+{
+    size_t capacity = map->capacity * 2;
+    HashEntry *entries = calloc(capacity, sizeof(HashEntry));
+    if (!entries)
+    {
+        fprintf(stderr, "内存分配失败：哈希表扩容\n");
+        return false;
+    }
+
+    for (size_t i = 0; i < map->capacity; i++)
+    {
+        HashEntry *old = &map->entries[i];
+        if (old->key)
+        {
+            *find_slot(entries, capacity, old->key, old->key_len, old->hash) = *old;
+        }
+    }
+
+    free(map->entries);
+    map->entries = entries;
+    map->capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief 查找键，返回值槽位指针
+ *
+ * 便于调用者原地修改值（如累加计数）而无需二次查找
+ *
+ * @return void** 值槽位指针，不存在返回NULL
+ */
+void **hash_map_lookup(const HashMap *map, const void *key, size_t key_len)
+{
+    if (!map->entries)
+    {
+        return NULL;
+    }
+    HashEntry *entry = find_slot(map->entries, map->capacity, key, key_len, hash_bytes(key, key_len));
+    return entry->key ? &entry->value : NULL;
+}
+
+/**
+ * @brief 查找键
+ *
+ * @return void* 对应的值，不存在返回NULL
+ */
+void *hash_map_get(const HashMap *map, const void *key, size_t key_len)
+{
+    void **value = hash_map_lookup(map, key, key_len);
+    return value ? *value : NULL;
+}
+
+/**
+ * @brief 插入或覆盖键值
+ *
+ * @param map 哈希表
+ * @param key 键
+ * @param key_len 键长度
+ * @param value 值
+ * @return bool 成功返回true，内存不足返回false
+ */
+bool hash_map_put(HashMap *map, const void *key, size_t key_len, void *value)
+{
+    if ((map->count + 1) * 2 > map->capacity && !grow(map))
+    {
+        return false;
+    }
+
+    uint64_t hash = hash_bytes(key, key_len);
+    HashEntry *entry = find_slot(map->entries, map->capacity, key, key_len, hash);
+    if (!entry->key)
+    {
+        const char *stored = store_key(map, key, key_len);
+        if (!stored)
+        {
+            fprintf(stderr, "内存分配失败：哈希表键\n");
+            return false;
+        }
+        entry->key = stored;
+        entry->key_len = key_len;
+        entry->hash = hash;
+        map->count++;
+    }
+    entry->value = value;
+    return true;
+}
+
+/**
+ * @brief 遍历哈希表
+ *
+ * 用法：size_t i = 0; HashEntry *e; while ((e = hash_map_next(map, &i))) {...}
+ *
+ * @return HashEntry* 下一个条目，遍历结束返回NULL
+ */
+HashEntry *hash_map_next(const HashMap *map, size_t *index)
+{
+    while (*index < map->capacity)
+    {
+        HashEntry *entry = &map->entries[(*index)++];
+        if (entry->key)
+        {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief 释放哈希表，值由调用者负责释放
+ *
+ * @param map 哈希表
+ */
+void hash_map_free(HashMap *map)
+{
+    free(map->entries);
+    HashKeyBlock *block = map->keys;
+    while (block)
+    {
+        HashKeyBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    memset(map, 0, sizeof(HashMap));
+}
@@ -0,0 +1,564 @@
+#include "utils/pager.h"
+#include "utils/console.h"
+#include "utils/utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#ifdef _WIN32
+#include <conio.h>
+#endif
+
+#define PAGER_RESERVED_ROWS 8 // 每屏留给标题、表头、状态和按键提示的行数
+
+typedef enum
+{
+    PAGER_KEY_NONE,
+    PAGER_KEY_NEXT,
+    PAGER_KEY_PREV,
+    PAGER_KEY_HOME,
+    PAGER_KEY_END,
+    PAGER_KEY_SEARCH,
+    PAGER_KEY_AGAIN,
+    PAGER_KEY_QUIT
+} PagerKey;
+
+typedef struct
+{
+    Database *db;
+    const PagerQuery *query;
+    char *key_names[PAGER_MAX_KEYS]; // 加引号的键集列名
+    char *search_clause;             // 在各显示列中查找:search的条件
+    int page_rows;
+    long total;
+    char **cells;          // 当前页单元格，page_rows * column_count
+    sqlite3_value **keys;  // 当前页各行键值，page_rows * key_count
+    int rows;              // 当前页行数
+} Pager;
+
+/**
+ * 给列名加双引号，内部的双引号加倍
+ */
+static char *quote_name(const char *name)
+{
+    char *quoted = malloc(strlen(name) * 2 + 3);
+    if (!quoted)
+    {
+        return NULL;
+    }
+    char *p = quoted;
+    *p++ = '"';
+    for (; *name; name++)
+    {
+        if (*name == '"')
+            *p++ = '"';
+        *p++ = *name;
+    }
+    *p++ = '"';
+    *p = '\0';
+    return quoted;
+}
+
+static void pager_clear_page(Pager *pager)
+{
+    const PagerQuery *query = pager->query;
+    for (int i = 0; i < pager->rows * query->column_count; i++)
+    {
+        free(pager->cells[i]);
+    }
+    for (int i = 0; i < pager->rows * query->key_count; i++)
+    {
+        sqlite3_value_free(pager->keys[i]);
+    }
+    pager->rows = 0;
+}
+
+static void pager_free(Pager *pager)
+{
+    if (pager->cells)
+    {
+        pager_clear_page(pager);
+    }
+    for (int k = 0; k < PAGER_MAX_KEYS; k++)
+    {
+        free(pager->key_names[k]);
+    }
+    free(pager->search_clause);
+    free(pager->cells);
+    free(pager->keys);
+}
+
+/**
+ * 准备基础查询读取列名，生成键集列名和搜索条件，并统计总行数
+ */
+static bool pager_init(Pager *pager, Database *db, const PagerQuery *query)
+{
+    memset(pager, 0, sizeof(Pager));
+    pager->db = db;
+    pager->query = query;
+
+    if (query->key_count < 1 || query->key_count > PAGER_MAX_KEYS)
+    {
+        fprintf(stderr, "分页查询的键集列数无效: %d\n", query->key_count);
+        return false;
+    }
+
+    sqlite3_stmt *stmt;
+    if (sqlite3_prepare_v2(db->db, query->sql, -1, &stmt, NULL) != SQLITE_OK)
+    {
+        fprintf(stderr, "准备分页查询失败: %s\n", sqlite3_errmsg(db->db));
+        return false;
+    }
+    if (sqlite3_column_count(stmt) != query->column_count + query->key_count)
+    {
+        fprintf(stderr, "分页查询的列数与定义不符\n");
+        sqlite3_finalize(stmt);
+        return false;
+    }
+
+    size_t clause_size = 3;
+    for (int c = 0; c < query->column_count; c++)
+    {
+        clause_size += strlen(sqlite3_column_name(stmt, c)) * 2 + 32;
+    }
+    pager->search_clause = malloc(clause_size);
+    bool ok = pager->search_clause != NULL;
+    if (ok)
+    {
+        size_t len = 0;
+        pager->search_clause[len++] = '(';
+        for (int c = 0; ok && c < query->column_count; c++)
+        {
+            char *name = quote_name(sqlite3_column_name(stmt, c));
+            ok = name != NULL;
+            if (ok)
+            {
+                len += snprintf(pager->search_clause + len, clause_size - len, "%sinstr(%s, :search) > 0",
+                                c > 0 ? " OR " : "", name);
+            }
+            free(name);
+        }
+        snprintf(pager->search_clause + len, clause_size - len, ")");
+    }
+    for (int k = 0; ok && k < query->key_count; k++)
+    {
+        pager->key_names[k] = quote_name(sqlite3_column_name(stmt, query->column_count + k));
+        ok = pager->key_names[k] != NULL;
+    }
+    sqlite3_finalize(stmt);
+    if (!ok)
+    {
+        fprintf(stderr, "内存分配失败：分页\n");
+        return false;
+    }
+
+    size_t size = strlen(query->sql) + 64;
+    char *sql = malloc(size);
+    if (!sql)
+    {
+        fprintf(stderr, "内存分配失败：分页\n");
+        return false;
+    }
+    snprintf(sql, size, "SELECT COUNT(*) FROM (%s)", query->sql);
+    if (sqlite3_prepare_v2(db->db, sql, -1, &stmt, NULL) == SQLITE_OK)
+    {
+        if (query->bind_params)
+        {
+            query->bind_params(stmt, query->params);
+        }
+        if (sqlite3_step(stmt) == SQLITE_ROW)
+        {
+            pager->total = sqlite3_column_int64(stmt, 0);
+        }
+        sqlite3_finalize(stmt);
+    }
+    free(sql);
+    return true;
+}
+
+/**
+ * 准备一次取数的查询。anchor为起点键值，NULL表示从头开始；inclusive表示包含起点；
+ * ascending为按键集升序取；search非NULL时只取包含该文本的行；limit为-1时不限行数
+ */
+static sqlite3_stmt *pager_prepare(Pager *pager, sqlite3_value **anchor, bool inclusive, bool ascending,
+                                   const char *search, int limit)
+{
+    const PagerQuery *query = pager->query;
+    size_t size = strlen(query->sql) + strlen(pager->search_clause) + 256;
+    for (int k = 0; k < query->key_count; k++)
+    {
+        size += strlen(pager->key_names[k]) * 2 + 16;
+    }
+    char *sql = malloc(size);
+    if (!sql)
+    {
+        fprintf(stderr, "内存分配失败：分页\n");
+        return NULL;
+    }
+
+    size_t len = snprintf(sql, size, "SELECT * FROM (%s) WHERE 1", query->sql);
+    if (anchor)
+    {
+        len += snprintf(sql + len, size - len, " AND (");
+        for (int k = 0; k < query->key_count; k++)
+        {
+            len += snprintf(sql + len, size - len, "%s%s", k > 0 ? ", " : "", pager->key_names[k]);
+        }
+        len += snprintf(sql + len, size - len, ") %s%s (", ascending ? ">" : "<", inclusive ? "=" : "");
+        for (int k = 0; k < query->key_count; k++)
+        {
+            len += snprintf(sql + len, size - len, "%s:key%d", k > 0 ? ", " : "", k);
+        }
+        len += snprintf(sql + len, size - len, ")");
+    }
+    if (search)
+    {
+        len += snprintf(sql + len, size - len, " AND %s", pager->search_clause);
+    }
+    len += snprintf(sql + len, size - len, " ORDER BY ");
+    for (int k = 0; k < query->key_count; k++)
+    {
+        len += snprintf(sql + len, size - len, "%s%s%s", k > 0 ? ", " : "", pager->key_names[k],
+                        ascending ? "" : " DESC");
+    }
+    snprintf(sql + len, size - len, " LIMIT :limit");
+
+    sqlite3_stmt *stmt;
+    int rc = sqlite3_prepare_v2(pager->db->db, sql, -1, &stmt, NULL);
+    free(sql);
+    if (rc != SQLITE_OK)
+    {
+        fprintf(stderr, "准备分页查询失败: %s\n", sqlite3_errmsg(pager->db->db));
+        return NULL;
+    }
+
+    if (query->bind_params)
+    {
+        query->bind_params(stmt, query->params);
+    }
+    for (int k = 0; anchor && k < query->key_count; k++)
+    {
+        char name[16];
+        snprintf(name, sizeof(name), ":key%d", k);
+        sqlite3_bind_value(stmt, sqlite3_bind_parameter_index(stmt, name), anchor[k]);
+    }
+    if (search)
+    {
+        sqlite3_bind_text(stmt, sqlite3_bind_parameter_index(stmt, ":search"), search, -1, SQLITE_TRANSIENT);
+    }
+    sqlite3_bind_int(stmt, sqlite3_bind_parameter_index(stmt, ":limit"), limit);
+    return stmt;
+}
+
+/**
+ * 取一页替换当前页。reverse表示逆着浏览方向取（上一页、末页），取回后倒序排列；
+ * 没有取到行时保留当前页。返回取到的行数，失败返回-1
+ */
+static int pager_fetch(Pager *pager, sqlite3_value **anchor, bool inclusive, bool reverse, const char *search,
+                       int limit)
+{
+    const PagerQuery *query = pager->query;
+    sqlite3_stmt *stmt = pager_prepare(pager, anchor, inclusive, query->descending == reverse, search, limit);
+    if (!stmt)
+    {
+        return -1;
+    }
+
+    int cc = query->column_count, kc = query->key_count;
+    char **cells = calloc((size_t)limit * cc, sizeof(char *));
+    sqlite3_value **keys = calloc((size_t)limit * kc, sizeof(sqlite3_value *));
+    int rows = 0;
+    int rc = SQLITE_NOMEM;
+    while (cells && keys && (rc = sqlite3_step(stmt)) == SQLITE_ROW)
+    {
+        for (int c = 0; c < cc; c++)
+        {
+            const char *text = (const char *)sqlite3_column_text(stmt, c);
+            cells[rows * cc + c] = strdup(text ? text : "");
+        }
+        for (int k = 0; k < kc; k++)
+        {
+            keys[rows * kc + k] = sqlite3_value_dup(sqlite3_column_value(stmt, cc + k));
+        }
+        rows++;
+    }
+    sqlite3_finalize(stmt);
+
+    if (rc != SQLITE_DONE || rows == 0)
+    {
+        if (rc != SQLITE_DONE)
+            fprintf(stderr, "分页查询失败: %s\n", sqlite3_errmsg(pager->db->db));
+        for (int i = 0; cells && keys && i < rows * cc; i++)
+            free(cells[i]);
+        for (int i = 0; cells && keys && i < rows * kc; i++)
+            sqlite3_value_free(keys[i]);
+        free(cells);
+        free(keys);
+        return rc == SQLITE_DONE ? 0 : -1;
+    }
+
+    if (reverse)
+    {
+        for (int lo = 0, hi = rows - 1; lo < hi; lo++, hi--)
+        {
+            for (int c = 0; c < cc; c++)
+            {
+                char *cell = cells[lo * cc + c];
+                cells[lo * cc + c] = cells[hi * cc + c];
+                cells[hi * cc + c] = cell;
+            }
+            for (int k = 0; k < kc; k++)
+            {
+                sqlite3_value *key = keys[lo * kc + k];
+                keys[lo * kc + k] = keys[hi * kc + k];
+                keys[hi * kc + k] = key;
+            }
+        }
+    }
+
+    pager_clear_page(pager);
+    free(pager->cells);
+    free(pager->keys);
+    pager->cells = cells;
+    pager->keys = keys;
+    pager->rows = rows;
+    return rows;
+}
+
+/**
+ * 查找当前页首行之后第一个包含text的行，找不到时从头查找，找到后以该行为首行翻页
+ */
+static bool pager_search(Pager *pager, const char *text)
+{
+    sqlite3_value **anchor = pager->rows > 0 ? pager->keys : NULL;
+    int found = pager_fetch(pager, anchor, false, false, text, 1);
+    if (found == 0 && anchor)
+    {
+        found = pager_fetch(pager, NULL, false, false, text, 1);
+    }
+    if (found <= 0)
+    {
+        return false;
+    }
+    return pager_fetch(pager, pager->keys, true, false, NULL, pager->page_rows) > 0;
+}
+
+static PagerKey pager_read_key(void)
+{
+#ifdef _WIN32
+    int ch = _getch();
+    if (ch == 0 || ch == 0xE0)
+    {
+        switch (_getch())
+        {
+        case 73:
+            return PAGER_KEY_PREV;
+        case 81:
+            return PAGER_KEY_NEXT;
+        case 71:
+            return PAGER_KEY_HOME;
+        case 79:
+            return PAGER_KEY_END;
+        default:
+            return PAGER_KEY_NONE;
+        }
+    }
+#else
+    int ch = getch();
+    if (ch == 27) // ESC [ 序列：PgUp为5~，PgDn为6~，Home为H或1~/7~，End为F或4~/8~
+    {
+        if (getch() != '[')
+            return PAGER_KEY_NONE;
+        int code = getch();
+        if (code == 'H')
+            return PAGER_KEY_HOME;
+        if (code == 'F')
+            return PAGER_KEY_END;
+        if (code < '1' || code > '8' || getch() != '~')
+            return PAGER_KEY_NONE;
+        switch (code)
+        {
+        case '5':
+            return PAGER_KEY_PREV;
+        case '6':
+            return PAGER_KEY_NEXT;
+        case '1':
+        case '7':
+            return PAGER_KEY_HOME;
+        case '4':
+        case '8':
+            return PAGER_KEY_END;
+        default:
+            return PAGER_KEY_NONE;
+        }
+    }
+#endif
+    switch (ch)
+    {
+    case ' ':
+    case '\n':
+    case '\r':
+    case 'f':
+        return PAGER_KEY_NEXT;
+    case 'b':
+        return PAGER_KEY_PREV;
+    case 'g':
+        return PAGER_KEY_HOME;
+    case 'G':
+        return PAGER_KEY_END;
+    case '/':
+        return PAGER_KEY_SEARCH;
+    case 'n':
+        return PAGER_KEY_AGAIN;
+    case 'q':
+    case 'Q':
+    case EOF:
+        return PAGER_KEY_QUIT;
+    default:
+        return PAGER_KEY_NONE;
+    }
+}
+
+static void pager_render(const Pager *pager, const char *status)
+{
+    const PagerQuery *query = pager->query;
+    clear_screen();
+    printf("\n=== %s ===\n\n", query->title);
+
+    Table table;
+    if (table_begin(&table, query->columns, query->column_count, pager->page_rows))
+    {
+        for (int r = 0; r < pager->rows; r++)
+        {
+            table_add_row(&table, (const char *const *)&pager->cells[r * query->column_count]);
+        }
+        table_end(&table);
+    }
+
+    printf("\n共 %ld 条记录  %s\n", pager->total, status);
+    printf("[PgDn/空格]下一页 [PgUp/b]上一页 [Home/g]首页 [End/G]末页 [/]搜索 [n]下一个 [q]返回\n");
+    fflush(stdout);
+}
+
+/**
+ * 非交互时按顺序输出全部结果
+ */
+static bool pager_dump(Pager *pager)
+{
+    const PagerQuery *query = pager->query;
+    sqlite3_stmt *stmt = pager_prepare(pager, NULL, false, !query->descending, NULL, -1);
+    if (!stmt)
+    {
+        return false;
+    }
+
+    printf("\n=== %s ===\n\n", query->title);
+    Table table;
+    table_begin(&table, query->columns, query->column_count, 0);
+    const char **values = malloc(query->column_count * sizeof(char *));
+    int rc = SQLITE_NOMEM;
+    while (values && (rc = sqlite3_step(stmt)) == SQLITE_ROW)
+    {
+        for (int c = 0; c < query->column_count; c++)
+        {
+            values[c] = (const char *)sqlite3_column_text(stmt, c);
+        }
+        table_add_row(&table, values);
+    }
+    free(values);
+    printf("\n共 %ld 条记录\n", table_end(&table));
+    sqlite3_finalize(stmt);
+    return rc == SQLITE_DONE;
+}
+
+/**
+ * @brief 分页浏览查询结果
+ *
+ * @param db 数据库连接
+ * @param query 查询定义
+ * @return bool 成功返回true
+ */
+bool pager_browse(Database *db, const PagerQuery *query)
+{
+    Pager pager;
+    if (!pager_init(&pager, db, query))
+    {
+        pager_free(&pager);
+        return false;
+    }
+
+    if (!isatty(STDIN_FILENO) || !isatty(STDOUT_FILENO))
+    {
+        bool ok = pager_dump(&pager);
+        pager_free(&pager);
+        return ok;
+    }
+
+    pager.page_rows = table_screen_rows() - PAGER_RESERVED_ROWS;
+    if (pager.page_rows < 1)
+    {
+        pager.page_rows = 1;
+    }
+    if (pager_fetch(&pager, NULL, false, false, NULL, pager.page_rows) < 0)
+    {
+        pager_free(&pager);
+        return false;
+    }
+
+    char search[128] = "";
+    char status[256] = "";
+    bool done = false;
+    while (!done)
+    {
+        pager_render(&pager, pager.rows == 0 ? "暂无记录" : status);
+        status[0] = '\0';
+
+        int fetched;
+        switch (pager_read_key())
+        {
+        case PAGER_KEY_NEXT:
+            fetched = pager.rows > 0 ? pager_fetch(&pager, &pager.keys[(pager.rows - 1) * query->key_count], false,
+                                                   false, NULL, pager.page_rows)
+                                     : 0;
+            if (fetched == 0)
+                snprintf(status, sizeof(status), "已是最后一页");
+            break;
+        case PAGER_KEY_PREV:
+            fetched = pager.rows > 0 ? pager_fetch(&pager, pager.keys, false, true, NULL, pager.page_rows) : 0;
+            if (fetched == 0)
+                snprintf(status, sizeof(status), "已是第一页");
+            else if (fetched > 0 && fetched < pager.page_rows) // 不足一屏说明已到开头，补满首页
+                pager_fetch(&pager, NULL, false, false, NULL, pager.page_rows);
+            break;
+        case PAGER_KEY_HOME:
+            pager_fetch(&pager, NULL, false, false, NULL, pager.page_rows);
+            break;
+        case PAGER_KEY_END:
+            pager_fetch(&pager, NULL, false, true, NULL, pager.page_rows);
+            break;
+        case PAGER_KEY_SEARCH:
+            printf("搜索: ");
+            fflush(stdout);
+            if (!fgets(search, sizeof(search), stdin))
+            {
+                search[0] = '\0';
+            }
+            trim_newline(search);
+            // fall through
+        case PAGER_KEY_AGAIN:
+            if (search[0] && !pager_search(&pager, search))
+            {
+                snprintf(status, sizeof(status), "未找到“%s”", search);
+            }
+            break;
+        case PAGER_KEY_QUIT:
+            done = true;
+            break;
+        default:
+            break;
+        }
+    }
+
+    pager_free(&pager);
+    return true;
+}
@@ -0,0 +1,292 @@
+#include "utils/pinyin.h"
+#include <stdlib.h>
+#include <string.h>
+
+// 权重区间：ASCII非字母字符 < 字母与汉字 < 其他字符
+#define WEIGHT_RANKED 0x100
+#define WEIGHT_OTHER 0x100000
+
+/**
+ * 解码一个UTF-8字符，返回消耗的字节数；非法序列按一个字节的U+FFFD处理
+ */
+static size_t decode_utf8(const unsigned char *s, size_t len, uint32_t *cp)
+{
+    unsigned char c = s[0];
+    size_t n;
+    if (c < 0x80)
+    {
+        *cp = c;
+        return 1;
+    }
+    if ((c & 0xE0) == 0xC0)
+    {
+        n = 2;
+        *cp = c & 0x1F;
+    }
+    else if ((c & 0xF0) == 0xE0)
+    {
+        n = 3;
+        *cp = c & 0x0F;
+    }
+    else if ((c & 0xF8) == 0xF0)
+    {
+        n = 4;
+        *cp = c & 0x07;
+    }
+    else
+    {
+        *cp = 0xFFFD;
+        return 1;
+    }
+    if (n > len)
+    {
+        *cp = 0xFFFD;
+        return 1;
+    }
+    for (size_t i = 1; i < n; i++)
+    {
+        if ((s[i] & 0xC0) != 0x80)
+        {
+            *cp = 0xFFFD;
+            return 1;
+        }
+        *cp = (*cp << 6) | (s[i] & 0x3F);
+    }
+    return n;
+}
+
+/**
+ * 字母的权重：位于该字母的汉字组之前；没有拼音以I、U、V开头，排在下一个有汉字的字母之前
+ */
+static uint32_t letter_weight(int index)
+{
+    int next = index;
+    while (PINYIN_LETTER_RANKS[next] == 0)
+    {
+        next++;
+    }
+    return WEIGHT_RANKED + 4u * PINYIN_LETTER_RANKS[next] - (uint32_t)(next - index);
+}
+
+static uint32_t char_weight(uint32_t cp)
+{
+    if (cp < 0x80)
+    {
+        if (cp >= 'a' && cp <= 'z')
+            return letter_weight((int)(cp - 'a'));
+        if (cp >= 'A' && cp <= 'Z')
+            return letter_weight((int)(cp - 'A'));
+        return cp + 1;
+    }
+    if (cp >= PINYIN_FIRST && cp <= PINYIN_LAST && PINYIN_RANKS[cp - PINYIN_FIRST] != 0)
+    {
+        return WEIGHT_RANKED + 4u * PINYIN_RANKS[cp - PINYIN_FIRST];
+    }
+    for (int i = 0; i < PINYIN_EXTRA_COUNT; i++)
+    {
+        if (PINYIN_EXTRA[i][0] == cp)
+            return WEIGHT_RANKED + 4u * PINYIN_EXTRA[i][1];
+    }
+    return WEIGHT_OTHER + cp;
+}
+
+/**
+ * 生成拼音排序键
+ *
+ * @param text UTF-8字符串
+ * @param len 字节数
+ * @param out 输出缓冲区，可为NULL（只计算长度）
+ * @param size 缓冲区大小
+ * @return 完整排序键的长度
+ */
+size_t pinyin_sort_key(const char *text, size_t len, unsigned char *out, size_t size)
+{
+    const unsigned char *s = (const unsigned char *)text;
+    size_t pos = 0, key_len = 0;
+    while (pos < len)
+    {
+        uint32_t cp;
+        pos += decode_utf8(s + pos, len - pos, &cp);
+        uint32_t weight = char_weight(cp);
+        if (out && key_len + PINYIN_KEY_CHAR_BYTES <= size)
+        {
+            out[key_len] = (unsigned char)(weight >> 16);
+            out[key_len + 1] = (unsigned char)(weight >> 8);
+            out[key_len + 2] = (unsigned char)weight;
+        }
+        key_len += PINYIN_KEY_CHAR_BYTES;
+    }
+    return key_len;
+}
+
+/**
+ * 按拼音比较，逐字符比较权重，不生成排序键
+ */
+int pinyin_compare(const char *a, size_t a_len, const char *b, size_t b_len)
+{
+    const unsigned char *sa = (const unsigned char *)a, *sb = (const unsigned char *)b;
+    size_t pa = 0, pb = 0;
+    while (pa < a_len && pb < b_len)
+    {
+        uint32_t ca, cb;
+        pa += decode_utf8(sa + pa, a_len - pa, &ca);
+        pb += decode_utf8(sb + pb, b_len - pb, &cb);
+        if (ca != cb)
+        {
+            uint32_t wa = char_weight(ca), wb = char_weight(cb);
+            if (wa != wb)
+                return wa < wb ? -1 : 1;
+        }
+    }
+    if (pa < a_len || pb < b_len)
+    {
+        return pa < a_len ? 1 : -1;
+    }
+    size_t n = a_len < b_len ? a_len : b_len;
+    int result = memcmp(a, b, n);
+    return result != 0 ? result : (a_len > b_len) - (a_len < b_len);
+}
+
+typedef struct
+{
+    const unsigned char *key;
+    size_t key_len;
+    void *record;
+} SortEntry;
+
+static int compare_entries(const void *a, const void *b)
+{
+    const SortEntry *ea = a, *eb = b;
+    size_t n = ea->key_len < eb->key_len ? ea->key_len : eb->key_len;
+    int result = memcmp(ea->key, eb->key, n);
+    return result != 0 ? result : (ea->key_len > eb->key_len) - (ea->key_len < eb->key_len);
+}
+
+/**
+ * 按拼音对记录指针排序
+ *
+ * 所有排序键放在一块连续内存中，qsort只移动24字节的键/指针对，
+ * 比较时为memcmp，不再逐次解码UTF-8。拼音相同的记录之间顺序不保证。
+ *
+ * @param records 记录指针数组，排序结果写回此数组
+ * @param count 记录数
+ * @param name_of 取记录名称的函数
+ * @return 内存不足时返回false，数组保持不变
+ */
+bool pinyin_sort_records(void **records, size_t count, const char *(*name_of)(const void *record))
+{
+    if (count < 2)
+    {
+        return true;
+    }
+    SortEntry *entries = malloc(count * sizeof(SortEntry));
+    size_t *lengths = malloc(count * sizeof(size_t));
+    size_t total = 0;
+    for (size_t i = 0; entries && lengths && i < count; i++)
+    {
+        lengths[i] = strlen(name_of(records[i]));
+        total += lengths[i] * PINYIN_KEY_CHAR_BYTES; // 每字节至多一个字符
+    }
+    unsigned char *arena = entries && lengths ? malloc(total + 1) : NULL;
+    if (!arena)
+    {
+        free(entries);
+        free(lengths);
+        return false;
+    }
+
+    unsigned char *pos = arena;
+    for (size_t i = 0; i < count; i++)
+    {
+        entries[i].key = pos;
+        entries[i].key_len = pinyin_sort_key(name_of(records[i]), lengths[i], pos, lengths[i] * PINYIN_KEY_CHAR_BYTES);
+        entries[i].record = records[i];
+        pos += entries[i].key_len;
+    }
+    qsort(entries, count, sizeof(SortEntry), compare_entries);
+    for (size_t i = 0; i < count; i++)
+    {
+        records[i] = entries[i].record;
+    }
+
+    free(arena);
+    free(lengths);
+    free(entries);
+    return true;
+}
+
+static int collate_pinyin(void *arg, int a_len, const void *a, int b_len, const void *b)
+{
+    (void)arg;
+    return pinyin_compare(a, (size_t)a_len, b, (size_t)b_len);
+}
+
+static void sql_pinyin_key(sqlite3_context *context, int argc, sqlite3_value **argv)
+{
+    (void)argc;
+    if (sqlite3_value_type(argv[0]) == SQLITE_NULL)
+    {
+        sqlite3_result_null(context);
+        return;
+    }
+    const char *text = (const char *)sqlite3_value_text(argv[0]);
+    size_t len = (size_t)sqlite3_value_bytes(argv[0]);
+    size_t key_len = len * PINYIN_KEY_CHAR_BYTES;
+    unsigned char *key = sqlite3_malloc64(key_len + 1);
+    if (!key)
+    {
+        sqlite3_result_error_nomem(context);
+        return;
+    }
+    key_len = pinyin_sort_key(text, len, key, key_len);
+    sqlite3_result_blob64(context, key, key_len, sqlite3_free);
+}
+
+/**
+ * 注册拼音排序规则和排序键函数
+ *
+ * ORDER BY name COLLATE PINYIN 用于临时排序，pinyin_key() 供临时查询使用。
+ * users.name_sort_key 由程序在写入时计算（见pinyin_bind_sort_key），不依赖连接上注册的函数，
+ * 未注册的连接（外部脚本等）也能照常写users表。
+ *
+ * @param db SQLite连接
+ * @return 注册成功返回true
+ */
+bool pinyin_register(sqlite3 *db)
+{
+    return sqlite3_create_collation(db, "PINYIN", SQLITE_UTF8, NULL, collate_pinyin) == SQLITE_OK &&
+           sqlite3_create_function(db, "pinyin_key", 1, SQLITE_UTF8 | SQLITE_DETERMINISTIC | SQLITE_INNOCUOUS, NULL,
+                                   sql_pinyin_key, NULL, NULL) == SQLITE_OK;
+}
+
+/**
+ * 绑定排序键参数
+ *
+ * 常见长度的姓名在栈上计算后由SQLite复制，超长时另行分配
+ *
+ * @param stmt 预编译语句
+ * @param index 参数序号（从1开始）
+ * @param text UTF-8字符串，可为NULL
+ * @return SQLite返回码
+ */
+int pinyin_bind_sort_key(sqlite3_stmt *stmt, int index, const char *text)
+{
+    if (!text)
+    {
+        return sqlite3_bind_null(stmt, index);
+    }
+    size_t len = strlen(text);
+    unsigned char buffer[64 * PINYIN_KEY_CHAR_BYTES];
+    size_t key_len = pinyin_sort_key(text, len, buffer, sizeof(buffer));
+    if (key_len <= sizeof(buffer))
+    {
+        return sqlite3_bind_blob64(stmt, index, buffer, key_len, SQLITE_TRANSIENT);
+    }
+    unsigned char *key = sqlite3_malloc64(key_len);
+    if (!key)
+    {
+        return SQLITE_NOMEM;
+    }
+    pinyin_sort_key(text, len, key, key_len);
+    return sqlite3_bind_blob64(stmt, index, key, key_len, sqlite3_free);
+}
@@ -0,0 +1,1758 @@
+// 由 data_gen/gen_pinyin_table.py 生成，请勿手工修改
+#include "utils/pinyin.h"
+
+// 拉丁字母A-Z在拼音顺序中的位置，0表示没有以该字母开头的拼音
+const uint16_t PINYIN_LETTER_RANKS[26] = {
+    1, 198, 1090, 2430, 3426, 3612, 4234, 5061, 0, 6125, 7731, 8286, 9857, 10666, 11146, 11181, 11779, 12786, 13112, 14425, 0, 0, 15316, 15947, 17283, 19235,
+};
+
+// 表范围之外的汉字
+const uint32_t PINYIN_EXTRA[PINYIN_EXTRA_COUNT][2] = {
+    {0x3007, 9218},
+};
+
+// U+4E00至U+9FA5各汉字在拼音顺序中的位置，0表示不在表中
+const uint16_t PINYIN_RANKS[PINYIN_LAST - PINYIN_FIRST + 1] = {
+    17872, 3047, 7843, 11780, 13421, 16245, 5131, 15412, 19643, 13152, 13422, 16246,
+    6126, 1061, 18801, 10346, 4266, 1896, 1897, 20436, 12283, 11414, 13742, 13741,
+    12480, 899, 17813, 2256, 3094, 14055, 1645, 3090, 12481, 9015, 3091, 18644,
+    9016, 17395, 923, 13191, 4987, 7294, 4501, 17284, 12172, 20173, 6301, 7025,
+    3914, 4826, 2039, 1370, 9146, 20569, 20364, 5066, 15368, 2529, 15612, 20365,
+    7195, 8767, 7441, 11589, 4044, 17910, 18026, 10699, 15942, 7316, 7317, 15239,
+    10075, 18027, 17873, 19930, 15801, 19508, 5638, 3621, 8555, 18282, 11620, 11258,
+    12231, 5582, 4784, 1653, 1660, 17988, 18322, 17361, 10401, 7315, 11905, 17805,
+    16073, 16450, 4267, 7318, 16247, 5591, 13859, 3190, 13727, 6132, 10746, 6425,
+    7459, 13696, 10040, 5511, 9907, 9746, 20612, 13029, 17156, 17450, 4137, 13257,
+    10674, 4299, 14403, 18724, 2378, 19749, 4304, 20086, 4897, 4306, 9748, 9186,
+    18125, 7582, 8571, 9897, 18802, 19869, 13750, 13753, 3599, 1963, 18709, 8137,
+    18708, 19153, 5592, 11815, 15858, 7194, 14101, 14326, 4517, 4518, 17336, 16640,
+    17339, 11823, 17342, 6234, 15082, 15438, 7830, 14447, 6800, 5080, 18035, 1367,
+    5374, 10620, 17870, 16488, 7159, 14983, 9027, 16489, 7163, 17821, 12314, 983,
+    18684, 16717, 2570, 8916, 3398, 10171, 12848, 12849, 6222, 6418, 15439, 18028,
+    13554, 12850, 8553, 3048, 19422, 7080, 11724, 1861, 200, 19636, 7059, 7026,
+    893, 12910, 2255, 3994, 13159, 9758, 894, 1166, 20671, 13743, 14426, 19644,
+    4169, 16446, 16261, 15240, 5415, 15021, 12872, 11997, 4316, 4437, 970, 2487,
+    9300, 17990, 1512, 1429, 13113, 13429, 17911, 10636, 10180, 12873, 6487, 1513,
+    17645, 12059, 20216, 11492, 15775, 15860, 6654, 6506, 17740, 3916, 1167, 12875,
+    15442, 3896, 2769, 3748, 20174, 11907, 11329, 18711, 2975, 3338, 15895, 18036,
+    16789, 7831, 17875, 6224, 41, 15944, 6325, 4047, 3622, 16890, 7105, 11415,
+    2559, 4007, 14647, 20217, 18586, 6078, 5944, 18803, 2350, 2020, 13160, 15550,
+    2021, 1517, 17305, 16392, 13398, 1412, 9759, 1168, 17254, 16791, 15551, 20382,
+    19429, 16306, 11095, 971, 4651, 10854, 10875, 16695, 324, 17001, 9304, 20274,
+    13514, 12564, 2207, 526, 13746, 6427, 11416, 18040, 14105, 17992, 19870, 2925,
+    5091, 9915, 2578, 20383, 1063, 12565, 573, 19665, 2199, 15614, 2770, 20384,
+    20895, 18668, 17646, 14802, 19592, 5275, 595, 15264, 13477, 18712, 18041, 4050,
+    20898, 4603, 11036, 15023, 10855, 16266, 12609, 18514, 15335, 12006, 13822, 7738,
+    438, 11331, 5920, 5336, 8523, 16479, 4463, 17612, 270, 3639, 10498, 6430,
+    3602, 924, 6235, 5369, 6073, 4932, 12681, 14900, 6842, 2208, 18052, 13729,
+    16831, 13516, 15247, 7790, 19975, 4247, 8325, 17920, 1761, 8036, 4857, 8774,
+    18240, 13754, 10276, 20308, 17005, 18669, 75, 9581, 10599, 3561, 9763, 3127,
+    1289, 1706, 17257, 4563, 20236, 17880, 12999, 2386, 16205, 14110, 19277, 9671,
+    14477, 6843, 19771, 1213, 12232, 8051, 1299, 11037, 11057, 7082, 15868, 5478,
+    7280, 1695, 19845, 20904, 1901, 12315, 9672, 7405, 13931, 15003, 13581, 15205,
+    979, 10724, 16535, 756, 15200, 18808, 16141, 2293, 3438, 12518, 16981, 4878,
+    8018, 15869, 7702, 18067, 4142, 9001, 20817, 12260, 8782, 18555, 6053, 7224,
+    12112, 13173, 11328, 14231, 4069, 15963, 8736, 4143, 11622, 395, 18725, 11832,
+    16207, 16794, 16891, 18809, 2845, 1519, 1863, 20170, 17453, 8904, 8783, 8326,
+    14139, 6594, 16892, 4147, 6089, 7478, 16621, 11199, 6663, 826, 1973, 3817,
+    3978, 17347, 104, 468, 18858, 16772, 581, 5586, 1414, 19951, 927, 7335,
+    17700, 2353, 8905, 15385, 8327, 1172, 20762, 4504, 4800, 469, 14877, 13869,
+    13870, 10181, 2703, 14537, 7603, 2074, 16855, 11374, 14649, 5510, 18002, 11785,
+    14814, 4340, 7228, 7041, 14302, 1466, 6975, 3756, 19979, 7962, 7555, 20710,
+    7479, 12114, 10829, 9765, 20550, 15758, 9824, 14147, 8656, 6054, 3102, 20696,
+    517, 15870, 7480, 10707, 1110, 6597, 19534, 17790, 19980, 13284, 12392, 12311,
+    18374, 1621, 6532, 17458, 13055, 20225, 2125, 6495, 6351, 15565, 18815, 931,
+    13098, 14763, 15476, 11526, 17525, 3931, 14650, 15781, 3491, 16663, 1526, 13633,
+    7793, 2851, 20910, 1257, 14986, 473, 16709, 5814, 17753, 19597, 1902, 17368,
+    18623, 6664, 16991, 19471, 2162, 4186, 557, 20087, 20746, 10354, 6250, 18007,
+    16710, 17232, 1097, 3262, 1220, 19785, 11172, 15076, 15077, 474, 19250, 9466,
+    6979, 15566, 3901, 1435, 4898, 14209, 20104, 14247, 16196, 4229, 19074, 12967,
+    8812, 11101, 19211, 6763, 9887, 360, 2893, 14613, 5244, 6984, 15994, 13364,
+    12117, 7618, 1174, 1980, 13161, 478, 16627, 18564, 17704, 14586, 14387, 17655,
+    3616, 932, 6447, 2486, 19280, 14652, 4748, 855, 1953, 11125, 1132, 8609,
+    2333, 18519, 19348, 20752, 532, 14166, 182, 2027, 18823, 19536, 20808, 13402,
+    2059, 7246, 1799, 13282, 5161, 19617, 12401, 17537, 2869, 16724, 9470, 479,
+    11579, 7088, 8978, 9602, 9933, 12031, 16283, 14588, 18445, 3146, 20465, 16518,
+    13368, 12239, 7289, 15202, 20878, 11741, 16014, 8509, 1458, 4868, 9047, 11800,
+    1626, 1332, 15588, 6170, 961, 5975, 2036, 14953, 2600, 6865, 7346, 13252,
+    3904, 16426, 7420, 3519, 6814, 6688, 15047, 9205, 1004, 4740, 16447, 14260,
+    16427, 6744, 10466, 17839, 7133, 6512, 12270, 11515, 3943, 20293, 55, 13148,
+    17968, 7717, 11063, 1337, 18150, 2660, 7207, 17078, 8059, 6627, 1989, 2550,
+    6871, 13283, 19283, 1164, 866, 102, 13011, 14499, 1881, 1304, 8386, 10866,
+    7101, 12128, 10192, 15886, 11022, 12470, 10867, 1448, 9127, 8616, 9691, 8103,
+    432, 18936, 802, 19299, 20007, 14137, 18598, 5223, 1603, 1605, 8849, 14743,
+    15600, 9449, 1957, 1351, 12810, 13896, 6014, 8875, 9810, 19302, 11126, 14656,
+    17497, 8595, 10759, 3558, 15891, 19186, 19285, 19004, 16868, 1821, 19684, 16869,
+    16263, 4855, 3299, 7906, 3300, 10348, 15155, 1430, 3560, 3301, 3562, 7062,
+    15157, 14106, 17451, 17454, 13732, 0, 2634, 12018, 3154, 3851, 10022, 13537,
+    3155, 0, 7182, 8750, 5854, 13033, 15440, 10815, 12679, 9017, 18726, 199,
+    4558, 9376, 15949, 5185, 8372, 4594, 14843, 4795, 16849, 897, 11824, 7469,
+    2911, 20615, 3848, 17649, 6530, 13845, 6365, 18126, 6386, 1393, 7265, 10048,
+    12800, 10816, 19005, 10037, 4353, 12801, 1211, 7266, 1212, 19274, 4767, 7275,
+    10051, 20279, 10053, 4635, 16988, 10355, 10291, 12964, 18281, 16691, 7788, 7675,
+    11056, 17916, 10242, 13761, 4798, 10185, 20204, 7481, 18977, 10482, 7988, 9147,
+    4187, 16692, 10320, 892, 3095, 14482, 4355, 3960, 896, 5597, 1822, 7585,
+    5598, 8109, 17807, 8655, 11239, 4051, 10449, 3126, 16356, 9103, 11987, 6523,
+    7220, 13932, 10127, 15116, 11786, 4727, 20540, 14148, 7229, 9002, 12432, 2955,
+    9235, 3137, 4341, 6601, 18252, 2281, 17952, 8813, 2068, 10500, 20546, 2334,
+    14073, 3380, 7134, 9187, 9188, 11023, 16033, 3213, 6299, 3667, 3668, 3669,
+    3975, 7360, 1949, 19929, 3917, 10664, 20169, 4048, 3918, 11632, 3922, 7749,
+    5815, 7755, 4307, 2757, 11660, 12094, 16867, 8048, 15097, 137, 1912, 6128,
+    2644, 5106, 5109, 19353, 2674, 2951, 2675, 12869, 12870, 2045, 3839, 12284,
+    18030, 6129, 7780, 12110, 2388, 1919, 15712, 6133, 2560, 16826, 5670, 15369,
+    7586, 8661, 19097, 9101, 9311, 19383, 4356, 2063, 4052, 1914, 12656, 7361,
+    13313, 10450, 9219, 20176, 11240, 837, 6961, 6962, 11286, 8768, 13314, 838,
+    1368, 7197, 4752, 4521, 2702, 2065, 8138, 8001, 3403, 3603, 20056, 13969,
+    12733, 13258, 2209, 7907, 6966, 4956, 2210, 4957, 7750, 3404, 6333, 14811,
+    7203, 9464, 9823, 19391, 18976, 2413, 17146, 7908, 8295, 12064, 13259, 2066,
+    4769, 6658, 2414, 8664, 14752, 3818, 11710, 1373, 11835, 2067, 20697, 4366,
+    15357, 947, 6145, 3362, 12408, 13358, 3193, 6665, 6346, 948, 17364, 7482,
+    6064, 13640, 6602, 3371, 3263, 15816, 4770, 4188, 13638, 6670, 4451, 2452,
+    7756, 2069, 2017, 1381, 15170, 9603, 8680, 11408, 13333, 11554, 7979, 6859,
+    4760, 12211, 7626, 5683, 19476, 20610, 8928, 7505, 11440, 9333, 4970, 6872,
+    4971, 6692, 6693, 14600, 6067, 6387, 6702, 18163, 6703, 20148, 1352, 6647,
+    10530, 8726, 20378, 8760, 17333, 12732, 322, 4560, 6424, 15943, 9913, 9102,
+    7106, 7945, 16647, 20017, 3125, 20385, 11096, 6963, 12610, 13455, 18042, 20307,
+    10535, 8769, 7107, 8498, 8499, 7553, 7984, 17613, 15318, 16619, 10600, 8083,
+    6967, 9104, 5276, 13755, 7909, 7112, 4423, 980, 10454, 1786, 8455, 18556,
+    18557, 10351, 7910, 17190, 7556, 12409, 9586, 1073, 10219, 1789, 8574, 7776,
+    10356, 3140, 17018, 17021, 7782, 15945, 18094, 17193, 15744, 13641, 8506, 10648,
+    9604, 11580, 13792, 6163, 12346, 6784, 1488, 12735, 16519, 18139, 7627, 3651,
+    7537, 15048, 7506, 2551, 16674, 9923, 17198, 17199, 9710, 8837, 1540, 12811,
+    12737, 374, 13447, 19154, 7295, 414, 4602, 15892, 19155, 15684, 706, 4268,
+    4269, 375, 2220, 18228, 16870, 11356, 7363, 14690, 4464, 11733, 3486, 11294,
+    4089, 4572, 2453, 7338, 12446, 569, 5669, 454, 10784, 13826, 3728, 7328,
+    17912, 19237, 6774, 7832, 6795, 8082, 5512, 16204, 12566, 747, 4933, 12288,
+    19327, 8086, 3796, 5524, 18816, 4945, 8185, 5967, 2545, 4969, 8923, 8929,
+    14292, 3214, 7352, 7656, 16130, 11489, 12562, 17877, 7859, 17455, 735, 10880,
+    12580, 13692, 17252, 11996, 10921, 13123, 20801, 13603, 15859, 5942, 323, 13747,
+    16131, 15413, 5650, 16648, 15414, 441, 20803, 20547, 16651, 2531, 9918, 10725,
+    2533, 6251, 994, 13979, 1041, 8105, 745, 1054, 19591, 7737, 9509, 18645,
+    9552, 15957, 4772, 15778, 16705, 6955, 6956, 15611, 130, 12447, 19932, 10038,
+    18352, 15473, 13456, 6231, 12746, 9745, 1762, 7543, 16702, 17006, 7083, 12747,
+    15906, 6239, 3492, 12393, 16007, 13180, 1453, 15549, 3468, 14963, 8761, 19713,
+    5132, 8762, 17324, 17286, 17508, 13483, 2817, 19497, 11265, 17306, 5277, 17309,
+    20057, 1214, 11267, 14760, 8663, 13486, 5499, 14970, 20836, 2415, 3819, 19015,
+    1221, 19021, 16455, 17459, 8814, 7619, 13290, 2894, 1922, 7339, 7089, 143,
+    4951, 17542, 14074, 8821, 1459, 8383, 8830, 17428, 17490, 19060, 14053, 4559,
+    9143, 12972, 12654, 12655, 3581, 8603, 3192, 16393, 20437, 13154, 1124, 1125,
+    1126, 1129, 51, 2514, 18665, 1251, 6223, 18690, 13986, 3702, 13835, 4792,
+    220, 3613, 13096, 13751, 13864, 20564, 12646, 13843, 754, 17009, 6489, 11245,
+    14207, 4424, 15620, 14208, 3024, 13085, 2274, 7983, 4680, 7458, 9301, 4768,
+    2676, 7985, 20016, 6894, 19683, 258, 3049, 7896, 14483, 1779, 13725, 18666,
+    12507, 11687, 17814, 5232, 14056, 14582, 1759, 8556, 2952, 6130, 9081, 5396,
+    10402, 16940, 9979, 1705, 4502, 17057, 17680, 20672, 5274, 6225, 2976, 2391,
+    15022, 10476, 5497, 8765, 15152, 16506, 19464, 16248, 17806, 9669, 17287, 9898,
+    11170, 6063, 17878, 7676, 1898, 9199, 15213, 18283, 3807, 574, 12376, 12377,
+    7027, 1064, 4000, 259, 3319, 3840, 3435, 5104, 14967, 7947, 14024, 11911,
+    5419, 19935, 18326, 15829, 15830, 1505, 10805, 17177, 15950, 2071, 3151, 15713,
+    5495, 5397, 15831, 4421, 17362, 7701, 9670, 3474, 4462, 10081, 2480, 11912,
+    1648, 15832, 4422, 4009, 6895, 5398, 1760, 13606, 10806, 15214, 4135, 18043,
+    2481, 11171, 8770, 499, 19008, 5009, 15734, 12141, 15808, 3478, 13656, 7544,
+    11353, 15716, 10807, 9858, 9302, 12787, 18589, 2822, 20237, 13756, 20275, 14960,
+    16136, 18053, 11940, 11633, 20679, 4652, 2158, 15615, 16985, 3, 10762, 4236,
+    11311, 18054, 16533, 13517, 5514, 10503, 2444, 12657, 7438, 5107, 19240, 15248,
+    3359, 11719, 11287, 839, 4057, 17591, 5278, 19261, 5279, 5067, 7331, 18553,
+    4226, 2431, 20276, 15337, 7732, 4745, 7733, 20915, 1066, 9395, 3096, 11010,
+    14478, 14059, 16394, 6087, 11944, 3604, 3481, 4860, 19511, 16142, 17927, 9138,
+    20616, 10403, 10239, 20031, 17747, 6142, 20280, 4445, 13933, 19291, 16620, 5068,
+    5881, 8037, 5715, 14692, 16311, 3482, 17111, 16893, 5010, 17513, 8524, 17882,
+    8, 11615, 13561, 15027, 5401, 16874, 3360, 15348, 5062, 19265, 18672, 3042,
+    11210, 16490, 7, 4515, 8087, 17326, 2432, 16536, 606, 5947, 10929, 5646,
+    16864, 8053, 3385, 3846, 6335, 11058, 10597, 18511, 5236, 19016, 9456, 11720,
+    9991, 4447, 11149, 1707, 13459, 8898, 10675, 20804, 5292, 8006, 16539, 16405,
+    8502, 949, 19720, 19470, 9028, 210, 10404, 9110, 14303, 4083, 1056, 5146,
+    5375, 4539, 14034, 4499, 18682, 17518, 4660, 4688, 500, 5111, 14384, 2109,
+    18080, 9, 6467, 15103, 16312, 15386, 8792, 15969, 14611, 20907, 12524, 1521,
+    15835, 19367, 17327, 3152, 11916, 2789, 12380, 9886, 10548, 4597, 3164, 12658,
+    8503, 9018, 14404, 19368, 5774, 8494, 13261, 6146, 20896, 15761, 3973, 7120,
+    5640, 11950, 13846, 15518, 13970, 1468, 3569, 8804, 12199, 105, 19393, 18512,
+    10925, 18702, 14878, 8352, 13285, 15978, 15307, 5525, 20, 19673, 11082, 7935,
+    20574, 20575, 13400, 2852, 5377, 9149, 6, 1111, 16456, 15216, 15872, 15728,
+    2359, 13286, 4692, 11919, 11920, 14697, 2585, 2586, 17827, 20687, 585, 2360,
+    2009, 5298, 17328, 11922, 19724, 3772, 9019, 16323, 11466, 13287, 8320, 19394,
+    18377, 4776, 11186, 19750, 13221, 20460, 10961, 5060, 9791, 17369, 2853, 12690,
+    1375, 1042, 3076, 8454, 16626, 7409, 14614, 1795, 14764, 100, 7306, 2592,
+    7734, 18545, 15625, 10731, 13365, 18876, 19729, 8299, 6938, 5481, 5135, 3013,
+    20250, 1303, 15350, 11129, 18865, 18258, 19251, 17686, 11147, 10358, 5550, 19194,
+    2034, 5960, 5783, 5784, 16106, 5269, 6154, 8187, 20205, 15523, 13291, 17026,
+    5818, 3374, 10965, 17065, 9032, 18877, 13192, 1715, 12238, 17529, 2541, 11355,
+    1130, 8676, 18513, 19472, 15481, 10376, 18437, 11346, 1058, 8157, 16151, 18878,
+    6985, 9505, 8025, 19371, 5616, 14773, 17709, 5342, 5, 16927, 12154, 13226,
+    18520, 14250, 5467, 16667, 46, 14391, 9899, 1258, 5085, 7874, 2436, 13184,
+    1547, 13035, 14186, 15325, 6164, 11277, 15819, 12099, 13793, 4478, 20629, 6939,
+    9845, 15738, 15340, 14128, 1717, 5214, 14424, 0, 5069, 14409, 12347, 10968,
+    5271, 19995, 13146, 10667, 4507, 10671, 2889, 15, 12202, 15019, 639, 145,
+    146, 8917, 20838, 19710, 10562, 14220, 14210, 14576, 2800, 11801, 6908, 1830,
+    6815, 7757, 14589, 13335, 1193, 6454, 24, 16563, 11581, 9506, 4237, 4708,
+    16564, 5530, 5976, 5019, 11174, 16284, 19401, 1442, 16964, 11681, 2727, 9901,
+    9890, 5561, 8645, 3195, 4238, 14598, 17810, 535, 18388, 13151, 6909, 10312,
+    16630, 5647, 9910, 12796, 2010, 11367, 8510, 16632, 6174, 20374, 1497, 8196,
+    20843, 16569, 14080, 5220, 4159, 9053, 12241, 16024, 1990, 1385, 2604, 5364,
+    17273, 3466, 20879, 3652, 1722, 5906, 19297, 2056, 2301, 2601, 18917, 15219,
+    1243, 6913, 17794, 16025, 11962, 5217, 8930, 16968, 2745, 5908, 18312, 11728,
+    7577, 12352, 17242, 10971, 9507, 14081, 17484, 18498, 2439, 19554, 11148, 20296,
+    7139, 11065, 5988, 16729, 11964, 3528, 19374, 17898, 13811, 6916, 19083, 18,
+    18528, 7641, 8062, 18834, 11347, 2713, 4241, 5395, 3327, 2626, 16806, 13142,
+    11444, 11501, 18277, 20845, 11024, 2808, 8444, 14437, 6068, 13013, 5207, 16252,
+    17854, 3368, 11517, 1883, 6392, 7143, 5224, 14832, 1449, 17282, 10077, 1091,
+    14834, 9568, 6005, 1019, 18600, 10983, 18316, 5630, 10079, 5412, 19741, 8707,
+    9347, 5090, 10747, 16585, 10522, 17559, 8857, 9526, 9416, 10525, 2615, 1606,
+    11610, 11503, 16524, 6112, 10526, 16180, 3401, 8032, 17434, 1355, 18412, 12821,
+    2923, 8323, 14473, 16591, 7657, 2155, 5725, 6118, 20475, 10992, 16592, 1096,
+    8718, 1399, 1312, 8882, 18215, 9793, 10749, 19258, 14230, 16126, 19443, 6587,
+    19259, 20379, 8410, 10998, 10745, 8437, 9392, 15504, 5917, 18236, 12508, 14102,
+    11005, 6591, 5918, 16792, 18237, 10720, 15167, 15168, 3339, 7834, 18974, 7276,
+    11525, 19156, 2221, 5539, 5919, 19009, 3436, 5026, 8257, 2222, 15015, 15114,
+    15507, 9760, 5027, 12777, 12917, 9221, 4725, 5028, 14479, 5029, 15115, 18673,
+    5030, 18290, 6055, 11755, 18812, 5112, 19017, 9767, 12674, 18817, 12395, 5031,
+    2025, 15524, 19022, 12675, 8010, 4199, 19029, 19030, 17357, 15129, 15137, 15138,
+    15171, 9752, 5980, 18164, 5748, 9727, 9738, 15150, 17334, 15151, 15001, 13635,
+    11753, 9578, 8069, 17285, 19275, 15506, 4438, 18845, 15802, 4886, 11493, 17913,
+    2736, 11999, 12000, 19841, 20559, 2645, 11986, 16258, 13394, 8107, 1454, 11818,
+    10954, 10536, 6134, 6461, 20020, 20021, 309, 17189, 18044, 12365, 10082, 7677,
+    12966, 15223, 3765, 515, 516, 14521, 7789, 5714, 20899, 7948, 596, 7198,
+    2839, 7156, 6327, 8049, 2818, 7157, 6520, 14535, 8771, 242, 15898, 3861,
+    20509, 11672, 325, 14595, 8213, 12571, 14570, 19938, 15267, 4295, 11634, 2927,
+    4773, 10825, 14486, 11420, 7267, 17647, 3995, 179, 9582, 12483, 10622, 7897,
+    4628, 17178, 223, 1736, 1530, 9222, 20388, 4173, 5515, 20058, 2073, 8287,
+    9445, 9446, 9512, 180, 2489, 11288, 10474, 16833, 3128, 6336, 5337, 9696,
+    2171, 1764, 8606, 4251, 18241, 5500, 3288, 19687, 4070, 4861, 17696, 3386,
+    3387, 4936, 1269, 17617, 18288, 3624, 4632, 19012, 3002, 16653, 7933, 13414,
+    13839, 3483, 938, 2929, 5428, 17291, 8038, 2475, 7741, 2648, 7751, 5204,
+    10780, 103, 16808, 16406, 19072, 341, 4019, 245, 18081, 18356, 5147, 17013,
+    2075, 12333, 4540, 10, 538, 3744, 12748, 18559, 7705, 6439, 2847, 9904,
+    8488, 7546, 1654, 13322, 7069, 19721, 9111, 9112, 1074, 1661, 5694, 1075,
+    13708, 17191, 5011, 7269, 17808, 10926, 2831, 18866, 1081, 17295, 12691, 14331,
+    11467, 12396, 15389, 7487, 9782, 19876, 7963, 1849, 3104, 2505, 14584, 106,
+    1119, 1976, 539, 7794, 19983, 3390, 18095, 19984, 18096, 11320, 6152, 20541,
+    11844, 13210, 7488, 10834, 8008, 7916, 14612, 8215, 10882, 6533, 3289, 7086,
+    4368, 18867, 3493, 11376, 4729, 15158, 8657, 3766, 17314, 12116, 8260, 120,
+    13600, 3413, 10785, 15106, 1672, 18259, 6043, 627, 8979, 5013, 3014, 20461,
+    5504, 399, 400, 18744, 2776, 10026, 6940, 13048, 17830, 4552, 7784, 20713,
+    18745, 5819, 3502, 17705, 17530, 423, 2176, 10097, 1457, 3236, 15278, 18357,
+    3965, 20227, 7045, 7073, 5392, 4373, 2094, 6607, 11670, 8644, 16513, 5811,
+    8648, 3271, 15360, 17066, 6360, 6261, 8056, 18446, 14433, 1680, 18570, 7760,
+    14251, 14252, 13714, 10309, 14440, 15746, 1681, 15130, 14617, 12757, 20207, 8822,
+    20208, 364, 13139, 19343, 3290, 14863, 15922, 19924, 17194, 4479, 19856, 47,
+    4573, 17421, 7797, 14864, 19031, 15668, 16725, 9379, 5089, 8483, 1443, 11381,
+    549, 1576, 9611, 9559, 11157, 12124, 10110, 10563, 20442, 14001, 13903, 9491,
+    1752, 9961, 787, 7248, 1233, 13952, 20124, 19619, 7808, 18523, 2941, 1589,
+    19998, 16164, 5017, 12193, 7130, 2874, 13403, 10650, 2336, 17543, 14442, 19444,
+    12077, 12175, 9009, 15663, 20519, 12216, 19446, 16965, 13370, 13371, 236, 11743,
+    8060, 3119, 3683, 12763, 10579, 3323, 3324, 20867, 2875, 13646, 3420, 3422,
+    14547, 2760, 10618, 3878, 5831, 14548, 2477, 17835, 20428, 6728, 190, 12181,
+    6183, 12219, 7938, 18165, 11481, 672, 2942, 6747, 17812, 18529, 17165, 14553,
+    8426, 7510, 5717, 2664, 12820, 12133, 17202, 16438, 16120, 5351, 56, 17301,
+    2697, 5225, 13050, 7155, 8617, 8123, 9527, 17435, 14563, 15604, 5718, 9451,
+    9452, 13086, 8858, 9178, 12822, 1411, 17210, 17440, 8596, 254, 15366, 13738,
+    12851, 13178, 20491, 20492, 13607, 17879, 9916, 7892, 20394, 20495, 5545, 5547,
+    8245, 17888, 5551, 17027, 8251, 13851, 10008, 20868, 13852, 17899, 20014, 4679,
+    1964, 6775, 3961, 461, 19539, 757, 14298, 12776, 9223, 4177, 2416, 16250,
+    16888, 16760, 10776, 16256, 8174, 15948, 15353, 19066, 10039, 14233, 3357, 3358,
+    17819, 12406, 15354, 4636, 4637, 11952, 10233, 10235, 18309, 6083, 1590, 2472,
+    19421, 14842, 14506, 4224, 4791, 17679, 17590, 5187, 4406, 13654, 14666, 14507,
+    15083, 17447, 571, 17914, 8033, 6426, 3369, 5671, 8102, 19188, 6428, 204,
+    3551, 8906, 5770, 2771, 17452, 11300, 7552, 11825, 10710, 3976, 16654, 3898,
+    2912, 17675, 8150, 20794, 5772, 11945, 7744, 19466, 502, 18068, 6761, 14718,
+    19340, 511, 15970, 5863, 3798, 2956, 17266, 528, 2936, 183, 13467, 15745,
+    5065, 184, 15923, 185, 6765, 8924, 3379, 19146, 6766, 13807, 3906, 6103,
+    687, 9728, 3402, 11103, 11090, 3060, 10700, 12001, 6517, 14428, 7319, 11111,
+    1286, 5230, 16264, 3708, 6302, 14037, 12998, 3769, 15464, 5417, 20477, 4170,
+    9859, 2530, 12880, 4010, 7219, 17396, 5081, 15725, 20177, 11182, 3245, 6328,
+    7949, 20218, 17681, 7108, 19157, 10395, 4001, 1819, 19098, 20479, 11041, 17510,
+    10678, 16763, 3862, 575, 18713, 15295, 3919, 15415, 3741, 15861, 18849, 4887,
+    3248, 224, 10823, 20263, 20565, 19667, 2445, 10704, 19068, 15088, 16308, 19976,
+    3427, 10141, 10537, 11783, 600, 13518, 12285, 3428, 5280, 16986, 3623, 19871,
+    10423, 326, 10623, 4011, 9224, 20673, 20674, 13730, 12802, 13317, 17592, 9930,
+    7056, 4653, 14107, 16851, 15556, 20617, 7462, 13318, 11593, 12888, 17697, 3129,
+    6733, 13868, 6240, 4252, 16507, 5651, 7528, 6802, 4633, 8525, 6528, 6529,
+    17928, 10924, 19978, 6143, 6147, 16401, 5379, 4862, 7679, 8034, 17514, 10499,
+    9105, 11333, 3484, 18674, 17404, 1291, 13522, 18242, 13702, 4937, 12683, 20618,
+    14145, 15474, 5429, 15333, 9465, 17344, 12830, 6803, 9717, 11623, 16407, 13460,
+    8739, 1655, 16706, 9992, 4020, 14385, 10090, 15560, 7913, 2138, 2139, 15004,
+    10936, 16838, 10727, 18731, 10681, 11711, 10808, 7529, 13528, 20075, 5113, 2848,
+    20481, 3439, 11601, 15207, 16408, 10353, 15836, 17405, 15873, 11, 17409, 18732,
+    14116, 18733, 15321, 8899, 16316, 7377, 12648, 20512, 11790, 16317, 20576, 3105,
+    1415, 9590, 32, 3429, 3430, 9467, 10332, 2258, 11721, 7410, 11680, 1098,
+    9243, 15390, 820, 16548, 13900, 11921, 5892, 3716, 15773, 13064, 14540, 3773,
+    3837, 6980, 14844, 10835, 12692, 7225, 6029, 7169, 12023, 2933, 16857, 5612,
+    15358, 8333, 620, 18260, 1855, 10794, 4189, 7235, 9768, 121, 8376, 8216,
+    18297, 17349, 7378, 8805, 2914, 16318, 5695, 5677, 18378, 1324, 13566, 14987,
+    2652, 17754, 15916, 10743, 2140, 6496, 15078, 17028, 18879, 15525, 2863, 12975,
+    10131, 2542, 13057, 12319, 5893, 15784, 12073, 2095, 10378, 4191, 7020, 3264,
+    17959, 20228, 10098, 5820, 10334, 82, 18379, 17067, 6941, 15482, 10149, 19075,
+    19891, 12488, 13784, 16718, 15297, 8980, 10060, 12806, 14064, 11527, 15626, 15324,
+    7341, 5552, 174, 12312, 401, 16954, 15079, 4903, 1927, 17710, 11509, 16079,
+    19032, 18496, 12932, 13036, 1718, 9322, 10134, 11224, 175, 9861, 4639, 8188,
+    12348, 6509, 13209, 19791, 19033, 6942, 12937, 10487, 18385, 6262, 14253, 10941,
+    16329, 14673, 11271, 8461, 10787, 389, 48, 11510, 11604, 18140, 11565, 18906,
+    8576, 17104, 9928, 17893, 19620, 7818, 18524, 10884, 8688, 2801, 4908, 17383,
+    7092, 20443, 1444, 19402, 5097, 10820, 8539, 10511, 19711, 5620, 5621, 186,
+    10821, 12176, 9902, 11592, 4674, 15882, 12242, 15300, 19586, 10028, 16333, 16334,
+    10572, 9054, 8931, 5686, 4912, 2746, 20001, 16969, 17897, 5679, 16026, 8197,
+    12834, 16027, 17546, 1338, 6818, 10137, 3725, 3653, 16289, 18166, 5989, 6917,
+    4213, 13812, 673, 13374, 14340, 12182, 8966, 5749, 16781, 10945, 3120, 18167,
+    1133, 57, 10931, 11025, 9862, 14937, 1884, 7144, 2190, 18782, 11607, 12956,
+    13014, 10709, 17387, 14501, 18404, 1143, 10947, 19122, 18454, 10340, 710, 9863,
+    13576, 16862, 10893, 3215, 9374, 18999, 8430, 17560, 13989, 9284, 6890, 10932,
+    8432, 12052, 18413, 13991, 6017, 12717, 10289, 8724, 9729, 17441, 20358, 8434,
+    20706, 6957, 7583, 7584, 7971, 19204, 9860, 20692, 2385, 14362, 4053, 457,
+    20613, 16617, 16793, 10231, 14111, 14480, 376, 6334, 4654, 11091, 17157, 18691,
+    20455, 5071, 9718, 14365, 10761, 10405, 2259, 12024, 13901, 1156, 17296, 20630,
+    10863, 4034, 20639, 8689, 17166, 1036, 13015, 10698, 10987, 10988, 18414, 9730,
+    10329, 11009, 12965, 14427, 4927, 19530, 12449, 18804, 13838, 74, 15098, 14174,
+    15373, 12995, 17741, 5420, 17917, 7199, 20533, 10295, 20366, 2646, 5425, 20709,
+    4797, 20277, 3073, 15384, 18230, 392, 13698, 13699, 1848, 13559, 7911, 17060,
+    13762, 18675, 5773, 17937, 14929, 13733, 16402, 4567, 1656, 12780, 4568, 16540,
+    19272, 19515, 397, 5083, 17519, 16541, 6440, 13563, 1563, 12929, 5861, 10300,
+    7989, 8070, 852, 14242, 1112, 19295, 6352, 18981, 6353, 18298, 10302, 7990,
+    12397, 12750, 19788, 6676, 4192, 11016, 933, 5740, 10150, 12370, 5121, 18880,
+    13711, 11017, 7124, 11019, 20113, 18824, 403, 8071, 11020, 12372, 10564, 1279,
+    7500, 4771, 12373, 5531, 15928, 9048, 13718, 11021, 19537, 13569, 15592, 16693,
+    8072, 5981, 9055, 7721, 5750, 18183, 17977, 411, 12329, 1850, 412, 3952,
+    2390, 3298, 14103, 17214, 2685, 9695, 3302, 13842, 11688, 3924, 20438, 4021,
+    13487, 7914, 6734, 6739, 20440, 15622, 20866, 17233, 13946, 3309, 2695, 16607,
+    6958, 13454, 3582, 3583, 3584, 4243, 6518, 13861, 1554, 13423, 13424, 10594,
+    4240, 1434, 9095, 16368, 16369, 8261, 18605, 15433, 18606, 9091, 9092, 17693,
+    9983, 15437, 15434, 15435, 4245, 17694, 3408, 8184, 20206, 7342, 4308, 4697,
+    4309, 15192, 4313, 4314, 13653, 18324, 1758, 7841, 10824, 7081, 15552, 10948,
+    7403, 11504, 1244, 16133, 556, 7364, 7032, 14851, 12572, 14838, 7033, 15811,
+    2973, 13661, 13734, 11638, 6148, 16707, 19824, 16708, 10830, 19574, 15971, 15561,
+    9949, 3431, 9498, 11646, 14839, 3822, 13908, 16719, 15124, 9681, 9684, 16112,
+    1246, 9688, 7507, 16730, 7517, 7580, 9068, 7650, 13923, 16183, 1528, 15222,
+    10873, 13310, 15346, 16262, 8763, 3469, 2723, 6022, 9394, 18037, 11908, 12876,
+    15896, 5141, 13512, 18805, 1913, 14327, 11909, 12877, 19099, 310, 17742, 131,
+    17307, 15899, 6964, 3472, 6226, 12007, 3863, 15374, 11819, 1238, 12060, 11820,
+    1288, 7028, 12567, 4378, 16395, 177, 8373, 2686, 205, 20901, 20902, 17648,
+    7463, 4360, 7898, 4617, 17158, 11673, 8775, 14908, 12573, 17399, 4058, 16920,
+    6488, 9295, 15268, 11455, 181, 2490, 8111, 19102, 12574, 5604, 11692, 10424,
+    113, 14909, 9225, 1737, 11669, 3097, 5145, 8139, 16921, 10042, 15025, 17159,
+    18055, 774, 5283, 207, 9834, 3485, 4178, 17221, 3003, 9585, 3555, 3564,
+    4253, 12670, 3130, 17929, 10624, 13703, 76, 15512, 5733, 20066, 10298, 8737,
+    6337, 15028, 15513, 18676, 4746, 16208, 8738, 17698, 6896, 19877, 9719, 6804,
+    3440, 3441, 18859, 16655, 1045, 12263, 12778, 3929, 3930, 10765, 8740, 18616,
+    16409, 5435, 2687, 13529, 1657, 15117, 4541, 7706, 5237, 16213, 18291, 18813,
+    8489, 7807, 8504, 8328, 16360, 12749, 7964, 1840, 1841, 14452, 9150, 5675,
+    7379, 8334, 11845, 10434, 8217, 8218, 20805, 4730, 2332, 17315, 17316, 4379,
+    9769, 9770, 8647, 7607, 3363, 19884, 5014, 18299, 3106, 5115, 19885, 15567,
+    16601, 11468, 17370, 14149, 6981, 529, 20806, 8009, 3107, 19576, 4731, 18300,
+    20707, 19428, 5821, 18746, 15352, 17626, 3934, 12536, 17627, 14765, 18008, 20105,
+    13785, 19273, 17755, 3503, 20409, 7785, 9701, 17465, 10132, 5122, 6155, 6156,
+    5785, 14988, 13643, 10099, 12118, 15917, 18747, 20714, 8378, 7901, 17415, 17416,
+    15572, 20715, 1273, 14332, 12933, 7929, 12320, 18748, 14841, 9489, 15131, 3291,
+    16008, 15747, 1175, 2656, 12938, 6989, 7761, 9323, 15924, 14154, 12207, 20631,
+    15526, 533, 2895, 2401, 12100, 18571, 10969, 2402, 6312, 13827, 13111, 14169,
+    20723, 6786, 9049, 7819, 1382, 3028, 1237, 3064, 15110, 9492, 19655, 19582,
+    19583, 147, 1194, 12589, 12157, 2337, 20842, 2693, 2694, 16083, 18907, 11342,
+    9410, 16520, 1247, 962, 12324, 6819, 17480, 8511, 19604, 9161, 9056, 9057,
+    7076, 2761, 3421, 20869, 6914, 4972, 17725, 6820, 17726, 7631, 19555, 18168,
+    17167, 10773, 17849, 17850, 17972, 10977, 16376, 6272, 16733, 7904, 16028, 2884,
+    191, 20844, 15666, 17978, 12957, 2698, 9299, 19254, 18835, 19125, 18344, 13046,
+    7014, 8843, 4920, 9417, 9418, 2902, 12960, 16062, 7433, 1356, 18490, 8148,
+    17436, 15501, 10779, 12718, 1511, 2322, 9731, 2906, 2907, 11004, 17443, 17442,
+    17501, 8176, 17502, 2013, 8047, 2014, 20233, 5806, 7158, 17216, 1491, 1492,
+    9125, 4556, 20894, 12256, 7457, 4585, 7460, 15809, 11775, 11776, 1292, 12537,
+    12547, 6300, 17989, 14100, 257, 19936, 19668, 16508, 17938, 7084, 17258, 7554,
+    211, 17267, 7058, 4045, 19236, 591, 13744, 1062, 3050, 13976, 3648, 10953,
+    13655, 3841, 11194, 20022, 15955, 5600, 2579, 15508, 19646, 14648, 2491, 10538,
+    11332, 11195, 14945, 942, 8908, 20059, 20303, 975, 20060, 2846, 10545, 18069,
+    18070, 11639, 11988, 7545, 13000, 13977, 2496, 19919, 14012, 12264, 19777, 13665,
+    12781, 16075, 342, 2503, 4894, 1864, 11647, 19650, 13174, 15359, 2506, 15519,
+    1436, 13288, 11846, 19395, 5032, 10061, 3237, 5482, 19922, 16955, 10307, 15527,
+    15785, 4102, 18112, 347, 11651, 3045, 4574, 11225, 5865, 14674, 10310, 6510,
+    14734, 5903, 20191, 13336, 9962, 10651, 788, 5034, 19403, 10652, 348, 19656,
+    7209, 1386, 4121, 20132, 5534, 3654, 2057, 656, 708, 19662, 10322, 12220,
+    1321, 3879, 10199, 350, 1885, 10414, 1940, 7011, 16383, 8399, 4335, 11630,
+    10897, 6519, 922, 925, 16852, 4346, 17678, 5769, 18667, 18592, 6309, 4872,
+    11490, 14964, 19423, 4873, 20478, 10592, 12431, 597, 12330, 3340, 2054, 4931,
+    17325, 280, 7029, 17002, 9510, 15862, 20500, 8017, 18371, 2823, 11289, 2928,
+    17288, 10396, 4522, 2211, 4138, 15026, 11266, 3809, 16481, 17998, 20067, 14901,
+    20068, 16894, 3249, 20908, 16542, 15118, 4943, 8020, 9993, 14984, 18649, 1046,
+    926, 1700, 8335, 621, 6252, 79, 13940, 7817, 18518, 15296, 14150, 13941,
+    12425, 18881, 18818, 10399, 14187, 1225, 16459, 3824, 7343, 3513, 4904, 9380,
+    13292, 8918, 8462, 14188, 20114, 11723, 12427, 7347, 7344, 7093, 148, 8274,
+    9472, 18360, 9096, 2513, 9612, 18141, 1936, 1339, 15139, 14082, 16779, 10400,
+    1460, 15883, 3828, 4875, 8030, 8063, 674, 12183, 16734, 9190, 9191, 9069,
+    9528, 6422, 18491, 16298, 14978, 18539, 8725, 14980, 18323, 17213, 17394, 14982,
+    2784, 11209, 6656, 5921, 10705, 5922, 4584, 10922, 7743, 746, 18038, 11936,
+    11077, 3897, 7439, 17456, 18071, 19341, 657, 18029, 17874, 3600, 13153, 13748,
+    3601, 13786, 13794, 4557, 2974, 18325, 5593, 4046, 5416, 15803, 15189, 1732,
+    6776, 243, 13558, 2840, 19614, 7589, 14667, 4139, 2824, 10243, 16309, 5541,
+    1480, 11097, 7221, 19821, 17939, 10279, 12671, 15356, 13431, 13099, 17061, 7230,
+    2957, 19615, 6780, 12173, 11377, 2587, 12174, 628, 629, 13493, 2593, 6617,
+    4640, 4509, 3619, 640, 7980, 6727, 847, 16574, 2605, 5020, 6788, 5459,
+    10253, 5024, 15365, 7664, 6320, 6321, 4885, 2621, 9583, 9584, 15183, 5957,
+    20106, 5968, 5969, 17973, 17974, 17981, 17982, 19093, 19094, 13311, 16829, 15686,
+    15024, 17515, 17516, 18860, 1708, 1113, 783, 2958, 853, 11378, 18572, 11571,
+    19621, 18484, 1730, 1778, 20560, 15294, 6227, 3750, 20178, 18045, 15443, 1529,
+    578, 2772, 9226, 4059, 15448, 19872, 2291, 15449, 7222, 2497, 15964, 17259,
+    5370, 17618, 5702, 9697, 5501, 15451, 1696, 20076, 16982, 7231, 15119, 2257,
+    20171, 8329, 2260, 2738, 11200, 16104, 3111, 6354, 1437, 20088, 2261, 20244,
+    8336, 18882, 16711, 7044, 6671, 13787, 6497, 760, 5822, 4193, 17234, 15573,
+    11272, 17711, 15489, 16009, 19894, 11582, 14778, 2733, 19899, 19902, 842, 2734,
+    1832, 1537, 6873, 5990, 6877, 5912, 10118, 9459, 16470, 435, 12632, 16761,
+    16805, 592, 18031, 8557, 12852, 2677, 3070, 4263, 6329, 12861, 12854, 1402,
+    14569, 14719, 14720, 4288, 11932, 13749, 2389, 20052, 15465, 9980, 15951, 3670,
+    18372, 14875, 10425, 15714, 20179, 1823, 15903, 6228, 15863, 16137, 6462, 18587,
+    15416, 2224, 14142, 8050, 18850, 748, 20053, 11821, 2351, 1556, 14508, 15224,
+    12061, 10923, 6039, 16872, 11044, 8095, 16267, 16764, 7813, 5516, 7771, 3899,
+    5701, 14510, 14162, 15864, 11178, 1463, 2064, 7464, 18056, 393, 1481, 10426,
+    11312, 20903, 19439, 17666, 7470, 327, 11100, 10763, 19873, 11196, 1067, 14946,
+    5609, 5605, 7471, 2446, 8909, 14061, 1862, 2844, 2498, 17921, 15101, 18613,
+    4014, 6241, 11357, 16853, 19070, 10826, 4793, 4060, 16138, 601, 18590, 12286,
+    17119, 2226, 902, 5858, 17007, 1966, 602, 13934, 15965, 14524, 18584, 20745,
+    3304, 10593, 20028, 18057, 13763, 10819, 17222, 13764, 16143, 8526, 5380, 8088,
+    10601, 20032, 16656, 8975, 14902, 5859, 3004, 5238, 7972, 4938, 5381, 15966,
+    6844, 13938, 14140, 5521, 12484, 17667, 5953, 5923, 1787, 6468, 17930, 16875,
+    4794, 9200, 5882, 20698, 17010, 1766, 13425, 11108, 5373, 3552, 7912, 3131,
+    14853, 4569, 12672, 16186, 11989, 19104, 11359, 7934, 2728, 5954, 3487, 16638,
+    15071, 17363, 7752, 1215, 10781, 19208, 9988, 18563, 18560, 18978, 11426, 8242,
+    12204, 19105, 18868, 15120, 7042, 15979, 19725, 9201, 14815, 5148, 5239, 12290,
+    14818, 1076, 18082, 12115, 5935, 15972, 470, 9931, 17884, 5376, 14163, 12673,
+    1697, 8140, 15909, 15910, 18594, 8668, 9029, 5779, 2227, 18097, 19106, 8793,
+    11006, 10782, 3494, 12751, 17100, 12019, 15911, 10457, 2262, 3799, 445, 3375,
+    2361, 1469, 10175, 13175, 6355, 4834, 4829, 16858, 2704, 11791, 7965, 14879,
+    9771, 15995, 7795, 4989, 10883, 12410, 1866, 3320, 5043, 19548, 7170, 15391,
+    18986, 7072, 6361, 8377, 18869, 6097, 5307, 12693, 14541, 14819, 14822, 10962,
+    15452, 2141, 5526, 6030, 15980, 1456, 16773, 15520, 5961, 3504, 14407, 20748,
+    6534, 18565, 2934, 7489, 1146, 1673, 2730, 480, 12293, 1138, 2588, 4830,
+    3415, 10786, 19212, 16494, 20513, 3015, 5823, 2127, 12457, 12845, 16810, 1226,
+    737, 10460, 20716, 14766, 12258, 1873, 485, 17068, 15483, 4472, 12032, 15574,
+    18895, 18749, 630, 17069, 5786, 10463, 631, 18127, 10359, 18566, 7777, 2653,
+    18261, 3505, 1571, 10065, 11993, 7920, 18760, 49, 12296, 17466, 11132, 4326,
+    19213, 20749, 13137, 8658, 3902, 18503, 8189, 8190, 12761, 4575, 19172, 14254,
+    14261, 11864, 17712, 14167, 5870, 6263, 4698, 7501, 2070, 10885, 16668, 7762,
+    19913, 18573, 1204, 17271, 13590, 998, 7778, 19079, 16158, 6060, 18575, 17658,
+    8823, 13195, 14675, 18268, 2180, 17033, 12121, 14518, 5812, 19215, 13591, 10501,
+    4601, 13494, 2265, 11555, 10653, 10657, 5035, 1810, 1148, 1142, 1140, 2338,
+    10467, 14725, 19622, 15074, 187, 14002, 9963, 4836, 12764, 19372, 7348, 5982,
+    7758, 8919, 11179, 14170, 12351, 18363, 9707, 13404, 15633, 15172, 9935, 12037,
+    13498, 18525, 12438, 7820, 2881, 20002, 9473, 7571, 11806, 11802, 18918, 11661,
+    9050, 2278, 18597, 1833, 20133, 15075, 1627, 11963, 12590, 11389, 495, 830,
+    12471, 6821, 19447, 1805, 8932, 11664, 8198, 5983, 12243, 1687, 18365, 18366,
+    16115, 16034, 2606, 14549, 3396, 3311, 3310, 14268, 7642, 1235, 16570, 3655,
+    3905, 8512, 8540, 1834, 5099, 11965, 16335, 10468, 7210, 9086, 15884, 1149,
+    7632, 2302, 16433, 14577, 13628, 11448, 18169, 1992, 16290, 10774, 2607, 14578,
+    7211, 14157, 5173, 6878, 15638, 17085, 3121, 12361, 12356, 7511, 1205, 7940,
+    16735, 18405, 192, 10074, 18170, 9192, 13231, 7722, 5707, 10178, 8427, 58,
+    9193, 17390, 8281, 16253, 1814, 18836, 18368, 2483, 10225, 61, 10200, 3315,
+    11884, 10533, 8389, 10179, 1886, 20149, 11141, 11142, 17388, 17663, 1020, 20154,
+    8125, 8104, 18664, 4043, 9348, 10415, 1693, 6025, 1405, 10228, 8431, 5709,
+    17110, 12827, 1407, 6402, 7523, 5726, 13505, 18219, 8997, 10742, 10265, 14657,
+    7665, 4384, 4385, 20499, 4436, 19096, 15893, 6516, 16941, 13927, 12922, 16132,
+    1646, 15772, 7030, 4441, 6524, 12143, 6085, 12144, 19593, 3138, 11973, 6470,
+    3011, 19432, 6473, 6310, 19958, 7786, 6255, 8161, 4279, 2755, 19602, 12158,
+    4454, 6624, 7000, 18908, 6625, 17481, 9618, 5535, 19606, 16172, 16174, 2135,
+    2518, 12634, 5594, 5595, 5596, 3470, 13752, 14809, 10041, 5606, 8776, 3742,
+    14402, 733, 2930, 7268, 13415, 17940, 18003, 13359, 5613, 3777, 17467, 13837,
+    13857, 1100, 19463, 12509, 8558, 11726, 201, 2471, 12909, 3703, 13042, 19276,
+    15242, 19645, 2972, 7828, 18694, 8000, 4317, 13513, 1252, 15243, 4681, 7986,
+    15897, 2740, 12002, 19974, 12878, 8264, 10162, 13207, 17604, 11045, 338, 1525,
+    12839, 15952, 12062, 293, 6463, 18714, 4054, 178, 15956, 11417, 20023, 20054,
+    3475, 2741, 19680, 1649, 6330, 17448, 8096, 749, 1479, 7362, 15715, 5540,
+    19100, 7590, 238, 12378, 2561, 19908, 19189, 15375, 10802, 18046, 13862, 20429,
+    11712, 15084, 3160, 7835, 19714, 11713, 4136, 11283, 222, 169, 19384, 15169,
+    7976, 9756, 12189, 19233, 5601, 415, 903, 20029, 11358, 14522, 1068, 11421,
+    14487, 17743, 19819, 19465, 17593, 416, 5267, 10857, 17820, 2825, 1785, 11422,
+    6429, 10532, 10142, 1543, 17289, 1854, 12575, 10452, 1967, 6431, 4061, 19498,
+    20367, 2532, 1296, 10665, 10895, 8288, 4140, 11284, 328, 11198, 9142, 10668,
+    4787, 12063, 7465, 14448, 225, 15249, 15250, 171, 7365, 20548, 11242, 19669,
+    283, 281, 2826, 10856, 7472, 8265, 9447, 6592, 11983, 18515, 8374, 11011,
+    943, 19386, 12015, 5366, 8266, 13765, 6971, 19910, 11007, 4587, 4588, 12687,
+    13981, 2387, 19241, 7846, 17931, 16657, 1216, 5883, 11594, 20434, 13825, 10669,
+    265, 1739, 4775, 20069, 8267, 3388, 3389, 20033, 12291, 114, 11078, 19846,
+    4465, 6897, 8040, 3132, 10670, 14903, 9106, 19467, 9673, 3005, 15319, 7596,
+    9139, 7443, 20077, 9720, 17345, 15757, 14449, 16658, 10764, 2633, 6845, 19878,
+    6306, 5884, 16313, 18970, 12, 15252, 11123, 2417, 984, 4542, 14803, 19849,
+    1662, 13114, 13115, 7950, 10129, 9457, 7370, 11372, 6598, 18083, 15005, 13323,
+    13047, 15387, 16659, 1256, 3962, 6849, 15871, 7707, 7336, 15065, 8243, 6090,
+    15121, 20551, 11714, 9675, 212, 5149, 13432, 10950, 7530, 19427, 13939, 17798,
+    7604, 1057, 15378, 1077, 20882, 18084, 19524, 9674, 14184, 15253, 8496, 14374,
+    343, 6599, 5775, 2688, 15660, 15417, 12339, 11405, 13482, 9116, 10435, 10167,
+    4150, 273, 7490, 2684, 15774, 21, 7547, 19112, 20747, 1545, 2077, 6982,
+    15105, 518, 10686, 10906, 13095, 20888, 15782, 15981, 16277, 1666, 2892, 13208,
+    9757, 12433, 4369, 3364, 13847, 2981, 11715, 2832, 19640, 6056, 6307, 14670,
+    11981, 11847, 11201, 13874, 12027, 9244, 17791, 17350, 7608, 19886, 9020, 4777,
+    18098, 6094, 13362, 19911, 3495, 1114, 14585, 1534, 898, 6932, 14820, 7973,
+    15186, 17460, 2420, 20245, 7380, 14894, 12070, 7942, 266, 11190, 6933, 9554,
+    4785, 10506, 4554, 20089, 2568, 10237, 1155, 13194, 4831, 11409, 19076, 11130,
+    6608, 19892, 7307, 6609, 18750, 17422, 8158, 10737, 5405, 12976, 11507, 15484,
+    13138, 20795, 17070, 10379, 14767, 10951, 1259, 13788, 20750, 19857, 17889, 17235,
+    18546, 715, 17628, 5787, 17468, 19296, 109, 16956, 17353, 15786, 7893, 2006,
+    6246, 14823, 8297, 8302, 1572, 7745, 7308, 7309, 15127, 6943, 5894, 4520,
+    1852, 16561, 3016, 16641, 19023, 12071, 17799, 1260, 19473, 446, 17706, 15485,
+    555, 8420, 15730, 12382, 1316, 4452, 9490, 20751, 4527, 6856, 4641, 12383,
+    12939, 12758, 1856, 2007, 19580, 14378, 14367, 999, 1983, 12934, 365, 2393,
+    13196, 7875, 17713, 2691, 19961, 11102, 8292, 6546, 14189, 12558, 4409, 16370,
+    14044, 13185, 7125, 10409, 3514, 2079, 11133, 13334, 14454, 19502, 14618, 11227,
+    299, 2437, 8824, 14676, 5553, 20115, 15327, 5659, 12038, 15731, 12191, 14865,
+    19792, 3515, 16669, 11135, 12702, 1274, 19520, 4482, 15876, 3556, 13495, 7829,
+    13496, 13884, 277, 17714, 878, 14195, 14528, 13129, 1383, 14394, 7311, 1831,
+    2050, 4786, 914, 3967, 13974, 2876, 11958, 14197, 19527, 8963, 1628, 1719,
+    4837, 9613, 9846, 9493, 20754, 4274, 5622, 19477, 2060, 14663, 5684, 2339,
+    10697, 10517, 6742, 4909, 18483, 19999, 153, 20134, 10972, 9964, 1404, 7981,
+    1915, 13499, 15173, 6866, 10509, 10513, 19734, 1158, 7956, 789, 6787, 18269,
+    4648, 12039, 9097, 6273, 18389, 7578, 11586, 11585, 8497, 3328, 16430, 13049,
+    4973, 19298, 18151, 16336, 1631, 1632, 13116, 10772, 5471, 14083, 5165, 4882,
+    2440, 20880, 10912, 9189, 19914, 5907, 20498, 6874, 6315, 1188, 2571, 2572,
+    1538, 963, 1527, 7579, 4160, 9042, 523, 4161, 12271, 964, 2397, 20585,
+    20467, 15589, 11729, 12384, 3325, 10913, 5660, 16675, 9508, 6875, 2314, 14461,
+    5174, 12272, 15769, 6629, 4330, 18530, 8580, 10755, 9564, 13375, 20586, 19408,
+    11731, 2151, 6192, 2636, 13232, 1189, 12419, 12417, 5798, 6950, 12353, 8046,
+    2552, 16676, 7736, 11500, 267, 194, 7512, 17844, 3547, 10238, 14212, 10254,
+    6316, 14502, 20595, 2699, 16848, 8429, 1092, 7453, 17804, 13032, 17859, 17855,
+    10869, 15794, 6285, 882, 11026, 4458, 20150, 20142, 8277, 10523, 6713, 16684,
+    9130, 14531, 278, 14214, 9569, 9755, 12841, 14756, 11219, 17664, 8638, 1093,
+    13897, 19300, 10918, 16384, 7729, 6071, 8859, 8311, 5768, 18467, 9529, 9453,
+    12047, 12048, 19301, 12053, 8400, 16299, 18415, 10121, 12823, 1323, 18506, 2318,
+    16687, 13506, 9813, 7730, 10266, 8719, 19303, 9732, 14532, 20834, 8883, 2908,
+    15332, 2639, 6891, 7666, 8435, 8890, 10757, 19931, 4955, 4939, 11795, 17244,
+    11725, 14299, 13836, 7844, 18588, 4264, 17993, 4561, 4291, 294, 3763, 19920,
+    11695, 2891, 7987, 10455, 15907, 4726, 5293, 1218, 16622, 10281, 1974, 4469,
+    2790, 17019, 6903, 10458, 1567, 7340, 13534, 3372, 18819, 1792, 142, 284,
+    17020, 6904, 3373, 8959, 10966, 622, 1476, 2916, 3365, 18113, 4322, 13176,
+    7902, 17531, 3321, 6157, 15091, 16628, 3376, 6860, 7242, 17630, 16224, 10438,
+    13948, 25, 12212, 26, 19915, 2806, 19858, 4036, 13955, 9058, 12592, 16889,
+    18017, 6879, 13397, 6880, 20596, 18184, 8967, 682, 8712, 16636, 16637, 15685,
+    17155, 11826, 11836, 19525, 856, 7609, 19526, 8463, 3800, 298, 300, 8387,
+    18838, 8406, 15610, 3167, 13608, 9094, 6492, 5548, 16664, 6498, 18821, 19793,
+    6910, 15792, 14935, 3184, 7060, 1780, 18286, 4141, 12145, 19572, 12611, 20567,
+    19577, 3270, 2422, 14065, 16777, 20578, 20587, 12354, 9165, 20597, 1993, 3284,
+    20380, 3729, 1371, 5190, 18719, 13662, 11334, 18614, 10144, 11269, 11837, 19543,
+    10020, 9676, 11335, 11431, 9317, 4023, 3757, 17101, 7171, 7172, 10861, 20807,
+    19693, 18009, 9324, 13438, 6677, 18761, 18014, 11870, 20143, 3657, 11558, 3658,
+    19563, 8066, 14355, 18794, 15827, 6322, 6338, 6356, 6098, 12915, 2577, 7329,
+    20018, 19355, 16649, 14899, 17215, 17000, 4235, 8294, 4336, 5144, 14484, 2841,
+    16942, 1369, 13697, 8110, 17608, 13700, 15467, 10427, 10428, 15238, 2090, 15865,
+    19161, 462, 132, 19425, 311, 6965, 8214, 13609, 5607, 3752, 5233, 4958,
+    1413, 17059, 10477, 6026, 3844, 12366, 5517, 18058, 15958, 16767, 17400, 19426,
+    3753, 14536, 13582, 7473, 17619, 19292, 906, 16807, 18493, 17121, 11696, 19822,
+    9230, 2092, 5234, 10145, 20885, 10546, 758, 17011, 6027, 19670, 20760, 13766,
+    13767, 18854, 3814, 3006, 10044, 10877, 1455, 15667, 3100, 31, 907, 133,
+    20281, 9398, 16358, 8114, 14930, 1490, 13709, 5877, 5862, 17113, 8151, 16948,
+    6850, 7115, 20078, 7116, 13416, 15031, 5466, 17520, 4255, 16492, 13307, 16608,
+    17824, 19138, 5888, 5116, 5153, 7711, 15392, 16413, 8219, 20287, 15982, 1663,
+    13637, 1048, 19726, 19727, 15914, 5154, 5958, 5242, 1612, 15398, 14881, 20579,
+    20851, 20269, 11758, 7206, 15996, 13350, 10862, 15997, 12412, 11924, 7176, 4946,
+    19912, 18114, 20107, 122, 15399, 9152, 9033, 1420, 15454, 16609, 19307, 3838,
+    17073, 4553, 17960, 16225, 19141, 5898, 16993, 10464, 8162, 17793, 18494, 13910,
+    15580, 13909, 12416, 10066, 10732, 6618, 11113, 123, 17631, 2096, 17718, 14410,
+    7131, 10491, 6867, 7765, 4411, 15749, 1472, 11959, 5250, 17544, 8831, 52,
+    6373, 6382, 10176, 19308, 16731, 5251, 10658, 10569, 2236, 10889, 19628, 5984,
+    428, 5169, 17106, 2029, 9062, 16287, 2608, 7212, 11587, 9166, 15220, 16116,
+    18171, 6388, 5873, 2515, 17840, 17841, 8838, 14554, 15055, 16613, 3829, 13573,
+    19701, 5255, 18185, 16498, 16820, 13550, 6883, 433, 7254, 17555, 62, 17856,
+    13019, 13918, 10202, 17205, 17780, 11774, 8850, 1584, 8126, 3037, 9088, 17563,
+    6119, 9534, 16063, 12962, 9424, 10756, 9831, 9733, 13309, 14658, 17503, 20360,
+    19087, 19088, 12563, 17815, 4551, 17817, 5518, 5284, 13871, 1192, 1191, 13651,
+    9959, 1242, 1245, 14824, 20850, 1147, 17029, 5970, 18337, 12298, 3857, 11487,
+    19095, 18643, 13052, 11371, 3865, 4062, 9231, 3795, 12612, 14812, 11109, 14931,
+    14039, 19850, 8481, 8480, 20837, 10483, 5810, 15469, 15217, 1493, 6158, 11796,
+    18382, 20721, 15470, 15056, 8487, 8550, 10203, 9425, 10635, 2753, 15613, 10534,
+    509, 19485, 13925, 13926, 10637, 20306, 12853, 202, 11754, 3424, 3384, 2678,
+    8766, 4929, 6135, 7297, 572, 16915, 1647, 2205, 13254, 13044, 19248, 12680,
+    12008, 18715, 4292, 15810, 1253, 13315, 17218, 3671, 15900, 20675, 8896, 16850,
+    1102, 2380, 12881, 777, 15246, 2842, 19647, 9984, 1781, 18047, 4271, 4562,
+    3246, 8662, 11913, 13928, 4357, 14907, 6796, 13395, 15431, 8324, 7358, 9985,
+    17609, 9882, 10385, 14112, 19011, 5191, 3810, 442, 6968, 3098, 4407, 17744,
+    16269, 1950, 2091, 11188, 13865, 5672, 16768, 1899, 20389, 1900, 14143, 312,
+    14144, 6232, 15779, 7111, 4629, 6141, 10016, 11456, 603, 15471, 134, 3733,
+    3866, 18059, 4063, 10722, 15959, 5608, 17290, 3161, 16786, 19820, 17682, 9145,
+    13077, 3463, 10085, 19686, 5042, 19939, 2225, 19206, 20864, 3162, 13866, 19356,
+    3425, 8777, 9653, 6593, 1650, 14182, 12146, 3923, 10723, 16534, 16273, 8004,
+    11640, 14489, 16101, 20034, 4788, 16537, 6508, 6435, 4620, 378, 10547, 18072,
+    17822, 17825, 13768, 10955, 579, 3409, 17932, 9232, 908, 10860, 8289, 5285,
+    330, 3672, 20183, 2499, 2172, 17650, 4015, 271, 10615, 4300, 11784, 12804,
+    12974, 10054, 13450, 14146, 19757, 16209, 18677, 13523, 4959, 15305, 19512, 10726,
+    11014, 18561, 2828, 20070, 19468, 1270, 2583, 4658, 1071, 7333, 138, 4071,
+    6595, 208, 3410, 7861, 10711, 20395, 607, 9361, 1300, 13324, 14117, 1970,
+    11314, 13757, 4789, 19469, 17748, 1615, 7334, 13769, 19944, 9362, 10088, 8897,
+    12924, 19513, 19382, 778, 19594, 20071, 9399, 3133, 9515, 13613, 8784, 8375,
+    18558, 13935, 17228, 13983, 11947, 19778, 11787, 8794, 17941, 16482, 19851, 8795,
+    13219, 4754, 7781, 505, 12863, 16623, 272, 12864, 928, 20620, 1865, 18085,
+    2213, 16989, 20313, 6666, 20847, 3567, 3589, 18650, 3630, 4589, 7848, 8529,
+    19544, 9113, 18248, 17668, 5294, 4513, 18086, 13773, 4470, 19266, 9721, 4084,
+    6976, 5382, 4962, 14695, 4865, 15516, 8090, 13002, 117, 77, 7557, 17942,
+    20552, 8007, 20079, 12453, 15032, 13183, 13182, 5737, 7407, 7337, 17180, 3412,
+    20510, 18734, 19294, 0, 18375, 7057, 9391, 19595, 17293, 12833, 19779, 2650,
+    11788, 12235, 5676, 4963, 6762, 20482, 17229, 14388, 13267, 19786, 444, 14972,
+    8268, 7236, 11708, 519, 4090, 13065, 15066, 7610, 15983, 8464, 9364, 3932,
+    11792, 15719, 7685, 4323, 14243, 9003, 12531, 15007, 18653, 10093, 344, 9458,
+    11361, 20484, 2854, 17063, 15125, 19370, 139, 4732, 623, 2793, 5117, 20685,
+    19957, 12895, 475, 4546, 6603, 5780, 15393, 11124, 6443, 14912, 6357, 16549,
+    9677, 6041, 13435, 1241, 3872, 14151, 10232, 15841, 8669, 8670, 3175, 12368,
+    18479, 14389, 7381, 14753, 16712, 8246, 20577, 13875, 1315, 3717, 15568, 7237,
+    8671, 854, 16259, 3996, 14698, 20090, 8337, 8913, 6604, 20553, 9245, 8677,
+    11953, 934, 9774, 2228, 12119, 10335, 11858, 11859, 1121, 5004, 1326, 2731,
+    3801, 11203, 361, 362, 6033, 20717, 1674, 19358, 6256, 8815, 11379, 18883,
+    18884, 4734, 7714, 3142, 14615, 4371, 15455, 2864, 2423, 3679, 1617, 19600,
+    11925, 18989, 17469, 18885, 12676, 18115, 13248, 12867, 2080, 8649, 11797, 20555,
+    4103, 7870, 8342, 20779, 20780, 19694, 4801, 3852, 3873, 13538, 12413, 10839,
+    15400, 5048, 9598, 5213, 6944, 18010, 1870, 7444, 7415, 1675, 20889, 9005,
+    12151, 19988, 2081, 17297, 7384, 447, 6810, 20580, 20632, 857, 11380, 3078,
+    1952, 1477, 10182, 5696, 6610, 4905, 16152, 3204, 12120, 2725, 4986, 2950,
+    9799, 19959, 12739, 10504, 4230, 4555, 11410, 19578, 18233, 15298, 13249, 3392,
+    17792, 4200, 15581, 15490, 3274, 6499, 20722, 6547, 17961, 13592, 16080, 17538,
+    17475, 2028, 6548, 2097, 18825, 5310, 19475, 15790, 11536, 560, 17688, 6099,
+    16961, 13103, 17632, 8303, 17423, 514, 5899, 8163, 7046, 8164, 14069, 3938,
+    16643, 15299, 20091, 6678, 10654, 10067, 1999, 5615, 5558, 8984, 8650, 14993,
+    10733, 18762, 18631, 10105, 14168, 17132, 17133, 17656, 19794, 11537, 17836, 6264,
+    6990, 17837, 1954, 3350, 18751, 20796, 15491, 10106, 14825, 6257, 6991, 7763,
+    12490, 18447, 12992, 5828, 9471, 8565, 12740, 16529, 11616, 13828, 4280, 14543,
+    8422, 15670, 18763, 1601, 9661, 7446, 13601, 2000, 11524, 16726, 6502, 18142,
+    19584, 4117, 11136, 10313, 8467, 12943, 4709, 6689, 7447, 14434, 17758, 19802,
+    354, 13275, 19039, 20691, 10492, 14262, 6511, 17719, 7001, 5872, 4347, 3802,
+    19521, 12078, 9891, 14379, 19040, 16727, 12944, 13719, 19965, 2340, 19177, 14994,
+    9330, 12940, 14622, 12762, 19528, 14075, 13647, 14458, 7880, 16015, 4703, 11803,
+    4412, 4413, 14371, 11228, 14678, 4483, 17236, 2897, 11083, 6267, 14046, 4645,
+    2083, 12159, 1277, 12102, 5704, 10111, 17037, 4383, 4394, 20588, 15283, 12279,
+    17671, 2898, 6503, 7799, 20856, 2726, 9461, 860, 20325, 13193, 16087, 6175,
+    8925, 5985, 18527, 12129, 5049, 4281, 4285, 15175, 5687, 11807, 13250, 2342,
+    11386, 18661, 5564, 6768, 5625, 5796, 4974, 10973, 18152, 4397, 7822, 4913,
+    4914, 1197, 9970, 7099, 2779, 20489, 8567, 8485, 1577, 2237, 8690, 16904,
+    12418, 14004, 3684, 15070, 4840, 19405, 14269, 8611, 9562, 9012, 10321, 9477,
+    1498, 14270, 7883, 1916, 14628, 794, 9619, 7312, 19761, 19479, 13891, 19629,
+    9937, 10514, 10944, 17673, 14919, 11387, 20421, 13276, 16035, 12710, 5386, 6558,
+    2238, 6420, 17587, 12178, 17186, 18396, 3611, 17245, 20005, 12246, 20839, 2272,
+    11762, 13958, 5685, 8204, 19809, 20871, 19123, 13376, 16036, 2101, 2943, 3637,
+    4329, 10518, 15887, 12221, 12836, 9207, 9340, 12247, 16434, 13093, 3685, 19588,
+    15286, 8533, 19182, 14029, 3329, 1634, 14632, 10193, 7427, 1690, 14277, 7643,
+    7644, 2944, 5991, 6184, 11127, 16522, 15301, 11034, 13071, 20329, 15057, 19449,
+    3883, 12472, 12807, 5387, 12085, 4675, 9373, 8543, 4398, 1939, 16188, 13652,
+    20708, 13181, 6282, 3157, 7263, 9565, 6729, 2001, 19047, 14465, 13894, 6750,
+    14558, 9195, 11068, 18341, 16090, 14349, 13340, 20860, 17108, 1638, 4348, 7428,
+    20863, 18186, 12357, 11764, 17431, 8581, 3947, 5939, 2665, 6393, 14345, 1037,
+    11666, 1691, 1958, 20430, 4975, 6283, 7024, 6505, 12420, 19531, 6630, 12185,
+    2716, 18019, 825, 14159, 13475, 9196, 8902, 1281, 10204, 18317, 14712, 14504,
+    10341, 11887, 15177, 871, 6107, 6399, 12046, 10871, 11029, 17903, 4419, 7801,
+    18369, 11086, 12430, 17487, 11888, 10326, 19704, 4979, 2104, 6199, 8169, 11686,
+    2765, 1941, 4510, 10342, 18602, 20156, 5869, 12049, 8620, 8585, 13133, 9571,
+    8851, 2321, 9713, 10417, 6010, 11164, 9525, 20151, 4402, 3217, 19055, 8860,
+    3833, 20599, 14216, 8944, 6797, 1945, 12444, 20337, 9535, 17438, 8867, 20336,
+    1608, 7015, 3539, 14229, 5711, 10989, 18949, 9426, 8368, 6927, 16385, 4926,
+    7454, 16590, 9287, 18419, 6582, 18349, 18642, 18471, 16473, 11075, 1029, 1358,
+    8407, 7456, 13993, 13509, 15548, 2276, 12720, 12635, 1187, 7359, 18955, 9817,
+    8887, 2323, 9734, 2641, 7669, 17589, 8438, 8413, 20361, 8600, 8759, 256,
+    10753, 18962, 9290, 4884, 12109, 2206, 5803, 16769, 18716, 18060, 12012, 11153,
+    16945, 1482, 1971, 11951, 7774, 18087, 7605, 16146, 17014, 5268, 18870, 8186,
+    8458, 8076, 14041, 15984, 13, 17890, 11798, 2004, 1771, 12321, 8077, 7796,
+    8078, 7798, 2035, 13293, 4756, 18264, 16778, 16644, 18764, 12125, 16565, 17842,
+    4455, 15820, 14592, 7135, 11159, 5536, 14828, 5721, 16970, 11348, 16117, 16633,
+    2005, 13501, 13377, 5101, 1994, 18187, 3536, 18786, 2154, 5805, 20015, 19916,
+    2198, 1065, 15866, 11827, 1069, 1070, 15349, 7474, 12066, 1742, 13224, 1772,
+    13228, 20209, 14334, 14335, 8832, 2427, 18775, 8839, 4921, 2484, 3471, 14099,
+    6521, 19715, 10539, 10540, 17683, 10541, 2292, 17595, 14876, 13614, 2500, 13399,
+    17015, 17263, 13872, 1136, 7611, 11570, 11991, 12532, 14244, 12411, 19193, 8977,
+    18116, 4004, 19989, 17831, 1139, 6034, 2543, 6258, 3025, 19803, 19197, 15671,
+    1910, 879, 14829, 7136, 13408, 18313, 2964, 7349, 5992, 2326, 18172, 2553,
+    3256, 6751, 8991, 884, 3218, 6731, 6583, 13860, 11154, 3269, 20396, 18249,
+    12434, 18099, 13262, 12266, 7894, 16604, 17268, 2938, 5936, 5937, 4704, 12213,
+    6171, 18153, 11160, 5938, 3281, 17904, 16596, 15828, 4825, 10619, 10125, 10126,
+    30, 7019, 3199, 18909, 570, 593, 608, 11460, 11461, 613, 1346, 10014,
+    5210, 1108, 11457, 9137, 6436, 19542, 13136, 10644, 15306, 17230, 3590, 12930,
+    16361, 7408, 10616, 5212, 12533, 3176, 13268, 14574, 11321, 7416, 3366, 2364,
+    558, 13155, 13179, 10068, 13140, 13885, 18705, 15310, 5311, 6679, 14459, 13156,
+    9664, 10617, 10030, 15058, 12969, 1461, 11763, 9657, 19559, 13212, 19560, 10205,
+    9572, 12636, 3041, 13739, 2768, 10422, 7587, 9986, 11930, 11584, 10702, 11933,
+    2679, 16268, 2015, 3845, 17614, 10817, 890, 4072, 13524, 3101, 12390, 11948,
+    18250, 15973, 5084, 17652, 78, 17348, 7917, 12398, 17354, 3112, 2594, 9702,
+    12414, 17659, 19142, 19145, 14011, 14021, 19907, 895, 18551, 2643, 14022, 8559,
+    10874, 15236, 3706, 4928, 14965, 19933, 12514, 848, 19424, 10347, 2313, 5943,
+    2953, 5140, 1287, 20561, 2038, 15370, 3709, 2473, 15953, 15244, 9981, 12512,
+    11934, 13356, 11618, 5142, 12003, 15804, 15805, 17255, 14104, 13027, 4586, 6732,
+    1733, 15806, 15160, 7357, 14594, 19937, 20024, 12009, 10293, 4682, 15436, 7200,
+    7201, 13075, 7678, 5421, 14509, 12726, 6229, 750, 751, 4337, 15726, 20175,
+    3731, 16873, 7591, 5583, 11043, 11937, 3864, 17003, 17008, 12379, 17918, 15776,
+    19158, 19010, 5203, 17449, 1557, 1558, 2580, 18608, 3341, 5602, 6084, 11782,
+    10639, 11107, 10083, 2447, 10349, 10294, 1824, 11259, 576, 13255, 20025, 11330,
+    11241, 20508, 19238, 4604, 9312, 10084, 19385, 3920, 11152, 8772, 9761, 1169,
+    3921, 15509, 5603, 10542, 10143, 13929, 7440, 19293, 15251, 15269, 15270, 5281,
+    8778, 10277, 17922, 3614, 3811, 18611, 14852, 20061, 19681, 4655, 19541, 17401,
+    14060, 8112, 7277, 7366, 16697, 12516, 18061, 6432, 20180, 12684, 11674, 5946,
+    10296, 503, 19387, 20342, 8562, 18591, 4656, 5426, 4296, 3640, 10043, 14113,
+    5519, 11635, 2200, 3710, 19940, 14234, 11038, 1614, 9227, 11301, 944, 11941,
+    14108, 10827, 7404, 13124, 20390, 13610, 8627, 17120, 7593, 4064, 11243, 10453,
+    14513, 17594, 6304, 18554, 4828, 546, 17161, 9396, 9513, 2620, 9833, 16698,
+    11707, 19388, 7160, 18289, 11221, 6972, 18073, 5885, 5924, 19278, 1658, 18243,
+    15514, 5502, 6659, 17620, 9107, 14119, 6339, 3565, 16834, 4073, 13117, 13218,
+    20035, 18354, 15837, 16102, 7847, 20311, 6778, 9835, 9839, 115, 3134, 14813,
+    10602, 8628, 17883, 10280, 12685, 7064, 11697, 15559, 16598, 16703, 5430, 17012,
+    14236, 8089, 14693, 12292, 7466, 3587, 20238, 13034, 11641, 17223, 16876, 20072,
+    4863, 5734, 10479, 6074, 15320, 11990, 11211, 15812, 12576, 9315, 18074, 6437,
+    7226, 12095, 6736, 6805, 19772, 13663, 20568, 1217, 3625, 5948, 6340, 9314,
+    1372, 6040, 5585, 11059, 17224, 7113, 9114, 12525, 15562, 19758, 7708, 5114,
+    345, 9994, 20570, 18617, 15974, 985, 3170, 5776, 5436, 18088, 11756, 18478,
+    8419, 5240, 8490, 5134, 8741, 4524, 4085, 15838, 8976, 2110, 3963, 18089,
+    18861, 15033, 8505, 5075, 7117, 6441, 1826, 7283, 10130, 14304, 1618, 11336,
+    16410, 13584, 15161, 8258, 11624, 10957, 5150, 7167, 16543, 13488, 10905, 15104,
+    18562, 16624, 16314, 15006, 3442, 14237, 15215, 7531, 1239, 14816, 8796, 14013,
+    14120, 8630, 14014, 14668, 3201, 8535, 8330, 8910, 15517, 15759, 19166, 5777,
+    2791, 5393, 13089, 6667, 19639, 13220, 4091, 4832, 16859, 13848, 13984, 17317,
+    2142, 19651, 17828, 7966, 15783, 5118, 15257, 3108, 5299, 15762, 7382, 13489,
+    9004, 6031, 14453, 20554, 2935, 12294, 2729, 7561, 20625, 15985, 16602, 11848,
+    4693, 5044, 17371, 9151, 14651, 20246, 11406, 5243, 1416, 13876, 11793, 3736,
+    19985, 9591, 10795, 7411, 14699, 2263, 8631, 19760, 11648, 3791, 14152, 14880,
+    11505, 2589, 18871, 10836, 18703, 9592, 4342, 10303, 7238, 9246, 9772, 18301,
+    2362, 12616, 5703, 18872, 10907, 13535, 782, 2113, 5527, 18987, 8338, 6057,
+    12399, 17372, 12097, 14845, 10388, 20039, 18331, 10304, 520, 18982, 15729, 13101,
+    3774, 12400, 18983, 7900, 6358, 13490, 18984, 13245, 9593, 20700, 3203, 11974,
+    6672, 10357, 11506, 16187, 18739, 18985, 13567, 13586, 12977, 5788, 20370, 6611,
+    11112, 18752, 12538, 14989, 12617, 3252, 3680, 19474, 995, 15787, 15763, 2865,
+    15486, 15669, 13005, 16720, 1227, 15627, 5300, 4380, 17470, 5444, 17130, 10284,
+    7903, 10023, 18380, 17471, 18627, 5406, 10389, 13634, 10133, 19269, 6044, 10715,
+    4947, 1796, 3506, 11212, 10100, 8981, 11954, 11955, 10101, 14862, 2282, 15528,
+    1131, 15163, 10360, 5962, 10559, 16957, 6259, 11351, 6540, 6605, 5554, 3979,
+    16460, 18117, 18358, 19601, 13712, 6945, 1623, 5824, 14587, 18753, 632, 10461,
+    13668, 15107, 13620, 18567, 7417, 3143, 15184, 6857, 6861, 12539, 17377, 14597,
+    9408, 6100, 19024, 10738, 332, 18657, 12697, 20485, 9034, 1327, 17417, 2115,
+    10967, 20633, 15361, 13669, 9950, 18442, 8321, 8191, 3990, 6680, 17030, 9468,
+    15529, 4275, 16260, 18443, 11676, 7126, 17539, 14619, 19034, 14411, 19035, 8920,
+    17756, 10234, 20542, 1682, 7921, 14517, 14441, 15328, 9308, 4609, 13197, 10488,
+    19518, 13715, 18128, 9787, 9874, 11759, 15492, 8825, 1106, 15925, 16010, 15672,
+    12152, 19399, 13672, 14255, 23, 12349, 14190, 19173, 16928, 18265, 12941, 6059,
+    14256, 14421, 10886, 14435, 13673, 13037, 14, 11252, 1984, 1923, 11262, 15739,
+    1176, 10410, 4480, 2896, 5247, 5871, 16159, 20634, 2797, 20116, 16842, 4155,
+    6992, 5657, 4453, 20689, 14677, 14738, 14309, 641, 6906, 5971, 4994, 18306,
+    4393, 9409, 20108, 17540, 13497, 9952, 18448, 2117, 9704, 8442, 9724, 16639,
+    858, 14529, 18896, 16916, 5623, 642, 790, 20125, 6785, 7994, 13597, 13405,
+    2778, 10314, 149, 9560, 5590, 5532, 18596, 1384, 3724, 18526, 4996, 9953,
+    12428, 18770, 11583, 6374, 17322, 1496, 11804, 16113, 6375, 9614, 9474, 9411,
+    7094, 5036, 2266, 9499, 20003, 4284, 12179, 8681, 17478, 1195, 6911, 2231,
+    2119, 15174, 11158, 14737, 17811, 16084, 10315, 14623, 10565, 13406, 5166, 8921,
+    8423, 15329, 1753, 4311, 3968, 17105, 17894, 9965, 20705, 10009, 7821, 9847,
+    11366, 13953, 19641, 19623, 20497, 17038, 5794, 6082, 6690, 17384, 14003, 9051,
+    2346, 14779, 17672, 6745, 2267, 18485, 5454, 17237, 13954, 4838, 18450, 16566,
+    20772, 8262, 17039, 8987, 20126, 15532, 11513, 18919, 6915, 11709, 2658, 5986,
+    7006, 15885, 11193, 6274, 11218, 15536, 14275, 12081, 12082, 16029, 9627, 16168,
+    17274, 3353, 5832, 10469, 13092, 14271, 8532, 19807, 2268, 18143, 19762, 15363,
+    13372, 14550, 1499, 17243, 8199, 17795, 13465, 15140, 20326, 13120, 5365, 667,
+    13338, 1340, 1341, 13915, 15053, 11730, 9162, 15537, 13236, 13230, 1688, 7292,
+    1689, 5688, 6822, 8541, 1539, 4327, 2383, 5472, 14084, 13956, 11368, 5127,
+    19179, 9381, 5473, 4122, 5252, 5312, 16337, 6694, 13339, 16169, 18972, 9656,
+    8384, 11040, 18783, 9194, 10368, 19359, 2627, 5799, 19409, 16736, 18927, 8751,
+    13813, 17168, 9271, 15423, 20654, 18531, 5993, 1159, 8989, 2945, 17851, 193,
+    5751, 19810, 1343, 9972, 2573, 2609, 18173, 14341, 11516, 7513, 14462, 12358,
+    6185, 20593, 8937, 11066, 5021, 7140, 3880, 13233, 6275, 14313, 5994, 1956,
+    14467, 14158, 3066, 13246, 20375, 8358, 867, 8938, 10288, 13686, 13959, 10323,
+    11039, 18458, 18459, 10201, 7145, 11885, 683, 6394, 5226, 13016, 2373, 15795,
+    14684, 18345, 18346, 3312, 2191, 6104, 7257, 8445, 7725, 36, 11746, 20598,
+    15540, 868, 4716, 12090, 18460, 891, 8278, 3832, 1185, 10078, 6714, 15601,
+    9855, 19313, 9712, 8844, 18601, 17674, 9570, 14138, 20144, 18465, 3216, 15462,
+    5914, 16747, 11234, 13577, 804, 1349, 10581, 9349, 6574, 11773, 13238, 1692,
+    4721, 873, 6113, 16441, 9530, 12385, 5182, 18468, 12961, 8861, 7258, 16586,
+    18469, 14322, 15605, 16749, 5710, 17184, 20335, 9419, 8364, 3316, 3694, 5577,
+    8365, 13964, 9307, 18470, 10261, 6408, 8994, 6716, 18472, 3910, 9179, 18208,
+    6580, 19128, 1357, 2523, 12812, 6644, 8401, 3695, 14006, 19001, 20604, 3953,
+    13507, 8622, 8402, 2275, 12633, 18540, 12092, 3641, 4845, 12772, 17577, 5261,
+    18508, 13121, 19320, 9735, 17568, 8720, 10290, 13391, 14533, 2640, 6892, 1400,
+    18509, 5264, 255, 20359, 8436, 8411, 10758, 15367, 9739, 17251, 16391, 17580,
+    4352, 17584, 18967, 6077, 776, 10406, 4856, 2742, 5879, 16531, 16532, 6023,
+    5399, 9220, 19364, 20459, 7320, 19509, 16696, 1782, 20563, 19262, 19263, 1154,
+    17610, 11942, 20181, 3867, 11048, 7278, 15689, 11693, 18062, 9514, 2072, 11423,
+    7772, 11244, 17402, 7773, 11280, 10641, 1506, 9093, 4960, 7837, 3342, 4858,
+    16770, 20062, 4883, 4859, 15557, 12198, 775, 2448, 16210, 19879, 20344, 7899,
+    19688, 4074, 227, 16704, 3411, 9303, 20549, 17122, 7475, 14583, 11302, 7281,
+    11291, 14490, 14491, 909, 17651, 15016, 5092, 20397, 19514, 2913, 15617, 13704,
+    8974, 1788, 5860, 20304, 5522, 14038, 8441, 14971, 6851, 17016, 5383, 12728,
+    9115, 5778, 17622, 16895, 16896, 16362, 18287, 15815, 20240, 17701, 13774, 15475,
+    15034, 10407, 19267, 7775, 5403, 8536, 16214, 20347, 17114, 19881, 11699, 17365,
+    5927, 4866, 1532, 5889, 7849, 1611, 3676, 13433, 17826, 5955, 0, 14662,
+    7118, 12846, 9140, 15986, 4092, 7284, 16713, 11757, 14973, 20571, 15008, 15380,
+    5077, 11362, 8482, 17521, 17022, 3933, 1793, 12931, 5549, 15987, 13877, 5340,
+    17192, 8023, 7532, 16550, 15988, 17373, 5155, 20496, 7712, 2855, 16714, 6253,
+    15915, 17374, 9716, 5119, 17526, 5781, 10174, 7412, 2705, 481, 3874, 9203,
+    8223, 6058, 15218, 15998, 2365, 15844, 5407, 1508, 4152, 15788, 6811, 2229,
+    3980, 11652, 12458, 13102, 15999, 12459, 16799, 1485, 17532, 17533, 18118, 7620,
+    18886, 4381, 12794, 11472, 16886, 15472, 13621, 1470, 13436, 16884, 10908, 4528,
+    15661, 1574, 5343, 8180, 20210, 3275, 16198, 5900, 3981, 8985, 17074, 16812,
+    5829, 6862, 6549, 643, 18383, 20372, 15582, 15165, 13351, 16016, 11114, 11115,
+    1330, 17380, 7285, 7290, 18897, 10154, 13272, 15629, 19490, 16800, 12464, 12979,
+    10107, 5791, 17034, 19696, 15493, 3681, 12543, 14336, 17633, 9121, 20371, 6948,
+    4430, 4757, 381, 5559, 19143, 16199, 13829, 9040, 718, 4646, 15208, 14624,
+    1509, 13337, 3554, 1005, 5867, 16672, 16165, 15929, 16017, 19219, 5319, 5345,
+    16018, 19178, 16883, 10696, 13353, 12479, 17774, 17195, 10316, 8926, 18451, 15879,
+    12945, 4578, 17586, 12200, 9309, 16019, 658, 795, 2239, 9620, 6559, 13904,
+    18154, 9478, 11388, 14312, 18155, 14729, 7633, 20727, 19220, 5626, 17969, 20135,
+    154, 15634, 9370, 5170, 11161, 12847, 7291, 9971, 8263, 13409, 2327, 19450,
+    6566, 16037, 16038, 16039, 18156, 16634, 1813, 5835, 1391, 17843, 14555, 12798,
+    17550, 16341, 12222, 7724, 2747, 3354, 13546, 6825, 3884, 14089, 9063, 18928,
+    9167, 15059, 13443, 3858, 3686, 17551, 17246, 8443, 10138, 14665, 18174, 7213,
+    10177, 7264, 6881, 18455, 18929, 18188, 17169, 8390, 14519, 19376, 1161, 14346,
+    16046, 12768, 2245, 8945, 5940, 20354, 16743, 9278, 15499, 18189, 16683, 19702,
+    6000, 2478, 11069, 8391, 13020, 16381, 7852, 17206, 7147, 1888, 2718, 17781,
+    5354, 8446, 807, 12958, 8852, 10587, 434, 13107, 9714, 8312, 141, 17277,
+    8127, 14051, 9100, 8868, 9536, 7651, 9090, 17564, 16064, 16750, 9427, 17860,
+    1165, 12824, 19131, 8447, 2277, 7662, 1847, 4846, 7526, 1542, 10269, 14659,
+    8449, 20362, 8452, 9291, 2331, 18969, 19679, 19707, 11189, 19874, 11292, 1616,
+    19013, 42, 15628, 5186, 7634, 7645, 4167, 17869, 244, 2997, 17871, 17692,
+    20818, 14000, 3593, 11220, 2055, 7862, 19328, 3026, 12160, 18547, 12186, 11549,
+    313, 11246, 1489, 6541, 11204, 3205, 2049, 18765, 19491, 719, 3027, 355,
+    1006, 2051, 18662, 18693, 3219, 17304, 1624, 11042, 11055, 11617, 7298, 10598,
+    14429, 10621, 8500, 12882, 9977, 3734, 10017, 10642, 4361, 15904, 17512, 4443,
+    463, 14118, 6660, 4686, 18678, 4446, 13615, 10625, 2829, 12016, 12734, 12688,
+    20699, 14721, 15975, 9996, 7952, 12025, 15874, 4733, 16000, 8672, 8678, 11722,
+    6159, 4372, 19990, 506, 12698, 2116, 3206, 7493, 6451, 6542, 3939, 11528,
+    7876, 7418, 7854, 1934, 16166, 488, 9848, 7050, 9867, 13157, 15635, 10031,
+    3330, 15060, 12280, 6789, 16189, 8853, 3220, 9132, 11208, 11561, 1026, 16065,
+    1859, 15546, 8178, 1860, 12725, 12738, 221, 3707, 12510, 6303, 1101, 20562,
+    112, 4439, 20493, 4874, 9881, 18609, 7836, 972, 5496, 17340, 18284, 5720,
+    20494, 19190, 8097, 11046, 2785, 12387, 20219, 10640, 458, 11424, 7406, 17923,
+    13611, 11290, 16206, 15271, 5542, 9228, 3812, 11458, 10858, 17745, 18670, 4618,
+    17179, 7367, 2581, 976, 8015, 16357, 11012, 5735, 5371, 6846, 5286, 19689,
+    6242, 17260, 13325, 14450, 12925, 13844, 15029, 8527, 3200, 16211, 13664, 8054,
+    19880, 18855, 14363, 18735, 614, 9995, 15976, 7558, 8900, 16215, 18292, 14289,
+    8459, 471, 20080, 17406, 13263, 8797, 5151, 16363, 7173, 11202, 3778, 16551,
+    285, 11849, 10837, 784, 18359, 8339, 9117, 6535, 12149, 8220, 17378, 5045,
+    20763, 10247, 1417, 17885, 20092, 19887, 17318, 10220, 1099, 2294, 13468, 9141,
+    2915, 9795, 5555, 20718, 4964, 15575, 3935, 15764, 19025, 16811, 20316, 10012,
+    15662, 2018, 16421, 15164, 17355, 10768, 16642, 6448, 5483, 716, 18628, 18632,
+    10102, 1275, 17715, 14368, 1000, 10489, 5658, 19036, 14191, 9888, 19037, 2482,
+    18910, 13674, 5215, 12203, 18129, 19795, 1177, 5221, 9966, 7249, 6769, 10566,
+    19624, 1333, 155, 150, 5218, 2341, 524, 7635, 668, 659, 5833, 11744,
+    9163, 17045, 15054, 17777, 9059, 14047, 16571, 13858, 3326, 6918, 4487, 7574,
+    3211, 5995, 8064, 16377, 16737, 14443, 16378, 17203, 11027, 11608, 6105, 11085,
+    10226, 9131, 10791, 4876, 13855, 9531, 14445, 16443, 10262, 12813, 5727, 10792,
+    9814, 16388, 11903, 7667, 17097, 10397, 20621, 9699, 9519, 18843, 14232, 15441,
+    12511, 4244, 3051, 8561, 203, 6136, 5422, 2843, 2040, 4293, 7321, 18717,
+    11914, 18718, 1464, 9870, 4564, 15867, 4012, 15690, 7034, 17310, 850, 755,
+    358, 19103, 7594, 10163, 7595, 15376, 6525, 10086, 2562, 11599, 15558, 5731,
+    16397, 12147, 9233, 2501, 18075, 99, 11642, 2931, 4075, 17098, 16103, 946,
+    2201, 4621, 6490, 13451, 11698, 2170, 7863, 12805, 13616, 13525, 17933, 20819,
+    6438, 10430, 13326, 9363, 609, 19773, 19774, 7597, 3642, 9400, 7070, 6899,
+    6668, 8798, 4879, 16275, 20241, 4590, 17366, 16922, 17623, 16990, 9840, 14238,
+    20314, 12334, 18293, 17231, 398, 3591, 16511, 17702, 16216, 5193, 4895, 1827,
+    17017, 295, 11337, 8546, 2622, 18502, 5890, 15695, 3444, 1667, 2856, 15875,
+    15842, 1664, 7713, 10094, 476, 15009, 16414, 1977, 5120, 17102, 17411, 12534,
+    17127, 8465, 8743, 16925, 4093, 9318, 17311, 15989, 9247, 8673, 7121, 8960,
+    14406, 14423, 3989, 15381, 2937, 11603, 19579, 13225, 10436, 18887, 7385, 1546,
+    8343, 15697, 13644, 15530, 14882, 1981, 20890, 542, 1619, 5588, 11860, 3516,
+    8224, 1421, 11861, 543, 15401, 9599, 2264, 4816, 17472, 2960, 482, 9153,
+    12341, 11473, 11191, 12752, 20581, 12342, 3643, 7154, 12460, 3238, 7047, 6045,
+    18826, 10069, 10108, 2098, 17075, 14774, 16813, 2512, 12980, 10439, 6550, 15583,
+    13058, 5792, 16670, 2019, 6619, 20463, 1471, 8986, 12703, 16226, 3276, 19077,
+    17319, 10788, 5560, 18384, 18766, 5830, 13080, 13227, 9331, 13680, 12946, 14412,
+    17720, 15673, 15880, 19804, 7132, 18452, 9875, 14679, 9334, 14625, 8833, 8468,
+    4906, 19859, 12161, 2394, 7628, 19682, 17721, 53, 861, 13888, 1445, 8234,
+    20444, 2240, 7100, 17900, 2347, 2241, 11878, 8691, 18486, 14414, 12550, 17107,
+    156, 8964, 10169, 19630, 18314, 5699, 18397, 15639, 9633, 15851, 2748, 16929,
+    19451, 17247, 12623, 2666, 9168, 9064, 12473, 14278, 5836, 4916, 11745, 7214,
+    3687, 7137, 9341, 6186, 6024, 7215, 63, 688, 1162, 12627, 19360, 2628,
+    6884, 5007, 14580, 6001, 5754, 13237, 14347, 14871, 2002, 18787, 7148, 9532,
+    872, 13905, 15733, 20846, 8396, 16125, 20663, 17109, 13062, 15796, 4286, 8586,
+    3221, 8862, 20157, 12987, 8713, 19315, 12475, 14835, 4924, 14321, 8315, 9428,
+    9537, 8869, 19318, 8448, 18420, 10267, 16474, 12478, 4847, 2721, 19322, 5765,
+    4751, 977, 3009, 986, 5614, 19996, 11566, 337, 12816, 8891, 15334, 0,
+    16478, 12010, 314, 11349, 3754, 2563, 15752, 11155, 0, 0, 15347, 5543,
+    9234, 17934, 11645, 2177, 274, 7533, 1438, 1712, 0, 2654, 10221, 1082,
+    20514, 11653, 720, 20291, 19796, 0, 2181, 18390, 11960, 16331, 9494, 2882,
+    11162, 10191, 20445, 550, 9208, 19459, 15888, 11518, 2554, 15754, 18408, 17491,
+    4287, 2492, 13555, 14859, 14860, 5124, 1440, 13604, 12407, 13530, 1376, 1377,
+    13066, 13622, 14222, 13544, 18581, 13975, 9579, 4225, 18552, 537, 3977, 11018,
+    14850, 18607, 6486, 13511, 19486, 2924, 4049, 10721, 2890, 11621, 14968, 5673,
+    15002, 19844, 19264, 10183, 604, 11828, 9377, 17219, 9313, 1465, 10626, 19162,
+    3714, 4076, 4523, 14854, 7035, 7036, 12727, 15618, 4077, 14855, 10627, 3361,
+    11248, 6737, 15322, 2451, 10728, 9316, 512, 19825, 1975, 10629, 10630, 1219,
+    14858, 4257, 615, 2454, 20093, 3496, 11850, 9749, 11217, 18231, 3650, 5678,
+    13470, 18754, 10632, 7715, 18100, 9319, 13471, 3017, 1871, 5680, 2625, 20516,
+    6165, 15403, 6741, 1684, 1473, 15237, 8579, 6176, 1265, 9342, 3046, 15182,
+    9211, 6754, 6756, 1890, 11519, 3038, 3040, 11491, 6969, 2584, 13881, 13882,
+    20127, 17967, 10800, 10703, 3052, 577, 6930, 9045, 4362, 4444, 7332, 20267,
+    16249, 13357, 16943, 11117, 8779, 17615, 1597, 18615, 209, 7037, 7598, 11833,
+    16193, 2352, 610, 18076, 8785, 20761, 2046, 3925, 20399, 11303, 11462, 4302,
+    7867, 2159, 17147, 19952, 2566, 19826, 3626, 20040, 14732, 7371, 6247, 3820,
+    7372, 13328, 6442, 17099, 19516, 929, 10958, 19921, 18516, 7232, 12694, 14733,
+    15018, 17948, 6934, 15569, 5930, 14525, 17653, 1794, 20094, 5367, 17329, 10151,
+    3179, 7243, 16553, 15072, 15108, 10000, 11496, 16554, 14290, 4027, 8816, 20109,
+    2403, 3377, 15918, 13270, 8507, 13850, 5789, 16324, 18130, 534, 19653, 4817,
+    14544, 3826, 9865, 9155, 1720, 6366, 14885, 85, 1800, 644, 645, 10440,
+    4737, 3292, 3433, 15584, 18706, 2367, 17331, 20352, 2297, 2544, 13593, 20212,
+    1806, 18911, 5485, 3941, 8304, 17635, 1578, 15132, 18827, 5018, 15699, 5795,
+    8028, 6504, 18270, 18144, 9500, 13211, 7636, 1811, 16030, 4805, 18157, 15675,
+    6276, 2052, 302, 5977, 9335, 1310, 13853, 11120, 2899, 2476, 845, 14530,
+    19658, 797, 13599, 2305, 9828, 18175, 20767, 1857, 19659, 19538, 14219, 13234,
+    12745, 2991, 9502, 9503, 10574, 12359, 18342, 18487, 5841, 4130, 9066, 9413,
+    12248, 9344, 8513, 16345, 3830, 2555, 18364, 5352, 28, 306, 16346, 4806,
+    4980, 11079, 18941, 15544, 18195, 18535, 11502, 8618, 8845, 13919, 2614, 9197,
+    2947, 9198, 8362, 846, 6403, 1727, 17665, 17117, 6952, 19906, 10080, 8876,
+    6121, 8369, 6423, 2905, 17118, 18492, 18350, 12639, 18544, 14534, 2909, 9832,
+    9742, 9743, 941, 945, 4940, 228, 3615, 2743, 3617, 268, 269, 12281,
+    6233, 19365, 19366, 10049, 2737, 11183, 6931, 5813, 4891, 2202, 9236, 4386,
+    10549, 6243, 6852, 11407, 4390, 22, 3446, 5245, 5159, 633, 15402, 1874,
+    12122, 16011, 27, 16612, 5253, 5874, 5254, 19410, 2349, 5256, 16616, 17845,
+    11684, 5258, 6886, 65, 16824, 5876, 8870, 11576, 5333, 6924, 11452, 4318,
+    11304, 20285, 7686, 12540, 2381, 12759, 19478, 4710, 7690, 7691, 20294, 19481,
+    4717, 19678, 3222, 10448, 11915, 18431, 18720, 443, 19671, 20184, 11350, 5287,
+    18434, 5295, 18090, 950, 15388, 5296, 135, 19575, 17410, 6531, 5301, 18704,
+    8141, 3718, 4273, 2706, 11222, 4153, 12541, 13639, 2708, 9605, 19581, 10189,
+    8692, 7095, 17040, 6556, 11229, 4841, 92, 9524, 16999, 20258, 2667, 95,
+    4722, 8871, 10638, 3053, 4338, 16944, 9987, 15468, 19977, 11943, 19062, 14856,
+    16452, 3335, 16771, 16144, 11247, 3926, 3343, 10431, 10480, 13631, 13770, 19163,
+    10352, 11215, 3755, 10386, 2534, 10089, 10055, 7805, 16403, 7978, 13775, 17597,
+    19882, 17749, 13531, 6091, 2474, 19827, 8116, 7373, 13585, 17943, 13632, 10148,
+    10550, 20400, 19780, 19781, 10331, 13776, 18979, 3010, 10881, 20701, 20702, 1507,
+    19500, 17124, 911, 10282, 9402, 14307, 15037, 10240, 3044, 2857, 10803, 10484,
+    17128, 1713, 8117, 7562, 10603, 19853, 14938, 17624, 17461, 10556, 20226, 10551,
+    19766, 19888, 10103, 14390, 13463, 5160, 5790, 2866, 1701, 2404, 7564, 3447,
+    9951, 16417, 16001, 8259, 8354, 6612, 13352, 14886, 5005, 15404, 8659, 13795,
+    12465, 9122, 17320, 7262, 19896, 8682, 8355, 14337, 7568, 14019, 14310, 3196,
+    646, 11511, 10655, 6036, 10887, 9606, 18131, 6993, 1115, 20270, 18771, 6037,
+    9889, 16251, 16846, 5904, 5006, 19270, 2128, 6551, 10155, 3240, 5486, 17077,
+    14895, 8166, 4395, 13082, 10070, 17041, 3633, 15793, 10380, 1903, 8195, 10241,
+    15750, 7997, 2661, 1549, 7884, 14211, 16201, 12468, 10575, 10495, 9938, 14020,
+    19411, 19660, 18176, 2965, 7982, 10576, 14030, 2246, 9463, 1723, 9939, 11572,
+    1635, 4952, 10194, 5804, 13087, 11588, 16047, 12249, 11747, 20377, 2762, 13575,
+    14031, 9087, 1541, 16347, 7809, 17846, 17050, 15062, 10610, 9171, 4976, 6709,
+    17857, 66, 6006, 19561, 6636, 4723, 19705, 12629, 10120, 1905, 13213, 11035,
+    17208, 17784, 6109, 10206, 10343, 11611, 10344, 8863, 8129, 7658, 17091, 10345,
+    6122, 9539, 10212, 9429, 4848, 9958, 16128, 1998, 14660, 7812, 20381, 10015,
+    7065, 9148, 18888, 14043, 19400, 7670, 13726, 17994, 13560, 19941, 5479, 13562,
+    18476, 7525, 20247, 6853, 2405, 3268, 33, 6885, 19452, 19092, 252, 13694,
+    3072, 11938, 6139, 20676, 4297, 15905, 19716, 8002, 4363, 16139, 3673, 8113,
+    2647, 9871, 13260, 2535, 7599, 8786, 4016, 10432, 3464, 6088, 7815, 20036,
+    11946, 7791, 7038, 851, 3479, 17346, 11425, 19717, 17407, 14328, 20439, 1520,
+    3344, 11216, 17517, 7153, 3927, 3631, 10552, 19501, 7374, 18862, 7868, 15273,
+    15274, 2830, 19535, 19782, 3488, 4086, 10631, 20401, 8296, 713, 11098, 11625,
+    11360, 9237, 11305, 8564, 11700, 951, 11701, 13532, 19249, 43, 8799, 9403,
+    15035, 18585, 8800, 8134, 1951, 7951, 12695, 20317, 8091, 4899, 3497, 10766,
+    11992, 9594, 15570, 44, 4505, 16415, 16839, 17412, 3141, 11363, 15990, 8547,
+    5440, 14042, 16218, 12205, 12443, 15521, 12236, 18101, 7953, 16555, 12754, 1403,
+    8469, 5408, 18755, 16556, 16222, 10006, 9841, 18568, 1523, 1535, 15789, 9320,
+    18495, 9997, 12755, 17534, 13271, 8248, 18889, 1797, 5697, 9556, 1587, 6613,
+    11119, 14155, 20582, 7955, 11382, 17381, 20517, 7967, 1668, 11865, 20764, 12435,
+    9156, 7689, 959, 3080, 10441, 2962, 6552, 5344, 9607, 50, 14338, 12760,
+    8651, 449, 18307, 3307, 15877, 11866, 9783, 15405, 2918, 10771, 486, 11957,
+    1588, 13059, 17425, 3029, 3082, 3207, 15281, 7002, 18386, 739, 7923, 660,
+    15630, 14048, 19805, 3278, 16229, 2659, 14776, 10790, 11411, 6626, 2877, 14590,
+    1280, 14897, 11961, 3356, 3942, 17135, 12765, 12766, 9876, 4579, 10914, 14272,
+    3452, 2183, 9336, 14085, 14629, 369, 5661, 11441, 15590, 13186, 8612, 2396,
+    14869, 16231, 16031, 8933, 11230, 15538, 19200, 3293, 19736, 7885, 8298, 20446,
+    12439, 4999, 20449, 1344, 11966, 157, 11369, 9382, 9566, 7810, 2061, 1591,
+    18339, 8614, 798, 11967, 10519, 11968, 2343, 20733, 12440, 2152, 9789, 6193,
+    13379, 8514, 12624, 19453, 2763, 6710, 16175, 9172, 3086, 14559, 5842, 11232,
+    19255, 12224, 2781, 8846, 6730, 6827, 16190, 19642, 12250, 3331, 6637, 18937,
+    20526, 5327, 7927, 19413, 8583, 7905, 1959, 17861, 12770, 2668, 18020, 6755,
+    11449, 11450, 18942, 11595, 3538, 68, 7891, 6577, 18943, 13063, 10207, 11307,
+    2194, 1021, 17677, 9895, 1094, 16349, 8130, 8588, 8621, 20161, 8864, 8872,
+    3696, 12773, 11308, 18421, 8877, 9430, 9431, 10589, 1031, 13994, 4849, 8408,
+    19305, 17444, 13745, 13740, 8734, 12912, 13485, 19101, 14109, 11816, 14430, 9883,
+    16699, 17684, 16270, 11829, 11830, 20030, 527, 3303, 20220, 12889, 17881, 13705,
+    18679, 20073, 14911, 4078, 4179, 10299, 20820, 19945, 14293, 10146, 20905, 12577,
+    5610, 20398, 13556, 14329, 2173, 1302, 10245, 9678, 18814, 16483, 15843, 14904,
+    11578, 20402, 4944, 16217, 19953, 6359, 4427, 19783, 4428, 14015, 7122, 13587,
+    4258, 8247, 2858, 2689, 6095, 14702, 11862, 4735, 4835, 20852, 9258, 9601,
+    915, 7127, 2690, 19991, 9600, 1328, 448, 19751, 5901, 18658, 16160, 18266,
+    20640, 6101, 19797, 4107, 19078, 15847, 16371, 17634, 19962, 17892, 10109, 14070,
+    2870, 501, 20589, 19806, 18577, 6268, 4432, 14626, 14076, 9892, 14460, 4232,
+    17079, 11879, 18938, 16118, 6187, 14134, 1345, 2610, 4977, 14348, 8752, 11070,
+    10259, 2701, 8854, 12815, 19132, 14800, 19323, 8643, 12973, 18810, 18727, 8665,
+    16715, 12343, 5273, 15099, 16919, 14058, 12855, 15100, 20677, 1268, 4319, 18063,
+    16271, 904, 10898, 12485, 12486, 20203, 3900, 5235, 19164, 7864, 10387, 19946,
+    7164, 580, 19947, 18856, 10301, 8021, 331, 11427, 10831, 8801, 18618, 20798,
+    11428, 987, 9238, 10553, 1703, 10899, 12335, 17598, 20886, 20081, 19954, 13899,
+    7476, 20680, 6075, 6149, 1620, 15038, 20095, 6076, 5302, 18253, 20626, 20096,
+    6935, 12866, 3251, 17949, 20318, 5959, 11061, 4194, 16002, 7850, 8470, 4028,
+    17269, 14016, 9679, 8249, 4325, 7177, 14768, 1676, 15128, 13437, 14017, 17358,
+    9784, 9608, 4738, 20891, 12868, 20545, 366, 286, 6166, 19963, 20117, 8252,
+    8652, 11383, 7877, 916, 1875, 20853, 18898, 14224, 9751, 16464, 17895, 16167,
+    740, 6376, 4118, 11514, 11137, 6949, 20213, 20724, 16995, 1629, 2710, 15721,
+    16338, 20647, 18920, 6383, 17046, 19836, 20136, 2714, 6514, 6177, 4414, 4415,
+    4712, 12947, 14342, 12971, 6389, 7823, 10661, 1150, 10117, 20152, 6377, 9628,
+    14226, 6188, 18488, 15722, 12496, 13235, 5349, 18177, 5843, 12304, 6317, 14350,
+    16579, 11748, 6828, 20556, 20215, 20865, 9692, 14351, 11072, 13239, 6007, 12809,
+    11144, 18944, 11596, 6404, 15197, 15723, 1640, 6110, 8131, 9694, 811, 13247,
+    12817, 20557, 8728, 2324, 17154, 15317, 7299, 12450, 15960, 12451, 7961, 18698,
+    13526, 7204, 17765, 2016, 20536, 15102, 8501, 12289, 19532, 17750, 734, 388,
+    17751, 912, 15323, 20348, 6900, 12265, 2978, 15817, 4900, 17703, 20097, 2047,
+    17770, 14933, 6905, 2048, 7286, 16557, 1669, 7992, 2325, 15766, 2598, 8012,
+    7878, 20583, 16962, 14225, 4803, 8142, 3181, 20611, 17196, 15767, 15330, 17359,
+    18772, 7502, 12469, 17727, 17728, 14936, 1500, 18830, 14870, 2992, 7514, 9098,
+    16040, 15934, 8144, 2053, 19676, 8080, 8079, 9462, 1639, 2374, 11567, 19377,
+    2330, 12275, 12476, 3186, 19381, 9454, 12309, 8764, 1965, 13823, 4174, 12136,
+    1972, 5431, 11834, 5265, 13650, 3912, 13936, 10398, 12647, 19596, 20403, 9239,
+    9404, 930, 7233, 7241, 19616, 291, 14126, 7716, 5445, 15040, 14165, 7244,
+    2985, 18132, 13949, 7239, 12650, 7003, 11628, 3265, 13452, 20457, 1248, 2749,
+    2384, 15351, 7260, 7803, 7261, 20341, 20343, 8563, 11373, 18728, 1740, 4301,
+    9989, 20345, 15432, 3235, 6150, 16599, 260, 14294, 6244, 12367, 19691, 14375,
+    17312, 20511, 19018, 5611, 5194, 16625, 1240, 616, 582, 6600, 18004, 3109,
+    13331, 13619, 2435, 2794, 20350, 10687, 1714, 4663, 8806, 12295, 10459, 380,
+    14913, 14123, 4094, 1222, 521, 11339, 2455, 20684, 2859, 9248, 19396, 11093,
+    4095, 4624, 3678, 6444, 4324, 3719, 13735, 10046, 11690, 14840, 6536, 12454,
+    9405, 10475, 714, 9842, 4965, 12584, 1745, 18262, 17771, 16367, 586, 12455,
+    8269, 2754, 16605, 7074, 12699, 14377, 13006, 3632, 8092, 20410, 15067, 6160,
+    2457, 5199, 1228, 20229, 7993, 8344, 634, 13300, 2624, 19893, 1230, 4031,
+    19174, 15133, 11192, 8683, 8472, 7445, 4818, 6620, 5125, 15042, 16227, 20118,
+    1677, 14295, 13796, 20416, 20892, 16610, 13439, 14990, 1231, 17418, 4431, 8057,
+    4310, 1876, 8136, 4382, 19175, 11150, 12033, 16611, 6621, 11717, 8346, 20782,
+    588, 661, 662, 4508, 14495, 4790, 18707, 6557, 2711, 4672, 1751, 19900,
+    12436, 13295, 20271, 9615, 1007, 6172, 9157, 14297, 7718, 4119, 19493, 4673,
+    7968, 12079, 12040, 7719, 2085, 4819, 18994, 1234, 20809, 1034, 19404, 12299,
+    15311, 9803, 2546, 16567, 13105, 6695, 17080, 721, 14380, 16466, 16374, 11662,
+    19808, 16817, 5565, 17970, 20419, 19091, 2099, 9708, 15822, 3122, 14049, 6277,
+    6994, 5837, 16818, 10158, 3726, 2030, 20468, 11529, 3944, 20353, 5838, 12302,
+    5487, 12493, 10391, 12130, 4750, 8200, 13830, 9495, 19183, 5323, 14633, 19124,
+    1858, 4399, 3806, 13106, 19903, 4613, 10978, 12132, 16614, 2328, 9448, 11391,
+    3243, 8840, 675, 20594, 1937, 13302, 1756, 20424, 12164, 9414, 8388, 6567,
+    1087, 8700, 6002, 676, 2807, 2247, 17389, 11413, 1151, 20470, 11482, 11573,
+    3158, 18945, 10416, 15176, 19412, 13303, 4978, 17979, 5628, 1392, 7998, 2306,
+    11667, 19375, 6194, 4953, 14279, 9496, 1236, 9634, 10916, 14397, 2329, 2996,
+    14398, 8568, 3282, 9041, 16580, 1022, 10327, 13304, 2669, 9070, 2557, 2948,
+    4164, 6638, 10470, 8207, 2521, 6832, 2750, 5845, 14381, 8515, 19287, 16587,
+    9641, 13819, 19288, 11978, 11206, 11979, 11207, 4331, 7520, 3258, 9636, 17437,
+    1035, 2630, 13150, 20432, 9420, 12050, 8952, 1089, 20299, 8366, 13832, 8403,
+    8209, 18795, 19127, 5227, 19816, 14505, 14836, 10990, 1891, 6291, 18235, 11980,
+    14746, 20476, 20301, 3664, 14217, 20300, 12139, 20607, 14748, 9650, 9540, 6649,
+    15313, 18474, 18958, 8371, 9434, 12313, 8957, 8412, 12057, 19134, 20201, 12637,
+    8958, 731, 3286, 20832, 8729, 14098, 9820, 18475, 19136, 20609, 18968, 10274,
+    2786, 3674, 13519, 19718, 13527, 11105, 5288, 8629, 16274, 20681, 10828, 2392,
+    19661, 12017, 19540, 583, 316, 15912, 13264, 7816, 12991, 3894, 617, 2354,
+    18370, 19722, 1767, 14520, 5639, 213, 8807, 4305, 7483, 11703, 10557, 2286,
+    19545, 20288, 8674, 14245, 14939, 8808, 16003, 14248, 5446, 15041, 20635, 1223,
+    19115, 20251, 9154, 20486, 275, 8548, 3903, 3572, 12585, 5360, 9007, 16422,
+    4108, 9008, 1157, 7180, 8745, 19118, 9616, 7421, 11871, 2368, 288, 19625,
+    9158, 20765, 7183, 5050, 5698, 13162, 13163, 14630, 742, 12981, 10372, 5488,
+    16997, 20766, 5641, 6696, 19286, 2186, 8694, 16738, 4040, 11140, 496, 4714,
+    16918, 4400, 14634, 12559, 6515, 1190, 20490, 14637, 10255, 13165, 3908, 19350,
+    7824, 6790, 10520, 13166, 13167, 11143, 16053, 9014, 6792, 8067, 1038, 5759,
+    13965, 20771, 16444, 11145, 15179, 10994, 8873, 20914, 2814, 10995, 14943, 8451,
+    10292, 14057, 7300, 16134, 4565, 19909, 7302, 18671, 6341, 1293, 20282, 17225,
+    19090, 5432, 18700, 5289, 15377, 12890, 15718, 15692, 12526, 10684, 20622, 15090,
+    11050, 3997, 6347, 13873, 2111, 11429, 19852, 13265, 5437, 20041, 6245, 3849,
+    19167, 12892, 2567, 7071, 14239, 3758, 14405, 2355, 7324, 19242, 261, 7085,
+    4024, 20098, 2203, 20688, 1867, 5441, 19243, 8632, 16148, 4096, 16716, 13536,
+    955, 20405, 12581, 9249, 20406, 13462, 4343, 17654, 4097, 15277, 19829, 2507,
+    1978, 13666, 20189, 16319, 20821, 7270, 333, 12618, 10558, 13942, 20848, 8135,
+    7174, 12898, 5200, 16721, 6986, 20321, 1872, 4779, 276, 7621, 8118, 5556,
+    2215, 5741, 4529, 14671, 6987, 8026, 6858, 12700, 4265, 9843, 17131, 530,
+    16418, 4104, 4512, 3144, 12935, 14940, 18263, 8607, 16722, 7565, 17031, 4259,
+    3018, 15068, 14066, 6782, 16484, 5963, 7622, 19992, 6622, 7569, 1721, 10363,
+    19834, 9682, 1678, 12544, 13886, 353, 15069, 16562, 5743, 12322, 4547, 16917,
+    14775, 15096, 16671, 5451, 16161, 4109, 14974, 14311, 3308, 8253, 4032, 7181,
+    5617, 19964, 17419, 7288, 3969, 6367, 17055, 12907, 20725, 1548, 3397, 8834,
+    9705, 9010, 1879, 12730, 13464, 11872, 11873, 20543, 11874, 15406, 12126, 16428,
+    13854, 15533, 11926, 14704, 15407, 4374, 15458, 536, 20532, 1117, 5051, 2369,
+    9776, 9369, 11927, 19603, 663, 2147, 9267, 10336, 11805, 12300, 14868, 20726,
+    4997, 20783, 16020, 20648, 16860, 9023, 7096, 3781, 13067, 10443, 18912, 20755,
+    3682, 9706, 17042, 18391, 13427, 11976, 17047, 16467, 6560, 7924, 16431, 13060,
+    10337, 6178, 3280, 1844, 2883, 10444, 10382, 19042, 16732, 408, 14086, 12494,
+    722, 5767, 4532, 2242, 10366, 15636, 4207, 15593, 15086, 4611, 10392, 16677,
+    8988, 20728, 765, 19221, 18272, 14780, 4761, 20145, 19222, 1633, 1342, 2516,
+    16232, 19043, 20756, 16971, 18505, 15664, 4533, 17081, 18456, 7141, 18178, 20521,
+    10890, 349, 4713, 11231, 20297, 6568, 2164, 12712, 14005, 19148, 16234, 2344,
+    16041, 12948, 14682, 4214, 19184, 1552, 4417, 13041, 5569, 19284, 14740, 16435,
+    14276, 19838, 20768, 14683, 5878, 1123, 677, 3987, 2307, 8701, 14399, 17486,
+    16121, 20770, 8582, 7575, 12134, 9974, 20008, 9693, 10662, 11574, 8939, 10256,
+    17140, 20757, 6195, 13341, 14352, 3690, 9711, 544, 17902, 13200, 10611, 17730,
+    12194, 6048, 16448, 6395, 13299, 16934, 12799, 17141, 14356, 12227, 19455, 20897,
+    19971, 13382, 13168, 9174, 18946, 3659, 9071, 2153, 20872, 6715, 12844, 1394,
+    13072, 16935, 6008, 5691, 20828, 16054, 12196, 19234, 2479, 13629, 6011, 16179,
+    13240, 6639, 6757, 5760, 19362, 2251, 16751, 6888, 692, 2616, 18201, 11076,
+    14357, 18202, 13306, 16976, 6409, 875, 12107, 8404, 11751, 17211, 20830, 11898,
+    11399, 17786, 10590, 8641, 16688, 20831, 8132, 18603, 17052, 8589, 16300, 1359,
+    6928, 9541, 1360, 18425, 1107, 12825, 16304, 20841, 20833, 9856, 8730, 2722,
+    8440, 8601, 8998, 14054, 7296, 18695, 5418, 20273, 16265, 4440, 19089, 6230,
+    15371, 8108, 6326, 12879, 15553, 19159, 5423, 2107, 11418, 13256, 4358, 10679,
+    12883, 20759, 9762, 3842, 20026, 15687, 3751, 20386, 19843, 11047, 13863, 16398,
+    4339, 16700, 4065, 8973, 20816, 13520, 16140, 19942, 20182, 20278, 329, 4066,
+    1968, 13458, 18064, 7161, 2493, 352, 12926, 6973, 8019, 12842, 3007, 5192,
+    5949, 4511, 17123, 6779, 9836, 7600, 6847, 15064, 4543, 16544, 7559, 16923,
+    16147, 14316, 14669, 6348, 14762, 6153, 17023, 9250, 18381, 17024, 11923, 3775,
+    2143, 13426, 4990, 13627, 15522, 10333, 13849, 540, 1868, 14700, 9365, 12729,
+    20711, 19598, 15394, 9700, 20531, 20627, 7919, 16461, 6543, 10361, 8421, 14769,
+    10390, 6161, 19139, 5964, 14067, 3391, 3272, 761, 16419, 4607, 20515, 5766,
+    2867, 9683, 717, 10437, 19026, 7128, 4201, 13038, 19835, 3982, 2335, 4410,
+    1331, 8684, 18133, 6553, 859, 11556, 9967, 8577, 18392, 14395, 10606, 13199,
+    16678, 9060, 13373, 19448, 6748, 12106, 12223, 5752, 6882, 20829, 3999, 16701,
+    4364, 4002, 12742, 4003, 11972, 956, 11654, 16514, 19708, 4375, 18393, 18398,
+    12441, 16254, 4842, 20873, 14561, 1186, 11969, 15755, 18416, 8590, 14568, 9542,
+    4851, 15447, 15446, 4354, 15450, 5133, 9794, 9790, 4079, 10244, 3627, 4661,
+    20368, 7375, 10021, 4689, 10433, 4367, 262, 4778, 14770, 7566, 4105, 13594,
+    17476, 19697, 20854, 4780, 20584, 18899, 20119, 110, 3634, 8424, 13912, 14077,
+    11477, 9893, 9371, 264, 3636, 8702, 1501, 15640, 669, 6396, 19454, 1836,
+    9375, 6196, 7576, 10328, 19706, 9807, 11486, 6213, 6219, 9736, 17605, 10278,
+    12142, 2449, 10128, 17621, 18651, 18648, 3869, 214, 4387, 17669, 4690, 12148,
+    19329, 4388, 9251, 18102, 20407, 2774, 16897, 12190, 17953, 16420, 12936, 12783,
+    12784, 12192, 5744, 14392, 16423, 18134, 17676, 12162, 12083, 18776, 4534, 7007,
+    14601, 19048, 16042, 3692, 13344, 3887, 13345, 8971, 8587, 4536, 11081, 12201,
+    1408, 18806, 4596, 18077, 1828, 15737, 3850, 5438, 1790, 1791, 2356, 4098,
+    16219, 513, 18103, 8290, 18104, 11432, 9252, 9378, 20099, 12619, 16076, 16666,
+    16485, 16004, 16153, 7895, 12267, 5965, 5895, 16558, 13294, 5452, 6743, 2802,
+    2370, 3803, 2712, 13296, 1807, 20420, 6628, 17082, 1812, 11530, 20729, 15383,
+    5909, 5489, 5324, 5350, 5175, 158, 11559, 18190, 8940, 5491, 197, 9175,
+    11354, 12276, 163, 3660, 18191, 6012, 17092, 2719, 17785, 8522, 8521, 7845,
+    10057, 19748, 11838, 4622, 4625, 4623, 3043, 3019, 3559, 13971, 13054, 10712,
+    10713, 3261, 8604, 14969, 20682, 4525, 1514, 5241, 19168, 246, 11433, 17950,
+    14124, 12659, 6445, 7484, 6065, 1928, 8537, 9785, 6269, 14599, 11175, 9479,
+    11084, 6770, 11278, 19494, 9481, 6200, 8544, 6114, 18604, 10591, 5712, 3585,
+    18048, 3055, 17797, 2433, 14164, 12336, 19169, 1768, 2536, 2537, 5439, 4544,
+    19981, 11249, 10959, 2539, 19830, 1533, 9253, 19889, 18654, 15339, 9046, 9406,
+    19986, 11015, 14905, 3573, 17356, 14949, 4758, 17054, 8914, 5248, 13645, 9123,
+    11619, 7184, 7503, 589, 2837, 5037, 15700, 17043, 11626, 2232, 3089, 10842,
+    14997, 7450, 2243, 8143, 8999, 8201, 2244, 8934, 15751, 8202, 8941, 8946,
+    2248, 159, 13624, 14171, 14976, 8208, 10984, 20009, 2558, 11030, 12282, 10872,
+    14977, 14979, 9435, 18846, 18842, 19692, 14121, 14235, 18135, 14257, 14129, 19698,
+    19699, 12994, 18033, 8552, 6137, 12513, 7930, 1207, 4442, 973, 5771, 5807,
+    17995, 12884, 16618, 13028, 20266, 19067, 3247, 4359, 12923, 4294, 1254, 15777,
+    1431, 4685, 19943, 5108, 4013, 3790, 3868, 11313, 11281, 6526, 3743, 20535,
+    18612, 10680, 128, 7931, 12788, 4566, 18852, 15717, 17695, 11831, 11459, 12096,
+    15961, 15962, 3813, 7932, 7202, 14511, 13580, 20202, 19648, 16652, 13583, 15619,
+    20283, 3008, 2564, 3815, 229, 981, 12613, 14857, 465, 4753, 14481, 20678,
+    8005, 19948, 10878, 11643, 20703, 4144, 11282, 19775, 16315, 20906, 11315, 6491,
+    13636, 19949, 379, 10628, 12578, 5544, 7865, 1765, 18355, 16946, 17596, 9401,
+    3135, 7739, 9516, 7227, 11099, 17367, 11260, 8041, 17944, 4867, 5076, 4448,
+    3139, 1709, 6809, 16877, 16878, 3568, 118, 5384, 11534, 10822, 20704, 4896,
+    1665, 14932, 19955, 2357, 10091, 16660, 2358, 16661, 9920, 9919, 6248, 16759,
+    11008, 8055, 13126, 19342, 11839, 10783, 10283, 11060, 9723, 15418, 991, 15720,
+    15395, 16899, 6854, 7240, 18655, 5378, 2412, 9118, 13329, 15010, 10095, 2114,
+    13588, 12098, 2739, 7534, 2295, 16898, 16796, 15258, 11285, 1670, 10810, 11735,
+    3177, 15259, 10949, 10799, 11495, 4694, 9796, 8809, 8961, 19652, 2366, 6946,
+    9021, 14009, 11474, 785, 9775, 11535, 8608, 8192, 2082, 2595, 14883, 10811,
+    7178, 10695, 8301, 17832, 17379, 12899, 13589, 2144, 4157, 4154, 7386, 3792,
+    12153, 15421, 3145, 11475, 5033, 20719, 3079, 15791, 10135, 10841, 20464, 1801,
+    2283, 9800, 11173, 2871, 86, 16814, 10789, 13950, 13985, 10740, 19216, 20211,
+    12996, 3517, 13141, 15134, 17689, 6681, 15585, 6863, 18756, 6452, 3277, 647,
+    1441, 4202, 16424, 10888, 10364, 15341, 14735, 15201, 356, 12103, 9685, 15342,
+    14218, 14627, 14263, 20518, 4484, 18145, 1044, 9052, 6270, 11478, 16673, 4396,
+    9689, 880, 11168, 1446, 9621, 5039, 11263, 2008, 796, 6771, 4037, 14631,
+    10515, 16032, 20447, 9709, 6823, 18497, 9665, 20137, 17185, 2103, 9209, 15061,
+    11392, 10892, 2011, 9065, 2372, 4917, 16575, 14730, 3688, 20006, 6826, 13378,
+    5537, 2371, 13094, 16468, 14323, 3907, 18406, 13342, 20431, 2575, 8065, 11071,
+    15234, 8947, 684, 18534, 7646, 1995, 18192, 7550, 8310, 8968, 13201, 15235,
+    4718, 11889, 2377, 885, 17207, 10798, 15797, 19346, 16442, 808, 16863, 8073,
+    8313, 17391, 9538, 6120, 19246, 9830, 12638, 19347, 9737, 10853, 19247, 1555,
+    12013, 15780, 4881, 19332, 9173, 4877, 20693, 6840, 10960, 1907, 6362, 4392,
+    1908, 10338, 10979, 20050, 20082, 4473, 6682, 3020, 19960, 16901, 14496, 19811,
+    7330, 16399, 18721, 1255, 17752, 18729, 1829, 16154, 16155, 7345, 18773, 18828,
+    16861, 7451, 7350, 16803, 13476, 13481, 13510, 7322, 13777, 14526, 13883, 13803,
+    14887, 14591, 11770, 11771, 4821, 5692, 14896, 2032, 14026, 16228, 15881, 20234,
+    2680, 2022, 13327, 17999, 3727, 11185, 14514, 3677, 317, 2023, 5195, 3759,
+    296, 584, 9654, 20187, 6669, 1173, 9254, 20351, 19397, 3414, 992, 16320,
+    4500, 2024, 16220, 9520, 12461, 11270, 16005, 8044, 4110, 19373, 3970, 8685,
+    13440, 18767, 8473, 15011, 18900, 15586, 1008, 10223, 10927, 7392, 5839, 13841,
+    7925, 766, 10659, 3032, 3191, 371, 1264, 18179, 14199, 1179, 1199, 9482,
+    2519, 17187, 17782, 1837, 2767, 2631, 12187, 9573, 18021, 6290, 6719, 6115,
+    10210, 11899, 9575, 9543, 1363, 13997, 4516, 9000, 6527, 6569, 13217, 17522,
+    4099, 11627, 17561, 17576, 1202, 1210, 18032, 8560, 14966, 6798, 40, 10701,
+    14906, 6799, 6959, 11370, 15372, 18039, 1295, 10330, 10275, 4289, 12004, 18847,
+    18848, 13448, 12445, 3244, 5599, 11910, 9982, 20694, 5950, 14300, 20051, 16451,
+    11454, 4055, 15225, 15554, 15833, 19934, 11939, 13316, 15688, 12111, 12856, 4056,
+    7977, 7031, 9511, 17004, 6138, 12331, 11822, 17397, 3843, 206, 13076, 16765,
+    6331, 5644, 5645, 3732, 15901, 7592, 4616, 20027, 19160, 12332, 170, 1921,
+    10050, 17308, 3808, 12914, 5188, 2223, 18285, 18646, 752, 18049, 12310, 15555,
+    8773, 11494, 3476, 16396, 1432, 1170, 20387, 14221, 14759, 19069, 12803, 9229,
+    14488, 13449, 2787, 10377, 12422, 8780, 18582, 7860, 10643, 464, 377, 4619,
+    10429, 17996, 17997, 7467, 11590, 13097, 8016, 11013, 10859, 978, 905, 13319,
+    16914, 17746, 16272, 510, 5427, 18373, 19499, 3099, 7368, 3000, 10952, 4298,
+    5520, 11636, 10087, 4067, 13612, 4657, 605, 15616, 4068, 20566, 10052, 3712,
+    6433, 10018, 10019, 226, 2174, 10543, 20614, 2827, 1738, 6342, 7162, 9397,
+    2280, 10938, 19027, 17160, 18433, 12452, 4466, 10481, 8787, 12927, 18353, 4519,
+    12113, 1306, 1562, 18857, 5205, 20695, 9108, 15839, 6343, 4892, 2212, 6596,
+    2175, 4634, 4864, 9990, 1271, 6806, 6807, 4080, 18730, 20312, 20619, 6735,
+    5925, 18244, 1272, 3628, 12921, 13001, 1825, 10007, 15030, 20221, 12011, 20346,
+    17226, 5736, 4017, 12686, 4254, 2434, 7165, 16854, 2033, 1203, 7166, 3566,
+    116, 12233, 1741, 12862, 6661, 14761, 5808, 11644, 8788, 7066, 8528, 13937,
+    20480, 2450, 6465, 12831, 611, 19392, 12234, 5951, 6344, 2649, 18971, 12928,
+    6028, 16835, 9837, 18435, 17227, 7114, 14364, 18245, 9908, 5433, 20284, 17766,
+    3250, 15563, 8666, 3171, 4022, 12865, 18294, 5297, 567, 1078, 19192, 2792,
+    15122, 14305, 14306, 1659, 1564, 15840, 840, 15977, 4545, 8802, 11734, 20404,
+    10554, 8803, 20483, 20887, 15254, 12527, 13266, 14386, 1565, 11375, 7442, 10092,
+    10186, 16856, 7168, 1522, 13533, 7683, 17408, 14985, 18619, 2418, 4814, 5152,
+    18652, 2419, 6469, 15444, 14240, 11051, 13434, 16411, 8491, 4087, 3443, 10555,
+    15727, 6977, 10729, 10645, 7792, 8331, 8911, 13710, 15760, 15162, 16276, 6092,
+    18620, 18436, 18376, 4599, 2112, 10004, 10005, 2214, 15396, 7175, 2860, 12614,
+    3110, 6537, 20778, 4749, 8291, 9595, 7413, 15623, 7687, 10963, 8221, 5303,
+    11737, 19268, 4408, 5046, 4100, 9773, 1418, 1869, 14153, 2078, 19599, 10168,
+    1120, 230, 8675, 15126, 957, 5156, 420, 12381, 7548, 15991, 12337, 2833,
+    6936, 11736, 2651, 7087, 12237, 14492, 4526, 5653, 4664, 9255, 3776, 12340,
+    80, 15453, 541, 20268, 17375, 7383, 6538, 9185, 14573, 13878, 14861, 2707,
+    5587, 11851, 5304, 2363, 14701, 2093, 624, 1439, 5738, 3823, 8340, 11794,
+    10187, 11649, 15477, 2590, 13289, 5739, 17462, 17951, 14914, 11852, 15397, 1224,
+    10714, 19867, 15308, 7305, 14948, 9797, 707, 18232, 10188, 1043, 11309, 3088,
+    18438, 18439, 18440, 16552, 13127, 12489, 7871, 16515, 15420, 18822, 18757, 4195,
+    8982, 17071, 17072, 10739, 1229, 15765, 2126, 16559, 18740, 738, 10062, 83,
+    3507, 9844, 18444, 8270, 8271, 6740, 10362, 20911, 20912, 20799, 402, 12978,
+    16107, 17833, 84, 12620, 6544, 4106, 9703, 7179, 11352, 3936, 5447, 5448,
+    5484, 17535, 15109, 19767, 20636, 16462, 12900, 4474, 11982, 12415, 10285, 5825,
+    13539, 11738, 4276, 3118, 20289, 6683, 15576, 996, 15487, 11187, 6363, 5557,
+    19344, 6449, 3273, 17772, 14308, 2230, 12701, 15488, 19789, 8159, 14991, 6035,
+    16108, 13670, 11956, 8379, 20720, 17687, 18988, 10104, 19140, 13943, 2868, 20462,
+    4802, 12808, 17148, 1380, 7759, 8193, 5648, 6764, 9469, 15577, 11213, 18692,
+    14192, 18361, 13675, 2118, 13716, 19144, 19798, 8492, 13007, 10190, 8826, 12743,
+    14296, 19038, 8827, 7448, 16012, 367, 1924, 16983, 15135, 9325, 6102, 2919,
+    12123, 20800, 11704, 2406, 18990, 1929, 18901, 8045, 11226, 11739, 11740, 10692,
+    14045, 16081, 3875, 19176, 19895, 6554, 6265, 13104, 1178, 3553, 10249, 5206,
+    14369, 19799, 10490, 14193, 17035, 9326, 16082, 4699, 8466, 12942, 15748, 4282,
+    2425, 13676, 14620, 9825, 13039, 14393, 17076, 487, 17757, 4967, 648, 20753,
+    4995, 20916, 14915, 1232, 11345, 8381, 2611, 6368, 8686, 13542, 8484, 18902,
+    9305, 18449, 10567, 2986, 14916, 10047, 15020, 1985, 11384, 88, 8922, 2233,
+    16114, 11655, 12491, 7097, 2120, 7004, 15534, 15187, 1196, 18921, 18146, 20670,
+    9085, 649, 9561, 17056, 1083, 19626, 8578, 12180, 9968, 17426, 9268, 6364,
+    791, 4998, 5136, 2803, 14264, 9617, 13500, 13407, 2804, 10411, 17197, 9969,
+    1009, 2878, 2407, 19768, 13545, 17136, 15631, 5562, 151, 10286, 9475, 2298,
+    20192, 1122, 11682, 6767, 10317, 2234, 10943, 5978, 7572, 18310, 6691, 10896,
+    13892, 18267, 5038, 1575, 5624, 13273, 7995, 12127, 9866, 19333, 19430, 12177,
+    3156, 8965, 9206, 7996, 34, 664, 8695, 15594, 6278, 12084, 13648, 3656,
+    10195, 11176, 1387, 2920, 17275, 6824, 13069, 13070, 8613, 18777, 12244, 1935,
+    5662, 6561, 9911, 19180, 383, 18637, 12622, 9629, 12835, 5987, 3524, 14781,
+    3804, 7637, 20858, 3645, 13009, 3881, 8203, 14028, 13068, 17332, 16972, 4208,
+    7638, 2662, 15850, 3123, 14087, 16576, 16170, 9412, 15676, 13466, 11880, 6562,
+    19223, 14372, 9272, 18930, 16233, 15753, 6279, 5460, 14136, 11067, 8615, 17086,
+    19224, 18922, 16088, 5257, 391, 5208, 59, 15498, 5996, 5997, 6390, 2192,
+    16465, 15424, 10412, 18180, 8654, 6749, 1160, 13547, 12184, 8942, 7881, 19049,
+    2462, 14831, 14603, 17150, 678, 19556, 14373, 16291, 3689, 3067, 16739, 4715,
+    16740, 13916, 6704, 5209, 5410, 13132, 16782, 17200, 17779, 292, 14213, 13917,
+    17204, 3313, 11609, 15599, 11028, 1887, 9905, 13017, 11568, 14503, 6397, 19361,
+    1582, 19812, 3596, 10870, 18461, 4418, 2273, 16581, 11886, 3638, 6631, 17049,
+    8170, 6286, 744, 2994, 10324, 8392, 7146, 1182, 10393, 12474, 12305, 16379,
+    9078, 11177, 16348, 14280, 9666, 18196, 17051, 16694, 8708, 18197, 8300, 8619,
+    6919, 2809, 20047, 452, 14744, 17783, 10584, 5800, 805, 3661, 14215, 14562,
+    15188, 12477, 12251, 15649, 9350, 6003, 11180, 4420, 19228, 439, 8865, 13920,
+    1942, 37, 9212, 19363, 17093, 12386, 8367, 6116, 15312, 15939, 13073, 13074,
+    11893, 5390, 9533, 14227, 15198, 10211, 19231, 11668, 18840, 17209, 6405, 7273,
+    17094, 10527, 12561, 14228, 7274, 3992, 10991, 1040, 12814, 18209, 16386, 18797,
+    7434, 8995, 8972, 18348, 12188, 18417, 9421, 15094, 15609, 19129, 9285, 12631,
+    17736, 3697, 10122, 5183, 8149, 8405, 6410, 2670, 9976, 8642, 8591, 5915,
+    3954, 19972, 15654, 8175, 19612, 5713, 8721, 6412, 10268, 8623, 5719, 9815,
+    6214, 8177, 9651, 6588, 13134, 14751, 8599, 12731, 16597, 18223, 9740, 10172,
+    835, 5513, 5584, 9553, 11118, 9698, 14062, 16545, 12067, 1979, 5528, 16951,
+    2400, 4101, 16952, 16958, 9558, 5589, 18768, 5249, 6816, 7497, 5040, 430,
+    17429, 19607, 19608, 8145, 869, 16176, 13963, 1839, 12515, 2954, 6305, 12517,
+    3056, 13657, 16192, 7601, 19719, 13478, 18701, 5110, 20683, 5434, 5886, 10184,
+    4503, 14301, 16194, 1307, 13706, 18000, 9872, 16509, 3737, 3489, 215, 1769,
+    12020, 15693, 15694, 13078, 359, 11463, 19107, 19108, 7684, 11840, 15036, 18328,
+    11841, 1137, 19019, 7606, 5928, 12338, 11842, 20224, 17313, 5211, 10646, 15445,
+    3870, 3871, 5196, 4600, 19357, 4183, 12791, 7043, 4088, 1710, 3165, 421,
+    16364, 10838, 14723, 12487, 18624, 19517, 11650, 1743, 18683, 5305, 5094, 7485,
+    8810, 4190, 12793, 19488, 4626, 11469, 11470, 16321, 20408, 2959, 841, 913,
+    4665, 19546, 12582, 13479, 14952, 9256, 4695, 2591, 4696, 18441, 8811, 1622,
+    12586, 10605, 4475, 2216, 5931, 5932, 10001, 4196, 17629, 15326, 9119, 20322,
+    17891, 16325, 8272, 6812, 8817, 18119, 11656, 11799, 5064, 13480, 17954, 15456,
+    10560, 12462, 12297, 4948, 12463, 20110, 9932, 8549, 19730, 6474, 10769, 14068,
+    11863, 16815, 7048, 12545, 13441, 18574, 6477, 15209, 1524, 287, 3451, 5162,
+    13913, 17103, 3940, 13595, 13596, 4156, 16425, 19709, 15848, 4111, 8687, 8474,
+    650, 1930, 18991, 18659, 6995, 2596, 17420, 14992, 2939, 15210, 5933, 15768,
+    19966, 14156, 3782, 7393, 10318, 11875, 11876, 18913, 7720, 8305, 10224, 12155,
+    14078, 16021, 9777, 8835, 3030, 14920, 14705, 8231, 5126, 5167, 18914, 368,
+    3793, 11479, 15495, 3322, 18147, 18996, 14422, 12708, 12104, 13081, 10843, 12402,
+    15632, 9024, 5052, 15362, 3113, 3520, 319, 2879, 15459, 1141, 17660, 18504,
+    5022, 1334, 3083, 8306, 7886, 6996, 16645, 14998, 10073, 16973, 10339, 18778,
+    6951, 13720, 17083, 5840, 17482, 723, 12982, 15496, 4209, 19044, 10159, 15665,
+    4123, 13010, 16679, 18638, 12551, 10032, 16202, 18394, 13682, 1845, 14602, 20327,
+    20730, 14782, 4210, 19045, 8167, 10196, 8309, 3210, 5566, 12495, 3033, 8836,
+    15770, 19147, 12651, 10741, 9480, 2100, 12949, 18453, 6746, 339, 8475, 11273,
+    14090, 16043, 2218, 16044, 19050, 15741, 8943, 14200, 304, 12952, 12953, 6284,
+    15823, 16933, 5176, 12360, 17975, 562, 5663, 14635, 18018, 3255, 10718, 5325,
+    5570, 4915, 9877, 10496, 18181, 15705, 18457, 14727, 20195, 1180, 13215, 11977,
+    9954, 14944, 13410, 13817, 1200, 1725, 2887, 160, 9635, 15645, 20153, 14638,
+    1580, 11560, 12625, 11483, 18788, 6711, 9806, 9483, 12375, 20196, 18347, 6752,
+    13978, 15708, 16582, 15426, 19740, 19764, 9903, 9868, 5025, 9345, 10035, 16048,
+    2249, 8704, 9956, 16583, 1478, 19632, 10010, 16525, 10585, 20840, 14091, 12499,
+    14728, 20010, 11396, 11397, 6887, 12628, 831, 9072, 11235, 4954, 16123, 6318,
+    20451, 5846, 3794, 8516, 7648, 7649, 6009, 18318, 1350, 6833, 13383, 10775,
+    16588, 15852, 1846, 17248, 14092, 2003, 1641, 2632, 8754, 16752, 13384, 18022,
+    7217, 2464, 1353, 11970, 2167, 16499, 13502, 9829, 12362, 18507, 1311, 8855,
+    19436, 17095, 8953, 20355, 19417, 16646, 10011, 16753, 11900, 12963, 6645, 10229,
+    5228, 13022, 6117, 20605, 7017, 11612, 5272, 10418, 3700, 8592, 7016, 8318,
+    10472, 8722, 2130, 8874, 12505, 10996, 9544, 3259, 16594, 20340, 9436, 8878,
+    9437, 3956, 17796, 554, 10750, 4724, 7542, 18426, 13966, 16069, 1144, 12640,
+    12722, 3260, 1145, 9948, 12643, 7018, 20363, 20558, 17176, 5809, 11054, 11316,
+    11110, 16797, 20230, 9922, 3607, 7735, 10419, 16184, 16827, 17457, 7806, 19073,
+    12669, 9257, 17129, 13944, 16322, 15073, 16516, 6947, 16330, 17321, 5567, 15637,
+    2715, 1835, 15641, 2717, 20539, 5388, 12641, 17876, 18229, 1055, 4320, 18722,
+    819, 1282, 17924, 13320, 1596, 4018, 4988, 3847, 13973, 6970, 10682, 20185,
+    2565, 18078, 20222, 20188, 7039, 20037, 16662, 12789, 19950, 12891, 12317, 7067,
+    7680, 19020, 10147, 1308, 172, 10939, 5887, 12790, 6446, 15275, 9296, 2508,
+    422, 11293, 17769, 20909, 618, 13461, 14571, 7486, 5339, 17162, 16924, 19828,
+    17945, 11197, 952, 2773, 15338, 4184, 4991, 20083, 20100, 12792, 11250, 18091,
+    10058, 15255, 10685, 4606, 17125, 19723, 12579, 472, 4992, 16077, 10894, 988,
+    958, 4227, 1773, 1770, 8024, 12896, 6781, 6471, 6673, 993, 6983, 3570,
+    4449, 13003, 20319, 4901, 18254, 1105, 9120, 7742, 16865, 20487, 2623, 16959,
+    8222, 7943, 10942, 13947, 6475, 8250, 1679, 8746, 7535, 13540, 11716, 4476,
+    18136, 18890, 19831, 9321, 12546, 12782, 6369, 18137, 1059, 20488, 14018, 13274,
+    12785, 8901, 8915, 8962, 8027, 6614, 3998, 1318, 651, 8226, 14703, 19080,
+    9262, 1774, 1422, 1877, 3367, 821, 9022, 13430, 11324, 11325, 3780, 18992,
+    9826, 5053, 17477, 3208, 14826, 20128, 7390, 18013, 6370, 19993, 4781, 7944,
+    11975, 14827, 14777, 4204, 1843, 16728, 741, 3031, 8232, 3266, 16930, 16931,
+    5346, 19081, 384, 405, 4205, 18774, 15185, 17479, 5905, 489, 1955, 9686,
+    11310, 2547, 19198, 14436, 4612, 2438, 5705, 12950, 19082, 13040, 10717, 7293,
+    14413, 305, 15211, 1776, 13187, 10946, 18399, 7052, 12043, 5708, 8031, 8935,
+    8385, 8696, 19754, 13684, 9690, 18182, 2999, 16744, 16293, 15646, 823, 1198,
+    6189, 12195, 13251, 385, 16469, 709, 4131, 6632, 20471, 6633, 2375, 6287,
+    2556, 19256, 3691, 1017, 16523, 16787, 843, 12837, 9955, 8393, 176, 19414,
+    4981, 1209, 14353, 11073, 1322, 8970, 693, 7079, 2629, 13921, 14581, 694,
+    8397, 11750, 13021, 20048, 3287, 13922, 15343, 13820, 279, 16686, 1030, 1609,
+    8370, 9432, 16098, 16302, 8409, 19755, 2525, 7527, 19324, 13691, 6651, 11255,
+    18220, 8453, 17337, 16185, 15954, 17767, 3972, 14542, 4231, 3993, 4221, 251,
+    5331, 6216, 6221, 6655, 4799, 759, 17523, 4902, 7612, 11545, 10059, 10305,
+    10306, 10408, 13781, 14127, 1317, 9801, 7623, 10311, 14941, 8927, 17775, 20129,
+    7692, 16085, 13354, 15497, 16171, 14889, 18784, 8428, 3529, 3241, 12325, 11279,
+    6398, 10497, 18462, 4649, 12601, 19609, 7149, 4807, 2751, 6717, 9808, 12666,
+    6578, 15545, 7659, 12605, 9811, 8433, 13578, 2815, 4812, 6653, 4796, 17511,
+    4889, 10297, 13758, 1314, 8418, 7602, 6349, 16078, 2795, 14884, 18769, 4647,
+    7138, 12661, 6841, 12519, 7068, 2287, 7613, 20101, 1515, 6249, 4666, 2597,
+    20641, 2834, 13401, 5681, 12704, 4481, 13797, 7021, 4949, 4576, 1986, 7022,
+    6061, 12548, 16816, 14265, 10844, 6179, 9622, 20138, 19480, 679, 16821, 5573,
+    13411, 4581, 20158, 17170, 1997, 16057, 17985, 8884, 7663, 16067, 17570, 16071,
+    17398, 17585, 3074, 4180, 12520, 12521, 6898, 5402, 6345, 3649, 17264, 2979,
+    5469, 1309, 14717, 16949, 6978, 17946, 12893, 17281, 18295, 13360, 11949, 15256,
+    6350, 17265, 18296, 3445, 3853, 17351, 17685, 14178, 13568, 18302, 16774, 7614,
+    16603, 10804, 1568, 18625, 20042, 16879, 3760, 16798, 1484, 13491, 16278, 13118,
+    20544, 16992, 18105, 18106, 14287, 1716, 5270, 13541, 5308, 17032, 19832, 20411,
+    19923, 4638, 20642, 20690, 19549, 4700, 4197, 6615, 3021, 9259, 2835, 17670,
+    8818, 10770, 11251, 20290, 4344, 18120, 7491, 17773, 19519, 17955, 17956, 12649,
+    19695, 11657, 635, 16887, 12587, 231, 2458, 20822, 14672, 20373, 2178, 19731,
+    18569, 16994, 17238, 18138, 5866, 5313, 13798, 1278, 16629, 13677, 5372, 1294,
+    4642, 4950, 12705, 5972, 6997, 5682, 4260, 16486, 15494, 13543, 20292, 15043,
+    10250, 19551, 10505, 3518, 5902, 17424, 16880, 4782, 3609, 935, 14934, 17962,
+    8610, 20323, 8093, 8035, 15849, 18903, 14736, 6378, 20130, 12905, 2299, 8486,
+    3453, 8100, 3550, 13804, 15013, 2599, 490, 1335, 18688, 7957, 12268, 12323,
+    13972, 89, 18829, 16631, 1683, 7051, 16429, 15821, 15930, 4433, 14180, 1050,
+    5979, 7250, 14035, 19860, 14036, 3209, 5700, 1474, 14010, 7008, 7926, 12593,
+    2269, 16606, 14343, 15460, 16339, 3805, 1724, 14463, 18158, 10891, 18315, 2990,
+    11498, 20590, 1388, 1550, 20538, 6384, 11808, 14551, 20522, 15595, 7424, 12429,
+    3124, 19925, 19406, 20784, 12041, 20591, 9037, 6697, 1991, 5222, 9788, 13570,
+    822, 5716, 11540, 18779, 3034, 16974, 11548, 13814, 17087, 13815, 6062, 5689,
+    3530, 20231, 2885, 16682, 4126, 11761, 14999, 6705, 11928, 18931, 20655, 20450,
+    16119, 5998, 18274, 93, 16342, 10734, 1581, 3974, 20330, 17636, 17552, 5844,
+    17088, 4492, 11138, 11809, 10609, 17852, 15642, 16866, 14742, 20259, 13380, 6634,
+    11685, 8205, 5868, 6108, 4459, 18463, 10251, 16615, 10325, 16122, 12166, 1553,
+    17183, 14788, 14281, 372, 1757, 12044, 13818, 6772, 19051, 16745, 5353, 14685,
+    17731, 17732, 20172, 18791, 806, 2279, 12442, 8705, 10521, 10582, 13412, 19742,
+    10508, 6640, 19415, 6953, 8948, 9484, 1163, 11165, 5008, 16091, 20600, 161,
+    162, 7103, 19743, 17983, 5538, 6794, 9941, 1504, 5180, 5665, 1395, 16975,
+    19456, 13243, 16058, 19482, 3317, 19928, 10777, 8398, 3461, 18418, 7652, 6203,
+    20881, 6889, 1039, 6013, 20473, 15855, 19441, 19496, 13833, 12277, 14564, 19442,
+    11766, 13630, 17096, 19378, 14567, 2637, 14358, 16387, 6206, 6923, 7218, 19611,
+    10748, 17907, 69, 19564, 11520, 5941, 5693, 18210, 18211, 13385, 12828, 11089,
+    12108, 20528, 14475, 5632, 20262, 5229, 70, 18422, 6720, 18951, 6650, 6020,
+    3225, 19746, 17143, 19321, 8624, 13579, 15656, 1401, 8888, 17986, 773, 19747,
+    17571, 3542, 1894, 15658, 1895, 17788, 1364, 12829, 18351, 8414, 1610, 16689,
+    10999, 5728, 19325, 18225, 2642, 19571, 17581, 3234, 17393, 6323, 3069, 4168,
+    12871, 6127, 6960, 5468, 14716, 12826, 13355, 11931, 15241, 17280, 18034, 17253,
+    6324, 12874, 6760, 5945, 11151, 7461, 17338, 10801, 16984, 3434, 9786, 16871,
+    14173, 3971, 13484, 3749, 7588, 19917, 4683, 5266, 11631, 20814, 13824, 16885,
+    19510, 14286, 19818, 2819, 20235, 2169, 12568, 19685, 598, 18050, 17919, 8084,
+    8605, 13759, 4774, 13658, 6236, 5880, 1651, 20309, 13521, 5674, 2582, 4630,
+    12682, 4934, 17220, 18065, 19875, 4248, 16480, 1290, 6052, 16987, 20239, 7040,
+    15813, 18811, 12261, 15908, 4425, 18680, 5952, 8098, 14033, 14175, 3549, 12424,
+    20315, 20775, 11128, 3202, 20572, 3797, 7915, 15564, 18736, 14008, 13564, 2980,
+    1374, 9030, 20537, 14330, 14538, 13565, 18092, 10604, 1569, 3012, 5864, 6674,
+    16665, 17181, 17829, 15624, 3498, 18873, 17064, 1325, 20628, 81, 17527, 2861,
+    10248, 11546, 16953, 10510, 2635, 14249, 16723, 17707, 363, 13789, 12028, 10308,
+    7090, 9934, 19732, 6623, 10507, 14546, 19440, 12240, 8382, 11760, 7629, 17547,
+    12105, 19553, 1607, 4684, 12021, 5442, 16195, 6254, 5453, 5098, 5409, 16049,
+    16050, 6070, 9073, 5138, 3226, 9438, 3168, 6738, 11917, 13782, 8747, 2744,
+    15364, 561, 13957, 16439, 3949, 20162, 20168, 17582, 17583, 13728, 1969, 5891,
+    15227, 18107, 15228, 18108, 6539, 218, 5505, 3508, 1925, 16512, 5793, 6555,
+    7936, 4261, 7498, 4035, 16022, 862, 5219, 18923, 20331, 6457, 3885, 16051,
+    1018, 15677, 5755, 870, 2810, 20735, 3889, 18203, 20055, 417, 1301, 119,
+    11471, 10688, 11434, 4627, 10690, 18685, 2961, 10561, 14130, 16902, 5745, 8227,
+    5314, 5216, 10568, 5168, 10071, 8693, 10845, 590, 18837, 6458, 15166, 10013,
+    11484, 16052, 3533, 7519, 10583, 1917, 14565, 5729, 7672, 459, 19776, 19014,
+    4181, 1104, 4598, 14722, 17947, 5198, 15419, 11602, 6096, 3720, 14527, 4833,
+    19398, 19987, 3606, 20412, 13790, 636, 20643, 3608, 4966, 11547, 736, 9909,
+    2510, 13642, 8119, 3825, 14950, 17957, 1746, 10063, 5341, 637, 9609, 9204,
+    5973, 4262, 11538, 20644, 6500, 17036, 19433, 6864, 4283, 19331, 6685, 18395,
+    17272, 19861, 13473, 863, 864, 12549, 13474, 2043, 19334, 20255, 8357, 19309,
+    2219, 1551, 13418, 14890, 11326, 4535, 16340, 9924, 6698, 14344, 4211, 14593,
+    2270, 2271, 20139, 6180, 19657, 3242, 7142, 16881, 2129, 19201, 410, 19271,
+    8359, 3988, 1184, 6197, 13649, 18193, 20472, 4217, 4650, 13149, 19416, 9074,
+    18198, 289, 1594, 15427, 20155, 20527, 809, 19152, 19461, 2617, 19316, 17562,
+    11778, 13386, 15429, 18473, 7150, 4349, 16352, 19335, 701, 3227, 13906, 17569,
+    13419, 17144, 9460, 4351, 19337, 456, 19769, 4171, 19006, 4595, 1103, 19389,
+    16310, 282, 19649, 6086, 20063, 3713, 14523, 11600, 732, 4631, 20391, 4827,
+    3605, 6662, 504, 13771, 14947, 4961, 8115, 2502, 10056, 3816, 5338, 17935,
+    19431, 20084, 6493, 5956, 20623, 9202, 9587, 19330, 20624, 4256, 7119, 12535,
+    19854, 8353, 13469, 4198, 3239, 6162, 13902, 13417, 2217, 638, 20252, 4530,
+    11322, 2569, 8356, 3983, 20520, 4206, 20466, 13147, 19407, 17553, 19310, 19149,
+    19460, 13381, 18464, 4350, 1783, 15992, 13492, 10736, 15044, 16162, 1625, 5347,
+    1636, 19753, 16235, 14639, 20793, 20792, 8789, 7303, 4182, 19690, 4321, 11918,
+    13361, 12456, 18329, 16366, 2160, 7615, 12369, 1744, 2161, 1599, 1600, 3022,
+    7387, 1486, 2777, 16156, 19550, 7624, 19116, 12588, 6266, 1748, 1931, 4759,
+    17182, 20645, 14917, 3393, 9124, 4328, 14396, 2300, 16086, 19700, 14266, 18340,
+    7425, 6699, 12767, 14664, 2148, 2348, 9623, 12662, 2663, 12497, 20656, 14785,
+    12599, 1815, 5850, 12252, 12228, 6920, 19379, 14837, 3598, 19304, 19306, 20802,
+    11184, 418, 8022, 7869, 3336, 7616, 4025, 1586, 6606, 3764, 20043, 14431,
+    19113, 247, 11853, 19114, 12150, 15309, 14493, 18121, 10909, 9260, 10152, 232,
+    2998, 8011, 15279, 6450, 2163, 11299, 11984, 20413, 7388, 2917, 19994, 4029,
+    11223, 7494, 13332, 1033, 10840, 7492, 8819, 4514, 17963, 6167, 3416, 16372,
+    6813, 3417, 20324, 12706, 8042, 20435, 4968, 12466, 8181, 16487, 1802, 9610,
+    11539, 20120, 6478, 14942, 1116, 6684, 14455, 12208, 652, 16280, 3418, 6168,
+    7422, 6379, 13889, 15141, 1987, 7251, 10970, 16568, 1084, 17164, 2382, 10634,
+    13890, 9011, 18576, 6868, 1880, 12214, 10607, 14464, 6700, 11881, 15771, 15596,
+    2134, 7009, 6280, 10974, 7394, 7395, 9778, 9624, 8660, 5706, 7508, 1754,
+    15409, 12711, 14755, 1012, 20810, 12303, 18015, 2303, 20731, 1118, 20732, 11412,
+    20140, 19897, 2921, 20004, 18785, 3381, 3355, 2037, 18579, 20214, 2886, 19505,
+    1592, 2012, 6701, 4762, 14636, 7452, 4127, 20811, 3035, 11542, 12983, 11139,
+    14786, 1283, 15203, 6635, 2700, 2398, 11811, 14468, 12167, 10917, 2901, 14789,
+    6288, 10982, 11233, 9310, 19314, 685, 1838, 9637, 9075, 2308, 14605, 2522,
+    14282, 16124, 8183, 6201, 20011, 12169, 2811, 11236, 20736, 8949, 552, 19351,
+    10919, 844, 15199, 7431, 2752, 1250, 16296, 3693, 1946, 20199, 3332, 967,
+    2310, 2311, 7653, 7654, 9213, 14439, 12229, 7581, 11767, 9043, 3333, 2317,
+    8128, 19380, 2466, 698, 699, 20356, 7521, 1943, 12278, 3337, 1892, 6209,
+    15890, 19133, 10920, 9214, 9133, 20013, 8885, 20165, 1361, 1948, 3285, 15657,
+    9439, 9215, 16303, 15659, 20826, 8415, 16758, 12818, 13122, 11000, 14476, 12642,
+    7055, 2319, 2411, 16129, 8179, 7673, 9216, 13515, 4570, 2540, 3913, 12583,
+    14804, 3394, 3395, 4577, 8476, 12908, 9827, 35, 6181, 7426, 14653, 7975,
+    8542, 17485, 10160, 7825, 12602, 9485, 8545, 3400, 20012, 17588, 14807, 2720,
+    18510, 18964, 1518, 17343, 4941, 7681, 15621, 19109, 16795, 2504, 17062, 3715,
+    12894, 13330, 8099, 13879, 15229, 1570, 2509, 3499, 10689, 11854, 10024, 13056,
+    12897, 12072, 20456, 5404, 5529, 12621, 8120, 2836, 9261, 2511, 140, 19833,
+    3721, 8094, 17657, 11364, 483, 4667, 4668, 11295, 20414, 12968, 3509, 233,
+    20265, 20044, 17708, 7872, 18122, 20111, 13799, 11658, 3574, 4591, 7419, 6907,
+    4869, 5315, 7764, 12707, 20253, 19281, 20121, 13472, 9036, 18915, 13442, 18635,
+    15422, 18338, 19735, 15408, 4158, 12403, 20256, 10846, 8653, 19737, 19605, 9038,
+    20652, 5910, 15461, 2149, 5054, 7800, 18016, 11390, 12131, 5000, 10915, 11663,
+    4820, 493, 9779, 11205, 9013, 13061, 12984, 6421, 17637, 16343, 2031, 2285,
+    2102, 4493, 18640, 5411, 13893, 4215, 20657, 4128, 15678, 525, 19589, 18789,
+    15679, 14686, 4719, 19814, 16237, 19052, 9638, 6834, 1502, 20458, 15650, 6049,
+    17188, 19745, 6921, 19610, 1052, 8534, 3890, 3662, 9177, 4496, 13241, 7804,
+    5761, 18024, 6292, 20529, 3580, 18952, 6721, 5414, 8594, 11344, 8886, 8889,
+    9545, 9217, 1516, 17335, 4930, 17058, 2488, 12885, 20454, 3480, 9764, 13053,
+    5400, 4659, 7866, 9517, 20264, 20038, 18079, 5523, 19823, 8790, 17699, 12391,
+    13778, 19279, 20085, 6901, 20242, 12689, 9588, 6902, 19728, 4151, 9031, 10910,
+    484, 5896, 4993, 15457, 9006, 2145, 20637, 2284, 4112, 6419, 15674, 13887,
+    11340, 19041, 16230, 10911, 9625, 19739, 9169, 16766, 4669, 2179, 2182, 11512,
+    20855, 764, 8307, 8308, 2187, 17151, 336, 767, 768, 769, 17152, 770,
+    307, 2195, 771, 772, 1559, 13030, 11062, 11064, 1396, 2137, 2136, 18227,
+    12911, 711, 712, 13695, 13043, 9044, 2442, 1313, 4290, 12005, 18696, 18697,
+    11935, 17256, 17915, 5058, 9914, 11781, 19239, 15466, 15156, 20534, 18432, 14810,
+    19205, 7109, 5189, 17341, 3704, 15902, 2443, 3437, 5070, 19756, 20232, 7110,
+    19061, 15510, 8907, 1735, 1531, 10876, 14910, 20064, 17925, 7279, 6434, 1561,
+    2494, 3586, 2788, 11694, 20392, 3001, 19390, 14691, 13930, 15272, 12668, 7223,
+    5926, 3136, 18681, 10246, 547, 6144, 10706, 17936, 6974, 20502, 9109, 17261,
+    15206, 14176, 13772, 14694, 11268, 5503, 10879, 3345, 7282, 17112, 17262, 1047,
+    18593, 16546, 12528, 15095, 20349, 12529, 2849, 2850, 15123, 7234, 14817, 3172,
+    18005, 19759, 15017, 4880, 15913, 13779, 1698, 14241, 19369, 12779, 3964, 8912,
+    14420, 5929, 8742, 4747, 8341, 522, 2421, 7617, 548, 5782, 2485, 9596,
+    18626, 20248, 7123, 18874, 2133, 8152, 15478, 14821, 18109, 2456, 19063, 9798,
+    559, 11131, 18758, 2655, 14319, 3348, 14333, 17473, 2026, 1747, 14771, 18891,
+    13713, 19790, 18629, 19214, 3510, 762, 5059, 3511, 16223, 5826, 12542, 2709,
+    2459, 15531, 10744, 17958, 4643, 17716, 1909, 9327, 17270, 14456, 2872, 1749,
+    19064, 14258, 14457, 12101, 9900, 17717, 4839, 19627, 152, 13805, 1095, 1808,
+    14267, 19349, 19712, 3352, 2880, 9476, 1755, 2395, 9164, 20870, 12843, 12042,
+    17115, 18924, 17971, 15932, 9061, 7515, 13816, 680, 17691, 9925, 16741, 14354,
+    5074, 19557, 14739, 3597, 10394, 724, 727, 8293, 8709, 19056, 17737, 9816,
+    8757, 18051, 14981, 2756, 11906, 18517, 13312, 5103, 18710, 9978, 12997, 12448,
+    15430, 8106, 4008, 7833, 849, 3730, 16828, 10677, 16762, 13557, 340, 19007,
+    2379, 6079, 16650, 346, 15807, 7468, 18610, 5105, 14485, 12482, 599, 11419,
+    900, 13457, 460, 15336, 2820, 20773, 17818, 9144, 8085, 4890, 20310, 13659,
+    8003, 18853, 4249, 5282, 12287, 20065, 6237, 5732, 5498, 16832, 6801, 16074,
+    4907, 11122, 8456, 6464, 8052, 19918, 8495, 19207, 17403, 1652, 3169, 15967,
+    9659, 4145, 15834, 4081, 4426, 5231, 8457, 6466, 4538, 7703, 18477, 982,
+    16145, 466, 8791, 19165, 1079, 16600, 11789, 11464, 12394, 5012, 20243, 14539,
+    20776, 11637, 8332, 10832, 1544, 18621, 1085, 16454, 2538, 7414, 18532, 12206,
+    17886, 3153, 17463, 10096, 13100, 477, 3500, 13880, 7563, 18820, 19209, 5480,
+    8153, 16457, 16458, 14185, 14616, 10486, 16006, 13031, 1982, 20638, 20781, 17834,
+    15818, 16463, 19170, 5246, 18521, 587, 10064, 1494, 4033, 9084, 18308, 20441,
+    5618, 12209, 17382, 19618, 9960, 12210, 16996, 2758, 689, 17240, 665, 19445,
+    15535, 19926, 10072, 13369, 9159, 11683, 2548, 10197, 17847, 1208, 8061, 3945,
+    10198, 20785, 8122, 8969, 19312, 1347, 18599, 6198, 17557, 1354, 2409, 9282,
+    5724, 16066, 3951, 19319, 8879, 18647, 3057, 12522, 20573, 11338, 20286, 18006,
+    4303, 18737, 7325, 17464, 20849, 10025, 19855, 17025, 3178, 19787, 3854, 19085,
+    4228, 19210, 14515, 14846, 11985, 15280, 2296, 5095, 4670, 14223, 3618, 1878,
+    19282, 10502, 8538, 2146, 1911, 18687, 15045, 20046, 16281, 6783, 1685, 18362,
+    15142, 6912, 10112, 8029, 14291, 8633, 11742, 20857, 5078, 17545, 13301, 10933,
+    15539, 9626, 8425, 17385, 14707, 11317, 19587, 2121, 14552, 20859, 20523, 2304,
+    8235, 14787, 16344, 3197, 5571, 16998, 16847, 14579, 12553, 2122, 19225, 11706,
+    7888, 14201, 10252, 12713, 1904, 2399, 19226, 18583, 136, 19523, 5079, 14640,
+    6791, 11575, 1595, 18947, 8706, 19352, 8517, 17905, 6793, 1053, 6922, 16059,
+    14566, 3620, 11074, 18212, 8755, 7522, 17565, 18213, 10934, 13024, 17212, 1893,
+    17572, 9288, 10270, 10271, 10935, 16804, 6925, 13305, 10273, 17578, 753, 1109,
+    13783, 18686, 13791, 13821, 8735, 20223, 17809, 9035, 8710, 7063, 7152, 12523,
+    18001, 9083, 2681, 19672, 3058, 11702, 12530, 216, 4148, 19784, 19982, 217,
+    9747, 4149, 10708, 2982, 13363, 12257, 7991, 2042, 20686, 3705, 5654, 5655,
+    5157, 4370, 11855, 9998, 12918, 2862, 14125, 16149, 18110, 1298, 13667, 15154,
+    15993, 11106, 12026, 12560, 6675, 11508, 17801, 7075, 240, 3738, 1573, 16841,
+    3166, 19117, 12029, 4030, 11435, 10691, 16775, 3448, 7625, 3349, 4608, 18332,
+    12074, 318, 13128, 12857, 1487, 11052, 3855, 19195, 6311, 12344, 11436, 5015,
+    5449, 18304, 7688, 13671, 18123, 20190, 16109, 4277, 12919, 6081, 14516, 7839,
+    19086, 9655, 3512, 15735, 3378, 20649, 10864, 15136, 13800, 10442, 4671, 7879,
+    9263, 917, 14131, 4705, 1001, 11437, 18904, 14132, 20893, 1049, 18633, 14866,
+    6501, 19800, 13736, 13801, 19997, 7495, 1319, 13678, 13679, 17134, 19674, 424,
+    5316, 653, 13623, 1932, 13717, 1002, 20417, 1803, 19244, 11677, 15046, 12076,
+    4113, 19533, 9367, 12034, 4114, 8828, 19119, 11438, 17600, 334, 960, 6998,
+    4610, 13951, 19898, 10633, 16110, 16111, 2873, 6453, 10656, 14575, 5746, 18011,
+    14071, 8121, 7740, 455, 6686, 15049, 16843, 5455, 6869, 1775, 3610, 9849,
+    918, 13806, 10608, 6455, 18311, 7693, 20254, 1853, 16495, 15050, 10570, 8634,
+    6173, 18916, 17044, 12859, 20883, 20131, 12467, 13366, 1809, 16373, 16844, 12709,
+    11439, 14954, 20328, 16521, 10493, 8039, 17722, 16285, 16332, 16905, 7694, 1262,
+    8531, 6271, 11497, 13008, 10287, 17896, 18271, 4870, 111, 3093, 18660, 13229,
+    7855, 12080, 9725, 14141, 16, 2987, 5171, 13083, 13808, 7958, 12552, 16572,
+    19738, 16932, 19345, 14783, 2428, 4763, 5474, 20194, 15080, 9687, 10115, 8477,
+    15410, 16780, 19181, 494, 15933, 14273, 18925, 1336, 3084, 1013, 5172, 6481,
+    5458, 2315, 3946, 1320, 15411, 20141, 14088, 17084, 5664, 18831, 14921, 4592,
+    20592, 9753, 16845, 12374, 13598, 5128, 9754, 17802, 1938, 19458, 7396, 16432,
+    14955, 10002, 11772, 8697, 11254, 13084, 1686, 4434, 8748, 14726, 940, 20422,
+    19868, 15111, 9372, 20861, 7516, 1462, 19065, 6706, 4376, 2993, 14709, 1447,
+    9780, 5055, 9273, 451, 9630, 8703, 12165, 11718, 7551, 10445, 20862, 11393,
+    124, 11445, 16436, 17299, 20505, 8637, 7887, 7969, 14466, 8236, 3212, 10818,
+    2086, 20658, 19901, 508, 10980, 20769, 2123, 14556, 3085, 11882, 12086, 20524,
+    6190, 18932, 7102, 4822, 10034, 1424, 14891, 16045, 8990, 14710, 4741, 2429,
+    13960, 19813, 9631, 10227, 9632, 5649, 824, 4242, 8347, 7939, 3767, 15946,
+    10719, 15425, 19311, 5642, 2735, 16292, 11531, 6069, 9039, 3647, 10170, 7767,
+    18400, 2782, 8992, 5023, 16380, 3257, 15144, 15541, 20734, 4218, 12985, 6289,
+    3534, 7697, 1593, 14790, 19495, 5629, 17638, 3283, 16238, 18790, 7959, 16822,
+    5847, 15602, 4219, 19677, 1266, 12306, 13687, 5413, 8171, 14892, 10612, 12225,
+    12226, 5492, 15081, 2250, 5756, 17858, 10447, 6712, 3267, 6707, 14160, 8172,
+    5574, 17089, 3399, 7012, 19815, 725, 20197, 20661, 16908, 17803, 10139, 11214,
+    19, 7054, 12137, 10119, 14415, 2465, 373, 16240, 8950, 14416, 7779, 9351,
+    17733, 17862, 11087, 15742, 12959, 14642, 14417, 12170, 8856, 14050, 2087, 1023,
+    11237, 2441, 565, 13189, 4377, 20662, 15825, 18466, 5875, 14926, 9352, 7768,
+    14382, 13279, 14202, 15428, 5259, 19865, 19866, 8478, 18199, 19054, 14655, 10985,
+    16092, 6459, 4461, 9878, 7539, 14183, 20824, 14418, 16255, 3991, 15736, 10673,
+    9574, 14419, 11166, 20813, 15178, 16910, 4844, 17142, 8993, 13856, 195, 9957,
+    10586, 9809, 690, 15651, 9354, 2813, 13169, 20758, 17984, 9642, 165, 7960,
+    12171, 2345, 11813, 1451, 14606, 9975, 18537, 1397, 3950, 7259, 810, 13961,
+    9504, 16936, 2252, 9422, 19317, 6718, 1201, 8714, 16257, 16060, 7826, 14007,
+    553, 19663, 12138, 1642, 9647, 5666, 6293, 11752, 6015, 12197, 11679, 9180,
+    13242, 16937, 13170, 1643, 8210, 14095, 9387, 10778, 5852, 11591, 14359, 3698,
+    12253, 12678, 17641, 14607, 16527, 7660, 6835, 20874, 9076, 12308, 8518, 3318,
+    16788, 19289, 6207, 6646, 20200, 2766, 17303, 18500, 3295, 7661, 11088, 19290,
+    11768, 14957, 3699, 19664, 3068, 13387, 7748, 6581, 3835, 14360, 9576, 7541,
+    6018, 18953, 8955, 20602, 12230, 6722, 20606, 8593, 702, 14958, 5762, 17865,
+    3383, 5057, 2673, 7524, 3891, 2467, 498, 18216, 71, 20744, 17279, 2995,
+    20427, 5391, 20530, 6215, 10997, 5334, 6123, 12405, 876, 18424, 8212, 11031,
+    16979, 6723, 6724, 12140, 1285, 20167, 10420, 8727, 8597, 6217, 20835, 8133,
+    13420, 11404, 8319, 3230, 14052, 2157, 9715, 817, 436, 9577, 16449, 8081,
+    9440, 3544, 9546, 16784, 6725, 8450, 1032, 6589, 17789, 1365, 16476, 6726,
+    16072, 4852, 1183, 11001, 8625, 2320, 12644, 11256, 9821, 20827, 9741, 19354,
+    11003, 7674, 14661, 13924, 8416, 7061, 4239, 17991, 19770, 3054, 19666, 11671,
+    9082, 15153, 12014, 2041, 13321, 6238, 3675, 2977, 10164, 11104, 17616, 1297,
+    16836, 4272, 1072, 14512, 7477, 3346, 1483, 20186, 10683, 467, 4365, 315,
+    12065, 17768, 12316, 7682, 15814, 4605, 7838, 3735, 6080, 15089, 11049, 239,
+    18863, 12068, 19883, 12069, 4691, 953, 3432, 11689, 1080, 989, 19110, 20825,
+    10647, 14572, 6494, 2932, 18622, 14951, 990, 9240, 14040, 12022, 10045, 419,
+    13780, 17126, 14432, 619, 10833, 11430, 3370, 16840, 7853, 8530, 3592, 9999,
+    17352, 18656, 1671, 6472, 17800, 10767, 20102, 2672, 15039, 9680, 2983, 18255,
+    7754, 19489, 20320, 16105, 3077, 3092, 16279, 5656, 12696, 13269, 5063, 2984,
+    4506, 10485, 19890, 13222, 6855, 17887, 1378, 1851, 14596, 107, 18303, 13004,
+    20415, 8508, 11769, 15845, 8345, 14724, 8983, 7954, 16560, 14408, 8744, 19457,
+    1926, 5016, 4429, 3449, 16926, 2424, 9750, 3937, 16776, 9366, 7746, 6616,
+    13079, 14754, 8471, 12371, 7389, 4, 12156, 19752, 11134, 2426, 10027, 507,
+    11867, 2732, 7922, 8228, 1423, 16013, 4739, 9802, 2084, 20504, 7091, 20122,
+    16282, 7549, 6066, 11323, 14545, 3081, 6687, 7499, 10222, 20646, 12301, 18387,
+    7766, 12163, 14079, 3521, 1263, 12215, 20193, 3279, 14198, 5834, 5747, 17,
+    3254, 10136, 9501, 20650, 3827, 10113, 10577, 19862, 1014, 4488, 10975, 14654,
+    7538, 10976, 10672, 9337, 4416, 370, 18159, 6456, 865, 12951, 799, 14604,
+    9973, 9805, 551, 18533, 7255, 2780, 20812, 17137, 9343, 1348, 7647, 9099,
+    11749, 9567, 3314, 8394, 11765, 2316, 12168, 2764, 6111, 8584, 5757, 20601,
+    8951, 18200, 1284, 812, 8316, 1362, 16475, 19638, 1433, 7326, 173, 3023,
+    12594, 9089, 10264, 19637, 10165, 9884, 13982, 13349, 6093, 10166, 17413, 625,
+    5158, 626, 13396, 7747, 7840, 531, 5450, 13090, 13177, 16326, 16327, 6545,
+    10462, 16197, 14023, 3180, 19492, 10796, 19552, 11365, 16244, 9264, 763, 654,
+    13091, 54, 4804, 4485, 4486, 3635, 1988, 5470, 4910, 10465, 13216, 8254,
+    8493, 9662, 14995, 13297, 7423, 19120, 19121, 1389, 12663, 9210, 1425, 13308,
+    8255, 17386, 15706, 17430, 3531, 6038, 18933, 15707, 16526, 386, 5475, 12665,
+    17761, 15709, 321, 125, 15542, 18278, 8279, 12769, 8395, 3198, 12741, 3948,
+    14872, 10986, 14471, 7769, 5328, 12771, 2062, 4808, 3185, 11929, 8147, 14644,
+    4810, 11569, 7811, 16181, 6016, 1398, 11521, 2671, 5763, 14474, 15711, 14438,
+    10161, 13980, 13346, 17509, 5143, 594, 15724, 2058, 13088, 15511, 16307, 5424,
+    6522, 10451, 7814, 10173, 19487, 10793, 4893, 15691, 14451, 10456, 9660, 7753,
+    3629, 4467, 5290, 8244, 7304, 19111, 8460, 3194, 18875, 17376, 1419, 16150,
+    15696, 6032, 17414, 3501, 1379, 8380, 12660, 5966, 8273, 12756, 5317, 14867,
+    2460, 12744, 5137, 5753, 4175, 4166, 8554, 3297, 16790, 11998, 15894, 4270,
+    20049, 18238, 17606, 3159, 3473, 13605, 308, 11318, 7946, 19187, 13051, 20019,
+    11453, 7196, 3740, 17607, 18239, 19842, 6929, 1613, 3477, 12569, 2821, 20815,
+    20900, 2926, 9294, 2, 15265, 15266, 440, 901, 4172, 6332, 9580, 9444,
+    1560, 16830, 3405, 9497, 10544, 6777, 13867, 3406, 16400, 3563, 4935, 18699,
+    4250, 13347, 7704, 12262, 16837, 2108, 4185, 612, 16212, 13348, 13617, 20074,
+    11727, 3163, 19071, 19847, 1920, 16404, 2724, 10956, 19191, 16359, 11319, 3821,
+    20777, 18093, 3305, 9766, 18251, 7376, 2076, 1566, 11465, 9241, 14696, 16412,
+    9589, 13618, 16365, 18256, 20369, 17625, 12913, 16221, 1842, 17528, 18257, 13945,
+    2775, 18741, 9407, 15479, 15480, 10964, 3306, 14317, 108, 5816, 6937, 14318,
+    18330, 4278, 17474, 5897, 4477, 19196, 15919, 8154, 45, 16157, 14621, 6371,
+    19654, 2692, 144, 16163, 18334, 13135, 12840, 9160, 15191, 2759, 6876, 14339,
+    14320, 189, 16375, 3877, 10868, 3576, 6191, 2696, 16089, 18343, 3457, 5913,
+    9450, 16061, 8781, 8841, 8847, 20501, 5546, 19956, 14376, 7560, 10730, 18111,
+    12753, 17536, 12345, 12030, 16882, 17330, 6260, 4736, 5742, 20123, 4644, 7567,
+    2184, 18522, 7391, 1933, 5533, 19253, 9850, 18780, 1882, 2966, 14315, 5181,
+    15798, 13988, 4843, 1944, 19257, 18536, 6202, 16055, 1889, 9386, 8711, 10735,
+    17171, 19260, 6297, 6298, 18807, 18742, 17173, 10676, 4005, 13223, 10649, 15698,
+    3856, 11261, 19171, 8820, 1804, 17601, 9265, 8575, 101, 390, 15926, 2940,
+    2657, 5619, 15927, 2988, 16966, 6380, 10660, 1579, 16573, 19522, 14996, 19863,
+    11343, 10116, 9269, 11810, 20257, 6106, 13298, 3783, 5461, 19558, 18275, 10847,
+    20425, 15233, 9170, 9306, 3148, 18401, 15935, 9279, 13987, 9280, 16239, 5463,
+    18279, 9926, 9927, 19202, 9384, 10236, 874, 15937, 15652, 8282, 18319, 16093,
+    18204, 38, 2618, 14750, 13171, 18954, 9648, 9423, 2524, 6294, 11264, 17643,
+    253, 11451, 15547, 3955, 16182, 6413, 9906, 10213, 10214, 8598, 8892, 6124,
+    39, 3836, 2527, 9441, 9289, 72, 3957, 8895, 413, 5361, 5357, 5359,
+    937, 12388, 12389, 7245, 14847, 19801, 7247, 1630, 12437, 7252, 7253, 2946,
+    7256, 14849, 3770, 3779, 7856, 10260, 10371, 10370, 426, 17848, 14893, 6019,
+    17866, 4468, 3059, 1276, 12075, 12901, 2796, 3253, 15920, 12902, 12350, 7129,
+    17149, 11053, 241, 18335, 13119, 10693, 10571, 20823, 2461, 335, 18148, 17776,
+    14706, 491, 6479, 5456, 11296, 17602, 939, 18273, 4489, 14708, 7010, 16680,
+    90, 91, 5368, 4593, 11995, 2463, 12245, 14975, 9940, 18499, 14314, 14922,
+    12273, 17138, 7974, 545, 14469, 13428, 921, 8280, 7400, 8322, 16748, 12986,
+    351, 3557, 12500, 12501, 5329, 16635, 10663, 7401, 6570, 728, 2783, 6575,
+    15681, 14687, 4614, 14472, 497, 16685, 11238, 4497, 695, 8283, 14608, 9487,
+    4983, 12254, 17153, 6210, 6585, 6758, 1409, 2468, 5634, 16389, 12058, 3231,
+    15344, 6590, 8417, 15515, 12903, 4120, 10156, 12736, 4490, 15597, 12274, 5130,
+    1475, 8285, 12993, 19229, 13503, 15606, 4495, 290, 14688, 4615, 19230, 4435,
+    696, 15608, 14361, 3228, 15345, 3232, 15505, 12886, 4082, 5123, 15587, 19217,
+    14680, 7323, 7327, 16288, 16742, 16294, 6204, 18246, 19252, 19218, 13453, 8566,
+    11394, 5851, 18407, 19232, 11400, 97, 18280, 16502, 5635, 17823, 3062, 12426,
+    8155, 16517, 14027, 5096, 16960, 17964, 16963, 3465, 14179, 8182, 11868, 5201,
+    18905, 15382, 301, 3351, 2805, 2549, 11253, 11678, 9298, 1536, 7208, 8635,
+    5322, 12217, 3525, 3454, 15598, 16681, 8275, 13571, 17976, 13574, 5072, 3296,
+    18832, 11629, 8636, 4162, 6482, 15087, 5999, 8168, 6483, 9792, 15014, 1637,
+    18489, 19150, 5572, 5177, 7216, 15193, 15194, 11606, 8360, 15195, 20665, 20664,
+    2088, 3087, 8361, 14560, 5178, 12045, 7889, 2376, 17116, 12326, 17980, 13144,
+    14793, 3458, 3537, 17432, 15732, 7802, 18549, 20452, 17433, 16382, 16802, 18023,
+    19084, 13190, 2903, 2904, 6773, 8146, 8640, 8519, 11577, 15355, 9944, 2312,
+    17738, 5262, 12255, 4744, 17278, 17499, 6021, 1410, 13025, 10216, 877, 16390,
+    11614, 9547, 8439, 11002, 12724, 17816, 3061, 12423, 5093, 16510, 14025, 16947,
+    16950, 15379, 4728, 3347, 11843, 297, 14177, 5197, 18864, 9521, 9297, 11675,
+    7205, 6988, 6476, 15012, 5309, 18480, 7287, 7873, 17965, 11605, 5974, 15190,
+    5163, 18481, 18482, 7882, 14784, 18548, 3526, 20448, 17427, 3455, 10981, 9929,
+    2900, 13188, 5260, 8639, 1406, 13023, 11613, 12723, 3928, 786, 4783, 4115,
+    16200, 19585, 792, 13131, 234, 14497, 9126, 4764, 17139, 13444, 7518, 803,
+    14093, 15607, 17640, 17735, 14204, 7770, 14205, 3663, 9355, 16095, 9388, 11562,
+    11563, 9357, 813, 814, 815, 9079, 829, 13244, 3958, 16913, 3915, 17611,
+    19573, 779, 13125, 7496, 14072, 14196, 17723, 9332, 11557, 800, 801, 3771,
+    3665, 3789, 3768, 13707, 13701, 1127, 6151, 3075, 14122, 15260, 19547, 14366,
+    16493, 15230, 12904, 18892, 7570, 1798, 18336, 3722, 3723, 14370, 18333, 15092,
+    17966, 20913, 655, 7023, 14681, 9368, 2188, 14961, 14133, 404, 13802, 3419,
+    5086, 12906, 14888, 6870, 6480, 919, 17724, 15051, 2189, 16496, 17661, 7573,
+    3594, 17548, 8573, 16023, 1134, 965, 10812, 3527, 1086, 7723, 3183, 14274,
+    18781, 13809, 17729, 6047, 5056, 13810, 6708, 20525, 920, 16437, 1088, 17853,
+    14557, 3785, 19631, 15643, 4823, 3532, 11116, 19227, 5575, 5848, 14962, 6004,
+    6571, 5493, 64, 14641, 3859, 15647, 4720, 1267, 14181, 14643, 1024, 4401,
+    16177, 8206, 9385, 14203, 14713, 17863, 19185, 10524, 14645, 9942, 691, 18950,
+    16911, 7104, 13172, 8211, 20474, 13388, 1816, 2619, 18214, 6208, 12838, 1644,
+    18541, 14689, 15655, 16503, 19565, 3860, 5088, 10215, 17573, 10531, 1366, 16504,
+    9822, 19326, 10754, 13693, 3071, 6131, 15245, 14610, 15226, 16135, 12887, 18851,
+    1784, 3711, 18327, 6657, 13760, 394, 14114, 3407, 17926, 3588, 12832, 16491,
+    5291, 8572, 6848, 15968, 910, 954, 3173, 3490, 18738, 10809, 7709, 5047,
+    6042, 16416, 4815, 1261, 8194, 4701, 14194, 1329, 17838, 10512, 1003, 9328,
+    16903, 7098, 9936, 13164, 20469, 10752, 13840, 8156, 5041, 16453, 3876, 1010,
+    10865, 666, 1015, 15143, 5100, 3786, 6572, 94, 67, 4222, 16297, 19151,
+    16783, 3892, 11597, 16785, 9873, 18893, 3966, 5164, 2798, 15282, 19733, 1750,
+    17239, 20418, 19967, 11341, 16801, 12920, 13130, 19199, 15701, 20000, 2602, 9663,
+    18636, 1011, 406, 7630, 15284, 18149, 12591, 11777, 12595, 7271, 11691, 19675,
+    18997, 11327, 20295, 7504, 20423, 11094, 7397, 11442, 19339, 6513, 9270, 19837,
+    14498, 4212, 17662, 13737, 670, 15315, 15285, 14135, 9338, 9894, 11543, 14711,
+    20146, 12954, 14741, 3147, 17201, 12677, 13548, 7272, 3595, 5087, 1016, 20332,
+    18276, 9851, 20305, 2612, 16746, 9346, 7429, 14172, 12327, 10003, 8479, 5179,
+    15145, 17090, 15212, 7726, 3467, 1702, 16823, 29, 9639, 20506, 20261, 13504,
+    11544, 8238, 14714, 8348, 20737, 7928, 11890, 11891, 17558, 3787, 13203, 17488,
+    4498, 17762, 15940, 11551, 2253, 11552, 12091, 3788, 5853, 12089, 6072, 18796,
+    14796, 12716, 16242, 20739, 8173, 12988, 14094, 4766, 15290, 4923, 14206, 12054,
+    1694, 20159, 9356, 11402, 14745, 16096, 1206, 3223, 17566, 19057, 20789, 13204,
+    13389, 8723, 20163, 13992, 9649, 16097, 9812, 19633, 10588, 196, 1135, 816,
+    2254, 12606, 700, 20164, 18956, 16978, 5667, 968, 14283, 16595, 9182, 19613,
+    3334, 9360, 15292, 1249, 2949, 6837, 14959, 17574, 9818, 19567, 7192, 18221,
+    17867, 15262, 11598, 20302, 17579, 9442, 9668, 14749, 16477, 6417, 13998, 7437,
+    16100, 5730, 8731, 818, 9869, 18844, 15263, 17217, 1734, 12570, 12916, 974,
+    9658, 19338, 13731, 14115, 4176, 7369, 20774, 20393, 15314, 11092, 6507, 18066,
+    2495, 16538, 9885, 18247, 6808, 5652, 9838, 5082, 11533, 780, 8667, 1699,
+    17524, 16809, 12318, 7710, 11856, 11857, 7918, 20503, 20712, 14246, 1128, 11550,
+    20112, 8160, 13198, 15921, 188, 9329, 12035, 13367, 793, 9804, 2235, 1390,
+    20298, 6406, 13990, 16471, 4687, 15571, 15578, 15579, 18759, 4345, 18124, 129,
+    15085, 7049, 427, 492, 2165, 14805, 2838, 8013, 5073, 12218, 5490, 8043,
+    4491, 15204, 4549, 11541, 686, 7890, 11994, 18792, 14324, 9486, 1027, 16589,
+    357, 1028, 2166, 8074, 886, 10528, 9077, 9488, 16593, 3229, 19336, 14325,
+    14808, 888, 8075, 9548, 4389, 4391, 12269, 7842, 12259, 8520, 13214, 781,
+    8225, 8229, 2799, 3761, 16906, 12795, 10029, 2603, 8233, 881, 3644, 14923,
+    11443, 20659, 3646, 12797, 14830, 429, 671, 10033, 4124, 3577, 12955, 12597,
+    4580, 16907, 8276, 6391, 11395, 20433, 13445, 14400, 14833, 8848, 883, 20738,
+    2812, 11398, 14161, 19904, 12715, 20740, 14032, 6641, 15303, 5578, 8314, 7313,
+    11901, 8954, 19839, 887, 11403, 9896, 13158, 9945, 9946, 13253, 16980, 9134,
+    12056, 12055, 10751, 5764, 8284, 11032, 889, 9135, 12819, 3174, 3182, 10797,
+    5476, 16178, 3187, 5139, 3189, 3188, 7314, 1467, 18965, 18966, 4471, 17554,
+    4163, 12363, 4922, 20741, 9389, 4925, 13413, 18957, 4942, 10153, 6372, 11869,
+    4246, 8165, 6046, 235, 11705, 10157, 16967, 17483, 16577, 9025, 18939, 15196,
+    11812, 15463, 9026, 15648, 4315, 1728, 11564, 697, 10529, 6319, 16977, 1906,
+    17504, 19568, 18743, 2683, 12858, 6999, 263, 5457, 15261, 2989, 6314, 17048,
+    3456, 3522, 13277, 5202, 15232, 10578, 7053, 13572, 320, 19046, 11480, 9563,
+    15702, 5568, 9523, 19245, 3746, 3882, 10694, 18639, 11553, 10595, 5326, 16236,
+    12598, 5129, 11446, 9274, 15287, 966, 12554, 11665, 4129, 681, 2204, 15644,
+    7398, 2967, 250, 18641, 5002, 11447, 10901, 16819, 14500, 431, 4216, 19506,
+    7509, 4676, 13831, 3149, 2528, 14470, 7013, 13895, 5508, 16500, 3578, 126,
+    15543, 19703, 20333, 18367, 9128, 9852, 15063, 14806, 18194, 936, 15603, 6829,
+    8014, 4918, 16295, 4494, 5934, 8551, 4233, 7857, 16939, 3382, 7698, 14794,
+    10369, 13446, 19507, 14401, 12328, 18793, 10813, 19744, 5003, 4550, 14288, 15853,
+    12556, 13343, 11732, 5801, 14925, 8753, 13280, 13281, 7858, 10208, 1704, 8903,
+    20797, 16191, 18580, 10849, 20666, 11894, 19905, 16501, 10814, 2124, 6407, 2970,
+    12307, 4743, 20272, 3116, 8349, 3834, 10850, 18205, 8239, 9643, 7353, 1427,
+    7187, 9781, 9283, 20787, 8715, 10230, 20742, 20160, 10904, 5643, 18973, 2888,
+    13688, 13552, 6051, 14797, 5494, 16825, 20338, 8317, 20743, 19435, 729, 730,
+    5802, 12719, 19437, 15502, 15503, 18798, 2105, 12989, 3039, 5855, 8996, 17492,
+    12502, 12503, 6642, 566, 3540, 17642, 4223, 13145, 4332, 16203, 15304, 5579,
+    13834, 13108, 17145, 15682, 12135, 5263, 15826, 3747, 13205, 9358, 9879, 13724,
+    13689, 4811, 20669, 14747, 14446, 17739, 3462, 18550, 12093, 11902, 15683, 13109,
+    13602, 8956, 166, 8570, 5916, 10473, 6414, 14928, 12607, 6586, 13553, 9947,
+    16099, 12557, 828, 6415, 6411, 20357, 6759, 16912, 20453, 18542, 19634, 7827,
+    17175, 833, 18959, 12608, 16528, 969, 6893, 17249, 14284, 5856, 20876, 13392,
+    13393, 3666, 4984, 9183, 17250, 10384, 16127, 19462, 16530, 3911, 4813, 5509,
+    8068, 19438, 13206, 19569, 4334, 4985, 18501, 8758, 1452, 8646, 13967, 73,
+    13026, 6416, 17053, 5636, 13968, 8893, 9136, 8894, 10421, 19817, 16505, 3546,
+    9549, 4853, 8732, 16305, 18723, 2682, 6308, 18630, 15231, 9557, 3745, 219,
+    5318, 248, 11659, 10900, 9522, 18634, 19503, 4203, 249, 425, 5506, 11476,
+    14494, 4911, 7005, 7851, 15591, 3575, 15052, 19434, 5507, 8058, 6381, 6817,
+    16286, 19504, 16497, 17241, 4548, 8698, 8936, 6563, 8749, 13721, 14924, 5001,
+    13278, 5797, 7695, 6385, 18578, 12404, 9275, 11883, 20786, 3784, 8237, 1426,
+    4742, 10848, 10902, 2968, 7185, 13549, 13685, 20660, 3909, 3036, 564, 1450,
+    14791, 15680, 15500, 13143, 3535, 12498, 4220, 5849, 12714, 6753, 726, 13202,
+    164, 11892, 14444, 4809, 17734, 11274, 6576, 8569, 827, 17174, 832, 9943,
+    10471, 18538, 15653, 16094, 4982, 13390, 9181, 20875, 5633, 4333, 8756, 19566,
+    4824, 10940, 18012, 4116, 8829, 7310, 1051, 17541, 4146, 2963, 6169, 3984,
+    13045, 4312, 13681, 3985, 10494, 407, 18995, 19968, 5627, 12355, 4038, 303,
+    15703, 6564, 13683, 18926, 4006, 17690, 7639, 7640, 11499, 5722, 19864, 409,
+    17549, 17298, 19927, 3739, 3986, 15704, 11163, 2517, 4456, 13012, 9276, 10413,
+    4125, 15288, 10446, 8842, 743, 20147, 4457, 18998, 2193, 12626, 16578, 1726,
+    2613, 7399, 17759, 4677, 3114, 18934, 17603, 12970, 17300, 14956, 18935, 14898,
+    18402, 3294, 15824, 3579, 4765, 60, 19969, 17556, 5389, 16584, 6484, 9129,
+    20334, 17639, 14792, 5464, 9853, 13018, 10613, 4460, 12860, 6830, 16909, 20260,
+    19970, 9854, 5394, 10930, 3548, 9726, 6485, 6400, 15146, 5723, 15302, 1060,
+    15854, 7540, 18948, 1025, 7727, 17276, 563, 16056, 7728, 7430, 15112, 7186,
+    14795, 3459, 3460, 8101, 5576, 15889, 13551, 8363, 6926, 11257, 9644, 11485,
+    13898, 4133, 96, 20603, 11401, 12364, 12051, 453, 2971, 9645, 12775, 6579,
+    7432, 15159, 17302, 19000, 11895, 8716, 17864, 20507, 7970, 3423, 8240, 13626,
+    11896, 7188, 18206, 18207, 7189, 20667, 8350, 3117, 11814, 2132, 4537, 7402,
+    7655, 18234, 20884, 6205, 13962, 18410, 1817, 10383, 12990, 98, 12504, 14798,
+    5580, 14799, 3541, 6954, 10036, 4134, 2106, 15147, 17493, 5332, 19058, 11532,
+    8241, 10123, 5581, 18411, 2044, 15941, 7435, 3150, 1181, 3762, 5355, 18423,
+    19059, 16301, 15743, 13690, 5356, 1947, 14646, 16243, 13110, 9359, 6295, 4678,
+    6584, 14383, 5184, 2196, 2197, 18217, 17787, 17567, 6211, 8880, 14873, 7999,
+    14757, 14758, 18218, 15148, 9880, 6836, 4403, 14874, 1585, 6296, 15180, 19765,
+    167, 17764, 17908, 11167, 1818, 20166, 9390, 18543, 9667, 703, 13995, 20608,
+    18799, 15857, 7668, 18321, 14801, 14096, 6838, 18222, 5668, 704, 18427, 14285,
+    5857, 3701, 6839, 9080, 17575, 4405, 7356, 16353, 16354, 15149, 9912, 20877,
+    18960, 18428, 9652, 15181, 16355, 17172, 18224, 11522, 1961, 9819, 16070, 17987,
+    6220, 19420, 18800, 19570, 17868, 17644, 11523, 11033, 5637, 10272, 18429, 10218,
+    2816, 19135, 18961, 8626, 437, 9550, 5358, 9443, 13999, 19137, 18430, 4854,
+    12645, 8733, 9744, 10937, 7301, 6140, 18975, 10478, 13660, 11156, 17292, 1171,
+    396, 19848, 4662, 3103, 9518, 17294, 16547, 17599, 9242, 1711, 12615, 18980,
+    17163, 15276, 14063, 20103, 3571, 4755, 16900, 5385, 20249, 4450, 9722, 5443,
+    15846, 997, 8679, 7536, 4702, 3450, 18894, 16328, 14772, 15878, 12774, 10381,
+    87, 8230, 450, 11385, 12036, 2131, 4531, 18993, 14259, 5563, 5320, 3523,
+    4711, 12492, 2185, 10114, 15931, 18160, 17778, 15740, 9339, 6281, 18161, 6565,
+    5348, 17901, 18403, 19763, 9383, 9067, 6831, 7351, 18940, 9640, 5758, 19562,
+    18409, 5631, 10209, 4850, 13996, 9555, 7077, 9277, 6643, 16350, 2410, 6648,
+    6652, 17445, 2408, 9597, 18595, 2288, 6313, 11297, 2289, 11298, 20426, 7696,
+    20376, 6573, 10257, 10258, 18839, 9353, 1583, 7699, 9176, 10851, 11897, 9646,
+    7354, 7700, 7190, 8866, 16472, 16351, 6460, 10263, 8881, 13508, 19635, 9184,
+    7193, 11904, 9292, 17446, 2290, 9921, 9917, 5321, 1510, 4039, 10373, 10367,
+    4041, 11306, 12664, 12600, 10614, 4042, 16440, 8351, 12603, 10375, 1820, 3959,
+    4026, 12596, 10374, 9864, 10076, 10516, 5911, 10596, 20788, 11121, 3893, 5827,
+    5817, 7078, 4871, 14848, 15093, 5462, 5690, 8124, 5465, 13911, 8699, 10903,
+    1731, 5363, 5362, 18162, 12087, 2574, 16173, 15221, 10580, 10573, 12088, 2520,
+    1996, 18663, 2922, 17906, 16241, 17489, 12604, 10140, 17494, 12421, 19130, 8717,
+    2638, 3224, 1152, 17392, 17439, 17498, 2576, 127, 19840, 2526, 1153, 17909,
+    10124, 19590, 17507, 3233, 9551, 20045, 3895, 4132, 4165, 10365, 10350, 19053,
+    2309, 12667, 1503, 15331, 20339, 19973, 10217, 168, 834, 15293, 705, 19028,
+    1495, 15291, 3063, 10319, 10716, 3065, 20653, 4706, 4707, 3115, 3888, 14715,
+    19002, 11488, 1428, 4404, 11971, 19003, 14609, 14731, 13914, 13907, 3886, 3831,
+    15710, 237, 2969, 15289, 20198, 12630, 13625, 13722, 18689, 13723, 15000, 15856,
+    10928, 7191, 6050, 7436, 17500, 15113, 14097, 16068, 16445, 17505, 8602, 568,
+    17760, 12555, 5102, 15936, 15938, 5477, 16757, 3543, 19483, 16938, 15756, 19484,
+    11080, 10760, 11877, 19529, 6401, 20668, 6212, 6218, 11817, 6182, 1777, 1602,
+    1604, 5330, 17323, 18320, 16754, 387, 19418, 16755, 1305, 1729, 17495, 7455,
+    14927, 9286, 9281, 1918, 12721, 16756, 7941, 10993, 7355, 17763, 2156, 8256,
+    18841, 1960, 18025, 10852, 19419, 20790, 12653, 19203, 17506, 11169, 3545, 15800,
+    18226, 2168, 20791, 2910, 1962, 7151, 17360, 1763, 1598, 5306, 18305, 7449,
+    9266, 382, 14918, 20651, 7937, 18833, 2150, 12652, 15799, 9415, 11275, 4582,
+    11276, 17496, 9433, 9455, 4583, 7787, 2469, 9293, 2470, 9393, 4571, 7783,
+    4919, 12506, 836, 4888, 19126, 2089, 5335, 7671, 16690, 18963,
+};
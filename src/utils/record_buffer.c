@@ -0,0 +1,144 @@
+#include "utils/record_buffer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief 初始化记录缓冲区
+ *
+ * @param buffer 缓冲区
+ * @param record_size 每条记录字节数
+ * @param chunk_records 每块记录数，0表示按默认块大小计算
+ */
+void record_buffer_init(RecordBuffer *buffer, size_t record_size, size_t chunk_records)
+{
+    memset(buffer, 0, sizeof(RecordBuffer));
+    buffer->record_size = record_size;
+    if (chunk_records == 0)
+    {
+        chunk_records = RECORD_BUFFER_CHUNK_BYTES / record_size;
+    }
+    buffer->chunk_records = chunk_records > 0 ? chunk_records : 1;
+}
+
+/**
+ * @brief 追加一条记录
+ *
+ * @param buffer 缓冲区
+ * @return void* 新记录（已清零），内存不足时返回NULL
+ */
+void *record_buffer_append(RecordBuffer *buffer)
+{
+    size_t offset = buffer->count % buffer->chunk_records;
+    if (offset == 0 && buffer->count / buffer->chunk_records == buffer->chunk_count)
+    {
+        if (buffer->chunk_count == buffer->chunk_cap)
+        {
+            size_t cap = buffer->chunk_cap ? buffer->chunk_cap * 2 : 16;
+            char **chunks = realloc(buffer->chunks, cap * sizeof(char *));
+            if (!chunks)
+            {
+                fprintf(stderr, "内存分配失败：记录缓冲区\n");
+                return NULL;
+            }
+            buffer->chunks = chunks;
+            buffer->chunk_cap = cap;
+        }
+        char *chunk = malloc(buffer->chunk_records * buffer->record_size);
+        if (!chunk)
+        {
+            fprintf(stderr, "内存分配失败：记录缓冲区\n");
+            return NULL;
+        }
+        buffer->chunks[buffer->chunk_count++] = chunk;
+    }
+
+    char *record = buffer->chunks[buffer->count / buffer->chunk_records] + offset * buffer->record_size;
+    memset(record, 0, buffer->record_size);
+    buffer->count++;
+    return record;
+}
+
+/**
+ * @brief 按下标取记录
+ *
+ * @param buffer 缓冲区
+ * @param index 下标，须小于count
+ * @return void* 记录指针
+ */
+void *record_buffer_at(const RecordBuffer *buffer, size_t index)
+{
+    return buffer->chunks[index / buffer->chunk_records] + (index % buffer->chunk_records) * buffer->record_size;
+}
+
+/**
+ * @brief 排序全部记录
+ *
+ * 记录分散在多个块中，先拷贝到一段连续内存排序再按顺序写回
+ *
+ * @param buffer 缓冲区
+ * @param compare 比较函数
+ * @return bool 成功返回true，内存不足返回false（记录顺序不变）
+ */
+bool record_buffer_sort(RecordBuffer *buffer, int (*compare)(const void *, const void *))
+{
+    if (buffer->count < 2)
+    {
+        return true;
+    }
+    if (buffer->chunk_count == 1)
+    {
+        qsort(buffer->chunks[0], buffer->count, buffer->record_size, compare);
+        return true;
+    }
+
+    char *flat = malloc(buffer->count * buffer->record_size);
+    if (!flat)
+    {
+        fprintf(stderr, "内存分配失败：记录缓冲区排序\n");
+        return false;
+    }
+    for (size_t c = 0, copied = 0; c < buffer->chunk_count; c++)
+    {
+        size_t n = buffer->count - copied < buffer->chunk_records ? buffer->count - copied : buffer->chunk_records;
+        memcpy(flat + copied * buffer->record_size, buffer->chunks[c], n * buffer->record_size);
+        copied += n;
+    }
+    qsort(flat, buffer->count, buffer->record_size, compare);
+    for (size_t c = 0, copied = 0; c < buffer->chunk_count; c++)
+    {
+        size_t n = buffer->count - copied < buffer->chunk_records ? buffer->count - copied : buffer->chunk_records;
+        memcpy(buffer->chunks[c], flat + copied * buffer->record_size, n * buffer->record_size);
+        copied += n;
+    }
+    free(flat);
+    return true;
+}
+
+/**
+ * @brief 清空记录，保留已分配的块供再次追加
+ *
+ * @param buffer 缓冲区
+ */
+void record_buffer_clear(RecordBuffer *buffer)
+{
+    buffer->count = 0;
+}
+
+/**
+ * @brief 释放缓冲区的全部内存
+ *
+ * @param buffer 缓冲区
+ */
+void record_buffer_free(RecordBuffer *buffer)
+{
+    for (size_t c = 0; c < buffer->chunk_count; c++)
+    {
+        free(buffer->chunks[c]);
+    }
+    free(buffer->chunks);
+    buffer->chunks = NULL;
+    buffer->chunk_count = 0;
+    buffer->chunk_cap = 0;
+    buffer->count = 0;
+}
@@ -0,0 +1,459 @@
+#include "utils/row_sort.h"
+#include "utils/hash_map.h"
+#include "utils/pinyin.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define ROW_ID_BYTES 4
+#define INSERTION_THRESHOLD 32 // 桶内行数少于此值时改用插入排序
+#define MIN_RUN_ROWS 1024
+
+// 文本列的编码方式
+typedef enum
+{
+    TEXT_PREFIX, // 所有取值的拼音键都不超过前缀，直接编码拼音键
+    TEXT_RANK    // 有取值超出前缀，编码其在全部不同取值中的拼音名次
+} TextMode;
+
+// 一列在键中的编码
+typedef struct
+{
+    size_t width;    // 字节数，含空值标记
+    TextMode mode;
+    uint32_t *ranks; // TEXT_RANK时每行的名次
+} KeyColumn;
+
+// 键的布局
+typedef struct
+{
+    const RowSortColumn *columns;
+    int column_count;
+    KeyColumn keys[ROW_SORT_MAX_COLUMNS];
+    size_t width; // 每行键的字节数，含行号
+} KeyLayout;
+
+static bool is_null(const RowSortColumn *column, size_t row)
+{
+    return (column->nulls && column->nulls[row]) || (column->type == ROW_SORT_TEXT && !column->texts[row]);
+}
+
+static void put_u64(unsigned char *out, uint64_t value)
+{
+    for (int i = 7; i >= 0; i--)
+    {
+        out[i] = (unsigned char)value;
+        value >>= 8;
+    }
+}
+
+static void put_u32(unsigned char *out, uint32_t value)
+{
+    out[0] = (unsigned char)(value >> 24);
+    out[1] = (unsigned char)(value >> 16);
+    out[2] = (unsigned char)(value >> 8);
+    out[3] = (unsigned char)value;
+}
+
+static const char *entry_key(const void *record)
+{
+    return ((const HashEntry *)record)->key;
+}
+
+/**
+ * 为文本列计算每行的名次：不同取值去重后按拼音排序，名次即其位置
+ */
+static bool rank_text_column(const RowSortColumn *column, size_t n, KeyColumn *key)
+{
+    HashMap values;
+    key->ranks = malloc(n * sizeof(uint32_t));
+    if (!key->ranks || !hash_map_init(&values, 256))
+    {
+        return false;
+    }
+    bool ok = true;
+    for (size_t i = 0; ok && i < n; i++)
+    {
+        const char *text = column->texts[i];
+        if (!is_null(column, i) && !hash_map_get(&values, text, strlen(text)))
+        {
+            ok = hash_map_put(&values, text, strlen(text), &values);
+        }
+    }
+
+    void **entries = ok ? malloc((values.count + 1) * sizeof(void *)) : NULL;
+    size_t count = 0, index = 0;
+    HashEntry *entry;
+    while (entries && (entry = hash_map_next(&values, &index)) != NULL)
+    {
+        entries[count++] = entry;
+    }
+    ok = entries && pinyin_sort_records(entries, count, entry_key);
+    for (size_t i = 0; ok && i < count; i++)
+    {
+        ((HashEntry *)entries[i])->value = (void *)(uintptr_t)i;
+    }
+    for (size_t i = 0; ok && i < n; i++)
+    {
+        const char *text = column->texts[i];
+        key->ranks[i] = is_null(column, i) ? 0 : (uint32_t)(uintptr_t)hash_map_get(&values, text, strlen(text));
+    }
+    free(entries);
+    hash_map_free(&values);
+    return ok;
+}
+
+/**
+ * 确定各列的编码：数值列定长8字节；文本列取最长的拼音键，超过前缀时改为名次
+ */
+static bool plan_layout(KeyLayout *layout, size_t n, size_t text_limit)
+{
+    layout->width = ROW_ID_BYTES;
+    for (int i = 0; i < layout->column_count; i++)
+    {
+        const RowSortColumn *column = &layout->columns[i];
+        KeyColumn *key = &layout->keys[i];
+        key->width = 1 + sizeof(uint64_t);
+        if (column->type == ROW_SORT_TEXT)
+        {
+            size_t longest = 0;
+            for (size_t row = 0; row < n; row++)
+            {
+                if (!is_null(column, row))
+                {
+                    size_t len = pinyin_sort_key(column->texts[row], strlen(column->texts[row]), NULL, 0);
+                    longest = len > longest ? len : longest;
+                }
+            }
+            key->mode = longest <= text_limit ? TEXT_PREFIX : TEXT_RANK;
+            key->width = 1 + (key->mode == TEXT_PREFIX ? longest : sizeof(uint32_t));
+            if (key->mode == TEXT_RANK && !rank_text_column(column, n, key))
+            {
+                fprintf(stderr, "内存分配失败：排序名次\n");
+                return false;
+            }
+        }
+        layout->width += key->width;
+    }
+    return true;
+}
+
+/**
+ * 编码一行的键：每列一个空值标记字节加定长取值，降序列整体取反，最后是大端行号
+ */
+static void encode_row(const KeyLayout *layout, uint32_t row, unsigned char *out)
+{
+    for (int i = 0; i < layout->column_count; i++)
+    {
+        const RowSortColumn *column = &layout->columns[i];
+        const KeyColumn *key = &layout->keys[i];
+        memset(out, 0, key->width);
+        if (!is_null(column, row))
+        {
+            out[0] = 1;
+            switch (column->type)
+            {
+            case ROW_SORT_INT:
+                // 翻转符号位后按无符号比较即为有符号顺序
+                put_u64(out + 1, (uint64_t)column->ints[row] ^ (1ULL << 63));
+                break;
+            case ROW_SORT_REAL:
+            {
+                // 正数翻转符号位，负数全部取反，按无符号比较即为数值顺序
+                double value = column->reals[row] == 0 ? 0.0 : column->reals[row];
+                uint64_t bits;
+                memcpy(&bits, &value, sizeof(bits));
+                put_u64(out + 1, (bits >> 63) ? ~bits : bits ^ (1ULL << 63));
+                break;
+            }
+            case ROW_SORT_TEXT:
+                // 拼音键不足列宽时补0，短的排在前面
+                if (key->mode == TEXT_RANK)
+                    put_u32(out + 1, key->ranks[row]);
+                else
+                    pinyin_sort_key(column->texts[row], strlen(column->texts[row]), out + 1, key->width - 1);
+                break;
+            }
+        }
+        if (column->descending)
+        {
+            for (size_t j = 0; j < key->width; j++)
+            {
+                out[j] = (unsigned char)~out[j];
+            }
+        }
+        out += key->width;
+    }
+    put_u32(out, row);
+}
+
+static uint32_t key_row(const KeyLayout *layout, const unsigned char *key)
+{
+    const unsigned char *id = key + layout->width - ROW_ID_BYTES;
+    return ((uint32_t)id[0] << 24) | ((uint32_t)id[1] << 16) | ((uint32_t)id[2] << 8) | id[3];
+}
+
+/**
+ * 从第depth字节起插入排序，scratch至少能放一个键
+ */
+static void insertion_sort(unsigned char *keys, size_t n, size_t width, size_t depth, unsigned char *scratch)
+{
+    for (size_t i = 1; i < n; i++)
+    {
+        size_t j = i;
+        if (memcmp(keys + (j - 1) * width + depth, keys + j * width + depth, width - depth) <= 0)
+        {
+            continue;
+        }
+        memcpy(scratch, keys + i * width, width);
+        while (j > 0 && memcmp(keys + (j - 1) * width + depth, scratch + depth, width - depth) > 0)
+        {
+            memcpy(keys + j * width, keys + (j - 1) * width, width);
+            j--;
+        }
+        memcpy(keys + j * width, scratch, width);
+    }
+}
+
+/**
+ * MSD基数排序：按第depth字节分桶，各桶递归处理下一字节；
+ * 整批键在该字节上相同时直接看下一字节。tmp与keys等长，作分桶缓冲
+ */
+static void radix_sort(unsigned char *keys, unsigned char *tmp, size_t n, size_t width, size_t depth)
+{
+    while (n > INSERTION_THRESHOLD && depth < width)
+    {
+        size_t counts[256] = {0};
+        for (size_t i = 0; i < n; i++)
+        {
+            counts[keys[i * width + depth]]++;
+        }
+        if (counts[keys[depth]] == n)
+        {
+            depth++;
+            continue;
+        }
+
+        size_t offsets[256], next[256], sum = 0;
+        for (int b = 0; b < 256; b++)
+        {
+            offsets[b] = next[b] = sum;
+            sum += counts[b];
+        }
+        for (size_t i = 0; i < n; i++)
+        {
+            const unsigned char *key = keys + i * width;
+            memcpy(tmp + next[key[depth]]++ * width, key, width);
+        }
+        memcpy(keys, tmp, n * width);
+
+        for (int b = 0; b < 256; b++)
+        {
+            if (counts[b] > 1)
+            {
+                radix_sort(keys + offsets[b] * width, tmp + offsets[b] * width, counts[b], width, depth + 1);
+            }
+        }
+        return;
+    }
+    if (n > 1 && depth < width)
+    {
+        insertion_sort(keys, n, width, depth, tmp);
+    }
+}
+
+static bool sort_in_memory(const KeyLayout *layout, size_t n, uint32_t *order)
+{
+    size_t width = layout->width;
+    unsigned char *keys = malloc(n * width);
+    unsigned char *tmp = malloc(n * width);
+    if (!keys || !tmp)
+    {
+        fprintf(stderr, "内存分配失败：排序键\n");
+        free(keys);
+        free(tmp);
+        return false;
+    }
+    for (size_t i = 0; i < n; i++)
+    {
+        encode_row(layout, (uint32_t)i, keys + i * width);
+    }
+    radix_sort(keys, tmp, n, width, 0);
+    for (size_t i = 0; i < n; i++)
+    {
+        order[i] = key_row(layout, keys + i * width);
+    }
+    free(keys);
+    free(tmp);
+    return true;
+}
+
+// 多路归并的一路
+typedef struct
+{
+    FILE *fp;
+    unsigned char *key; // 当前键
+} MergeRun;
+
+static bool run_less(const MergeRun *a, const MergeRun *b, size_t width)
+{
+    return memcmp(a->key, b->key, width) < 0;
+}
+
+static void sift_down(MergeRun *heap, size_t count, size_t i, size_t width)
+{
+    for (;;)
+    {
+        size_t smallest = i, left = 2 * i + 1, right = left + 1;
+        if (left < count && run_less(&heap[left], &heap[smallest], width))
+            smallest = left;
+        if (right < count && run_less(&heap[right], &heap[smallest], width))
+            smallest = right;
+        if (smallest == i)
+            return;
+        MergeRun swap = heap[i];
+        heap[i] = heap[smallest];
+        heap[smallest] = swap;
+        i = smallest;
+    }
+}
+
+/**
+ * 外部排序：每段run_rows行在内存中排好后写入临时文件，最后用小根堆多路归并
+ */
+static bool sort_external(const KeyLayout *layout, size_t n, size_t run_rows, uint32_t *order, RowSortStats *stats)
+{
+    size_t width = layout->width;
+    size_t run_count = (n + run_rows - 1) / run_rows;
+    unsigned char *keys = malloc(run_rows * width);
+    unsigned char *tmp = malloc(run_rows * width);
+    MergeRun *runs = calloc(run_count, sizeof(MergeRun));
+    unsigned char *heads = malloc(run_count * width);
+    bool ok = keys && tmp && runs && heads;
+    if (!ok)
+    {
+        fprintf(stderr, "内存分配失败：外部排序\n");
+    }
+
+    size_t written = 0;
+    for (size_t r = 0; ok && r < run_count; r++)
+    {
+        size_t rows = n - written < run_rows ? n - written : run_rows;
+        for (size_t i = 0; i < rows; i++)
+        {
+            encode_row(layout, (uint32_t)(written + i), keys + i * width);
+        }
+        radix_sort(keys, tmp, rows, width, 0);
+        runs[r].fp = tmpfile();
+        runs[r].key = heads + r * width;
+        ok = runs[r].fp && fwrite(keys, width, rows, runs[r].fp) == rows && fflush(runs[r].fp) == 0;
+        if (ok)
+        {
+            rewind(runs[r].fp);
+            ok = fread(runs[r].key, width, 1, runs[r].fp) == 1;
+        }
+        if (!ok)
+        {
+            fprintf(stderr, "写入排序临时文件失败\n");
+        }
+        written += rows;
+    }
+    // 归并时不再需要段缓冲
+    free(keys);
+    free(tmp);
+
+    if (ok)
+    {
+        for (size_t i = run_count; i-- > 0;)
+        {
+            sift_down(runs, run_count, i, width);
+        }
+        size_t active = run_count, out = 0;
+        while (active > 0)
+        {
+            order[out++] = key_row(layout, runs[0].key);
+            if (fread(runs[0].key, width, 1, runs[0].fp) != 1)
+            {
+                MergeRun done = runs[0];
+                runs[0] = runs[--active];
+                runs[active] = done;
+            }
+            sift_down(runs, active, 0, width);
+        }
+        ok = out == n;
+    }
+
+    for (size_t r = 0; runs && r < run_count; r++)
+    {
+        if (runs[r].fp)
+            fclose(runs[r].fp);
+    }
+    free(runs);
+    free(heads);
+    stats->external = true;
+    stats->run_count = (int)run_count;
+    return ok;
+}
+
+/**
+ * 多列排序
+ *
+ * @param columns 排序列，按优先级排列
+ * @param column_count 列数，1至ROW_SORT_MAX_COLUMNS
+ * @param row_count 行数
+ * @param options 选项，NULL表示默认
+ * @param order 输出参数，长度为row_count，排序后的行号
+ * @param stats 输出参数，可为NULL
+ * @return 成功返回true
+ */
+bool row_sort(const RowSortColumn *columns, int column_count, size_t row_count, const RowSortOptions *options,
+              uint32_t *order, RowSortStats *stats)
+{
+    struct timespec started, finished;
+    clock_gettime(CLOCK_MONOTONIC, &started);
+    RowSortStats local;
+    if (!stats)
+    {
+        stats = &local;
+    }
+    memset(stats, 0, sizeof(RowSortStats));
+
+    if (column_count < 1 || column_count > ROW_SORT_MAX_COLUMNS || row_count > UINT32_MAX)
+    {
+        fprintf(stderr, "排序参数无效\n");
+        return false;
+    }
+
+    int prefix = options && options->text_prefix > 0 ? options->text_prefix : ROW_SORT_DEFAULT_PREFIX;
+    size_t budget = options && options->memory_budget > 0 ? options->memory_budget : ROW_SORT_DEFAULT_BUDGET;
+    KeyLayout layout;
+    memset(&layout, 0, sizeof(KeyLayout));
+    layout.columns = columns;
+    layout.column_count = column_count;
+    bool ok = plan_layout(&layout, row_count, (size_t)prefix * PINYIN_KEY_CHAR_BYTES);
+    stats->key_width = layout.width;
+    for (int i = 0; i < column_count; i++)
+    {
+        stats->ranked_columns += layout.keys[i].mode == TEXT_RANK;
+    }
+
+    // 键和分桶缓冲各一份
+    if (ok && row_count * layout.width * 2 <= budget)
+    {
+        ok = sort_in_memory(&layout, row_count, order);
+    }
+    else if (ok)
+    {
+        size_t run_rows = budget / (layout.width * 2);
+        ok = sort_external(&layout, row_count, run_rows < MIN_RUN_ROWS ? MIN_RUN_ROWS : run_rows, order, stats);
+    }
+    for (int i = 0; i < column_count; i++)
+    {
+        free(layout.keys[i].ranks);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &finished);
+    stats->elapsed_seconds = (finished.tv_sec - started.tv_sec) + (finished.tv_nsec - started.tv_nsec) / 1e9;
+    return ok;
+}
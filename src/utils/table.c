@@ -0,0 +1,408 @@
+#include "utils/table.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#ifndef _WIN32
+#include <sys/ioctl.h>
+#endif
+
+#define TABLE_DEFAULT_SCREEN_ROWS 24
+#define TABLE_RESERVED_ROWS 4 // 每屏留给表头、分隔线和提示的行数
+#define TABLE_NULL_CELL ((size_t)-1)
+
+static const char ELLIPSIS[] = "…"; // 截断标记，显示宽度1
+
+// 显示宽度为2的区间（Unicode East Asian Width为W或F），按起点升序
+static const uint32_t WIDE_RANGES[][2] = {
+    {0x1100, 0x115F},   {0x2E80, 0x303E},   {0x3041, 0x33FF},   {0x3400, 0x4DBF}, {0x4E00, 0x9FFF},
+    {0xA000, 0xA4CF},   {0xA960, 0xA97F},   {0xAC00, 0xD7A3},   {0xF900, 0xFAFF}, {0xFE10, 0xFE19},
+    {0xFE30, 0xFE6F},   {0xFF00, 0xFF60},   {0xFFE0, 0xFFE6},   {0x1F300, 0x1F64F}, {0x1F900, 0x1F9FF},
+    {0x20000, 0x2FFFD}, {0x30000, 0x3FFFD},
+};
+
+// 显示宽度为0的区间（组合附加符号、零宽字符、变体选择符）
+static const uint32_t ZERO_RANGES[][2] = {
+    {0x0300, 0x036F}, {0x200B, 0x200F}, {0x20D0, 0x20FF}, {0xFE00, 0xFE0F}, {0xFE20, 0xFE2F},
+};
+
+static bool in_ranges(uint32_t cp, const uint32_t (*ranges)[2], int count)
+{
+    int lo = 0, hi = count - 1;
+    while (lo <= hi)
+    {
+        int mid = (lo + hi) / 2;
+        if (cp < ranges[mid][0])
+            hi = mid - 1;
+        else if (cp > ranges[mid][1])
+            lo = mid + 1;
+        else
+            return true;
+    }
+    return false;
+}
+
+/**
+ * 解码一个UTF-8字符，返回字节数；非法序列按1字节的U+FFFD处理
+ */
+static int utf8_next(const unsigned char *s, uint32_t *cp)
+{
+    if (s[0] < 0x80)
+    {
+        *cp = s[0];
+        return 1;
+    }
+    int len = (s[0] & 0xE0) == 0xC0 ? 2 : (s[0] & 0xF0) == 0xE0 ? 3 : (s[0] & 0xF8) == 0xF0 ? 4 : 0;
+    if (len == 0)
+    {
+        *cp = 0xFFFD;
+        return 1;
+    }
+    uint32_t value = s[0] & (0x7F >> len);
+    for (int i = 1; i < len; i++)
+    {
+        if ((s[i] & 0xC0) != 0x80)
+        {
+            *cp = 0xFFFD;
+            return 1;
+        }
+        value = (value << 6) | (s[i] & 0x3F);
+    }
+    *cp = value;
+    return len;
+}
+
+static int codepoint_width(uint32_t cp)
+{
+    if (cp < 0x20 || (cp >= 0x7F && cp < 0xA0))
+        return 0;
+    if (cp < 0x300)
+        return 1;
+    if (in_ranges(cp, ZERO_RANGES, sizeof(ZERO_RANGES) / sizeof(ZERO_RANGES[0])))
+        return 0;
+    if (in_ranges(cp, WIDE_RANGES, sizeof(WIDE_RANGES) / sizeof(WIDE_RANGES[0])))
+        return 2;
+    return 1;
+}
+
+/**
+ * @brief 计算字符串的显示宽度
+ *
+ * @param text UTF-8字符串，NULL按空串处理
+ * @return int 显示宽度
+ */
+int display_width(const char *text)
+{
+    int width = 0;
+    const unsigned char *p = (const unsigned char *)text;
+    while (p && *p)
+    {
+        uint32_t cp;
+        p += utf8_next(p, &cp);
+        width += codepoint_width(cp);
+    }
+    return width;
+}
+
+/**
+ * 显示宽度不超过limit的最长前缀的字节数，width输出该前缀的宽度
+ */
+static size_t fit_prefix(const char *text, int limit, int *width)
+{
+    const unsigned char *p = (const unsigned char *)text;
+    *width = 0;
+    while (*p)
+    {
+        uint32_t cp;
+        int len = utf8_next(p, &cp);
+        int w = codepoint_width(cp);
+        if (*width + w > limit)
+        {
+            break;
+        }
+        *width += w;
+        p += len;
+    }
+    return (size_t)(p - (const unsigned char *)text);
+}
+
+/**
+ * @brief 获取终端行数
+ *
+ * @return int 终端可显示的行数，标准输出不是终端时返回默认值24
+ */
+int table_screen_rows(void)
+{
+#ifndef _WIN32
+    struct winsize size;
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0 && size.ws_row > 0)
+    {
+        return size.ws_row;
+    }
+#endif
+    return TABLE_DEFAULT_SCREEN_ROWS;
+}
+
+static bool out_reserve(Table *table, size_t extra)
+{
+    if (table->out_len + extra <= table->out_cap)
+    {
+        return true;
+    }
+    size_t cap = table->out_cap ? table->out_cap : 8192;
+    while (cap < table->out_len + extra)
+    {
+        cap *= 2;
+    }
+    char *grown = realloc(table->out, cap);
+    if (!grown)
+    {
+        table->failed = true;
+        return false;
+    }
+    table->out = grown;
+    table->out_cap = cap;
+    return true;
+}
+
+static void out_append(Table *table, const char *text, size_t len)
+{
+    if (out_reserve(table, len))
+    {
+        memcpy(table->out + table->out_len, text, len);
+        table->out_len += len;
+    }
+}
+
+static void out_repeat(Table *table, char c, int count)
+{
+    if (count > 0 && out_reserve(table, (size_t)count))
+    {
+        memset(table->out + table->out_len, c, (size_t)count);
+        table->out_len += (size_t)count;
+    }
+}
+
+/**
+ * 单元格的显示宽度（计入截断）
+ */
+static int cell_width(const TableColumn *column, const char *text)
+{
+    int width = display_width(text);
+    return column->max_width > 0 && width > column->max_width ? column->max_width : width;
+}
+
+/**
+ * 按列宽输出一个单元格，last为行末列时左对齐不补尾部空格
+ */
+static void render_cell(Table *table, int column, const char *text, bool last)
+{
+    const TableColumn *def = &table->columns[column];
+    int width = display_width(text);
+    size_t len = strlen(text);
+    bool truncated = def->max_width > 0 && width > def->max_width;
+    if (truncated)
+    {
+        len = fit_prefix(text, def->max_width - 1, &width);
+        width += 1;
+    }
+
+    int pad = table->widths[column] - width;
+    if (def->align == TABLE_ALIGN_RIGHT)
+        out_repeat(table, ' ', pad);
+    out_append(table, text, len);
+    if (truncated)
+        out_append(table, ELLIPSIS, sizeof(ELLIPSIS) - 1);
+    if (def->align == TABLE_ALIGN_LEFT && !last)
+        out_repeat(table, ' ', pad);
+}
+
+/**
+ * 一次写出缓冲区（先冲刷stdio中此前的输出，保证顺序）
+ */
+static void write_out(Table *table)
+{
+    fflush(stdout);
+    size_t written = 0;
+    while (written < table->out_len)
+    {
+        ssize_t n = write(STDOUT_FILENO, table->out + written, table->out_len - written);
+        if (n <= 0)
+        {
+            break;
+        }
+        written += (size_t)n;
+    }
+    table->out_len = 0;
+}
+
+/**
+ * 渲染本页：先按本页内容放宽列宽，再格式化到输出缓冲区并一次写出
+ */
+static void render_page(Table *table)
+{
+    for (int r = 0; r < table->page_count; r++)
+    {
+        for (int c = 0; c < table->column_count; c++)
+        {
+            size_t offset = table->offsets[r * table->column_count + c];
+            if (offset != TABLE_NULL_CELL)
+            {
+                int width = cell_width(&table->columns[c], table->cells + offset);
+                if (width > table->widths[c])
+                    table->widths[c] = width;
+            }
+        }
+    }
+
+    if (!table->header_done)
+    {
+        int total = 0;
+        for (int c = 0; c < table->column_count; c++)
+        {
+            if (c > 0)
+                out_repeat(table, ' ', TABLE_COLUMN_GAP);
+            render_cell(table, c, table->columns[c].title, c == table->column_count - 1);
+            total += table->widths[c] + (c > 0 ? TABLE_COLUMN_GAP : 0);
+        }
+        out_append(table, "\n", 1);
+        out_repeat(table, '-', total);
+        out_append(table, "\n", 1);
+        table->header_done = true;
+    }
+
+    for (int r = 0; r < table->page_count; r++)
+    {
+        for (int c = 0; c < table->column_count; c++)
+        {
+            size_t offset = table->offsets[r * table->column_count + c];
+            if (c > 0)
+                out_repeat(table, ' ', TABLE_COLUMN_GAP);
+            render_cell(table, c, offset == TABLE_NULL_CELL ? "" : table->cells + offset,
+                        c == table->column_count - 1);
+        }
+        out_append(table, "\n", 1);
+    }
+
+    write_out(table);
+    table->page_count = 0;
+    table->cells_len = 0;
+}
+
+/**
+ * @brief 开始一个表格
+ *
+ * @param table 表格
+ * @param columns 列定义，须在table_end之前保持有效
+ * @param column_count 列数
+ * @param page_rows 每页行数，<=0时按终端高度
+ * @return bool 成功返回true
+ */
+bool table_begin(Table *table, const TableColumn *columns, int column_count, int page_rows)
+{
+    memset(table, 0, sizeof(Table));
+    table->columns = columns;
+    table->column_count = column_count;
+    table->page_rows = page_rows > 0 ? page_rows : table_screen_rows() - TABLE_RESERVED_ROWS;
+    if (table->page_rows < 1)
+    {
+        table->page_rows = 1;
+    }
+
+    table->widths = calloc(column_count, sizeof(int));
+    table->offsets = malloc((size_t)table->page_rows * column_count * sizeof(size_t));
+    if (!table->widths || !table->offsets)
+    {
+        fprintf(stderr, "内存分配失败：表格\n");
+        free(table->widths);
+        free(table->offsets);
+        table->widths = NULL;
+        table->offsets = NULL;
+        table->failed = true;
+        return false;
+    }
+    for (int c = 0; c < column_count; c++)
+    {
+        table->widths[c] = cell_width(&columns[c], columns[c].title);
+    }
+    return true;
+}
+
+/**
+ * @brief 添加一行
+ *
+ * @param table 表格
+ * @param values 各列的值，NULL显示为空
+ */
+void table_add_row(Table *table, const char *const *values)
+{
+    if (table->failed)
+    {
+        return;
+    }
+
+    size_t need = 0;
+    for (int c = 0; c < table->column_count; c++)
+    {
+        need += values[c] ? strlen(values[c]) + 1 : 0;
+    }
+    if (table->cells_len + need > table->cells_cap)
+    {
+        size_t cap = table->cells_cap ? table->cells_cap : 4096;
+        while (cap < table->cells_len + need)
+        {
+            cap *= 2;
+        }
+        char *grown = realloc(table->cells, cap);
+        if (!grown)
+        {
+            fprintf(stderr, "内存分配失败：表格\n");
+            table->failed = true;
+            return;
+        }
+        table->cells = grown;
+        table->cells_cap = cap;
+    }
+
+    size_t *offsets = table->offsets + (size_t)table->page_count * table->column_count;
+    for (int c = 0; c < table->column_count; c++)
+    {
+        if (!values[c])
+        {
+            offsets[c] = TABLE_NULL_CELL;
+            continue;
+        }
+        size_t len = strlen(values[c]) + 1;
+        offsets[c] = table->cells_len;
+        memcpy(table->cells + table->cells_len, values[c], len);
+        table->cells_len += len;
+    }
+
+    table->row_count++;
+    if (++table->page_count == table->page_rows)
+    {
+        render_page(table);
+    }
+}
+
+/**
+ * @brief 结束表格：写出剩余行（没有数据行时只写表头）并释放资源
+ *
+ * @param table 表格
+ * @return long 总行数
+ */
+long table_end(Table *table)
+{
+    if (table->widths && (table->page_count > 0 || !table->header_done))
+    {
+        render_page(table);
+    }
+    free(table->widths);
+    free(table->offsets);
+    free(table->cells);
+    free(table->out);
+    long rows = table->row_count;
+    memset(table, 0, sizeof(Table));
+    return rows;
+}
@@ -0,0 +1,301 @@
+#include "utils/thread_pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+
+typedef HANDLE pool_thread_t;
+typedef CRITICAL_SECTION pool_mutex_t;
+typedef CONDITION_VARIABLE pool_cond_t;
+
+#define pool_mutex_init(m) InitializeCriticalSection(m)
+#define pool_mutex_destroy(m) DeleteCriticalSection(m)
+#define pool_mutex_lock(m) EnterCriticalSection(m)
+#define pool_mutex_unlock(m) LeaveCriticalSection(m)
+#define pool_cond_init(c) InitializeConditionVariable(c)
+#define pool_cond_destroy(c) ((void)0)
+#define pool_cond_wait(c, m) SleepConditionVariableCS(c, m, INFINITE)
+#define pool_cond_signal(c) WakeConditionVariable(c)
+#define pool_cond_broadcast(c) WakeAllConditionVariable(c)
+#else
+#include <pthread.h>
+#include <unistd.h>
+
+typedef pthread_t pool_thread_t;
+typedef pthread_mutex_t pool_mutex_t;
+typedef pthread_cond_t pool_cond_t;
+
+#define pool_mutex_init(m) pthread_mutex_init(m, NULL)
+#define pool_mutex_destroy(m) pthread_mutex_destroy(m)
+#define pool_mutex_lock(m) pthread_mutex_lock(m)
+#define pool_mutex_unlock(m) pthread_mutex_unlock(m)
+#define pool_cond_init(c) pthread_cond_init(c, NULL)
+#define pool_cond_destroy(c) pthread_cond_destroy(c)
+#define pool_cond_wait(c, m) pthread_cond_wait(c, m)
+#define pool_cond_signal(c) pthread_cond_signal(c)
+#define pool_cond_broadcast(c) pthread_cond_broadcast(c)
+#endif
+
+typedef struct
+{
+    ThreadTask task;
+    void *arg;
+} PoolJob;
+
+struct ThreadPool
+{
+    pool_mutex_t lock;
+    pool_cond_t not_empty; // 队列非空，唤醒工作线程
+    pool_cond_t not_full;  // 队列有空位，唤醒提交方
+    pool_cond_t idle;      // 全部任务完成，唤醒等待方
+
+    PoolJob *queue; // 环形队列
+    size_t capacity;
+    size_t head;
+    size_t count;
+
+    int running; // 正在执行的任务数
+    int failed;  // 失败的任务数
+    bool stopping;
+
+    pool_thread_t *threads;
+    int thread_count;
+};
+
+/**
+ * @brief 工作线程主循环
+ */
+#ifdef _WIN32
+static unsigned __stdcall worker_main(void *data)
+#else
+static void *worker_main(void *data)
+#endif
+{
+    ThreadPool *pool = (ThreadPool *)data;
+
+    for (;;)
+    {
+        pool_mutex_lock(&pool->lock);
+        while (pool->count == 0 && !pool->stopping)
+        {
+            pool_cond_wait(&pool->not_empty, &pool->lock);
+        }
+        if (pool->count == 0 && pool->stopping)
+        {
+            pool_mutex_unlock(&pool->lock);
+            break;
+        }
+
+        PoolJob job = pool->queue[pool->head];
+        pool->head = (pool->head + 1) % pool->capacity;
+        pool->count--;
+        pool->running++;
+        pool_cond_signal(&pool->not_full);
+        pool_mutex_unlock(&pool->lock);
+
+        bool ok = job.task(job.arg);
+
+        pool_mutex_lock(&pool->lock);
+        pool->running--;
+        if (!ok)
+        {
+            pool->failed++;
+        }
+        if (pool->count == 0 && pool->running == 0)
+        {
+            pool_cond_broadcast(&pool->idle);
+        }
+        pool_mutex_unlock(&pool->lock);
+    }
+
+#ifdef _WIN32
+    return 0;
+#else
+    return NULL;
+#endif
+}
+
+/**
+ * @brief 获取系统CPU核数
+ *
+ * @return int CPU核数，至少为1
+ */
+int thread_pool_cpu_count(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int)count : 1;
+#endif
+}
+
+/**
+ * @brief 创建线程池
+ *
+ * @param thread_count 工作线程数，<=0时使用CPU核数
+ * @param queue_capacity 任务队列容量，为0时取线程数的4倍
+ * @return ThreadPool* 线程池，失败返回NULL
+ */
+ThreadPool *thread_pool_create(int thread_count, size_t queue_capacity)
+{
+    if (thread_count <= 0)
+    {
+        thread_count = thread_pool_cpu_count();
+    }
+    if (queue_capacity == 0)
+    {
+        queue_capacity = (size_t)thread_count * 4;
+    }
+
+    ThreadPool *pool = calloc(1, sizeof(ThreadPool));
+    if (!pool)
+    {
+        fprintf(stderr, "内存分配失败：线程池\n");
+        return NULL;
+    }
+    pool->queue = calloc(queue_capacity, sizeof(PoolJob));
+    pool->threads = calloc(thread_count, sizeof(pool_thread_t));
+    if (!pool->queue || !pool->threads)
+    {
+        fprintf(stderr, "内存分配失败：线程池\n");
+        free(pool->queue);
+        free(pool->threads);
+        free(pool);
+        return NULL;
+    }
+    pool->capacity = queue_capacity;
+
+    pool_mutex_init(&pool->lock);
+    pool_cond_init(&pool->not_empty);
+    pool_cond_init(&pool->not_full);
+    pool_cond_init(&pool->idle);
+
+    for (int i = 0; i < thread_count; i++)
+    {
+#ifdef _WIN32
+        pool->threads[i] = (HANDLE)_beginthreadex(NULL, 0, worker_main, pool, 0, NULL);
+        bool started = pool->threads[i] != 0;
+#else
+        bool started = pthread_create(&pool->threads[i], NULL, worker_main, pool) == 0;
+#endif
+        if (!started)
+        {
+            fprintf(stderr, "创建工作线程失败\n");
+            break;
+        }
+        pool->thread_count++;
+    }
+
+    if (pool->thread_count == 0)
+    {
+        thread_pool_destroy(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+/**
+ * @brief 提交任务
+ *
+ * 队列满时阻塞，直到有工作线程取走任务，避免生产方无限堆积内存
+ *
+ * @param pool 线程池
+ * @param task 任务函数
+ * @param arg 任务参数，由任务函数负责释放
+ * @return bool 提交成功返回true，线程池正在销毁时返回false
+ */
+bool thread_pool_submit(ThreadPool *pool, ThreadTask task, void *arg)
+{
+    pool_mutex_lock(&pool->lock);
+    while (pool->count == pool->capacity && !pool->stopping)
+    {
+        pool_cond_wait(&pool->not_full, &pool->lock);
+    }
+    if (pool->stopping)
+    {
+        pool_mutex_unlock(&pool->lock);
+        return false;
+    }
+
+    size_t tail = (pool->head + pool->count) % pool->capacity;
+    pool->queue[tail].task = task;
+    pool->queue[tail].arg = arg;
+    pool->count++;
+    pool_cond_signal(&pool->not_empty);
+    pool_mutex_unlock(&pool->lock);
+    return true;
+}
+
+/**
+ * @brief 等待已提交的任务全部完成
+ *
+ * @param pool 线程池
+ * @return int 自上次等待以来失败的任务数
+ */
+int thread_pool_wait(ThreadPool *pool)
+{
+    pool_mutex_lock(&pool->lock);
+    while (pool->count > 0 || pool->running > 0)
+    {
+        pool_cond_wait(&pool->idle, &pool->lock);
+    }
+    int failed = pool->failed;
+    pool->failed = 0;
+    pool_mutex_unlock(&pool->lock);
+    return failed;
+}
+
+/**
+ * @brief 销毁线程池
+ *
+ * 已提交的任务会执行完毕后再退出工作线程
+ *
+ * @param pool 线程池
+ */
+void thread_pool_destroy(ThreadPool *pool)
+{
+    if (!pool)
+    {
+        return;
+    }
+
+    pool_mutex_lock(&pool->lock);
+    pool->stopping = true;
+    pool_cond_broadcast(&pool->not_empty);
+    pool_cond_broadcast(&pool->not_full);
+    pool_mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < pool->thread_count; i++)
+    {
+#ifdef _WIN32
+        WaitForSingleObject(pool->threads[i], INFINITE);
+        CloseHandle(pool->threads[i]);
+#else
+        pthread_join(pool->threads[i], NULL);
+#endif
+    }
+
+    pool_mutex_destroy(&pool->lock);
+    pool_cond_destroy(&pool->not_empty);
+    pool_cond_destroy(&pool->not_full);
+    pool_cond_destroy(&pool->idle);
+    free(pool->queue);
+    free(pool->threads);
+    free(pool);
+}
+
+/**
+ * @brief 获取线程池大小
+ *
+ * @param pool 线程池
+ * @return int 工作线程数
+ */
+int thread_pool_size(const ThreadPool *pool)
+{
+    return pool->thread_count;
+}
@@ -88,6 +88,30 @@ bool hash_password(const char *password, char *hashed_output, size_t output_size
     return true;
 }
 
+/**
+ * 计算本地日期的天序号
+ *
+ * 取time所在的本地日期，返回该日期距1970-01-01的天数，同一天内任意时刻结果相同
+ *
+ * @param time_val 时间
+ * @return 天序号
+ */
+long local_day_number(time_t time_val)
+{
+    struct tm tm_info;
+    localtime_r(&time_val, &tm_info);
+
+    // 公历日期转天数（以3月为年首，闰日落在年末）
+    long year = tm_info.tm_year + 1900;
+    int month = tm_info.tm_mon + 1;
+    year -= month <= 2;
+    long era = (year >= 0 ? year : year - 399) / 400;
+    long year_of_era = year - era * 400;
+    long day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + tm_info.tm_mday - 1;
+    long day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * 146097 + day_of_era - 719468;
+}
+
 /**
  * @brief 格式化时间为字符串
  *
@@ -0,0 +1,168 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "db/database.h"
+#include "models/billing.h"
+#include "models/late_fee.h"
+
+#define TEST_DB "test_late_fee.db"
+#define DAY 86400
+
+#define CHECK(cond)                                                              \
+    do                                                                           \
+    {                                                                            \
+        if (!(cond))                                                             \
+        {                                                                        \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);     \
+            failures++;                                                          \
+        }                                                                        \
+    } while (0)
+
+#define CHECK_AMOUNT(actual, expected)                                                          \
+    do                                                                                          \
+    {                                                                                           \
+        double a_ = (actual), e_ = (expected);                                                  \
+        if (fabs(a_ - e_) > 0.005)                                                              \
+        {                                                                                       \
+            printf("%s:%d: %s = %.2f, expected %.2f\n", __FILE__, __LINE__, #actual, a_, e_);   \
+            failures++;                                                                         \
+        }                                                                                       \
+    } while (0)
+
+static int failures = 0;
+
+static void remove_db(void)
+{
+    remove(TEST_DB);
+    remove(TEST_DB "-wal");
+    remove(TEST_DB "-shm");
+}
+
+// 执行返回单个数值的查询，arg绑定到第一个参数（如有）
+static double query_double(Database *db, const char *sql, long long arg)
+{
+    sqlite3_stmt *stmt;
+    double value = -1;
+    if (sqlite3_prepare_v2(db->db, sql, -1, &stmt, NULL) == SQLITE_OK)
+    {
+        sqlite3_bind_int64(stmt, 1, arg);
+        if (sqlite3_step(stmt) == SQLITE_ROW)
+        {
+            value = sqlite3_column_double(stmt, 0);
+        }
+        sqlite3_finalize(stmt);
+    }
+    return value;
+}
+
+static double billed_late_fees(Database *db)
+{
+    return query_double(db, "SELECT COALESCE(SUM(amount), 0) FROM transactions WHERE fee_type = 6", 0);
+}
+
+static double run_total(Database *db, time_t day)
+{
+    return query_double(db, "SELECT total_amount FROM late_fee_runs WHERE accrual_date = ?", day);
+}
+
+// 预览与实际计提同一日期，两者的账单数和金额须一致，并与预期的增量相符
+static void accrue_and_compare(Database *db, time_t day, int expected_bills, double expected_amount)
+{
+    BillingPreview preview;
+    CHECK(preview_late_fees(db, day, BILLING_PREVIEW_TOP_N, &preview));
+    double before = billed_late_fees(db);
+
+    LateFeeAccrual accrual;
+    CHECK(accrue_late_fees(db, day, &accrual));
+    CHECK(!accrual.already_accrued);
+    CHECK(accrual.bill_count == expected_bills);
+    CHECK_AMOUNT(accrual.total_amount, expected_amount);
+    CHECK(preview.summary.bill_count == accrual.bill_count);
+    CHECK_AMOUNT(preview.summary.total_amount, accrual.total_amount);
+    CHECK_AMOUNT(run_total(db, accrual.accrual_date), accrual.total_amount);
+    CHECK_AMOUNT(billed_late_fees(db) - before, accrual.total_amount);
+    free_billing_preview(&preview);
+}
+
+static void seed(Database *db, time_t first_day)
+{
+    CHECK(db_execute(db,
+                     "INSERT INTO buildings (building_id, building_name, address, floors_count) "
+                     "VALUES ('b1', '1号楼', '测试路1号', 6);"
+                     "INSERT INTO users (user_id, username, password_hash, name, role_id, registration_date) "
+                     "VALUES ('u1', 'owner1', 'x', '业主一', 'role_owner', 0);"
+                     "INSERT INTO rooms (room_id, building_id, room_number, floor, area_sqm, owner_id, status) "
+                     "VALUES ('r1', 'b1', '101', 1, 90, 'u1', 1);") == SQLITE_OK);
+
+    // 三张逾期账单，首次计提时分别已过宽限期45、85、385天（宽限15天）
+    static const struct
+    {
+        const char *id;
+        double amount;
+        int overdue_days;
+    } BILLS[] = {{"t1", 1000, 60}, {"t2", 2000, 100}, {"t3", 500, 400}};
+    for (int i = 0; i < 3; i++)
+    {
+        char sql[512];
+        time_t due = first_day - (time_t)BILLS[i].overdue_days * DAY;
+        snprintf(sql, sizeof(sql),
+                 "INSERT INTO transactions (transaction_id, user_id, room_id, fee_type, amount, payment_date, "
+                 "due_date, status, period_start, period_end) VALUES ('%s', 'u1', 'r1', 1, %.2f, 0, %lld, 2, %lld, %lld)",
+                 BILLS[i].id, BILLS[i].amount, (long long)due, (long long)(due - 30 * DAY), (long long)due);
+        CHECK(db_execute(db, sql) == SQLITE_OK);
+    }
+}
+
+int main(void)
+{
+    remove_db();
+    Database db;
+    if (db_init(&db, TEST_DB) != SQLITE_OK)
+    {
+        printf("无法创建测试数据库\n");
+        return 1;
+    }
+
+    struct tm tm_day = {0};
+    tm_day.tm_year = 2026 - 1900;
+    tm_day.tm_mon = 5;
+    tm_day.tm_mday = 1;
+    tm_day.tm_isdst = -1;
+    time_t day1 = mktime(&tm_day);
+    seed(&db, day1);
+
+    // 规则：日万分之五，宽限15天，封顶为本金
+    // 首次计提：1000*0.0005*45 + 2000*0.0005*85 + 500*0.0005*385
+    accrue_and_compare(&db, day1, 3, 22.5 + 85 + 96.25);
+
+    // 6天后再次计提：追加到未缴清的滞纳金账单，本次只计6天的增量
+    time_t day2 = day1 + 6 * DAY;
+    accrue_and_compare(&db, day2, 3, (1000 + 2000 + 500) * 0.0005 * 6);
+
+    // 滞纳金账单缴清后继续计提：新开账单，仍只计3天的增量
+    CHECK(db_execute(&db, "UPDATE transactions SET status = 1 WHERE fee_type = 6") == SQLITE_OK);
+    time_t day3 = day2 + 3 * DAY;
+    accrue_and_compare(&db, day3, 3, (1000 + 2000 + 500) * 0.0005 * 3);
+    CHECK(query_double(&db, "SELECT COUNT(*) FROM transactions WHERE fee_type = 6", 0) == 6);
+
+    // 同一日期重复计提：返回首次结果，不再写入
+    double before = billed_late_fees(&db);
+    LateFeeAccrual again;
+    CHECK(accrue_late_fees(&db, day3, &again));
+    CHECK(again.already_accrued);
+    CHECK_AMOUNT(again.total_amount, (1000 + 2000 + 500) * 0.0005 * 3);
+    CHECK_AMOUNT(billed_late_fees(&db), before);
+
+    db_close_quiet(&db);
+    remove_db();
+
+    if (failures > 0)
+    {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("late fee tests passed\n");
+    return 0;
+}
@@ -0,0 +1,170 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "utils/record_buffer.h"
+
+#define CHECK(cond)                                                           \
+    do                                                                        \
+    {                                                                         \
+        if (!(cond))                                                          \
+        {                                                                     \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);   \
+            failures++;                                                       \
+        }                                                                     \
+    } while (0)
+
+typedef struct
+{
+    int key;
+    int sequence;
+    char name[20];
+} TestRecord;
+
+static int failures = 0;
+
+static int compare_key(const void *a, const void *b)
+{
+    const TestRecord *x = a, *y = b;
+    if (x->key != y->key)
+        return (x->key > y->key) - (x->key < y->key);
+    return (x->sequence > y->sequence) - (x->sequence < y->sequence);
+}
+
+static bool is_zero(const void *p, size_t size)
+{
+    const unsigned char *bytes = p;
+    for (size_t i = 0; i < size; i++)
+    {
+        if (bytes[i])
+            return false;
+    }
+    return true;
+}
+
+// 默认块大小按记录大小计算
+static void test_init(void)
+{
+    RecordBuffer buffer;
+    record_buffer_init(&buffer, sizeof(TestRecord), 0);
+    CHECK(buffer.chunk_records == RECORD_BUFFER_CHUNK_BYTES / sizeof(TestRecord));
+    CHECK(buffer.count == 0 && buffer.chunk_count == 0);
+    record_buffer_free(&buffer);
+
+    // 记录比块还大时每块至少一条
+    record_buffer_init(&buffer, RECORD_BUFFER_CHUNK_BYTES * 2, 0);
+    CHECK(buffer.chunk_records == 1);
+    record_buffer_free(&buffer);
+}
+
+// 跨块追加：新记录已清零，按下标取回的内容与写入一致，已有记录不移动
+static void test_append_at(void)
+{
+    RecordBuffer buffer;
+    record_buffer_init(&buffer, sizeof(TestRecord), 4);
+    TestRecord *first = NULL;
+    for (int i = 0; i < 37; i++)
+    {
+        TestRecord *record = record_buffer_append(&buffer);
+        CHECK(record != NULL);
+        if (!record)
+            break;
+        CHECK(is_zero(record, sizeof(TestRecord)));
+        record->key = i * 3;
+        record->sequence = i;
+        snprintf(record->name, sizeof(record->name), "业主%d", i);
+        if (i == 0)
+            first = record;
+    }
+    CHECK(buffer.count == 37);
+    CHECK(buffer.chunk_count == 10);
+    CHECK(record_buffer_at(&buffer, 0) == first);
+    for (size_t i = 0; i < buffer.count; i++)
+    {
+        const TestRecord *record = record_buffer_at(&buffer, i);
+        char expected[20];
+        snprintf(expected, sizeof(expected), "业主%d", (int)i);
+        CHECK(record->key == (int)i * 3 && record->sequence == (int)i && strcmp(record->name, expected) == 0);
+    }
+    record_buffer_free(&buffer);
+    CHECK(buffer.chunks == NULL && buffer.chunk_count == 0 && buffer.count == 0);
+}
+
+// 排序结果与qsort一致，覆盖单块、多块和重复键
+static void test_sort(size_t count, size_t chunk_records)
+{
+    RecordBuffer buffer;
+    record_buffer_init(&buffer, sizeof(TestRecord), chunk_records);
+    TestRecord *expected = malloc(count * sizeof(TestRecord));
+    CHECK(expected != NULL || count == 0);
+    srand(42);
+    for (size_t i = 0; i < count; i++)
+    {
+        TestRecord *record = record_buffer_append(&buffer);
+        record->key = rand() % 50;
+        record->sequence = (int)i;
+        snprintf(record->name, sizeof(record->name), "r%zu", i);
+        expected[i] = *record;
+    }
+    if (count > 0)
+        qsort(expected, count, sizeof(TestRecord), compare_key);
+
+    CHECK(record_buffer_sort(&buffer, compare_key));
+    CHECK(buffer.count == count);
+    for (size_t i = 0; i < count; i++)
+    {
+        CHECK(memcmp(record_buffer_at(&buffer, i), &expected[i], sizeof(TestRecord)) == 0);
+    }
+    free(expected);
+    record_buffer_free(&buffer);
+}
+
+// 清空后保留块，再次追加的记录仍为清零状态，且不再分配新块
+static void test_clear(void)
+{
+    RecordBuffer buffer;
+    record_buffer_init(&buffer, sizeof(TestRecord), 8);
+    for (int i = 0; i < 20; i++)
+    {
+        TestRecord *record = record_buffer_append(&buffer);
+        memset(record, 0xAB, sizeof(TestRecord));
+    }
+    size_t chunks = buffer.chunk_count;
+    char *first_chunk = buffer.chunks[0];
+
+    record_buffer_clear(&buffer);
+    CHECK(buffer.count == 0);
+    CHECK(buffer.chunk_count == chunks);
+
+    for (int i = 0; i < 20; i++)
+    {
+        TestRecord *record = record_buffer_append(&buffer);
+        CHECK(record != NULL && is_zero(record, sizeof(TestRecord)));
+        record->key = i;
+    }
+    CHECK(buffer.count == 20);
+    CHECK(buffer.chunk_count == chunks);
+    CHECK(buffer.chunks[0] == first_chunk);
+    CHECK(((TestRecord *)record_buffer_at(&buffer, 19))->key == 19);
+    record_buffer_free(&buffer);
+}
+
+int main(void)
+{
+    printf("Record buffer tests\n");
+    test_init();
+    test_append_at();
+    test_sort(0, 4);
+    test_sort(1, 4);
+    test_sort(3, 4);      // 单块
+    test_sort(1000, 7);   // 多块，末块不满
+    test_sort(1024, 256); // 多块，末块正好满
+    test_clear();
+
+    if (failures > 0)
+    {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("all passed\n");
+    return 0;
+}
@@ -0,0 +1,171 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "utils/pinyin.h"
+#include "utils/row_sort.h"
+
+#define ROWS 20000
+
+#define CHECK(cond)                                                              \
+    do                                                                           \
+    {                                                                            \
+        if (!(cond))                                                             \
+        {                                                                        \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);     \
+            failures++;                                                          \
+        }                                                                        \
+    } while (0)
+
+static const char *BUILDINGS[] = {"翠苑一号楼", "翠苑二号楼", "阳光花园A座", "阳光花园B座", "Bamboo Court",
+                                  "长青苑", "", NULL};
+
+// 按列存放的测试数据：欠费（含负数和零）、面积（部分为空）、楼宇（含空串和空值）、房号、注册时间
+static double outstanding[ROWS];
+static double area[ROWS];
+static uint8_t area_null[ROWS];
+static const char *building[ROWS];
+static char room_storage[ROWS][16];
+static const char *room[ROWS];
+static int64_t registered[ROWS];
+
+static RowSortColumn columns[ROW_SORT_MAX_COLUMNS];
+static int column_count;
+static int failures = 0;
+
+static void fill(void)
+{
+    static const int64_t EDGE_INTS[] = {INT64_MIN, -1, 0, 1, INT64_MAX};
+    srand(12345);
+    for (size_t i = 0; i < ROWS; i++)
+    {
+        outstanding[i] = (rand() % 5 == 0) ? 0 : (rand() % 200000) / 100.0 - 100;
+        area[i] = 60 + rand() % 120 + (rand() % 4) * 0.25;
+        area_null[i] = rand() % 20 == 0;
+        building[i] = BUILDINGS[rand() % 8];
+        snprintf(room_storage[i], sizeof(room_storage[i]), "%d-%d", rand() % 30 + 1, rand() % 8 + 1);
+        room[i] = room_storage[i];
+        registered[i] = rand() % 50 == 0 ? EDGE_INTS[rand() % 5] : 1600000000 + rand() % 100000000;
+    }
+}
+
+// 参照实现：逐行按完整值比较，空值升序时在前、降序时在后，全部相同时按行号
+static int reference_compare(const void *pa, const void *pb)
+{
+    uint32_t a = *(const uint32_t *)pa, b = *(const uint32_t *)pb;
+    for (int i = 0; i < column_count; i++)
+    {
+        const RowSortColumn *c = &columns[i];
+        bool na = (c->nulls && c->nulls[a]) || (c->type == ROW_SORT_TEXT && !c->texts[a]);
+        bool nb = (c->nulls && c->nulls[b]) || (c->type == ROW_SORT_TEXT && !c->texts[b]);
+        int r;
+        if (na || nb)
+            r = nb - na;
+        else if (c->type == ROW_SORT_TEXT)
+            r = pinyin_compare(c->texts[a], strlen(c->texts[a]), c->texts[b], strlen(c->texts[b]));
+        else if (c->type == ROW_SORT_REAL)
+            r = (c->reals[a] > c->reals[b]) - (c->reals[a] < c->reals[b]);
+        else
+            r = (c->ints[a] > c->ints[b]) - (c->ints[a] < c->ints[b]);
+        if (r != 0)
+            return c->descending ? -r : r;
+    }
+    return (a > b) - (a < b);
+}
+
+// 用qsort参照实现核对row_sort的结果
+static void check_case(const char *name, size_t rows, const RowSortOptions *options, RowSortStats *stats)
+{
+    static uint32_t expected[ROWS], order[ROWS];
+    for (uint32_t i = 0; i < rows; i++)
+        expected[i] = i;
+    qsort(expected, rows, sizeof(uint32_t), reference_compare);
+
+    memset(order, 0xFF, sizeof(order));
+    bool sorted = row_sort(columns, column_count, rows, options, order, stats);
+    CHECK(sorted);
+    if (sorted && memcmp(expected, order, sizeof(uint32_t) * rows) != 0)
+    {
+        size_t at = 0;
+        while (expected[at] == order[at])
+            at++;
+        printf("%s: order differs from reference at position %zu (expected row %u, got %u)\n", name, at,
+               expected[at], order[at]);
+        failures++;
+    }
+}
+
+int main(void)
+{
+    printf("Row sort tests\n");
+    fill();
+    RowSortStats stats;
+
+    // 欠费降序、面积升序（空值在前）
+    columns[0] = (RowSortColumn){.type = ROW_SORT_REAL, .descending = true, .reals = outstanding};
+    columns[1] = (RowSortColumn){.type = ROW_SORT_REAL, .reals = area, .nulls = area_null};
+    column_count = 2;
+    check_case("outstanding desc,area", ROWS, NULL, &stats);
+    CHECK(!stats.external);
+
+    // 面积降序时空值在后
+    columns[0] = (RowSortColumn){.type = ROW_SORT_REAL, .descending = true, .reals = area, .nulls = area_null};
+    column_count = 1;
+    check_case("area desc", ROWS, NULL, &stats);
+
+    // 楼宇（含空串和空值）、房号、注册时间降序（含int64边界值）
+    columns[0] = (RowSortColumn){.type = ROW_SORT_TEXT, .texts = building};
+    columns[1] = (RowSortColumn){.type = ROW_SORT_TEXT, .texts = room};
+    columns[2] = (RowSortColumn){.type = ROW_SORT_INT, .descending = true, .ints = registered};
+    column_count = 3;
+    check_case("building,room,registered desc", ROWS, NULL, &stats);
+
+    // 楼宇降序时空值在后
+    columns[0].descending = true;
+    check_case("building desc,room,registered desc", ROWS, NULL, &stats);
+
+    // 前缀很短时楼宇名按名次编码
+    RowSortOptions short_prefix = {.text_prefix = 3};
+    check_case("building desc,room,registered desc(prefix 3)", ROWS, &short_prefix, &stats);
+    CHECK(stats.ranked_columns > 0);
+
+    // 内存上限很小时走外部归并，结果应与内存排序一致
+    RowSortOptions small_budget = {.memory_budget = 16 * 1024};
+    check_case("building desc,room,registered desc(external)", ROWS, &small_budget, &stats);
+    CHECK(stats.external);
+    CHECK(stats.run_count > 1);
+
+    columns[0] = (RowSortColumn){.type = ROW_SORT_REAL, .reals = area, .nulls = area_null};
+    columns[1] = (RowSortColumn){.type = ROW_SORT_REAL, .descending = true, .reals = outstanding};
+    column_count = 2;
+    check_case("area,outstanding desc(external)", ROWS, &small_budget, &stats);
+    CHECK(stats.external && stats.run_count > 1);
+
+    // 外部归并与前缀名次编码同时使用
+    RowSortOptions both = {.memory_budget = 16 * 1024, .text_prefix = 2};
+    columns[0] = (RowSortColumn){.type = ROW_SORT_TEXT, .texts = building};
+    columns[1] = (RowSortColumn){.type = ROW_SORT_INT, .ints = registered};
+    check_case("building,registered(external,prefix 2)", ROWS, &both, &stats);
+    CHECK(stats.external && stats.ranked_columns > 0);
+
+    // 全部相同的键按行号排列；0行和1行
+    static int64_t same[ROWS];
+    columns[0] = (RowSortColumn){.type = ROW_SORT_INT, .descending = true, .ints = same};
+    column_count = 1;
+    check_case("constant", ROWS, NULL, &stats);
+    check_case("constant(external)", ROWS, &small_budget, &stats);
+    check_case("one row", 1, NULL, &stats);
+    check_case("no rows", 0, NULL, &stats);
+
+    // 参数无效
+    uint32_t order[1];
+    CHECK(!row_sort(columns, 0, 1, NULL, order, NULL));
+    CHECK(!row_sort(columns, ROW_SORT_MAX_COLUMNS + 1, 1, NULL, order, NULL));
+
+    if (failures > 0)
+    {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("all passed\n");
+    return 0;
+}